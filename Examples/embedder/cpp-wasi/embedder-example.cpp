@@ -15,7 +15,6 @@
 #include "WAVM/Runtime/Intrinsics.h"
 #include "WAVM/Runtime/Linker.h"
 #include "WAVM/Runtime/Runtime.h"
-#include "WAVM/VFS/SandboxFS.h"
 #include "WAVM/WASI/WASI.h"
 #include "WAVM/WASM/WASM.h"
 
@@ -105,7 +104,7 @@ int main(int argc, char** argv)
 	for(int argIndex = 1; argIndex < argc; ++argIndex) { wasiArgs.push_back(argv[argIndex]); }
 
 	std::shared_ptr<VFS::FileSystem> sandboxFS
-		= VFS::makeSandboxFS(&Platform::getHostFS(), Platform::getCurrentWorkingDirectory());
+		= Platform::makeHostSandboxFS(Platform::getCurrentWorkingDirectory());
 
 	std::shared_ptr<WASI::Process> process
 		= createProcess(compartment,
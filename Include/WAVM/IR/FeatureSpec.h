@@ -27,7 +27,8 @@
 	V(exceptionHandling, "exception-handling", "Exception handling")                               \
 	V(extendedNameSection, "extended-name-section", "Extended name section")                       \
 	V(multipleMemories, "multi-memory", "Multiple memories")                                       \
-	V(memory64, "memory64", "Memories with 64-bit addresses")
+	V(memory64, "memory64", "Memories with 64-bit addresses")                                      \
+	V(relaxedSIMD, "relaxed-simd", "Relaxed SIMD")
 
 // Non-standard extensions. These are disabled by default, but may be enabled on the command-line.
 #define WAVM_ENUM_NONSTANDARD_FEATURES(V)                                                          \
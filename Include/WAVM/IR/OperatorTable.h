@@ -597,6 +597,27 @@
 	visitOp(0xfdfd, i32x4_trunc_sat_f64x2_u_zero  , "i32x4.trunc_sat_f64x2_u_zero"  , NoImm                     , v128_to_v128              , simd                   )   \
 	visitOp(0xfdfe, f64x2_convert_low_i32x4_s     , "f64x2.convert_low_i32x4_s"     , NoImm                     , v128_to_v128              , simd                   )   \
 	visitOp(0xfdff, f64x2_convert_low_i32x4_u     , "f64x2.convert_low_i32x4_u"     , NoImm                     , v128_to_v128              , simd                   )   \
+/* Relaxed SIMD (see relaxedSIMDOpcodePrefix in Operators.h)                                                                                                          */ \
+	visitOp(0xfa00, i8x16_relaxed_swizzle         , "i8x16.relaxed_swizzle"         , NoImm                     , v128_v128_to_v128         , relaxedSIMD            )   \
+	visitOp(0xfa01, i32x4_relaxed_trunc_f32x4_s   , "i32x4.relaxed_trunc_f32x4_s"   , NoImm                     , v128_to_v128              , relaxedSIMD            )   \
+	visitOp(0xfa02, i32x4_relaxed_trunc_f32x4_u   , "i32x4.relaxed_trunc_f32x4_u"   , NoImm                     , v128_to_v128              , relaxedSIMD            )   \
+	visitOp(0xfa03, i32x4_relaxed_trunc_f64x2_s_zero, "i32x4.relaxed_trunc_f64x2_s_zero", NoImm                     , v128_to_v128              , relaxedSIMD            )   \
+	visitOp(0xfa04, i32x4_relaxed_trunc_f64x2_u_zero, "i32x4.relaxed_trunc_f64x2_u_zero", NoImm                     , v128_to_v128              , relaxedSIMD            )   \
+	visitOp(0xfa05, f32x4_relaxed_madd            , "f32x4.relaxed_madd"            , NoImm                     , v128_v128_v128_to_v128    , relaxedSIMD            )   \
+	visitOp(0xfa06, f32x4_relaxed_nmadd           , "f32x4.relaxed_nmadd"           , NoImm                     , v128_v128_v128_to_v128    , relaxedSIMD            )   \
+	visitOp(0xfa07, f64x2_relaxed_madd            , "f64x2.relaxed_madd"            , NoImm                     , v128_v128_v128_to_v128    , relaxedSIMD            )   \
+	visitOp(0xfa08, f64x2_relaxed_nmadd           , "f64x2.relaxed_nmadd"           , NoImm                     , v128_v128_v128_to_v128    , relaxedSIMD            )   \
+	visitOp(0xfa09, i8x16_relaxed_laneselect      , "i8x16.relaxed_laneselect"      , NoImm                     , v128_v128_v128_to_v128    , relaxedSIMD            )   \
+	visitOp(0xfa0a, i16x8_relaxed_laneselect      , "i16x8.relaxed_laneselect"      , NoImm                     , v128_v128_v128_to_v128    , relaxedSIMD            )   \
+	visitOp(0xfa0b, i32x4_relaxed_laneselect      , "i32x4.relaxed_laneselect"      , NoImm                     , v128_v128_v128_to_v128    , relaxedSIMD            )   \
+	visitOp(0xfa0c, i64x2_relaxed_laneselect      , "i64x2.relaxed_laneselect"      , NoImm                     , v128_v128_v128_to_v128    , relaxedSIMD            )   \
+	visitOp(0xfa0d, f32x4_relaxed_min             , "f32x4.relaxed_min"             , NoImm                     , v128_v128_to_v128         , relaxedSIMD            )   \
+	visitOp(0xfa0e, f32x4_relaxed_max             , "f32x4.relaxed_max"             , NoImm                     , v128_v128_to_v128         , relaxedSIMD            )   \
+	visitOp(0xfa0f, f64x2_relaxed_min             , "f64x2.relaxed_min"             , NoImm                     , v128_v128_to_v128         , relaxedSIMD            )   \
+	visitOp(0xfa10, f64x2_relaxed_max             , "f64x2.relaxed_max"             , NoImm                     , v128_v128_to_v128         , relaxedSIMD            )   \
+	visitOp(0xfa11, i16x8_relaxed_q15mulr_s       , "i16x8.relaxed_q15mulr_s"       , NoImm                     , v128_v128_to_v128         , relaxedSIMD            )   \
+	visitOp(0xfa12, i16x8_relaxed_dot_i8x16_i7x16_s, "i16x8.relaxed_dot_i8x16_i7x16_s", NoImm                     , v128_v128_to_v128         , relaxedSIMD            )   \
+	visitOp(0xfa13, i32x4_relaxed_dot_i8x16_i7x16_add_s, "i32x4.relaxed_dot_i8x16_i7x16_add_s", NoImm                     , v128_v128_v128_to_v128    , relaxedSIMD            )   \
 /* Atomic fence                                                                                                                                                       */ \
 	visitOp(0xfe03, atomic_fence                  , "atomic.fence"                  , AtomicFenceImm            , none_to_none              , atomics                )
 
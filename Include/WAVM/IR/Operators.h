@@ -181,6 +181,11 @@ namespace WAVM { namespace IR {
 
 	static constexpr U64 maxSingleByteOpcode = 0xdf;
 
+	// The relaxed SIMD operators are encoded in the binary format as 0xfd followed by a sub-opcode
+	// >= 0x100, which doesn't fit in a 16-bit Opcode. They are represented as Opcodes with this
+	// prefix, which isn't used by the binary format, and the sub-opcode - 0x100.
+	static constexpr U8 relaxedSIMDOpcodePrefix = 0xfa;
+
 	template<typename Imm> struct OpcodeAndImm
 	{
 		Opcode opcode;
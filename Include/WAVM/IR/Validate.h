@@ -92,6 +92,12 @@ namespace WAVM { namespace IR {
 
 	WAVM_API void validateCodeSection(ModuleValidationState& state);
 
+	// Validates the code of the module's function definitions like validateCodeSection, but on up
+	// to numThreads threads. If numThreads is 0, it is chosen from the number of hardware threads
+	// and the amount of code to validate. If any function is invalid, throws the same exception as
+	// validateCodeSection: the exception for the lowest-indexed invalid function definition.
+	WAVM_API void validateCodeSectionInParallel(ModuleValidationState& state, Uptr numThreads = 0);
+
 	inline void validatePostCodeSections(ModuleValidationState& state)
 	{
 		validateDataSegments(state);
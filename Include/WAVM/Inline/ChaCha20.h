@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string.h>
+#include "WAVM/Inline/BasicTypes.h"
+
+namespace WAVM { namespace ChaCha20 {
+	static constexpr Uptr numBlockBytes = 64;
+
+	inline U32 rotl(U32 value, U32 numBits)
+	{
+		return (value << numBits) | (value >> (32 - numBits));
+	}
+
+	inline void quarterRound(U32* state, Uptr a, Uptr b, Uptr c, Uptr d)
+	{
+		state[a] += state[b];
+		state[d] = rotl(state[d] ^ state[a], 16);
+		state[c] += state[d];
+		state[b] = rotl(state[b] ^ state[c], 12);
+		state[a] += state[b];
+		state[d] = rotl(state[d] ^ state[a], 8);
+		state[c] += state[d];
+		state[b] = rotl(state[b] ^ state[c], 7);
+	}
+
+	// Generates a block of the ChaCha20 keystream, as described in section 2.3 of RFC 7539, from a
+	// 256-bit key and the four words that follow it in the state: the block counter and the nonce.
+	// RFC 7539 uses a 32-bit block counter and a 96-bit nonce, but the words can also be used as a
+	// 64-bit block counter and a 64-bit nonce.
+	inline void generateBlock(const U32 key[8], const U32 counterAndNonce[4], U8* outBlock)
+	{
+		const U32 initialState[16] = {0x61707865,
+									  0x3320646e,
+									  0x79622d32,
+									  0x6b206574,
+									  key[0],
+									  key[1],
+									  key[2],
+									  key[3],
+									  key[4],
+									  key[5],
+									  key[6],
+									  key[7],
+									  counterAndNonce[0],
+									  counterAndNonce[1],
+									  counterAndNonce[2],
+									  counterAndNonce[3]};
+
+		U32 state[16];
+		memcpy(state, initialState, sizeof(state));
+		for(Uptr doubleRoundIndex = 0; doubleRoundIndex < 10; ++doubleRoundIndex)
+		{
+			quarterRound(state, 0, 4, 8, 12);
+			quarterRound(state, 1, 5, 9, 13);
+			quarterRound(state, 2, 6, 10, 14);
+			quarterRound(state, 3, 7, 11, 15);
+			quarterRound(state, 0, 5, 10, 15);
+			quarterRound(state, 1, 6, 11, 12);
+			quarterRound(state, 2, 7, 8, 13);
+			quarterRound(state, 3, 4, 9, 14);
+		}
+		for(Uptr wordIndex = 0; wordIndex < 16; ++wordIndex)
+		{ state[wordIndex] += initialState[wordIndex]; }
+
+		// Serialize the state as little-endian words, which matches the host byte order.
+		memcpy(outBlock, state, sizeof(state));
+	}
+}}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string.h>
 #include <functional>
 #include <string>
 #include <type_traits>
@@ -105,11 +106,39 @@ namespace WAVM {
 		Uptr operator()(I64 i, Uptr seed = 0) const { return Uptr(XXH64_fixed(I64(i), U64(seed))); }
 	};
 
+	// A reference to a string that isn't necessarily stored in a std::string: used to look up
+	// std::string keys in a HashMap or HashSet without constructing a std::string.
+	struct StringView
+	{
+		const char* data;
+		Uptr numChars;
+
+		StringView(const char* inData, Uptr inNumChars) : data(inData), numChars(inNumChars) {}
+		StringView(const char* string) : data(string), numChars(strlen(string)) {}
+		StringView(const std::string& string) : data(string.data()), numChars(string.size()) {}
+
+		friend bool operator==(StringView left, StringView right)
+		{
+			return left.numChars == right.numChars
+				   && !memcmp(left.data, right.data, left.numChars);
+		}
+		friend bool operator!=(StringView left, StringView right) { return !(left == right); }
+	};
+
+	template<> struct Hash<StringView>
+	{
+		Uptr operator()(StringView string, Uptr seed = 0) const
+		{
+			return Uptr(XXH64(string.data, string.numChars, seed));
+		}
+	};
+
+	// Hash<std::string> must produce the same hash as Hash<StringView> for the same characters.
 	template<> struct Hash<std::string>
 	{
 		Uptr operator()(const std::string& string, Uptr seed = 0) const
 		{
-			return Uptr(XXH64(string.data(), string.size(), seed));
+			return Hash<StringView>()(string, seed);
 		}
 	};
 
@@ -128,4 +157,31 @@ namespace WAVM {
 		static bool areKeysEqual(const Key& left, const Key& right) { return left == right; }
 		static Uptr getKeyHash(const Key& key) { return Hash<Key>()(key); }
 	};
+
+	// A hash policy that defines IsTransparent accepts lookup keys of other types than the key type
+	// of the HashMap or HashSet. It must hash a lookup key the same as the equivalent key, and
+	// provide an areKeysEqual that compares a key to a lookup key.
+	template<> struct DefaultHashPolicy<std::string>
+	{
+		typedef void IsTransparent;
+
+		static bool areKeysEqual(StringView left, StringView right) { return left == right; }
+		static Uptr getKeyHash(StringView key) { return Hash<StringView>()(key); }
+	};
+
+	template<typename> struct MakeVoid
+	{
+		typedef void Type;
+	};
+
+	template<typename HashPolicy, typename = void> struct IsTransparentHashPolicy
+	{
+		static constexpr bool value = false;
+	};
+	template<typename HashPolicy>
+	struct IsTransparentHashPolicy<HashPolicy,
+								   typename MakeVoid<typename HashPolicy::IsTransparent>::Type>
+	{
+		static constexpr bool value = true;
+	};
 }
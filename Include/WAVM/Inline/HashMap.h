@@ -1,10 +1,12 @@
 #pragma once
 
 #include <initializer_list>
+#include <type_traits>
 #include "WAVM/Inline/Assert.h"
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/Inline/Hash.h"
 #include "WAVM/Inline/HashTable.h"
+#include "WAVM/Inline/SwissHashTable.h"
 
 namespace WAVM {
 	template<typename Key, typename Value> struct HashMapPair
@@ -19,7 +21,7 @@ namespace WAVM {
 
 	template<typename Key, typename Value> struct HashMapIterator
 	{
-		template<typename, typename, typename> friend struct HashMap;
+		template<typename, typename, typename, template<typename...> class> friend struct HashMap;
 
 		typedef HashMapPair<Key, Value> Pair;
 
@@ -39,12 +41,24 @@ namespace WAVM {
 						const HashTableBucket<Pair>* inEndBucket);
 	};
 
-	template<typename Key, typename Value, typename KeyHashPolicy = DefaultHashPolicy<Key>>
+	// A map from keys to values. The pairs are stored in a SwissHashTable by default, but Table may
+	// be HashTable to store them in a Robin Hood hash table instead.
+	template<typename Key,
+			 typename Value,
+			 typename KeyHashPolicy = DefaultHashPolicy<Key>,
+			 template<typename...> class Table = SwissHashTable>
 	struct HashMap
 	{
 		typedef HashMapPair<Key, Value> Pair;
 		typedef HashMapIterator<Key, Value> Iterator;
 
+		// The functions that take a LookupKey are only enabled if KeyHashPolicy is transparent (see
+		// IsTransparentHashPolicy), and allow looking up a key without constructing a Key.
+		template<typename LookupKey>
+		using EnableIfLookupKey =
+			typename std::enable_if<IsTransparentHashPolicy<KeyHashPolicy>::value
+									&& !std::is_same<LookupKey, Key>::value>::type;
+
 		HashMap(Uptr reserveNumPairs = 0);
 		HashMap(const std::initializer_list<Pair>& initializerList);
 
@@ -71,6 +85,8 @@ namespace WAVM {
 		// If the map contains the key, removes it and returns true.
 		// If the map doesn't contain the key, returns false.
 		bool remove(const Key& key);
+		template<typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+		bool remove(const LookupKey& key);
 
 		// Assuming the map contains the key, remove it. Asserts if the map didn't contain the key,
 		// or silently does nothing if assertions are disabled.
@@ -78,6 +94,8 @@ namespace WAVM {
 
 		// Returns true if the map contains the key.
 		bool contains(const Key& key) const;
+		template<typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+		bool contains(const LookupKey& key) const;
 
 		// Returns a reference to the value bound to the key. Assumes that the map contains the key.
 		const Value& operator[](const Key& key) const;
@@ -87,10 +105,16 @@ namespace WAVM {
 		// key.
 		const Value* get(const Key& key) const;
 		Value* get(const Key& key);
+		template<typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+		const Value* get(const LookupKey& key) const;
+		template<typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+		Value* get(const LookupKey& key);
 
 		// Returns a pointer to the key-value pair for a key, or null if the map doesn't contain the
 		// key.
 		const Pair* getPair(const Key& key) const;
+		template<typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+		const Pair* getPair(const LookupKey& key) const;
 
 		// Removes all pairs from the map.
 		void clear();
@@ -110,13 +134,19 @@ namespace WAVM {
 		struct HashTablePolicy
 		{
 			WAVM_FORCEINLINE static const Key& getKey(const Pair& pair) { return pair.key; }
-			WAVM_FORCEINLINE static bool areKeysEqual(const Key& left, const Key& right)
+			template<typename LookupKey>
+			WAVM_FORCEINLINE static bool areKeysEqual(const Key& left, const LookupKey& right)
 			{
 				return KeyHashPolicy::areKeysEqual(left, right);
 			}
 		};
 
-		HashTable<Key, Pair, HashTablePolicy> table;
+		Table<Key, Pair, HashTablePolicy> table;
+
+		template<typename LookupKey>
+		const HashTableBucket<Pair>* getBucketForRead(const LookupKey& key) const;
+		template<typename LookupKey>
+		HashTableBucket<Pair>* getBucketForModify(const LookupKey& key);
 	};
 
 // The implementation is defined in a separate file.
@@ -1,15 +1,17 @@
 #pragma once
 
 #include <initializer_list>
+#include <type_traits>
 #include "WAVM/Inline/Assert.h"
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/Inline/Hash.h"
 #include "WAVM/Inline/HashTable.h"
+#include "WAVM/Inline/SwissHashTable.h"
 
 namespace WAVM {
 	template<typename Element> struct HashSetIterator
 	{
-		template<typename, typename> friend struct HashSet;
+		template<typename, typename, template<typename...> class> friend struct HashSet;
 
 		bool operator!=(const HashSetIterator& other) const;
 		bool operator==(const HashSetIterator& other) const;
@@ -28,9 +30,20 @@ namespace WAVM {
 						const HashTableBucket<Element>* inEndBucket);
 	};
 
-	template<typename Element, typename ElementHashPolicy = DefaultHashPolicy<Element>>
+	// A set of elements. The elements are stored in a SwissHashTable by default, but Table may be
+	// HashTable to store them in a Robin Hood hash table instead.
+	template<typename Element,
+			 typename ElementHashPolicy = DefaultHashPolicy<Element>,
+			 template<typename...> class Table = SwissHashTable>
 	struct HashSet
 	{
+		// The functions that take a LookupKey are only enabled if ElementHashPolicy is transparent
+		// (see IsTransparentHashPolicy), and allow looking up an element without constructing one.
+		template<typename LookupKey>
+		using EnableIfLookupKey =
+			typename std::enable_if<IsTransparentHashPolicy<ElementHashPolicy>::value
+									&& !std::is_same<LookupKey, Element>::value>::type;
+
 		HashSet(Uptr reserveNumElements = 0);
 		HashSet(const std::initializer_list<Element>& initializerList);
 
@@ -45,6 +58,8 @@ namespace WAVM {
 		// If the set contains the element, removes it and returns true.
 		// If the set doesn't contain the element, returns false.
 		bool remove(const Element& element);
+		template<typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+		bool remove(const LookupKey& key);
 
 		// Assuming the set contains the element, remove it. Asserts if the set didn't contain the
 		// element, or silently does nothing if assertions are disabled.
@@ -57,11 +72,15 @@ namespace WAVM {
 
 		// Returns true if the set contains the element.
 		bool contains(const Element& element) const;
+		template<typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+		bool contains(const LookupKey& key) const;
 
 		// If the set contains the element, returns a pointer to it. This is useful if the hash
 		// policy allows distinct elements to compare as equal; e.g. for deduplicating equivalent
 		// values.
 		const Element* get(const Element& element) const;
+		template<typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+		const Element* get(const LookupKey& key) const;
 
 		// Removes all elements from the set.
 		void clear();
@@ -84,13 +103,17 @@ namespace WAVM {
 			{
 				return element;
 			}
-			WAVM_FORCEINLINE static bool areKeysEqual(const Element& left, const Element& right)
+			template<typename LookupKey>
+			WAVM_FORCEINLINE static bool areKeysEqual(const Element& left, const LookupKey& right)
 			{
 				return ElementHashPolicy::areKeysEqual(left, right);
 			}
 		};
 
-		HashTable<Element, Element, HashTablePolicy> table;
+		Table<Element, Element, HashTablePolicy> table;
+
+		template<typename LookupKey>
+		const HashTableBucket<Element>* getBucketForRead(const LookupKey& key) const;
 	};
 
 // The implementation is defined in a separate file.
@@ -38,7 +38,7 @@ namespace WAVM {
 	struct HashTablePolicy
 	{
 		static const Key& getKey(const Element&);
-		static bool areKeysEqual(const Key&, const Key&);
+		template<typename LookupKey> static bool areKeysEqual(const Key&, const LookupKey&);
 	};
 	*/
 
@@ -58,6 +58,9 @@ namespace WAVM {
 	// Key!=Element, and HashTablePolicy::getKey(Element) is used to derive the key of an element in
 	// the hash table.
 	//
+	//   The lookup functions may be called with any key type that HashTablePolicy::areKeysEqual
+	// accepts, as long as the hash passed with it is the same as the hash of the equivalent Key.
+	//
 	//   The implementation is a Robin Hood hash table.
 	//
 	//   The buckets are a linear array of elements paired with pointer-sized metadata that uses 1
@@ -116,10 +119,11 @@ namespace WAVM {
 
 		void resize(Uptr newNumBuckets);
 
-		bool remove(Uptr hash, const Key& key);
+		template<typename LookupKey> bool remove(Uptr hash, const LookupKey& key);
 
-		const Bucket* getBucketForRead(Uptr hash, const Key& key) const;
-		Bucket* getBucketForModify(Uptr hash, const Key& key);
+		template<typename LookupKey>
+		const Bucket* getBucketForRead(Uptr hash, const LookupKey& key) const;
+		template<typename LookupKey> Bucket* getBucketForModify(Uptr hash, const LookupKey& key);
 		Bucket& getBucketForAdd(Uptr hash, const Key& key);
 
 		Uptr size() const { return numElements; }
@@ -3,8 +3,9 @@
 
 // Use these macros to compress the boilerplate template declarations in a non-inline member
 // function definition for HashMap.
-#define HASHMAP_PARAMETERS typename Key, typename Value, typename KeyHashPolicy
-#define HASHMAP_ARGUMENTS Key, Value, KeyHashPolicy
+#define HASHMAP_PARAMETERS                                                                         \
+	typename Key, typename Value, typename KeyHashPolicy, template<typename...> class Table
+#define HASHMAP_ARGUMENTS Key, Value, KeyHashPolicy, Table
 
 template<HASHMAP_PARAMETERS>
 HashMap<HASHMAP_ARGUMENTS>::HashMap(Uptr reserveNumPairs) : table(reserveNumPairs)
@@ -92,6 +93,13 @@ template<HASHMAP_PARAMETERS> bool HashMap<HASHMAP_ARGUMENTS>::remove(const Key&
 	return table.remove(KeyHashPolicy::getKeyHash(key), key);
 }
 
+template<HASHMAP_PARAMETERS>
+template<typename LookupKey, typename>
+bool HashMap<HASHMAP_ARGUMENTS>::remove(const LookupKey& key)
+{
+	return table.remove(KeyHashPolicy::getKeyHash(key), key);
+}
+
 template<HASHMAP_PARAMETERS> void HashMap<HASHMAP_ARGUMENTS>::removeOrFail(const Key& key)
 {
 	const bool removed = table.remove(KeyHashPolicy::getKeyHash(key), key);
@@ -100,18 +108,20 @@ template<HASHMAP_PARAMETERS> void HashMap<HASHMAP_ARGUMENTS>::removeOrFail(const
 
 template<HASHMAP_PARAMETERS> bool HashMap<HASHMAP_ARGUMENTS>::contains(const Key& key) const
 {
-	const Uptr hash = KeyHashPolicy::getKeyHash(key);
-	const HashTableBucket<Pair>* bucket = table.getBucketForRead(hash, key);
-	WAVM_ASSERT(!bucket
-				|| bucket->hashAndOccupancy == (hash | HashTableBucket<Pair>::isOccupiedMask));
-	return bucket != nullptr;
+	return getBucketForRead(key) != nullptr;
+}
+
+template<HASHMAP_PARAMETERS>
+template<typename LookupKey, typename>
+bool HashMap<HASHMAP_ARGUMENTS>::contains(const LookupKey& key) const
+{
+	return getBucketForRead(key) != nullptr;
 }
 
 template<HASHMAP_PARAMETERS>
 const Value& HashMap<HASHMAP_ARGUMENTS>::operator[](const Key& key) const
 {
-	const Uptr hash = KeyHashPolicy::getKeyHash(key);
-	const HashTableBucket<Pair>* bucket = table.getBucketForRead(hash, key);
+	const HashTableBucket<Pair>* bucket = getBucketForRead(key);
 	WAVM_ASSERT(bucket);
 	if(!bucket)
 	{
@@ -119,14 +129,12 @@ const Value& HashMap<HASHMAP_ARGUMENTS>::operator[](const Key& key) const
 		// warning isn't triggered because it thinks this function might return nullptr.
 		WAVM_UNREACHABLE();
 	}
-	WAVM_ASSERT(bucket->hashAndOccupancy == (hash | HashTableBucket<Pair>::isOccupiedMask));
 	return bucket->storage.get().value;
 }
 
 template<HASHMAP_PARAMETERS> Value& HashMap<HASHMAP_ARGUMENTS>::operator[](const Key& key)
 {
-	const Uptr hash = KeyHashPolicy::getKeyHash(key);
-	HashTableBucket<Pair>* bucket = table.getBucketForModify(hash, key);
+	HashTableBucket<Pair>* bucket = getBucketForModify(key);
 	WAVM_ASSERT(bucket);
 	if(!bucket)
 	{
@@ -134,45 +142,50 @@ template<HASHMAP_PARAMETERS> Value& HashMap<HASHMAP_ARGUMENTS>::operator[](const
 		// warning isn't triggered because it thinks this function might return nullptr.
 		WAVM_UNREACHABLE();
 	}
-	WAVM_ASSERT(bucket->hashAndOccupancy == (hash | HashTableBucket<Pair>::isOccupiedMask));
 	return bucket->storage.get().value;
 }
 
 template<HASHMAP_PARAMETERS> const Value* HashMap<HASHMAP_ARGUMENTS>::get(const Key& key) const
 {
-	const Uptr hash = KeyHashPolicy::getKeyHash(key);
-	const HashTableBucket<Pair>* bucket = table.getBucketForRead(hash, key);
-	if(!bucket) { return nullptr; }
-	else
-	{
-		WAVM_ASSERT(bucket->hashAndOccupancy == (hash | HashTableBucket<Pair>::isOccupiedMask));
-		return &bucket->storage.get().value;
-	}
+	const HashTableBucket<Pair>* bucket = getBucketForRead(key);
+	return bucket ? &bucket->storage.get().value : nullptr;
 }
 
 template<HASHMAP_PARAMETERS> Value* HashMap<HASHMAP_ARGUMENTS>::get(const Key& key)
 {
-	const Uptr hash = KeyHashPolicy::getKeyHash(key);
-	HashTableBucket<Pair>* bucket = table.getBucketForModify(hash, key);
-	if(!bucket) { return nullptr; }
-	else
-	{
-		WAVM_ASSERT(bucket->hashAndOccupancy == (hash | HashTableBucket<Pair>::isOccupiedMask));
-		return &bucket->storage.get().value;
-	}
+	HashTableBucket<Pair>* bucket = getBucketForModify(key);
+	return bucket ? &bucket->storage.get().value : nullptr;
+}
+
+template<HASHMAP_PARAMETERS>
+template<typename LookupKey, typename>
+const Value* HashMap<HASHMAP_ARGUMENTS>::get(const LookupKey& key) const
+{
+	const HashTableBucket<Pair>* bucket = getBucketForRead(key);
+	return bucket ? &bucket->storage.get().value : nullptr;
+}
+
+template<HASHMAP_PARAMETERS>
+template<typename LookupKey, typename>
+Value* HashMap<HASHMAP_ARGUMENTS>::get(const LookupKey& key)
+{
+	HashTableBucket<Pair>* bucket = getBucketForModify(key);
+	return bucket ? &bucket->storage.get().value : nullptr;
 }
 
 template<HASHMAP_PARAMETERS>
 const HashMapPair<Key, Value>* HashMap<HASHMAP_ARGUMENTS>::getPair(const Key& key) const
 {
-	const Uptr hash = KeyHashPolicy::getKeyHash(key);
-	const HashTableBucket<Pair>* bucket = table.getBucketForRead(hash, key);
-	if(!bucket) { return nullptr; }
-	else
-	{
-		WAVM_ASSERT(bucket->hashAndOccupancy == (hash | HashTableBucket<Pair>::isOccupiedMask));
-		return &bucket->storage.get();
-	}
+	const HashTableBucket<Pair>* bucket = getBucketForRead(key);
+	return bucket ? &bucket->storage.get() : nullptr;
+}
+
+template<HASHMAP_PARAMETERS>
+template<typename LookupKey, typename>
+const HashMapPair<Key, Value>* HashMap<HASHMAP_ARGUMENTS>::getPair(const LookupKey& key) const
+{
+	const HashTableBucket<Pair>* bucket = getBucketForRead(key);
+	return bucket ? &bucket->storage.get() : nullptr;
 }
 
 template<HASHMAP_PARAMETERS> void HashMap<HASHMAP_ARGUMENTS>::clear() { table.clear(); }
@@ -265,5 +278,25 @@ HashMapIterator<Key, Value>::HashMapIterator(
 {
 }
 
+template<HASHMAP_PARAMETERS>
+template<typename LookupKey>
+const HashTableBucket<HashMapPair<Key, Value>>* HashMap<HASHMAP_ARGUMENTS>::getBucketForRead(
+	const LookupKey& key) const
+{
+	const Uptr hash = KeyHashPolicy::getKeyHash(key);
+	const HashTableBucket<Pair>* bucket = table.getBucketForRead(hash, key);
+	WAVM_ASSERT(!bucket
+				|| bucket->hashAndOccupancy == (hash | HashTableBucket<Pair>::isOccupiedMask));
+	return bucket;
+}
+
+template<HASHMAP_PARAMETERS>
+template<typename LookupKey>
+HashTableBucket<HashMapPair<Key, Value>>* HashMap<HASHMAP_ARGUMENTS>::getBucketForModify(
+	const LookupKey& key)
+{
+	return const_cast<HashTableBucket<Pair>*>(getBucketForRead(key));
+}
+
 #undef HASHMAP_PARAMETERS
 #undef HASHMAP_ARGUMENTS
@@ -78,7 +78,8 @@ template<HASHTABLE_PARAMETERS> void HashTable<HASHTABLE_ARGUMENTS>::resize(Uptr
 }
 
 template<HASHTABLE_PARAMETERS>
-bool HashTable<HASHTABLE_ARGUMENTS>::remove(Uptr hash, const Key& key)
+template<typename LookupKey>
+bool HashTable<HASHTABLE_ARGUMENTS>::remove(Uptr hash, const LookupKey& key)
 {
 	// Find the bucket (if any) holding the key.
 	const Uptr hashAndOccupancy = hash | Bucket::isOccupiedMask;
@@ -99,9 +100,10 @@ bool HashTable<HASHTABLE_ARGUMENTS>::remove(Uptr hash, const Key& key)
 }
 
 template<HASHTABLE_PARAMETERS>
+template<typename LookupKey>
 const HashTableBucket<Element>* HashTable<HASHTABLE_ARGUMENTS>::getBucketForRead(
 	Uptr hash,
-	const Key& key) const
+	const LookupKey& key) const
 {
 	if(!buckets) { return nullptr; }
 
@@ -145,8 +147,9 @@ const HashTableBucket<Element>* HashTable<HASHTABLE_ARGUMENTS>::getBucketForRead
 }
 
 template<HASHTABLE_PARAMETERS>
+template<typename LookupKey>
 HashTableBucket<Element>* HashTable<HASHTABLE_ARGUMENTS>::getBucketForModify(Uptr hash,
-																			 const Key& key)
+																			 const LookupKey& key)
 {
 	return const_cast<Bucket*>(getBucketForRead(hash, key));
 }
@@ -0,0 +1,459 @@
+// IWYU pragma: private, include "WAVM/Inline/SwissHashTable.h"
+// You should only include this file indirectly by including SwissHashTable.h.
+
+// Use these macros to compress the boilerplate template declarations in a non-inline member
+// function definition for SwissHashTable.
+#define SWISSHASHTABLE_PARAMETERS                                                                  \
+	typename Key, typename Element, typename HashTablePolicy, typename AllocPolicy
+#define SWISSHASHTABLE_ARGUMENTS Key, Element, HashTablePolicy, AllocPolicy
+
+namespace SwissHashTableImpl {
+	static constexpr Uptr groupSize = 16;
+
+	// The control byte values for empty and deleted buckets. Occupied buckets have a control byte
+	// between 0 and 127, so both of these are negative.
+	static constexpr I8 emptyControlByte = I8(-128);
+	static constexpr I8 deletedControlByte = I8(-2);
+
+	// The bits of an element's hash that are stored in its bucket's control byte, and the bits
+	// that are used to index the buckets.
+	WAVM_FORCEINLINE I8 getControlByte(Uptr hash) { return I8(hash & 0x7f); }
+	WAVM_FORCEINLINE Uptr getBucketIndexHash(Uptr hash)
+	{
+		return (hash & HashTableBucket<U8>::hashMask) >> 7;
+	}
+
+	// These functions compare the control bytes for a group of buckets to a value, and return a
+	// mask with bit N set if the control byte of the group's Nth bucket matched.
+#if WAVM_SWISS_HASH_TABLE_SSE2
+	WAVM_FORCEINLINE U32 matchGroup(const I8* group, I8 controlByte)
+	{
+		const __m128i controlBytes = _mm_loadu_si128((const __m128i*)group);
+		return U32(_mm_movemask_epi8(_mm_cmpeq_epi8(controlBytes, _mm_set1_epi8(controlByte))));
+	}
+	WAVM_FORCEINLINE U32 matchEmptyOrDeleted(const I8* group)
+	{
+		// Empty and deleted buckets have the only control bytes less than -1.
+		const __m128i controlBytes = _mm_loadu_si128((const __m128i*)group);
+		return U32(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), controlBytes)));
+	}
+#elif WAVM_SWISS_HASH_TABLE_NEON
+	WAVM_FORCEINLINE U32 getNEONMask(uint8x16_t matches)
+	{
+		// Select a different bit from each lane of the 8-lane halves, and sum the lanes of each
+		// half to get the mask.
+		static const uint8_t laneBits[16]
+			= {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+		const uint8x16_t maskedMatches = vandq_u8(matches, vld1q_u8(laneBits));
+		return U32(vaddv_u8(vget_low_u8(maskedMatches)))
+			   | (U32(vaddv_u8(vget_high_u8(maskedMatches))) << 8);
+	}
+	WAVM_FORCEINLINE U32 matchGroup(const I8* group, I8 controlByte)
+	{
+		return getNEONMask(vceqq_s8(vld1q_s8(group), vdupq_n_s8(controlByte)));
+	}
+	WAVM_FORCEINLINE U32 matchEmptyOrDeleted(const I8* group)
+	{
+		return getNEONMask(vcltq_s8(vld1q_s8(group), vdupq_n_s8(-1)));
+	}
+#else
+	WAVM_FORCEINLINE U32 matchGroup(const I8* group, I8 controlByte)
+	{
+		U32 mask = 0;
+		for(Uptr index = 0; index < groupSize; ++index)
+		{
+			if(group[index] == controlByte) { mask |= U32(1) << index; }
+		}
+		return mask;
+	}
+	WAVM_FORCEINLINE U32 matchEmptyOrDeleted(const I8* group)
+	{
+		U32 mask = 0;
+		for(Uptr index = 0; index < groupSize; ++index)
+		{
+			if(group[index] < -1) { mask |= U32(1) << index; }
+		}
+		return mask;
+	}
+#endif
+	WAVM_FORCEINLINE U32 matchEmpty(const I8* group) { return matchGroup(group, emptyControlByte); }
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+void SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::setControlByte(Uptr bucketIndex, I8 controlByte)
+{
+	// Also set the copy of the control bytes for the first buckets after the last bucket.
+	controlBytes[bucketIndex] = controlByte;
+	if(bucketIndex < SwissHashTableImpl::groupSize - 1)
+	{ controlBytes[numBuckets() + bucketIndex] = controlByte; }
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+Uptr SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::findBucketForInsert(Uptr hash) const
+{
+	WAVM_ASSERT(buckets);
+
+	// Find the first empty or deleted bucket in the key's probe sequence.
+	Uptr groupIndex = SwissHashTableImpl::getBucketIndexHash(hash) & hashToBucketIndexMask;
+	Uptr probeIndex = 0;
+	while(true)
+	{
+		const U32 matches = SwissHashTableImpl::matchEmptyOrDeleted(controlBytes + groupIndex);
+		if(matches)
+		{ return (groupIndex + countTrailingZeroes(matches)) & hashToBucketIndexMask; }
+
+		++probeIndex;
+		WAVM_ASSERT(probeIndex * SwissHashTableImpl::groupSize < numBuckets());
+		groupIndex = (groupIndex + probeIndex * SwissHashTableImpl::groupSize)
+					 & hashToBucketIndexMask;
+	};
+}
+
+template<SWISSHASHTABLE_PARAMETERS> void SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::clear()
+{
+	destruct();
+	buckets = nullptr;
+	controlBytes = nullptr;
+	numElements = 0;
+	numDeletedBuckets = 0;
+	hashToBucketIndexMask = UINTPTR_MAX;
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+void SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::resize(Uptr newNumBuckets)
+{
+	WAVM_ASSERT(!(newNumBuckets & (newNumBuckets - 1)));
+	WAVM_ASSERT(!newNumBuckets || newNumBuckets >= SwissHashTableImpl::groupSize);
+
+	const Uptr oldNumBuckets = numBuckets();
+	Bucket* oldBuckets = buckets;
+	I8* oldControlBytes = controlBytes;
+
+	if(!newNumBuckets)
+	{
+		WAVM_ASSERT(!numElements);
+		buckets = nullptr;
+		controlBytes = nullptr;
+	}
+	else
+	{
+		// Allocate the new buckets, and initialize their control bytes to empty.
+		buckets = new Bucket[newNumBuckets]();
+		controlBytes = new I8[newNumBuckets + SwissHashTableImpl::groupSize - 1];
+		memset(controlBytes,
+			   SwissHashTableImpl::emptyControlByte,
+			   newNumBuckets + SwissHashTableImpl::groupSize - 1);
+	}
+
+	hashToBucketIndexMask = newNumBuckets - 1;
+	numDeletedBuckets = 0;
+
+	if(oldBuckets)
+	{
+		// Iterate over the old buckets, and reinsert their contents in the new buckets.
+		for(Uptr bucketIndex = 0; bucketIndex < oldNumBuckets; ++bucketIndex)
+		{
+			Bucket& oldBucket = oldBuckets[bucketIndex];
+			if(oldBucket.hashAndOccupancy)
+			{
+				WAVM_ASSERT(buckets);
+				const Uptr newBucketIndex = findBucketForInsert(oldBucket.hashAndOccupancy);
+				setControlByte(newBucketIndex,
+							   SwissHashTableImpl::getControlByte(oldBucket.hashAndOccupancy));
+
+				// Move the element from the old bucket to the new.
+				Bucket& newBucket = buckets[newBucketIndex];
+				newBucket.storage.construct(std::move(oldBucket.storage.get()));
+				newBucket.hashAndOccupancy = oldBucket.hashAndOccupancy;
+				oldBucket.storage.destruct();
+				oldBucket.hashAndOccupancy = 0;
+			}
+		}
+
+		// Free the old buckets.
+		delete[] oldBuckets;
+		delete[] oldControlBytes;
+	}
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+template<typename LookupKey>
+bool SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::remove(Uptr hash, const LookupKey& key)
+{
+	using namespace SwissHashTableImpl;
+
+	// Find the bucket (if any) holding the key.
+	Bucket* bucket = getBucketForModify(hash, key);
+	if(!bucket) { return false; }
+
+	// Remove the element in the bucket.
+	const Uptr bucketIndex = bucket - buckets;
+	bucket->storage.destruct();
+	bucket->hashAndOccupancy = 0;
+
+	// If every group that contains the bucket also contains an empty bucket, then no search could
+	// have continued past the bucket, so it can be marked as empty. Otherwise, mark it as deleted
+	// so searches continue past it.
+	const U32 emptyBefore
+		= matchEmpty(controlBytes + ((bucketIndex - groupSize) & hashToBucketIndexMask));
+	const U32 emptyAfter = matchEmpty(controlBytes + bucketIndex);
+	const Uptr numNonEmptyBefore = emptyBefore ? countLeadingZeroes(emptyBefore) - 16 : groupSize;
+	const Uptr numNonEmptyAfter = emptyAfter ? countTrailingZeroes(emptyAfter) : groupSize;
+	if(numNonEmptyBefore + numNonEmptyAfter < groupSize)
+	{ setControlByte(bucketIndex, emptyControlByte); }
+	else
+	{
+		setControlByte(bucketIndex, deletedControlByte);
+		++numDeletedBuckets;
+	}
+
+	// Decrease the number of elements and resize the table if the occupancy is too low.
+	--numElements;
+	const Uptr maxDesiredBuckets = AllocPolicy::getMaxDesiredBuckets(numElements);
+	if(numBuckets() > maxDesiredBuckets) { resize(maxDesiredBuckets); }
+
+	return true;
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+template<typename LookupKey>
+const HashTableBucket<Element>* SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::getBucketForRead(
+	Uptr hash,
+	const LookupKey& key) const
+{
+	using namespace SwissHashTableImpl;
+
+	if(!buckets) { return nullptr; }
+
+	// Start at the group indexed by the upper bits of the hash.
+	const Uptr hashAndOccupancy = hash | Bucket::isOccupiedMask;
+	const I8 controlByte = getControlByte(hash);
+	Uptr groupIndex = getBucketIndexHash(hash) & hashToBucketIndexMask;
+	Uptr probeIndex = 0;
+	while(true)
+	{
+		// Check the buckets in the group whose control byte matches the key's hash.
+		U32 matches = matchGroup(controlBytes + groupIndex, controlByte);
+		while(matches)
+		{
+			const Uptr bucketIndex
+				= (groupIndex + countTrailingZeroes(matches)) & hashToBucketIndexMask;
+			const Bucket& bucket = buckets[bucketIndex];
+			if(bucket.hashAndOccupancy == hashAndOccupancy
+			   && HashTablePolicy::areKeysEqual(HashTablePolicy::getKey(bucket.storage.get()),
+												key))
+			{ return &bucket; }
+			matches &= matches - 1;
+		}
+
+		// If the group has an empty bucket, the key would have been added to the group, so the
+		// table doesn't contain the key.
+		if(matchEmpty(controlBytes + groupIndex)) { return nullptr; }
+
+		// Otherwise, continue to the next group in the probe sequence.
+		++probeIndex;
+		WAVM_ASSERT(probeIndex * groupSize < numBuckets());
+		groupIndex = (groupIndex + probeIndex * groupSize) & hashToBucketIndexMask;
+	};
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+template<typename LookupKey>
+HashTableBucket<Element>* SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::getBucketForModify(
+	Uptr hash,
+	const LookupKey& key)
+{
+	return const_cast<Bucket*>(getBucketForRead(hash, key));
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+HashTableBucket<Element>& SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::getBucketForAdd(Uptr hash,
+																				  const Key& key)
+{
+	// If the table already contains the key, return its bucket.
+	if(Bucket* existingBucket = getBucketForModify(hash, key))
+	{
+		WAVM_ASSERT(existingBucket->hashAndOccupancy == (hash | Bucket::isOccupiedMask));
+		return *existingBucket;
+	}
+
+	// Make sure there's enough space to add a new key to the table. The deleted buckets count
+	// towards the occupancy, since they make searches longer just like elements do.
+	if(!buckets
+	   || numElements + numDeletedBuckets + 1 > AllocPolicy::getMaxOccupiedBuckets(numBuckets()))
+	{
+		// Resizing the table discards the deleted buckets, so it may not need to grow. However, if
+		// the elements alone would make the table more than 3/4 of the way to its maximum
+		// occupancy, grow it anyway, so it isn't resized again after just a few more adds.
+		Uptr newNumBuckets = AllocPolicy::getMinDesiredBuckets(numElements + 1);
+		if(newNumBuckets <= numBuckets()
+		   && (numElements + 1) * 4 > AllocPolicy::getMaxOccupiedBuckets(numBuckets()) * 3)
+		{ newNumBuckets = numBuckets() * 2; }
+		resize(newNumBuckets);
+	}
+
+	// Find an empty or deleted bucket to write the new key to.
+	const Uptr bucketIndex = findBucketForInsert(hash);
+	if(controlBytes[bucketIndex] == SwissHashTableImpl::deletedControlByte)
+	{ --numDeletedBuckets; }
+	setControlByte(bucketIndex, SwissHashTableImpl::getControlByte(hash));
+	++numElements;
+
+	// The caller is expected to fill the bucket once this function returns.
+	Bucket& bucket = buckets[bucketIndex];
+	WAVM_ASSERT(!bucket.hashAndOccupancy);
+	return bucket;
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+void SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::analyzeSpaceUsage(Uptr& outTotalMemoryBytes,
+																 Uptr& outMaxProbeCount,
+																 F32& outOccupancy,
+																 F32& outAverageProbeCount) const
+{
+	using namespace SwissHashTableImpl;
+
+	outTotalMemoryBytes = sizeof(*this);
+	if(buckets)
+	{ outTotalMemoryBytes += (sizeof(Bucket) + 1) * numBuckets() + groupSize - 1; }
+	outOccupancy = buckets ? size() / F32(numBuckets()) : 0.0f;
+
+	outMaxProbeCount = 0;
+	outAverageProbeCount = 0.0f;
+	if(!numElements) { return; }
+	for(Uptr bucketIndex = 0; bucketIndex < numBuckets(); ++bucketIndex)
+	{
+		const Uptr hashAndOccupancy = buckets[bucketIndex].hashAndOccupancy;
+		if(!hashAndOccupancy) { continue; }
+
+		// Count the groups in the element's probe sequence up to the one containing its bucket.
+		Uptr groupIndex = getBucketIndexHash(hashAndOccupancy) & hashToBucketIndexMask;
+		Uptr probeCount = 1;
+		while(((bucketIndex - groupIndex) & hashToBucketIndexMask) >= groupSize)
+		{
+			groupIndex = (groupIndex + probeCount * groupSize) & hashToBucketIndexMask;
+			++probeCount;
+		};
+
+		outMaxProbeCount = probeCount > outMaxProbeCount ? probeCount : outMaxProbeCount;
+		outAverageProbeCount += probeCount / F32(numElements);
+	}
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::SwissHashTable(Uptr estimatedNumElements)
+: buckets(nullptr)
+, controlBytes(nullptr)
+, numElements(0)
+, numDeletedBuckets(0)
+, hashToBucketIndexMask(UINTPTR_MAX)
+{
+	const Uptr numBuckets = AllocPolicy::getMinDesiredBuckets(estimatedNumElements);
+	if(numBuckets) { resize(numBuckets); }
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::SwissHashTable(const SwissHashTable& copy)
+{
+	copyFrom(copy);
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::SwissHashTable(SwissHashTable&& movee) noexcept
+{
+	moveFrom(std::move(movee));
+}
+
+template<SWISSHASHTABLE_PARAMETERS> SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::~SwissHashTable()
+{
+	destruct();
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+SwissHashTable<SWISSHASHTABLE_ARGUMENTS>& SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::operator=(
+	const SwissHashTable<SWISSHASHTABLE_ARGUMENTS>& copyee)
+{
+	// Do nothing if copying from this.
+	if(this != &copyee)
+	{
+		destruct();
+		copyFrom(copyee);
+	}
+	return *this;
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+SwissHashTable<SWISSHASHTABLE_ARGUMENTS>& SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::operator=(
+	SwissHashTable<SWISSHASHTABLE_ARGUMENTS>&& movee) noexcept
+{
+	// Do nothing if moving from this.
+	if(this != &movee)
+	{
+		destruct();
+		moveFrom(std::move(movee));
+	}
+	return *this;
+}
+
+template<SWISSHASHTABLE_PARAMETERS> void SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::destruct()
+{
+	if(buckets)
+	{
+		for(Uptr bucketIndex = 0; bucketIndex < numBuckets(); ++bucketIndex)
+		{
+			if(buckets[bucketIndex].hashAndOccupancy) { buckets[bucketIndex].storage.destruct(); }
+		}
+
+		delete[] buckets;
+		delete[] controlBytes;
+		buckets = nullptr;
+		controlBytes = nullptr;
+	}
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+void SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::copyFrom(const SwissHashTable& copy)
+{
+	numElements = copy.numElements;
+	numDeletedBuckets = copy.numDeletedBuckets;
+	hashToBucketIndexMask = copy.hashToBucketIndexMask;
+
+	if(!copy.buckets)
+	{
+		buckets = nullptr;
+		controlBytes = nullptr;
+	}
+	else
+	{
+		const Uptr numControlBytes = copy.numBuckets() + SwissHashTableImpl::groupSize - 1;
+		controlBytes = new I8[numControlBytes];
+		memcpy(controlBytes, copy.controlBytes, numControlBytes);
+
+		buckets = new Bucket[copy.numBuckets()];
+		for(Uptr bucketIndex = 0; bucketIndex < numBuckets(); ++bucketIndex)
+		{
+			buckets[bucketIndex].hashAndOccupancy = copy.buckets[bucketIndex].hashAndOccupancy;
+			if(buckets[bucketIndex].hashAndOccupancy)
+			{ buckets[bucketIndex].storage.construct(copy.buckets[bucketIndex].storage.get()); }
+		}
+	}
+}
+
+template<SWISSHASHTABLE_PARAMETERS>
+void SwissHashTable<SWISSHASHTABLE_ARGUMENTS>::moveFrom(SwissHashTable&& movee) noexcept
+{
+	numElements = movee.numElements;
+	numDeletedBuckets = movee.numDeletedBuckets;
+	hashToBucketIndexMask = movee.hashToBucketIndexMask;
+	buckets = movee.buckets;
+	controlBytes = movee.controlBytes;
+
+	movee.numElements = 0;
+	movee.numDeletedBuckets = 0;
+	movee.hashToBucketIndexMask = UINTPTR_MAX;
+	movee.buckets = nullptr;
+	movee.controlBytes = nullptr;
+}
+
+#undef SWISSHASHTABLE_PARAMETERS
+#undef SWISSHASHTABLE_ARGUMENTS
@@ -1,52 +1,70 @@
 #pragma once
 
+#include <vector>
+#include "WAVM/Inline/Assert.h"
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/Inline/HashMap.h"
+#include "WAVM/Platform/Intrinsic.h"
 
 namespace WAVM {
 	// A map that's somewhere between an array and a HashMap.
 	// It's keyed by a range of integers, but sparsely maps those integers to elements.
 	template<typename Index, typename Element> struct IndexMap
 	{
-		IndexMap(Index inMinIndex, Index inMaxIndex)
-		: lastIndex(inMinIndex - 1), minIndex(inMinIndex), maxIndex(inMaxIndex)
+		IndexMap(Index inMinIndex, Index inMaxIndex) : minIndex(inMinIndex), maxIndex(inMaxIndex)
 		{
 			WAVM_ASSERT(maxIndex >= minIndex);
 		}
 
-		// Allocates an index, and adds the element to the map. Indices are allocated sequentially,
-		// starting at minIndex, and wrapping back to minIndex after maxIndex. After the allocator
-		// has wrapped back to previously allocated indices, indices are probed sequentially until
-		// an unallocated one is found. Because of this, it takes O(N) time to add an element. If an
-		// index couldn't be allocated, returns false. Otherwise, returns true and the index the
-		// element was allocated at is written to the outIndex argument.
+		// Allocates the lowest unallocated index, and adds the element to the map. Indices that
+		// were removed from the map are reused before indices that have never been allocated, so
+		// the allocated indices stay dense. Allocation takes O(log64 N) time, which is at most 11
+		// steps for a 64-bit index. If an index couldn't be allocated, returns failIndex.
+		// Otherwise, returns the index the element was allocated at.
 		template<typename... Args> Index add(Index failIndex, Args&&... args)
 		{
-			// If all possible indices are allocated, return failure.
-			if(map.size() >= Uptr(maxIndex - minIndex + 1)) { return failIndex; }
-
-			// Starting from the index after the last index to be allocated, check indices
-			// sequentially until one is found that isn't allocated.
-			do
+			Uptr offset;
+			if(!freeOffsets.isEmpty())
+			{
+				// Reuse the lowest index that was allocated and then removed.
+				offset = freeOffsets.getSmallest();
+				freeOffsets.remove(offset);
+			}
+			else if(numUsedOffsets <= Uptr(maxIndex - minIndex))
+			{
+				// Allocate the lowest index that has never been allocated.
+				offset = numUsedOffsets++;
+			}
+			else
 			{
-				++lastIndex;
-				if(lastIndex > maxIndex) { lastIndex = minIndex; }
-			} while(map.contains(lastIndex));
+				// All possible indices are allocated.
+				return failIndex;
+			}
 
-			// Add the element to the map with the given index.
-			WAVM_ASSERT(lastIndex >= minIndex);
-			WAVM_ASSERT(lastIndex <= maxIndex);
-			map.addOrFail(lastIndex, std::forward<Args>(args)...);
+			const Index index = Index(minIndex + offset);
+			WAVM_ASSERT(index >= minIndex);
+			WAVM_ASSERT(index <= maxIndex);
+			map.addOrFail(index, std::forward<Args>(args)...);
 
-			return lastIndex;
+			return index;
 		}
 
 		// Inserts an element at a specific index. If the index is already allocated, asserts.
+		// Any unallocated indices below the index will be reused by add. This takes time and memory
+		// proportional to the number of those indices that had never been allocated.
 		template<typename... Args> void insertOrFail(Index index, Args&&... args)
 		{
 			WAVM_ASSERT(index >= minIndex);
 			WAVM_ASSERT(index <= maxIndex);
 			map.addOrFail(index, std::forward<Args>(args)...);
+
+			const Uptr offset = Uptr(index - minIndex);
+			if(offset < numUsedOffsets) { freeOffsets.remove(offset); }
+			else
+			{
+				while(numUsedOffsets < offset) { freeOffsets.add(numUsedOffsets++); }
+				numUsedOffsets = offset + 1;
+			}
 		}
 
 		// Removes an element by index. If there wasn't an allocated at the specified index,
@@ -56,6 +74,7 @@ namespace WAVM {
 			WAVM_ASSERT(index >= minIndex);
 			WAVM_ASSERT(index <= maxIndex);
 			map.removeOrFail(index);
+			freeOffsets.add(Uptr(index - minIndex));
 		}
 
 		// Returns whether the specified index is allocated.
@@ -127,9 +146,95 @@ namespace WAVM {
 		Iterator end() const { return Iterator(map.end()); }
 
 	private:
-		Index lastIndex;
+		// A set of offsets from minIndex, stored as a hierarchy of bit sets: bit N of level 0 is
+		// set if offset N is in the set, and bit N of each higher level is set if word N of the
+		// level below it is non-zero. The highest level has a single word, so the smallest member can be
+		// found by following the lowest set bits down from the highest level.
+		struct OffsetSet
+		{
+			bool isEmpty() const { return !levels.size() || !levels.back()[0]; }
+
+			bool contains(Uptr offset) const
+			{
+				return levels.size() && offset / 64 < levels[0].size()
+					   && (levels[0][offset / 64] & (U64(1) << (offset % 64)));
+			}
+
+			Uptr getSmallest() const
+			{
+				WAVM_ASSERT(!isEmpty());
+				Uptr offset = 0;
+				for(Uptr levelIndex = levels.size(); levelIndex--;)
+				{ offset = offset * 64 + Uptr(countTrailingZeroes(levels[levelIndex][offset])); }
+				return offset;
+			}
+
+			void add(Uptr offset)
+			{
+				WAVM_ASSERT(!contains(offset));
+				if(!levels.size() || offset / 64 >= levels[0].size()) { grow(offset / 64 + 1); }
+
+				// Set the offset's bit in each level until reaching a word that already had a bit
+				// set, and so is already marked as non-zero in the level above it.
+				for(Uptr levelIndex = 0; levelIndex < levels.size(); ++levelIndex)
+				{
+					U64& word = levels[levelIndex][offset / 64];
+					const bool wasZero = !word;
+					word |= U64(1) << (offset % 64);
+					if(!wasZero) { break; }
+					offset /= 64;
+				}
+			}
+
+			void remove(Uptr offset)
+			{
+				WAVM_ASSERT(contains(offset));
+
+				// Clear the offset's bit in each level until reaching a word that is still
+				// non-zero.
+				for(Uptr levelIndex = 0; levelIndex < levels.size(); ++levelIndex)
+				{
+					U64& word = levels[levelIndex][offset / 64];
+					word &= ~(U64(1) << (offset % 64));
+					if(word) { break; }
+					offset /= 64;
+				}
+			}
+
+		private:
+			std::vector<std::vector<U64>> levels;
+
+			void grow(Uptr numWords)
+			{
+				for(Uptr levelIndex = 0;; ++levelIndex)
+				{
+					if(levelIndex == levels.size())
+					{
+						// Add a new highest level, which summarizes the single word of the
+						// previous highest level.
+						levels.emplace_back(numWords, U64(0));
+						if(levelIndex > 0 && levels[levelIndex - 1][0]) { levels.back()[0] = 1; }
+					}
+					else if(levels[levelIndex].size() < numWords)
+					{
+						levels[levelIndex].resize(numWords, U64(0));
+					}
+
+					if(numWords == 1) { break; }
+					numWords = (numWords + 63) / 64;
+				}
+			}
+		};
+
 		Index minIndex;
 		Index maxIndex;
+
+		// The offsets from minIndex below numUsedOffsets have been allocated at some point, and
+		// freeOffsets contains those of them that aren't currently allocated. The offsets at or
+		// above numUsedOffsets have never been allocated.
+		Uptr numUsedOffsets{0};
+		OffsetSet freeOffsets;
+
 		HashMap<Index, Element> map;
 	};
 }
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+
+namespace WAVM {
+	// A compact, immutable map from code offsets to WebAssembly operator indices. The entries are
+	// sorted by offset and delta-encoded as LEB128 varints in a single buffer. Every
+	// numEntriesPerBlock entries, the full offset and operator index are stored in a separate block
+	// array, which is binary searched to find the block that must be decoded to look up an offset.
+	struct InstructionOffsetTable
+	{
+		typedef std::pair<U32, U32> Entry;
+
+		static constexpr Uptr numEntriesPerBlock = 32;
+
+		InstructionOffsetTable() = default;
+
+		// Builds the table from a list of (offset, operator index) entries. The entries don't need
+		// to be sorted; if there are multiple entries with the same offset, the first is used.
+		InstructionOffsetTable(std::vector<Entry>&& entries)
+		{
+			std::stable_sort(
+				entries.begin(), entries.end(), [](const Entry& left, const Entry& right) {
+					return left.first < right.first;
+				});
+
+			Entry previousEntry;
+			for(const Entry& entry : entries)
+			{
+				if(numEntries && entry.first == previousEntry.first) { continue; }
+
+				if(numEntries % numEntriesPerBlock == 0)
+				{
+					WAVM_ASSERT(encodedDeltas.size() <= UINT32_MAX);
+					blocks.push_back({entry.first, entry.second, U32(encodedDeltas.size())});
+				}
+				else
+				{
+					encodeVarUInt32(entry.first - previousEntry.first);
+					encodeVarUInt32(encodeZigZag(I32(entry.second - previousEntry.second)));
+				}
+
+				previousEntry = entry;
+				++numEntries;
+			}
+
+			blocks.shrink_to_fit();
+			encodedDeltas.shrink_to_fit();
+		}
+
+		// Finds the entry with the highest offset that is <= the given offset. Returns false if
+		// there is no such entry.
+		bool lookup(U32 offset, Entry& outEntry) const
+		{
+			// Find the last block that starts at or before the offset.
+			auto blockIt = std::upper_bound(
+				blocks.begin(), blocks.end(), offset, [](U32 searchOffset, const Block& block) {
+					return searchOffset < block.offset;
+				});
+			if(blockIt == blocks.begin()) { return false; }
+			--blockIt;
+
+			// Decode the block's entries until reaching one past the offset.
+			const Uptr blockIndex = Uptr(blockIt - blocks.begin());
+			const Uptr numBlockEntries = std::min(Uptr(numEntriesPerBlock),
+												  numEntries - blockIndex * numEntriesPerBlock);
+			const U8* nextByte = encodedDeltas.data() + blockIt->encodedDeltaOffset;
+
+			outEntry = Entry(blockIt->offset, blockIt->opIndex);
+			for(Uptr entryIndex = 1; entryIndex < numBlockEntries; ++entryIndex)
+			{
+				const U32 nextOffset = outEntry.first + decodeVarUInt32(nextByte);
+				const U32 nextOpIndex
+					= outEntry.second + U32(decodeZigZag(decodeVarUInt32(nextByte)));
+				if(nextOffset > offset) { break; }
+				outEntry = Entry(nextOffset, nextOpIndex);
+			}
+			return true;
+		}
+
+		Uptr getNumEntries() const { return numEntries; }
+		Uptr getNumBytes() const
+		{
+			return blocks.capacity() * sizeof(Block) + encodedDeltas.capacity();
+		}
+
+	private:
+		struct Block
+		{
+			U32 offset;
+			U32 opIndex;
+			U32 encodedDeltaOffset;
+		};
+
+		std::vector<Block> blocks;
+		std::vector<U8> encodedDeltas;
+		Uptr numEntries = 0;
+
+		void encodeVarUInt32(U32 value)
+		{
+			while(value >= 0x80)
+			{
+				encodedDeltas.push_back(U8(value | 0x80));
+				value >>= 7;
+			};
+			encodedDeltas.push_back(U8(value));
+		}
+
+		static U32 decodeVarUInt32(const U8*& nextByte)
+		{
+			U32 value = 0;
+			for(U32 shift = 0;; shift += 7)
+			{
+				const U8 byte = *nextByte++;
+				value |= U32(byte & 0x7f) << shift;
+				if(!(byte & 0x80)) { return value; }
+			};
+		}
+
+		// Maps signed deltas to unsigned values so that small negative deltas encode to few bytes.
+		static U32 encodeZigZag(I32 value) { return (U32(value) << 1) ^ U32(value >> 31); }
+		static I32 decodeZigZag(U32 value) { return I32(value >> 1) ^ -I32(value & 1); }
+	};
+}
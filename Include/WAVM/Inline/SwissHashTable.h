@@ -0,0 +1,133 @@
+#pragma once
+
+#include "Assert.h"
+#include "BasicTypes.h"
+#include "HashTable.h"
+#include "Impl/OptionalStorage.h"
+#include "WAVM/Platform/Intrinsic.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define WAVM_SWISS_HASH_TABLE_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define WAVM_SWISS_HASH_TABLE_NEON 1
+#endif
+
+namespace WAVM {
+	struct DefaultSwissHashTableAllocPolicy
+	{
+		// The table always has at least one group of buckets.
+		static constexpr Uptr minBuckets = 16;
+
+		static Uptr divideAndRoundUp(Uptr numerator, Uptr denominator)
+		{
+			return (numerator + denominator - 1) / denominator;
+		}
+
+		// The maximum number of buckets that may be occupied by elements or deleted elements
+		// before the table is resized.
+		static Uptr getMaxOccupiedBuckets(Uptr numBuckets) { return numBuckets - numBuckets / 8; }
+
+		static Uptr getMaxDesiredBuckets(Uptr numDesiredElements)
+		{
+			const Uptr maxDesiredBuckets
+				= Uptr(1) << WAVM::ceilLogTwo(divideAndRoundUp(numDesiredElements * 32, 7));
+			return maxDesiredBuckets < minBuckets ? minBuckets : maxDesiredBuckets;
+		}
+
+		static Uptr getMinDesiredBuckets(Uptr numDesiredElements)
+		{
+			if(numDesiredElements == 0) { return 0; }
+			else
+			{
+				const Uptr minDesiredBuckets
+					= Uptr(1) << WAVM::ceilLogTwo(divideAndRoundUp(numDesiredElements * 8, 7));
+				return minDesiredBuckets < minBuckets ? minBuckets : minDesiredBuckets;
+			}
+		}
+	};
+
+	// An open-addressing hash table that probes groups of 16 buckets at a time, in the style of
+	// Abseil's "Swiss tables". It has the same interface as HashTable, and can be used by HashMap
+	// and HashSet in its place.
+	//
+	//   In addition to the array of buckets, the table has an array of control bytes: one for each
+	// bucket. A control byte is either a special value indicating the bucket is empty or holds a
+	// deleted element, or 7 bits of the hash of the element in the bucket. To find a key, the
+	// table loads the control bytes for a group of 16 consecutive buckets, and uses SSE2 or NEON
+	// instructions to compare them all to the key's 7 hash bits at once. Only the buckets whose
+	// control byte matches are checked for the key, so most searches touch a single cache line of
+	// control bytes, and compare the key to a single element.
+	//
+	//   The group to start searching at is indexed by the remaining bits of the key's hash. If the
+	// key isn't in that group, and the group doesn't contain an empty bucket, the search continues
+	// to another group using a triangular probe sequence, which visits every group when the number
+	// of buckets is a power of two. The control bytes for the first 15 buckets are duplicated
+	// after the last bucket, so a group may start at any bucket without wrapping around.
+	//
+	//   Removing an element leaves a "deleted" control byte in its bucket, so searches for other
+	// keys continue past it. The bucket can be reused by a later add, and the deleted buckets are
+	// discarded when the table is resized. If there is an empty bucket close enough to the removed
+	// element that no search could have continued past it, the bucket is marked empty instead.
+	//
+	//   Because searches compare 16 control bytes at once, the table can be kept fuller than
+	// HashTable: the default policy resizes it to keep between 22% and 87.5% of the buckets
+	// occupied.
+	template<typename Key,
+			 typename Element,
+			 typename HashTablePolicy,
+			 typename AllocPolicy = DefaultSwissHashTableAllocPolicy>
+	struct SwissHashTable
+	{
+		typedef HashTableBucket<Element> Bucket;
+
+		SwissHashTable(Uptr estimatedNumElements = 0);
+		SwissHashTable(const SwissHashTable& copy);
+		SwissHashTable(SwissHashTable&& movee) noexcept;
+		~SwissHashTable();
+
+		SwissHashTable& operator=(const SwissHashTable& copyee);
+		SwissHashTable& operator=(SwissHashTable&& movee) noexcept;
+
+		void clear();
+
+		void resize(Uptr newNumBuckets);
+
+		template<typename LookupKey> bool remove(Uptr hash, const LookupKey& key);
+
+		template<typename LookupKey>
+		const Bucket* getBucketForRead(Uptr hash, const LookupKey& key) const;
+		template<typename LookupKey> Bucket* getBucketForModify(Uptr hash, const LookupKey& key);
+		Bucket& getBucketForAdd(Uptr hash, const Key& key);
+
+		Uptr size() const { return numElements; }
+		Uptr numBuckets() const { return hashToBucketIndexMask + 1; }
+
+		Bucket* getBuckets() const { return buckets; }
+
+		// Compute some statistics about the space usage of this hash table. The probe counts are
+		// the number of groups that are searched to find an element.
+		void analyzeSpaceUsage(Uptr& outTotalMemoryBytes,
+							   Uptr& outMaxProbeCount,
+							   F32& outOccupancy,
+							   F32& outAverageProbeCount) const;
+
+	private:
+		Bucket* buckets;
+		I8* controlBytes;
+		Uptr numElements;
+		Uptr numDeletedBuckets;
+		Uptr hashToBucketIndexMask;
+
+		void setControlByte(Uptr bucketIndex, I8 controlByte);
+		Uptr findBucketForInsert(Uptr hash) const;
+
+		void destruct();
+		void copyFrom(const SwissHashTable& copy);
+		void moveFrom(SwissHashTable&& movee) noexcept;
+	};
+
+// The implementation is defined in a separate file.
+#include "Impl/SwissHashTableImpl.h"
+}
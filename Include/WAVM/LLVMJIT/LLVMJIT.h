@@ -70,6 +70,10 @@ namespace WAVM { namespace LLVMJIT {
 	WAVM_API std::string disassembleObject(const TargetSpec& targetSpec,
 										   const std::vector<U8>& objectBytes);
 
+	// Returns the flags that compiled code assumes the WAVM intrinsic function with the given name
+	// is defined with. The runtime checks that they match the flags of the intrinsic definitions.
+	WAVM_API Intrinsics::FunctionFlags getIntrinsicFunctionFlags(const char* name);
+
 	// An opaque type that can be used to reference a loaded JIT module.
 	struct Module;
 
@@ -115,15 +119,16 @@ namespace WAVM { namespace LLVMJIT {
 	// Loads a module from object code, and binds its undefined symbols to the provided bindings.
 	WAVM_API std::shared_ptr<Module> loadModule(
 		const std::vector<U8>& objectFileBytes,
-		HashMap<std::string, FunctionBinding>&& wavmIntrinsicsExportMap,
-		std::vector<IR::FunctionType>&& types,
-		std::vector<FunctionBinding>&& functionImports,
+		const HashMap<std::string, FunctionBinding>& wavmIntrinsicsExportMap,
+		const std::vector<IR::FunctionType>& types,
+		const std::vector<FunctionBinding>& functionImports,
 		std::vector<TableBinding>&& tables,
 		std::vector<MemoryBinding>&& memories,
 		std::vector<GlobalBinding>&& globals,
 		std::vector<ExceptionTypeBinding>&& exceptionTypes,
 		InstanceBinding instance,
 		Uptr tableReferenceBias,
+		Uptr biasedNullTableElement,
 		const std::vector<Runtime::FunctionMutableData*>& functionDefMutableDatas,
 		std::string&& debugName);
 
@@ -139,4 +144,26 @@ namespace WAVM { namespace LLVMJIT {
 
 	// Generates an invoke thunk for a specific function type.
 	WAVM_API Runtime::InvokeThunkPointer getInvokeThunk(IR::FunctionType functionType);
+
+	// Controls how loaded JIT code is described to the Linux perf profiler, so it can attribute
+	// samples in JIT code to named WebAssembly functions.
+	enum class PerfMapMode
+	{
+		none,
+
+		// Writes the address, size, and name of each loaded function to /tmp/perf-<pid>.map.
+		// Functions aren't removed from the map when their module is unloaded, so perf may
+		// attribute samples in a module that reuses their addresses to the unloaded functions.
+		map,
+
+		// Writes each loaded function's code and a mapping from the code to WebAssembly operator
+		// indices to /tmp/jit-<pid>.dump. To use it, record with `perf record -k mono`, and process
+		// the recording with `perf inject --jit`.
+		jitdump,
+	};
+
+	// Sets the perf map mode. Only code loaded after the mode is set is described to perf.
+	// Returns false if the perf map file couldn't be created, or if the mode isn't supported on
+	// this platform.
+	WAVM_API bool setPerfMapMode(PerfMapMode mode);
 }}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Platform/Clock.h"
+#include "WAVM/Platform/Defines.h"
+
+// A registry of counters and histograms that measure the performance of the runtime.
+namespace WAVM { namespace Metrics {
+	namespace Impl {
+		WAVM_API extern std::atomic<bool> enabled;
+	}
+
+	// Metrics are disabled by default. While they are disabled, recording a metric only loads and
+	// tests a flag, and timers don't read the clock.
+	inline bool isEnabled() { return Impl::enabled.load(std::memory_order_relaxed); }
+	WAVM_API void setEnabled(bool enable);
+
+	// The number of shards that the per-thread state of a metric is spread across. Each thread
+	// updates the shard it is assigned to, so threads don't contend for the same cache line.
+	static constexpr Uptr numShards = 16;
+
+	// A counter that only increases (until reset).
+	struct Counter
+	{
+		Counter() = default;
+
+		// Don't allow copying or moving a Counter.
+		Counter(const Counter&) = delete;
+		Counter(Counter&&) = delete;
+		void operator=(const Counter&) = delete;
+		void operator=(Counter&&) = delete;
+
+		void add(U64 delta = 1)
+		{
+			if(isEnabled()) { addImpl(delta); }
+		}
+
+		// Returns the sum of the counter's shards. Adds that happen concurrently with get may or
+		// may not be included.
+		WAVM_API U64 get() const;
+		WAVM_API void reset();
+
+	private:
+		struct alignas(64) Shard
+		{
+			std::atomic<U64> value{0};
+		};
+		Shard shards[numShards];
+
+		WAVM_API void addImpl(U64 delta);
+	};
+
+	enum class Unit
+	{
+		none,
+		bytes,
+
+		// Nanosecond values are exported as seconds.
+		nanoseconds,
+	};
+
+	// A histogram of U64 values. Values less than 2^subBucketBits are counted exactly; larger
+	// values are counted in log-linear buckets that each cover 1/2^subBucketBits of a power of two,
+	// so a bucket's bounds are within 12.5% of any value in it.
+	struct Histogram
+	{
+		static constexpr Uptr subBucketBits = 3;
+		static constexpr Uptr numSubBuckets = Uptr(1) << subBucketBits;
+		static constexpr Uptr numBuckets = numSubBuckets * (64 - subBucketBits + 1);
+
+		const Unit unit;
+
+		Histogram(Unit inUnit) : unit(inUnit) {}
+		WAVM_API ~Histogram();
+
+		// Don't allow copying or moving a Histogram.
+		Histogram(const Histogram&) = delete;
+		Histogram(Histogram&&) = delete;
+		void operator=(const Histogram&) = delete;
+		void operator=(Histogram&&) = delete;
+
+		void record(U64 value)
+		{
+			if(isEnabled()) { recordImpl(value); }
+		}
+
+		// Returns the sums of the histogram's shards. Records that happen concurrently may or may
+		// not be included.
+		WAVM_API U64 getBucketCount(Uptr bucketIndex) const;
+		WAVM_API U64 getSum() const;
+		WAVM_API void reset();
+
+		// Maps between values and bucket indices. getBucketUpperBound returns the greatest value
+		// that is counted in the bucket.
+		WAVM_API static Uptr getBucketIndex(U64 value);
+		WAVM_API static U64 getBucketUpperBound(Uptr bucketIndex);
+
+	private:
+		// Each shard has its own bucket counts, so threads recording similar values don't contend
+		// for the same bucket. The shards take about 64KB, so they are only allocated when the
+		// first value is recorded, which doesn't happen while metrics are disabled.
+		struct alignas(64) Shard
+		{
+			std::atomic<U64> sum{0};
+			std::atomic<U64> bucketCounts[numBuckets]{};
+		};
+		std::atomic<Shard*> shards{nullptr};
+
+		WAVM_API void recordImpl(U64 value);
+	};
+
+	// Records the time between its construction and destruction in a histogram of nanoseconds. If
+	// metrics were disabled when the timer was constructed, nothing is recorded.
+	struct Timer
+	{
+		Timer(Histogram& inHistogram)
+		: histogram(inHistogram), startNS(isEnabled() ? getNanoseconds() : 0)
+		{
+		}
+
+		~Timer()
+		{
+			if(startNS) { histogram.record(getNanoseconds() - startNS); }
+		}
+
+	private:
+		Histogram& histogram;
+		U64 startNS;
+
+		static U64 getNanoseconds()
+		{
+			return U64(I64(Platform::getClockTime(Platform::Clock::monotonic).ns));
+		}
+	};
+
+	// Returns the metric registered with a name and optional label, registering it if this is the
+	// first time it was requested. The registered metrics are never freed, so the returned
+	// reference may be cached, e.g. in a static local variable. All the metrics with the same name
+	// must be of the same kind, and have the same help string and label name.
+	WAVM_API Counter& getCounter(const char* name,
+								 const char* help,
+								 const char* labelName = nullptr,
+								 const char* labelValue = nullptr);
+	WAVM_API Histogram& getHistogram(const char* name,
+									 const char* help,
+									 Unit unit,
+									 const char* labelName = nullptr,
+									 const char* labelValue = nullptr);
+
+	enum class MetricKind
+	{
+		counter,
+		histogram,
+	};
+
+	struct HistogramBucketSnapshot
+	{
+		U64 upperBound;
+		U64 count;
+	};
+
+	struct MetricSnapshot
+	{
+		std::string name;
+		std::string help;
+		std::string labelName;
+		std::string labelValue;
+		MetricKind kind;
+		Unit unit;
+
+		// The value of a counter, or the number of values recorded in a histogram.
+		U64 count;
+
+		// The sum of the values recorded in a histogram, and its buckets that contain values in
+		// order of increasing upper bound.
+		U64 sum;
+		std::vector<HistogramBucketSnapshot> buckets;
+	};
+
+	// Returns a snapshot of all registered metrics, sorted by name and label value.
+	WAVM_API std::vector<MetricSnapshot> getSnapshot();
+
+	// Formats a snapshot in the Prometheus text exposition format.
+	WAVM_API std::string formatPrometheusText(const std::vector<MetricSnapshot>& snapshot);
+
+	// Resets all registered metrics to zero.
+	WAVM_API void reset();
+}}
@@ -50,6 +50,14 @@ namespace WAVM { namespace NFA {
 		// Constructs a DFA from the abstract builder object (which is destroyed).
 		Machine(Builder* inBuilder);
 
+		// Constructs a DFA from tables that were serialized by dumpCPPTables. The state transition
+		// table is run-length encoded as (next state, run length) pairs.
+		Machine(const U32* inCharToOffsetMap,
+				const I16* runLengthEncodedTransitions,
+				Uptr numRunLengthEncodedTransitions,
+				Uptr inNumClasses,
+				Uptr inNumStates);
+
 		// Feeds characters into the DFA until it reaches a terminal state.
 		// Upon reaching a terminal state, the state is returned, and the nextChar pointer
 		// is updated to point to the first character not consumed by the DFA.
@@ -90,6 +98,14 @@ namespace WAVM { namespace NFA {
 		// Dumps the DFA's states and edges to the GraphViz .dot format.
 		std::string dumpDFAGraphViz() const;
 
+		// Dumps the DFA's tables to C++ source that defines constexpr arrays prefixed by
+		// namePrefix, which may be passed to the serialized table constructor above.
+		std::string dumpCPPTables(const char* namePrefix) const;
+
+		// Returns true if both DFAs have identical tables.
+		bool operator==(const Machine& other) const;
+		bool operator!=(const Machine& other) const { return !(*this == other); }
+
 	private:
 		typedef I16 InternalStateIndex;
 		static constexpr InternalStateIndex internalMaxStates = INT16_MAX;
@@ -15,7 +15,13 @@ namespace WAVM { namespace Platform {
 		monotonic,
 
 		// The amount of CPU time used by this process.
-		processCPUTime
+		processCPUTime,
+
+		// Lower resolution versions of realtime and monotonic that share their origin, but may be
+		// much cheaper to read. On platforms without a cheaper clock, they are the same as the
+		// corresponding precise clock.
+		realtimeCoarse,
+		monotonicCoarse
 	};
 
 	WAVM_API Time getClockTime(Clock clock);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/Platform/Defines.h"
@@ -24,4 +25,35 @@ namespace WAVM { namespace Platform {
 		virtual ~HostFS() override {}
 	};
 	WAVM_API HostFS& getHostFS();
+
+	// Creates a file system whose root is the given host directory. Paths are resolved relative to
+	// open handles for the root directory and up to maxCachedDirs recently used subdirectories.
+	// Returns null if the root directory couldn't be opened.
+	WAVM_API std::shared_ptr<VFS::FileSystem> makeHostSandboxFS(const std::string& rootPath,
+																Uptr maxCachedDirs = 128);
+
+	// A read-only mapping of a host file's contents into the address space.
+	struct MappedFile
+	{
+		virtual ~MappedFile() {}
+
+		const U8* getData() const { return data; }
+		Uptr getNumBytes() const { return numBytes; }
+
+		// Maps numBytes of the file starting at offset over the committed pages at destAddress.
+		// The pages are mapped copy-on-write, so writing to them doesn't modify the file. offset,
+		// numBytes, and destAddress must be multiples of the page size. Returns false if the pages
+		// couldn't be mapped.
+		virtual bool mapCopyOnWrite(U64 offset, Uptr numBytes, U8* destAddress) = 0;
+
+	protected:
+		const U8* data;
+		Uptr numBytes;
+
+		MappedFile(const U8* inData, Uptr inNumBytes) : data(inData), numBytes(inNumBytes) {}
+	};
+
+	// Maps a host file into the address space. Returns null if the file couldn't be opened or
+	// mapped.
+	WAVM_API std::shared_ptr<MappedFile> mapFile(const std::string& path);
 }}
@@ -4,4 +4,9 @@
 
 namespace WAVM { namespace Platform {
 	WAVM_API void getCryptographicRNG(U8* outRandomBytes, Uptr numBytes);
+
+	// Returns a number that changes in the child process each time the process forks. Random state
+	// that is derived from getCryptographicRNG must be discarded when it changes, so the parent and
+	// child don't generate the same numbers.
+	WAVM_API U64 getForkGeneration();
 }}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <functional>
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Time.h"
+#include "WAVM/Platform/Defines.h"
+#include "WAVM/Platform/Diagnostics.h"
+
+namespace WAVM { namespace Platform {
+	// A sampling profiler. While sampling is started, each sampled thread is interrupted whenever
+	// it has used samplingInterval of CPU time, and the call stack it was interrupted at is
+	// recorded in a buffer for the thread. The call stack is walked using frame pointers, so the
+	// callers of code that doesn't maintain a frame pointer may be missing from it.
+	//
+	// Threads created by createThread while sampling is started are sampled until they exit.
+	// Other threads are only sampled between calls to startSamplingCurrentThread and
+	// stopSamplingCurrentThread.
+
+	// Starts sampling. Returns false if sampling isn't supported on this platform.
+	WAVM_API bool startSampling(Time samplingInterval);
+	WAVM_API void stopSampling();
+
+	// Starts or stops sampling the calling thread. startSamplingCurrentThread returns false if
+	// sampling isn't started.
+	WAVM_API bool startSamplingCurrentThread();
+	WAVM_API void stopSamplingCurrentThread();
+
+	// Calls visitSample with each call stack that has been recorded since the last call, and
+	// returns the number of samples that were dropped because a thread's buffer was full.
+	WAVM_API Uptr readSamples(const std::function<void(const CallStack&)>& visitSample);
+}}
@@ -8,6 +8,7 @@
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/Inline/HashMap.h"
 #include "WAVM/Runtime/Runtime.h"
+#include "WAVM/RuntimeABI/RuntimeABI.h"
 
 namespace WAVM { namespace Runtime {
 	struct ContextRuntimeData;
@@ -35,16 +36,32 @@ namespace WAVM { namespace Intrinsics {
 		WAVM_API Function(Intrinsics::Module* moduleRef,
 						  const char* inName,
 						  void* inNativeFunction,
-						  IR::FunctionType type);
+						  IR::FunctionType type,
+						  FunctionFlags inFlags = FunctionFlags::none);
+
+		// Creates an intrinsic function that is bound to an environment value: the native function
+		// receives the environment as an additional leading i64 parameter, which is supplied by
+		// the thunk and omitted from the type of the instantiated function.
+		WAVM_API Function(Intrinsics::Module* moduleRef,
+						  const char* inName,
+						  void* inNativeFunction,
+						  IR::FunctionType type,
+						  U64 inEnvironment);
 
 		const char* getName() const { return name; }
 		IR::FunctionType getType() const { return type; }
 		void* getNativeFunction() const { return nativeFunction; }
+		bool hasEnvironment() const { return hasEnv; }
+		U64 getEnvironment() const { return environment; }
+		FunctionFlags getFlags() const { return flags; }
 
 	private:
 		const char* name;
 		IR::FunctionType type;
 		void* nativeFunction;
+		bool hasEnv;
+		U64 environment;
+		FunctionFlags flags;
 	};
 
 	// The base class of Intrinsic globals.
@@ -146,15 +163,24 @@ namespace WAVM { namespace Intrinsics {
 
 #define WAVM_INTRINSIC_MODULE_REF(name) getIntrinsicModule_##name()
 
-#define WAVM_DEFINE_INTRINSIC_FUNCTION(module, nameString, Result, cName, ...)                     \
+#define WAVM_DEFINE_INTRINSIC_FUNCTION_WITH_FLAGS(module, nameString, flags, Result, cName, ...)   \
 	static Result cName(WAVM::Runtime::ContextRuntimeData* contextRuntimeData, ##__VA_ARGS__);     \
 	static WAVM::Intrinsics::Function cName##Intrinsic(                                            \
 		getIntrinsicModule_##module(),                                                             \
 		nameString,                                                                                \
 		(void*)&cName,                                                                             \
-		WAVM::Intrinsics::inferIntrinsicFunctionType(&cName));                                     \
+		WAVM::Intrinsics::inferIntrinsicFunctionType(&cName),                                      \
+		flags);                                                                                    \
 	static Result cName(WAVM::Runtime::ContextRuntimeData* contextRuntimeData, ##__VA_ARGS__)
 
+#define WAVM_DEFINE_INTRINSIC_FUNCTION(module, nameString, Result, cName, ...)                     \
+	WAVM_DEFINE_INTRINSIC_FUNCTION_WITH_FLAGS(module,                                              \
+											  nameString,                                          \
+											  WAVM::Intrinsics::FunctionFlags::none,               \
+											  Result,                                              \
+											  cName,                                               \
+											  ##__VA_ARGS__)
+
 #define WAVM_DEFINE_INTRINSIC_FUNCTION_WITH_CONTEXT_SWITCH(module, nameString, Result, cName, ...) \
 	static WAVM::Intrinsics::ResultInContextRuntimeData<Result>* cName(                            \
 		WAVM::Runtime::ContextRuntimeData* contextRuntimeData, ##__VA_ARGS__);                     \
@@ -297,7 +297,7 @@ namespace WAVM { namespace Runtime {
 	WAVM_API std::string asString(const InstructionSource& source);
 
 	// Looks up the source of an instruction from either a native or WASM module.
-	bool getInstructionSourceByAddress(Uptr ip, InstructionSource& outSource);
+	WAVM_API bool getInstructionSourceByAddress(Uptr ip, InstructionSource& outSource);
 
 	// Describes a call stack.
 	WAVM_API std::vector<std::string> describeCallStack(const Platform::CallStack& callStack);
@@ -468,6 +468,29 @@ namespace WAVM { namespace Runtime {
 										 std::string&& debugName,
 										 ResourceQuotaRefParam resourceQuota = ResourceQuotaRef());
 
+	// An instantiation template holds the work of instantiating a module that doesn't differ
+	// between instances with the same imports: the type checked imports, the deserialized debug
+	// names, the export name table, and the layout of the module's data and elem segments.
+	// Instantiating from a template skips that work, so it's faster for a module that is
+	// instantiated many times with the same imports.
+	// A template keeps its compartment and imports alive until it's destroyed, so it must be
+	// destroyed before the compartment can be freed by tryCollectCompartment.
+	struct InstantiationTemplate;
+	typedef std::shared_ptr<InstantiationTemplate> InstantiationTemplateRef;
+	typedef const std::shared_ptr<InstantiationTemplate>& InstantiationTemplateRefParam;
+
+	// Creates an instantiation template for a module with the given imports. The imports are
+	// checked the same way as by instantiateModule.
+	WAVM_API InstantiationTemplateRef createInstantiationTemplate(Compartment* compartment,
+																  ModuleConstRefParam module,
+																  ImportBindings&& imports,
+																  std::string&& debugName);
+
+	// Instantiates a module from an instantiation template. May throw a runtime exception for bad
+	// segment offsets. It's safe to instantiate the same template from multiple threads.
+	WAVM_API Instance* instantiateModule(InstantiationTemplateRefParam instantiationTemplate,
+										 ResourceQuotaRefParam resourceQuota = ResourceQuotaRef());
+
 	// Gets the start function of a Instance.
 	WAVM_API Function* getStartFunction(const Instance* instance);
 
@@ -507,7 +530,20 @@ namespace WAVM { namespace Runtime {
 	// Compartments
 	//
 
-	WAVM_API Compartment* createCompartment(std::string&& debugName = "");
+	// Limits on the number of objects a compartment may contain. A compartment reserves address
+	// space for maxContexts contexts and commits the runtime data for maxMemories memories and
+	// maxTables tables up front, so lowering these limits allows many more compartments to coexist
+	// in one process. Each limit must be at least 1; limits greater than the absolute maximums
+	// defined in RuntimeABI.h are clamped to them.
+	struct CompartmentLimits
+	{
+		Uptr maxContexts = UINTPTR_MAX;
+		Uptr maxMemories = UINTPTR_MAX;
+		Uptr maxTables = UINTPTR_MAX;
+	};
+
+	WAVM_API Compartment* createCompartment(std::string&& debugName = "",
+											const CompartmentLimits& limits = CompartmentLimits());
 
 	WAVM_API Compartment* cloneCompartment(const Compartment* compartment,
 										   std::string&& debugName = "");
@@ -5,7 +5,6 @@
 //
 
 #include <atomic>
-#include <map>
 #include "WAVM/IR/Types.h"
 #include "WAVM/IR/Value.h"
 #include "WAVM/Inline/BasicTypes.h"
@@ -15,6 +14,29 @@ namespace WAVM { namespace LLVMJIT {
 	struct Module;
 }}
 
+namespace WAVM { namespace Intrinsics {
+	// Properties of an intrinsic function that allow calls to it to be compiled more efficiently.
+	// The flags of the WAVM intrinsics that compiled code calls must match the flags returned by
+	// LLVMJIT::getIntrinsicFunctionFlags, which is checked when the first module is instantiated.
+	enum class FunctionFlags : U32
+	{
+		none = 0,
+
+		// The function never throws an exception or unwinds the stack, so calls to it don't need
+		// an unwind edge, even inside a try block.
+		noThrow = 1 << 0,
+	};
+
+	inline FunctionFlags operator|(FunctionFlags left, FunctionFlags right)
+	{
+		return FunctionFlags(U32(left) | U32(right));
+	}
+	inline bool hasFlags(FunctionFlags flags, FunctionFlags requiredFlags)
+	{
+		return (U32(flags) & U32(requiredFlags)) == U32(requiredFlags);
+	}
+}}
+
 namespace WAVM { namespace Runtime {
 	// Forward declarations
 	struct Compartment;
@@ -23,6 +45,7 @@ namespace WAVM { namespace Runtime {
 	struct Object;
 	struct Table;
 	struct Memory;
+	struct CompartmentRuntimeData;
 
 	// Runtime object types. This must be a superset of IR::ExternKind, with IR::ExternKind
 	// values having the same representation in Runtime::ObjectKind.
@@ -57,7 +80,8 @@ namespace WAVM { namespace Runtime {
 	static constexpr Uptr contextNumBytes = 16384;
 	static constexpr Uptr maxThunkArgAndReturnBytes = 256;
 	static constexpr Uptr maxMutableGlobals
-		= (contextNumBytes - maxThunkArgAndReturnBytes - sizeof(Context*))
+		= (contextNumBytes - maxThunkArgAndReturnBytes - sizeof(Context*)
+		   - sizeof(CompartmentRuntimeData*))
 		  / sizeof(IR::UntaggedValue);
 	static constexpr Uptr contextRuntimeDataAlignment = 16384;
 
@@ -69,6 +93,7 @@ namespace WAVM { namespace Runtime {
 	{
 		U8 thunkArgAndReturnData[maxThunkArgAndReturnBytes];
 		Context* context;
+		CompartmentRuntimeData* compartmentRuntimeData;
 		IR::UntaggedValue mutableGlobals[maxMutableGlobals];
 	};
 
@@ -91,9 +116,10 @@ namespace WAVM { namespace Runtime {
 	{
 		void* base;
 		Uptr endIndex;
+		std::atomic<Uptr> numElements;
 	};
 
-	static_assert(sizeof(TableRuntimeData) == sizeof(Uptr) * 2,
+	static_assert(sizeof(TableRuntimeData) == sizeof(Uptr) * 3,
 				  "TableRuntimeData isn't the expected size");
 
 	static constexpr Uptr maxMemories = 255;
@@ -102,7 +128,6 @@ namespace WAVM { namespace Runtime {
 	static constexpr Uptr maxTables = (compartmentNonContextBytes - sizeof(Compartment*)
 									   - maxMemories * sizeof(MemoryRuntimeData))
 									  / sizeof(TableRuntimeData);
-	static constexpr Uptr compartmentRuntimeDataAlignmentLog2 = 31;
 
 	struct CompartmentRuntimeData
 	{
@@ -174,7 +199,6 @@ namespace WAVM { namespace Runtime {
 		Runtime::Function* function = nullptr;
 		Uptr numCodeBytes = 0;
 		std::atomic<Uptr> numRootReferences{0};
-		std::map<U32, U32> offsetToOpIndexMap;
 		std::string debugName;
 		std::atomic<InvokeThunkPointer> invokeThunk{nullptr};
 		void* userData{nullptr};
@@ -225,8 +249,6 @@ namespace WAVM { namespace Runtime {
 
 	inline CompartmentRuntimeData* getCompartmentRuntimeData(ContextRuntimeData* contextRuntimeData)
 	{
-		return reinterpret_cast<CompartmentRuntimeData*>(
-			reinterpret_cast<Uptr>(contextRuntimeData)
-			& -(Iptr(1) << compartmentRuntimeDataAlignmentLog2));
+		return contextRuntimeData->compartmentRuntimeData;
 	}
 }}
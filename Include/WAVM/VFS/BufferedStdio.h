@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Time.h"
+#include "WAVM/VFS/VFS.h"
+
+namespace WAVM { namespace VFS {
+	// Wraps a process's stdio VFDs so that writes to stdout and stderr are buffered in memory
+	// instead of each needing a host syscall. Both outputs share a single buffer, and buffered
+	// output is written to the inner VFDs in the order it was written, so stdout and stderr
+	// interleave the same way they would unbuffered. The buffer is flushed when it's half full,
+	// after flushInterval has elapsed, when an output VFD is synced or closed, before reading from
+	// stdin, and when the BufferedStdio is destroyed.
+	//
+	// Only character devices and pipes are buffered: if an output is another type of file, the
+	// corresponding VFD returned by the BufferedStdio is the inner VFD. Closing the wrapper VFDs
+	// doesn't close the inner VFDs, and the wrappers must not be used after the BufferedStdio is
+	// destroyed.
+	struct BufferedStdio
+	{
+		virtual ~BufferedStdio() {}
+
+		virtual VFD* getStdIn() = 0;
+		virtual VFD* getStdOut() = 0;
+		virtual VFD* getStdErr() = 0;
+
+		// Writes any buffered output to the inner VFDs.
+		virtual Result flush() = 0;
+	};
+
+	WAVM_API std::shared_ptr<BufferedStdio> makeBufferedStdio(VFD* stdIn,
+															  VFD* stdOut,
+															  VFD* stdErr,
+															  Uptr numBufferBytes = 65536,
+															  Time flushInterval = Time{100000000});
+}}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include "WAVM/VFS/VFS.h"
+
+namespace WAVM { namespace Platform {
+	struct MappedFile;
+}}
+
+namespace WAVM { namespace VFS {
+	// Creates a read-only file system from an image written by writeImage. Reads are served
+	// directly from the mapped image, and the file contents can be mapped copy-on-write into other
+	// memory. Returns null if the image is malformed.
+	WAVM_API std::shared_ptr<FileSystem> makeImageFS(std::shared_ptr<Platform::MappedFile> image);
+
+	// Writes an image of the directory tree at rootPath in sourceFS to outputFD. Only regular
+	// files and directories are included in the image.
+	WAVM_API Result writeImage(FileSystem* sourceFS,
+							   const std::string& rootPath,
+							   VFD* outputFD);
+}}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <memory>
+
+namespace WAVM { namespace VFS {
+	struct FileSystem;
+
+	// Creates an empty file system that stores its files and directories in memory.
+	WAVM_API std::shared_ptr<FileSystem> makeMemoryFS();
+}}
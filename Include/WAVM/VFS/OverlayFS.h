@@ -0,0 +1,16 @@
+#pragma once
+
+#include <memory>
+
+namespace WAVM { namespace VFS {
+	struct FileSystem;
+
+	// Creates a file system that layers the contents of upperFS over lowerFS. lowerFS is never
+	// modified: files in lowerFS are copied to upperFS before they are opened for writing or their
+	// times are set by path, VFDs opened read-only for files in lowerFS reject changes to the file
+	// with Result::notPermitted, and deleting a file or directory in lowerFS just hides it. Both
+	// file systems must outlive the overlay, and the overlay must outlive the directory VFDs opened
+	// from it.
+	WAVM_API std::shared_ptr<FileSystem> makeOverlayFS(FileSystem* lowerFS,
+													   FileSystem* upperFS);
+}}
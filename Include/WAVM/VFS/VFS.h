@@ -213,6 +213,15 @@ namespace WAVM { namespace VFS {
 
 		virtual Result openDir(DirEntStream*& outStream) = 0;
 
+		// Maps numBytes of the file starting at offset over the committed pages at destAddress,
+		// without copying the file if possible. Writes to the pages don't modify the file, and
+		// bytes past the end of the file are zeroed. offset, numBytes, and destAddress must be
+		// multiples of the page size. Returns notSupported if the file can't be mapped.
+		virtual Result mapCopyOnWrite(U64 offset, Uptr numBytes, U8* destAddress)
+		{
+			return Result::notSupported;
+		}
+
 		Result read(void* outData,
 					Uptr numBytes,
 					Uptr* outNumBytesRead = nullptr,
@@ -32,6 +32,11 @@ namespace WAVM { namespace WASI {
 	WAVM_API Runtime::Memory* getProcessMemory(const Process& process);
 	WAVM_API void setProcessMemory(Process& process, Runtime::Memory* memory);
 
+	// Makes the process's realtime and monotonic clocks use the cheaper coarse platform clocks,
+	// trading resolution for speed in guests that read the clock very frequently. Even without
+	// this, the coarse clocks are used for reads that request a precision they can satisfy.
+	WAVM_API void setProcessUsesCoarseClocks(Process& process, bool useCoarseClocks);
+
 	enum class SyscallTraceLevel
 	{
 		none,
@@ -399,17 +399,19 @@ namespace WAVM { namespace WAST {
 		}
 	};
 
+	// Benchmarks either an InvokeAction, which is invoked repeatedly, or a ModuleAction, which is
+	// repeatedly compiled and instantiated.
 	struct BenchmarkCommand : Command
 	{
 		std::string name;
-		std::unique_ptr<InvokeAction> invokeAction;
+		std::unique_ptr<Action> action;
 
 		BenchmarkCommand(TextFileLocus&& inLocus,
 						 std::string&& inName,
-						 std::unique_ptr<InvokeAction>&& inInvokeAction)
+						 std::unique_ptr<Action>&& inAction)
 		: Command(Command::benchmark, std::move(inLocus))
 		, name(std::move(inName))
-		, invokeAction(std::move(inInvokeAction))
+		, action(std::move(inAction))
 		{
 		}
 	};
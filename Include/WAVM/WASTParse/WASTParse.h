@@ -55,10 +55,22 @@ namespace WAVM { namespace WAST {
 
 	// Parse a module from a string. Returns true if it succeeds, and writes the module to
 	// outModule. If it fails, returns false and appends a list of errors to outErrors.
+	// The module's function bodies are parsed on up to numThreads threads. If numThreads is 0, it
+	// is chosen from the number of hardware threads and the size of the module. The result doesn't
+	// depend on the number of threads.
 	WAVM_API bool parseModule(const char* string,
 							  Uptr stringLength,
 							  IR::Module& outModule,
-							  std::vector<Error>& outErrors);
+							  std::vector<Error>& outErrors,
+							  Uptr numThreads = 0);
+
+	// Generates the C++ source for the lexer's precomputed DFA tables (Lib/WASTParse/LexerTables.h)
+	// by building them from the lexer's token definitions.
+	WAVM_API std::string generatePrecomputedLexerTables();
+
+	// Returns true if the precomputed lexer tables compiled into WAVM are identical to the tables
+	// built from the lexer's token definitions at runtime. Logs an error if they differ.
+	WAVM_API bool validatePrecomputedLexerTables();
 
 	WAVM_API void reportParseErrors(const char* filename,
 									const char* source,
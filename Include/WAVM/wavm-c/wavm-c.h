@@ -111,6 +111,7 @@ WASM_DECLARE_FEATURE(multivalue)
 WASM_DECLARE_FEATURE(reference_types)
 WASM_DECLARE_FEATURE(extended_name_section)
 WASM_DECLARE_FEATURE(multimemory)
+WASM_DECLARE_FEATURE(relaxed_simd)
 
 // Non-standard extensions.
 WASM_DECLARE_FEATURE(shared_tables)
@@ -457,6 +458,40 @@ WASM_C_API own wasm_func_t* wasm_func_new_with_env(wasm_compartment_t*,
 												   void (*finalizer)(void*),
 												   const char* debug_name);
 
+// Creates a function that calls a native function directly with the C calling convention, passing
+// env as the first argument followed by the function's parameters. It avoids marshalling the
+// arguments and results through arrays, but is only supported for function types whose parameters
+// are i32, i64, f32, or f64, and that have at most one result of those types. The native function
+// for (param i32 f64) (result i64) is declared as int64_t callback(void* env, int32_t, double).
+// A raw callback may not return a trap. Returns NULL if the function type isn't supported.
+WASM_C_API own wasm_func_t* wasm_func_new_raw(wasm_compartment_t*,
+											  const wasm_functype_t* type,
+											  void* raw_callback,
+											  void* env,
+											  void (*finalizer)(void*),
+											  const char* debug_name);
+
+// Describes a function to create with wasm_func_new_batch. If raw_callback is non-null, the
+// function is created as if by wasm_func_new_raw, and callback is ignored.
+typedef struct wasm_func_desc_t
+{
+	const wasm_functype_t* type;
+	wasm_func_callback_with_env_t callback;
+	void* raw_callback;
+	void* env;
+	void (*finalizer)(void*);
+	const char* debug_name;
+} wasm_func_desc_t;
+
+// Creates num_funcs functions at once, sharing the cost of compiling and instantiating the code
+// that adapts them to be called from WebAssembly. The finalizers are called once all the functions
+// created by the batch have been collected. Returns false without creating any functions if any of
+// the descriptions are unsupported.
+WASM_C_API bool wasm_func_new_batch(wasm_compartment_t*,
+									size_t num_funcs,
+									const wasm_func_desc_t descs[],
+									own wasm_func_t* out_funcs[]);
+
 WASM_C_API own wasm_functype_t* wasm_func_type(const wasm_func_t*);
 WASM_C_API size_t wasm_func_param_arity(const wasm_func_t*);
 WASM_C_API size_t wasm_func_result_arity(const wasm_func_t*);
@@ -568,6 +603,26 @@ WASM_C_API own wasm_instance_t* wasm_instance_new(wasm_store_t*,
 WASM_C_API size_t wasm_instance_num_exports(const wasm_instance_t*);
 WASM_C_API wasm_extern_t* wasm_instance_export(const wasm_instance_t*, size_t index);
 
+///////////////////////////////////////////////////////////////////////////////
+// Metrics
+
+// Metrics of compilation, instantiation, memory growth, traps, garbage collection, the object
+// cache, and WASI syscalls are only recorded while metrics are enabled. They are disabled by
+// default.
+WASM_C_API void wasm_metrics_set_enabled(bool enable);
+WASM_C_API void wasm_metrics_reset();
+
+// Gets the value of a counter, or the number and sum of the values recorded in a histogram (in
+// nanoseconds for durations). label_value may be NULL for metrics without a label. Returns false
+// if no metric with the name and label value has been recorded.
+WASM_C_API bool wasm_metrics_get(const char* name,
+								 const char* label_value,
+								 uint64_t* out_count,
+								 uint64_t* out_sum);
+
+// Returns the metrics in the Prometheus text exposition format.
+WASM_C_API own char* wasm_metrics_print_prometheus(size_t* out_num_chars);
+
 ///////////////////////////////////////////////////////////////////////////////
 // Convenience
 
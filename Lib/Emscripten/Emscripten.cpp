@@ -819,6 +819,9 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(env,
 	return result;
 }
 
+// The number of IOVs that writeImpl can translate without allocating memory for them.
+static constexpr I32 numStackIOVs = 8;
+
 static emabi::Result writeImpl(Emscripten::Process* process,
 							   emabi::FD fd,
 							   emabi::Address iovsAddress,
@@ -832,8 +835,12 @@ static emabi::Result writeImpl(Emscripten::Process* process,
 	VFS::VFD* vfd = getVFD(process, fd);
 	if(!vfd) { return emabi::ebadf; }
 
-	// Allocate memory for the IOWriteBuffers.
-	auto vfsWriteBuffers = (VFS::IOWriteBuffer*)malloc(numIOVs * sizeof(VFS::IOWriteBuffer));
+	// Use a buffer on the stack for the IOWriteBuffers, unless there are too many IOVs to fit.
+	VFS::IOWriteBuffer stackWriteBuffers[numStackIOVs];
+	VFS::IOWriteBuffer* vfsWriteBuffers
+		= numIOVs <= numStackIOVs
+			  ? stackWriteBuffers
+			  : (VFS::IOWriteBuffer*)malloc(numIOVs * sizeof(VFS::IOWriteBuffer));
 
 	// Catch any out-of-bounds memory access exceptions that are thrown.
 	emabi::Result result = emabi::esuccess;
@@ -871,7 +878,7 @@ static emabi::Result writeImpl(Emscripten::Process* process,
 		});
 
 	// Free the VFS write buffers.
-	free(vfsWriteBuffers);
+	if(vfsWriteBuffers != stackWriteBuffers) { free(vfsWriteBuffers); }
 
 	return result;
 }
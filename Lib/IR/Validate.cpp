@@ -1,7 +1,9 @@
 #include "WAVM/IR/Validate.h"
 #include <stdint.h>
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 #include "WAVM/IR/FeatureSpec.h"
@@ -17,6 +19,8 @@
 #include "WAVM/Inline/Hash.h"
 #include "WAVM/Inline/HashSet.h"
 #include "WAVM/Logging/Logging.h"
+#include "WAVM/Platform/Mutex.h"
+#include "WAVM/Platform/Thread.h"
 
 using namespace WAVM;
 using namespace WAVM::IR;
@@ -1291,15 +1295,107 @@ void IR::validateDataSegments(ModuleValidationState& state)
 	}
 }
 
+static void validateFunctionCode(ModuleValidationState& state, const FunctionDef& functionDef)
+{
+	CodeValidationStream validationStream(state, functionDef);
+	OperatorDecoderStream operatorDecoderStream(functionDef.code);
+	while(operatorDecoderStream) { operatorDecoderStream.decodeOp(validationStream); }
+	validationStream.finish();
+}
+
 void IR::validateCodeSection(ModuleValidationState& state)
 {
 	const Module& module = state.module;
-	for(const auto& functionDef : module.functions.defs)
+	for(const FunctionDef& functionDef : module.functions.defs)
+	{ validateFunctionCode(state, functionDef); }
+}
+
+namespace {
+	struct ParallelCodeValidation
 	{
-		CodeValidationStream validationStream(state, functionDef);
-		OperatorDecoderStream operatorDecoderStream(functionDef.code);
-		while(operatorDecoderStream) { operatorDecoderStream.decodeOp(validationStream); }
+		ModuleValidationState& moduleValidationState;
+		std::atomic<Uptr> nextFunctionDefIndex{0};
+
+		// The index of the lowest-indexed function definition that has been found to be invalid,
+		// or UINTPTR_MAX if none has. firstValidationErrorMessage is the message of its exception.
+		Platform::Mutex firstValidationErrorMutex;
+		std::atomic<Uptr> firstInvalidFunctionDefIndex{UINTPTR_MAX};
+		std::string firstValidationErrorMessage;
+
+		ParallelCodeValidation(ModuleValidationState& inModuleValidationState)
+		: moduleValidationState(inModuleValidationState)
+		{
+		}
+	};
+}
+
+static I64 parallelCodeValidationThreadMain(void* validationVoid)
+{
+	ParallelCodeValidation& validation = *(ParallelCodeValidation*)validationVoid;
+	const Module& module = validation.moduleValidationState.module;
+	while(true)
+	{
+		// The function definitions are claimed in order, so once a function is found to be invalid,
+		// the functions claimed after it can't change which exception is thrown.
+		const Uptr functionDefIndex = validation.nextFunctionDefIndex++;
+		if(functionDefIndex >= module.functions.defs.size()
+		   || functionDefIndex > validation.firstInvalidFunctionDefIndex.load())
+		{ break; }
+
+		try
+		{
+			validateFunctionCode(validation.moduleValidationState,
+								 module.functions.defs[functionDefIndex]);
+		}
+		catch(ValidationException const& exception)
+		{
+			Platform::Mutex::Lock lock(validation.firstValidationErrorMutex);
+			if(functionDefIndex < validation.firstInvalidFunctionDefIndex.load())
+			{
+				validation.firstInvalidFunctionDefIndex.store(functionDefIndex);
+				validation.firstValidationErrorMessage = exception.message;
+			}
+		}
+	}
+	return 0;
+}
+
+void IR::validateCodeSectionInParallel(ModuleValidationState& state, Uptr numThreads)
+{
+	const Module& module = state.module;
+	const Uptr numFunctionDefs = module.functions.defs.size();
+
+	if(!numThreads)
+	{
+		// Only use as many threads as there is enough code to amortize the cost of creating them.
+		static constexpr Uptr minCodeBytesPerThread = 64 * 1024;
+		Uptr numCodeBytes = 0;
+		for(const FunctionDef& functionDef : module.functions.defs)
+		{ numCodeBytes += functionDef.code.size(); }
+		numThreads = std::min(Platform::getNumberOfHardwareThreads(),
+							  numCodeBytes / minCodeBytesPerThread + 1);
+	}
+	numThreads = std::min(numThreads, numFunctionDefs);
+
+	if(numThreads <= 1)
+	{
+		validateCodeSection(state);
+		return;
 	}
+
+	// Validate the code on numThreads - 1 new threads, and this thread.
+	ParallelCodeValidation validation(state);
+	std::vector<Platform::Thread*> threads;
+	for(Uptr threadIndex = 1; threadIndex < numThreads; ++threadIndex)
+	{
+		threads.push_back(
+			Platform::createThread(0, parallelCodeValidationThreadMain, &validation));
+	}
+	parallelCodeValidationThreadMain(&validation);
+	for(Platform::Thread* thread : threads) { Platform::joinThread(thread); }
+
+	if(validation.firstInvalidFunctionDefIndex.load() != UINTPTR_MAX)
+	{ throw ValidationException(std::move(validation.firstValidationErrorMessage)); }
 }
 
 namespace WAVM { namespace IR {
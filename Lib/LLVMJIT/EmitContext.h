@@ -88,14 +88,13 @@ namespace WAVM { namespace LLVMJIT {
 
 		llvm::Value* getCompartmentAddress()
 		{
-			// Derive the compartment runtime data from the context address by masking off the lower
-			// 31 bits.
-			return irBuilder.CreateIntToPtr(
-				irBuilder.CreateAnd(
-					irBuilder.CreatePtrToInt(irBuilder.CreateLoad(contextPointerVariable),
-											 llvmContext.i64Type),
-					emitLiteral(llvmContext, ~((U64(1) << 31) - 1))),
-				llvmContext.i8PtrType);
+			// Load the compartment runtime data address from the context runtime data.
+			llvm::Value* offset = emitLiteral(
+				llvmContext, U64(offsetof(Runtime::ContextRuntimeData, compartmentRuntimeData)));
+			return loadFromUntypedPointer(
+				irBuilder.CreateInBoundsGEP(irBuilder.CreateLoad(contextPointerVariable), {offset}),
+				llvmContext.i8PtrType,
+				sizeof(U8*));
 		}
 
 		void reloadMemoryBases()
@@ -155,6 +154,7 @@ namespace WAVM { namespace LLVMJIT {
 										 const std::initializer_list<llvm::Value*>& args)
 		{
 			WAVM_ASSERT(intrinsicType.callingConvention() == IR::CallingConvention::intrinsic);
+			const Intrinsics::FunctionFlags flags = getIntrinsicFunctionFlags(intrinsicName);
 
 			llvm::Module* llvmModule = irBuilder.GetInsertBlock()->getParent()->getParent();
 			llvm::Function* intrinsicFunction = llvmModule->getFunction(intrinsicName);
@@ -166,10 +166,15 @@ namespace WAVM { namespace LLVMJIT {
 														   llvmModule);
 				intrinsicFunction->setCallingConv(
 					asLLVMCallingConv(intrinsicType.callingConvention()));
+				if(hasFlags(flags, Intrinsics::FunctionFlags::noThrow))
+				{ intrinsicFunction->setDoesNotThrow(); }
 			}
 
-			return emitCallOrInvoke(
-				intrinsicFunction, args, intrinsicType, getInnermostUnwindToBlock());
+			// Calls to intrinsics that can't throw don't need to be invokes, even inside a try.
+			llvm::BasicBlock* unwindToBlock = hasFlags(flags, Intrinsics::FunctionFlags::noThrow)
+												  ? nullptr
+												  : getInnermostUnwindToBlock();
+			return emitCallOrInvoke(intrinsicFunction, args, intrinsicType, unwindToBlock);
 		}
 
 		// Creates either a call or an invoke if the call occurs inside a try.
@@ -428,6 +428,37 @@ EMIT_UNARY_OP(i32x4_trunc_sat_f64x2_u_zero,
 				  I32(0),
 				  irBuilder.CreateBitCast(operand, llvmContext.f64x2Type))))
 
+// x86 cvttps2dq and cvttpd2dq convert NaN and out-of-range lanes to INT32_MIN, which is allowed for
+// the relaxed truncations. There is no unsigned equivalent, so the unsigned truncations and other
+// targets use the saturating truncation.
+void EmitFunctionContext::i32x4_relaxed_trunc_f32x4_s(NoImm imm)
+{
+	if(moduleContext.targetArch != llvm::Triple::x86_64
+	   && moduleContext.targetArch != llvm::Triple::x86)
+	{ i32x4_trunc_sat_f32x4_s(imm); }
+	else
+	{
+		auto operand = irBuilder.CreateBitCast(pop(), llvmContext.f32x4Type);
+		push(callLLVMIntrinsic({}, llvm::Intrinsic::x86_sse2_cvttps2dq, {operand}));
+	}
+}
+void EmitFunctionContext::i32x4_relaxed_trunc_f32x4_u(NoImm imm) { i32x4_trunc_sat_f32x4_u(imm); }
+void EmitFunctionContext::i32x4_relaxed_trunc_f64x2_s_zero(NoImm imm)
+{
+	if(moduleContext.targetArch != llvm::Triple::x86_64
+	   && moduleContext.targetArch != llvm::Triple::x86)
+	{ i32x4_trunc_sat_f64x2_s_zero(imm); }
+	else
+	{
+		auto operand = irBuilder.CreateBitCast(pop(), llvmContext.f64x2Type);
+		push(callLLVMIntrinsic({}, llvm::Intrinsic::x86_sse2_cvttpd2dq, {operand}));
+	}
+}
+void EmitFunctionContext::i32x4_relaxed_trunc_f64x2_u_zero(NoImm imm)
+{
+	i32x4_trunc_sat_f64x2_u_zero(imm);
+}
+
 EMIT_UNARY_OP(i32_extend8_s, sext(trunc(operand, llvmContext.i8Type), llvmContext.i32Type))
 EMIT_UNARY_OP(i32_extend16_s, sext(trunc(operand, llvmContext.i16Type), llvmContext.i32Type))
 EMIT_UNARY_OP(i64_extend8_s, sext(trunc(operand, llvmContext.i8Type), llvmContext.i64Type))
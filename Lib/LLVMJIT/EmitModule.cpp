@@ -127,6 +127,8 @@ void LLVMJIT::emitModule(const IR::Module& irModule,
 						 llvm::TargetMachine* targetMachine)
 {
 	Timing::Timer emitTimer;
+	static Metrics::Histogram& emitDurationHistogram = getCompilePhaseDurationHistogram("emit_ir");
+	Metrics::Timer emitMetricsTimer(emitDurationHistogram);
 	EmitModuleContext moduleContext(irModule, llvmContext, &outLLVMModule, targetMachine);
 
 	// Set the module data layout for the target machine.
@@ -201,6 +203,10 @@ void LLVMJIT::emitModule(const IR::Module& irModule,
 	moduleContext.tableReferenceBias = llvm::ConstantExpr::getPtrToInt(
 		createImportedConstant(outLLVMModule, "tableReferenceBias"), moduleContext.iptrType);
 
+	// Create a LLVM external global that will be the biased value that represents null in a table.
+	moduleContext.biasedNullTableElement = llvm::ConstantExpr::getPtrToInt(
+		createImportedConstant(outLLVMModule, "biasedNullTableElement"), moduleContext.iptrType);
+
 #if LLVM_VERSION_MAJOR < 10
 	// Create a LLVM external global that will be a constant Iptr 1 that is opaque to the optimizer.
 	moduleContext.unoptimizableOne = llvm::ConstantExpr::getPtrToInt(
@@ -35,6 +35,7 @@ namespace WAVM { namespace LLVMJIT {
 
 		llvm::Constant* instanceId;
 		llvm::Constant* tableReferenceBias;
+		llvm::Constant* biasedNullTableElement;
 
 #if LLVM_VERSION_MAJOR < 10
 		llvm::Constant* unoptimizableOne;
@@ -1079,3 +1079,174 @@ void EmitFunctionContext::i16x8_q15mulr_sat_s(NoImm)
 	llvm::Value* result = irBuilder.CreateTrunc(saturate, llvmContext.i16x8Type);
 	push(result);
 }
+
+//
+// Relaxed SIMD: these operators allow implementation-defined results for some inputs, so on x86
+// they are lowered to the native instruction instead of the sequences needed to implement the
+// strict semantics of the corresponding SIMD operators. Other targets use the strict lowering,
+// which always produces one of the allowed results.
+//
+
+static bool isX86(const EmitModuleContext& moduleContext)
+{
+	return moduleContext.targetArch == llvm::Triple::x86_64
+		   || moduleContext.targetArch == llvm::Triple::x86;
+}
+
+void EmitFunctionContext::i8x16_relaxed_swizzle(NoImm imm)
+{
+	if(!isX86(moduleContext)) { i8x16_swizzle(imm); }
+	else
+	{
+		// pshufb uses an index >= 16 modulo 16 unless its MSB is set, which is allowed for relaxed
+		// swizzle.
+		auto indexVector = irBuilder.CreateBitCast(pop(), llvmContext.i8x16Type);
+		auto elementVector = irBuilder.CreateBitCast(pop(), llvmContext.i8x16Type);
+		push(callLLVMIntrinsic(
+			{}, llvm::Intrinsic::x86_ssse3_pshuf_b_128, {elementVector, indexVector}));
+	}
+}
+
+// llvm.fmuladd is fused when the target has FMA instructions, and otherwise is a multiply
+// followed by an add: relaxed madd allows either.
+#define EMIT_SIMD_RELAXED_MADD(name, llvmType, negateProduct)                                      \
+	void EmitFunctionContext::name(NoImm)                                                          \
+	{                                                                                              \
+		auto addend = irBuilder.CreateBitCast(pop(), llvmType);                                    \
+		auto right = irBuilder.CreateBitCast(pop(), llvmType);                                     \
+		auto left = irBuilder.CreateBitCast(pop(), llvmType);                                      \
+		if(negateProduct) { left = irBuilder.CreateFNeg(left); }                                   \
+		push(callLLVMIntrinsic({llvmType}, llvm::Intrinsic::fmuladd, {left, right, addend}));      \
+	}
+EMIT_SIMD_RELAXED_MADD(f32x4_relaxed_madd, llvmContext.f32x4Type, false)
+EMIT_SIMD_RELAXED_MADD(f32x4_relaxed_nmadd, llvmContext.f32x4Type, true)
+EMIT_SIMD_RELAXED_MADD(f64x2_relaxed_madd, llvmContext.f64x2Type, false)
+EMIT_SIMD_RELAXED_MADD(f64x2_relaxed_nmadd, llvmContext.f64x2Type, true)
+
+// x86 blendv selects each lane using the MSB of the mask lane, which is allowed for relaxed
+// laneselect.
+#define EMIT_SIMD_RELAXED_LANESELECT(name, x86BlendType, x86BlendIntrinsicId)                      \
+	void EmitFunctionContext::name(NoImm imm)                                                      \
+	{                                                                                              \
+		if(!isX86(moduleContext)) { v128_bitselect(imm); }                                         \
+		else                                                                                       \
+		{                                                                                          \
+			auto mask = irBuilder.CreateBitCast(pop(), x86BlendType);                              \
+			auto falseValue = irBuilder.CreateBitCast(pop(), x86BlendType);                        \
+			auto trueValue = irBuilder.CreateBitCast(pop(), x86BlendType);                         \
+			push(callLLVMIntrinsic({}, x86BlendIntrinsicId, {falseValue, trueValue, mask}));       \
+		}                                                                                          \
+	}
+EMIT_SIMD_RELAXED_LANESELECT(i8x16_relaxed_laneselect,
+							 llvmContext.i8x16Type,
+							 llvm::Intrinsic::x86_sse41_pblendvb)
+EMIT_SIMD_RELAXED_LANESELECT(i32x4_relaxed_laneselect,
+							 llvmContext.f32x4Type,
+							 llvm::Intrinsic::x86_sse41_blendvps)
+EMIT_SIMD_RELAXED_LANESELECT(i64x2_relaxed_laneselect,
+							 llvmContext.f64x2Type,
+							 llvm::Intrinsic::x86_sse41_blendvpd)
+
+// There is no 16-bit blendv, and pblendvb would select the bytes of a 16-bit lane independently.
+void EmitFunctionContext::i16x8_relaxed_laneselect(NoImm imm) { v128_bitselect(imm); }
+
+// x86 min and max return the second operand if either operand is NaN, or if both operands are
+// zero, which is allowed for relaxed min and max.
+#define EMIT_SIMD_RELAXED_MIN_MAX(type, minOrMax, x86IntrinsicId)                                  \
+	void EmitFunctionContext::type##_relaxed_##minOrMax(NoImm imm)                                 \
+	{                                                                                              \
+		if(!isX86(moduleContext)) { type##_##minOrMax(imm); }                                      \
+		else                                                                                       \
+		{                                                                                          \
+			auto right = irBuilder.CreateBitCast(pop(), llvmContext.type##Type);                   \
+			auto left = irBuilder.CreateBitCast(pop(), llvmContext.type##Type);                    \
+			push(callLLVMIntrinsic({}, x86IntrinsicId, {left, right}));                            \
+		}                                                                                          \
+	}
+EMIT_SIMD_RELAXED_MIN_MAX(f32x4, min, llvm::Intrinsic::x86_sse_min_ps)
+EMIT_SIMD_RELAXED_MIN_MAX(f32x4, max, llvm::Intrinsic::x86_sse_max_ps)
+EMIT_SIMD_RELAXED_MIN_MAX(f64x2, min, llvm::Intrinsic::x86_sse2_min_pd)
+EMIT_SIMD_RELAXED_MIN_MAX(f64x2, max, llvm::Intrinsic::x86_sse2_max_pd)
+
+void EmitFunctionContext::i16x8_relaxed_q15mulr_s(NoImm imm)
+{
+	if(!isX86(moduleContext)) { i16x8_q15mulr_sat_s(imm); }
+	else
+	{
+		// pmulhrsw wraps instead of saturating for -0x8000 * -0x8000, which is allowed for relaxed
+		// q15mulr.
+		auto right = irBuilder.CreateBitCast(pop(), llvmContext.i16x8Type);
+		auto left = irBuilder.CreateBitCast(pop(), llvmContext.i16x8Type);
+		push(callLLVMIntrinsic({}, llvm::Intrinsic::x86_ssse3_pmul_hr_sw_128, {left, right}));
+	}
+}
+
+// Sums each group of numElementsPerSum consecutive elements of a vector.
+static llvm::Value* emitHorizontalSums(llvm::IRBuilder<>& irBuilder,
+									   llvm::Value* vector,
+									   U32 numElements,
+									   U32 numElementsPerSum)
+{
+	const U32 numSums = numElements / numElementsPerSum;
+	llvm::Constant* undefVector = llvm::UndefValue::get(vector->getType());
+	llvm::Value* result = nullptr;
+	for(U32 sumElementIndex = 0; sumElementIndex < numElementsPerSum; ++sumElementIndex)
+	{
+		LLVM_LANE_INDEX_TYPE mask[16];
+		for(U32 sumIndex = 0; sumIndex < numSums; ++sumIndex)
+		{ mask[sumIndex] = LLVM_LANE_INDEX_TYPE(sumIndex * numElementsPerSum + sumElementIndex); }
+		llvm::Value* elements = irBuilder.CreateShuffleVector(
+			vector, undefVector, llvm::ArrayRef<LLVM_LANE_INDEX_TYPE>(mask, numSums));
+		result = result ? irBuilder.CreateAdd(result, elements) : elements;
+	}
+	return result;
+}
+
+// x86 pmaddubsw multiplies unsigned bytes by signed bytes, and adds adjacent pairs of products
+// with signed saturation. The relaxed dot product operators allow either signed or unsigned
+// interpretation of the 7-bit operand, and saturation of the intermediate 16-bit sums.
+
+void EmitFunctionContext::i16x8_relaxed_dot_i8x16_i7x16_s(NoImm)
+{
+	auto right = irBuilder.CreateBitCast(pop(), llvmContext.i8x16Type);
+	auto left = irBuilder.CreateBitCast(pop(), llvmContext.i8x16Type);
+	if(isX86(moduleContext))
+	{
+		push(callLLVMIntrinsic({}, llvm::Intrinsic::x86_ssse3_pmadd_ub_sw_128, {right, left}));
+	}
+	else
+	{
+		llvm::Value* product
+			= irBuilder.CreateMul(irBuilder.CreateSExt(left, llvmContext.i16x16Type),
+								  irBuilder.CreateSExt(right, llvmContext.i16x16Type));
+		push(emitHorizontalSums(irBuilder, product, 16, 2));
+	}
+}
+
+void EmitFunctionContext::i32x4_relaxed_dot_i8x16_i7x16_add_s(NoImm)
+{
+	auto addend = irBuilder.CreateBitCast(pop(), llvmContext.i32x4Type);
+	auto right = irBuilder.CreateBitCast(pop(), llvmContext.i8x16Type);
+	auto left = irBuilder.CreateBitCast(pop(), llvmContext.i8x16Type);
+	llvm::Value* sums;
+	if(isX86(moduleContext))
+	{
+		// Use pmaddwd to multiply the 16-bit sums by 1, and add adjacent pairs of them.
+		llvm::Value* i16Sums
+			= callLLVMIntrinsic({}, llvm::Intrinsic::x86_ssse3_pmadd_ub_sw_128, {right, left});
+		sums = callLLVMIntrinsic(
+			{},
+			llvm::Intrinsic::x86_sse2_pmadd_wd,
+			{i16Sums,
+			 llvm::ConstantVector::getSplat(LLVM_ELEMENT_COUNT(8),
+											llvm::ConstantInt::get(llvmContext.i16Type, 1))});
+	}
+	else
+	{
+		llvm::Value* product
+			= irBuilder.CreateMul(irBuilder.CreateSExt(left, llvmContext.i32x16Type),
+								  irBuilder.CreateSExt(right, llvmContext.i32x16Type));
+		sums = emitHorizontalSums(irBuilder, product, 16, 4);
+	}
+	push(irBuilder.CreateAdd(sums, addend));
+}
@@ -19,6 +19,7 @@ PUSH_DISABLE_WARNINGS_FOR_LLVM_HEADERS
 #include <llvm/IR/Value.h>
 POP_DISABLE_WARNINGS_FOR_LLVM_HEADERS
 
+using namespace WAVM;
 using namespace WAVM::IR;
 using namespace WAVM::LLVMJIT;
 
@@ -45,32 +46,100 @@ void EmitFunctionContext::ref_func(FunctionRefImm imm)
 	push(externref);
 }
 
-void EmitFunctionContext::table_get(TableImm imm)
+// Computes a pointer to a table element that is guaranteed to be within the virtual address space
+// reserved for the table: out-of-bounds indices are clamped to TableRuntimeData::endIndex, which
+// maps them to the guard element at the end of the table.
+static llvm::Value* getTableElementPointer(EmitFunctionContext& functionContext,
+										   Uptr tableIndex,
+										   llvm::Value* elementIndex)
+{
+	llvm::IRBuilder<>& irBuilder = functionContext.irBuilder;
+	EmitModuleContext& moduleContext = functionContext.moduleContext;
+
+	// Load base and endIndex from the TableRuntimeData in CompartmentRuntimeData::tables
+	// corresponding to tableIndex.
+	auto tableRuntimeDataPointer = irBuilder.CreateInBoundsGEP(
+		functionContext.getCompartmentAddress(), {moduleContext.tableOffsets[tableIndex]});
+	auto tableBasePointer = functionContext.loadFromUntypedPointer(
+		irBuilder.CreateInBoundsGEP(
+			tableRuntimeDataPointer,
+			{emitLiteralIptr(offsetof(Runtime::TableRuntimeData, base), moduleContext.iptrType)}),
+		moduleContext.iptrType->getPointerTo(),
+		moduleContext.iptrAlignment);
+	auto tableMaxIndex = functionContext.loadFromUntypedPointer(
+		irBuilder.CreateInBoundsGEP(tableRuntimeDataPointer,
+									{emitLiteralIptr(offsetof(Runtime::TableRuntimeData, endIndex),
+													 moduleContext.iptrType)}),
+		moduleContext.iptrType,
+		moduleContext.iptrAlignment);
+
+	auto clampedElementIndex = irBuilder.CreateSelect(
+		irBuilder.CreateICmpULT(elementIndex, tableMaxIndex), elementIndex, tableMaxIndex);
+	return irBuilder.CreateInBoundsGEP(tableBasePointer, {clampedElementIndex});
+}
+
+// Emits a trap if a biased table element value is zero, which means that the element is outside
+// the table's current bounds (either the guard element, or a committed element past the end).
+static void emitTableBoundsTrap(EmitFunctionContext& functionContext,
+								Uptr tableIndex,
+								llvm::Value* elementIndex,
+								llvm::Value* biasedValue)
 {
-	llvm::Value* index = pop();
-	llvm::Value* result = emitRuntimeIntrinsic(
-		"table.get",
-		FunctionType({ValueType::externref},
+	EmitModuleContext& moduleContext = functionContext.moduleContext;
+	functionContext.emitConditionalTrapIntrinsic(
+		functionContext.irBuilder.CreateICmpEQ(biasedValue,
+											   emitLiteralIptr(0, moduleContext.iptrType)),
+		"outOfBoundsTableAccess",
+		FunctionType(TypeTuple(),
 					 TypeTuple({moduleContext.iptrValueType, moduleContext.iptrValueType}),
 					 IR::CallingConvention::intrinsic),
-		{zext(index, moduleContext.iptrType),
-		 getTableIdFromOffset(moduleContext.tableOffsets[imm.tableIndex])})[0];
-	push(result);
+		{elementIndex, getTableIdFromOffset(moduleContext.tableOffsets[tableIndex])});
+}
+
+void EmitFunctionContext::table_get(TableImm imm)
+{
+	llvm::Value* index = zext(pop(), moduleContext.iptrType);
+
+	// Load the biased element value, and trap if it's the out-of-bounds sentinel.
+	llvm::LoadInst* biasedValueLoad
+		= irBuilder.CreateLoad(getTableElementPointer(*this, imm.tableIndex, index));
+	biasedValueLoad->setAtomic(llvm::AtomicOrdering::Acquire);
+	biasedValueLoad->setAlignment(LLVM_ALIGNMENT(sizeof(Uptr)));
+	emitTableBoundsTrap(*this, imm.tableIndex, index, biasedValueLoad);
+
+	// Unbias the element value, and translate the uninitialized sentinel to null.
+	llvm::Value* reference = irBuilder.CreateIntToPtr(
+		irBuilder.CreateAdd(biasedValueLoad, moduleContext.tableReferenceBias),
+		llvmContext.externrefType);
+	push(irBuilder.CreateSelect(
+		irBuilder.CreateICmpEQ(biasedValueLoad, moduleContext.biasedNullTableElement),
+		llvm::Constant::getNullValue(llvmContext.externrefType),
+		reference));
 }
 
 void EmitFunctionContext::table_set(TableImm imm)
 {
 	llvm::Value* value = pop();
-	llvm::Value* index = pop();
-	emitRuntimeIntrinsic("table.set",
-						 FunctionType({},
-									  TypeTuple({moduleContext.iptrValueType,
-												 ValueType::externref,
-												 moduleContext.iptrValueType}),
-									  IR::CallingConvention::intrinsic),
-						 {zext(index, moduleContext.iptrType),
-						  value,
-						  getTableIdFromOffset(moduleContext.tableOffsets[imm.tableIndex])});
+	llvm::Value* index = zext(pop(), moduleContext.iptrType);
+
+	// Load the element's current biased value, and trap if it's the out-of-bounds sentinel. Tables
+	// never shrink, so an element that is in bounds when loaded will still be in bounds when it is
+	// written, and the write doesn't need to be a compare-and-swap against the loaded value.
+	llvm::Value* elementPointer = getTableElementPointer(*this, imm.tableIndex, index);
+	llvm::LoadInst* oldBiasedValueLoad = irBuilder.CreateLoad(elementPointer);
+	oldBiasedValueLoad->setAtomic(llvm::AtomicOrdering::Acquire);
+	oldBiasedValueLoad->setAlignment(LLVM_ALIGNMENT(sizeof(Uptr)));
+	emitTableBoundsTrap(*this, imm.tableIndex, index, oldBiasedValueLoad);
+
+	// Bias the new value, translating null to the uninitialized sentinel, and store it.
+	llvm::Value* biasedValue = irBuilder.CreateSelect(
+		irBuilder.CreateICmpEQ(value, llvm::Constant::getNullValue(llvmContext.externrefType)),
+		moduleContext.biasedNullTableElement,
+		irBuilder.CreateSub(irBuilder.CreatePtrToInt(value, moduleContext.iptrType),
+							moduleContext.tableReferenceBias));
+	llvm::StoreInst* biasedValueStore = irBuilder.CreateStore(biasedValue, elementPointer);
+	biasedValueStore->setAtomic(llvm::AtomicOrdering::Release);
+	biasedValueStore->setAlignment(LLVM_ALIGNMENT(sizeof(Uptr)));
 }
 
 void EmitFunctionContext::table_init(ElemSegmentAndTableImm imm)
@@ -165,13 +234,18 @@ void EmitFunctionContext::table_grow(TableImm imm)
 }
 void EmitFunctionContext::table_size(TableImm imm)
 {
-	ValueVector currentNumElements
-		= emitRuntimeIntrinsic("table.size",
-							   FunctionType(TypeTuple(moduleContext.iptrValueType),
-											TypeTuple(moduleContext.iptrValueType),
-											IR::CallingConvention::intrinsic),
-							   {getTableIdFromOffset(moduleContext.tableOffsets[imm.tableIndex])});
-	WAVM_ASSERT(currentNumElements.size() == 1);
+	// Load the number of table elements from the compartment runtime data.
+	llvm::LoadInst* numElementsLoad = loadFromUntypedPointer(
+		irBuilder.CreateInBoundsGEP(
+			getCompartmentAddress(),
+			{llvm::ConstantExpr::getAdd(
+				moduleContext.tableOffsets[imm.tableIndex],
+				emitLiteralIptr(offsetof(Runtime::TableRuntimeData, numElements),
+								moduleContext.iptrType))}),
+		moduleContext.iptrType,
+		moduleContext.iptrAlignment);
+	numElementsLoad->setAtomic(llvm::AtomicOrdering::Acquire);
+
 	const TableType& tableType = moduleContext.irModule.tables.getType(imm.tableIndex);
-	push(coerceIptrToIndex(tableType.indexType, currentNumElements[0]));
+	push(coerceIptrToIndex(tableType.indexType, numElementsLoad));
 }
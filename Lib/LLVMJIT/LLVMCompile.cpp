@@ -88,6 +88,9 @@ static void optimizeLLVMModule(llvm::Module& llvmModule, bool shouldLogMetrics)
 {
 	// Run some optimization on the module's functions.
 	Timing::Timer optimizationTimer;
+	static Metrics::Histogram& optimizeDurationHistogram
+		= getCompilePhaseDurationHistogram("optimize");
+	Metrics::Timer optimizeMetricsTimer(optimizeDurationHistogram);
 
 	llvm::legacy::FunctionPassManager fpm(&llvmModule);
 	fpm.add(llvm::createPromoteMemoryToRegisterPass());
@@ -143,6 +146,10 @@ std::vector<U8> LLVMJIT::compileLLVMModule(LLVMContext& llvmContext,
 	Timing::Timer machineCodeTimer;
 	std::vector<U8> objectBytes;
 	{
+		static Metrics::Histogram& codegenDurationHistogram
+			= getCompilePhaseDurationHistogram("codegen");
+		Metrics::Timer codegenMetricsTimer(codegenDurationHistogram);
+
 		llvm::legacy::PassManager passManager;
 		llvm::MCContext* mcContext;
 		LLVMArrayOutputStream objectStream;
@@ -159,6 +166,15 @@ std::vector<U8> LLVMJIT::compileLLVMModule(LLVMContext& llvmContext,
 	return objectBytes;
 }
 
+Metrics::Histogram& LLVMJIT::getCompilePhaseDurationHistogram(const char* phase)
+{
+	return Metrics::getHistogram("wavm_compile_phase_duration_seconds",
+								 "Time spent in each phase of compiling and loading modules.",
+								 Metrics::Unit::nanoseconds,
+								 "phase",
+								 phase);
+}
+
 static std::unique_ptr<llvm::TargetMachine> getAndValidateTargetMachine(
 	const IR::FeatureSpec& featureSpec,
 	const TargetSpec& targetSpec)
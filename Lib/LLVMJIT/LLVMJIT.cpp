@@ -1,4 +1,5 @@
 #include "WAVM/LLVMJIT/LLVMJIT.h"
+#include <string.h>
 #include <utility>
 #include "LLVMJITPrivate.h"
 #include "WAVM/IR/FeatureSpec.h"
@@ -70,7 +71,7 @@ namespace LLVMRuntimeSymbols {
 llvm::JITEvaluatedSymbol LLVMJIT::resolveJITImport(llvm::StringRef name)
 {
 	// Allow some intrinsics used by LLVM
-	void** symbolValue = LLVMRuntimeSymbols::map.get(name.str());
+	void** symbolValue = LLVMRuntimeSymbols::map.get(StringView(name.data(), name.size()));
 	if(!symbolValue)
 	{
 		Errors::fatalf("LLVM generated code references unknown external symbol: %s",
@@ -228,6 +229,24 @@ TargetValidationResult LLVMJIT::validateTarget(const TargetSpec& targetSpec,
 	return validateTargetMachine(targetMachine, featureSpec);
 }
 
+Intrinsics::FunctionFlags LLVMJIT::getIntrinsicFunctionFlags(const char* name)
+{
+	// The intrinsics that are called without an unwind edge.
+	static const char* const noThrowIntrinsicNames[] = {"createException",
+														"destroyException",
+														"memory.grow",
+														"data.drop",
+														"table.grow",
+														"elem.drop",
+														"debugEnterFunction",
+														"debugExitFunction"};
+	for(const char* noThrowIntrinsicName : noThrowIntrinsicNames)
+	{
+		if(!strcmp(name, noThrowIntrinsicName)) { return Intrinsics::FunctionFlags::noThrow; }
+	}
+	return Intrinsics::FunctionFlags::none;
+}
+
 Version LLVMJIT::getVersion()
 {
 	return Version{LLVM_VERSION_MAJOR, LLVM_VERSION_MINOR, LLVM_VERSION_PATCH, 5};
@@ -2,11 +2,14 @@
 
 #include <cctype>
 #include <string>
+#include <utility>
 #include <vector>
 #include "WAVM/IR/Module.h"
 #include "WAVM/IR/Operators.h"
 #include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/InstructionOffsetTable.h"
 #include "WAVM/LLVMJIT/LLVMJIT.h"
+#include "WAVM/Metrics/Metrics.h"
 #include "WAVM/Platform/Mutex.h"
 #include "WAVM/RuntimeABI/RuntimeABI.h"
 
@@ -388,6 +391,11 @@ namespace WAVM { namespace LLVMJIT {
 		std::map<Uptr, Runtime::Function*> addressToFunctionMap;
 		std::string debugName;
 
+		// Maps code offsets relative to imageBaseAddress to WebAssembly operator indices. If the
+		// DWARF line info is parsed lazily, this is decoded from dwarfContext by the first call to
+		// getInstructionSourceByAddress, and dwarfContext is freed.
+		Uptr imageBaseAddress;
+		InstructionOffsetTable instructionOffsets;
 #if LAZY_PARSE_DWARF_LINE_INFO
 		Platform::Mutex dwarfContextMutex;
 		std::unique_ptr<llvm::DWARFContext> dwarfContext;
@@ -424,6 +432,24 @@ namespace WAVM { namespace LLVMJIT {
 											 bool shouldLogMetrics,
 											 llvm::TargetMachine* targetMachine);
 
+	// Returns the histogram of the time spent in a phase of compiling and loading modules.
+	extern Metrics::Histogram& getCompilePhaseDurationHistogram(const char* phase);
+
+	// A loaded function to describe to the Linux perf profiler.
+	struct PerfMapFunction
+	{
+		Uptr address;
+		Uptr numBytes;
+		std::string name;
+
+		// Maps addresses in the function's code to WebAssembly operator indices. Only needed for
+		// PerfMapMode::jitdump.
+		std::vector<std::pair<Uptr, U32>> opIndices;
+	};
+
+	PerfMapMode getPerfMapMode();
+	void addPerfMapFunctions(const std::vector<PerfMapFunction>& functions);
+
 	extern void processSEHTables(U8* imageBase,
 								 const llvm::LoadedObjectInfo& loadedObject,
 								 const llvm::object::SectionRef& pdataSection,
@@ -83,6 +83,30 @@ struct LLVMJIT::GlobalModuleState
 	~GlobalModuleState() { delete gdbRegistrationListener; }
 };
 
+// Gets the DWARF line info for a function, which maps its machine code addresses to WebAssembly op
+// indices.
+static llvm::DILineInfoTable getFunctionLineInfo(llvm::DWARFContext& dwarfContext,
+												 Uptr codeAddress,
+												 Uptr numCodeBytes)
+{
+#if LAZY_PARSE_DWARF_LINE_INFO
+	const llvm::DILineInfoSpecifier lineInfoSpecifier(
+#if LLVM_VERSION_MAJOR >= 11
+		llvm::DILineInfoSpecifier::FileLineInfoKind::RawValue,
+#else
+		llvm::DILineInfoSpecifier::FileLineInfoKind::Default,
+#endif
+		llvm::DINameKind::None);
+
+	return dwarfContext.getLineInfoForAddressRange(
+		llvm::object::SectionedAddress{codeAddress, llvm::object::SectionedAddress::UndefSection},
+		numCodeBytes,
+		lineInfoSpecifier);
+#else
+	return dwarfContext.getLineInfoForAddressRange(codeAddress, numCodeBytes);
+#endif
+}
+
 // Allocates memory for the LLVM object loader.
 struct LLVMJIT::ModuleMemoryManager : llvm::RTDyldMemoryManager
 {
@@ -332,6 +356,9 @@ Module::Module(const std::vector<U8>& objectBytes,
 #endif
 {
 	Timing::Timer loadObjectTimer;
+	static Metrics::Histogram& loadObjectDurationHistogram
+		= getCompilePhaseDurationHistogram("load_object");
+	Metrics::Timer loadObjectMetricsTimer(loadObjectDurationHistogram);
 
 #if LLVM_VERSION_MAJOR >= 8
 	std::unique_ptr<llvm::object::ObjectFile> object;
@@ -525,6 +552,8 @@ Module::Module(const std::vector<U8>& objectBytes,
 #endif
 	}
 
+	imageBaseAddress = reinterpret_cast<Uptr>(memoryManager->getImageBaseAddress());
+
 	// Create a DWARF context to interpret the debug information in this compilation unit.
 #if LAZY_PARSE_DWARF_LINE_INFO
 	Platform::Mutex::Lock dwarfContextLock(dwarfContextMutex);
@@ -532,8 +561,13 @@ Module::Module(const std::vector<U8>& objectBytes,
 		= llvm::DWARFContext::create(memoryManager->getSectionNameToContentsMap(), sizeof(Uptr));
 #else
 	auto dwarfContext = llvm::DWARFContext::create(*object, &*loadedObject);
+	std::vector<InstructionOffsetTable::Entry> instructionOffsetEntries;
 #endif
 
+	// If enabled, describe the loaded functions to the Linux perf profiler.
+	const PerfMapMode perfMapMode = getPerfMapMode();
+	std::vector<PerfMapFunction> perfMapFunctions;
+
 	// Iterate over the functions in the loaded object.
 	for(std::pair<llvm::object::SymbolRef, U64> symbolSizePair :
 		llvm::object::computeSymbolSizes(*object))
@@ -563,22 +597,20 @@ Module::Module(const std::vector<U8>& objectBytes,
 		if(llvm::Expected<llvm::object::section_iterator> symbolSection = symbol.getSection())
 		{ loadedAddress += (Uptr)loadedObject->getSectionLoadAddress(*symbolSection.get()); }
 
-		std::map<U32, U32> offsetToOpIndexMap;
-#if !LAZY_PARSE_DWARF_LINE_INFO
 		// Get the DWARF line info for this symbol, which maps machine code addresses to
 		// WebAssembly op indices.
-#if LLVM_VERSION_MAJOR >= 9
-		llvm::Expected<llvm::object::section_iterator> section = symbol.getSection();
-		if(!section) { continue; }
-		llvm::DILineInfoTable lineInfoTable = dwarfContext->getLineInfoForAddressRange(
-			llvm::object::SectionedAddress{loadedAddress, section.get()->getIndex()},
-			symbolSizePair.second);
-#else
-		llvm::DILineInfoTable lineInfoTable
-			= dwarfContext->getLineInfoForAddressRange(loadedAddress, symbolSizePair.second);
-#endif
+		llvm::DILineInfoTable lineInfoTable;
+		if(!LAZY_PARSE_DWARF_LINE_INFO || perfMapMode == PerfMapMode::jitdump)
+		{
+			lineInfoTable
+				= getFunctionLineInfo(*dwarfContext, loadedAddress, Uptr(symbolSizePair.second));
+		}
+#if !LAZY_PARSE_DWARF_LINE_INFO
 		for(auto lineInfo : lineInfoTable)
-		{ offsetToOpIndexMap.emplace(U32(lineInfo.first - loadedAddress), lineInfo.second.Line); }
+		{
+			instructionOffsetEntries.emplace_back(U32(lineInfo.first - imageBaseAddress),
+												  U32(lineInfo.second.Line));
+		}
 #endif
 
 		// Add the function to the module's name and address to function maps.
@@ -593,9 +625,31 @@ Module::Module(const std::vector<U8>& objectBytes,
 		function->mutableData->jitModule = this;
 		function->mutableData->function = function;
 		function->mutableData->numCodeBytes = Uptr(symbolSizePair.second);
-		function->mutableData->offsetToOpIndexMap = std::move(offsetToOpIndexMap);
+
+		if(perfMapMode != PerfMapMode::none)
+		{
+			PerfMapFunction perfMapFunction;
+			perfMapFunction.address = loadedAddress;
+			perfMapFunction.numBytes = Uptr(symbolSizePair.second);
+			perfMapFunction.name = function->mutableData->debugName;
+			if(perfMapMode == PerfMapMode::jitdump)
+			{
+				for(auto lineInfo : lineInfoTable)
+				{
+					perfMapFunction.opIndices.emplace_back(Uptr(lineInfo.first),
+														   U32(lineInfo.second.Line));
+				}
+			}
+			perfMapFunctions.push_back(std::move(perfMapFunction));
+		}
 	}
 
+	if(perfMapFunctions.size()) { addPerfMapFunctions(perfMapFunctions); }
+
+#if !LAZY_PARSE_DWARF_LINE_INFO
+	instructionOffsets = InstructionOffsetTable(std::move(instructionOffsetEntries));
+#endif
+
 	const Uptr moduleEndAddress = reinterpret_cast<Uptr>(memoryManager->getImageBaseAddress()
 														 + memoryManager->getNumImageBytes());
 	{
@@ -649,15 +703,16 @@ Module::~Module()
 
 std::shared_ptr<LLVMJIT::Module> LLVMJIT::loadModule(
 	const std::vector<U8>& objectFileBytes,
-	HashMap<std::string, FunctionBinding>&& wavmIntrinsicsExportMap,
-	std::vector<IR::FunctionType>&& types,
-	std::vector<FunctionBinding>&& functionImports,
+	const HashMap<std::string, FunctionBinding>& wavmIntrinsicsExportMap,
+	const std::vector<IR::FunctionType>& types,
+	const std::vector<FunctionBinding>& functionImports,
 	std::vector<TableBinding>&& tables,
 	std::vector<MemoryBinding>&& memories,
 	std::vector<GlobalBinding>&& globals,
 	std::vector<ExceptionTypeBinding>&& exceptionTypes,
 	InstanceBinding instance,
 	Uptr tableReferenceBias,
+	Uptr biasedNullTableElement,
 	const std::vector<Runtime::FunctionMutableData*>& functionDefMutableDatas,
 	std::string&& debugName)
 {
@@ -666,7 +721,7 @@ std::shared_ptr<LLVMJIT::Module> LLVMJIT::loadModule(
 
 	// Bind the wavmIntrinsic function symbols; the compiled module assumes they have the intrinsic
 	// calling convention, so no thunking is necessary.
-	for(auto exportMapPair : wavmIntrinsicsExportMap)
+	for(const auto& exportMapPair : wavmIntrinsicsExportMap)
 	{
 		importedSymbolMap.addOrFail(exportMapPair.key,
 									reinterpret_cast<Uptr>(exportMapPair.value.code));
@@ -752,6 +807,9 @@ std::shared_ptr<LLVMJIT::Module> LLVMJIT::loadModule(
 	// Bind the tableReferenceBias symbol to the tableReferenceBias.
 	importedSymbolMap.addOrFail("tableReferenceBias", tableReferenceBias);
 
+	// Bind the biasedNullTableElement symbol to the biased value that represents null in a table.
+	importedSymbolMap.addOrFail("biasedNullTableElement", biasedNullTableElement);
+
 #if LLVM_VERSION_MAJOR < 10
 	// Bind the unoptimizableOne symbol to 1.
 	importedSymbolMap.addOrFail("unoptimizableOne", 1);
@@ -779,6 +837,42 @@ std::shared_ptr<LLVMJIT::Module> LLVMJIT::loadModule(
 	return std::make_shared<Module>(objectFileBytes, importedSymbolMap, true, std::move(debugName));
 }
 
+#if LAZY_PARSE_DWARF_LINE_INFO
+// Decodes the DWARF line info for all functions in a module into its instruction offset table, and
+// frees the DWARF context. The caller must hold the module's dwarfContextMutex.
+static void decodeInstructionOffsets(LLVMJIT::Module& jitModule)
+{
+	WAVM_ASSERT(jitModule.dwarfContext);
+	Timing::Timer decodeTimer;
+
+	std::vector<InstructionOffsetTable::Entry> entries;
+	for(const auto& addressFunctionPair : jitModule.addressToFunctionMap)
+	{
+		const Runtime::Function* function = addressFunctionPair.second;
+		llvm::DILineInfoTable lineInfoTable
+			= getFunctionLineInfo(*jitModule.dwarfContext,
+								  reinterpret_cast<Uptr>(function->code),
+								  function->mutableData->numCodeBytes);
+		for(auto lineInfo : lineInfoTable)
+		{
+			entries.emplace_back(U32(lineInfo.first - jitModule.imageBaseAddress),
+								 U32(lineInfo.second.Line));
+		}
+	}
+
+	jitModule.instructionOffsets = InstructionOffsetTable(std::move(entries));
+	jitModule.dwarfContext.reset();
+
+	Timing::logTimer(
+		(std::string("Decoded instruction offsets for ") + jitModule.debugName).c_str(),
+		decodeTimer);
+	Log::printf(Log::Category::metrics,
+				"Instruction offsets: %" WAVM_PRIuPTR " entries, %.1f KiB\n",
+				jitModule.instructionOffsets.getNumEntries(),
+				jitModule.instructionOffsets.getNumBytes() / 1024.0);
+}
+#endif
+
 bool LLVMJIT::getInstructionSourceByAddress(Uptr address, InstructionSource& outSource)
 {
 	Module* jitModule;
@@ -800,33 +894,21 @@ bool LLVMJIT::getInstructionSourceByAddress(Uptr address, InstructionSource& out
 	{ return false; }
 
 #if LAZY_PARSE_DWARF_LINE_INFO
+	// Decode the module's instruction offsets the first time they are needed.
 	Platform::Mutex::Lock dwarfContextLock(jitModule->dwarfContextMutex);
-	llvm::DILineInfo lineInfo = jitModule->dwarfContext->getLineInfoForAddress(
-		llvm::object::SectionedAddress{address, llvm::object::SectionedAddress::UndefSection},
-		llvm::DILineInfoSpecifier(
-#if LLVM_VERSION_MAJOR >= 11
-			llvm::DILineInfoSpecifier::FileLineInfoKind::RawValue,
-#else
-			llvm::DILineInfoSpecifier::FileLineInfoKind::Default,
+	if(jitModule->dwarfContext) { decodeInstructionOffsets(*jitModule); }
+	dwarfContextLock.unlock();
 #endif
-			llvm::DINameKind::None));
 
-	outSource.instructionIndex = Uptr(lineInfo.Line);
-	return true;
-#else
-	// Find the highest entry in the offsetToOpIndexMap whose offset is <= the symbol-relative IP.
-	U32 ipOffset = (U32)(address - codeAddress);
-	Iptr opIndex = -1;
-	for(auto offsetMapIt : outSource.function->mutableData->offsetToOpIndexMap)
+	// Find the highest entry in the instruction offset table whose offset is <= the IP, ignoring
+	// entries that precede the start of the function containing the IP.
+	InstructionOffsetTable::Entry entry;
+	if(jitModule->instructionOffsets.lookup(U32(address - jitModule->imageBaseAddress), entry)
+	   && entry.first >= U32(codeAddress - jitModule->imageBaseAddress))
+	{ outSource.instructionIndex = Uptr(entry.second); }
+	else
 	{
-		if(offsetMapIt.first <= ipOffset) { opIndex = offsetMapIt.second; }
-		else
-		{
-			break;
-		}
+		outSource.instructionIndex = 0;
 	}
-
-	outSource.instructionIndex = opIndex > 0 ? Uptr(opIndex) : 0;
 	return true;
-#endif
 }
@@ -0,0 +1,317 @@
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+#include "LLVMJITPrivate.h"
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/LLVMJIT/LLVMJIT.h"
+#include "WAVM/Logging/Logging.h"
+#include "WAVM/Platform/Clock.h"
+#include "WAVM/Platform/Mutex.h"
+
+#ifdef __linux__
+#include <elf.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace WAVM;
+using namespace WAVM::LLVMJIT;
+
+#ifdef __linux__
+
+// The jitdump format is described in tools/perf/Documentation/jitdump-specification.txt in the
+// Linux kernel source.
+static constexpr U32 jitDumpMagic = 0x4A695444;
+static constexpr U32 jitDumpVersion = 1;
+
+enum class JITDumpRecordType : U32
+{
+	codeLoad = 0,
+	codeDebugInfo = 2,
+	codeClose = 3,
+};
+
+struct JITDumpHeader
+{
+	U32 magic;
+	U32 version;
+	U32 numBytes;
+	U32 elfMachine;
+	U32 pad1;
+	U32 pid;
+	U64 timestamp;
+	U64 flags;
+};
+
+struct JITDumpRecordHeader
+{
+	JITDumpRecordType type;
+	U32 numBytes;
+	U64 timestamp;
+};
+
+// Followed by the function name as a null-terminated string, and the function's code.
+struct JITDumpCodeLoadRecord
+{
+	JITDumpRecordHeader header;
+	U32 pid;
+	U32 tid;
+	U64 virtualAddress;
+	U64 codeAddress;
+	U64 numCodeBytes;
+	U64 codeIndex;
+};
+
+// Followed by numEntries entries, each a JITDumpDebugEntry followed by a null-terminated file
+// name. A file name of "\xff" means the same file name as the previous entry.
+struct JITDumpDebugInfoRecord
+{
+	JITDumpRecordHeader header;
+	U64 codeAddress;
+	U64 numEntries;
+};
+
+struct JITDumpDebugEntry
+{
+	U64 codeAddress;
+	U32 line;
+	U32 discriminator;
+};
+
+static U64 getJITDumpTimestamp()
+{
+	// perf must be told to use the same clock with `perf record -k mono`.
+	return U64(Platform::getClockTime(Platform::Clock::monotonic).ns);
+}
+
+static constexpr U32 getJITDumpELFMachine()
+{
+#if defined(__x86_64__)
+	return EM_X86_64;
+#elif defined(__aarch64__)
+	return EM_AARCH64;
+#else
+	return EM_NONE;
+#endif
+}
+
+struct PerfMapState
+{
+	Platform::Mutex mutex;
+	std::atomic<PerfMapMode> mode{PerfMapMode::none};
+
+	// PerfMapMode::map state.
+	FILE* mapFile = nullptr;
+
+	// PerfMapMode::jitdump state. perf finds the jitdump file by looking for an executable mapping
+	// of it in the recording.
+	FILE* jitDumpFile = nullptr;
+	void* jitDumpMarker = nullptr;
+	Uptr jitDumpMarkerNumBytes = 0;
+	U64 nextCodeIndex = 0;
+
+	// The state is never destroyed, so it's safe to use from other static destructors.
+	static PerfMapState& get()
+	{
+		static PerfMapState* state = new PerfMapState;
+		return *state;
+	}
+};
+
+static void closePerfMap(PerfMapState& state)
+{
+	if(state.mapFile)
+	{
+		fclose(state.mapFile);
+		state.mapFile = nullptr;
+	}
+
+	if(state.jitDumpFile)
+	{
+		JITDumpRecordHeader closeRecord;
+		closeRecord.type = JITDumpRecordType::codeClose;
+		closeRecord.numBytes = sizeof(JITDumpRecordHeader);
+		closeRecord.timestamp = getJITDumpTimestamp();
+		fwrite(&closeRecord, sizeof(closeRecord), 1, state.jitDumpFile);
+
+		munmap(state.jitDumpMarker, state.jitDumpMarkerNumBytes);
+		fclose(state.jitDumpFile);
+		state.jitDumpFile = nullptr;
+		state.jitDumpMarker = nullptr;
+	}
+}
+
+static bool openJITDump(PerfMapState& state)
+{
+	const std::string path = "/tmp/jit-" + std::to_string(getpid()) + ".dump";
+	state.jitDumpFile = fopen(path.c_str(), "w+");
+	if(!state.jitDumpFile)
+	{
+		Log::printf(Log::error, "Couldn't create jitdump file %s.\n", path.c_str());
+		return false;
+	}
+
+	state.jitDumpMarkerNumBytes = Uptr(sysconf(_SC_PAGESIZE));
+	state.jitDumpMarker = mmap(nullptr,
+							   state.jitDumpMarkerNumBytes,
+							   PROT_READ | PROT_EXEC,
+							   MAP_PRIVATE,
+							   fileno(state.jitDumpFile),
+							   0);
+	if(state.jitDumpMarker == MAP_FAILED)
+	{
+		Log::printf(Log::error, "Couldn't map jitdump file %s.\n", path.c_str());
+		fclose(state.jitDumpFile);
+		state.jitDumpFile = nullptr;
+		state.jitDumpMarker = nullptr;
+		return false;
+	}
+
+	JITDumpHeader header;
+	memset(&header, 0, sizeof(header));
+	header.magic = jitDumpMagic;
+	header.version = jitDumpVersion;
+	header.numBytes = sizeof(JITDumpHeader);
+	header.elfMachine = getJITDumpELFMachine();
+	header.pid = U32(getpid());
+	header.timestamp = getJITDumpTimestamp();
+	fwrite(&header, sizeof(header), 1, state.jitDumpFile);
+	fflush(state.jitDumpFile);
+	return true;
+}
+
+static void writeJITDumpFunction(PerfMapState& state, const PerfMapFunction& function)
+{
+	const U64 timestamp = getJITDumpTimestamp();
+
+	// Write the mapping from code addresses to operator indices before the code.
+	if(function.opIndices.size())
+	{
+		const std::string& fileName = function.name;
+		U32 numBytes = U32(sizeof(JITDumpDebugInfoRecord)
+						   + function.opIndices.size() * (sizeof(JITDumpDebugEntry) + 2)
+						   + fileName.size() - 1);
+
+		JITDumpDebugInfoRecord debugInfoRecord;
+		debugInfoRecord.header.type = JITDumpRecordType::codeDebugInfo;
+		debugInfoRecord.header.numBytes = numBytes;
+		debugInfoRecord.header.timestamp = timestamp;
+		debugInfoRecord.codeAddress = function.address;
+		debugInfoRecord.numEntries = function.opIndices.size();
+		fwrite(&debugInfoRecord, sizeof(debugInfoRecord), 1, state.jitDumpFile);
+
+		for(Uptr entryIndex = 0; entryIndex < function.opIndices.size(); ++entryIndex)
+		{
+			JITDumpDebugEntry entry;
+			entry.codeAddress = function.opIndices[entryIndex].first;
+			entry.line = function.opIndices[entryIndex].second;
+			entry.discriminator = 0;
+			fwrite(&entry, sizeof(entry), 1, state.jitDumpFile);
+
+			if(entryIndex == 0)
+			{ fwrite(fileName.c_str(), fileName.size() + 1, 1, state.jitDumpFile); }
+			else
+			{
+				fwrite("\xff", 2, 1, state.jitDumpFile);
+			}
+		}
+	}
+
+	JITDumpCodeLoadRecord codeLoadRecord;
+	codeLoadRecord.header.type = JITDumpRecordType::codeLoad;
+	codeLoadRecord.header.numBytes
+		= U32(sizeof(JITDumpCodeLoadRecord) + function.name.size() + 1 + function.numBytes);
+	codeLoadRecord.header.timestamp = timestamp;
+	codeLoadRecord.pid = U32(getpid());
+	codeLoadRecord.tid = U32(syscall(SYS_gettid));
+	codeLoadRecord.virtualAddress = function.address;
+	codeLoadRecord.codeAddress = function.address;
+	codeLoadRecord.numCodeBytes = function.numBytes;
+	codeLoadRecord.codeIndex = state.nextCodeIndex++;
+	fwrite(&codeLoadRecord, sizeof(codeLoadRecord), 1, state.jitDumpFile);
+	fwrite(function.name.c_str(), function.name.size() + 1, 1, state.jitDumpFile);
+	fwrite(
+		reinterpret_cast<const void*>(function.address), function.numBytes, 1, state.jitDumpFile);
+}
+
+bool LLVMJIT::setPerfMapMode(PerfMapMode mode)
+{
+	PerfMapState& state = PerfMapState::get();
+	Platform::Mutex::Lock lock(state.mutex);
+
+	closePerfMap(state);
+	state.mode.store(PerfMapMode::none, std::memory_order_release);
+
+	switch(mode)
+	{
+	case PerfMapMode::none: break;
+	case PerfMapMode::map: {
+		const std::string path = "/tmp/perf-" + std::to_string(getpid()) + ".map";
+		state.mapFile = fopen(path.c_str(), "w");
+		if(!state.mapFile)
+		{
+			Log::printf(Log::error, "Couldn't create perf map file %s.\n", path.c_str());
+			return false;
+		}
+		break;
+	}
+	case PerfMapMode::jitdump:
+		if(!openJITDump(state)) { return false; }
+		break;
+
+	default: WAVM_UNREACHABLE();
+	};
+
+	state.mode.store(mode, std::memory_order_release);
+	return true;
+}
+
+PerfMapMode LLVMJIT::getPerfMapMode()
+{
+	return PerfMapState::get().mode.load(std::memory_order_acquire);
+}
+
+void LLVMJIT::addPerfMapFunctions(const std::vector<PerfMapFunction>& functions)
+{
+	PerfMapState& state = PerfMapState::get();
+	Platform::Mutex::Lock lock(state.mutex);
+
+	switch(state.mode.load(std::memory_order_relaxed))
+	{
+	case PerfMapMode::none: break;
+	case PerfMapMode::map:
+		// The map is append-only, like the maps written by other JITs: perf has no way to remove
+		// a function from it, and rewriting it whenever a module is unloaded is too slow.
+		for(const PerfMapFunction& function : functions)
+		{
+			fprintf(state.mapFile,
+					"%" WAVM_PRIxPTR " %" WAVM_PRIxPTR " %s\n",
+					function.address,
+					function.numBytes,
+					function.name.c_str());
+		}
+		fflush(state.mapFile);
+		break;
+	case PerfMapMode::jitdump:
+		for(const PerfMapFunction& function : functions) { writeJITDumpFunction(state, function); }
+		fflush(state.jitDumpFile);
+		break;
+
+	default: WAVM_UNREACHABLE();
+	};
+}
+
+#else
+
+bool LLVMJIT::setPerfMapMode(PerfMapMode mode) { return mode == PerfMapMode::none; }
+
+PerfMapMode LLVMJIT::getPerfMapMode() { return PerfMapMode::none; }
+
+void LLVMJIT::addPerfMapFunctions(const std::vector<PerfMapFunction>& functions) {}
+
+#endif
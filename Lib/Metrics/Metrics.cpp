@@ -0,0 +1,373 @@
+#include "WAVM/Metrics/Metrics.h"
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/HashMap.h"
+#include "WAVM/Platform/Intrinsic.h"
+#include "WAVM/Platform/Mutex.h"
+
+using namespace WAVM;
+using namespace WAVM::Metrics;
+
+std::atomic<bool> Metrics::Impl::enabled{false};
+
+void Metrics::setEnabled(bool enable) { Impl::enabled.store(enable, std::memory_order_relaxed); }
+
+static Uptr getThreadShardIndex()
+{
+	static std::atomic<Uptr> nextThreadShardIndex{0};
+	static thread_local Uptr threadShardIndex = nextThreadShardIndex++ % numShards;
+	return threadShardIndex;
+}
+
+void Counter::addImpl(U64 delta)
+{
+	shards[getThreadShardIndex()].value.fetch_add(delta, std::memory_order_relaxed);
+}
+
+U64 Counter::get() const
+{
+	U64 sum = 0;
+	for(const Shard& shard : shards) { sum += shard.value.load(std::memory_order_relaxed); }
+	return sum;
+}
+
+void Counter::reset()
+{
+	for(Shard& shard : shards) { shard.value.store(0, std::memory_order_relaxed); }
+}
+
+Uptr Histogram::getBucketIndex(U64 value)
+{
+	if(value < numSubBuckets) { return Uptr(value); }
+
+	// The bucket is determined by the highest set bit of the value, and the subBucketBits bits
+	// below it.
+	const Uptr shift = Uptr(floorLogTwo(value)) - subBucketBits;
+	return numSubBuckets + shift * numSubBuckets + Uptr(value >> shift) - numSubBuckets;
+}
+
+U64 Histogram::getBucketUpperBound(Uptr bucketIndex)
+{
+	WAVM_ASSERT(bucketIndex < numBuckets);
+	if(bucketIndex < numSubBuckets) { return U64(bucketIndex); }
+
+	const Uptr shift = (bucketIndex - numSubBuckets) / numSubBuckets;
+	const U64 subBucketIndex = U64(bucketIndex % numSubBuckets);
+	const U64 lowerBound = (numSubBuckets + subBucketIndex) << shift;
+	return lowerBound + ((U64(1) << shift) - 1);
+}
+
+Histogram::~Histogram() { delete[] shards.load(std::memory_order_acquire); }
+
+void Histogram::recordImpl(U64 value)
+{
+	// Allocate the shards the first time a value is recorded. If another thread allocated them
+	// concurrently, use its shards instead.
+	Shard* currentShards = shards.load(std::memory_order_acquire);
+	if(!currentShards)
+	{
+		Shard* newShards = new Shard[numShards];
+		if(shards.compare_exchange_strong(currentShards, newShards, std::memory_order_acq_rel))
+		{ currentShards = newShards; }
+		else
+		{
+			delete[] newShards;
+		}
+	}
+
+	Shard& shard = currentShards[getThreadShardIndex()];
+	shard.bucketCounts[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+	shard.sum.fetch_add(value, std::memory_order_relaxed);
+}
+
+U64 Histogram::getBucketCount(Uptr bucketIndex) const
+{
+	WAVM_ASSERT(bucketIndex < numBuckets);
+	const Shard* currentShards = shards.load(std::memory_order_acquire);
+	if(!currentShards) { return 0; }
+
+	U64 count = 0;
+	for(Uptr shardIndex = 0; shardIndex < numShards; ++shardIndex)
+	{
+		const Shard& shard = currentShards[shardIndex];
+		count += shard.bucketCounts[bucketIndex].load(std::memory_order_relaxed);
+	}
+	return count;
+}
+
+U64 Histogram::getSum() const
+{
+	const Shard* currentShards = shards.load(std::memory_order_acquire);
+	if(!currentShards) { return 0; }
+
+	U64 sum = 0;
+	for(Uptr shardIndex = 0; shardIndex < numShards; ++shardIndex)
+	{ sum += currentShards[shardIndex].sum.load(std::memory_order_relaxed); }
+	return sum;
+}
+
+void Histogram::reset()
+{
+	Shard* currentShards = shards.load(std::memory_order_acquire);
+	if(!currentShards) { return; }
+
+	for(Uptr shardIndex = 0; shardIndex < numShards; ++shardIndex)
+	{
+		for(std::atomic<U64>& bucketCount : currentShards[shardIndex].bucketCounts)
+		{ bucketCount.store(0, std::memory_order_relaxed); }
+		currentShards[shardIndex].sum.store(0, std::memory_order_relaxed);
+	}
+}
+
+namespace {
+	struct Metric
+	{
+		std::string name;
+		std::string help;
+		std::string labelName;
+		std::string labelValue;
+		MetricKind kind;
+		std::unique_ptr<Counter> counter;
+		std::unique_ptr<Histogram> histogram;
+	};
+
+	struct Registry
+	{
+		Platform::Mutex mutex;
+		std::vector<std::unique_ptr<Metric>> metrics;
+
+		// Maps a metric's name and label value, separated by a null character, to the metric.
+		HashMap<std::string, Metric*> nameAndLabelToMetricMap;
+
+		// The registry is never destroyed, so the metrics may be used from other static
+		// destructors, and from threads that are still running when the process exits.
+		static Registry& get()
+		{
+			static Registry* registry = new Registry;
+			return *registry;
+		}
+	};
+}
+
+static Metric& getOrAddMetric(Registry& registry,
+							  MetricKind kind,
+							  const char* name,
+							  const char* help,
+							  Unit unit,
+							  const char* labelName,
+							  const char* labelValue)
+{
+	WAVM_ASSERT(name && help);
+	WAVM_ASSERT(!labelName == !labelValue);
+
+	std::string nameAndLabel = name;
+	if(labelValue)
+	{
+		nameAndLabel += '\0';
+		nameAndLabel += labelValue;
+	}
+
+	Metric*& metric = registry.nameAndLabelToMetricMap.getOrAdd(nameAndLabel, nullptr);
+	if(!metric)
+	{
+		registry.metrics.emplace_back(new Metric);
+		metric = registry.metrics.back().get();
+		metric->name = name;
+		metric->help = help;
+		metric->labelName = labelName ? labelName : "";
+		metric->labelValue = labelValue ? labelValue : "";
+		metric->kind = kind;
+		if(kind == MetricKind::counter) { metric->counter.reset(new Counter); }
+		else
+		{
+			metric->histogram.reset(new Histogram(unit));
+		}
+	}
+
+	WAVM_ASSERT(metric->kind == kind);
+	WAVM_ASSERT(metric->help == help);
+	WAVM_ASSERT(metric->labelName == (labelName ? labelName : ""));
+	WAVM_ASSERT(kind == MetricKind::counter || metric->histogram->unit == unit);
+	return *metric;
+}
+
+Counter& Metrics::getCounter(const char* name,
+							 const char* help,
+							 const char* labelName,
+							 const char* labelValue)
+{
+	Registry& registry = Registry::get();
+	Platform::Mutex::Lock lock(registry.mutex);
+	return *getOrAddMetric(
+				registry, MetricKind::counter, name, help, Unit::none, labelName, labelValue)
+				.counter;
+}
+
+Histogram& Metrics::getHistogram(const char* name,
+								 const char* help,
+								 Unit unit,
+								 const char* labelName,
+								 const char* labelValue)
+{
+	Registry& registry = Registry::get();
+	Platform::Mutex::Lock lock(registry.mutex);
+	return *getOrAddMetric(
+				registry, MetricKind::histogram, name, help, unit, labelName, labelValue)
+				.histogram;
+}
+
+std::vector<MetricSnapshot> Metrics::getSnapshot()
+{
+	Registry& registry = Registry::get();
+	Platform::Mutex::Lock lock(registry.mutex);
+
+	std::vector<MetricSnapshot> snapshot;
+	for(const std::unique_ptr<Metric>& metric : registry.metrics)
+	{
+		MetricSnapshot metricSnapshot;
+		metricSnapshot.name = metric->name;
+		metricSnapshot.help = metric->help;
+		metricSnapshot.labelName = metric->labelName;
+		metricSnapshot.labelValue = metric->labelValue;
+		metricSnapshot.kind = metric->kind;
+		metricSnapshot.sum = 0;
+		if(metric->kind == MetricKind::counter)
+		{
+			metricSnapshot.unit = Unit::none;
+			metricSnapshot.count = metric->counter->get();
+		}
+		else
+		{
+			// Derive the count from the buckets, so it is consistent with the buckets even if
+			// values are recorded while the snapshot is taken.
+			const Histogram& histogram = *metric->histogram;
+			metricSnapshot.unit = histogram.unit;
+			metricSnapshot.count = 0;
+			for(Uptr bucketIndex = 0; bucketIndex < Histogram::numBuckets; ++bucketIndex)
+			{
+				const U64 bucketCount = histogram.getBucketCount(bucketIndex);
+				if(bucketCount)
+				{
+					metricSnapshot.buckets.push_back(
+						{Histogram::getBucketUpperBound(bucketIndex), bucketCount});
+					metricSnapshot.count += bucketCount;
+				}
+			}
+			metricSnapshot.sum = histogram.getSum();
+		}
+		snapshot.push_back(std::move(metricSnapshot));
+	}
+
+	std::sort(snapshot.begin(),
+			  snapshot.end(),
+			  [](const MetricSnapshot& left, const MetricSnapshot& right) {
+				  return left.name != right.name ? left.name < right.name
+												 : left.labelValue < right.labelValue;
+			  });
+	return snapshot;
+}
+
+static std::string formatValue(U64 value, Unit unit)
+{
+	char buffer[32];
+	if(unit == Unit::nanoseconds) { snprintf(buffer, sizeof(buffer), "%.9g", F64(value) / 1e9); }
+	else
+	{
+		snprintf(buffer, sizeof(buffer), "%" PRIu64, value);
+	}
+	return buffer;
+}
+
+static std::string escapeLabelValue(const std::string& labelValue)
+{
+	std::string result;
+	for(char c : labelValue)
+	{
+		switch(c)
+		{
+		case '\\': result += "\\\\"; break;
+		case '\"': result += "\\\""; break;
+		case '\n': result += "\\n"; break;
+		default: result += c; break;
+		};
+	}
+	return result;
+}
+
+// Formats the labels of a sample: the metric's label, if it has one, and an extra label.
+static std::string formatLabels(const MetricSnapshot& metric,
+								const char* extraLabelName = nullptr,
+								const std::string& extraLabelValue = std::string())
+{
+	std::string result;
+	if(metric.labelName.size())
+	{ result += metric.labelName + "=\"" + escapeLabelValue(metric.labelValue) + "\""; }
+	if(extraLabelName)
+	{
+		if(result.size()) { result += ','; }
+		result += std::string(extraLabelName) + "=\"" + extraLabelValue + "\"";
+	}
+	return result.size() ? "{" + result + "}" : result;
+}
+
+std::string Metrics::formatPrometheusText(const std::vector<MetricSnapshot>& snapshot)
+{
+	std::string result;
+	for(Uptr metricIndex = 0; metricIndex < snapshot.size(); ++metricIndex)
+	{
+		const MetricSnapshot& metric = snapshot[metricIndex];
+
+		// Only write the HELP and TYPE lines before the first sample with each name.
+		if(!metricIndex || snapshot[metricIndex - 1].name != metric.name)
+		{
+			result += "# HELP " + metric.name + ' ' + metric.help + '\n';
+			result += "# TYPE " + metric.name
+					  + (metric.kind == MetricKind::counter ? " counter\n" : " histogram\n");
+		}
+
+		if(metric.kind == MetricKind::counter)
+		{
+			result += metric.name + formatLabels(metric) + ' '
+					  + formatValue(metric.count, metric.unit) + '\n';
+		}
+		else
+		{
+			// Prometheus histogram buckets are cumulative.
+			U64 cumulativeCount = 0;
+			for(const HistogramBucketSnapshot& bucket : metric.buckets)
+			{
+				cumulativeCount += bucket.count;
+				result += metric.name + "_bucket"
+						  + formatLabels(metric, "le", formatValue(bucket.upperBound, metric.unit))
+						  + ' ' + formatValue(cumulativeCount, Unit::none) + '\n';
+			}
+			result += metric.name + "_bucket" + formatLabels(metric, "le", "+Inf") + ' '
+					  + formatValue(metric.count, Unit::none) + '\n';
+			result += metric.name + "_sum" + formatLabels(metric) + ' '
+					  + formatValue(metric.sum, metric.unit) + '\n';
+			result += metric.name + "_count" + formatLabels(metric) + ' '
+					  + formatValue(metric.count, Unit::none) + '\n';
+		}
+	}
+	return result;
+}
+
+void Metrics::reset()
+{
+	Registry& registry = Registry::get();
+	Platform::Mutex::Lock lock(registry.mutex);
+	for(const std::unique_ptr<Metric>& metric : registry.metrics)
+	{
+		if(metric->kind == MetricKind::counter) { metric->counter->reset(); }
+		else
+		{
+			metric->histogram->reset();
+		}
+	}
+}
@@ -397,6 +397,30 @@ NFA::Machine::Machine(Builder* builder)
 	Log::printf(Log::metrics, "  reduced DFA character classes to %" WAVM_PRIuPTR "\n", numClasses);
 }
 
+NFA::Machine::Machine(const U32* inCharToOffsetMap,
+					  const I16* runLengthEncodedTransitions,
+					  Uptr numRunLengthEncodedTransitions,
+					  Uptr inNumClasses,
+					  Uptr inNumStates)
+: numClasses(inNumClasses), numStates(inNumStates)
+{
+	memcpy(charToOffsetMap, inCharToOffsetMap, sizeof(charToOffsetMap));
+
+	// Expand the (next state, run length) pairs into the [charClass][state] transition map.
+	const Uptr numTransitions = numClasses * numStates;
+	stateAndOffsetToNextStateMap = new InternalStateIndex[numTransitions];
+	Uptr transitionIndex = 0;
+	for(Uptr runIndex = 0; runIndex + 1 < numRunLengthEncodedTransitions; runIndex += 2)
+	{
+		const InternalStateIndex nextState = runLengthEncodedTransitions[runIndex];
+		const Uptr runLength = Uptr(runLengthEncodedTransitions[runIndex + 1]);
+		WAVM_ERROR_UNLESS(runLength <= numTransitions - transitionIndex);
+		for(Uptr runOffset = 0; runOffset < runLength; ++runOffset)
+		{ stateAndOffsetToNextStateMap[transitionIndex++] = nextState; }
+	}
+	WAVM_ERROR_UNLESS(transitionIndex == numTransitions);
+}
+
 NFA::Machine::~Machine()
 {
 	if(stateAndOffsetToNextStateMap)
@@ -415,6 +439,59 @@ void NFA::Machine::moveFrom(Machine&& inMachine) noexcept
 	numStates = inMachine.numStates;
 }
 
+bool NFA::Machine::operator==(const Machine& other) const
+{
+	return numClasses == other.numClasses && numStates == other.numStates
+		   && !memcmp(charToOffsetMap, other.charToOffsetMap, sizeof(charToOffsetMap))
+		   && !memcmp(stateAndOffsetToNextStateMap,
+					  other.stateAndOffsetToNextStateMap,
+					  sizeof(InternalStateIndex) * numClasses * numStates);
+}
+
+std::string NFA::Machine::dumpCPPTables(const char* namePrefix) const
+{
+	static constexpr Uptr numValuesPerLine = 16;
+	const std::string prefix(namePrefix);
+
+	std::string result;
+	result += "static constexpr WAVM::Uptr " + prefix + "NumClasses = " + std::to_string(numClasses)
+			  + ";\n";
+	result += "static constexpr WAVM::Uptr " + prefix + "NumStates = " + std::to_string(numStates)
+			  + ";\n";
+
+	result += "static constexpr WAVM::U32 " + prefix + "CharToOffsetMap[256] = {";
+	for(Uptr charIndex = 0; charIndex < 256; ++charIndex)
+	{
+		if(charIndex % numValuesPerLine == 0) { result += "\n\t"; }
+		result += std::to_string(charToOffsetMap[charIndex]) + ",";
+	}
+	result += "\n};\n";
+
+	// Most transitions are to the unmatched character terminal, so run-length encode the
+	// transition map as (next state, run length) pairs.
+	std::string transitionsString;
+	Uptr numEncodedValues = 0;
+	const Uptr numTransitions = numClasses * numStates;
+	for(Uptr transitionIndex = 0; transitionIndex < numTransitions;)
+	{
+		const InternalStateIndex nextState = stateAndOffsetToNextStateMap[transitionIndex];
+		Uptr runLength = 1;
+		while(transitionIndex + runLength < numTransitions && runLength < INT16_MAX
+			  && stateAndOffsetToNextStateMap[transitionIndex + runLength] == nextState)
+		{ ++runLength; }
+		transitionIndex += runLength;
+
+		if(numEncodedValues % numValuesPerLine == 0) { transitionsString += "\n\t"; }
+		transitionsString += std::to_string(nextState) + "," + std::to_string(runLength) + ",";
+		numEncodedValues += 2;
+	}
+
+	result += "static constexpr WAVM::I16 " + prefix + "RunLengthEncodedTransitions["
+			  + std::to_string(numEncodedValues) + "] = {" + transitionsString + "\n};\n";
+
+	return result;
+}
+
 static char nibbleToHexChar(U8 value) { return value < 10 ? ('0' + value) : 'a' + value - 10; }
 
 static std::string escapeString(const std::string& string)
@@ -8,6 +8,7 @@
 #include "WAVM/Inline/Errors.h"
 #include "WAVM/Inline/Time.h"
 #include "WAVM/Inline/Timing.h"
+#include "WAVM/Metrics/Metrics.h"
 #include "WAVM/Platform/Clock.h"
 #include "WAVM/Platform/Defines.h"
 #include "WAVM/Runtime/Runtime.h"
@@ -624,12 +625,20 @@ struct LMDBObjectCache : Runtime::ObjectCacheInterface
 		Timing::logRatePerSecond(
 			"Hashed module key", hashTimer, numWASMBytes / 1024.0 / 1024.0, "MiB");
 
+		static Metrics::Counter& numHitsCounter = Metrics::getCounter(
+			"wavm_object_cache_hits_total", "Number of modules found in the object cache.");
+		static Metrics::Counter& numMissesCounter = Metrics::getCounter(
+			"wavm_object_cache_misses_total", "Number of modules not found in the object cache.");
+
 		// Try to find the module's object code in the cache.
 		std::vector<U8> objectCode;
 		try
 		{
 			if(tryGetCachedObject(moduleHashBytes, wasmBytes, numWASMBytes, objectCode))
-			{ return objectCode; }
+			{
+				numHitsCounter.add();
+				return objectCode;
+			}
 		}
 		catch(Database::Exception const& exception)
 		{
@@ -639,6 +648,7 @@ struct LMDBObjectCache : Runtime::ObjectCacheInterface
 		}
 
 		// If there wasn't a matching cached module+object code, compile the module.
+		numMissesCounter.add();
 		objectCode = compileThunk();
 
 		// Add the cached module+object code to the database.
@@ -82,6 +82,20 @@ Time Platform::getClockTime(Clock clock)
 		struct rusage ru;
 		WAVM_ERROR_UNLESS(!getrusage(RUSAGE_SELF, &ru));
 		return Time{timevalToNS(ru.ru_stime) + timevalToNS(ru.ru_utime)};
+#endif
+	}
+	case Clock::realtimeCoarse: {
+#ifdef CLOCK_REALTIME_COARSE
+		return Time{getClockAsI128(CLOCK_REALTIME_COARSE)};
+#else
+		return getClockTime(Clock::realtime);
+#endif
+	}
+	case Clock::monotonicCoarse: {
+#ifdef CLOCK_MONOTONIC_COARSE
+		return Time{getClockAsI128(CLOCK_MONOTONIC_COARSE)};
+#else
+		return getClockTime(Clock::monotonic);
 #endif
 	}
 	default: WAVM_UNREACHABLE();
@@ -107,6 +121,20 @@ Time Platform::getClockResolution(Clock clock)
 		return Time{getClockResAsI128(CLOCK_PROCESS_CPUTIME_ID)};
 #else
 		return Time{1000};
+#endif
+	}
+	case Clock::realtimeCoarse: {
+#ifdef CLOCK_REALTIME_COARSE
+		return Time{getClockResAsI128(CLOCK_REALTIME_COARSE)};
+#else
+		return getClockResolution(Clock::realtime);
+#endif
+	}
+	case Clock::monotonicCoarse: {
+#ifdef CLOCK_MONOTONIC_COARSE
+		return Time{getClockResAsI128(CLOCK_MONOTONIC_COARSE)};
+#else
+		return getClockResolution(Clock::monotonic);
 #endif
 	}
 	default: WAVM_UNREACHABLE();
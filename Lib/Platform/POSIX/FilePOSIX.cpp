@@ -7,17 +7,23 @@
 #include <fcntl.h>
 #include <limits.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
 #include <sys/uio.h>
 #include <unistd.h>
+#include <list>
+#include <memory>
+#include <string>
 #include "WAVM/Inline/Assert.h"
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/Inline/Errors.h"
+#include "WAVM/Inline/HashMap.h"
 #include "WAVM/Inline/I128.h"
 #include "WAVM/Inline/Time.h"
 #include "WAVM/Platform/File.h"
+#include "WAVM/Platform/Memory.h"
 #include "WAVM/Platform/Mutex.h"
 #include "WAVM/VFS/VFS.h"
 
@@ -638,11 +644,9 @@ protected:
 
 HostFS& Platform::getHostFS() { return POSIXFS::get(); }
 
-Result POSIXFS::open(const std::string& path,
-					 FileAccessMode accessMode,
-					 FileCreateMode createMode,
-					 VFD*& outFD,
-					 const VFDFlags& vfsFlags)
+static U32 getOpenFlags(FileAccessMode accessMode,
+						FileCreateMode createMode,
+						const VFDFlags& vfsFlags)
 {
 	U32 flags = 0;
 	switch(accessMode)
@@ -664,11 +668,20 @@ Result POSIXFS::open(const std::string& path,
 	default: WAVM_UNREACHABLE();
 	};
 
-	mode_t mode = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH;
-
 	flags |= translateVFDFlags(vfsFlags);
 
-	const I32 fd = ::open(path.c_str(), flags, mode);
+	return flags;
+}
+
+static constexpr mode_t openMode = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH;
+
+Result POSIXFS::open(const std::string& path,
+					 FileAccessMode accessMode,
+					 FileCreateMode createMode,
+					 VFD*& outFD,
+					 const VFDFlags& vfsFlags)
+{
+	const I32 fd = ::open(path.c_str(), getOpenFlags(accessMode, createMode, vfsFlags), openMode);
 	if(fd == -1) { return asVFSResult(errno); }
 
 	outFD = new POSIXFD(fd);
@@ -685,7 +698,9 @@ Result POSIXFS::getFileInfo(const std::string& path, VFS::FileInfo& outInfo)
 	return Result::success;
 }
 
-Result POSIXFS::setFileTimes(const std::string& path,
+// Sets the times of a file identified by a path relative to dirFD, which may be AT_FDCWD.
+static Result setFileTimesAt(I32 dirFD,
+							 const char* path,
 							 bool setLastAccessTime,
 							 Time lastAccessTime,
 							 bool setLastWriteTime,
@@ -708,9 +723,22 @@ Result POSIXFS::setFileTimes(const std::string& path,
 		timespecs[1].tv_nsec = U32(lastWriteTime.ns % 1000000000);
 	}
 
-	return utimensat(AT_FDCWD, path.c_str(), timespecs, 0) == 0 ? Result::success
-																: asVFSResult(errno);
+	return utimensat(dirFD, path, timespecs, 0) == 0 ? Result::success : asVFSResult(errno);
 #else
+	// utimes has no variant that takes a directory FD, so open the file and set its times
+	// through the FD.
+	if(dirFD != AT_FDCWD)
+	{
+		const I32 fd = openat(dirFD, path, O_RDONLY);
+		if(fd == -1) { return asVFSResult(errno); }
+
+		POSIXFD* vfd = new POSIXFD(fd);
+		const Result result
+			= vfd->setFileTimes(setLastAccessTime, lastAccessTime, setLastWriteTime, lastWriteTime);
+		vfd->close();
+		return result;
+	}
+
 	// MacOS pre-10.13 does not have utimensat, so fall back to utimes, which only has microsecond
 	// precision, and no equivalent of UTIME_OMIT.
 	// If !setLastAccessTime or !setLastWriteTime, use stat to read the current times.
@@ -718,7 +746,7 @@ Result POSIXFS::setFileTimes(const std::string& path,
 	if(!setLastAccessTime || !setLastWriteTime)
 	{
 		struct stat fileStatus;
-		if(stat(path.c_str(), &fileStatus)) { return asVFSResult(errno); }
+		if(stat(path, &fileStatus)) { return asVFSResult(errno); }
 
 		if(!setLastAccessTime) { lastAccessTime.ns = timeToNS(fileStatus.st_atime); }
 		if(!setLastWriteTime) { lastWriteTime.ns = timeToNS(fileStatus.st_mtime); }
@@ -730,10 +758,20 @@ Result POSIXFS::setFileTimes(const std::string& path,
 	timevals[1].tv_sec = U64(lastWriteTime.ns / 1000000000);
 	timevals[1].tv_usec = U64(lastWriteTime.ns / 1000 % 1000000);
 
-	return utimes(path.c_str(), timevals) == 0 ? Result::success : asVFSResult(errno);
+	return utimes(path, timevals) == 0 ? Result::success : asVFSResult(errno);
 #endif
 }
 
+Result POSIXFS::setFileTimes(const std::string& path,
+							 bool setLastAccessTime,
+							 Time lastAccessTime,
+							 bool setLastWriteTime,
+							 Time lastWriteTime)
+{
+	return setFileTimesAt(
+		AT_FDCWD, path.c_str(), setLastAccessTime, lastAccessTime, setLastWriteTime, lastWriteTime);
+}
+
 Result POSIXFS::openDir(const std::string& path, DirEntStream*& outStream)
 {
 	DIR* dir = opendir(path.c_str());
@@ -763,6 +801,424 @@ Result POSIXFS::createDir(const std::string& path)
 	return !mkdir(path.c_str(), 0666) ? Result::success : asVFSResult(errno);
 }
 
+// Splits a path into the path of its parent directory relative to the root, and the name of the
+// file within that directory. Empty and "." components are ignored, and ".." components are
+// resolved lexically without allowing them to escape the root. Returns false if the path refers to
+// the root itself.
+static bool splitSandboxPath(const std::string& path, std::string& outDirPath, std::string& outName)
+{
+	outDirPath.clear();
+
+	Uptr componentStart = 0;
+	while(componentStart < path.size())
+	{
+		if(path[componentStart] == '/')
+		{
+			++componentStart;
+			continue;
+		}
+
+		Uptr componentEnd = path.find('/', componentStart);
+		if(componentEnd == std::string::npos) { componentEnd = path.size(); }
+
+		const Uptr numComponentChars = componentEnd - componentStart;
+		if(numComponentChars == 1 && path[componentStart] == '.') {}
+		else if(numComponentChars == 2 && path[componentStart] == '.'
+				&& path[componentStart + 1] == '.')
+		{
+			const Uptr lastSeparator = outDirPath.rfind('/');
+			outDirPath.resize(lastSeparator == std::string::npos ? 0 : lastSeparator);
+		}
+		else
+		{
+			if(outDirPath.size()) { outDirPath += '/'; }
+			outDirPath.append(path, componentStart, numComponentChars);
+		}
+
+		componentStart = componentEnd;
+	}
+
+	if(outDirPath.empty()) { return false; }
+
+	const Uptr lastSeparator = outDirPath.rfind('/');
+	if(lastSeparator == std::string::npos)
+	{
+		outName = std::move(outDirPath);
+		outDirPath.clear();
+	}
+	else
+	{
+		outName = outDirPath.substr(lastSeparator + 1);
+		outDirPath.resize(lastSeparator);
+	}
+	return true;
+}
+
+// A directory FD that is closed once the last reference to it is released.
+struct POSIXDirHandle
+{
+	const I32 fd;
+
+	POSIXDirHandle(I32 inFD) : fd(inFD) {}
+	~POSIXDirHandle() { ::close(fd); }
+};
+
+typedef std::shared_ptr<POSIXDirHandle> POSIXDirHandleRef;
+
+// A file system whose root is a host directory. Instead of having the host resolve an absolute path
+// for every access, it holds FDs for the root directory and an LRU cache of recently used
+// subdirectories, and accesses files relative to them using the *at family of syscalls.
+struct POSIXSandboxFS : FileSystem
+{
+	POSIXSandboxFS(POSIXDirHandleRef&& inRootDir, Uptr inMaxCachedDirs)
+	: rootDir(std::move(inRootDir)), maxCachedDirs(inMaxCachedDirs)
+	{
+	}
+
+	virtual Result open(const std::string& path,
+						FileAccessMode accessMode,
+						FileCreateMode createMode,
+						VFD*& outFD,
+						const VFDFlags& flags) override
+	{
+		POSIXDirHandleRef dir;
+		std::string name;
+		Result result = resolve(path, dir, name);
+		if(result != Result::success) { return result; }
+
+		const I32 fd
+			= openat(dir->fd, name.c_str(), getOpenFlags(accessMode, createMode, flags), openMode);
+		if(fd == -1) { return asVFSResult(errno); }
+
+		outFD = new POSIXFD(fd);
+		return Result::success;
+	}
+
+	virtual Result getFileInfo(const std::string& path, FileInfo& outInfo) override
+	{
+		POSIXDirHandleRef dir;
+		std::string name;
+		Result result = resolve(path, dir, name);
+		if(result != Result::success) { return result; }
+
+		struct stat fileStatus;
+		if(fstatat(dir->fd, name.c_str(), &fileStatus, 0)) { return asVFSResult(errno); }
+
+		getFileInfoFromStatus(fileStatus, outInfo);
+		return Result::success;
+	}
+
+	virtual Result setFileTimes(const std::string& path,
+								bool setLastAccessTime,
+								Time lastAccessTime,
+								bool setLastWriteTime,
+								Time lastWriteTime) override
+	{
+		POSIXDirHandleRef dir;
+		std::string name;
+		Result result = resolve(path, dir, name);
+		if(result != Result::success) { return result; }
+
+		return setFileTimesAt(dir->fd,
+							  name.c_str(),
+							  setLastAccessTime,
+							  lastAccessTime,
+							  setLastWriteTime,
+							  lastWriteTime);
+	}
+
+	virtual Result openDir(const std::string& path, DirEntStream*& outStream) override
+	{
+		POSIXDirHandleRef dir;
+		std::string name;
+		Result result = resolve(path, dir, name);
+		if(result != Result::success) { return result; }
+
+		const I32 fd = openat(dir->fd, name.c_str(), O_RDONLY | O_DIRECTORY);
+		if(fd == -1) { return asVFSResult(errno); }
+
+		DIR* dirStream = fdopendir(fd);
+		if(!dirStream)
+		{
+			const int error = errno;
+			::close(fd);
+			return asVFSResult(error);
+		}
+
+		outStream = new POSIXDirEntStream(dirStream);
+		return Result::success;
+	}
+
+	virtual Result renameFile(const std::string& oldPath, const std::string& newPath) override
+	{
+		POSIXDirHandleRef oldDir;
+		std::string oldName;
+		Result result = resolveForModification(oldPath, oldDir, oldName);
+		if(result != Result::success) { return result; }
+
+		POSIXDirHandleRef newDir;
+		std::string newName;
+		result = resolveForModification(newPath, newDir, newName);
+		if(result != Result::success) { return result; }
+
+		if(renameat(oldDir->fd, oldName.c_str(), newDir->fd, newName.c_str()))
+		{ return asVFSResult(errno); }
+
+		// If a directory was moved or replaced, the cached FDs for it and its subdirectories no
+		// longer correspond to their paths.
+		invalidateCachedDirs(oldPath);
+		invalidateCachedDirs(newPath);
+		return Result::success;
+	}
+
+	virtual Result unlinkFile(const std::string& path) override
+	{
+		POSIXDirHandleRef dir;
+		std::string name;
+		Result result = resolveForModification(path, dir, name);
+		if(result != Result::success) { return result; }
+
+		return !unlinkat(dir->fd, name.c_str(), 0) ? Result::success : asVFSResult(errno);
+	}
+
+	virtual Result removeDir(const std::string& path) override
+	{
+		POSIXDirHandleRef dir;
+		std::string name;
+		Result result = resolveForModification(path, dir, name);
+		if(result != Result::success) { return result; }
+
+		if(unlinkat(dir->fd, name.c_str(), AT_REMOVEDIR)) { return asVFSResult(errno); }
+
+		invalidateCachedDirs(path);
+		return Result::success;
+	}
+
+	virtual Result createDir(const std::string& path) override
+	{
+		POSIXDirHandleRef dir;
+		std::string name;
+		Result result = resolve(path, dir, name);
+		if(result != Result::success) { return result; }
+
+		return !mkdirat(dir->fd, name.c_str(), 0666) ? Result::success : asVFSResult(errno);
+	}
+
+private:
+	struct CachedDir
+	{
+		std::string path;
+		POSIXDirHandleRef dir;
+	};
+
+	const POSIXDirHandleRef rootDir;
+	const Uptr maxCachedDirs;
+
+	// The cached subdirectories of the root, ordered from most to least recently used, and indexed
+	// by their path relative to the root.
+	Platform::Mutex cacheMutex;
+	std::list<CachedDir> cachedDirs;
+	HashMap<std::string, std::list<CachedDir>::iterator> pathToCachedDirMap;
+
+	// Resolves a path to an open parent directory and the name of the file within it. If the path
+	// refers to the root directory, outName is set to ".".
+	Result resolve(const std::string& path, POSIXDirHandleRef& outDir, std::string& outName)
+	{
+		std::string dirPath;
+		if(!splitSandboxPath(path, dirPath, outName))
+		{
+			outDir = rootDir;
+			outName = ".";
+			return Result::success;
+		}
+
+		return getDir(dirPath, outDir);
+	}
+
+	// Like resolve, but disallows paths that refer to the root directory.
+	Result resolveForModification(const std::string& path,
+								  POSIXDirHandleRef& outDir,
+								  std::string& outName)
+	{
+		std::string dirPath;
+		if(!splitSandboxPath(path, dirPath, outName)) { return Result::notPermitted; }
+
+		return getDir(dirPath, outDir);
+	}
+
+	Result getDir(const std::string& dirPath, POSIXDirHandleRef& outDir)
+	{
+		if(dirPath.empty())
+		{
+			outDir = rootDir;
+			return Result::success;
+		}
+
+		Platform::Mutex::Lock cacheLock(cacheMutex);
+
+		// Find the longest prefix of the path that is cached.
+		POSIXDirHandleRef dir = rootDir;
+		Uptr numResolvedChars = 0;
+		Uptr prefixEnd = dirPath.size();
+		while(true)
+		{
+			auto cachedDirIt = prefixEnd == dirPath.size()
+								   ? pathToCachedDirMap.get(dirPath)
+								   : pathToCachedDirMap.get(dirPath.substr(0, prefixEnd));
+			if(cachedDirIt)
+			{
+				// Move the cached directory to the front of the LRU list.
+				cachedDirs.splice(cachedDirs.begin(), cachedDirs, *cachedDirIt);
+
+				dir = (*cachedDirIt)->dir;
+				numResolvedChars = prefixEnd;
+				break;
+			}
+
+			const Uptr lastSeparator = dirPath.rfind('/', prefixEnd - 1);
+			if(lastSeparator == std::string::npos) { break; }
+			prefixEnd = lastSeparator;
+		}
+
+		// Open the remaining components of the path one at a time, caching each of them.
+		while(numResolvedChars < dirPath.size())
+		{
+			const Uptr componentStart = numResolvedChars ? numResolvedChars + 1 : 0;
+			Uptr componentEnd = dirPath.find('/', componentStart);
+			if(componentEnd == std::string::npos) { componentEnd = dirPath.size(); }
+
+			const std::string component
+				= dirPath.substr(componentStart, componentEnd - componentStart);
+			const I32 fd = openat(dir->fd, component.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+			if(fd == -1) { return asVFSResult(errno); }
+
+			dir = std::make_shared<POSIXDirHandle>(fd);
+			addCachedDir(dirPath.substr(0, componentEnd), dir);
+			numResolvedChars = componentEnd;
+		}
+
+		outDir = std::move(dir);
+		return Result::success;
+	}
+
+	void addCachedDir(std::string&& path, const POSIXDirHandleRef& dir)
+	{
+		cachedDirs.push_front({std::move(path), dir});
+		pathToCachedDirMap.addOrFail(cachedDirs.front().path, cachedDirs.begin());
+
+		if(cachedDirs.size() > maxCachedDirs)
+		{
+			pathToCachedDirMap.removeOrFail(cachedDirs.back().path);
+			cachedDirs.pop_back();
+		}
+	}
+
+	// Removes a directory and its subdirectories from the cache.
+	void invalidateCachedDirs(const std::string& path)
+	{
+		std::string dirPath;
+		std::string name;
+		if(!splitSandboxPath(path, dirPath, name)) { return; }
+		if(dirPath.size()) { dirPath += '/'; }
+		dirPath += name;
+
+		Platform::Mutex::Lock cacheLock(cacheMutex);
+		for(auto cachedDirIt = cachedDirs.begin(); cachedDirIt != cachedDirs.end();)
+		{
+			const std::string& cachedPath = cachedDirIt->path;
+			if(!cachedPath.compare(0, dirPath.size(), dirPath)
+			   && (cachedPath.size() == dirPath.size() || cachedPath[dirPath.size()] == '/'))
+			{
+				pathToCachedDirMap.removeOrFail(cachedPath);
+				cachedDirIt = cachedDirs.erase(cachedDirIt);
+			}
+			else
+			{
+				++cachedDirIt;
+			}
+		}
+	}
+};
+
+std::shared_ptr<FileSystem> Platform::makeHostSandboxFS(const std::string& rootPath,
+														Uptr maxCachedDirs)
+{
+	const I32 rootFD = ::open(rootPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if(rootFD == -1) { return nullptr; }
+
+	return std::make_shared<POSIXSandboxFS>(std::make_shared<POSIXDirHandle>(rootFD),
+											maxCachedDirs);
+}
+
+struct POSIXMappedFile : MappedFile
+{
+	POSIXMappedFile(I32 inFD, const U8* inData, Uptr inNumBytes)
+	: MappedFile(inData, inNumBytes), fd(inFD)
+	{
+	}
+
+	~POSIXMappedFile()
+	{
+		if(numBytes && munmap(const_cast<U8*>(data), numBytes))
+		{ Errors::fatalf("munmap failed: %s", strerror(errno)); }
+		if(::close(fd)) { Errors::fatalf("close failed: %s", strerror(errno)); }
+	}
+
+	virtual bool mapCopyOnWrite(U64 offset, Uptr numMapBytes, U8* destAddress) override
+	{
+		const Uptr pageMask = getBytesPerPage() - 1;
+		WAVM_ASSERT(!(offset & pageMask));
+		WAVM_ASSERT(!(numMapBytes & pageMask));
+		WAVM_ASSERT(!(reinterpret_cast<Uptr>(destAddress) & pageMask));
+
+		// Don't map pages that are entirely past the end of the file: accessing them would raise
+		// SIGBUS instead of reading zeroes.
+		if(offset > numBytes || numMapBytes > ((numBytes - offset + pageMask) & ~pageMask))
+		{ return false; }
+		if(!numMapBytes) { return true; }
+
+		void* result = mmap(destAddress,
+							numMapBytes,
+							PROT_READ | PROT_WRITE,
+							MAP_PRIVATE | MAP_FIXED,
+							fd,
+							off_t(offset));
+		return result == destAddress;
+	}
+
+private:
+	I32 fd;
+};
+
+std::shared_ptr<MappedFile> Platform::mapFile(const std::string& path)
+{
+	const I32 fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if(fd == -1) { return nullptr; }
+
+	struct stat fileStatus;
+	if(fstat(fd, &fileStatus) || !S_ISREG(fileStatus.st_mode)
+	   || U64(fileStatus.st_size) > U64(UINTPTR_MAX))
+	{
+		::close(fd);
+		return nullptr;
+	}
+
+	// mmap doesn't allow mapping zero bytes, so represent empty files with a null mapping.
+	const Uptr numBytes = Uptr(fileStatus.st_size);
+	void* data = nullptr;
+	if(numBytes)
+	{
+		data = mmap(nullptr, numBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(data == MAP_FAILED)
+		{
+			::close(fd);
+			return nullptr;
+		}
+	}
+
+	return std::make_shared<POSIXMappedFile>(fd, (const U8*)data, numBytes);
+}
+
 std::string Platform::getCurrentWorkingDirectory()
 {
 	const Uptr maxPathBytes = pathconf(".", _PC_PATH_MAX);
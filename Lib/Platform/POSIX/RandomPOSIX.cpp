@@ -1,9 +1,11 @@
 #include <errno.h>
 #include <fcntl.h>
+#include <pthread.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <atomic>
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/Inline/Errors.h"
 #include "WAVM/Platform/Random.h"
@@ -60,3 +62,15 @@ void Platform::getCryptographicRNG(U8* outRandomBytes, Uptr numBytes)
 	readDevRandom(outRandomBytes, numBytes);
 }
 #endif
+
+static std::atomic<U64> forkGeneration{0};
+
+static void incrementForkGeneration() { forkGeneration.fetch_add(1, std::memory_order_relaxed); }
+
+U64 Platform::getForkGeneration()
+{
+	// Install the handler before the first generation is returned, so any fork after it changes.
+	static const int atforkResult = pthread_atfork(nullptr, nullptr, incrementForkGeneration);
+	if(atforkResult) { Errors::fatalf("pthread_atfork failed: %s", strerror(atforkResult)); }
+	return forkGeneration.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,341 @@
+#include <pthread.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <time.h>
+#include <string.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include "POSIXPrivate.h"
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/I128.h"
+#include "WAVM/Platform/Diagnostics.h"
+#include "WAVM/Platform/Mutex.h"
+#include "WAVM/Platform/Sampling.h"
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+#endif
+
+using namespace WAVM;
+using namespace WAVM::Platform;
+
+// A single-producer single-consumer ring buffer of call stacks sampled from a thread. The SIGPROF
+// handler running on the thread is the only producer, and readSamples is the only consumer.
+struct SampleBuffer
+{
+	static constexpr Uptr numSamples = 1024;
+
+	struct Sample
+	{
+		Uptr numFrames;
+		Uptr ips[CallStack::maxFrames];
+	};
+
+	std::atomic<U64> numWrittenSamples{0};
+	std::atomic<U64> numReadSamples{0};
+	std::atomic<Uptr> numDroppedSamples{0};
+
+	// The bounds of the thread's stack. The SIGPROF handler only follows frame pointers within
+	// them.
+	Uptr stackMinAddr = 0;
+	Uptr stackMaxAddr = 0;
+
+#ifdef __linux__
+	timer_t timer;
+#endif
+
+	// Set when the thread stops being sampled. The buffer is freed by readSamples once it has read
+	// the remaining samples.
+	bool isStopped = false;
+
+	Sample samples[numSamples];
+};
+
+// The buffers of the threads that are being sampled, and the buffers of stopped threads that still
+// contain unread samples. The SIGPROF handler doesn't access this state: it only accesses the
+// current thread's buffer through currentThreadSampleBuffer.
+struct SamplingState
+{
+	Mutex mutex;
+	bool isStarted = false;
+	Time samplingInterval{0};
+	std::vector<SampleBuffer*> sampleBuffers;
+
+	static SamplingState& get()
+	{
+		static SamplingState state;
+		return state;
+	}
+};
+
+// This is a trivially destructible thread_local, so the SIGPROF handler can access it without
+// running any initialization code. startSamplingCurrentThread writes it before the thread's timer
+// is started, so the TLS block is allocated before the handler can run.
+static thread_local SampleBuffer* currentThreadSampleBuffer = nullptr;
+
+static bool getInterruptedRegisters(void* contextVoid,
+									Uptr& outIP,
+									Uptr& outStackPointer,
+									Uptr& outFramePointer)
+{
+	ucontext_t* context = (ucontext_t*)contextVoid;
+#if defined(__linux__) && defined(__x86_64__)
+	outIP = Uptr(context->uc_mcontext.gregs[REG_RIP]);
+	outStackPointer = Uptr(context->uc_mcontext.gregs[REG_RSP]);
+	outFramePointer = Uptr(context->uc_mcontext.gregs[REG_RBP]);
+	return true;
+#elif defined(__linux__) && defined(__aarch64__)
+	outIP = Uptr(context->uc_mcontext.pc);
+	outStackPointer = Uptr(context->uc_mcontext.sp);
+	outFramePointer = Uptr(context->uc_mcontext.regs[29]);
+	return true;
+#elif defined(__APPLE__) && defined(__x86_64__)
+	outIP = Uptr(context->uc_mcontext->__ss.__rip);
+	outStackPointer = Uptr(context->uc_mcontext->__ss.__rsp);
+	outFramePointer = Uptr(context->uc_mcontext->__ss.__rbp);
+	return true;
+#elif defined(__APPLE__) && defined(__aarch64__)
+	outIP = Uptr(context->uc_mcontext->__ss.__pc);
+	outStackPointer = Uptr(context->uc_mcontext->__ss.__sp);
+	outFramePointer = Uptr(context->uc_mcontext->__ss.__fp);
+	return true;
+#else
+	return false;
+#endif
+}
+
+// The SIGPROF handler may interrupt any code on a sampled thread, including the SIGSEGV handler
+// and the code it longjmps to, so it must be async-signal-safe. It doesn't allocate, lock, or use
+// libunwind, and it only reads stack memory within the interrupted thread's stack, so it can't
+// fault and have the fault mistaken for a WebAssembly trap by the SIGSEGV handler.
+WAVM_NO_ASAN static void sigprofHandler(int, siginfo_t*, void* contextVoid)
+{
+	SampleBuffer* buffer = currentThreadSampleBuffer;
+	if(!buffer) { return; }
+
+	Uptr ip;
+	Uptr stackPointer;
+	Uptr framePointer;
+	if(!getInterruptedRegisters(contextVoid, ip, stackPointer, framePointer)) { return; }
+
+	const U64 numWrittenSamples = buffer->numWrittenSamples.load(std::memory_order_relaxed);
+	if(numWrittenSamples - buffer->numReadSamples.load(std::memory_order_acquire)
+	   >= SampleBuffer::numSamples)
+	{
+		buffer->numDroppedSamples.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	SampleBuffer::Sample& sample = buffer->samples[numWrittenSamples % SampleBuffer::numSamples];
+
+	// Walk the chain of frame records, each of which contains the caller's frame pointer followed
+	// by the return address. Like captureCallStack, subtract 1 from the return addresses so they
+	// are within the call instruction. Live frame records are between the interrupted stack
+	// pointer and the top of the stack, so a frame pointer below the stack pointer is stale, or
+	// not a frame pointer at all. The stack pointer may be on the signal stack if the SIGSEGV
+	// handler was interrupted, so the walk is also bounded by the bottom of the thread's stack.
+	const Uptr minFramePointer = std::max(stackPointer, buffer->stackMinAddr);
+	sample.ips[0] = ip;
+	sample.numFrames = 1;
+	while(sample.numFrames < CallStack::maxFrames && !(framePointer & (sizeof(Uptr) - 1))
+		  && framePointer >= minFramePointer
+		  && framePointer + sizeof(Uptr) * 2 <= buffer->stackMaxAddr)
+	{
+		const Uptr* frameRecord = reinterpret_cast<const Uptr*>(framePointer);
+		const Uptr callerFramePointer = frameRecord[0];
+		const Uptr returnAddress = frameRecord[1];
+		if(!returnAddress) { break; }
+		sample.ips[sample.numFrames++] = returnAddress - 1;
+
+		// Frame records must be at increasing addresses, which also ensures the walk terminates.
+		if(callerFramePointer <= framePointer) { break; }
+		framePointer = callerFramePointer;
+	}
+
+	buffer->numWrittenSamples.store(numWrittenSamples + 1, std::memory_order_release);
+}
+
+static void initSigprofHandlerOnce()
+{
+	static bool initedSigprofHandler = [] {
+		struct sigaction signalAction;
+		signalAction.sa_sigaction = sigprofHandler;
+		signalAction.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_RESTART;
+		sigemptyset(&signalAction.sa_mask);
+		WAVM_ERROR_UNLESS(!sigaction(SIGPROF, &signalAction, nullptr));
+		return true;
+	}();
+	WAVM_ASSERT(initedSigprofHandler);
+}
+
+static void setSampleTimer(SampleBuffer* buffer, Time interval)
+{
+	const I128 intervalNS = interval.ns;
+	struct timespec intervalTimespec;
+	intervalTimespec.tv_sec = time_t(I64(intervalNS / 1000000000));
+	intervalTimespec.tv_nsec = long(I64(intervalNS % 1000000000));
+
+#ifdef __linux__
+	struct itimerspec timerSpec;
+	timerSpec.it_interval = intervalTimespec;
+	timerSpec.it_value = intervalTimespec;
+	WAVM_ERROR_UNLESS(!timer_settime(buffer->timer, 0, &timerSpec, nullptr));
+#else
+	// Other POSIX platforms don't have per-thread CPU time timers, so use a process-wide profiling
+	// timer, whose SIGPROF is delivered to one of the threads using CPU time.
+	struct itimerval timerValue;
+	timerValue.it_interval.tv_sec = intervalTimespec.tv_sec;
+	timerValue.it_interval.tv_usec = suseconds_t(intervalTimespec.tv_nsec / 1000);
+	timerValue.it_value = timerValue.it_interval;
+	WAVM_ERROR_UNLESS(!setitimer(ITIMER_PROF, &timerValue, nullptr));
+#endif
+}
+
+bool Platform::startSampling(Time samplingInterval)
+{
+	WAVM_ASSERT(samplingInterval.ns > 0);
+	initSigprofHandlerOnce();
+
+	SamplingState& state = SamplingState::get();
+	Mutex::Lock lock(state.mutex);
+	state.isStarted = true;
+	state.samplingInterval = samplingInterval;
+
+	for(SampleBuffer* buffer : state.sampleBuffers)
+	{
+		if(!buffer->isStopped) { setSampleTimer(buffer, samplingInterval); }
+	}
+#ifndef __linux__
+	setSampleTimer(nullptr, samplingInterval);
+#endif
+
+	return true;
+}
+
+void Platform::stopSampling()
+{
+	SamplingState& state = SamplingState::get();
+	Mutex::Lock lock(state.mutex);
+	state.isStarted = false;
+
+	for(SampleBuffer* buffer : state.sampleBuffers)
+	{
+		if(!buffer->isStopped) { setSampleTimer(buffer, Time{0}); }
+	}
+#ifndef __linux__
+	setSampleTimer(nullptr, Time{0});
+#endif
+}
+
+bool Platform::startSamplingCurrentThread()
+{
+	WAVM_ASSERT(!currentThreadSampleBuffer);
+
+	SamplingState& state = SamplingState::get();
+	Mutex::Lock lock(state.mutex);
+	if(!state.isStarted) { return false; }
+
+	// Make sure the thread has a signal stack for the SIGPROF handler to run on.
+	initThreadAndGlobalSignals();
+
+	SampleBuffer* buffer = new SampleBuffer;
+	U8* stackMinGuardAddr;
+	U8* stackMinAddr;
+	U8* stackMaxAddr;
+	sigAltStack.getNonSignalStack(stackMinGuardAddr, stackMinAddr, stackMaxAddr);
+	buffer->stackMinAddr = reinterpret_cast<Uptr>(stackMinAddr);
+	buffer->stackMaxAddr = reinterpret_cast<Uptr>(stackMaxAddr);
+
+#ifdef __linux__
+	struct sigevent signalEvent;
+	memset(&signalEvent, 0, sizeof(signalEvent));
+	signalEvent.sigev_notify = SIGEV_THREAD_ID;
+	signalEvent.sigev_signo = SIGPROF;
+	signalEvent.sigev_notify_thread_id = pid_t(syscall(SYS_gettid));
+	if(timer_create(CLOCK_THREAD_CPUTIME_ID, &signalEvent, &buffer->timer))
+	{
+		delete buffer;
+		return false;
+	}
+#endif
+
+	currentThreadSampleBuffer = buffer;
+	state.sampleBuffers.push_back(buffer);
+#ifdef __linux__
+	setSampleTimer(buffer, state.samplingInterval);
+#endif
+	return true;
+}
+
+void Platform::stopSamplingCurrentThread()
+{
+	SampleBuffer* buffer = currentThreadSampleBuffer;
+	if(!buffer) { return; }
+
+	SamplingState& state = SamplingState::get();
+	Mutex::Lock lock(state.mutex);
+
+	// Block SIGPROF while deleting the timer, so a pending SIGPROF is handled after the thread's
+	// buffer is detached, and is ignored.
+	sigset_t sigprofSet;
+	sigset_t oldSet;
+	sigemptyset(&sigprofSet);
+	sigaddset(&sigprofSet, SIGPROF);
+	WAVM_ERROR_UNLESS(!pthread_sigmask(SIG_BLOCK, &sigprofSet, &oldSet));
+
+#ifdef __linux__
+	WAVM_ERROR_UNLESS(!timer_delete(buffer->timer));
+#endif
+	currentThreadSampleBuffer = nullptr;
+
+	WAVM_ERROR_UNLESS(!pthread_sigmask(SIG_SETMASK, &oldSet, nullptr));
+
+	buffer->isStopped = true;
+}
+
+Uptr Platform::readSamples(const std::function<void(const CallStack&)>& visitSample)
+{
+	SamplingState& state = SamplingState::get();
+	Mutex::Lock lock(state.mutex);
+
+	Uptr numDroppedSamples = 0;
+	for(Uptr bufferIndex = 0; bufferIndex < state.sampleBuffers.size();)
+	{
+		SampleBuffer* buffer = state.sampleBuffers[bufferIndex];
+
+		const U64 numReadSamples = buffer->numReadSamples.load(std::memory_order_relaxed);
+		const U64 numWrittenSamples = buffer->numWrittenSamples.load(std::memory_order_acquire);
+		for(U64 sampleIndex = numReadSamples; sampleIndex < numWrittenSamples; ++sampleIndex)
+		{
+			const SampleBuffer::Sample& sample
+				= buffer->samples[sampleIndex % SampleBuffer::numSamples];
+
+			CallStack callStack;
+			for(Uptr frameIndex = 0; frameIndex < sample.numFrames; ++frameIndex)
+			{ callStack.frames.push_back(CallStack::Frame{sample.ips[frameIndex]}); }
+			visitSample(callStack);
+		}
+		buffer->numReadSamples.store(numWrittenSamples, std::memory_order_release);
+		numDroppedSamples += buffer->numDroppedSamples.exchange(0, std::memory_order_relaxed);
+
+		// Free the buffers of threads that have stopped being sampled.
+		if(buffer->isStopped)
+		{
+			delete buffer;
+			state.sampleBuffers[bufferIndex] = state.sampleBuffers.back();
+			state.sampleBuffers.pop_back();
+		}
+		else
+		{
+			++bufferIndex;
+		}
+	}
+
+	return numDroppedSamples;
+}
@@ -28,6 +28,7 @@
 #include "WAVM/Platform/Intrinsic.h"
 #include "WAVM/Platform/Memory.h"
 #include "WAVM/Platform/Mutex.h"
+#include "WAVM/Platform/Sampling.h"
 #include "WAVM/Platform/Signal.h"
 #include "WAVM/Platform/Thread.h"
 
@@ -262,8 +263,12 @@ WAVM_NO_ASAN static void* createThreadEntry(void* argsVoid)
 
 	initThreadAndGlobalSignals();
 
+	// If the sampling profiler is started, sample the thread until it exits.
+	startSamplingCurrentThread();
+
 	I64 exitCode = (*args->entry)(args->entryArgument);
 
+	stopSamplingCurrentThread();
 	sigAltStack.deinit();
 
 	return reinterpret_cast<void*>(exitCode);
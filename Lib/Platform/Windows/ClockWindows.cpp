@@ -97,6 +97,13 @@ Time Platform::getClockTime(Clock clock)
 
 		return Time{fileTimeToI128(kernelTime) + fileTimeToI128(userTime)};
 	}
+	case Clock::realtimeCoarse: {
+		FILETIME realtimeClock;
+		GetSystemTimeAsFileTime(&realtimeClock);
+
+		return Time{fileTimeToWAVMRealTime(realtimeClock)};
+	}
+	case Clock::monotonicCoarse: return getClockTime(Clock::monotonic);
 	default: WAVM_UNREACHABLE();
 	};
 }
@@ -113,6 +120,15 @@ Time Platform::getClockResolution(Clock clock)
 		return Time{I128(result)};
 	}
 	case Clock::processCPUTime: return Time{100};
+	case Clock::realtimeCoarse: {
+		DWORD timeAdjustment;
+		DWORD timeIncrement;
+		BOOL isTimeAdjustmentDisabled;
+		WAVM_ERROR_UNLESS(
+			GetSystemTimeAdjustment(&timeAdjustment, &timeIncrement, &isTimeAdjustmentDisabled));
+		return Time{I128(U64(timeIncrement)) * 100};
+	}
+	case Clock::monotonicCoarse: return getClockResolution(Clock::monotonic);
 	default: WAVM_UNREACHABLE();
 	};
 }
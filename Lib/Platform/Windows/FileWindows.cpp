@@ -9,6 +9,7 @@
 #include "WAVM/Platform/Event.h"
 #include "WAVM/Platform/File.h"
 #include "WAVM/Platform/RWMutex.h"
+#include "WAVM/VFS/SandboxFS.h"
 #include "WAVM/VFS/VFS.h"
 #include "WindowsPrivate.h"
 
@@ -907,6 +908,87 @@ Result WindowsFS::openDir(const std::string& path, DirEntStream*& outStream)
 	}
 }
 
+std::shared_ptr<FileSystem> Platform::makeHostSandboxFS(const std::string& rootPath,
+														Uptr maxCachedDirs)
+{
+	// Windows doesn't have an equivalent of the POSIX *at syscalls, so just prefix the root path to
+	// each path accessed through the host file system.
+	return VFS::makeSandboxFS(&getHostFS(), rootPath);
+}
+
+struct WindowsMappedFile : MappedFile
+{
+	WindowsMappedFile(HANDLE inFileHandle,
+					  HANDLE inMappingHandle,
+					  const U8* inData,
+					  Uptr inNumBytes)
+	: MappedFile(inData, inNumBytes), fileHandle(inFileHandle), mappingHandle(inMappingHandle)
+	{
+	}
+
+	~WindowsMappedFile()
+	{
+		if(data && !UnmapViewOfFile(data))
+		{ Errors::fatalf("UnmapViewOfFile failed: GetLastError()=%u", GetLastError()); }
+		if(mappingHandle && !CloseHandle(mappingHandle))
+		{ Errors::fatalf("CloseHandle failed: GetLastError()=%u", GetLastError()); }
+		if(!CloseHandle(fileHandle))
+		{ Errors::fatalf("CloseHandle failed: GetLastError()=%u", GetLastError()); }
+	}
+
+	virtual bool mapCopyOnWrite(U64 offset, Uptr numMapBytes, U8* destAddress) override
+	{
+		// Windows can't map a view of a file over pages that are already allocated.
+		return false;
+	}
+
+private:
+	HANDLE fileHandle;
+	HANDLE mappingHandle;
+};
+
+std::shared_ptr<MappedFile> Platform::mapFile(const std::string& path)
+{
+	// Convert the path from a UTF-8 VFS path (with /) to a UTF-16 Windows path (with \).
+	std::wstring windowsPath;
+	if(!getWindowsPath(path, windowsPath)) { return nullptr; }
+
+	HANDLE fileHandle = CreateFileW(windowsPath.c_str(),
+									GENERIC_READ,
+									FILE_SHARE_READ,
+									nullptr,
+									OPEN_EXISTING,
+									FILE_ATTRIBUTE_NORMAL,
+									nullptr);
+	if(fileHandle == INVALID_HANDLE_VALUE) { return nullptr; }
+
+	LARGE_INTEGER fileSize;
+	if(!GetFileSizeEx(fileHandle, &fileSize) || U64(fileSize.QuadPart) > U64(UINTPTR_MAX))
+	{
+		CloseHandle(fileHandle);
+		return nullptr;
+	}
+
+	// CreateFileMapping doesn't allow mapping empty files, so represent them with a null mapping.
+	const Uptr numBytes = Uptr(fileSize.QuadPart);
+	HANDLE mappingHandle = nullptr;
+	const U8* data = nullptr;
+	if(numBytes)
+	{
+		mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if(mappingHandle)
+		{ data = (const U8*)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, numBytes); }
+		if(!data)
+		{
+			if(mappingHandle) { CloseHandle(mappingHandle); }
+			CloseHandle(fileHandle);
+			return nullptr;
+		}
+	}
+
+	return std::make_shared<WindowsMappedFile>(fileHandle, mappingHandle, data, numBytes);
+}
+
 std::string Platform::getCurrentWorkingDirectory()
 {
 	wchar_t buffer[MAX_PATH];
@@ -14,3 +14,9 @@ void Platform::getCryptographicRNG(U8* outRandomBytes, Uptr numBytes)
 	WAVM_ERROR_UNLESS(!BCryptGenRandom(
 		nullptr, outRandomBytes, ULONG(numBytes), BCRYPT_USE_SYSTEM_PREFERRED_RNG));
 }
+
+U64 Platform::getForkGeneration()
+{
+	// Windows processes can't fork.
+	return 0;
+}
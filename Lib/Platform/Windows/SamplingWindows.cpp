@@ -0,0 +1,15 @@
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Platform/Sampling.h"
+
+using namespace WAVM;
+using namespace WAVM::Platform;
+
+// Sampling isn't implemented on Windows.
+
+bool Platform::startSampling(Time samplingInterval) { return false; }
+void Platform::stopSampling() {}
+
+bool Platform::startSamplingCurrentThread() { return false; }
+void Platform::stopSamplingCurrentThread() {}
+
+Uptr Platform::readSamples(const std::function<void(const CallStack&)>& visitSample) { return 0; }
@@ -1,4 +1,5 @@
 #include <stddef.h>
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <vector>
@@ -16,17 +17,21 @@ using namespace WAVM::Runtime;
 
 Runtime::Compartment::Compartment(std::string&& inDebugName,
 								  struct CompartmentRuntimeData* inRuntimeData,
-								  U8* inUnalignedRuntimeData)
+								  const CompartmentLimits& inLimits,
+								  Uptr inNumReservedBytes,
+								  Uptr inNumCommittedBytes)
 : GCObject(ObjectKind::compartment, this, std::move(inDebugName))
 , runtimeData(inRuntimeData)
-, unalignedRuntimeData(inUnalignedRuntimeData)
-, tables(0, maxTables - 1)
-, memories(0, maxMemories - 1)
+, limits(inLimits)
+, numReservedBytes(inNumReservedBytes)
+, numCommittedBytes(inNumCommittedBytes)
+, tables(0, limits.maxTables - 1)
+, memories(0, limits.maxMemories - 1)
 // Use UINTPTR_MAX as an invalid ID for globals, exception types, and instances.
 , globals(0, UINTPTR_MAX - 1)
 , exceptionTypes(0, UINTPTR_MAX - 1)
 , instances(0, UINTPTR_MAX - 1)
-, contexts(0, maxContexts - 1)
+, contexts(0, limits.maxContexts - 1)
 , foreigns(0, UINTPTR_MAX - 1)
 {
 	runtimeData->compartment = this;
@@ -44,47 +49,61 @@ Runtime::Compartment::~Compartment()
 	WAVM_ASSERT(!contexts.size());
 	WAVM_ASSERT(!foreigns.size());
 
-	Platform::freeAlignedVirtualPages(unalignedRuntimeData,
-									  compartmentReservedBytes >> Platform::getBytesPerPageLog2(),
-									  compartmentRuntimeDataAlignmentLog2);
-	Platform::deregisterVirtualAllocation(offsetof(CompartmentRuntimeData, contexts));
+	// Freeing the compartment's virtual address space also frees the pages that are still
+	// committed for unused contexts.
+	Platform::deregisterVirtualAllocation(freeContextIds.size() * sizeof(ContextRuntimeData));
+
+	Platform::freeVirtualPages((U8*)runtimeData,
+							   numReservedBytes >> Platform::getBytesPerPageLog2());
+	Platform::deregisterVirtualAllocation(numCommittedBytes);
 }
 
-static CompartmentRuntimeData* initCompartmentRuntimeData(U8*& outUnalignedRuntimeData)
+static Compartment* createCompartmentImpl(std::string&& debugName, CompartmentLimits limits)
 {
+	limits.maxContexts = std::min(limits.maxContexts, maxContexts);
+	limits.maxMemories = std::min(limits.maxMemories, maxMemories);
+	limits.maxTables = std::min(limits.maxTables, maxTables);
+	if(!limits.maxContexts || !limits.maxMemories || !limits.maxTables) { return nullptr; }
+
+	// Only reserve address space for the contexts allowed by the limits, and only commit the
+	// memory and table runtime data that is allowed by the limits. The JIT code finds the
+	// CompartmentRuntimeData through ContextRuntimeData::compartmentRuntimeData, so the reservation
+	// doesn't need any particular alignment.
+	const Uptr pageSizeLog2 = Platform::getBytesPerPageLog2();
+	const Uptr numNonContextBytes = offsetof(CompartmentRuntimeData, contexts);
+	const Uptr numReservedBytes
+		= numNonContextBytes + limits.maxContexts * sizeof(ContextRuntimeData);
+	const Uptr numUsedNonContextBytes
+		= offsetof(CompartmentRuntimeData, tables) + limits.maxTables * sizeof(TableRuntimeData);
+	const Uptr numCommittedBytes = std::min(
+		numNonContextBytes,
+		((numUsedNonContextBytes + (Uptr(1) << pageSizeLog2) - 1) >> pageSizeLog2) << pageSizeLog2);
+
 	CompartmentRuntimeData* runtimeData
-		= (CompartmentRuntimeData*)Platform::allocateAlignedVirtualPages(
-			compartmentReservedBytes >> Platform::getBytesPerPageLog2(),
-			compartmentRuntimeDataAlignmentLog2,
-			outUnalignedRuntimeData);
+		= (CompartmentRuntimeData*)Platform::allocateVirtualPages(numReservedBytes >> pageSizeLog2);
+	if(!runtimeData) { return nullptr; }
 
-	WAVM_ERROR_UNLESS(Platform::commitVirtualPages(
-		(U8*)runtimeData,
-		offsetof(CompartmentRuntimeData, contexts) >> Platform::getBytesPerPageLog2()));
-	Platform::registerVirtualAllocation(offsetof(CompartmentRuntimeData, contexts));
+	if(!Platform::commitVirtualPages((U8*)runtimeData, numCommittedBytes >> pageSizeLog2))
+	{
+		Platform::freeVirtualPages((U8*)runtimeData, numReservedBytes >> pageSizeLog2);
+		return nullptr;
+	}
+	Platform::registerVirtualAllocation(numCommittedBytes);
 
-	return runtimeData;
+	return new Compartment(
+		std::move(debugName), runtimeData, limits, numReservedBytes, numCommittedBytes);
 }
 
-Compartment* Runtime::createCompartment(std::string&& debugName)
+Compartment* Runtime::createCompartment(std::string&& debugName, const CompartmentLimits& limits)
 {
-	U8* unalignedRuntimeData = nullptr;
-	CompartmentRuntimeData* runtimeData = initCompartmentRuntimeData(unalignedRuntimeData);
-	if(!runtimeData) { return nullptr; }
-
-	return new Compartment(std::move(debugName), runtimeData, unalignedRuntimeData);
+	return createCompartmentImpl(std::move(debugName), limits);
 }
 
 Compartment* Runtime::cloneCompartment(const Compartment* compartment, std::string&& debugName)
 {
 	Timing::Timer timer;
 
-	U8* unalignedRuntimeData = nullptr;
-	CompartmentRuntimeData* runtimeData = initCompartmentRuntimeData(unalignedRuntimeData);
-	if(!runtimeData) { return nullptr; }
-
-	Compartment* newCompartment
-		= new Compartment(std::move(debugName), runtimeData, unalignedRuntimeData);
+	Compartment* newCompartment = createCompartmentImpl(std::move(debugName), compartment->limits);
 	if(!newCompartment) { goto error; }
 	else
 	{
@@ -108,9 +127,10 @@ Compartment* Runtime::cloneCompartment(const Compartment* compartment, std::stri
 
 		// Clone globals.
 		newCompartment->globalDataAllocationMask = compartment->globalDataAllocationMask;
+		newCompartment->numLiveMutableGlobals = compartment->numLiveMutableGlobals;
 		memcpy(newCompartment->initialContextMutableGlobals,
 			   compartment->initialContextMutableGlobals,
-			   sizeof(newCompartment->initialContextMutableGlobals));
+			   compartment->numLiveMutableGlobals * sizeof(IR::UntaggedValue));
 		for(Global* global : compartment->globals)
 		{
 			Global* newGlobal = cloneGlobal(global, newCompartment);
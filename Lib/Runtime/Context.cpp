@@ -12,6 +12,10 @@
 using namespace WAVM;
 using namespace WAVM::Runtime;
 
+// The maximum number of unused ContextRuntimeData slots that a compartment keeps committed for
+// reuse by createContext.
+static constexpr Uptr maxFreeContextsPerCompartment = 64;
+
 Context* Runtime::createContext(Compartment* compartment, std::string&& debugName)
 {
 	WAVM_ASSERT(compartment);
@@ -19,31 +23,49 @@ Context* Runtime::createContext(Compartment* compartment, std::string&& debugNam
 	{
 		Platform::RWMutex::ExclusiveLock lock(compartment->mutex);
 
-		// Allocate an ID for the context in the compartment.
-		context->id = compartment->contexts.add(UINTPTR_MAX, context);
-		if(context->id == UINTPTR_MAX)
+		if(compartment->freeContextIds.size())
 		{
-			delete context;
-			return nullptr;
+			// Reuse the committed runtime data of a context that was previously destroyed.
+			context->id = compartment->freeContextIds.back();
+			compartment->freeContextIds.pop_back();
+			compartment->contexts.insertOrFail(context->id, context);
+			context->runtimeData = &compartment->runtimeData->contexts[context->id];
 		}
-		context->runtimeData = &compartment->runtimeData->contexts[context->id];
-
-		// Commit the page(s) for the context's runtime data.
-		if(!Platform::commitVirtualPages(
-			   (U8*)context->runtimeData,
-			   sizeof(ContextRuntimeData) >> Platform::getBytesPerPageLog2()))
+		else
 		{
-			delete context;
-			return nullptr;
+			// Allocate an ID for the context in the compartment.
+			const Uptr id = compartment->contexts.add(UINTPTR_MAX, context);
+			if(id == UINTPTR_MAX)
+			{
+				delete context;
+				return nullptr;
+			}
+
+			// Commit the page(s) for the context's runtime data.
+			ContextRuntimeData* runtimeData = &compartment->runtimeData->contexts[id];
+			if(!Platform::commitVirtualPages(
+				   (U8*)runtimeData,
+				   sizeof(ContextRuntimeData) >> Platform::getBytesPerPageLog2()))
+			{
+				compartment->contexts.removeOrFail(id);
+				delete context;
+				return nullptr;
+			}
+			Platform::registerVirtualAllocation(sizeof(ContextRuntimeData));
+
+			context->id = id;
+			context->runtimeData = runtimeData;
 		}
-		Platform::registerVirtualAllocation(sizeof(ContextRuntimeData));
 
-		// Initialize the context's global data.
+		// Initialize the context's global data. Only the mutable globals that have been allocated
+		// in the compartment need to be initialized: the rest aren't accessed until they are
+		// allocated, at which point createGlobal initializes them in every context.
 		memcpy(context->runtimeData->mutableGlobals,
 			   compartment->initialContextMutableGlobals,
-			   maxMutableGlobals * sizeof(IR::UntaggedValue));
+			   compartment->numLiveMutableGlobals * sizeof(IR::UntaggedValue));
 
 		context->runtimeData->context = context;
+		context->runtimeData->compartmentRuntimeData = compartment->runtimeData;
 	}
 
 	return context;
@@ -52,11 +74,22 @@ Context* Runtime::createContext(Compartment* compartment, std::string&& debugNam
 Runtime::Context::~Context()
 {
 	WAVM_ASSERT_RWMUTEX_IS_EXCLUSIVELY_LOCKED_BY_CURRENT_THREAD(compartment->mutex);
-	if(id != UINTPTR_MAX) { compartment->contexts.removeOrFail(id); }
+	if(id != UINTPTR_MAX)
+	{
+		compartment->contexts.removeOrFail(id);
+		runtimeData->context = nullptr;
 
-	Platform::decommitVirtualPages((U8*)runtimeData,
-								   sizeof(ContextRuntimeData) >> Platform::getBytesPerPageLog2());
-	Platform::deregisterVirtualAllocation(sizeof(ContextRuntimeData));
+		// Keep the context's runtime data committed so it can be reused by the next context
+		// created in the compartment, unless there are already enough unused contexts.
+		if(compartment->freeContextIds.size() < maxFreeContextsPerCompartment)
+		{ compartment->freeContextIds.push_back(id); }
+		else
+		{
+			Platform::decommitVirtualPages(
+				(U8*)runtimeData, sizeof(ContextRuntimeData) >> Platform::getBytesPerPageLog2());
+			Platform::deregisterVirtualAllocation(sizeof(ContextRuntimeData));
+		}
+	}
 }
 
 Compartment* Runtime::getCompartment(const Context* context) { return context->compartment; }
@@ -69,7 +102,7 @@ Context* Runtime::cloneContext(const Context* context, Compartment* newCompartme
 	{
 		memcpy(clonedContext->runtimeData->mutableGlobals,
 			   context->runtimeData->mutableGlobals,
-			   maxMutableGlobals * sizeof(IR::UntaggedValue));
+			   newCompartment->numLiveMutableGlobals * sizeof(IR::UntaggedValue));
 	}
 	return clonedContext;
 }
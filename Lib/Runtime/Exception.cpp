@@ -11,6 +11,7 @@
 #include "WAVM/Inline/Errors.h"
 #include "WAVM/Inline/HashSet.h"
 #include "WAVM/LLVMJIT/LLVMJIT.h"
+#include "WAVM/Metrics/Metrics.h"
 #include "WAVM/Platform/Diagnostics.h"
 #include "WAVM/Platform/RWMutex.h"
 #include "WAVM/Platform/Signal.h"
@@ -177,6 +178,13 @@ Exception* Runtime::createException(ExceptionType* type,
 	WAVM_ASSERT(numArguments == params.size());
 
 	const bool isUserException = type->compartment != nullptr;
+	if(!isUserException && Metrics::isEnabled())
+	{
+		Metrics::getCounter(
+			"wavm_traps_total", "Number of traps, by type.", "type", type->debugName.c_str())
+			.add();
+	}
+
 	Exception* exception = new(malloc(Exception::calcNumBytes(params.size())))
 		Exception(type->id, type, isUserException, std::move(callStack));
 	if(params.size())
@@ -275,13 +283,14 @@ std::string Runtime::describeException(const Exception* exception)
 		createException(type, arguments.data(), arguments.size(), Platform::captureCallStack(1)));
 }
 
-WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsicsException,
-							   "createException",
-							   Uptr,
-							   intrinsicCreateException,
-							   Uptr exceptionTypeId,
-							   Uptr argsBits,
-							   U32 isUserException)
+WAVM_DEFINE_INTRINSIC_FUNCTION_WITH_FLAGS(wavmIntrinsicsException,
+										  "createException",
+										  Intrinsics::FunctionFlags::noThrow,
+										  Uptr,
+										  intrinsicCreateException,
+										  Uptr exceptionTypeId,
+										  Uptr argsBits,
+										  U32 isUserException)
 {
 	ExceptionType* exceptionType;
 	{
@@ -297,11 +306,12 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsicsException,
 	return reinterpret_cast<Uptr>(exception);
 }
 
-WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsicsException,
-							   "destroyException",
-							   void,
-							   intrinsicDestroyException,
-							   Uptr exceptionBits)
+WAVM_DEFINE_INTRINSIC_FUNCTION_WITH_FLAGS(wavmIntrinsicsException,
+										  "destroyException",
+										  Intrinsics::FunctionFlags::noThrow,
+										  void,
+										  intrinsicDestroyException,
+										  Uptr exceptionBits)
 {
 	Exception* exception = reinterpret_cast<Exception*>(exceptionBits);
 	destroyException(exception);
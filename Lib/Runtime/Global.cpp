@@ -26,6 +26,8 @@ Global* Runtime::createGlobal(Compartment* compartment,
 		mutableGlobalIndex = compartment->globalDataAllocationMask.getSmallestNonMember();
 		if(mutableGlobalIndex == maxMutableGlobals) { return nullptr; }
 		compartment->globalDataAllocationMask.add(mutableGlobalIndex);
+		if(mutableGlobalIndex >= compartment->numLiveMutableGlobals)
+		{ compartment->numLiveMutableGlobals = mutableGlobalIndex + 1; }
 
 		// Zero-initialize the global's mutable value for all current and future contexts.
 		compartment->initialContextMutableGlobals[mutableGlobalIndex] = IR::UntaggedValue();
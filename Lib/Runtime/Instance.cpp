@@ -7,12 +7,15 @@
 #include "WAVM/IR/Value.h"
 #include "WAVM/Inline/Assert.h"
 #include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Errors.h"
 #include "WAVM/Inline/Hash.h"
 #include "WAVM/Inline/HashMap.h"
 #include "WAVM/Inline/Timing.h"
 #include "WAVM/LLVMJIT/LLVMJIT.h"
+#include "WAVM/Metrics/Metrics.h"
 #include "WAVM/Platform/Intrinsic.h"
 #include "WAVM/Platform/RWMutex.h"
+#include "WAVM/Runtime/Intrinsics.h"
 #include "WAVM/Runtime/Runtime.h"
 #include "WAVM/WASM/WASM.h"
 
@@ -69,11 +72,57 @@ Instance::~Instance()
 	}
 }
 
-Instance* Runtime::instantiateModule(Compartment* compartment,
-									 ModuleConstRefParam module,
-									 ImportBindings&& imports,
-									 std::string&& moduleDebugName,
-									 ResourceQuotaRefParam resourceQuota)
+static const HashMap<std::string, LLVMJIT::FunctionBinding>& getWAVMIntrinsicsExportMap()
+{
+	// The symbols the LLVMJIT object code imports from the WAVM intrinsics are the same for every
+	// instance, so only look them up once.
+	static const HashMap<std::string, LLVMJIT::FunctionBinding> wavmIntrinsicsExportMap = [] {
+		HashMap<std::string, LLVMJIT::FunctionBinding> result;
+		for(const HashMapPair<std::string, Intrinsics::Function*>& intrinsicFunctionPair :
+			Intrinsics::getUninstantiatedFunctions(
+				{WAVM_INTRINSIC_MODULE_REF(wavmIntrinsics),
+				 WAVM_INTRINSIC_MODULE_REF(wavmIntrinsicsAtomics),
+				 WAVM_INTRINSIC_MODULE_REF(wavmIntrinsicsException),
+				 WAVM_INTRINSIC_MODULE_REF(wavmIntrinsicsMemory),
+				 WAVM_INTRINSIC_MODULE_REF(wavmIntrinsicsTable)}))
+		{
+			// The compiled code's calls to the intrinsic must agree with how it is defined.
+			const Intrinsics::Function* intrinsicFunction = intrinsicFunctionPair.value;
+			if(intrinsicFunction->getFlags()
+			   != LLVMJIT::getIntrinsicFunctionFlags(intrinsicFunction->getName()))
+			{
+				Errors::fatalf("Intrinsic function %s is defined with different flags than LLVMJIT "
+							   "calls it with",
+							   intrinsicFunction->getName());
+			}
+
+			LLVMJIT::FunctionBinding functionBinding{intrinsicFunction->getNativeFunction()};
+			result.add(intrinsicFunctionPair.key, functionBinding);
+		}
+		return result;
+	}();
+	return wavmIntrinsicsExportMap;
+}
+
+// Evaluates the base offset of an active segment if it doesn't depend on a global defined by the
+// module, and so is the same for every instance with the same imports.
+static bool tryEvaluateConstantBaseOffset(const std::vector<Global*>& globalImports,
+										  InitializerExpression baseOffset,
+										  IndexType indexType,
+										  Uptr& outBaseOffset)
+{
+	if(baseOffset.type == InitializerExpression::Type::global_get
+	   && baseOffset.ref >= globalImports.size())
+	{ return false; }
+
+	outBaseOffset = getIndexValue(evaluateInitializer(globalImports, baseOffset), indexType);
+	return true;
+}
+
+InstantiationTemplateRef Runtime::createInstantiationTemplate(Compartment* compartment,
+															  ModuleConstRefParam module,
+															  ImportBindings&& imports,
+															  std::string&& debugName)
 {
 	// Check the types of the Instance's imports, and build per-kind import arrays.
 	std::vector<FunctionImportBinding> functionImports;
@@ -135,15 +184,178 @@ Instance* Runtime::instantiateModule(Compartment* compartment,
 		};
 	}
 
-	return instantiateModuleInternal(compartment,
-									 module,
-									 std::move(functionImports),
-									 std::move(tableImports),
-									 std::move(memoryImports),
-									 std::move(globalImports),
-									 std::move(exceptionTypeImports),
-									 std::move(moduleDebugName),
-									 resourceQuota);
+	return createInstantiationTemplateInternal(compartment,
+											   module,
+											   std::move(functionImports),
+											   std::move(tableImports),
+											   std::move(memoryImports),
+											   std::move(globalImports),
+											   std::move(exceptionTypeImports),
+											   std::move(debugName));
+}
+
+std::shared_ptr<InstantiationTemplate> Runtime::createInstantiationTemplateInternal(
+	Compartment* compartment,
+	ModuleConstRefParam module,
+	std::vector<FunctionImportBinding>&& functionImports,
+	std::vector<Table*>&& tableImports,
+	std::vector<Memory*>&& memoryImports,
+	std::vector<Global*>&& globalImports,
+	std::vector<ExceptionType*>&& exceptionTypeImports,
+	std::string&& debugName)
+{
+	WAVM_ASSERT(functionImports.size() == module->ir.functions.imports.size());
+	WAVM_ASSERT(tableImports.size() == module->ir.tables.imports.size());
+	WAVM_ASSERT(memoryImports.size() == module->ir.memories.imports.size());
+	WAVM_ASSERT(globalImports.size() == module->ir.globals.imports.size());
+	WAVM_ASSERT(exceptionTypeImports.size() == module->ir.exceptionTypes.imports.size());
+
+	std::shared_ptr<InstantiationTemplate> result = std::make_shared<InstantiationTemplate>();
+	result->compartment = compartment;
+	result->module = module;
+	result->debugName = std::move(debugName);
+
+	// Bind the function imports to the symbols in the LLVMJIT object code.
+	for(Uptr importIndex = 0; importIndex < module->ir.functions.imports.size(); ++importIndex)
+	{
+		const FunctionType functionType
+			= module->ir.types[module->ir.functions.imports[importIndex].type.index];
+		if(functionType.callingConvention() == CallingConvention::wasm)
+		{
+			Function* function = functionImports[importIndex].wasmFunction;
+			result->importedFunctions.push_back(function);
+			result->jitFunctionImports.push_back({function->code});
+			result->importRoots.push_back(asObject(function));
+		}
+		else
+		{
+			result->importedFunctions.push_back(nullptr);
+			result->jitFunctionImports.push_back({functionImports[importIndex].nativeFunction});
+		}
+	}
+	for(Table* table : tableImports) { result->importRoots.push_back(asObject(table)); }
+	for(Memory* memory : memoryImports) { result->importRoots.push_back(asObject(memory)); }
+	for(Global* global : globalImports) { result->importRoots.push_back(asObject(global)); }
+	for(ExceptionType* exceptionType : exceptionTypeImports)
+	{ result->importRoots.push_back(asObject(exceptionType)); }
+
+	// Deserialize the disassembly names.
+	DisassemblyNames disassemblyNames;
+	getDisassemblyNames(module->ir, disassemblyNames);
+
+	for(Uptr functionDefIndex = 0; functionDefIndex < module->ir.functions.defs.size();
+		++functionDefIndex)
+	{
+		std::string functionDebugName
+			= disassemblyNames.functions[module->ir.functions.imports.size() + functionDefIndex]
+				  .name;
+		if(!functionDebugName.size())
+		{ functionDebugName = "<function #" + std::to_string(functionDefIndex) + ">"; }
+		result->functionDefDebugNames.push_back("wasm!" + result->debugName + '!'
+												+ functionDebugName);
+	}
+	for(Uptr tableDefIndex = 0; tableDefIndex < module->ir.tables.defs.size(); ++tableDefIndex)
+	{
+		result->tableDefDebugNames.push_back(
+			disassemblyNames.tables[module->ir.tables.imports.size() + tableDefIndex]);
+	}
+	for(Uptr memoryDefIndex = 0; memoryDefIndex < module->ir.memories.defs.size(); ++memoryDefIndex)
+	{
+		result->memoryDefDebugNames.push_back(
+			disassemblyNames.memories[module->ir.memories.imports.size() + memoryDefIndex]);
+	}
+	for(Uptr globalDefIndex = 0; globalDefIndex < module->ir.globals.defs.size(); ++globalDefIndex)
+	{
+		result->globalDefDebugNames.push_back(
+			disassemblyNames.globals[module->ir.globals.imports.size() + globalDefIndex]);
+	}
+	for(Uptr exceptionTypeDefIndex = 0;
+		exceptionTypeDefIndex < module->ir.exceptionTypes.defs.size();
+		++exceptionTypeDefIndex)
+	{
+		result->exceptionTypeDefDebugNames.push_back(
+			disassemblyNames
+				.exceptionTypes[module->ir.exceptionTypes.imports.size() + exceptionTypeDefIndex]);
+	}
+
+	// Build the map from export names to export indices.
+	HashMap<std::string, Uptr> exportIndexMap;
+	for(Uptr exportIndex = 0; exportIndex < module->ir.exports.size(); ++exportIndex)
+	{ exportIndexMap.addOrFail(module->ir.exports[exportIndex].name, exportIndex); }
+	result->exportIndexMap
+		= std::make_shared<const HashMap<std::string, Uptr>>(std::move(exportIndexMap));
+
+	// Lay out the module's data and elem segments: passive segments are copied into each Instance
+	// for later use, and active segments are copied into their memory or table when instantiated.
+	for(Uptr segmentIndex = 0; segmentIndex < module->ir.dataSegments.size(); ++segmentIndex)
+	{
+		const DataSegment& dataSegment = module->ir.dataSegments[segmentIndex];
+		if(!dataSegment.isActive)
+		{
+			result->passiveDataSegments.push_back(dataSegment.data);
+			continue;
+		}
+
+		result->passiveDataSegments.push_back(nullptr);
+
+		InstantiationTemplate::ActiveSegment activeSegment;
+		activeSegment.segmentIndex = segmentIndex;
+		activeSegment.baseOffset = 0;
+		activeSegment.hasConstantBaseOffset = tryEvaluateConstantBaseOffset(
+			globalImports,
+			dataSegment.baseOffset,
+			module->ir.memories.getType(dataSegment.memoryIndex).indexType,
+			activeSegment.baseOffset);
+		activeSegment.numElements = dataSegment.data->size();
+		result->activeDataSegments.push_back(activeSegment);
+	}
+	for(Uptr segmentIndex = 0; segmentIndex < module->ir.elemSegments.size(); ++segmentIndex)
+	{
+		const ElemSegment& elemSegment = module->ir.elemSegments[segmentIndex];
+		result->passiveElemSegments.push_back(
+			elemSegment.type == ElemSegment::Type::passive ? elemSegment.contents : nullptr);
+		if(elemSegment.type != ElemSegment::Type::active) { continue; }
+
+		InstantiationTemplate::ActiveSegment activeSegment;
+		activeSegment.segmentIndex = segmentIndex;
+		activeSegment.baseOffset = 0;
+		activeSegment.hasConstantBaseOffset = tryEvaluateConstantBaseOffset(
+			globalImports,
+			elemSegment.baseOffset,
+			module->ir.tables.getType(elemSegment.tableIndex).indexType,
+			activeSegment.baseOffset);
+		switch(elemSegment.contents->encoding)
+		{
+		case ElemSegment::Encoding::expr:
+			activeSegment.numElements = elemSegment.contents->elemExprs.size();
+			break;
+		case ElemSegment::Encoding::index:
+			activeSegment.numElements = elemSegment.contents->elemIndices.size();
+			break;
+		default: WAVM_UNREACHABLE();
+		};
+		result->activeElemSegments.push_back(activeSegment);
+	}
+
+	result->functionImports = std::move(functionImports);
+	result->tableImports = std::move(tableImports);
+	result->memoryImports = std::move(memoryImports);
+	result->globalImports = std::move(globalImports);
+	result->exceptionTypeImports = std::move(exceptionTypeImports);
+
+	return result;
+}
+
+Instance* Runtime::instantiateModule(Compartment* compartment,
+									 ModuleConstRefParam module,
+									 ImportBindings&& imports,
+									 std::string&& moduleDebugName,
+									 ResourceQuotaRefParam resourceQuota)
+{
+	return instantiateModule(
+		createInstantiationTemplate(
+			compartment, module, std::move(imports), std::move(moduleDebugName)),
+		resourceQuota);
 }
 
 Instance* Runtime::instantiateModuleInternal(Compartment* compartment,
@@ -156,11 +368,29 @@ Instance* Runtime::instantiateModuleInternal(Compartment* compartment,
 											 std::string&& moduleDebugName,
 											 ResourceQuotaRefParam resourceQuota)
 {
-	WAVM_ASSERT(functionImports.size() == module->ir.functions.imports.size());
-	WAVM_ASSERT(tables.size() == module->ir.tables.imports.size());
-	WAVM_ASSERT(memories.size() == module->ir.memories.imports.size());
-	WAVM_ASSERT(globals.size() == module->ir.globals.imports.size());
-	WAVM_ASSERT(exceptionTypes.size() == module->ir.exceptionTypes.imports.size());
+	return instantiateModule(createInstantiationTemplateInternal(compartment,
+																 module,
+																 std::move(functionImports),
+																 std::move(tables),
+																 std::move(memories),
+																 std::move(globals),
+																 std::move(exceptionTypes),
+																 std::move(moduleDebugName)),
+							 resourceQuota);
+}
+
+Instance* Runtime::instantiateModule(InstantiationTemplateRefParam instantiationTemplate,
+									 ResourceQuotaRefParam resourceQuota)
+{
+	static Metrics::Histogram& instantiateDurationHistogram
+		= Metrics::getHistogram("wavm_instantiate_duration_seconds",
+								"Time spent instantiating modules, excluding start functions.",
+								Metrics::Unit::nanoseconds);
+	Metrics::Timer instantiateMetricsTimer(instantiateDurationHistogram);
+
+	const InstantiationTemplate& templ = *instantiationTemplate;
+	Compartment* compartment = templ.compartment;
+	const IR::Module& irModule = templ.module->ir;
 
 	Uptr id = UINTPTR_MAX;
 	{
@@ -169,19 +399,14 @@ Instance* Runtime::instantiateModuleInternal(Compartment* compartment,
 	}
 	if(id == UINTPTR_MAX) { return nullptr; }
 
-	// Deserialize the disassembly names.
-	DisassemblyNames disassemblyNames;
-	getDisassemblyNames(module->ir, disassemblyNames);
-
 	// Instantiate the module's memory and table definitions.
-	for(Uptr tableDefIndex = 0; tableDefIndex < module->ir.tables.defs.size(); ++tableDefIndex)
+	std::vector<Table*> tables = templ.tableImports;
+	for(Uptr tableDefIndex = 0; tableDefIndex < irModule.tables.defs.size(); ++tableDefIndex)
 	{
-		std::string debugName
-			= disassemblyNames.tables[module->ir.tables.imports.size() + tableDefIndex];
 		auto table = createTable(compartment,
-								 module->ir.tables.defs[tableDefIndex].type,
+								 irModule.tables.defs[tableDefIndex].type,
 								 nullptr,
-								 std::move(debugName),
+								 std::string(templ.tableDefDebugNames[tableDefIndex]),
 								 resourceQuota);
 		if(!table)
 		{
@@ -191,13 +416,12 @@ Instance* Runtime::instantiateModuleInternal(Compartment* compartment,
 		}
 		tables.push_back(table);
 	}
-	for(Uptr memoryDefIndex = 0; memoryDefIndex < module->ir.memories.defs.size(); ++memoryDefIndex)
+	std::vector<Memory*> memories = templ.memoryImports;
+	for(Uptr memoryDefIndex = 0; memoryDefIndex < irModule.memories.defs.size(); ++memoryDefIndex)
 	{
-		std::string debugName
-			= disassemblyNames.memories[module->ir.memories.imports.size() + memoryDefIndex];
 		auto memory = createMemory(compartment,
-								   module->ir.memories.defs[memoryDefIndex].type,
-								   std::move(debugName),
+								   irModule.memories.defs[memoryDefIndex].type,
+								   std::string(templ.memoryDefDebugNames[memoryDefIndex]),
 								   resourceQuota);
 		if(!memory)
 		{
@@ -209,13 +433,14 @@ Instance* Runtime::instantiateModuleInternal(Compartment* compartment,
 	}
 
 	// Instantiate the module's global definitions.
-	for(Uptr globalDefIndex = 0; globalDefIndex < module->ir.globals.defs.size(); ++globalDefIndex)
+	std::vector<Global*> globals = templ.globalImports;
+	for(Uptr globalDefIndex = 0; globalDefIndex < irModule.globals.defs.size(); ++globalDefIndex)
 	{
-		std::string debugName
-			= disassemblyNames.globals[module->ir.globals.imports.size() + globalDefIndex];
-		const GlobalDef& globalDef = module->ir.globals.defs[globalDefIndex];
-		Global* global
-			= createGlobal(compartment, globalDef.type, std::move(debugName), resourceQuota);
+		const GlobalDef& globalDef = irModule.globals.defs[globalDefIndex];
+		Global* global = createGlobal(compartment,
+									  globalDef.type,
+									  std::string(templ.globalDefDebugNames[globalDefIndex]),
+									  resourceQuota);
 		globals.push_back(global);
 
 		// Defer evaluation of globals with (ref.func ...) initializers until the module's code is
@@ -229,49 +454,20 @@ Instance* Runtime::instantiateModuleInternal(Compartment* compartment,
 	}
 
 	// Instantiate the module's exception types.
-	for(Uptr exceptionTypeDefIndex = 0;
-		exceptionTypeDefIndex < module->ir.exceptionTypes.defs.size();
+	std::vector<ExceptionType*> exceptionTypes = templ.exceptionTypeImports;
+	for(Uptr exceptionTypeDefIndex = 0; exceptionTypeDefIndex < irModule.exceptionTypes.defs.size();
 		++exceptionTypeDefIndex)
 	{
 		const ExceptionTypeDef& exceptionTypeDef
-			= module->ir.exceptionTypes.defs[exceptionTypeDefIndex];
-		std::string debugName
-			= disassemblyNames
-				  .exceptionTypes[module->ir.exceptionTypes.imports.size() + exceptionTypeDefIndex];
-		exceptionTypes.push_back(
-			createExceptionType(compartment, exceptionTypeDef.type, std::move(debugName)));
+			= irModule.exceptionTypes.defs[exceptionTypeDefIndex];
+		exceptionTypes.push_back(createExceptionType(
+			compartment,
+			exceptionTypeDef.type,
+			std::string(templ.exceptionTypeDefDebugNames[exceptionTypeDefIndex])));
 	}
 
 	// Set up the values to bind to the symbols in the LLVMJIT object code.
-	HashMap<std::string, LLVMJIT::FunctionBinding> wavmIntrinsicsExportMap;
-	for(const HashMapPair<std::string, Intrinsics::Function*>& intrinsicFunctionPair :
-		Intrinsics::getUninstantiatedFunctions({WAVM_INTRINSIC_MODULE_REF(wavmIntrinsics),
-												WAVM_INTRINSIC_MODULE_REF(wavmIntrinsicsAtomics),
-												WAVM_INTRINSIC_MODULE_REF(wavmIntrinsicsException),
-												WAVM_INTRINSIC_MODULE_REF(wavmIntrinsicsMemory),
-												WAVM_INTRINSIC_MODULE_REF(wavmIntrinsicsTable)}))
-	{
-		LLVMJIT::FunctionBinding functionBinding{intrinsicFunctionPair.value->getNativeFunction()};
-		wavmIntrinsicsExportMap.add(intrinsicFunctionPair.key, functionBinding);
-	}
-
-	std::vector<Function*> functions;
-	std::vector<LLVMJIT::FunctionBinding> jitFunctionImports;
-	for(Uptr importIndex = 0; importIndex < module->ir.functions.imports.size(); ++importIndex)
-	{
-		const FunctionType functionType
-			= module->ir.types[module->ir.functions.imports[importIndex].type.index];
-		if(functionType.callingConvention() == CallingConvention::wasm)
-		{
-			functions.push_back(functionImports[importIndex].wasmFunction);
-			jitFunctionImports.push_back({functionImports[importIndex].wasmFunction->code});
-		}
-		else
-		{
-			functions.push_back(nullptr);
-			jitFunctionImports.push_back({functionImports[importIndex].nativeFunction});
-		}
-	}
+	std::vector<Function*> functions = templ.importedFunctions;
 
 	std::vector<LLVMJIT::TableBinding> jitTables;
 	for(Table* table : tables) { jitTables.push_back({table->id}); }
@@ -298,36 +494,25 @@ Instance* Runtime::instantiateModuleInternal(Compartment* compartment,
 
 	// Create a FunctionMutableData for each function definition.
 	std::vector<FunctionMutableData*> functionDefMutableDatas;
-	for(Uptr functionDefIndex = 0; functionDefIndex < module->ir.functions.defs.size();
-		++functionDefIndex)
-	{
-		std::string debugName
-			= disassemblyNames.functions[module->ir.functions.imports.size() + functionDefIndex]
-				  .name;
-		if(!debugName.size())
-		{ debugName = "<function #" + std::to_string(functionDefIndex) + ">"; }
-		debugName = "wasm!" + moduleDebugName + '!' + debugName;
-
-		functionDefMutableDatas.push_back(new FunctionMutableData(std::move(debugName)));
-	}
+	for(const std::string& debugName : templ.functionDefDebugNames)
+	{ functionDefMutableDatas.push_back(new FunctionMutableData(std::string(debugName))); }
 
 	// Load the compiled module's object code with this instance's imports.
-	std::vector<FunctionType> jitTypes = module->ir.types;
-	std::vector<Runtime::Function*> jitFunctionDefs;
-	jitFunctionDefs.resize(module->ir.functions.defs.size(), nullptr);
 	std::shared_ptr<LLVMJIT::Module> jitModule
-		= LLVMJIT::loadModule(module->objectCode,
-							  std::move(wavmIntrinsicsExportMap),
-							  std::move(jitTypes),
-							  std::move(jitFunctionImports),
+		= LLVMJIT::loadModule(templ.module->objectCode,
+							  getWAVMIntrinsicsExportMap(),
+							  irModule.types,
+							  templ.jitFunctionImports,
 							  std::move(jitTables),
 							  std::move(jitMemories),
 							  std::move(jitGlobals),
 							  std::move(jitExceptionTypes),
 							  {id},
 							  reinterpret_cast<Uptr>(getOutOfBoundsElement()),
+							  reinterpret_cast<Uptr>(getUninitializedElement())
+								  - reinterpret_cast<Uptr>(getOutOfBoundsElement()),
 							  functionDefMutableDatas,
-							  std::string(moduleDebugName));
+							  std::string(templ.debugName));
 
 	// LLVMJIT::loadModule filled in the functionDefMutableDatas' function pointers with the
 	// compiled functions. Add those functions to the module.
@@ -335,9 +520,8 @@ Instance* Runtime::instantiateModuleInternal(Compartment* compartment,
 	{ functions.push_back(functionMutableData->function); }
 
 	// Set up the instance's exports.
-	HashMap<std::string, Object*> exportMap;
 	std::vector<Object*> exports;
-	for(const Export& exportIt : module->ir.exports)
+	for(const Export& exportIt : irModule.exports)
 	{
 		Object* exportedObject = nullptr;
 		switch(exportIt.kind)
@@ -356,33 +540,22 @@ Instance* Runtime::instantiateModuleInternal(Compartment* compartment,
 		case IR::ExternKind::invalid:
 		default: WAVM_UNREACHABLE();
 		}
-		exportMap.addOrFail(exportIt.name, exportedObject);
 		exports.push_back(exportedObject);
 	}
 
-	// Copy the module's data and elem segments into the Instance for later use.
-	DataSegmentVector dataSegments;
-	ElemSegmentVector elemSegments;
-	for(const DataSegment& dataSegment : module->ir.dataSegments)
-	{ dataSegments.push_back(dataSegment.isActive ? nullptr : dataSegment.data); }
-	for(const ElemSegment& elemSegment : module->ir.elemSegments)
-	{
-		elemSegments.push_back(elemSegment.type == ElemSegment::Type::passive ? elemSegment.contents
-																			  : nullptr);
-	}
-
 	// Look up the module's start function.
 	Function* startFunction = nullptr;
-	if(module->ir.startFunctionIndex != UINTPTR_MAX)
+	if(irModule.startFunctionIndex != UINTPTR_MAX)
 	{
-		startFunction = functions[module->ir.startFunctionIndex];
+		startFunction = functions[irModule.startFunctionIndex];
 		WAVM_ASSERT(FunctionType(startFunction->encodedType) == FunctionType());
 	}
 
 	// Create the Instance and add it to the compartment's modules list.
+	std::shared_ptr<const HashMap<std::string, Uptr>> exportIndexMap = templ.exportIndexMap;
 	Instance* instance = new Instance(compartment,
 									  id,
-									  std::move(exportMap),
+									  std::move(exportIndexMap),
 									  std::move(exports),
 									  std::move(functions),
 									  std::move(tables),
@@ -390,10 +563,10 @@ Instance* Runtime::instantiateModuleInternal(Compartment* compartment,
 									  std::move(globals),
 									  std::move(exceptionTypes),
 									  startFunction,
-									  std::move(dataSegments),
-									  std::move(elemSegments),
+									  DataSegmentVector(templ.passiveDataSegments),
+									  ElemSegmentVector(templ.passiveElemSegments),
 									  std::move(jitModule),
-									  std::move(moduleDebugName),
+									  std::string(templ.debugName),
 									  resourceQuota);
 	{
 		Platform::RWMutex::ExclusiveLock compartmentLock(compartment->mutex);
@@ -402,73 +575,62 @@ Instance* Runtime::instantiateModuleInternal(Compartment* compartment,
 
 	// Initialize the globals with (ref.func ...) initializers that were deferred until after the
 	// Runtime::Function objects were loaded.
-	for(Uptr globalDefIndex = 0; globalDefIndex < module->ir.globals.defs.size(); ++globalDefIndex)
+	for(Uptr globalDefIndex = 0; globalDefIndex < irModule.globals.defs.size(); ++globalDefIndex)
 	{
-		const GlobalDef& globalDef = module->ir.globals.defs[globalDefIndex];
+		const GlobalDef& globalDef = irModule.globals.defs[globalDefIndex];
 		if(globalDef.initializer.type == InitializerExpression::Type::ref_func)
 		{
-			Global* global = instance->globals[module->ir.globals.imports.size() + globalDefIndex];
+			Global* global = instance->globals[irModule.globals.imports.size() + globalDefIndex];
 			initializeGlobal(global, instance->functions[globalDef.initializer.ref]);
 		}
 	}
 
-	// Copy the module's data segments into their designated memory instances.
-	for(Uptr segmentIndex = 0; segmentIndex < module->ir.dataSegments.size(); ++segmentIndex)
+	// Copy the module's active data segments into their designated memory instances.
+	for(const InstantiationTemplate::ActiveSegment& activeSegment : templ.activeDataSegments)
 	{
-		const DataSegment& dataSegment = module->ir.dataSegments[segmentIndex];
-		if(dataSegment.isActive)
-		{
-			WAVM_ASSERT(instance->dataSegments[segmentIndex] == nullptr);
+		const DataSegment& dataSegment = irModule.dataSegments[activeSegment.segmentIndex];
+		WAVM_ASSERT(instance->dataSegments[activeSegment.segmentIndex] == nullptr);
 
+		Uptr baseOffset = activeSegment.baseOffset;
+		if(!activeSegment.hasConstantBaseOffset)
+		{
 			const Value baseOffsetValue
 				= evaluateInitializer(instance->globals, dataSegment.baseOffset);
-			const MemoryType& memoryType = module->ir.memories.getType(dataSegment.memoryIndex);
-			Uptr baseOffset = getIndexValue(baseOffsetValue, memoryType.indexType);
-
-			initDataSegment(instance,
-							segmentIndex,
-							dataSegment.data.get(),
-							instance->memories[dataSegment.memoryIndex],
-							baseOffset,
-							0,
-							dataSegment.data->size());
+			const MemoryType& memoryType = irModule.memories.getType(dataSegment.memoryIndex);
+			baseOffset = getIndexValue(baseOffsetValue, memoryType.indexType);
 		}
+
+		initDataSegment(instance,
+						activeSegment.segmentIndex,
+						dataSegment.data.get(),
+						instance->memories[dataSegment.memoryIndex],
+						baseOffset,
+						0,
+						activeSegment.numElements);
 	}
 
-	// Copy the module's elem segments into their designated table instances.
-	for(Uptr segmentIndex = 0; segmentIndex < module->ir.elemSegments.size(); ++segmentIndex)
+	// Copy the module's active elem segments into their designated table instances.
+	for(const InstantiationTemplate::ActiveSegment& activeSegment : templ.activeElemSegments)
 	{
-		const ElemSegment& elemSegment = module->ir.elemSegments[segmentIndex];
-		if(elemSegment.type == ElemSegment::Type::active)
-		{
-			WAVM_ASSERT(instance->elemSegments[segmentIndex] == nullptr);
+		const ElemSegment& elemSegment = irModule.elemSegments[activeSegment.segmentIndex];
+		WAVM_ASSERT(instance->elemSegments[activeSegment.segmentIndex] == nullptr);
 
+		Uptr baseOffset = activeSegment.baseOffset;
+		if(!activeSegment.hasConstantBaseOffset)
+		{
 			const Value baseOffsetValue
 				= evaluateInitializer(instance->globals, elemSegment.baseOffset);
-			const TableType& tableType = module->ir.tables.getType(elemSegment.tableIndex);
-			Uptr baseOffset = getIndexValue(baseOffsetValue, tableType.indexType);
-
-			Uptr numElements = 0;
-			switch(elemSegment.contents->encoding)
-			{
-			case ElemSegment::Encoding::expr:
-				numElements = elemSegment.contents->elemExprs.size();
-				break;
-			case ElemSegment::Encoding::index:
-				numElements = elemSegment.contents->elemIndices.size();
-				break;
-			default: WAVM_UNREACHABLE();
-			};
-
-			Table* table = instance->tables[elemSegment.tableIndex];
-			initElemSegment(instance,
-							segmentIndex,
-							elemSegment.contents.get(),
-							table,
-							baseOffset,
-							0,
-							numElements);
+			const TableType& tableType = irModule.tables.getType(elemSegment.tableIndex);
+			baseOffset = getIndexValue(baseOffsetValue, tableType.indexType);
 		}
+
+		initElemSegment(instance,
+						activeSegment.segmentIndex,
+						elemSegment.contents.get(),
+						instance->tables[elemSegment.tableIndex],
+						baseOffset,
+						0,
+						activeSegment.numElements);
 	}
 
 	return instance;
@@ -477,9 +639,7 @@ Instance* Runtime::instantiateModuleInternal(Compartment* compartment,
 Instance* Runtime::cloneInstance(Instance* instance, Compartment* newCompartment)
 {
 	// Remap the module's references to the cloned compartment.
-	HashMap<std::string, Object*> newExportMap;
-	for(const auto& pair : instance->exportMap)
-	{ newExportMap.add(pair.key, remapToClonedCompartment(pair.value, newCompartment)); }
+	std::shared_ptr<const HashMap<std::string, Uptr>> exportIndexMap = instance->exportIndexMap;
 	std::vector<Object*> newExports;
 	for(Object* exportObject : instance->exports)
 	{ newExports.push_back(remapToClonedCompartment(exportObject, newCompartment)); }
@@ -520,7 +680,7 @@ Instance* Runtime::cloneInstance(Instance* instance, Compartment* newCompartment
 	std::shared_ptr<LLVMJIT::Module> jitModuleCopy = instance->jitModule;
 	Instance* newInstance = new Instance(newCompartment,
 										 instance->id,
-										 std::move(newExportMap),
+										 std::move(exportIndexMap),
 										 std::move(newExports),
 										 std::move(newFunctions),
 										 std::move(newTables),
@@ -552,31 +712,34 @@ Table* Runtime::getDefaultTable(const Instance* instance)
 	return instance->tables.size() ? instance->tables[0] : nullptr;
 }
 
-Object* Runtime::getInstanceExport(const Instance* instance, const std::string& name)
+static Object* getInstanceExportNullable(const Instance* instance, const std::string& name)
 {
 	WAVM_ASSERT(instance);
-	Object* const* exportedObjectPtr = instance->exportMap.get(name);
-	return exportedObjectPtr ? *exportedObjectPtr : nullptr;
+	const Uptr* exportIndex = instance->exportIndexMap->get(name);
+	return exportIndex ? instance->exports[*exportIndex] : nullptr;
+}
+
+Object* Runtime::getInstanceExport(const Instance* instance, const std::string& name)
+{
+	return getInstanceExportNullable(instance, name);
 }
 
 Object* Runtime::getTypedInstanceExport(const Instance* instance,
 										const std::string& name,
 										const IR::ExternType& type)
 {
-	WAVM_ASSERT(instance);
-	Object* const* exportedObjectPtr = instance->exportMap.get(name);
-	return exportedObjectPtr && isA(*exportedObjectPtr, type) ? *exportedObjectPtr : nullptr;
+	Object* exportedObject = getInstanceExportNullable(instance, name);
+	return exportedObject && isA(exportedObject, type) ? exportedObject : nullptr;
 }
 
 Function* Runtime::getTypedInstanceExport(const Instance* instance,
 										  const std::string& name,
 										  const IR::FunctionType& type)
 {
-	WAVM_ASSERT(instance);
-	Object* const* exportedObjectPtr = instance->exportMap.get(name);
-	return exportedObjectPtr && (*exportedObjectPtr)->kind == ObjectKind::function
-				   && FunctionType(asFunction(*exportedObjectPtr)->encodedType) == type
-			   ? asFunction(*exportedObjectPtr)
+	Object* exportedObject = getInstanceExportNullable(instance, name);
+	return exportedObject && exportedObject->kind == ObjectKind::function
+				   && FunctionType(asFunction(exportedObject)->encodedType) == type
+			   ? asFunction(exportedObject)
 			   : nullptr;
 }
 
@@ -584,11 +747,10 @@ Table* Runtime::getTypedInstanceExport(const Instance* instance,
 									   const std::string& name,
 									   const IR::TableType& type)
 {
-	WAVM_ASSERT(instance);
-	Object* const* exportedObjectPtr = instance->exportMap.get(name);
-	return exportedObjectPtr && (*exportedObjectPtr)->kind == ObjectKind::table
-				   && isSubtype(getTableType(asTable(*exportedObjectPtr)), type)
-			   ? asTable(*exportedObjectPtr)
+	Object* exportedObject = getInstanceExportNullable(instance, name);
+	return exportedObject && exportedObject->kind == ObjectKind::table
+				   && isSubtype(getTableType(asTable(exportedObject)), type)
+			   ? asTable(exportedObject)
 			   : nullptr;
 }
 
@@ -596,11 +758,10 @@ Memory* Runtime::getTypedInstanceExport(const Instance* instance,
 										const std::string& name,
 										const IR::MemoryType& type)
 {
-	WAVM_ASSERT(instance);
-	Object* const* exportedObjectPtr = instance->exportMap.get(name);
-	return exportedObjectPtr && (*exportedObjectPtr)->kind == ObjectKind::memory
-				   && isSubtype(getMemoryType(asMemory(*exportedObjectPtr)), type)
-			   ? asMemory(*exportedObjectPtr)
+	Object* exportedObject = getInstanceExportNullable(instance, name);
+	return exportedObject && exportedObject->kind == ObjectKind::memory
+				   && isSubtype(getMemoryType(asMemory(exportedObject)), type)
+			   ? asMemory(exportedObject)
 			   : nullptr;
 }
 
@@ -608,11 +769,10 @@ Global* Runtime::getTypedInstanceExport(const Instance* instance,
 										const std::string& name,
 										const IR::GlobalType& type)
 {
-	WAVM_ASSERT(instance);
-	Object* const* exportedObjectPtr = instance->exportMap.get(name);
-	return exportedObjectPtr && (*exportedObjectPtr)->kind == ObjectKind::global
-				   && isSubtype(asGlobal(*exportedObjectPtr)->type, type)
-			   ? asGlobal(*exportedObjectPtr)
+	Object* exportedObject = getInstanceExportNullable(instance, name);
+	return exportedObject && exportedObject->kind == ObjectKind::global
+				   && isSubtype(asGlobal(exportedObject)->type, type)
+			   ? asGlobal(exportedObject)
 			   : nullptr;
 }
 
@@ -620,11 +780,10 @@ Runtime::ExceptionType* Runtime::getTypedInstanceExport(const Instance* instance
 														const std::string& name,
 														const IR::ExceptionType& type)
 {
-	WAVM_ASSERT(instance);
-	Object* const* exportedObjectPtr = instance->exportMap.get(name);
-	return exportedObjectPtr && (*exportedObjectPtr)->kind == ObjectKind::function
-				   && isSubtype(asExceptionType(*exportedObjectPtr)->sig.params, type.params)
-			   ? asExceptionType(*exportedObjectPtr)
+	Object* exportedObject = getInstanceExportNullable(instance, name);
+	return exportedObject && exportedObject->kind == ObjectKind::function
+				   && isSubtype(asExceptionType(exportedObject)->sig.params, type.params)
+			   ? asExceptionType(exportedObject)
 			   : nullptr;
 }
 
@@ -44,8 +44,14 @@ static void initializeModule(Intrinsics::Module* moduleRef)
 Intrinsics::Function::Function(Intrinsics::Module* moduleRef,
 							   const char* inName,
 							   void* inNativeFunction,
-							   FunctionType inType)
-: name(inName), type(inType), nativeFunction(inNativeFunction)
+							   FunctionType inType,
+							   FunctionFlags inFlags)
+: name(inName)
+, type(inType)
+, nativeFunction(inNativeFunction)
+, hasEnv(false)
+, environment(0)
+, flags(inFlags)
 {
 	initializeModule(moduleRef);
 
@@ -54,6 +60,27 @@ Intrinsics::Function::Function(Intrinsics::Module* moduleRef,
 	moduleRef->impl->functionMap.set(name, this);
 }
 
+Intrinsics::Function::Function(Intrinsics::Module* moduleRef,
+							   const char* inName,
+							   void* inNativeFunction,
+							   FunctionType inType,
+							   U64 inEnvironment)
+: name(inName)
+, type(inType)
+, nativeFunction(inNativeFunction)
+, hasEnv(true)
+, environment(inEnvironment)
+, flags(FunctionFlags::none)
+{
+	WAVM_ERROR_UNLESS(type.params().size() >= 1 && type.params()[0] == ValueType::i64);
+
+	initializeModule(moduleRef);
+
+	if(moduleRef->impl->functionMap.contains(name))
+	{ Errors::fatalf("Intrinsic function already registered: %s", name); }
+	moduleRef->impl->functionMap.set(name, this);
+}
+
 Intrinsics::Global::Global(Intrinsics::Module* moduleRef,
 						   const char* inName,
 						   ValueType inType,
@@ -101,6 +128,7 @@ Instance* Intrinsics::instantiateModule(
 	DisassemblyNames names;
 
 	std::vector<FunctionImportBinding> functionImportBindings;
+	std::vector<const Intrinsics::Function*> importedFunctions;
 	for(const Intrinsics::Module* moduleRef : moduleRefs)
 	{
 		if(moduleRef->impl)
@@ -108,6 +136,7 @@ Instance* Intrinsics::instantiateModule(
 			for(const auto& pair : moduleRef->impl->functionMap)
 			{
 				functionImportBindings.push_back({pair.value->getNativeFunction()});
+				importedFunctions.push_back(pair.value);
 				const Uptr typeIndex = irModule.types.size();
 				const Uptr functionIndex = irModule.functions.size();
 				irModule.types.push_back(pair.value->getType());
@@ -183,17 +212,26 @@ Instance* Intrinsics::instantiateModule(
 		++functionImportIndex)
 	{
 		const FunctionImport& functionImport = irModule.functions.imports[functionImportIndex];
+		const Intrinsics::Function* intrinsicFunction = importedFunctions[functionImportIndex];
 		const FunctionType intrinsicFunctionType = irModule.types[functionImport.type.index];
-		const FunctionType wasmFunctionType(intrinsicFunctionType.results(),
-											intrinsicFunctionType.params(),
-											CallingConvention::wasm);
+
+		// If the intrinsic is bound to an environment, the thunk passes it as the first argument,
+		// so it isn't a parameter of the thunk.
+		const Uptr numBoundParams = intrinsicFunction->hasEnvironment() ? 1 : 0;
+		const TypeTuple intrinsicParams = intrinsicFunctionType.params();
+		const TypeTuple wasmParams(intrinsicParams.data() + numBoundParams,
+								   intrinsicParams.size() - numBoundParams);
+		const FunctionType wasmFunctionType(
+			intrinsicFunctionType.results(), wasmParams, CallingConvention::wasm);
 
 		const Uptr wasmFunctionTypeIndex = irModule.types.size();
 		irModule.types.push_back(wasmFunctionType);
 
 		Serialization::ArrayOutputStream codeStream;
 		OperatorEncoderStream opEncoder(codeStream);
-		for(Uptr paramIndex = 0; paramIndex < intrinsicFunctionType.params().size(); ++paramIndex)
+		if(intrinsicFunction->hasEnvironment())
+		{ opEncoder.i64_const({I64(intrinsicFunction->getEnvironment())}); }
+		for(Uptr paramIndex = 0; paramIndex < wasmParams.size(); ++paramIndex)
 		{ opEncoder.local_get({paramIndex}); }
 		opEncoder.call({functionImportIndex});
 		opEncoder.end();
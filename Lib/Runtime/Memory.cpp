@@ -11,6 +11,7 @@
 #include "WAVM/IR/Value.h"
 #include "WAVM/Inline/Assert.h"
 #include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Metrics/Metrics.h"
 #include "WAVM/Platform/Intrinsic.h"
 #include "WAVM/Platform/RWMutex.h"
 #include "WAVM/Runtime/Runtime.h"
@@ -269,6 +270,13 @@ GrowResult Runtime::growMemory(Memory* memory, Uptr numPagesToGrow, Uptr* outOld
 			memory->compartment->runtimeData->memories[memory->id].numPages.store(
 				newNumPages, std::memory_order_release);
 		}
+
+		static Metrics::Counter& numGrowsCounter = Metrics::getCounter(
+			"wavm_memory_grow_total", "Number of times a memory was successfully grown.");
+		static Metrics::Counter& numGrownBytesCounter = Metrics::getCounter(
+			"wavm_memory_grow_bytes_total", "Number of bytes that memories were grown by.");
+		numGrowsCounter.add();
+		numGrownBytesCounter.add(U64(numPagesToGrow) * IR::numBytesPerPage);
 	}
 
 	if(outOldNumPages) { *outOldNumPages = oldNumPages; }
@@ -355,12 +363,13 @@ void Runtime::initDataSegment(Instance* instance,
 	}
 }
 
-WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsicsMemory,
-							   "memory.grow",
-							   Iptr,
-							   memory_grow,
-							   Uptr deltaPages,
-							   Uptr memoryId)
+WAVM_DEFINE_INTRINSIC_FUNCTION_WITH_FLAGS(wavmIntrinsicsMemory,
+										  "memory.grow",
+										  Intrinsics::FunctionFlags::noThrow,
+										  Iptr,
+										  memory_grow,
+										  Uptr deltaPages,
+										  Uptr memoryId)
 {
 	Memory* memory = getMemoryFromRuntimeData(contextRuntimeData, memoryId);
 	Uptr oldNumPages = 0;
@@ -408,12 +417,13 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsicsMemory,
 	}
 }
 
-WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsicsMemory,
-							   "data.drop",
-							   void,
-							   data_drop,
-							   Uptr instanceId,
-							   Uptr dataSegmentIndex)
+WAVM_DEFINE_INTRINSIC_FUNCTION_WITH_FLAGS(wavmIntrinsicsMemory,
+										  "data.drop",
+										  Intrinsics::FunctionFlags::noThrow,
+										  void,
+										  data_drop,
+										  Uptr instanceId,
+										  Uptr dataSegmentIndex)
 {
 	Instance* instance = getInstanceFromRuntimeData(contextRuntimeData, instanceId);
 	Platform::RWMutex::ExclusiveLock dataSegmentsLock(instance->dataSegmentsMutex);
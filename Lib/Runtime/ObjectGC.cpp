@@ -9,6 +9,7 @@
 #include "WAVM/Inline/HashSet.h"
 #include "WAVM/Inline/Timing.h"
 #include "WAVM/Logging/Logging.h"
+#include "WAVM/Metrics/Metrics.h"
 #include "WAVM/Platform/RWMutex.h"
 #include "WAVM/Runtime/Runtime.h"
 
@@ -179,6 +180,12 @@ struct GCState
 
 static bool collectGarbageImpl(Compartment* compartment)
 {
+	static Metrics::Histogram& pauseDurationHistogram
+		= Metrics::getHistogram("wavm_gc_pause_duration_seconds",
+								"Time spent collecting a compartment's garbage.",
+								Metrics::Unit::nanoseconds);
+	Metrics::Timer pauseMetricsTimer(pauseDurationHistogram);
+
 	Platform::RWMutex::ExclusiveLock compartmentLock(compartment->mutex);
 	Timing::Timer timer;
 
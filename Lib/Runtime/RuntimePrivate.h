@@ -79,6 +79,10 @@ namespace WAVM { namespace Runtime {
 	// at the end of the array will, when re-adding this Function's address, point to this Object.
 	extern Object* getOutOfBoundsElement();
 
+	// This is used as a sentinel value for null table elements, so that the out-of-bounds sentinel
+	// can be distinguished from null by comparing the biased value stored in the table to zero.
+	extern Object* getUninitializedElement();
+
 	// An instance of a WebAssembly Memory.
 	struct Memory : GCObject
 	{
@@ -172,7 +176,9 @@ namespace WAVM { namespace Runtime {
 	{
 		const Uptr id;
 
-		const HashMap<std::string, Object*> exportMap;
+		// Maps export names to indices in exports. Shared by all instances of the same
+		// InstantiationTemplate.
+		const std::shared_ptr<const HashMap<std::string, Uptr>> exportIndexMap;
 		const std::vector<Object*> exports;
 
 		const std::vector<Function*> functions;
@@ -195,7 +201,7 @@ namespace WAVM { namespace Runtime {
 
 		Instance(Compartment* inCompartment,
 				 Uptr inID,
-				 HashMap<std::string, Object*>&& inExportMap,
+				 std::shared_ptr<const HashMap<std::string, Uptr>>&& inExportIndexMap,
 				 std::vector<Object*>&& inExports,
 				 std::vector<Function*>&& inFunctions,
 				 std::vector<Table*>&& inTables,
@@ -210,7 +216,7 @@ namespace WAVM { namespace Runtime {
 				 ResourceQuotaRefParam inResourceQuota)
 		: GCObject(ObjectKind::instance, inCompartment, std::move(inDebugName))
 		, id(inID)
-		, exportMap(std::move(inExportMap))
+		, exportIndexMap(std::move(inExportIndexMap))
 		, exports(std::move(inExports))
 		, functions(std::move(inFunctions))
 		, tables(std::move(inTables))
@@ -245,7 +251,9 @@ namespace WAVM { namespace Runtime {
 		mutable Platform::RWMutex mutex;
 
 		struct CompartmentRuntimeData* const runtimeData;
-		U8* const unalignedRuntimeData;
+		const CompartmentLimits limits;
+		const Uptr numReservedBytes;
+		const Uptr numCommittedBytes;
 
 		IndexMap<Uptr, Table*> tables;
 		IndexMap<Uptr, Memory*> memories;
@@ -258,9 +266,19 @@ namespace WAVM { namespace Runtime {
 		DenseStaticIntSet<U32, maxMutableGlobals> globalDataAllocationMask;
 		IR::UntaggedValue initialContextMutableGlobals[maxMutableGlobals];
 
+		// One greater than the highest mutable global index that has ever been allocated in this
+		// compartment. Contexts only need to initialize the mutable globals below this index.
+		Uptr numLiveMutableGlobals = 0;
+
+		// The IDs of ContextRuntimeData slots that aren't used by any context, but are still
+		// committed so they can be reused by createContext.
+		std::vector<Uptr> freeContextIds;
+
 		Compartment(std::string&& inDebugName,
 					struct CompartmentRuntimeData* inRuntimeData,
-					U8* inUnalignedRuntimeData);
+					const CompartmentLimits& inLimits,
+					Uptr inNumReservedBytes,
+					Uptr inNumCommittedBytes);
 		~Compartment();
 	};
 
@@ -392,6 +410,60 @@ namespace WAVM { namespace Runtime {
 										std::vector<ExceptionType*>&& exceptionTypeImports,
 										std::string&& debugName,
 										ResourceQuotaRefParam resourceQuota = ResourceQuotaRef());
+
+	// The parts of instantiating a module that are the same for every instance with the same
+	// imports.
+	struct InstantiationTemplate
+	{
+		// An active data or elem segment, and its base offset if it doesn't depend on a global
+		// defined by the instance.
+		struct ActiveSegment
+		{
+			Uptr segmentIndex;
+			bool hasConstantBaseOffset;
+			Uptr baseOffset;
+			Uptr numElements;
+		};
+
+		GCPointer<Compartment> compartment;
+		ModuleConstRef module;
+		std::string debugName;
+
+		std::vector<FunctionImportBinding> functionImports;
+		std::vector<Table*> tableImports;
+		std::vector<Memory*> memoryImports;
+		std::vector<Global*> globalImports;
+		std::vector<ExceptionType*> exceptionTypeImports;
+
+		// Keeps the imported objects alive as long as the template.
+		std::vector<GCPointer<Object>> importRoots;
+
+		std::vector<Function*> importedFunctions;
+		std::vector<LLVMJIT::FunctionBinding> jitFunctionImports;
+
+		std::vector<std::string> functionDefDebugNames;
+		std::vector<std::string> tableDefDebugNames;
+		std::vector<std::string> memoryDefDebugNames;
+		std::vector<std::string> globalDefDebugNames;
+		std::vector<std::string> exceptionTypeDefDebugNames;
+
+		std::shared_ptr<const HashMap<std::string, Uptr>> exportIndexMap;
+
+		DataSegmentVector passiveDataSegments;
+		ElemSegmentVector passiveElemSegments;
+		std::vector<ActiveSegment> activeDataSegments;
+		std::vector<ActiveSegment> activeElemSegments;
+	};
+
+	std::shared_ptr<InstantiationTemplate> createInstantiationTemplateInternal(
+		Compartment* compartment,
+		ModuleConstRefParam module,
+		std::vector<FunctionImportBinding>&& functionImports,
+		std::vector<Table*>&& tableImports,
+		std::vector<Memory*>&& memoryImports,
+		std::vector<Global*>&& globalImports,
+		std::vector<ExceptionType*>&& exceptionTypeImports,
+		std::string&& debugName);
 }}
 
 namespace WAVM { namespace Intrinsics {
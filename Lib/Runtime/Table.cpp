@@ -49,7 +49,7 @@ Object* Runtime::getOutOfBoundsElement()
 	return asObject(function);
 }
 
-static Object* getUninitializedElement()
+Object* Runtime::getUninitializedElement()
 {
 	static Function* function = makeDummyFunction("uninitialized table element");
 	return asObject(function);
@@ -65,6 +65,33 @@ static Object* biasedTableElementValueToObject(Uptr biasedValue)
 	return reinterpret_cast<Object*>(biasedValue + reinterpret_cast<Uptr>(getOutOfBoundsElement()));
 }
 
+// Checks that the range [offset, offset + numElements) is within the table's current bounds, and
+// throws an out-of-bounds exception if it isn't. Tables never shrink, so once a range is validated
+// it stays in bounds, and the elements in it may be accessed without checking for the
+// out-of-bounds sentinel value.
+static void validateTableRange(Table* table, Uptr offset, Uptr numElements)
+{
+	const Uptr tableNumElements = table->numElements.load(std::memory_order_acquire);
+	if(offset + numElements > tableNumElements || offset + numElements < offset)
+	{
+		throwException(ExceptionTypes::outOfBoundsTableAccess,
+					   {table, U64(offset > tableNumElements ? offset : tableNumElements)});
+	}
+}
+
+// Writes a biased value to a range of table elements that is known to be in bounds. Each element is
+// written with a single atomic store, so concurrent table.get/table.set observe whole elements.
+static void fillTableElementsInBounds(Table* table,
+									  Uptr offset,
+									  Uptr numElements,
+									  Uptr biasedValue,
+									  std::memory_order memoryOrder)
+{
+	Table::Element* elements = table->elements + offset;
+	for(Uptr index = 0; index < numElements; ++index)
+	{ elements[index].biasedValue.store(biasedValue, memoryOrder); }
+}
+
 static Table* createTableImpl(Compartment* compartment,
 							  IR::TableType type,
 							  std::string&& debugName,
@@ -147,17 +174,21 @@ static GrowResult growTableImpl(Table* table,
 
 		if(initializeNewElements)
 		{
-			// Write the uninitialized sentinel value to the new elements.
-			const Uptr biasedTableInitElement
-				= objectToBiasedTableElementValue(initializeToElement);
-			for(Uptr elementIndex = oldNumElements; elementIndex < newNumElements; ++elementIndex)
-			{
-				table->elements[elementIndex].biasedValue.store(biasedTableInitElement,
-																std::memory_order_release);
-			}
+			// Write the initial value to the new elements. The elements aren't visible to other
+			// threads until the release store to numElements below, so they may be written relaxed.
+			fillTableElementsInBounds(table,
+									  oldNumElements,
+									  numElementsToGrow,
+									  objectToBiasedTableElementValue(initializeToElement),
+									  std::memory_order_relaxed);
 		}
 
 		table->numElements.store(newNumElements, std::memory_order_release);
+		if(table->id != UINTPTR_MAX)
+		{
+			table->compartment->runtimeData->tables[table->id].numElements.store(
+				newNumElements, std::memory_order_release);
+		}
 	}
 
 	if(outOldNumElements) { *outOldNumElements = oldNumElements; }
@@ -200,6 +231,8 @@ Table* Runtime::createTable(Compartment* compartment,
 		}
 		compartment->runtimeData->tables[table->id].base = table->elements;
 		compartment->runtimeData->tables[table->id].endIndex = table->numReservedElements;
+		compartment->runtimeData->tables[table->id].numElements.store(
+			table->numElements.load(std::memory_order_acquire), std::memory_order_release);
 	}
 
 	return table;
@@ -243,6 +276,8 @@ Table* Runtime::cloneTable(Table* table, Compartment* newCompartment)
 		newCompartment->tables.insertOrFail(newTable->id, newTable);
 		newCompartment->runtimeData->tables[newTable->id].base = newTable->elements;
 		newCompartment->runtimeData->tables[newTable->id].endIndex = newTable->numReservedElements;
+		newCompartment->runtimeData->tables[newTable->id].numElements.store(
+			newTable->numElements.load(std::memory_order_acquire), std::memory_order_release);
 	}
 
 	return newTable;
@@ -260,6 +295,7 @@ Table::~Table()
 		WAVM_ASSERT(compartment->runtimeData->tables[id].base == elements);
 		compartment->runtimeData->tables[id].base = nullptr;
 		compartment->runtimeData->tables[id].endIndex = 0;
+		compartment->runtimeData->tables[id].numElements.store(0, std::memory_order_release);
 	}
 
 	// Remove the table from the global array.
@@ -443,15 +479,7 @@ void Runtime::initElemSegment(Instance* instance,
 						U64(elemSegmentIndex),
 						U64(sourceOffset > numSourceElems ? sourceOffset : numSourceElems)});
 	}
-	else
-	{
-		const Uptr numTableElems = getTableNumElements(table);
-		if(destOffset + numElems > numTableElems || destOffset + numElems < destOffset)
-		{
-			throwException(ExceptionTypes::outOfBoundsTableAccess,
-						   {table, U64(destOffset > numTableElems ? destOffset : numTableElems)});
-		}
-	}
+	validateTableRange(table, destOffset, numElems);
 
 	// Assert that the segment's elems are the right type for the table.
 	switch(contents->encoding)
@@ -466,17 +494,12 @@ void Runtime::initElemSegment(Instance* instance,
 	default: WAVM_UNREACHABLE();
 	};
 
+	// The source and destination ranges were validated above, so decode each element and store it
+	// directly to the table without any per-element bounds checks.
+	Table::Element* destElements = table->elements + destOffset;
 	for(Uptr index = 0; index < numElems; ++index)
 	{
-		Uptr sourceIndex = sourceOffset + index;
-		const Uptr destIndex = destOffset + index;
-
-		if(sourceIndex >= numSourceElems || sourceIndex < sourceOffset)
-		{
-			throwException(ExceptionTypes::outOfBoundsElemSegmentAccess,
-						   {asObject(instance), U64(elemSegmentIndex), sourceIndex});
-		}
-		sourceIndex = branchlessMin(sourceIndex, numSourceElems);
+		const Uptr sourceIndex = sourceOffset + index;
 
 		// Decode the element value.
 		Object* elemObject = nullptr;
@@ -486,7 +509,7 @@ void Runtime::initElemSegment(Instance* instance,
 			const IR::ElemExpr& elemExpr = contents->elemExprs[sourceIndex];
 			switch(elemExpr.type)
 			{
-			case IR::ElemExpr::Type::ref_null: elemObject = nullptr; break;
+			case IR::ElemExpr::Type::ref_null: elemObject = getUninitializedElement(); break;
 			case IR::ElemExpr::Type::ref_func:
 				elemObject = asObject(instance->functions[elemExpr.index]);
 				break;
@@ -522,17 +545,22 @@ void Runtime::initElemSegment(Instance* instance,
 		default: WAVM_UNREACHABLE();
 		};
 
-		setTableElement(table, destIndex, elemObject);
+		WAVM_ASSERT(elemObject);
+		WAVM_ASSERT(elemObject == getUninitializedElement()
+					|| isInCompartment(elemObject, table->compartment));
+		destElements[index].biasedValue.store(objectToBiasedTableElementValue(elemObject),
+											  std::memory_order_release);
 	}
 }
 
-WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsicsTable,
-							   "table.grow",
-							   Iptr,
-							   table_grow,
-							   Object* initialValue,
-							   Uptr deltaNumElements,
-							   Uptr tableId)
+WAVM_DEFINE_INTRINSIC_FUNCTION_WITH_FLAGS(wavmIntrinsicsTable,
+										  "table.grow",
+										  Intrinsics::FunctionFlags::noThrow,
+										  Iptr,
+										  table_grow,
+										  Object* initialValue,
+										  Uptr deltaNumElements,
+										  Uptr tableId)
 {
 	Table* table = getTableFromRuntimeData(contextRuntimeData, tableId);
 	Uptr oldNumElements = 0;
@@ -610,12 +638,13 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsicsTable,
 	}
 }
 
-WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsicsTable,
-							   "elem.drop",
-							   void,
-							   elem_drop,
-							   Uptr instanceId,
-							   Uptr elemSegmentIndex)
+WAVM_DEFINE_INTRINSIC_FUNCTION_WITH_FLAGS(wavmIntrinsicsTable,
+										  "elem.drop",
+										  Intrinsics::FunctionFlags::noThrow,
+										  void,
+										  elem_drop,
+										  Uptr instanceId,
+										  Uptr elemSegmentIndex)
 {
 	Instance* instance = getInstanceFromRuntimeData(contextRuntimeData, instanceId);
 	Platform::RWMutex::ExclusiveLock elemSegmentsLock(instance->elemSegmentsMutex);
@@ -638,52 +667,30 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsicsTable,
 		Table* destTable = getTableFromRuntimeData(contextRuntimeData, destTableId);
 		Table* sourceTable = getTableFromRuntimeData(contextRuntimeData, sourceTableId);
 
-		const Uptr destOffsetUptr = Uptr(destOffset);
-		const Uptr sourceOffsetUptr = Uptr(sourceOffset);
-		const Uptr numElementsUptr = Uptr(numElements);
-
-		const Uptr sourceTableNumElements = getTableNumElements(sourceTable);
-		if(sourceOffsetUptr + numElementsUptr > sourceTableNumElements
-		   || sourceOffsetUptr + numElementsUptr < sourceOffsetUptr)
-		{
-			const Uptr outOfBoundsSourceOffset = sourceOffsetUptr > sourceTableNumElements
-													 ? sourceOffsetUptr
-													 : sourceTableNumElements;
-			throwException(ExceptionTypes::outOfBoundsTableAccess,
-						   {sourceTable, outOfBoundsSourceOffset});
-		}
-
-		const Uptr destTableNumElements = getTableNumElements(destTable);
-		if(destOffsetUptr + numElementsUptr > destTableNumElements
-		   || destOffsetUptr + numElementsUptr < destOffsetUptr)
-		{
-			const Uptr outOfBoundsDestOffset
-				= destOffsetUptr > destTableNumElements ? destOffsetUptr : destTableNumElements;
-			throwException(ExceptionTypes::outOfBoundsTableAccess,
-						   {destTable, outOfBoundsDestOffset});
-		}
+		validateTableRange(sourceTable, sourceOffset, numElements);
+		validateTableRange(destTable, destOffset, numElements);
 
-		if(sourceOffset < destOffset)
+		// Both ranges are in bounds, so copy the biased element values directly.
+		const Table::Element* sourceElements = sourceTable->elements + sourceOffset;
+		Table::Element* destElements = destTable->elements + destOffset;
+		if(sourceElements < destElements)
 		{
-			// When copying to higher indices, copy the elements in descending order to ensure that
-			// source elements may only be overwritten after they have been copied.
-			for(Uptr index = 0; index < numElements; ++index)
+			// When copying to higher addresses, copy the elements in descending order to ensure
+			// that source elements may only be overwritten after they have been copied.
+			for(Uptr index = numElements; index > 0; --index)
 			{
-				setTableElementNonNull(
-					destTable,
-					U64(destOffset) + U64(numElements - index - 1),
-					getTableElementNonNull(sourceTable,
-										   U64(sourceOffset) + U64(numElements - index - 1)));
+				destElements[index - 1].biasedValue.store(
+					sourceElements[index - 1].biasedValue.load(std::memory_order_acquire),
+					std::memory_order_release);
 			}
 		}
 		else
 		{
 			for(Uptr index = 0; index < numElements; ++index)
 			{
-				setTableElementNonNull(
-					destTable,
-					U64(destOffset) + U64(index),
-					getTableElementNonNull(sourceTable, U64(sourceOffset) + U64(index)));
+				destElements[index].biasedValue.store(
+					sourceElements[index].biasedValue.load(std::memory_order_acquire),
+					std::memory_order_release);
 			}
 		}
 	});
@@ -704,21 +711,12 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsicsTable,
 	Runtime::unwindSignalsAsExceptions([=] {
 		Table* destTable = getTableFromRuntimeData(contextRuntimeData, destTableId);
 
-		const Uptr destOffsetUptr = Uptr(destOffset);
-		const Uptr numElementsUptr = Uptr(numElements);
-
-		const Uptr destTableNumElements = getTableNumElements(destTable);
-		if(destOffsetUptr + numElementsUptr > destTableNumElements
-		   || destOffsetUptr + numElementsUptr < destOffsetUptr)
-		{
-			const Uptr outOfBoundsDestOffset
-				= destOffsetUptr > destTableNumElements ? destOffsetUptr : destTableNumElements;
-			throwException(ExceptionTypes::outOfBoundsTableAccess,
-						   {destTable, outOfBoundsDestOffset});
-		}
-
-		for(Uptr index = 0; index < numElements; ++index)
-		{ setTableElementNonNull(destTable, U64(destOffset) + U64(index), value); }
+		validateTableRange(destTable, destOffset, numElements);
+		fillTableElementsInBounds(destTable,
+								  destOffset,
+								  numElements,
+								  objectToBiasedTableElementValue(value),
+								  std::memory_order_release);
 	});
 }
 
@@ -744,3 +742,14 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsicsTable,
 					   {function, U64(expectedTypeEncoding)});
 	}
 }
+
+WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsicsTable,
+							   "outOfBoundsTableAccess",
+							   void,
+							   outOfBoundsTableAccess,
+							   Uptr index,
+							   Uptr tableId)
+{
+	Table* table = getTableFromRuntimeData(contextRuntimeData, tableId);
+	throwException(ExceptionTypes::outOfBoundsTableAccess, {table, U64(index)});
+}
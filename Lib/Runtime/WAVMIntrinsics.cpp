@@ -44,11 +44,12 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsics,
 
 static thread_local Uptr indentLevel = 0;
 
-WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsics,
-							   "debugEnterFunction",
-							   void,
-							   debugEnterFunction,
-							   const Function* function)
+WAVM_DEFINE_INTRINSIC_FUNCTION_WITH_FLAGS(wavmIntrinsics,
+										  "debugEnterFunction",
+										  Intrinsics::FunctionFlags::noThrow,
+										  void,
+										  debugEnterFunction,
+										  const Function* function)
 {
 	Log::printf(Log::debug,
 				"ENTER: %*s\n",
@@ -57,11 +58,12 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsics,
 	++indentLevel;
 }
 
-WAVM_DEFINE_INTRINSIC_FUNCTION(wavmIntrinsics,
-							   "debugExitFunction",
-							   void,
-							   debugExitFunction,
-							   const Function* function)
+WAVM_DEFINE_INTRINSIC_FUNCTION_WITH_FLAGS(wavmIntrinsics,
+										  "debugExitFunction",
+										  Intrinsics::FunctionFlags::noThrow,
+										  void,
+										  debugExitFunction,
+										  const Function* function)
 {
 	--indentLevel;
 	Log::printf(Log::debug,
@@ -0,0 +1,477 @@
+#include "WAVM/VFS/BufferedStdio.h"
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Time.h"
+#include "WAVM/Platform/Event.h"
+#include "WAVM/Platform/Mutex.h"
+#include "WAVM/Platform/Thread.h"
+#include "WAVM/VFS/VFS.h"
+
+using namespace WAVM;
+using namespace WAVM::VFS;
+
+// The maximum number of records that are coalesced into a single writev of an inner VFD.
+static constexpr Uptr maxBuffersPerWrite = 64;
+
+// Each write is stored in the ring buffer as a record: a header followed by the written bytes,
+// padded to a multiple of the header size. A record never wraps around the end of the ring: if
+// there isn't room for it before the end, a padding record fills the remaining space.
+struct RecordHeader
+{
+	// Zero until the writer has finished copying the record's bytes, then the number of bytes in
+	// the record plus one.
+	std::atomic<U32> committedNumBytesPlusOne;
+	U32 outputIndex;
+};
+static_assert(sizeof(RecordHeader) == 8, "RecordHeader is expected to be 8 bytes");
+
+static constexpr U32 paddingOutputIndex = UINT32_MAX;
+
+static Uptr alignToRecordHeader(Uptr numBytes)
+{
+	return (numBytes + sizeof(RecordHeader) - 1) & ~(sizeof(RecordHeader) - 1);
+}
+
+static Uptr getRecordNumBytes(Uptr numDataBytes)
+{
+	return alignToRecordHeader(sizeof(RecordHeader) + numDataBytes);
+}
+
+static bool isBufferableType(VFD* vfd)
+{
+	VFDInfo vfdInfo;
+	return vfd->getVFDInfo(vfdInfo) == Result::success
+		   && (vfdInfo.type == FileType::characterDevice || vfdInfo.type == FileType::pipe);
+}
+
+struct BufferedStdioImpl;
+
+// Wraps the stdin VFD, so that reading from it first flushes any buffered output. This ensures
+// that a prompt written to stdout is visible before the process waits for input.
+struct BufferedInputVFD : VFD
+{
+	BufferedInputVFD(BufferedStdioImpl* inStdio, VFD* inInnerVFD)
+	: stdio(inStdio), innerVFD(inInnerVFD)
+	{
+	}
+
+	virtual Result close() override { return Result::success; }
+
+	virtual Result seek(I64 offset, SeekOrigin origin, U64* outAbsoluteOffset = nullptr) override
+	{
+		return innerVFD->seek(offset, origin, outAbsoluteOffset);
+	}
+	virtual Result readv(const IOReadBuffer* buffers,
+						 Uptr numBuffers,
+						 Uptr* outNumBytesRead = nullptr,
+						 const U64* offset = nullptr) override;
+	virtual Result writev(const IOWriteBuffer* buffers,
+						  Uptr numBuffers,
+						  Uptr* outNumBytesWritten = nullptr,
+						  const U64* offset = nullptr) override
+	{
+		return innerVFD->writev(buffers, numBuffers, outNumBytesWritten, offset);
+	}
+
+	virtual Result sync(SyncType type) override { return innerVFD->sync(type); }
+
+	virtual Result getVFDInfo(VFDInfo& outInfo) override { return innerVFD->getVFDInfo(outInfo); }
+	virtual Result getFileInfo(FileInfo& outInfo) override
+	{
+		return innerVFD->getFileInfo(outInfo);
+	}
+	virtual Result setVFDFlags(const VFDFlags& flags) override
+	{
+		return innerVFD->setVFDFlags(flags);
+	}
+	virtual Result setFileSize(U64 numBytes) override { return innerVFD->setFileSize(numBytes); }
+	virtual Result setFileTimes(bool setLastAccessTime,
+								Time lastAccessTime,
+								bool setLastWriteTime,
+								Time lastWriteTime) override
+	{
+		return innerVFD->setFileTimes(
+			setLastAccessTime, lastAccessTime, setLastWriteTime, lastWriteTime);
+	}
+
+	virtual Result openDir(DirEntStream*& outStream) override
+	{
+		return innerVFD->openDir(outStream);
+	}
+
+private:
+	BufferedStdioImpl* stdio;
+	VFD* innerVFD;
+};
+
+// Wraps a stdout or stderr VFD, so that writes to it are buffered in the shared ring buffer.
+struct BufferedOutputVFD : VFD
+{
+	BufferedOutputVFD(BufferedStdioImpl* inStdio, VFD* inInnerVFD, U32 inOutputIndex)
+	: stdio(inStdio), innerVFD(inInnerVFD), outputIndex(inOutputIndex)
+	{
+	}
+
+	virtual Result close() override;
+
+	virtual Result seek(I64 offset, SeekOrigin origin, U64* outAbsoluteOffset = nullptr) override
+	{
+		return innerVFD->seek(offset, origin, outAbsoluteOffset);
+	}
+	virtual Result readv(const IOReadBuffer* buffers,
+						 Uptr numBuffers,
+						 Uptr* outNumBytesRead = nullptr,
+						 const U64* offset = nullptr) override
+	{
+		return innerVFD->readv(buffers, numBuffers, outNumBytesRead, offset);
+	}
+	virtual Result writev(const IOWriteBuffer* buffers,
+						  Uptr numBuffers,
+						  Uptr* outNumBytesWritten = nullptr,
+						  const U64* offset = nullptr) override;
+
+	virtual Result sync(SyncType type) override;
+
+	virtual Result getVFDInfo(VFDInfo& outInfo) override { return innerVFD->getVFDInfo(outInfo); }
+	virtual Result getFileInfo(FileInfo& outInfo) override
+	{
+		return innerVFD->getFileInfo(outInfo);
+	}
+	virtual Result setVFDFlags(const VFDFlags& flags) override
+	{
+		return innerVFD->setVFDFlags(flags);
+	}
+	virtual Result setFileSize(U64 numBytes) override { return innerVFD->setFileSize(numBytes); }
+	virtual Result setFileTimes(bool setLastAccessTime,
+								Time lastAccessTime,
+								bool setLastWriteTime,
+								Time lastWriteTime) override
+	{
+		return innerVFD->setFileTimes(
+			setLastAccessTime, lastAccessTime, setLastWriteTime, lastWriteTime);
+	}
+
+	virtual Result openDir(DirEntStream*& outStream) override
+	{
+		return innerVFD->openDir(outStream);
+	}
+
+private:
+	BufferedStdioImpl* stdio;
+	VFD* innerVFD;
+	U32 outputIndex;
+};
+
+// Writers reserve space for a record by atomically advancing reserveOffset, so buffering a write
+// doesn't need a lock. Flushes are serialized by flushMutex, and write the committed records
+// between flushedOffset and reserveOffset to the inner VFDs. The offsets increase monotonically,
+// and are reduced modulo the buffer size to index the ring.
+struct BufferedStdioImpl : BufferedStdio
+{
+	BufferedStdioImpl(VFD* inStdIn,
+					  VFD* inStdOut,
+					  VFD* inStdErr,
+					  Uptr inNumBufferBytes,
+					  Time inFlushInterval)
+	: numBufferBytes(alignToRecordHeader(std::max(inNumBufferBytes, minBufferBytes)))
+	, flushInterval(inFlushInterval)
+	, buffer(new U8[numBufferBytes])
+	, bufferedStdIn(this, inStdIn)
+	, bufferedStdOut(this, inStdOut, 0)
+	, bufferedStdErr(this, inStdErr, 1)
+	{
+		memset(buffer.get(), 0, numBufferBytes);
+		innerOutputVFDs[0] = inStdOut;
+		innerOutputVFDs[1] = inStdErr;
+		isOutputBuffered[0] = isBufferableType(inStdOut);
+		isOutputBuffered[1] = isBufferableType(inStdErr);
+
+		if(!isInfinity(flushInterval))
+		{ flushThread = Platform::createThread(0, flushThreadEntry, this); }
+	}
+
+	~BufferedStdioImpl()
+	{
+		if(flushThread)
+		{
+			isShuttingDown.store(true, std::memory_order_release);
+			flushThreadEvent.signal();
+			Platform::joinThread(flushThread);
+		}
+
+		flush();
+	}
+
+	virtual VFD* getStdIn() override { return &bufferedStdIn; }
+	virtual VFD* getStdOut() override
+	{
+		return isOutputBuffered[0] ? &bufferedStdOut : innerOutputVFDs[0];
+	}
+	virtual VFD* getStdErr() override
+	{
+		return isOutputBuffered[1] ? &bufferedStdErr : innerOutputVFDs[1];
+	}
+
+	virtual Result flush() override
+	{
+		Platform::Mutex::Lock flushLock(flushMutex);
+		flushLocked();
+
+		// Return any error from this flush or a previous implicit flush.
+		const Result result = flushResult;
+		flushResult = Result::success;
+		return result;
+	}
+
+	Result write(U32 outputIndex,
+				 const IOWriteBuffer* buffers,
+				 Uptr numBuffers,
+				 Uptr* outNumBytesWritten)
+	{
+		Uptr numDataBytes = 0;
+		for(Uptr bufferIndex = 0; bufferIndex < numBuffers; ++bufferIndex)
+		{ numDataBytes += buffers[bufferIndex].numBytes; }
+
+		// Write large writes directly to the inner VFD after flushing the buffered output.
+		const Uptr recordNumBytes = getRecordNumBytes(numDataBytes);
+		if(recordNumBytes > numBufferBytes / 2 || numDataBytes >= UINT32_MAX)
+		{
+			Platform::Mutex::Lock flushLock(flushMutex);
+			flushLocked();
+			return innerOutputVFDs[outputIndex]->writev(
+				buffers, numBuffers, outNumBytesWritten, nullptr);
+		}
+		if(outNumBytesWritten) { *outNumBytesWritten = numDataBytes; }
+		if(!numDataBytes) { return Result::success; }
+
+		// Reserve space for the record, and a padding record if it doesn't fit before the end of
+		// the ring. If there isn't enough free space in the ring, flush it and try again.
+		U64 beginOffset = reserveOffset.load(std::memory_order_relaxed);
+		U64 recordOffset;
+		U64 endOffset;
+		while(true)
+		{
+			const Uptr ringOffset = Uptr(beginOffset % numBufferBytes);
+			const Uptr numPaddingBytes
+				= ringOffset + recordNumBytes > numBufferBytes ? numBufferBytes - ringOffset : 0;
+			recordOffset = beginOffset + numPaddingBytes;
+			endOffset = recordOffset + recordNumBytes;
+
+			if(endOffset - flushedOffset.load(std::memory_order_acquire) > numBufferBytes)
+			{
+				implicitFlush();
+				beginOffset = reserveOffset.load(std::memory_order_relaxed);
+			}
+			else if(reserveOffset.compare_exchange_weak(beginOffset, endOffset))
+			{
+				break;
+			}
+		};
+
+		if(recordOffset != beginOffset)
+		{
+			commitRecord(beginOffset,
+						 paddingOutputIndex,
+						 Uptr(recordOffset - beginOffset) - sizeof(RecordHeader));
+		}
+
+		U8* recordData = buffer.get() + recordOffset % numBufferBytes + sizeof(RecordHeader);
+		for(Uptr bufferIndex = 0; bufferIndex < numBuffers; ++bufferIndex)
+		{
+			memcpy(recordData, buffers[bufferIndex].data, buffers[bufferIndex].numBytes);
+			recordData += buffers[bufferIndex].numBytes;
+		}
+		commitRecord(recordOffset, outputIndex, numDataBytes);
+
+		// Flush the buffer once it's half full, so writers rarely need to wait for a flush.
+		if(endOffset - flushedOffset.load(std::memory_order_acquire) > numBufferBytes / 2)
+		{ implicitFlush(); }
+
+		return Result::success;
+	}
+
+private:
+	static constexpr Uptr minBufferBytes = 256;
+
+	const Uptr numBufferBytes;
+	const Time flushInterval;
+	std::unique_ptr<U8[]> buffer;
+
+	std::atomic<U64> reserveOffset{0};
+	std::atomic<U64> flushedOffset{0};
+
+	Platform::Mutex flushMutex;
+	Result flushResult{Result::success};
+
+	Platform::Thread* flushThread{nullptr};
+	Platform::Event flushThreadEvent;
+	std::atomic<bool> isShuttingDown{false};
+
+	VFD* innerOutputVFDs[2];
+	bool isOutputBuffered[2];
+
+	BufferedInputVFD bufferedStdIn;
+	BufferedOutputVFD bufferedStdOut;
+	BufferedOutputVFD bufferedStdErr;
+
+	RecordHeader* getRecordHeader(U64 offset)
+	{
+		return reinterpret_cast<RecordHeader*>(buffer.get() + offset % numBufferBytes);
+	}
+
+	void commitRecord(U64 offset, U32 outputIndex, Uptr numDataBytes)
+	{
+		RecordHeader* header = getRecordHeader(offset);
+		header->outputIndex = outputIndex;
+		header->committedNumBytesPlusOne.store(U32(numDataBytes + 1), std::memory_order_release);
+	}
+
+	// Flushes the buffer without returning errors to the caller: any error is returned by the
+	// next explicit flush.
+	void implicitFlush()
+	{
+		Platform::Mutex::Lock flushLock(flushMutex);
+		flushLocked();
+	}
+
+	void flushLocked()
+	{
+		const U64 endOffset = reserveOffset.load(std::memory_order_acquire);
+		U64 offset = flushedOffset.load(std::memory_order_relaxed);
+		if(offset == endOffset) { return; }
+
+		// Coalesce consecutive records for the same output into a single write.
+		IOWriteBuffer writeBuffers[maxBuffersPerWrite];
+		Uptr numWriteBuffers = 0;
+		U32 writeOutputIndex = 0;
+		while(offset != endOffset)
+		{
+			// Wait for the writer that reserved this record to finish copying its data.
+			RecordHeader* header = getRecordHeader(offset);
+			U32 committedNumBytesPlusOne;
+			while(!(committedNumBytesPlusOne
+					= header->committedNumBytesPlusOne.load(std::memory_order_acquire)))
+			{ Platform::yieldToAnotherThread(); };
+
+			const Uptr numDataBytes = committedNumBytesPlusOne - 1;
+			if(header->outputIndex != paddingOutputIndex)
+			{
+				if(numWriteBuffers
+				   && (header->outputIndex != writeOutputIndex
+					   || numWriteBuffers == maxBuffersPerWrite))
+				{
+					writeAll(writeOutputIndex, writeBuffers, numWriteBuffers);
+					numWriteBuffers = 0;
+				}
+				writeOutputIndex = header->outputIndex;
+				writeBuffers[numWriteBuffers++]
+					= IOWriteBuffer{(const U8*)(header + 1), numDataBytes};
+			}
+
+			offset += getRecordNumBytes(numDataBytes);
+		};
+		if(numWriteBuffers) { writeAll(writeOutputIndex, writeBuffers, numWriteBuffers); }
+
+		// Clear the flushed records before releasing their space to writers, so the flush that
+		// reads the next record in this space doesn't see a stale header.
+		const U64 beginOffset = flushedOffset.load(std::memory_order_relaxed);
+		const Uptr beginRingOffset = Uptr(beginOffset % numBufferBytes);
+		const Uptr numFlushedBytes = Uptr(endOffset - beginOffset);
+		if(beginRingOffset + numFlushedBytes <= numBufferBytes)
+		{ memset(buffer.get() + beginRingOffset, 0, numFlushedBytes); }
+		else
+		{
+			memset(buffer.get() + beginRingOffset, 0, numBufferBytes - beginRingOffset);
+			memset(buffer.get(), 0, beginRingOffset + numFlushedBytes - numBufferBytes);
+		}
+		flushedOffset.store(endOffset, std::memory_order_release);
+	}
+
+	// Writes the buffers to an inner VFD, retrying after partial writes. If a write fails, the
+	// rest of the buffers are dropped, and the error is saved to be returned by the next flush.
+	void writeAll(U32 outputIndex, IOWriteBuffer* buffers, Uptr numBuffers)
+	{
+		VFD* vfd = innerOutputVFDs[outputIndex];
+		while(numBuffers)
+		{
+			Uptr numBytesWritten = 0;
+			Result result = vfd->writev(buffers, numBuffers, &numBytesWritten, nullptr);
+			if(result == Result::interruptedBySignal) { continue; }
+			else if(result != Result::success)
+			{
+				if(flushResult == Result::success) { flushResult = result; }
+				return;
+			}
+
+			while(numBuffers && numBytesWritten >= buffers->numBytes)
+			{
+				numBytesWritten -= buffers->numBytes;
+				++buffers;
+				--numBuffers;
+			};
+			if(numBuffers)
+			{
+				buffers->data = (const U8*)buffers->data + numBytesWritten;
+				buffers->numBytes -= numBytesWritten;
+			}
+		};
+	}
+
+	static I64 flushThreadEntry(void* argument)
+	{
+		BufferedStdioImpl* stdio = (BufferedStdioImpl*)argument;
+		while(!stdio->isShuttingDown.load(std::memory_order_acquire))
+		{
+			stdio->flushThreadEvent.wait(stdio->flushInterval);
+			if(stdio->reserveOffset.load(std::memory_order_acquire)
+			   != stdio->flushedOffset.load(std::memory_order_acquire))
+			{ stdio->implicitFlush(); }
+		};
+		return 0;
+	}
+};
+
+Result BufferedInputVFD::readv(const IOReadBuffer* buffers,
+							   Uptr numBuffers,
+							   Uptr* outNumBytesRead,
+							   const U64* offset)
+{
+	stdio->flush();
+	return innerVFD->readv(buffers, numBuffers, outNumBytesRead, offset);
+}
+
+Result BufferedOutputVFD::close() { return stdio->flush(); }
+
+Result BufferedOutputVFD::writev(const IOWriteBuffer* buffers,
+								 Uptr numBuffers,
+								 Uptr* outNumBytesWritten,
+								 const U64* offset)
+{
+	if(offset)
+	{
+		stdio->flush();
+		return innerVFD->writev(buffers, numBuffers, outNumBytesWritten, offset);
+	}
+	return stdio->write(outputIndex, buffers, numBuffers, outNumBytesWritten);
+}
+
+Result BufferedOutputVFD::sync(SyncType type)
+{
+	Result result = stdio->flush();
+	if(result != Result::success) { return result; }
+	return innerVFD->sync(type);
+}
+
+std::shared_ptr<BufferedStdio> VFS::makeBufferedStdio(VFD* stdIn,
+													  VFD* stdOut,
+													  VFD* stdErr,
+													  Uptr numBufferBytes,
+													  Time flushInterval)
+{
+	return std::make_shared<BufferedStdioImpl>(
+		stdIn, stdOut, stdErr, numBufferBytes, flushInterval);
+}
@@ -0,0 +1,696 @@
+#include "WAVM/VFS/ImageFS.h"
+#include <string.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "VFSPrivate.h"
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/I128.h"
+#include "WAVM/Inline/Time.h"
+#include "WAVM/Platform/File.h"
+#include "WAVM/Platform/Memory.h"
+#include "WAVM/Platform/Mutex.h"
+#include "WAVM/VFS/VFS.h"
+
+using namespace WAVM;
+using namespace WAVM::VFS;
+
+// An image is laid out as:
+//   ImageHeader
+//   ImageNode[numNodes]: node 0 is the root directory.
+//   ImageDirEntry[numDirEntries]: each directory's entries are contiguous, and sorted by name.
+//   char[numNameBytes]: the names of the directory entries.
+//   The contents of each file, aligned to imageDataAlignment.
+// The image is padded to a multiple of imageDataAlignment, so the pages containing any file's
+// contents can always be mapped.
+
+static constexpr U8 imageMagic[8] = {'W', 'A', 'V', 'M', 'I', 'M', 'G', 0};
+static constexpr U32 imageVersion = 1;
+
+// File contents are aligned to the largest page size of the supported hosts, so they can be
+// mapped directly from the image.
+static constexpr U64 imageDataAlignment = 16384;
+
+enum class ImageNodeType : U32
+{
+	file = 0,
+	directory = 1,
+};
+
+struct ImageHeader
+{
+	U8 magic[8];
+	U32 version;
+	U32 numNodes;
+	U32 numDirEntries;
+	U32 numNameBytes;
+	U64 numImageBytes;
+};
+
+struct ImageNode
+{
+	U64 dataOffset;
+	U64 numBytes;
+	I64 lastWriteTimeNS;
+	ImageNodeType type;
+	U32 parentNodeIndex;
+	U32 firstDirEntry;
+	U32 numDirEntries;
+};
+
+struct ImageDirEntry
+{
+	U32 nameOffset;
+	U32 numNameBytes;
+	U32 nodeIndex;
+};
+
+static_assert(sizeof(ImageHeader) == 32, "ImageHeader has unexpected padding");
+static_assert(sizeof(ImageNode) == 40, "ImageNode has unexpected padding");
+static_assert(sizeof(ImageDirEntry) == 12, "ImageDirEntry has unexpected padding");
+
+static constexpr Uptr maxIOBuffers = 1024;
+
+static U64 alignImageOffset(U64 offset)
+{
+	return (offset + imageDataAlignment - 1) & ~(imageDataAlignment - 1);
+}
+
+// The validated tables of a mapped image, shared by the ImageFS and the VFDs opened from it.
+struct Image
+{
+	std::shared_ptr<Platform::MappedFile> mapping;
+	const ImageNode* nodes;
+	const ImageDirEntry* dirEntries;
+	const char* names;
+	U32 numNodes;
+
+	const U8* getData(const ImageNode& node) const
+	{
+		return mapping->getData() + node.dataOffset;
+	}
+
+	std::string getName(const ImageDirEntry& dirEntry) const
+	{
+		return std::string(names + dirEntry.nameOffset, dirEntry.numNameBytes);
+	}
+
+	static FileType getFileType(const ImageNode& node)
+	{
+		return node.type == ImageNodeType::directory ? FileType::directory : FileType::file;
+	}
+
+	void getFileInfo(U32 nodeIndex, FileInfo& outInfo) const
+	{
+		const ImageNode& node = nodes[nodeIndex];
+		outInfo.deviceNumber = 0;
+		outInfo.fileNumber = U64(nodeIndex) + 1;
+		outInfo.type = getFileType(node);
+		outInfo.numLinks = 1;
+		outInfo.numBytes = node.numBytes;
+		outInfo.lastAccessTime.ns = node.lastWriteTimeNS;
+		outInfo.lastWriteTime.ns = node.lastWriteTimeNS;
+		outInfo.creationTime.ns = node.lastWriteTimeNS;
+	}
+
+	void getDirEnts(U32 nodeIndex, std::vector<DirEnt>& outDirEnts) const
+	{
+		const ImageNode& node = nodes[nodeIndex];
+		WAVM_ASSERT(node.type == ImageNodeType::directory);
+
+		outDirEnts.push_back({U64(nodeIndex) + 1, ".", FileType::directory});
+		outDirEnts.push_back({U64(node.parentNodeIndex) + 1, "..", FileType::directory});
+		for(U32 entryIndex = 0; entryIndex < node.numDirEntries; ++entryIndex)
+		{
+			const ImageDirEntry& dirEntry = dirEntries[node.firstDirEntry + entryIndex];
+			outDirEnts.push_back({U64(dirEntry.nodeIndex) + 1,
+								  getName(dirEntry),
+								  getFileType(nodes[dirEntry.nodeIndex])});
+		}
+	}
+
+	// Looks up a path by binary searching the sorted entries of each directory along it.
+	Result lookup(const std::string& path, U32& outNodeIndex) const
+	{
+		std::vector<std::string> components;
+		splitPath(path, components);
+
+		U32 nodeIndex = 0;
+		for(const std::string& component : components)
+		{
+			const ImageNode& node = nodes[nodeIndex];
+			if(node.type != ImageNodeType::directory) { return Result::isNotDirectory; }
+
+			const ImageDirEntry* begin = dirEntries + node.firstDirEntry;
+			const ImageDirEntry* end = begin + node.numDirEntries;
+			const ImageDirEntry* dirEntry = std::lower_bound(
+				begin, end, component, [this](const ImageDirEntry& entry, const std::string& name) {
+					return compareName(entry, name) < 0;
+				});
+			if(dirEntry == end || compareName(*dirEntry, component) != 0)
+			{ return Result::doesNotExist; }
+
+			nodeIndex = dirEntry->nodeIndex;
+		}
+
+		outNodeIndex = nodeIndex;
+		return Result::success;
+	}
+
+private:
+	int compareName(const ImageDirEntry& dirEntry, const std::string& name) const
+	{
+		const Uptr numCommonBytes = std::min(Uptr(dirEntry.numNameBytes), name.size());
+		const int result = memcmp(names + dirEntry.nameOffset, name.data(), numCommonBytes);
+		if(result) { return result; }
+		else if(dirEntry.numNameBytes < name.size())
+		{
+			return -1;
+		}
+		else
+		{
+			return dirEntry.numNameBytes > name.size() ? 1 : 0;
+		}
+	}
+};
+
+static bool validateImage(const std::shared_ptr<Platform::MappedFile>& mapping, Image& outImage)
+{
+	const U8* data = mapping->getData();
+	const U64 numBytes = mapping->getNumBytes();
+	if(numBytes < sizeof(ImageHeader)) { return false; }
+
+	const ImageHeader* header = (const ImageHeader*)data;
+	if(memcmp(header->magic, imageMagic, sizeof(imageMagic)) || header->version != imageVersion
+	   || header->numImageBytes > numBytes || !header->numNodes)
+	{ return false; }
+
+	const U64 nodesOffset = sizeof(ImageHeader);
+	const U64 dirEntriesOffset = nodesOffset + U64(header->numNodes) * sizeof(ImageNode);
+	const U64 namesOffset = dirEntriesOffset + U64(header->numDirEntries) * sizeof(ImageDirEntry);
+	if(namesOffset + header->numNameBytes > header->numImageBytes) { return false; }
+
+	outImage.mapping = mapping;
+	outImage.nodes = (const ImageNode*)(data + nodesOffset);
+	outImage.dirEntries = (const ImageDirEntry*)(data + dirEntriesOffset);
+	outImage.names = (const char*)(data + namesOffset);
+	outImage.numNodes = header->numNodes;
+
+	if(outImage.nodes[0].type != ImageNodeType::directory) { return false; }
+	for(U32 nodeIndex = 0; nodeIndex < header->numNodes; ++nodeIndex)
+	{
+		const ImageNode& node = outImage.nodes[nodeIndex];
+		if(node.parentNodeIndex >= header->numNodes) { return false; }
+
+		switch(node.type)
+		{
+		case ImageNodeType::file:
+			if(node.dataOffset & (imageDataAlignment - 1) || node.dataOffset > header->numImageBytes
+			   || node.numBytes > header->numImageBytes - node.dataOffset)
+			{ return false; }
+			break;
+		case ImageNodeType::directory:
+			if(node.firstDirEntry > header->numDirEntries
+			   || node.numDirEntries > header->numDirEntries - node.firstDirEntry)
+			{ return false; }
+			break;
+		default: return false;
+		};
+	}
+
+	for(U32 entryIndex = 0; entryIndex < header->numDirEntries; ++entryIndex)
+	{
+		const ImageDirEntry& dirEntry = outImage.dirEntries[entryIndex];
+		if(!dirEntry.nodeIndex || dirEntry.nodeIndex >= header->numNodes
+		   || dirEntry.nameOffset > header->numNameBytes
+		   || dirEntry.numNameBytes > header->numNameBytes - dirEntry.nameOffset)
+		{ return false; }
+	}
+
+	return true;
+}
+
+struct ImageVFD : VFD
+{
+	ImageVFD(const std::shared_ptr<const Image>& inImage, U32 inNodeIndex, const VFDFlags& inFlags)
+	: image(inImage), nodeIndex(inNodeIndex), node(image->nodes[inNodeIndex]), flags(inFlags)
+	{
+	}
+
+	virtual Result close() override
+	{
+		delete this;
+		return Result::success;
+	}
+
+	virtual Result seek(I64 offset, SeekOrigin origin, U64* outAbsoluteOffset = nullptr) override
+	{
+		Platform::Mutex::Lock vfdLock(mutex);
+
+		I64 baseOffset = 0;
+		switch(origin)
+		{
+		case SeekOrigin::begin: baseOffset = 0; break;
+		case SeekOrigin::cur: baseOffset = I64(currentOffset); break;
+		case SeekOrigin::end: baseOffset = I64(node.numBytes); break;
+		default: WAVM_UNREACHABLE();
+		};
+
+		if((offset > 0 && baseOffset > INT64_MAX - offset) || baseOffset + offset < 0)
+		{ return Result::invalidOffset; }
+
+		currentOffset = U64(baseOffset + offset);
+		if(outAbsoluteOffset) { *outAbsoluteOffset = currentOffset; }
+		return Result::success;
+	}
+
+	virtual Result readv(const IOReadBuffer* buffers,
+						 Uptr numBuffers,
+						 Uptr* outNumBytesRead = nullptr,
+						 const U64* offset = nullptr) override
+	{
+		if(outNumBytesRead) { *outNumBytesRead = 0; }
+
+		if(node.type == ImageNodeType::directory) { return Result::isDirectory; }
+		if(numBuffers > maxIOBuffers) { return Result::tooManyBuffers; }
+
+		// Reads that don't specify an offset use and update the VFD's current offset, so must hold
+		// the VFD's mutex until they are complete.
+		U64 readOffset;
+		if(offset) { readOffset = *offset; }
+		else
+		{
+			mutex.lock();
+			readOffset = currentOffset;
+		}
+
+		// Copy directly from the mapped image.
+		const U8* fileData = image->getData(node);
+		Uptr numBytesRead = 0;
+		for(Uptr bufferIndex = 0; bufferIndex < numBuffers && readOffset < node.numBytes;
+			++bufferIndex)
+		{
+			const Uptr numBufferBytes = Uptr(
+				std::min(U64(buffers[bufferIndex].numBytes), node.numBytes - readOffset));
+			memcpy(buffers[bufferIndex].data, fileData + readOffset, numBufferBytes);
+			readOffset += numBufferBytes;
+			numBytesRead += numBufferBytes;
+		}
+
+		if(!offset)
+		{
+			currentOffset = readOffset;
+			mutex.unlock();
+		}
+		if(outNumBytesRead) { *outNumBytesRead = numBytesRead; }
+		return Result::success;
+	}
+
+	virtual Result writev(const IOWriteBuffer* buffers,
+						  Uptr numBuffers,
+						  Uptr* outNumBytesWritten = nullptr,
+						  const U64* offset = nullptr) override
+	{
+		if(outNumBytesWritten) { *outNumBytesWritten = 0; }
+		return node.type == ImageNodeType::directory ? Result::isDirectory : Result::notPermitted;
+	}
+
+	virtual Result sync(SyncType type) override { return Result::success; }
+
+	virtual Result getVFDInfo(VFDInfo& outInfo) override
+	{
+		Platform::Mutex::Lock vfdLock(mutex);
+		outInfo.type = Image::getFileType(node);
+		outInfo.flags = flags;
+		return Result::success;
+	}
+
+	virtual Result getFileInfo(FileInfo& outInfo) override
+	{
+		image->getFileInfo(nodeIndex, outInfo);
+		return Result::success;
+	}
+
+	virtual Result setVFDFlags(const VFDFlags& newFlags) override
+	{
+		Platform::Mutex::Lock vfdLock(mutex);
+		flags = newFlags;
+		return Result::success;
+	}
+
+	virtual Result setFileSize(U64 numBytes) override
+	{
+		return node.type == ImageNodeType::directory ? Result::isDirectory : Result::notPermitted;
+	}
+
+	virtual Result setFileTimes(bool setLastAccessTime,
+								Time lastAccessTime,
+								bool setLastWriteTime,
+								Time lastWriteTime) override
+	{
+		return Result::notPermitted;
+	}
+
+	virtual Result openDir(DirEntStream*& outStream) override
+	{
+		if(node.type != ImageNodeType::directory) { return Result::isNotDirectory; }
+
+		std::vector<DirEnt> dirEnts;
+		image->getDirEnts(nodeIndex, dirEnts);
+		outStream = new DirEntVectorStream(std::move(dirEnts));
+		return Result::success;
+	}
+
+	virtual Result mapCopyOnWrite(U64 offset, Uptr numBytes, U8* destAddress) override
+	{
+		if(node.type == ImageNodeType::directory) { return Result::isDirectory; }
+
+		const Uptr pageMask = Platform::getBytesPerPage() - 1;
+		if(offset & pageMask || numBytes & pageMask
+		   || reinterpret_cast<Uptr>(destAddress) & pageMask)
+		{ return Result::invalidOffset; }
+
+		// Map the pages that contain the file's contents, and zero the rest.
+		const Uptr numFileBytes
+			= offset >= node.numBytes ? 0 : Uptr(std::min(U64(numBytes), node.numBytes - offset));
+		const Uptr numFilePageBytes = (numFileBytes + pageMask) & ~pageMask;
+		if(numFilePageBytes)
+		{
+			if((node.dataOffset + offset) & pageMask) { return Result::notSupported; }
+			if(!image->mapping->mapCopyOnWrite(
+				   node.dataOffset + offset, numFilePageBytes, destAddress))
+			{ return Result::notSupported; }
+		}
+
+		memset(destAddress + numFileBytes, 0, numBytes - numFileBytes);
+		return Result::success;
+	}
+
+private:
+	const std::shared_ptr<const Image> image;
+	const U32 nodeIndex;
+	const ImageNode& node;
+
+	Platform::Mutex mutex;
+	U64 currentOffset{0};
+	VFDFlags flags;
+};
+
+struct ImageFS : FileSystem
+{
+	ImageFS(std::shared_ptr<const Image>&& inImage) : image(std::move(inImage)) {}
+
+	virtual Result open(const std::string& path,
+						FileAccessMode accessMode,
+						FileCreateMode createMode,
+						VFD*& outFD,
+						const VFDFlags& flags) override
+	{
+		U32 nodeIndex = 0;
+		const Result result = image->lookup(path, nodeIndex);
+		if(result == Result::doesNotExist)
+		{
+			return createMode == FileCreateMode::openExisting
+						   || createMode == FileCreateMode::truncateExisting
+					   ? Result::doesNotExist
+					   : Result::notPermitted;
+		}
+		else if(result != Result::success)
+		{
+			return result;
+		}
+
+		if(createMode == FileCreateMode::createNew) { return Result::alreadyExists; }
+		if(accessMode == FileAccessMode::writeOnly || accessMode == FileAccessMode::readWrite
+		   || createMode == FileCreateMode::createAlways
+		   || createMode == FileCreateMode::truncateExisting)
+		{
+			return image->nodes[nodeIndex].type == ImageNodeType::directory
+					   ? Result::isDirectory
+					   : Result::notPermitted;
+		}
+
+		outFD = new ImageVFD(image, nodeIndex, flags);
+		return Result::success;
+	}
+
+	virtual Result getFileInfo(const std::string& path, FileInfo& outInfo) override
+	{
+		U32 nodeIndex = 0;
+		const Result result = image->lookup(path, nodeIndex);
+		if(result != Result::success) { return result; }
+
+		image->getFileInfo(nodeIndex, outInfo);
+		return Result::success;
+	}
+
+	virtual Result setFileTimes(const std::string& path,
+								bool setLastAccessTime,
+								Time lastAccessTime,
+								bool setLastWriteTime,
+								Time lastWriteTime) override
+	{
+		return Result::notPermitted;
+	}
+
+	virtual Result openDir(const std::string& path, DirEntStream*& outStream) override
+	{
+		U32 nodeIndex = 0;
+		const Result result = image->lookup(path, nodeIndex);
+		if(result != Result::success) { return result; }
+		if(image->nodes[nodeIndex].type != ImageNodeType::directory)
+		{ return Result::isNotDirectory; }
+
+		std::vector<DirEnt> dirEnts;
+		image->getDirEnts(nodeIndex, dirEnts);
+		outStream = new DirEntVectorStream(std::move(dirEnts));
+		return Result::success;
+	}
+
+	virtual Result renameFile(const std::string& oldPath, const std::string& newPath) override
+	{
+		return Result::notPermitted;
+	}
+	virtual Result unlinkFile(const std::string& path) override { return Result::notPermitted; }
+	virtual Result removeDir(const std::string& path) override { return Result::notPermitted; }
+	virtual Result createDir(const std::string& path) override { return Result::notPermitted; }
+
+private:
+	const std::shared_ptr<const Image> image;
+};
+
+std::shared_ptr<FileSystem> VFS::makeImageFS(std::shared_ptr<Platform::MappedFile> mapping)
+{
+	std::shared_ptr<Image> image = std::make_shared<Image>();
+	if(!mapping || !validateImage(mapping, *image)) { return nullptr; }
+	return std::make_shared<ImageFS>(std::move(image));
+}
+
+//
+// Image writing
+//
+
+struct ImageWriterNode
+{
+	std::string sourcePath;
+	ImageNode imageNode;
+};
+
+static Result writeAll(VFD* fd, const void* data, Uptr numBytes)
+{
+	while(numBytes)
+	{
+		Uptr numBytesWritten = 0;
+		const Result result = fd->write(data, numBytes, &numBytesWritten);
+		if(result != Result::success) { return result; }
+		if(!numBytesWritten) { return Result::outOfFreeSpace; }
+
+		data = (const U8*)data + numBytesWritten;
+		numBytes -= numBytesWritten;
+	}
+	return Result::success;
+}
+
+static Result writeZeroes(VFD* fd, Uptr numBytes)
+{
+	static const U8 zeroes[4096] = {0};
+	while(numBytes)
+	{
+		const Uptr numChunkBytes = std::min(numBytes, sizeof(zeroes));
+		const Result result = writeAll(fd, zeroes, numChunkBytes);
+		if(result != Result::success) { return result; }
+		numBytes -= numChunkBytes;
+	}
+	return Result::success;
+}
+
+static Result copyFileContents(FileSystem* sourceFS,
+							   const ImageWriterNode& node,
+							   VFD* outputFD,
+							   U8* buffer,
+							   Uptr numBufferBytes)
+{
+	VFD* sourceFD = nullptr;
+	Result result = sourceFS->open(
+		node.sourcePath, FileAccessMode::readOnly, FileCreateMode::openExisting, sourceFD);
+	if(result != Result::success) { return result; }
+
+	U64 numRemainingBytes = node.imageNode.numBytes;
+	while(numRemainingBytes)
+	{
+		Uptr numBytesRead = 0;
+		result = sourceFD->read(
+			buffer, Uptr(std::min(U64(numBufferBytes), numRemainingBytes)), &numBytesRead);
+		if(result != Result::success) { break; }
+
+		// If the file was truncated since its size was read, fail rather than writing an image
+		// with a stale index.
+		if(!numBytesRead)
+		{
+			result = Result::ioDeviceError;
+			break;
+		}
+
+		result = writeAll(outputFD, buffer, numBytesRead);
+		if(result != Result::success) { break; }
+		numRemainingBytes -= numBytesRead;
+	}
+
+	const Result closeResult = sourceFD->close();
+	return result != Result::success ? result : closeResult;
+}
+
+Result VFS::writeImage(FileSystem* sourceFS, const std::string& rootPath, VFD* outputFD)
+{
+	FileInfo rootInfo;
+	Result result = sourceFS->getFileInfo(rootPath, rootInfo);
+	if(result != Result::success) { return result; }
+	if(rootInfo.type != FileType::directory) { return Result::isNotDirectory; }
+
+	// Visit the directory tree breadth-first, so each directory's entries are added to dirEntries
+	// contiguously.
+	std::vector<ImageWriterNode> nodes;
+	std::vector<ImageDirEntry> dirEntries;
+	std::string names;
+	nodes.push_back({rootPath, {0, 0, I64(rootInfo.lastWriteTime.ns), ImageNodeType::directory}});
+	for(Uptr dirNodeIndex = 0; dirNodeIndex < nodes.size(); ++dirNodeIndex)
+	{
+		if(nodes[dirNodeIndex].imageNode.type != ImageNodeType::directory) { continue; }
+		const std::string dirPath = nodes[dirNodeIndex].sourcePath;
+
+		DirEntStream* dirEntStream = nullptr;
+		result = sourceFS->openDir(dirPath, dirEntStream);
+		if(result != Result::success) { return result; }
+
+		std::vector<std::string> childNames;
+		DirEnt dirEnt;
+		while(dirEntStream->getNext(dirEnt))
+		{
+			if(dirEnt.name != "." && dirEnt.name != "..") { childNames.push_back(dirEnt.name); }
+		}
+		dirEntStream->close();
+		std::sort(childNames.begin(), childNames.end());
+
+		const U32 firstDirEntry = U32(dirEntries.size());
+		for(const std::string& childName : childNames)
+		{
+			const std::string childPath = dirPath + '/' + childName;
+			FileInfo childInfo;
+			result = sourceFS->getFileInfo(childPath, childInfo);
+			if(result != Result::success) { return result; }
+
+			ImageNodeType childType;
+			if(childInfo.type == FileType::directory) { childType = ImageNodeType::directory; }
+			else if(childInfo.type == FileType::file)
+			{
+				childType = ImageNodeType::file;
+			}
+			else
+			{
+				continue;
+			}
+
+			if(nodes.size() >= UINT32_MAX || names.size() + childName.size() > UINT32_MAX)
+			{ return Result::exceededFileSizeLimit; }
+
+			dirEntries.push_back({U32(names.size()), U32(childName.size()), U32(nodes.size())});
+			names += childName;
+
+			ImageNode childNode;
+			childNode.dataOffset = 0;
+			childNode.numBytes = childType == ImageNodeType::file ? childInfo.numBytes : 0;
+			childNode.lastWriteTimeNS = I64(childInfo.lastWriteTime.ns);
+			childNode.type = childType;
+			childNode.parentNodeIndex = U32(dirNodeIndex);
+			childNode.firstDirEntry = 0;
+			childNode.numDirEntries = 0;
+			nodes.push_back({childPath, childNode});
+		}
+
+		ImageNode& dirNode = nodes[dirNodeIndex].imageNode;
+		dirNode.firstDirEntry = firstDirEntry;
+		dirNode.numDirEntries = U32(dirEntries.size() - firstDirEntry);
+	}
+
+	// Lay out the file contents after the tables.
+	const U64 numTableBytes = sizeof(ImageHeader) + nodes.size() * sizeof(ImageNode)
+							  + dirEntries.size() * sizeof(ImageDirEntry) + names.size();
+	U64 nextDataOffset = alignImageOffset(numTableBytes);
+	for(ImageWriterNode& node : nodes)
+	{
+		if(node.imageNode.type == ImageNodeType::file)
+		{
+			node.imageNode.dataOffset = nextDataOffset;
+			nextDataOffset = alignImageOffset(nextDataOffset + node.imageNode.numBytes);
+		}
+	}
+
+	// Write the tables.
+	ImageHeader header;
+	memcpy(header.magic, imageMagic, sizeof(imageMagic));
+	header.version = imageVersion;
+	header.numNodes = U32(nodes.size());
+	header.numDirEntries = U32(dirEntries.size());
+	header.numNameBytes = U32(names.size());
+	header.numImageBytes = nextDataOffset;
+
+	std::vector<U8> tables(numTableBytes);
+	U8* nextTableByte = tables.data();
+	memcpy(nextTableByte, &header, sizeof(header));
+	nextTableByte += sizeof(header);
+	for(const ImageWriterNode& node : nodes)
+	{
+		memcpy(nextTableByte, &node.imageNode, sizeof(ImageNode));
+		nextTableByte += sizeof(ImageNode);
+	}
+	if(dirEntries.size())
+	{
+		memcpy(nextTableByte, dirEntries.data(), dirEntries.size() * sizeof(ImageDirEntry));
+		nextTableByte += dirEntries.size() * sizeof(ImageDirEntry);
+	}
+	if(names.size()) { memcpy(nextTableByte, names.data(), names.size()); }
+
+	result = writeAll(outputFD, tables.data(), tables.size());
+	if(result != Result::success) { return result; }
+	U64 numWrittenBytes = numTableBytes;
+
+	// Copy the contents of each file into the image.
+	static constexpr Uptr numCopyBufferBytes = 65536;
+	std::unique_ptr<U8[]> buffer(new U8[numCopyBufferBytes]);
+	for(const ImageWriterNode& node : nodes)
+	{
+		if(node.imageNode.type != ImageNodeType::file) { continue; }
+
+		result = writeZeroes(outputFD, Uptr(node.imageNode.dataOffset - numWrittenBytes));
+		if(result != Result::success) { return result; }
+
+		result = copyFileContents(sourceFS, node, outputFD, buffer.get(), numCopyBufferBytes);
+		if(result != Result::success) { return result; }
+		numWrittenBytes = node.imageNode.dataOffset + node.imageNode.numBytes;
+	}
+
+	return writeZeroes(outputFD, Uptr(header.numImageBytes - numWrittenBytes));
+}
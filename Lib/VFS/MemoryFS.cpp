@@ -0,0 +1,773 @@
+#include "WAVM/VFS/MemoryFS.h"
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+#include "VFSPrivate.h"
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/HashMap.h"
+#include "WAVM/Inline/Time.h"
+#include "WAVM/Platform/Clock.h"
+#include "WAVM/Platform/Mutex.h"
+#include "WAVM/Platform/RWMutex.h"
+#include "WAVM/VFS/VFS.h"
+
+using namespace WAVM;
+using namespace WAVM::VFS;
+
+// File contents are stored in pages that are allocated when they are first written. Pages that
+// haven't been written read as zeroes.
+static constexpr Uptr bytesPerPage = 4096;
+
+// The maximum size of a file. The page table is a flat array, so this bounds its size.
+static constexpr U64 maxFileBytes = U64(1) << 36;
+
+// The maximum number of buffers that may be passed to readv or writev.
+static constexpr Uptr maxIOBuffers = 1024;
+
+// The state of the nodes is protected by a fixed set of mutexes shared by all nodes, so that
+// operations on unrelated files and directories rarely contend, without the memory overhead of a
+// mutex per node.
+static constexpr Uptr numLockShards = 64;
+
+static Platform::RWMutex& getLockShard(Uptr shardIndex)
+{
+	static Platform::RWMutex lockShards[numLockShards];
+	return lockShards[shardIndex];
+}
+
+static U64 allocateFileNumber()
+{
+	static std::atomic<U64> nextFileNumber{1};
+	return nextFileNumber++;
+}
+
+static Time getCurrentTime() { return Platform::getClockTime(Platform::Clock::realtime); }
+
+struct MemoryDir;
+
+struct MemoryNode
+{
+	const U64 fileNumber;
+	const FileType type;
+	std::atomic<U32> numLinks;
+
+	// The following fields are protected by getMutex().
+	Time lastAccessTime;
+	Time lastWriteTime;
+	Time creationTime;
+
+	MemoryNode(FileType inType, U32 inNumLinks)
+	: fileNumber(allocateFileNumber()), type(inType), numLinks(inNumLinks)
+	{
+		lastAccessTime = lastWriteTime = creationTime = getCurrentTime();
+	}
+	virtual ~MemoryNode() {}
+
+	Uptr getLockShardIndex() const { return Uptr(fileNumber % numLockShards); }
+	Platform::RWMutex& getMutex() const { return getLockShard(getLockShardIndex()); }
+
+	// Must be called with getMutex() locked.
+	virtual U64 getNumBytes() const = 0;
+
+	// Must be called with getMutex() locked.
+	void getFileInfo(FileInfo& outInfo) const
+	{
+		outInfo.deviceNumber = 0;
+		outInfo.fileNumber = fileNumber;
+		outInfo.type = type;
+		outInfo.numLinks = numLinks;
+		outInfo.numBytes = getNumBytes();
+		outInfo.lastAccessTime = lastAccessTime;
+		outInfo.lastWriteTime = lastWriteTime;
+		outInfo.creationTime = creationTime;
+	}
+};
+
+typedef std::shared_ptr<MemoryNode> MemoryNodeRef;
+
+struct MemoryFile : MemoryNode
+{
+	// The following fields are protected by getMutex().
+	std::vector<std::unique_ptr<U8[]>> pages;
+	U64 numBytes{0};
+
+	MemoryFile() : MemoryNode(FileType::file, 1) {}
+
+	virtual U64 getNumBytes() const override { return numBytes; }
+
+	// Must be called with getMutex() locked.
+	Uptr read(U64 offset, const IOReadBuffer* buffers, Uptr numBuffers) const
+	{
+		Uptr numBytesRead = 0;
+		for(Uptr bufferIndex = 0; bufferIndex < numBuffers && offset < numBytes; ++bufferIndex)
+		{
+			U8* destination = (U8*)buffers[bufferIndex].data;
+			Uptr numBufferBytes
+				= Uptr(std::min(U64(buffers[bufferIndex].numBytes), numBytes - offset));
+			while(numBufferBytes)
+			{
+				const Uptr pageIndex = Uptr(offset / bytesPerPage);
+				const Uptr pageOffset = Uptr(offset % bytesPerPage);
+				const Uptr numChunkBytes = std::min(numBufferBytes, bytesPerPage - pageOffset);
+				if(pageIndex < pages.size() && pages[pageIndex])
+				{ memcpy(destination, pages[pageIndex].get() + pageOffset, numChunkBytes); }
+				else
+				{
+					memset(destination, 0, numChunkBytes);
+				}
+
+				destination += numChunkBytes;
+				offset += numChunkBytes;
+				numBytesRead += numChunkBytes;
+				numBufferBytes -= numChunkBytes;
+			}
+		}
+		return numBytesRead;
+	}
+
+	// Must be called with getMutex() exclusively locked.
+	Uptr write(U64 offset, const IOWriteBuffer* buffers, Uptr numBuffers)
+	{
+		Uptr numBytesWritten = 0;
+		for(Uptr bufferIndex = 0; bufferIndex < numBuffers; ++bufferIndex)
+		{
+			const U8* source = (const U8*)buffers[bufferIndex].data;
+			Uptr numBufferBytes = buffers[bufferIndex].numBytes;
+			while(numBufferBytes)
+			{
+				const Uptr pageIndex = Uptr(offset / bytesPerPage);
+				const Uptr pageOffset = Uptr(offset % bytesPerPage);
+				const Uptr numChunkBytes = std::min(numBufferBytes, bytesPerPage - pageOffset);
+				if(pageIndex >= pages.size()) { pages.resize(pageIndex + 1); }
+				if(!pages[pageIndex]) { pages[pageIndex].reset(new U8[bytesPerPage]()); }
+				memcpy(pages[pageIndex].get() + pageOffset, source, numChunkBytes);
+
+				source += numChunkBytes;
+				offset += numChunkBytes;
+				numBytesWritten += numChunkBytes;
+				numBufferBytes -= numChunkBytes;
+			}
+		}
+		if(offset > numBytes) { numBytes = offset; }
+		return numBytesWritten;
+	}
+
+	// Must be called with getMutex() exclusively locked.
+	void resize(U64 newNumBytes)
+	{
+		WAVM_ASSERT(newNumBytes <= maxFileBytes);
+		if(newNumBytes < numBytes)
+		{
+			// Free the pages past the new end of the file, and zero the tail of the last page so
+			// the bytes read as zeroes if the file is extended again.
+			const Uptr numPages = Uptr((newNumBytes + bytesPerPage - 1) / bytesPerPage);
+			if(pages.size() > numPages) { pages.resize(numPages); }
+
+			const Uptr lastPageOffset = Uptr(newNumBytes % bytesPerPage);
+			if(lastPageOffset && numPages <= pages.size() && pages[numPages - 1])
+			{
+				memset(
+					pages[numPages - 1].get() + lastPageOffset, 0, bytesPerPage - lastPageOffset);
+			}
+		}
+		numBytes = newNumBytes;
+	}
+};
+
+struct MemoryDir : MemoryNode
+{
+	// The following fields are protected by getMutex().
+	HashMap<std::string, MemoryNodeRef> children;
+	U64 parentFileNumber;
+	bool isRemoved{false};
+
+	// The parent directory is protected by MemoryFS::renameMutex. It is null for the root and for
+	// removed directories.
+	MemoryDir* parent;
+
+	MemoryDir(MemoryDir* inParent)
+	: MemoryNode(FileType::directory, 2)
+	, parentFileNumber(inParent ? inParent->fileNumber : fileNumber)
+	, parent(inParent)
+	{
+	}
+
+	virtual U64 getNumBytes() const override { return 0; }
+};
+
+// Exclusively locks the mutexes for a set of nodes, in a consistent order to avoid deadlocks, and
+// locking the mutex for nodes that share a shard only once. Must only be used while holding
+// MemoryFS::renameMutex, so at most one thread holds multiple node locks at a time.
+struct MultiNodeLock
+{
+	MultiNodeLock(std::initializer_list<const MemoryNode*> nodes)
+	{
+		// Insert the shard indices in sorted order, skipping duplicates.
+		WAVM_ASSERT(nodes.size() <= maxNodes);
+		for(const MemoryNode* node : nodes)
+		{
+			if(!node) { continue; }
+			const Uptr shardIndex = node->getLockShardIndex();
+			Uptr insertIndex = 0;
+			while(insertIndex < numShards && shardIndices[insertIndex] < shardIndex)
+			{ ++insertIndex; }
+			if(insertIndex < numShards && shardIndices[insertIndex] == shardIndex) { continue; }
+			for(Uptr index = numShards; index > insertIndex; --index)
+			{ shardIndices[index] = shardIndices[index - 1]; }
+			shardIndices[insertIndex] = shardIndex;
+			++numShards;
+		}
+		for(Uptr index = 0; index < numShards; ++index)
+		{ getLockShard(shardIndices[index]).lock(Platform::RWMutex::exclusive); }
+	}
+
+	~MultiNodeLock()
+	{
+		for(Uptr index = numShards; index > 0; --index)
+		{ getLockShard(shardIndices[index - 1]).unlock(Platform::RWMutex::exclusive); }
+	}
+
+private:
+	static constexpr Uptr maxNodes = 4;
+	Uptr shardIndices[maxNodes];
+	Uptr numShards{0};
+};
+
+static void getDirEnts(const MemoryDir* dir, std::vector<DirEnt>& outDirEnts)
+{
+	Platform::RWMutex::ShareableLock dirLock(dir->getMutex());
+	outDirEnts.push_back({dir->fileNumber, ".", FileType::directory});
+	outDirEnts.push_back({dir->parentFileNumber, "..", FileType::directory});
+	for(const auto& pair : dir->children)
+	{ outDirEnts.push_back({pair.value->fileNumber, pair.key, pair.value->type}); }
+}
+
+struct MemoryVFD : VFD
+{
+	MemoryVFD(MemoryNodeRef&& inNode, FileAccessMode inAccessMode, const VFDFlags& inFlags)
+	: node(std::move(inNode)), accessMode(inAccessMode), flags(inFlags)
+	{
+	}
+
+	virtual Result close() override
+	{
+		delete this;
+		return Result::success;
+	}
+
+	virtual Result seek(I64 offset, SeekOrigin origin, U64* outAbsoluteOffset = nullptr) override
+	{
+		Platform::Mutex::Lock vfdLock(mutex);
+
+		I64 baseOffset = 0;
+		switch(origin)
+		{
+		case SeekOrigin::begin: baseOffset = 0; break;
+		case SeekOrigin::cur: baseOffset = I64(currentOffset); break;
+		case SeekOrigin::end: {
+			Platform::RWMutex::ShareableLock nodeLock(node->getMutex());
+			baseOffset = I64(node->getNumBytes());
+			break;
+		}
+		default: WAVM_UNREACHABLE();
+		};
+
+		if((offset > 0 && baseOffset > INT64_MAX - offset) || baseOffset + offset < 0)
+		{ return Result::invalidOffset; }
+
+		currentOffset = U64(baseOffset + offset);
+		if(outAbsoluteOffset) { *outAbsoluteOffset = currentOffset; }
+		return Result::success;
+	}
+
+	virtual Result readv(const IOReadBuffer* buffers,
+						 Uptr numBuffers,
+						 Uptr* outNumBytesRead = nullptr,
+						 const U64* offset = nullptr) override
+	{
+		if(outNumBytesRead) { *outNumBytesRead = 0; }
+
+		if(node->type == FileType::directory) { return Result::isDirectory; }
+		if(accessMode != FileAccessMode::readOnly && accessMode != FileAccessMode::readWrite)
+		{ return Result::notPermitted; }
+		if(numBuffers > maxIOBuffers) { return Result::tooManyBuffers; }
+
+		MemoryFile* file = static_cast<MemoryFile*>(node.get());
+
+		// Reads that don't specify an offset use and update the VFD's current offset, so must hold
+		// the VFD's mutex until they are complete.
+		U64 readOffset;
+		if(offset) { readOffset = *offset; }
+		else
+		{
+			mutex.lock();
+			readOffset = currentOffset;
+		}
+
+		Uptr numBytesRead;
+		{
+			Platform::RWMutex::ShareableLock fileLock(file->getMutex());
+			numBytesRead = file->read(readOffset, buffers, numBuffers);
+		}
+
+		if(!offset)
+		{
+			currentOffset += numBytesRead;
+			mutex.unlock();
+		}
+		if(outNumBytesRead) { *outNumBytesRead = numBytesRead; }
+		return Result::success;
+	}
+
+	virtual Result writev(const IOWriteBuffer* buffers,
+						  Uptr numBuffers,
+						  Uptr* outNumBytesWritten = nullptr,
+						  const U64* offset = nullptr) override
+	{
+		if(outNumBytesWritten) { *outNumBytesWritten = 0; }
+
+		if(node->type == FileType::directory) { return Result::isDirectory; }
+		if(accessMode != FileAccessMode::writeOnly && accessMode != FileAccessMode::readWrite)
+		{ return Result::notPermitted; }
+		if(numBuffers > maxIOBuffers) { return Result::tooManyBuffers; }
+
+		// Count the number of bytes in all the buffers.
+		U64 numBufferBytes = 0;
+		for(Uptr bufferIndex = 0; bufferIndex < numBuffers; ++bufferIndex)
+		{
+			numBufferBytes += buffers[bufferIndex].numBytes;
+			if(numBufferBytes > maxFileBytes) { return Result::tooManyBufferBytes; }
+		}
+
+		MemoryFile* file = static_cast<MemoryFile*>(node.get());
+
+		Platform::Mutex::Lock vfdLock(mutex);
+		Platform::RWMutex::ExclusiveLock fileLock(file->getMutex());
+
+		// Determine the offset to write at. If the VFD is in append mode, writes that don't
+		// specify an offset always occur at the end of the file.
+		U64 writeOffset;
+		if(offset) { writeOffset = *offset; }
+		else if(flags.append)
+		{
+			writeOffset = file->numBytes;
+		}
+		else
+		{
+			writeOffset = currentOffset;
+		}
+
+		if(writeOffset > maxFileBytes || numBufferBytes > maxFileBytes - writeOffset)
+		{ return Result::exceededFileSizeLimit; }
+
+		const Uptr numBytesWritten = file->write(writeOffset, buffers, numBuffers);
+		if(numBytesWritten) { file->lastWriteTime = getCurrentTime(); }
+
+		if(!offset) { currentOffset = writeOffset + numBytesWritten; }
+		if(outNumBytesWritten) { *outNumBytesWritten = numBytesWritten; }
+		return Result::success;
+	}
+
+	virtual Result sync(SyncType type) override { return Result::success; }
+
+	virtual Result getVFDInfo(VFDInfo& outInfo) override
+	{
+		Platform::Mutex::Lock vfdLock(mutex);
+		outInfo.type = node->type;
+		outInfo.flags = flags;
+		return Result::success;
+	}
+
+	virtual Result getFileInfo(FileInfo& outInfo) override
+	{
+		Platform::RWMutex::ShareableLock nodeLock(node->getMutex());
+		node->getFileInfo(outInfo);
+		return Result::success;
+	}
+
+	virtual Result setVFDFlags(const VFDFlags& newFlags) override
+	{
+		Platform::Mutex::Lock vfdLock(mutex);
+		flags = newFlags;
+		return Result::success;
+	}
+
+	virtual Result setFileSize(U64 numBytes) override
+	{
+		if(node->type == FileType::directory) { return Result::isDirectory; }
+		if(accessMode != FileAccessMode::writeOnly && accessMode != FileAccessMode::readWrite)
+		{ return Result::notPermitted; }
+		if(numBytes > maxFileBytes) { return Result::exceededFileSizeLimit; }
+
+		MemoryFile* file = static_cast<MemoryFile*>(node.get());
+		Platform::RWMutex::ExclusiveLock fileLock(file->getMutex());
+		file->resize(numBytes);
+		file->lastWriteTime = getCurrentTime();
+		return Result::success;
+	}
+
+	virtual Result setFileTimes(bool setLastAccessTime,
+								Time lastAccessTime,
+								bool setLastWriteTime,
+								Time lastWriteTime) override
+	{
+		Platform::RWMutex::ExclusiveLock nodeLock(node->getMutex());
+		if(setLastAccessTime) { node->lastAccessTime = lastAccessTime; }
+		if(setLastWriteTime) { node->lastWriteTime = lastWriteTime; }
+		return Result::success;
+	}
+
+	virtual Result openDir(DirEntStream*& outStream) override
+	{
+		if(node->type != FileType::directory) { return Result::isNotDirectory; }
+
+		std::vector<DirEnt> dirEnts;
+		getDirEnts(static_cast<MemoryDir*>(node.get()), dirEnts);
+		outStream = new DirEntVectorStream(std::move(dirEnts));
+		return Result::success;
+	}
+
+private:
+	const MemoryNodeRef node;
+	const FileAccessMode accessMode;
+
+	// The following fields are protected by mutex.
+	Platform::Mutex mutex;
+	VFDFlags flags;
+	U64 currentOffset{0};
+};
+
+struct MemoryFS : FileSystem
+{
+	MemoryFS() : root(std::make_shared<MemoryDir>(nullptr)) {}
+
+	virtual Result open(const std::string& path,
+						FileAccessMode accessMode,
+						FileCreateMode createMode,
+						VFD*& outFD,
+						const VFDFlags& flags) override
+	{
+		std::vector<std::string> components;
+		splitPath(path, components);
+
+		MemoryNodeRef node;
+		if(components.empty()) { node = root; }
+		else
+		{
+			std::shared_ptr<MemoryDir> parent;
+			Result result = getParentDir(components, parent);
+			if(result != Result::success) { return result; }
+
+			const bool mayCreate = createMode == FileCreateMode::createAlways
+								   || createMode == FileCreateMode::createNew
+								   || createMode == FileCreateMode::openAlways;
+
+			Platform::RWMutex::Lock parentLock(
+				parent->getMutex(),
+				mayCreate ? Platform::RWMutex::exclusive : Platform::RWMutex::shareable);
+			if(parent->isRemoved) { return Result::doesNotExist; }
+
+			const MemoryNodeRef* existingNode = parent->children.get(components.back());
+			if(existingNode)
+			{
+				if(createMode == FileCreateMode::createNew) { return Result::alreadyExists; }
+				node = *existingNode;
+			}
+			else if(!mayCreate)
+			{
+				return Result::doesNotExist;
+			}
+			else
+			{
+				node = std::make_shared<MemoryFile>();
+				parent->children.addOrFail(components.back(), node);
+				parent->lastWriteTime = getCurrentTime();
+
+				// There's no need to truncate the file that was just created.
+				createMode = FileCreateMode::openExisting;
+			}
+		}
+
+		if(node->type == FileType::directory)
+		{
+			if(accessMode == FileAccessMode::writeOnly || accessMode == FileAccessMode::readWrite
+			   || createMode == FileCreateMode::createAlways
+			   || createMode == FileCreateMode::truncateExisting)
+			{ return Result::isDirectory; }
+		}
+		else if(createMode == FileCreateMode::createAlways
+				|| createMode == FileCreateMode::truncateExisting)
+		{
+			MemoryFile* file = static_cast<MemoryFile*>(node.get());
+			Platform::RWMutex::ExclusiveLock fileLock(file->getMutex());
+			file->resize(0);
+			file->lastWriteTime = getCurrentTime();
+		}
+
+		outFD = new MemoryVFD(std::move(node), accessMode, flags);
+		return Result::success;
+	}
+
+	virtual Result getFileInfo(const std::string& path, FileInfo& outInfo) override
+	{
+		MemoryNodeRef node;
+		Result result = getNode(path, node);
+		if(result != Result::success) { return result; }
+
+		Platform::RWMutex::ShareableLock nodeLock(node->getMutex());
+		node->getFileInfo(outInfo);
+		return Result::success;
+	}
+
+	virtual Result setFileTimes(const std::string& path,
+								bool setLastAccessTime,
+								Time lastAccessTime,
+								bool setLastWriteTime,
+								Time lastWriteTime) override
+	{
+		MemoryNodeRef node;
+		Result result = getNode(path, node);
+		if(result != Result::success) { return result; }
+
+		Platform::RWMutex::ExclusiveLock nodeLock(node->getMutex());
+		if(setLastAccessTime) { node->lastAccessTime = lastAccessTime; }
+		if(setLastWriteTime) { node->lastWriteTime = lastWriteTime; }
+		return Result::success;
+	}
+
+	virtual Result openDir(const std::string& path, DirEntStream*& outStream) override
+	{
+		MemoryNodeRef node;
+		Result result = getNode(path, node);
+		if(result != Result::success) { return result; }
+		if(node->type != FileType::directory) { return Result::isNotDirectory; }
+
+		std::vector<DirEnt> dirEnts;
+		getDirEnts(static_cast<MemoryDir*>(node.get()), dirEnts);
+		outStream = new DirEntVectorStream(std::move(dirEnts));
+		return Result::success;
+	}
+
+	virtual Result renameFile(const std::string& oldPath, const std::string& newPath) override
+	{
+		std::vector<std::string> oldComponents;
+		std::vector<std::string> newComponents;
+		splitPath(oldPath, oldComponents);
+		splitPath(newPath, newComponents);
+		if(oldComponents.empty() || newComponents.empty()) { return Result::busy; }
+
+		Platform::Mutex::Lock renameLock(renameMutex);
+
+		std::shared_ptr<MemoryDir> oldParent;
+		Result result = getParentDir(oldComponents, oldParent);
+		if(result != Result::success) { return result; }
+
+		std::shared_ptr<MemoryDir> newParent;
+		result = getParentDir(newComponents, newParent);
+		if(result != Result::success) { return result; }
+
+		const std::string& oldName = oldComponents.back();
+		const std::string& newName = newComponents.back();
+
+		// Look up the renamed node and the node it replaces. Directories can't be added, removed,
+		// or moved without holding renameMutex, but files may be concurrently created or
+		// unlinked, so retry if the entries changed between looking them up and locking the
+		// nodes.
+		while(true)
+		{
+			MemoryNodeRef node = getChild(oldParent.get(), oldName);
+			if(!node) { return Result::doesNotExist; }
+
+			MemoryNodeRef target = getChild(newParent.get(), newName);
+			if(target == node) { return Result::success; }
+
+			MultiNodeLock nodeLock({oldParent.get(), newParent.get(), node.get(), target.get()});
+			const MemoryNodeRef* lockedNode = oldParent->children.get(oldName);
+			const MemoryNodeRef* lockedTarget = newParent->children.get(newName);
+			if(!lockedNode || *lockedNode != node
+			   || (lockedTarget ? *lockedTarget != target : target != nullptr))
+			{ continue; }
+
+			if(newParent->isRemoved) { return Result::doesNotExist; }
+
+			if(node->type == FileType::directory)
+			{
+				// Don't allow moving a directory into itself or one of its subdirectories.
+				for(const MemoryDir* dir = newParent.get(); dir; dir = dir->parent)
+				{
+					if(dir == node.get()) { return Result::notPermitted; }
+				}
+			}
+
+			if(target)
+			{
+				if(node->type == FileType::directory && target->type != FileType::directory)
+				{ return Result::isNotDirectory; }
+				else if(node->type != FileType::directory
+						&& target->type == FileType::directory)
+				{
+					return Result::isDirectory;
+				}
+				else if(target->type == FileType::directory)
+				{
+					MemoryDir* targetDir = static_cast<MemoryDir*>(target.get());
+					if(targetDir->children.size()) { return Result::isNotEmpty; }
+					targetDir->isRemoved = true;
+					targetDir->parent = nullptr;
+					--newParent->numLinks;
+				}
+				--target->numLinks;
+			}
+
+			oldParent->children.removeOrFail(oldName);
+			newParent->children.set(newName, node);
+
+			if(node->type == FileType::directory && oldParent != newParent)
+			{
+				--oldParent->numLinks;
+				++newParent->numLinks;
+				MemoryDir* dir = static_cast<MemoryDir*>(node.get());
+				dir->parent = newParent.get();
+				dir->parentFileNumber = newParent->fileNumber;
+			}
+
+			const Time now = getCurrentTime();
+			oldParent->lastWriteTime = now;
+			newParent->lastWriteTime = now;
+			return Result::success;
+		}
+	}
+
+	virtual Result unlinkFile(const std::string& path) override
+	{
+		std::vector<std::string> components;
+		splitPath(path, components);
+		if(components.empty()) { return Result::isDirectory; }
+
+		std::shared_ptr<MemoryDir> parent;
+		Result result = getParentDir(components, parent);
+		if(result != Result::success) { return result; }
+
+		Platform::RWMutex::ExclusiveLock parentLock(parent->getMutex());
+		const MemoryNodeRef* node = parent->children.get(components.back());
+		if(!node) { return Result::doesNotExist; }
+		if((*node)->type == FileType::directory) { return Result::isDirectory; }
+
+		--(*node)->numLinks;
+		parent->children.removeOrFail(components.back());
+		parent->lastWriteTime = getCurrentTime();
+		return Result::success;
+	}
+
+	virtual Result removeDir(const std::string& path) override
+	{
+		std::vector<std::string> components;
+		splitPath(path, components);
+		if(components.empty()) { return Result::busy; }
+
+		Platform::Mutex::Lock renameLock(renameMutex);
+
+		std::shared_ptr<MemoryDir> parent;
+		Result result = getParentDir(components, parent);
+		if(result != Result::success) { return result; }
+
+		MemoryNodeRef node = getChild(parent.get(), components.back());
+		if(!node) { return Result::doesNotExist; }
+		if(node->type != FileType::directory) { return Result::isNotDirectory; }
+
+		// Directories can't be removed or replaced without holding renameMutex, so the node is
+		// still the parent's child.
+		MultiNodeLock nodeLock({parent.get(), node.get()});
+		MemoryDir* dir = static_cast<MemoryDir*>(node.get());
+		if(dir->children.size()) { return Result::isNotEmpty; }
+
+		dir->isRemoved = true;
+		dir->parent = nullptr;
+		dir->numLinks = 0;
+		--parent->numLinks;
+		parent->children.removeOrFail(components.back());
+		parent->lastWriteTime = getCurrentTime();
+		return Result::success;
+	}
+
+	virtual Result createDir(const std::string& path) override
+	{
+		std::vector<std::string> components;
+		splitPath(path, components);
+		if(components.empty()) { return Result::alreadyExists; }
+
+		std::shared_ptr<MemoryDir> parent;
+		Result result = getParentDir(components, parent);
+		if(result != Result::success) { return result; }
+
+		Platform::RWMutex::ExclusiveLock parentLock(parent->getMutex());
+		if(parent->isRemoved) { return Result::doesNotExist; }
+		if(parent->children.contains(components.back())) { return Result::alreadyExists; }
+
+		parent->children.addOrFail(components.back(), std::make_shared<MemoryDir>(parent.get()));
+		++parent->numLinks;
+		parent->lastWriteTime = getCurrentTime();
+		return Result::success;
+	}
+
+private:
+	const std::shared_ptr<MemoryDir> root;
+
+	// Serializes operations that add, remove, or move directories, so they can lock multiple nodes
+	// without deadlocking, and to protect MemoryDir::parent.
+	Platform::Mutex renameMutex;
+
+	static MemoryNodeRef getChild(const MemoryDir* dir, const std::string& name)
+	{
+		Platform::RWMutex::ShareableLock dirLock(dir->getMutex());
+		const MemoryNodeRef* child = dir->children.get(name);
+		return child ? *child : nullptr;
+	}
+
+	// Looks up the node at the given path components.
+	Result getNode(const std::vector<std::string>& components,
+				   Uptr numComponents,
+				   MemoryNodeRef& outNode)
+	{
+		MemoryNodeRef node = root;
+		for(Uptr componentIndex = 0; componentIndex < numComponents; ++componentIndex)
+		{
+			if(node->type != FileType::directory) { return Result::isNotDirectory; }
+
+			node = getChild(static_cast<MemoryDir*>(node.get()), components[componentIndex]);
+			if(!node) { return Result::doesNotExist; }
+		}
+
+		outNode = std::move(node);
+		return Result::success;
+	}
+
+	Result getNode(const std::string& path, MemoryNodeRef& outNode)
+	{
+		std::vector<std::string> components;
+		splitPath(path, components);
+		return getNode(components, components.size(), outNode);
+	}
+
+	// Looks up the directory containing the last of the given path components.
+	Result getParentDir(const std::vector<std::string>& components,
+						std::shared_ptr<MemoryDir>& outDir)
+	{
+		WAVM_ASSERT(components.size());
+
+		MemoryNodeRef node;
+		Result result = getNode(components, components.size() - 1, node);
+		if(result != Result::success) { return result; }
+		if(node->type != FileType::directory) { return Result::isNotDirectory; }
+
+		outDir = std::static_pointer_cast<MemoryDir>(node);
+		return Result::success;
+	}
+};
+
+std::shared_ptr<FileSystem> VFS::makeMemoryFS() { return std::make_shared<MemoryFS>(); }
@@ -0,0 +1,633 @@
+#include "WAVM/VFS/OverlayFS.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include "VFSPrivate.h"
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/HashSet.h"
+#include "WAVM/Inline/Time.h"
+#include "WAVM/Platform/RWMutex.h"
+#include "WAVM/VFS/VFS.h"
+
+using namespace WAVM;
+using namespace WAVM::VFS;
+
+// The number of bytes copied at a time when copying a file from the lower to the upper FS.
+static constexpr Uptr numCopyBufferBytes = 65536;
+
+struct OverlayFS;
+
+// Wraps a VFD opened from the overlay's lower or upper FS. Reading a directory's entries lists the
+// merged directory. A VFD from the lower FS rejects changes to the file instead of copying it to
+// the upper FS: the file may have been renamed or shadowed since it was opened, and the VFD may be
+// in use on other threads, so it can't be switched to a copy.
+struct OverlayVFD : VFD
+{
+	OverlayVFD(OverlayFS* inFS,
+			   VFD* inInnerVFD,
+			   std::string&& inPath,
+			   bool inIsDirectory,
+			   bool inIsLower)
+	: fs(inFS)
+	, innerVFD(inInnerVFD)
+	, path(std::move(inPath))
+	, isDirectory(inIsDirectory)
+	, isLower(inIsLower)
+	{
+	}
+
+	virtual Result close() override
+	{
+		Result result = innerVFD->close();
+		delete this;
+		return result;
+	}
+
+	virtual Result seek(I64 offset, SeekOrigin origin, U64* outAbsoluteOffset = nullptr) override
+	{
+		return innerVFD->seek(offset, origin, outAbsoluteOffset);
+	}
+	virtual Result readv(const IOReadBuffer* buffers,
+						 Uptr numBuffers,
+						 Uptr* outNumBytesRead = nullptr,
+						 const U64* offset = nullptr) override
+	{
+		return innerVFD->readv(buffers, numBuffers, outNumBytesRead, offset);
+	}
+	virtual Result writev(const IOWriteBuffer* buffers,
+						  Uptr numBuffers,
+						  Uptr* outNumBytesWritten = nullptr,
+						  const U64* offset = nullptr) override
+	{
+		if(isLower) { return Result::notPermitted; }
+		return innerVFD->writev(buffers, numBuffers, outNumBytesWritten, offset);
+	}
+
+	virtual Result sync(SyncType type) override { return innerVFD->sync(type); }
+
+	virtual Result getVFDInfo(VFDInfo& outInfo) override { return innerVFD->getVFDInfo(outInfo); }
+	virtual Result getFileInfo(FileInfo& outInfo) override
+	{
+		return innerVFD->getFileInfo(outInfo);
+	}
+	virtual Result setVFDFlags(const VFDFlags& flags) override
+	{
+		return innerVFD->setVFDFlags(flags);
+	}
+	virtual Result setFileSize(U64 numBytes) override
+	{
+		if(isLower) { return Result::notPermitted; }
+		return innerVFD->setFileSize(numBytes);
+	}
+	virtual Result setFileTimes(bool setLastAccessTime,
+								Time lastAccessTime,
+								bool setLastWriteTime,
+								Time lastWriteTime) override
+	{
+		if(isLower) { return Result::notPermitted; }
+		return innerVFD->setFileTimes(
+			setLastAccessTime, lastAccessTime, setLastWriteTime, lastWriteTime);
+	}
+
+	virtual Result openDir(DirEntStream*& outStream) override;
+
+	virtual Result mapCopyOnWrite(U64 offset, Uptr numBytes, U8* destAddress) override
+	{
+		return innerVFD->mapCopyOnWrite(offset, numBytes, destAddress);
+	}
+
+private:
+	OverlayFS* fs;
+	VFD* innerVFD;
+	std::string path;
+	bool isDirectory;
+	bool isLower;
+};
+
+struct OverlayFS : FileSystem
+{
+	OverlayFS(FileSystem* inLowerFS, FileSystem* inUpperFS)
+	: lowerFS(inLowerFS), upperFS(inUpperFS)
+	{
+	}
+
+	virtual Result open(const std::string& inPath,
+						FileAccessMode accessMode,
+						FileCreateMode createMode,
+						VFD*& outFD,
+						const VFDFlags& flags) override
+	{
+		std::vector<std::string> components;
+		splitPath(inPath, components);
+		std::string path = joinPath(components, components.size());
+
+		// Opening an existing file without writing to it doesn't modify the overlay, so only
+		// needs a shareable lock.
+		const bool isWrite
+			= accessMode == FileAccessMode::writeOnly || accessMode == FileAccessMode::readWrite
+			  || createMode == FileCreateMode::createAlways
+			  || createMode == FileCreateMode::truncateExisting;
+		const bool isReadOnly = !isWrite && createMode == FileCreateMode::openExisting;
+		Platform::RWMutex::Lock lock(
+			mutex, isReadOnly ? Platform::RWMutex::shareable : Platform::RWMutex::exclusive);
+
+		FileInfo fileInfo;
+		bool isInUpper = false;
+		Result result = getMergedFileInfo(components, path, fileInfo, isInUpper);
+		if(result == Result::success)
+		{
+			if(createMode == FileCreateMode::createNew) { return Result::alreadyExists; }
+
+			if(!isInUpper && fileInfo.type != FileType::directory && isWrite)
+			{
+				// Copy the file to the upper FS before modifying it. If it will be truncated, don't
+				// bother copying its contents.
+				const bool copyContents = createMode != FileCreateMode::createAlways
+										  && createMode != FileCreateMode::truncateExisting;
+				result = copyUp(components, path, fileInfo, copyContents);
+				if(result != Result::success) { return result; }
+				isInUpper = true;
+			}
+		}
+		else if(result == Result::doesNotExist)
+		{
+			if(createMode == FileCreateMode::openExisting
+			   || createMode == FileCreateMode::truncateExisting)
+			{ return Result::doesNotExist; }
+
+			// Create the file in the upper FS, creating its parent directory there if it's
+			// only in the lower FS.
+			result = ensureUpperParentDir(components);
+			if(result != Result::success) { return result; }
+			fileInfo.type = FileType::file;
+			isInUpper = true;
+		}
+		else
+		{
+			return result;
+		}
+
+		FileSystem* fs = isInUpper ? upperFS : lowerFS;
+		VFD* vfd = nullptr;
+		result = fs->open(path, accessMode, createMode, vfd, flags);
+		if(result != Result::success) { return result; }
+
+		// Files in the upper FS don't need to be wrapped, since they can be modified directly.
+		const bool isDirectory = fileInfo.type == FileType::directory;
+		if(!isInUpper || isDirectory)
+		{ vfd = new OverlayVFD(this, vfd, std::move(path), isDirectory, !isInUpper); }
+
+		outFD = vfd;
+		return Result::success;
+	}
+
+	virtual Result getFileInfo(const std::string& inPath, FileInfo& outInfo) override
+	{
+		std::vector<std::string> components;
+		splitPath(inPath, components);
+		const std::string path = joinPath(components, components.size());
+
+		Platform::RWMutex::ShareableLock lock(mutex);
+		bool isInUpper = false;
+		return getMergedFileInfo(components, path, outInfo, isInUpper);
+	}
+
+	virtual Result setFileTimes(const std::string& inPath,
+								bool setLastAccessTime,
+								Time lastAccessTime,
+								bool setLastWriteTime,
+								Time lastWriteTime) override
+	{
+		std::vector<std::string> components;
+		splitPath(inPath, components);
+		const std::string path = joinPath(components, components.size());
+
+		Platform::RWMutex::ExclusiveLock lock(mutex);
+		Result result = ensureUpper(components, path);
+		if(result != Result::success) { return result; }
+
+		return upperFS->setFileTimes(
+			path, setLastAccessTime, lastAccessTime, setLastWriteTime, lastWriteTime);
+	}
+
+	virtual Result openDir(const std::string& inPath, DirEntStream*& outStream) override
+	{
+		std::vector<std::string> components;
+		splitPath(inPath, components);
+		const std::string path = joinPath(components, components.size());
+
+		Platform::RWMutex::ShareableLock lock(mutex);
+		std::vector<DirEnt> dirEnts;
+		Result result = getMergedDirEnts(components, path, dirEnts);
+		if(result != Result::success) { return result; }
+
+		// Snapshot the merged directory, since it can't be iterated incrementally.
+		outStream = new DirEntVectorStream(std::move(dirEnts));
+		return Result::success;
+	}
+
+	virtual Result renameFile(const std::string& inOldPath, const std::string& inNewPath) override
+	{
+		std::vector<std::string> oldComponents;
+		std::vector<std::string> newComponents;
+		splitPath(inOldPath, oldComponents);
+		splitPath(inNewPath, newComponents);
+		if(oldComponents.empty() || newComponents.empty()) { return Result::busy; }
+		const std::string oldPath = joinPath(oldComponents, oldComponents.size());
+		const std::string newPath = joinPath(newComponents, newComponents.size());
+
+		Platform::RWMutex::ExclusiveLock lock(mutex);
+
+		FileInfo oldInfo;
+		bool isOldInUpper = false;
+		Result result = getMergedFileInfo(oldComponents, oldPath, oldInfo, isOldInUpper);
+		if(result != Result::success) { return result; }
+
+		FileInfo newInfo;
+		bool isNewInUpper = false;
+		result = getMergedFileInfo(newComponents, newPath, newInfo, isNewInUpper);
+		if(result == Result::success)
+		{
+			if(oldInfo.type == FileType::directory && newInfo.type != FileType::directory)
+			{ return Result::isNotDirectory; }
+			else if(oldInfo.type != FileType::directory && newInfo.type == FileType::directory)
+			{
+				return Result::isDirectory;
+			}
+			else if(newInfo.type == FileType::directory)
+			{
+				result = checkMergedDirIsEmpty(newComponents, newPath);
+				if(result != Result::success) { return result; }
+			}
+		}
+		else if(result != Result::doesNotExist)
+		{
+			return result;
+		}
+
+		const bool isOldInLower = isInLower(oldComponents, oldPath);
+		const bool isNewInLower = isInLower(newComponents, newPath);
+
+		// Copy the renamed file or directory tree to the upper FS, and rename it there. A directory
+		// that is already in the upper FS may still have children that are only in the lower FS,
+		// which must be copied up before the whiteout of the old path hides them.
+		if(!isOldInUpper || (oldInfo.type == FileType::directory && isOldInLower))
+		{
+			result = copyUpTree(oldComponents, oldPath, oldInfo);
+			if(result != Result::success) { return result; }
+		}
+
+		result = ensureUpperParentDir(newComponents);
+		if(result != Result::success) { return result; }
+
+		result = upperFS->renameFile(oldPath, newPath);
+		if(result != Result::success) { return result; }
+
+		// Hide the old path in the lower FS, as well as anything the rename replaced in the lower
+		// FS, which would otherwise show through the renamed directory.
+		if(isOldInLower) { whiteouts.add(oldPath); }
+		if(isNewInLower) { whiteouts.add(newPath); }
+		return Result::success;
+	}
+
+	virtual Result unlinkFile(const std::string& inPath) override
+	{
+		std::vector<std::string> components;
+		splitPath(inPath, components);
+		if(components.empty()) { return Result::isDirectory; }
+		const std::string path = joinPath(components, components.size());
+
+		Platform::RWMutex::ExclusiveLock lock(mutex);
+
+		FileInfo fileInfo;
+		bool isInUpper = false;
+		Result result = getMergedFileInfo(components, path, fileInfo, isInUpper);
+		if(result != Result::success) { return result; }
+		if(fileInfo.type == FileType::directory) { return Result::isDirectory; }
+
+		if(isInUpper)
+		{
+			result = upperFS->unlinkFile(path);
+			if(result != Result::success) { return result; }
+		}
+		if(isInLower(components, path)) { whiteouts.add(path); }
+		return Result::success;
+	}
+
+	virtual Result removeDir(const std::string& inPath) override
+	{
+		std::vector<std::string> components;
+		splitPath(inPath, components);
+		if(components.empty()) { return Result::busy; }
+		const std::string path = joinPath(components, components.size());
+
+		Platform::RWMutex::ExclusiveLock lock(mutex);
+
+		FileInfo fileInfo;
+		bool isInUpper = false;
+		Result result = getMergedFileInfo(components, path, fileInfo, isInUpper);
+		if(result != Result::success) { return result; }
+		if(fileInfo.type != FileType::directory) { return Result::isNotDirectory; }
+
+		result = checkMergedDirIsEmpty(components, path);
+		if(result != Result::success) { return result; }
+
+		if(isInUpper)
+		{
+			result = upperFS->removeDir(path);
+			if(result != Result::success) { return result; }
+		}
+		if(isInLower(components, path)) { whiteouts.add(path); }
+		return Result::success;
+	}
+
+	virtual Result createDir(const std::string& inPath) override
+	{
+		std::vector<std::string> components;
+		splitPath(inPath, components);
+		if(components.empty()) { return Result::alreadyExists; }
+		const std::string path = joinPath(components, components.size());
+
+		Platform::RWMutex::ExclusiveLock lock(mutex);
+
+		FileInfo fileInfo;
+		bool isInUpper = false;
+		Result result = getMergedFileInfo(components, path, fileInfo, isInUpper);
+		if(result == Result::success) { return Result::alreadyExists; }
+		else if(result != Result::doesNotExist)
+		{
+			return result;
+		}
+
+		// If the path was deleted from the lower FS, its whiteout remains, and hides the contents
+		// of the deleted directory in the lower FS from the new directory.
+		result = ensureUpperParentDir(components);
+		if(result != Result::success) { return result; }
+		return upperFS->createDir(path);
+	}
+
+private:
+	FileSystem* lowerFS;
+	FileSystem* upperFS;
+
+	// Protects whiteouts, and serializes modifications of the overlay.
+	Platform::RWMutex mutex;
+
+	// The paths of files and directories that have been deleted from the lower FS. A whiteout
+	// hides the path and everything beneath it in the lower FS, even if the path is recreated in
+	// the upper FS.
+	HashSet<std::string> whiteouts;
+
+	// Returns whether the lower FS is visible at the given path.
+	bool isLowerVisible(const std::vector<std::string>& components, Uptr numComponents)
+	{
+		std::string prefix;
+		for(Uptr componentIndex = 0; componentIndex < numComponents; ++componentIndex)
+		{
+			prefix += '/';
+			prefix += components[componentIndex];
+			if(whiteouts.contains(prefix)) { return false; }
+		}
+		return true;
+	}
+
+	// Returns whether there's a visible file or directory in the lower FS at the given path.
+	bool isInLower(const std::vector<std::string>& components, const std::string& path)
+	{
+		FileInfo lowerInfo;
+		return isLowerVisible(components, components.size())
+			   && lowerFS->getFileInfo(path, lowerInfo) == Result::success;
+	}
+
+	Result getMergedFileInfo(const std::vector<std::string>& components,
+							 const std::string& path,
+							 FileInfo& outInfo,
+							 bool& outIsInUpper)
+	{
+		Result result = upperFS->getFileInfo(path, outInfo);
+		if(result != Result::doesNotExist)
+		{
+			outIsInUpper = result == Result::success;
+			return result;
+		}
+
+		outIsInUpper = false;
+		if(!isLowerVisible(components, components.size())) { return Result::doesNotExist; }
+		return lowerFS->getFileInfo(path, outInfo);
+	}
+
+	Result getMergedDirEnts(const std::vector<std::string>& components,
+							const std::string& path,
+							std::vector<DirEnt>& outDirEnts)
+	{
+		FileInfo fileInfo;
+		bool isInUpper = false;
+		Result result = getMergedFileInfo(components, path, fileInfo, isInUpper);
+		if(result != Result::success) { return result; }
+		if(fileInfo.type != FileType::directory) { return Result::isNotDirectory; }
+
+		// Add the entries in the upper FS, then the entries in the lower FS that aren't shadowed
+		// by an entry in the upper FS or a whiteout.
+		HashSet<std::string> names;
+		DirEntStream* dirEntStream = nullptr;
+		DirEnt dirEnt;
+		if(isInUpper && upperFS->openDir(path, dirEntStream) == Result::success)
+		{
+			while(dirEntStream->getNext(dirEnt))
+			{
+				names.add(dirEnt.name);
+				outDirEnts.push_back(dirEnt);
+			}
+			dirEntStream->close();
+		}
+
+		if(isLowerVisible(components, components.size())
+		   && lowerFS->openDir(path, dirEntStream) == Result::success)
+		{
+			const std::string pathPrefix = components.empty() ? "/" : path + '/';
+			while(dirEntStream->getNext(dirEnt))
+			{
+				if(!names.contains(dirEnt.name) && !whiteouts.contains(pathPrefix + dirEnt.name))
+				{
+					names.add(dirEnt.name);
+					outDirEnts.push_back(dirEnt);
+				}
+			}
+			dirEntStream->close();
+		}
+
+		return Result::success;
+	}
+
+	Result checkMergedDirIsEmpty(const std::vector<std::string>& components,
+								 const std::string& path)
+	{
+		std::vector<DirEnt> dirEnts;
+		Result result = getMergedDirEnts(components, path, dirEnts);
+		if(result != Result::success) { return result; }
+
+		for(const DirEnt& dirEnt : dirEnts)
+		{
+			if(dirEnt.name != "." && dirEnt.name != "..") { return Result::isNotEmpty; }
+		}
+		return Result::success;
+	}
+
+	// Creates the directories leading to a path in the upper FS.
+	Result ensureUpperDirs(const std::vector<std::string>& components, Uptr numComponents)
+	{
+		for(Uptr numPrefixComponents = 1; numPrefixComponents <= numComponents;
+			++numPrefixComponents)
+		{
+			const std::string prefix = joinPath(components, numPrefixComponents);
+
+			FileInfo upperInfo;
+			Result result = upperFS->getFileInfo(prefix, upperInfo);
+			if(result == Result::success)
+			{
+				if(upperInfo.type != FileType::directory) { return Result::isNotDirectory; }
+				continue;
+			}
+			else if(result != Result::doesNotExist)
+			{
+				return result;
+			}
+
+			// Only create the directory in the upper FS if it exists in the lower FS.
+			FileInfo lowerInfo;
+			if(!isLowerVisible(components, numPrefixComponents)) { return Result::doesNotExist; }
+			result = lowerFS->getFileInfo(prefix, lowerInfo);
+			if(result != Result::success) { return result; }
+			if(lowerInfo.type != FileType::directory) { return Result::isNotDirectory; }
+
+			result = upperFS->createDir(prefix);
+			if(result != Result::success) { return result; }
+			upperFS->setFileTimes(
+				prefix, true, lowerInfo.lastAccessTime, true, lowerInfo.lastWriteTime);
+		}
+		return Result::success;
+	}
+
+	Result ensureUpperParentDir(const std::vector<std::string>& components)
+	{
+		WAVM_ASSERT(components.size());
+		return ensureUpperDirs(components, components.size() - 1);
+	}
+
+	// Copies a file from the lower FS to the upper FS.
+	Result copyUp(const std::vector<std::string>& components,
+				  const std::string& path,
+				  const FileInfo& lowerInfo,
+				  bool copyContents)
+	{
+		Result result = ensureUpperParentDir(components);
+		if(result != Result::success) { return result; }
+
+		VFD* upperVFD = nullptr;
+		result = upperFS->open(
+			path, FileAccessMode::writeOnly, FileCreateMode::createNew, upperVFD);
+		if(result != Result::success) { return result; }
+
+		if(copyContents)
+		{
+			VFD* lowerVFD = nullptr;
+			result = lowerFS->open(
+				path, FileAccessMode::readOnly, FileCreateMode::openExisting, lowerVFD);
+			if(result == Result::success)
+			{
+				std::unique_ptr<U8[]> buffer(new U8[numCopyBufferBytes]);
+				while(true)
+				{
+					Uptr numBytesRead = 0;
+					result = lowerVFD->read(buffer.get(), numCopyBufferBytes, &numBytesRead);
+					if(result != Result::success || !numBytesRead) { break; }
+
+					Uptr numBytesWritten = 0;
+					result = upperVFD->write(buffer.get(), numBytesRead, &numBytesWritten);
+					if(result != Result::success) { break; }
+					if(numBytesWritten != numBytesRead)
+					{
+						result = Result::outOfFreeSpace;
+						break;
+					}
+				}
+				lowerVFD->close();
+			}
+		}
+
+		upperVFD->close();
+
+		if(result != Result::success)
+		{
+			upperFS->unlinkFile(path);
+			return result;
+		}
+
+		return upperFS->setFileTimes(
+			path, true, lowerInfo.lastAccessTime, true, lowerInfo.lastWriteTime);
+	}
+
+	// Copies a file or directory tree from the lower FS to the upper FS.
+	Result copyUpTree(const std::vector<std::string>& components,
+					  const std::string& path,
+					  const FileInfo& info)
+	{
+		if(info.type != FileType::directory) { return copyUp(components, path, info, true); }
+
+		Result result = ensureUpperDirs(components, components.size());
+		if(result != Result::success) { return result; }
+
+		std::vector<DirEnt> dirEnts;
+		result = getMergedDirEnts(components, path, dirEnts);
+		if(result != Result::success) { return result; }
+
+		for(const DirEnt& dirEnt : dirEnts)
+		{
+			if(dirEnt.name == "." || dirEnt.name == "..") { continue; }
+
+			std::vector<std::string> childComponents = components;
+			childComponents.push_back(dirEnt.name);
+			const std::string childPath = joinPath(childComponents, childComponents.size());
+
+			FileInfo childInfo;
+			bool isChildInUpper = false;
+			result = getMergedFileInfo(childComponents, childPath, childInfo, isChildInUpper);
+			if(result != Result::success) { return result; }
+
+			if(!isChildInUpper || childInfo.type == FileType::directory)
+			{
+				result = copyUpTree(childComponents, childPath, childInfo);
+				if(result != Result::success) { return result; }
+			}
+		}
+		return Result::success;
+	}
+
+	// Ensures that a file or directory is in the upper FS, copying it from the lower FS if needed.
+	Result ensureUpper(const std::vector<std::string>& components, const std::string& path)
+	{
+		FileInfo fileInfo;
+		bool isInUpper = false;
+		Result result = getMergedFileInfo(components, path, fileInfo, isInUpper);
+		if(result != Result::success || isInUpper) { return result; }
+
+		if(fileInfo.type == FileType::directory)
+		{ return ensureUpperDirs(components, components.size()); }
+		else
+		{
+			return copyUp(components, path, fileInfo, true);
+		}
+	}
+};
+
+Result OverlayVFD::openDir(DirEntStream*& outStream)
+{
+	if(!isDirectory) { return innerVFD->openDir(outStream); }
+	return fs->openDir(path, outStream);
+}
+
+std::shared_ptr<FileSystem> VFS::makeOverlayFS(FileSystem* lowerFS, FileSystem* upperFS)
+{
+	return std::make_shared<OverlayFS>(lowerFS, upperFS);
+}
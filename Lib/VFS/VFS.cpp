@@ -1,4 +1,8 @@
 #include "WAVM/VFS/VFS.h"
+#include <string>
+#include <vector>
+#include "VFSPrivate.h"
+#include "WAVM/Inline/Assert.h"
 #include "WAVM/Inline/Errors.h"
 
 using namespace WAVM;
@@ -17,3 +21,49 @@ WAVM_ENUM_VFS_RESULTS(V)
 	default: WAVM_UNREACHABLE();
 	};
 }
+
+void VFS::splitPath(const std::string& path, std::vector<std::string>& outComponents)
+{
+	outComponents.clear();
+
+	Uptr componentStart = 0;
+	while(componentStart < path.size())
+	{
+		if(path[componentStart] == '/')
+		{
+			++componentStart;
+			continue;
+		}
+
+		Uptr componentEnd = path.find('/', componentStart);
+		if(componentEnd == std::string::npos) { componentEnd = path.size(); }
+
+		const Uptr numComponentChars = componentEnd - componentStart;
+		if(numComponentChars == 1 && path[componentStart] == '.') {}
+		else if(numComponentChars == 2 && path[componentStart] == '.'
+				&& path[componentStart + 1] == '.')
+		{
+			if(outComponents.size()) { outComponents.pop_back(); }
+		}
+		else
+		{
+			outComponents.emplace_back(path, componentStart, numComponentChars);
+		}
+
+		componentStart = componentEnd;
+	}
+}
+
+std::string VFS::joinPath(const std::vector<std::string>& components, Uptr numComponents)
+{
+	WAVM_ASSERT(numComponents <= components.size());
+	if(!numComponents) { return "/"; }
+
+	std::string result;
+	for(Uptr componentIndex = 0; componentIndex < numComponents; ++componentIndex)
+	{
+		result += '/';
+		result += components[componentIndex];
+	}
+	return result;
+}
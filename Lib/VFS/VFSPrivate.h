@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Platform/Mutex.h"
+#include "WAVM/VFS/VFS.h"
+
+namespace WAVM { namespace VFS {
+
+	// Splits a path into its components. Empty and "." components are ignored, and ".." components
+	// are resolved lexically without allowing them to escape the root.
+	void splitPath(const std::string& path, std::vector<std::string>& outComponents);
+
+	// Joins path components into a canonical absolute path.
+	std::string joinPath(const std::vector<std::string>& components, Uptr numComponents);
+
+	// A DirEntStream that iterates over a snapshot of a directory's entries.
+	struct DirEntVectorStream : DirEntStream
+	{
+		DirEntVectorStream(std::vector<DirEnt>&& inDirEnts) : dirEnts(std::move(inDirEnts)) {}
+
+		virtual void close() override { delete this; }
+
+		virtual bool getNext(DirEnt& outEntry) override
+		{
+			Platform::Mutex::Lock lock(mutex);
+			if(nextIndex >= dirEnts.size()) { return false; }
+			outEntry = dirEnts[nextIndex++];
+			return true;
+		}
+
+		virtual void restart() override
+		{
+			Platform::Mutex::Lock lock(mutex);
+			nextIndex = 0;
+		}
+
+		virtual U64 tell() override
+		{
+			Platform::Mutex::Lock lock(mutex);
+			return nextIndex;
+		}
+
+		virtual bool seek(U64 offset) override
+		{
+			Platform::Mutex::Lock lock(mutex);
+			if(offset > dirEnts.size()) { return false; }
+			nextIndex = Uptr(offset);
+			return true;
+		}
+
+	private:
+		Platform::Mutex mutex;
+		std::vector<DirEnt> dirEnts;
+		Uptr nextIndex{0};
+	};
+}}
@@ -1,8 +1,10 @@
 #include "WAVM/WASI/WASI.h"
+#include <string.h>
+#include <algorithm>
 #include "./WASIPrivate.h"
 #include "WAVM/IR/Types.h"
 #include "WAVM/Inline/BasicTypes.h"
-#include "WAVM/Inline/IndexMap.h"
+#include "WAVM/Inline/ChaCha20.h"
 #include "WAVM/Logging/Logging.h"
 #include "WAVM/Platform/Clock.h"
 #include "WAVM/Platform/Defines.h"
@@ -89,6 +91,79 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wasi,
 	UNIMPLEMENTED_SYSCALL("proc_raise", "(%u)", sig);
 }
 
+// A per-thread ChaCha20 keystream generator that is seeded from the platform's cryptographic RNG,
+// so most random_get calls can be satisfied without a syscall. After each refill of the buffer,
+// the key is replaced with the first bytes of the new keystream, and the bytes in the buffer are
+// cleared as they are consumed, so a later compromise of the state can't reveal earlier output.
+// If the process forks, the child reseeds instead of generating the same bytes as the parent.
+struct BufferedCryptographicRNG
+{
+	void read(U8* outRandomBytes, Uptr numBytes)
+	{
+		const U64 currentForkGeneration = Platform::getForkGeneration();
+		if(currentForkGeneration != forkGeneration)
+		{
+			forkGeneration = currentForkGeneration;
+			numRefillsUntilReseed = 0;
+			nextBufferByte = numBufferBytes;
+		}
+
+		while(numBytes > 0)
+		{
+			if(nextBufferByte == numBufferBytes) { refill(); }
+
+			const Uptr numBytesToCopy = std::min(numBytes, numBufferBytes - nextBufferByte);
+			memcpy(outRandomBytes, buffer + nextBufferByte, numBytesToCopy);
+			memset(buffer + nextBufferByte, 0, numBytesToCopy);
+			outRandomBytes += numBytesToCopy;
+			numBytes -= numBytesToCopy;
+			nextBufferByte += numBytesToCopy;
+		}
+	}
+
+private:
+	static constexpr Uptr numBlocksPerRefill = 16;
+	static constexpr Uptr numBufferBytes = numBlocksPerRefill * ChaCha20::numBlockBytes;
+	static constexpr Uptr numRefillsPerReseed = 1024;
+
+	U32 key[8];
+	U64 blockCounter = 0;
+	Uptr numRefillsUntilReseed = 0;
+	U8 buffer[numBufferBytes];
+	Uptr nextBufferByte = numBufferBytes;
+
+	// The fork generation that the state was seeded in.
+	U64 forkGeneration = 0;
+
+	void generateBlock(U8* outBlock)
+	{
+		const U32 counterAndNonce[4] = {U32(blockCounter), U32(blockCounter >> 32), 0, 0};
+		ChaCha20::generateBlock(key, counterAndNonce, outBlock);
+		++blockCounter;
+	}
+
+	void refill()
+	{
+		if(numRefillsUntilReseed == 0)
+		{
+			Platform::getCryptographicRNG((U8*)key, sizeof(key));
+			numRefillsUntilReseed = numRefillsPerReseed;
+		}
+		--numRefillsUntilReseed;
+
+		for(Uptr blockIndex = 0; blockIndex < numBlocksPerRefill; ++blockIndex)
+		{ generateBlock(buffer + blockIndex * ChaCha20::numBlockBytes); }
+
+		// Rekey from the start of the keystream, and don't return those bytes.
+		memcpy(key, buffer, sizeof(key));
+		memset(buffer, 0, sizeof(key));
+		blockCounter = 0;
+		nextBufferByte = sizeof(key);
+	}
+};
+
+static thread_local BufferedCryptographicRNG bufferedCryptographicRNG;
+
 WAVM_DEFINE_INTRINSIC_FUNCTION(wasi,
 							   "random_get",
 							   __wasi_errno_return_t,
@@ -104,7 +179,7 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wasi,
 	Runtime::catchRuntimeExceptions(
 		[&] {
 			U8* buffer = memoryArrayPtr<U8>(process->memory, bufferAddress, numBufferBytes);
-			Platform::getCryptographicRNG(buffer, numBufferBytes);
+			bufferedCryptographicRNG.read(buffer, numBufferBytes);
 		},
 		[&](Runtime::Exception* exception) {
 			WAVM_ASSERT(getExceptionType(exception) == ExceptionTypes::outOfBoundsMemoryAccess);
@@ -174,8 +249,7 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wasi, "sched_yield", __wasi_errno_return_t, wasi_
 
 WASI::Process::~Process()
 {
-	for(const std::shared_ptr<WASI::FDE>& fde : fdMap)
-	{
+	fdTable.forEach([](__wasi_fd_t fd, FDE* fde) {
 		VFS::Result result = fde->close();
 		if(result != VFS::Result::success)
 		{
@@ -183,7 +257,8 @@ WASI::Process::~Process()
 						"Error while closing file because of process exit: %s\n",
 						VFS::describeResult(result));
 		}
-	}
+		delete fde;
+	});
 }
 
 std::shared_ptr<Process> WASI::createProcess(Runtime::Compartment* compartment,
@@ -213,13 +288,20 @@ std::shared_ptr<Process> WASI::createProcess(Runtime::Compartment* compartment,
 	process->resolver.moduleNameToInstanceMap.set("wasi_unstable", wasi_snapshot_preview1);
 	process->resolver.moduleNameToInstanceMap.set("wasi_snapshot_preview1", wasi_snapshot_preview1);
 
+	// WAVM's extensions to WASI are imported from a separate module, so they can't conflict with
+	// future additions to WASI.
+	Instance* wavm_wasi_extensions = Intrinsics::instantiateModule(
+		compartment, {WAVM_INTRINSIC_MODULE_REF(wasiFileExtensions)}, "wavm_wasi_extensions");
+	process->resolver.moduleNameToInstanceMap.set("wavm_wasi_extensions", wavm_wasi_extensions);
+
 	__wasi_rights_t stdioRights = __WASI_RIGHT_FD_READ | __WASI_RIGHT_FD_FDSTAT_SET_FLAGS
 								  | __WASI_RIGHT_FD_WRITE | __WASI_RIGHT_FD_FILESTAT_GET
 								  | __WASI_RIGHT_POLL_FD_READWRITE;
 
-	process->fdMap.insertOrFail(0, std::make_shared<FDE>(stdIn, stdioRights, 0, "/dev/stdin"));
-	process->fdMap.insertOrFail(1, std::make_shared<FDE>(stdOut, stdioRights, 0, "/dev/stdout"));
-	process->fdMap.insertOrFail(2, std::make_shared<FDE>(stdErr, stdioRights, 0, "/dev/stderr"));
+	Platform::Mutex::Lock fdTableLock(process->fdTable.writeMutex);
+	process->fdTable.set(0, new FDE(stdIn, stdioRights, 0, "/dev/stdin"));
+	process->fdTable.set(1, new FDE(stdOut, stdioRights, 0, "/dev/stdout"));
+	process->fdTable.set(2, new FDE(stdErr, stdioRights, 0, "/dev/stderr"));
 
 	if(fileSystem)
 	{
@@ -237,16 +319,16 @@ std::shared_ptr<Process> WASI::createProcess(Runtime::Compartment* compartment,
 							   VFS::describeResult(openResult));
 			}
 
-			process->fdMap.insertOrFail(
-				3 + __wasi_fd_t(aliasIndex),
-				std::make_shared<FDE>(rootFD,
-									  DIRECTORY_RIGHTS,
-									  INHERITING_DIRECTORY_RIGHTS,
-									  preopenedRootAliases[aliasIndex],
-									  true,
-									  __wasi_preopentype_t(__WASI_PREOPENTYPE_DIR)));
+			process->fdTable.set(3 + __wasi_fd_t(aliasIndex),
+								 new FDE(rootFD,
+										 DIRECTORY_RIGHTS,
+										 INHERITING_DIRECTORY_RIGHTS,
+										 preopenedRootAliases[aliasIndex],
+										 true,
+										 __wasi_preopentype_t(__WASI_PREOPENTYPE_DIR)));
 		}
 	}
+	fdTableLock.unlock();
 
 	process->processClockOrigin = Platform::getClockTime(Platform::Clock::processCPUTime);
 
@@ -264,6 +346,11 @@ Process* WASI::getProcessFromContextRuntimeData(Runtime::ContextRuntimeData* con
 Memory* WASI::getProcessMemory(const Process& process) { return process.memory; }
 void WASI::setProcessMemory(Process& process, Memory* memory) { process.memory = memory; }
 
+void WASI::setProcessUsesCoarseClocks(Process& process, bool useCoarseClocks)
+{
+	process.useCoarseClocks = useCoarseClocks;
+}
+
 I32 WASI::catchExit(std::function<I32()>&& thunk)
 {
 	try
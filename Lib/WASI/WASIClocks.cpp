@@ -29,6 +29,22 @@ static bool getPlatformClock(__wasi_clockid_t clock, Platform::Clock& outPlatfor
 	}
 }
 
+// Returns the coarse version of a realtime or monotonic clock, or the clock itself otherwise.
+static Platform::Clock getCoarsePlatformClock(Platform::Clock platformClock)
+{
+	switch(platformClock)
+	{
+	case Platform::Clock::realtime: return Platform::Clock::realtimeCoarse;
+	case Platform::Clock::monotonic: return Platform::Clock::monotonicCoarse;
+
+	case Platform::Clock::processCPUTime:
+	case Platform::Clock::realtimeCoarse:
+	case Platform::Clock::monotonicCoarse: return platformClock;
+
+	default: WAVM_UNREACHABLE();
+	}
+}
+
 WAVM_DEFINE_INTRINSIC_FUNCTION(wasiClocks,
 							   "clock_res_get",
 							   __wasi_errno_return_t,
@@ -38,13 +54,14 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wasiClocks,
 {
 	TRACE_SYSCALL("clock_res_get", "(%u, " WASIADDRESS_FORMAT ")", clockId, resolutionAddress);
 
+	Process* process = getProcessFromContextRuntimeData(contextRuntimeData);
+
 	Platform::Clock platformClock;
 	if(!getPlatformClock(clockId, platformClock)) { return TRACE_SYSCALL_RETURN(__WASI_EINVAL); }
+	if(process->useCoarseClocks) { platformClock = getCoarsePlatformClock(platformClock); }
 
 	const Time clockResolution = Platform::getClockResolution(platformClock);
 
-	Process* process = getProcessFromContextRuntimeData(contextRuntimeData);
-
 	__wasi_timestamp_t wasiClockResolution = __wasi_timestamp_t(clockResolution.ns);
 	memoryRef<__wasi_timestamp_t>(process->memory, resolutionAddress) = wasiClockResolution;
 
@@ -70,6 +87,8 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wasiClocks,
 	Platform::Clock platformClock;
 	if(!getPlatformClock(clockId, platformClock)) { return TRACE_SYSCALL_RETURN(__WASI_EINVAL); }
 
+	if(process->useCoarseClocks) { platformClock = getCoarsePlatformClock(platformClock); }
+
 	Time clockTime = Platform::getClockTime(platformClock);
 
 	if(platformClock == Platform::Clock::processCPUTime)
@@ -2,6 +2,7 @@
 #include "./WASIPrivate.h"
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/Logging/Logging.h"
+#include "WAVM/Metrics/Metrics.h"
 #include "WAVM/WASI/WASI.h"
 
 using namespace WAVM;
@@ -151,3 +152,12 @@ __wasi_errno_t WASI::traceSyscallReturnf(const char* syscallName,
 	}
 	return wasiErrNo;
 }
+
+Metrics::Histogram& WASI::getSyscallDurationHistogram(const char* syscallName)
+{
+	return Metrics::getHistogram("wavm_wasi_syscall_duration_seconds",
+								 "Time spent in each WASI syscall.",
+								 Metrics::Unit::nanoseconds,
+								 "syscall",
+								 syscallName);
+}
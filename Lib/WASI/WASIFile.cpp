@@ -1,9 +1,11 @@
 #include "./WASIPrivate.h"
+#include "WAVM/IR/IR.h"
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/Inline/Time.h"
 #include "WAVM/Logging/Logging.h"
 #include "WAVM/Platform/Clock.h"
-#include "WAVM/Platform/RWMutex.h"
+#include "WAVM/Platform/Mutex.h"
+#include "WAVM/Platform/Thread.h"
 #include "WAVM/Runtime/Runtime.h"
 #include "WAVM/VFS/VFS.h"
 #include "WAVM/WASI/WASIABI.h"
@@ -15,6 +17,7 @@ using namespace WAVM::VFS;
 
 namespace WAVM { namespace WASI {
 	WAVM_DEFINE_INTRINSIC_MODULE(wasiFile)
+	WAVM_DEFINE_INTRINSIC_MODULE(wasiFileExtensions)
 }}
 
 static __wasi_errno_t asWASIErrNo(VFS::Result result)
@@ -61,47 +64,68 @@ static __wasi_errno_t asWASIErrNo(VFS::Result result)
 	};
 }
 
+// Releases a reference to an FDE. If it was the last reference, closes and deletes the FDE, and
+// returns the result of closing it. This closes the VFD+DirEntStream even if there was an error.
+static Result releaseFDE(FDE* fde)
+{
+	if(fde->numReferences.fetch_sub(1, std::memory_order_acq_rel) != 1) { return Result::success; }
+
+	const Result result = fde->close();
+	delete fde;
+	return result;
+}
+
 struct LockedFDE
 {
 	__wasi_errno_t error;
 
-	// Only set if result==_WASI_ESUCCESS:
-	Platform::RWMutex::Lock fdeLock;
-	std::shared_ptr<FDE> fde;
+	// Only set if result==_WASI_ESUCCESS. The LockedFDE holds a reference to the FDE, which keeps
+	// it from being closed until the LockedFDE is destroyed.
+	FDE* fde;
 
-	LockedFDE(__wasi_errno_t inError) : error(inError) {}
-	LockedFDE(const std::shared_ptr<FDE>& inFDE,
-			  Platform::RWMutex::LockShareability lockShareability)
-	: error(__WASI_ESUCCESS), fdeLock(inFDE->mutex, lockShareability), fde(inFDE)
+	LockedFDE(__wasi_errno_t inError) : error(inError), fde(nullptr) {}
+	LockedFDE(FDE* inFDE) : error(__WASI_ESUCCESS), fde(inFDE) {}
+	LockedFDE(LockedFDE&& movee) : error(movee.error), fde(movee.fde) { movee.fde = nullptr; }
+	~LockedFDE()
 	{
+		if(!fde) { return; }
+
+		// If the FD was closed while this syscall was using it, the FDE is closed here.
+		const Result result = releaseFDE(fde);
+		if(result != Result::success)
+		{
+			Log::printf(Log::Category::debug,
+						"Error while closing file after it was removed from the FD table: %s\n",
+						VFS::describeResult(result));
+		}
 	}
+
+	LockedFDE(const LockedFDE&) = delete;
+	void operator=(const LockedFDE&) = delete;
 };
 
 static LockedFDE getLockedFDE(Process* process,
 							  __wasi_fd_t fd,
 							  __wasi_rights_t requiredRights,
-							  __wasi_rights_t requiredInheritingRights,
-							  Platform::RWMutex::LockShareability lockShareability
-							  = Platform::RWMutex::shareable)
+							  __wasi_rights_t requiredInheritingRights)
 {
-	// Shareably lock the fdMap mutex.
-	Platform::RWMutex::ShareableLock fdsLock(process->fdMapMutex);
-
-	// Check that the fdMap contains a FDE for the given FD.
-	if(fd < process->fdMap.getMinIndex() || fd > process->fdMap.getMaxIndex())
-	{ return LockedFDE(__WASI_EBADF); }
-	std::shared_ptr<FDE>* fde = process->fdMap.get(fd);
+	// Pin the FD table, and look up the FDE for the given FD.
+	FDTable::ReadLock fdTableLock(process->fdTable);
+	FDE* fde = process->fdTable.get(fd);
 	if(!fde) { return LockedFDE(__WASI_EBADF); }
 
 	// Check that the FDE has the required rights.
-	if(((*fde)->rights & requiredRights) != requiredRights
-	   || ((*fde)->inheritingRights & requiredInheritingRights) != requiredInheritingRights)
+	if((fde->rights.load(std::memory_order_relaxed) & requiredRights) != requiredRights
+	   || (fde->inheritingRights.load(std::memory_order_relaxed) & requiredInheritingRights)
+			  != requiredInheritingRights)
 	{ return LockedFDE(__WASI_ENOTCAPABLE); }
 
-	TRACE_SYSCALL_FLOW("Locked FDE: %s", (*fde)->originalPath.c_str());
+	TRACE_SYSCALL_FLOW("Locked FDE: %s", fde->originalPath.c_str());
 
-	// Lock the FDE and return a reference to it.
-	return LockedFDE(*fde, lockShareability);
+	// Add a reference to the FDE before unpinning the FD table, so the syscall can keep using the
+	// FDE without blocking writers to the FD table.
+	fde->numReferences.fetch_add(1, std::memory_order_relaxed);
+	return LockedFDE(fde);
 }
 
 static __wasi_filetype_t asWASIFileType(FileType type)
@@ -154,48 +178,41 @@ static bool getCanonicalPath(const std::string& basePath,
 							 const std::string& relativePath,
 							 std::string& outAbsolutePath)
 {
+	// Build the canonical path in place, appending each component of the relative path to the base
+	// path, and truncating the path to remove a component for "..".
+	outAbsolutePath.reserve(basePath.size() + relativePath.size() + 1);
 	outAbsolutePath = basePath;
 	if(outAbsolutePath.back() == '/') { outAbsolutePath.pop_back(); }
-
-	std::vector<std::string> relativePathComponents;
+	const Uptr numBasePathChars = outAbsolutePath.size();
 
 	Uptr componentStart = 0;
 	while(componentStart < relativePath.size())
 	{
-		while(componentStart < relativePath.size() && relativePath[componentStart] == '/')
-		{ ++componentStart; }
-
-		Uptr nextPathSeparator = relativePath.find_first_of('/', componentStart);
+		if(relativePath[componentStart] == '/')
+		{
+			++componentStart;
+			continue;
+		}
 
+		Uptr nextPathSeparator = relativePath.find('/', componentStart);
 		if(nextPathSeparator == std::string::npos) { nextPathSeparator = relativePath.size(); }
 
-		if(nextPathSeparator != componentStart)
+		const Uptr numComponentChars = nextPathSeparator - componentStart;
+		if(numComponentChars == 2 && relativePath[componentStart] == '.'
+		   && relativePath[componentStart + 1] == '.')
 		{
-			std::string component
-				= relativePath.substr(componentStart, nextPathSeparator - componentStart);
-
-			if(component == "..")
-			{
-				if(!relativePathComponents.size()) { return false; }
-				else
-				{
-					relativePathComponents.pop_back();
-				}
-			}
-			else if(component != ".")
-			{
-				relativePathComponents.push_back(component);
-			}
-
-			componentStart = nextPathSeparator + 1;
+			// Don't allow ".." to escape the base path.
+			if(outAbsolutePath.size() == numBasePathChars) { return false; }
+			outAbsolutePath.resize(outAbsolutePath.rfind('/'));
+		}
+		else if(numComponentChars != 1 || relativePath[componentStart] != '.')
+		{
+			outAbsolutePath += '/';
+			outAbsolutePath.append(relativePath, componentStart, numComponentChars);
 		}
-	};
 
-	for(const std::string& component : relativePathComponents)
-	{
-		outAbsolutePath += '/';
-		outAbsolutePath += component;
-	}
+		componentStart = nextPathSeparator;
+	};
 
 	return true;
 }
@@ -273,6 +290,81 @@ Result WASI::FDE::close()
 	return result;
 }
 
+WASI::FDTable::FDTable() : currentSlots(new Slots(16)) {}
+
+WASI::FDTable::~FDTable()
+{
+	delete currentSlots.load(std::memory_order_relaxed);
+	for(Slots* slots : retiredSlots) { delete slots; }
+}
+
+__wasi_fd_t WASI::FDTable::add(FDE* fde)
+{
+	Slots* slots = currentSlots.load(std::memory_order_relaxed);
+	while(minUnusedFD < slots->numSlots && slots->fdes[minUnusedFD].load()) { ++minUnusedFD; };
+	if(minUnusedFD == maxFDs) { return UINT32_MAX; }
+
+	const __wasi_fd_t fd = __wasi_fd_t(minUnusedFD);
+	set(fd, fde);
+	return fd;
+}
+
+FDE* WASI::FDTable::set(__wasi_fd_t fd, FDE* fde)
+{
+	WAVM_ASSERT(fd < maxFDs);
+
+	Slots* slots = currentSlots.load(std::memory_order_relaxed);
+	if(fd >= slots->numSlots)
+	{
+		if(!fde) { return nullptr; }
+
+		// Publish a copy of the slots with room for the FD. Readers may still be using the old
+		// slots, so they are only freed by synchronize.
+		Uptr numNewSlots = slots->numSlots;
+		while(numNewSlots <= fd) { numNewSlots *= 2; };
+		Slots* newSlots = new Slots(std::min(numNewSlots, maxFDs));
+		for(Uptr slotIndex = 0; slotIndex < slots->numSlots; ++slotIndex)
+		{ newSlots->fdes[slotIndex].store(slots->fdes[slotIndex].load()); }
+		currentSlots.store(newSlots, std::memory_order_seq_cst);
+		retiredSlots.push_back(slots);
+		slots = newSlots;
+	}
+
+	FDE* oldFDE = slots->fdes[fd].exchange(fde, std::memory_order_seq_cst);
+	if(!fde && fd < minUnusedFD) { minUnusedFD = fd; }
+	return oldFDE;
+}
+
+void WASI::FDTable::synchronize()
+{
+	Platform::Mutex::Lock synchronizeLock(synchronizeMutex);
+
+	// Take the slot arrays that have been replaced so far. Readers that loaded them did so before
+	// they were replaced, so the epoch flips below also wait for those readers.
+	std::vector<Slots*> slotsToFree;
+	{
+		Platform::Mutex::Lock writeLock(writeMutex);
+		slotsToFree = std::move(retiredSlots);
+		retiredSlots.clear();
+	}
+
+	// Flip the parity of the epoch that new readers count themselves in, and wait for the readers
+	// counted in the old parity to finish. Doing this twice waits for any reader that read the
+	// epoch before the first flip, but didn't increment its count until after it.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	for(Uptr flipIndex = 0; flipIndex < 2; ++flipIndex)
+	{
+		const Uptr oldEpochParity = readerEpoch.fetch_add(1, std::memory_order_seq_cst) & 1;
+		for(ReaderShard& shard : readerShards)
+		{
+			while(shard.numReaders[oldEpochParity].load(std::memory_order_seq_cst))
+			{ Platform::yieldToAnotherThread(); };
+		}
+	}
+
+	for(Slots* slots : slotsToFree) { delete slots; }
+}
+
 WAVM_DEFINE_INTRINSIC_FUNCTION(wasiFile,
 							   "fd_prestat_get",
 							   __wasi_errno_return_t,
@@ -335,27 +427,23 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wasiFile,
 
 	Process* process = getProcessFromContextRuntimeData(contextRuntimeData);
 
-	// Exclusively lock the fds mutex, and look up the FDE corresponding to the FD.
-	Platform::RWMutex::ExclusiveLock fdsLock(process->fdMapMutex);
-	if(fd < process->fdMap.getMinIndex() || fd > process->fdMap.getMaxIndex())
-	{ return TRACE_SYSCALL_RETURN(__WASI_EBADF); }
-	std::shared_ptr<FDE>* fdePointer = process->fdMap.get(fd);
-	if(!fdePointer) { return TRACE_SYSCALL_RETURN(__WASI_EBADF); }
-	std::shared_ptr<FDE> fde = *fdePointer;
-
-	// Exclusively lock the FDE.
-	Platform::RWMutex::ExclusiveLock fdeLock(fde->mutex);
-
-	// Remove this FDE from the FD table, and unlock the fds mutex.
-	process->fdMap.removeOrFail(fd);
-	fdsLock.unlock();
+	// Lock the FD table for writing, and look up the FDE corresponding to the FD.
+	Platform::Mutex::Lock fdTableLock(process->fdTable.writeMutex);
+	FDE* fde = process->fdTable.get(fd);
+	if(!fde) { return TRACE_SYSCALL_RETURN(__WASI_EBADF); }
 
 	// Don't allow closing preopened FDs for now.
 	if(fde->isPreopened) { return TRACE_SYSCALL_RETURN(__WASI_EBADF); }
 
-	// Close the FDE's underlying VFD+DirEntStream. This can return an error code, but closes the
-	// VFD+DirEntStream even if there was an error.
-	const VFS::Result result = fde->close();
+	// Remove this FDE from the FD table, and wait for any syscalls that loaded it from the table to
+	// add their reference to it.
+	process->fdTable.remove(fd);
+	fdTableLock.unlock();
+	process->fdTable.synchronize();
+
+	// Release the FD table's reference to the FDE. If no syscalls are using the FDE, this closes
+	// its underlying VFD+DirEntStream. Otherwise, the last syscall to finish using it closes it.
+	const VFS::Result result = releaseFDE(fde);
 
 	return TRACE_SYSCALL_RETURN(asWASIErrNo(result));
 }
@@ -376,6 +464,9 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wasiFile,
 	return TRACE_SYSCALL_RETURN(asWASIErrNo(lockedFDE.fde->vfd->sync(SyncType::contents)));
 }
 
+// The number of IOVs that fd_read and fd_write can translate without allocating memory for them.
+static constexpr I32 numStackIOVs = 8;
+
 static __wasi_errno_t readImpl(Process* process,
 							   __wasi_fd_t fd,
 							   WASIAddress iovsAddress,
@@ -390,8 +481,11 @@ static __wasi_errno_t readImpl(Process* process,
 
 	if(numIOVs < 0 || numIOVs > __WASI_IOV_MAX) { return __WASI_EINVAL; }
 
-	// Allocate memory for the IOReadBuffers.
-	IOReadBuffer* vfsReadBuffers = (IOReadBuffer*)malloc(numIOVs * sizeof(IOReadBuffer));
+	// Use a buffer on the stack for the IOReadBuffers, unless there are too many IOVs to fit.
+	IOReadBuffer stackReadBuffers[numStackIOVs];
+	IOReadBuffer* vfsReadBuffers
+		= numIOVs <= numStackIOVs ? stackReadBuffers
+								  : (IOReadBuffer*)malloc(numIOVs * sizeof(IOReadBuffer));
 
 	// Catch any out-of-bounds memory access exceptions that are thrown.
 	__wasi_errno_t result = __WASI_ESUCCESS;
@@ -433,7 +527,7 @@ static __wasi_errno_t readImpl(Process* process,
 		});
 
 	// Free the VFS read buffers.
-	free(vfsReadBuffers);
+	if(vfsReadBuffers != stackReadBuffers) { free(vfsReadBuffers); }
 
 	return result;
 }
@@ -452,8 +546,11 @@ static __wasi_errno_t writeImpl(Process* process,
 
 	if(numIOVs < 0 || numIOVs > __WASI_IOV_MAX) { return __WASI_EINVAL; }
 
-	// Allocate memory for the IOWriteBuffers.
-	IOWriteBuffer* vfsWriteBuffers = (IOWriteBuffer*)malloc(numIOVs * sizeof(IOWriteBuffer));
+	// Use a buffer on the stack for the IOWriteBuffers, unless there are too many IOVs to fit.
+	IOWriteBuffer stackWriteBuffers[numStackIOVs];
+	IOWriteBuffer* vfsWriteBuffers
+		= numIOVs <= numStackIOVs ? stackWriteBuffers
+								  : (IOWriteBuffer*)malloc(numIOVs * sizeof(IOWriteBuffer));
 
 	// Catch any out-of-bounds memory access exceptions that are thrown.
 	__wasi_errno_t result = __WASI_ESUCCESS;
@@ -495,7 +592,7 @@ static __wasi_errno_t writeImpl(Process* process,
 		});
 
 	// Free the VFS write buffers.
-	free(vfsWriteBuffers);
+	if(vfsWriteBuffers != stackWriteBuffers) { free(vfsWriteBuffers); }
 
 	return result;
 }
@@ -631,36 +728,29 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wasiFile,
 
 	Process* process = getProcessFromContextRuntimeData(contextRuntimeData);
 
-	// Exclusively lock the fds mutex.
-	Platform::RWMutex::ExclusiveLock fdsLock(process->fdMapMutex);
-
-	// Look up the FDE for the source FD.
-	if(fromFD < process->fdMap.getMinIndex() || fromFD > process->fdMap.getMaxIndex())
-	{ return TRACE_SYSCALL_RETURN(__WASI_EBADF); }
-	std::shared_ptr<FDE>* fromFDEPointer = process->fdMap.get(fromFD);
-	if(!fromFDEPointer) { return TRACE_SYSCALL_RETURN(__WASI_EBADF); }
-	std::shared_ptr<FDE> fromFDE = *fromFDEPointer;
+	// Lock the FD table for writing.
+	Platform::Mutex::Lock fdTableLock(process->fdTable.writeMutex);
 
-	// Look up the FDE for the destination FD.
-	if(toFD < process->fdMap.getMinIndex() || toFD > process->fdMap.getMaxIndex())
-	{ return TRACE_SYSCALL_RETURN(__WASI_EBADF); }
-	std::shared_ptr<FDE>* toFDEPointer = process->fdMap.get(toFD);
-	if(!toFDEPointer) { return TRACE_SYSCALL_RETURN(__WASI_EBADF); }
-	std::shared_ptr<FDE> toFDE = *toFDEPointer;
+	// Look up the FDEs for the source and destination FDs.
+	FDE* fromFDE = process->fdTable.get(fromFD);
+	if(!fromFDE) { return TRACE_SYSCALL_RETURN(__WASI_EBADF); }
+	FDE* toFDE = process->fdTable.get(toFD);
+	if(!toFDE) { return TRACE_SYSCALL_RETURN(__WASI_EBADF); }
 
 	// Don't allow renumbering preopened files.
 	if(fromFDE->isPreopened || toFDE->isPreopened) { return TRACE_SYSCALL_RETURN(__WASI_ENOTSUP); }
 
-	// Exclusively lock the FDE being replaced at the destination FD.
-	Platform::RWMutex::ExclusiveLock fromFDELock(fromFDE->mutex);
-
-	// Close the FDE being replaced. This can return an error code, but closes the VFD+DirEntStream
-	// even if there was an error.
-	Result result = toFDE->close();
+	// Move the FDE from fromFD to toFD in the FD table, and wait for any syscalls that loaded the
+	// replaced FDE from the table to add their reference to it.
+	if(fromFD == toFD) { return TRACE_SYSCALL_RETURN(__WASI_ESUCCESS); }
+	process->fdTable.set(toFD, fromFDE);
+	process->fdTable.remove(fromFD);
+	fdTableLock.unlock();
+	process->fdTable.synchronize();
 
-	// Move the FDE from fromFD to toFD in the fds map.
-	process->fdMap[toFD] = std::move(fromFDE);
-	process->fdMap.removeOrFail(fromFD);
+	// Release the FD table's reference to the FDE being replaced, which closes it once no syscalls
+	// are using it.
+	Result result = releaseFDE(toFDE);
 
 	return TRACE_SYSCALL_RETURN(asWASIErrNo(result));
 }
@@ -775,8 +865,8 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wasiFile,
 	default: WAVM_UNREACHABLE();
 	}
 
-	fdstat.fs_rights_base = lockedFDE.fde->rights;
-	fdstat.fs_rights_inheriting = lockedFDE.fde->inheritingRights;
+	fdstat.fs_rights_base = lockedFDE.fde->rights.load(std::memory_order_relaxed);
+	fdstat.fs_rights_inheriting = lockedFDE.fde->inheritingRights.load(std::memory_order_relaxed);
 
 	return TRACE_SYSCALL_RETURN(__WASI_ESUCCESS);
 }
@@ -820,12 +910,12 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wasiFile,
 	Process* process = getProcessFromContextRuntimeData(contextRuntimeData);
 
 	LockedFDE lockedFDE
-		= getLockedFDE(process, fd, rights, inheritingRights, Platform::RWMutex::exclusive);
+		= getLockedFDE(process, fd, rights, inheritingRights);
 	if(lockedFDE.error != __WASI_ESUCCESS) { return TRACE_SYSCALL_RETURN(lockedFDE.error); }
 
 	// Narrow the FD's rights.
-	lockedFDE.fde->rights = rights;
-	lockedFDE.fde->inheritingRights = inheritingRights;
+	lockedFDE.fde->rights.store(rights, std::memory_order_relaxed);
+	lockedFDE.fde->inheritingRights.store(inheritingRights, std::memory_order_relaxed);
 
 	return TRACE_SYSCALL_RETURN(__WASI_ESUCCESS);
 }
@@ -996,14 +1086,15 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wasiFile,
 		= process->fileSystem->open(canonicalPath, accessMode, createMode, openedVFD, vfsVFDFlags);
 	if(result != VFS::Result::success) { return TRACE_SYSCALL_RETURN(asWASIErrNo(result)); }
 
-	Platform::RWMutex::ExclusiveLock fdsLock(process->fdMapMutex);
-	__wasi_fd_t fd = process->fdMap.add(
-		UINT32_MAX,
-		std::make_shared<FDE>(
-			openedVFD, requestedRights, requestedInheritingRights, std::move(canonicalPath)));
+	FDE* fde
+		= new FDE(openedVFD, requestedRights, requestedInheritingRights, std::move(canonicalPath));
+	Platform::Mutex::Lock fdTableLock(process->fdTable.writeMutex);
+	__wasi_fd_t fd = process->fdTable.add(fde);
 	if(fd == UINT32_MAX)
 	{
-		result = openedVFD->close();
+		fdTableLock.unlock();
+		result = fde->close();
+		delete fde;
 		if(result != VFS::Result::success)
 		{
 			Log::printf(Log::Category::debug,
@@ -1046,9 +1137,9 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wasiFile,
 
 	Process* process = getProcessFromContextRuntimeData(contextRuntimeData);
 
-	LockedFDE lockedFDE
-		= getLockedFDE(process, dirFD, __WASI_RIGHT_FD_READDIR, 0, Platform::RWMutex::exclusive);
+	LockedFDE lockedFDE = getLockedFDE(process, dirFD, __WASI_RIGHT_FD_READDIR, 0);
 	if(lockedFDE.error != __WASI_ESUCCESS) { return TRACE_SYSCALL_RETURN(lockedFDE.error); }
+	Platform::Mutex::Lock dirEntStreamLock(lockedFDE.fde->dirEntStreamMutex);
 
 	// If this is the first time readdir was called, open a DirEntStream for the FD.
 	if(!lockedFDE.fde->dirEntStream)
@@ -1527,3 +1618,55 @@ WAVM_DEFINE_INTRINSIC_FUNCTION(wasiFile,
 	const VFS::Result result = process->fileSystem->createDir(canonicalPath);
 	return TRACE_SYSCALL_RETURN(asWASIErrNo(result));
 }
+
+// A WAVM extension that maps part of a file into memory, without copying it if the file system
+// supports it. Writes to the memory don't modify the file, and bytes past the end of the file are
+// zeroed. offset, address, and numBytes must be multiples of the WebAssembly page size.
+WAVM_DEFINE_INTRINSIC_FUNCTION(wasiFileExtensions,
+							   "fd_map",
+							   __wasi_errno_return_t,
+							   wasi_fd_map,
+							   __wasi_fd_t fd,
+							   __wasi_filesize_t offset,
+							   WASIAddress address,
+							   WASIAddress numBytes)
+{
+	TRACE_SYSCALL("fd_map",
+				  "(%u, %" PRIu64 ", " WASIADDRESS_FORMAT ", %u)",
+				  fd,
+				  offset,
+				  address,
+				  numBytes);
+
+	Process* process = getProcessFromContextRuntimeData(contextRuntimeData);
+
+	if(offset % IR::numBytesPerPage || address % IR::numBytesPerPage
+	   || numBytes % IR::numBytesPerPage)
+	{ return TRACE_SYSCALL_RETURN(__WASI_EINVAL); }
+
+	LockedFDE lockedFDE = getLockedFDE(process, fd, __WASI_RIGHT_FD_READ, 0);
+	if(lockedFDE.error != __WASI_ESUCCESS) { return TRACE_SYSCALL_RETURN(lockedFDE.error); }
+
+	U8* destAddress = getValidatedMemoryOffsetRange(process->memory, address, numBytes);
+	if(!numBytes) { return TRACE_SYSCALL_RETURN(__WASI_ESUCCESS); }
+
+	VFS::Result result = lockedFDE.fde->vfd->mapCopyOnWrite(offset, numBytes, destAddress);
+	if(result == VFS::Result::notSupported)
+	{
+		// If the file can't be mapped, fall back to reading it into the memory.
+		Uptr numBytesRead = 0;
+		while(numBytesRead < numBytes)
+		{
+			U64 readOffset = offset + numBytesRead;
+			Uptr numChunkBytes = 0;
+			result = lockedFDE.fde->vfd->read(
+				destAddress + numBytesRead, numBytes - numBytesRead, &numChunkBytes, &readOffset);
+			if(result != VFS::Result::success || !numChunkBytes) { break; }
+			numBytesRead += numChunkBytes;
+		}
+		if(result == VFS::Result::success)
+		{ memset(destAddress + numBytesRead, 0, numBytes - numBytesRead); }
+	}
+
+	return TRACE_SYSCALL_RETURN(asWASIErrNo(result));
+}
@@ -1,11 +1,13 @@
 #include <memory.h>
+#include <atomic>
+#include <memory>
+#include <vector>
 #include "WAVM/IR/Types.h"
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/Inline/HashMap.h"
-#include "WAVM/Inline/IndexMap.h"
 #include "WAVM/Inline/Time.h"
+#include "WAVM/Metrics/Metrics.h"
 #include "WAVM/Platform/Mutex.h"
-#include "WAVM/Platform/RWMutex.h"
 #include "WAVM/Runtime/Intrinsics.h"
 #include "WAVM/Runtime/Linker.h"
 #include "WAVM/Runtime/Runtime.h"
@@ -15,6 +17,9 @@
 // Macros for tracing syscalls
 #define TRACE_SYSCALL(syscallName, argFormat, ...)                                                 \
 	const char* TRACE_SYSCALL_name = syscallName;                                                  \
+	static Metrics::Histogram& TRACE_SYSCALL_durationHistogram                                     \
+		= getSyscallDurationHistogram(syscallName);                                                \
+	Metrics::Timer TRACE_SYSCALL_metricsTimer(TRACE_SYSCALL_durationHistogram);                    \
 	traceSyscallf(TRACE_SYSCALL_name, argFormat, ##__VA_ARGS__)
 
 #define TRACE_SYSCALL_RETURN(returnCode, ...)                                                      \
@@ -58,19 +63,23 @@ namespace WAVM { namespace VFS {
 namespace WAVM { namespace WASI {
 	struct FDE
 	{
-		mutable Platform::RWMutex mutex;
-
 		VFS::VFD* vfd;
-		__wasi_rights_t rights;
-		__wasi_rights_t inheritingRights;
+		std::atomic<__wasi_rights_t> rights;
+		std::atomic<__wasi_rights_t> inheritingRights;
 
 		std::string originalPath;
 
 		bool isPreopened;
 		__wasi_preopentype_t preopenedType;
 
+		// Reading directory entries changes the stream's position, so is serialized by this mutex.
+		Platform::Mutex dirEntStreamMutex;
 		VFS::DirEntStream* dirEntStream{nullptr};
 
+		// One reference is held by the FD table while the FDE is in it, and one by each syscall
+		// that is using the FDE. The FDE is closed and deleted when the last reference is released.
+		std::atomic<Uptr> numReferences{1};
+
 		FDE(VFS::VFD* inVFD,
 			__wasi_rights_t inRights,
 			__wasi_rights_t inInheritingRights,
@@ -91,6 +100,119 @@ namespace WAVM { namespace WASI {
 		VFS::Result close();
 	};
 
+	// A table of FDEs that syscalls can read without taking a lock. A reader pins the table with a
+	// ReadLock, which increments a reader count in a shard chosen by the calling thread, and then
+	// looks up FDEs with an indexed load. Writers are serialized by writeMutex, and grow the table
+	// by publishing a new copy of its slot array. An FDE that is removed from the table may still
+	// be used by readers that loaded it before it was removed, so the table's reference to it must
+	// not be released until synchronize returns. Readers only hold a ReadLock long enough to add a
+	// reference to the FDE they look up, so synchronize doesn't wait for syscalls that block.
+	struct FDTable
+	{
+		struct ReadLock
+		{
+			ReadLock(const FDTable& table)
+			{
+				const Uptr epochParity = table.readerEpoch.load(std::memory_order_acquire) & 1;
+				numReaders = &table.readerShards[getThreadReaderShardIndex()]
+								  .numReaders[epochParity];
+				numReaders->fetch_add(1, std::memory_order_seq_cst);
+			}
+			ReadLock(ReadLock&& movee) : numReaders(movee.numReaders)
+			{
+				movee.numReaders = nullptr;
+			}
+			~ReadLock()
+			{
+				if(numReaders) { numReaders->fetch_sub(1, std::memory_order_release); }
+			}
+
+			ReadLock(const ReadLock&) = delete;
+			void operator=(const ReadLock&) = delete;
+
+		private:
+			std::atomic<Uptr>* numReaders;
+		};
+
+		// Serializes the functions below that modify the table.
+		Platform::Mutex writeMutex;
+
+		FDTable();
+		~FDTable();
+
+		// Returns the FDE for an FD, or null if the FD isn't in the table. The caller must hold a
+		// ReadLock or writeMutex.
+		FDE* get(__wasi_fd_t fd) const
+		{
+			const Slots* slots = currentSlots.load(std::memory_order_acquire);
+			return fd < slots->numSlots ? slots->fdes[fd].load(std::memory_order_acquire)
+										: nullptr;
+		}
+
+		// Adds an FDE at the lowest unused FD, and returns the FD. Returns UINT32_MAX if there
+		// are no unused FDs.
+		__wasi_fd_t add(FDE* fde);
+
+		// Sets the FDE for an FD, and returns the FDE it replaced, or null.
+		FDE* set(__wasi_fd_t fd, FDE* fde);
+
+		// Removes an FD from the table, and returns its FDE, or null if the FD wasn't in the table.
+		FDE* remove(__wasi_fd_t fd) { return set(fd, nullptr); }
+
+		// Waits until all readers that might have loaded an FDE before it was removed from the
+		// table have released their ReadLock, and frees any slot arrays replaced by growing the
+		// table. Must not be called while holding a ReadLock or writeMutex.
+		void synchronize();
+
+		template<typename Visitor> void forEach(Visitor&& visitor)
+		{
+			const Slots* slots = currentSlots.load(std::memory_order_acquire);
+			for(Uptr fd = 0; fd < slots->numSlots; ++fd)
+			{
+				FDE* fde = slots->fdes[fd].load(std::memory_order_acquire);
+				if(fde) { visitor(__wasi_fd_t(fd), fde); }
+			}
+		}
+
+	private:
+		static constexpr Uptr numReaderShards = 16;
+		static constexpr Uptr maxFDs = Uptr(INT32_MAX) + 1;
+
+		struct Slots
+		{
+			Uptr numSlots;
+			std::unique_ptr<std::atomic<FDE*>[]> fdes;
+
+			Slots(Uptr inNumSlots) : numSlots(inNumSlots), fdes(new std::atomic<FDE*>[numSlots])
+			{
+				for(Uptr fd = 0; fd < numSlots; ++fd) { fdes[fd].store(nullptr); }
+			}
+		};
+
+		struct alignas(64) ReaderShard
+		{
+			std::atomic<Uptr> numReaders[2]{{0}, {0}};
+		};
+
+		std::atomic<Slots*> currentSlots;
+		std::vector<Slots*> retiredSlots;
+
+		// Serializes calls to synchronize, which can't flip the reader epoch concurrently.
+		Platform::Mutex synchronizeMutex;
+		Uptr minUnusedFD{0};
+
+		mutable ReaderShard readerShards[numReaderShards];
+		std::atomic<Uptr> readerEpoch{0};
+
+		static Uptr getThreadReaderShardIndex()
+		{
+			static std::atomic<Uptr> nextThreadReaderShardIndex{0};
+			static thread_local Uptr threadReaderShardIndex
+				= nextThreadReaderShardIndex++ % numReaderShards;
+			return threadReaderShardIndex;
+		}
+	};
+
 	struct ProcessResolver : Runtime::Resolver
 	{
 		HashMap<std::string, Runtime::GCPointer<Runtime::Instance>> moduleNameToInstanceMap;
@@ -108,14 +230,14 @@ namespace WAVM { namespace WASI {
 		std::vector<std::string> args;
 		std::vector<std::string> envs;
 
-		Platform::RWMutex fdMapMutex;
-		IndexMap<__wasi_fd_t, std::shared_ptr<WASI::FDE>> fdMap{0, INT32_MAX};
+		FDTable fdTable;
 
 		VFS::FileSystem* fileSystem = nullptr;
 
 		ProcessResolver resolver;
 
 		Time processClockOrigin;
+		bool useCoarseClocks = false;
 
 		~Process();
 	};
@@ -142,8 +264,12 @@ namespace WAVM { namespace WASI {
 									   const char* format,
 									   ...);
 
+	// Returns the histogram of the time spent in a syscall, which TRACE_SYSCALL records into.
+	Metrics::Histogram& getSyscallDurationHistogram(const char* syscallName);
+
 	WAVM_DECLARE_INTRINSIC_MODULE(wasi);
 	WAVM_DECLARE_INTRINSIC_MODULE(wasiArgsEnvs);
 	WAVM_DECLARE_INTRINSIC_MODULE(wasiClocks);
 	WAVM_DECLARE_INTRINSIC_MODULE(wasiFile);
+	WAVM_DECLARE_INTRINSIC_MODULE(wasiFileExtensions);
 }}
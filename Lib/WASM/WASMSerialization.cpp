@@ -15,6 +15,7 @@
 #include "WAVM/Inline/Timing.h"
 #include "WAVM/Inline/Unicode.h"
 #include "WAVM/Logging/Logging.h"
+#include "WAVM/Metrics/Metrics.h"
 #include "WAVM/Platform/Defines.h"
 #include "WAVM/WASM/WASM.h"
 
@@ -38,7 +39,18 @@ WAVM_FORCEINLINE void serializeOpcode(InputStream& stream, Opcode& opcode)
 	{
 		U32 opcodeVarUInt;
 		serializeVarUInt32(stream, opcodeVarUInt);
-		opcode = Opcode((U32(opcodeU8) << 8) | opcodeVarUInt);
+		if(opcodeU8 == 0xfd && opcodeVarUInt >= 0x100 && opcodeVarUInt < 0x200)
+		{ opcode = Opcode((U32(relaxedSIMDOpcodePrefix) << 8) | (opcodeVarUInt - 0x100)); }
+		else if(opcodeU8 == relaxedSIMDOpcodePrefix || opcodeVarUInt > 0xff)
+		{
+			throw FatalSerializationException(
+				std::string("unknown opcode (") + std::to_string(opcodeU8) + " "
+				+ std::to_string(opcodeVarUInt) + ")");
+		}
+		else
+		{
+			opcode = Opcode((U32(opcodeU8) << 8) | opcodeVarUInt);
+		}
 	}
 }
 WAVM_FORCEINLINE void serializeOpcode(OutputStream& stream, Opcode opcode)
@@ -52,6 +64,11 @@ WAVM_FORCEINLINE void serializeOpcode(OutputStream& stream, Opcode opcode)
 	{
 		U8 opcodePrefix = U8(U16(opcode) >> 8);
 		U32 opcodeVarUInt = U32(opcode) & 0xff;
+		if(opcodePrefix == relaxedSIMDOpcodePrefix)
+		{
+			opcodePrefix = 0xfd;
+			opcodeVarUInt += 0x100;
+		}
 		serializeNativeValue(stream, opcodePrefix);
 		serializeVarUInt32(stream, opcodeVarUInt);
 	}
@@ -1034,10 +1051,10 @@ static void serializeFunctionBody(InputStream& sectionStream,
 		{ functionDef.nonParameterLocalTypes.push_back(localSet.type); }
 	}
 
-	// Deserialize the function code, validate it, and re-encode it in the IR format.
+	// Deserialize the function code, and re-encode it in the IR format. The code is validated
+	// after all the function bodies are deserialized.
 	ArrayOutputStream irCodeByteStream;
 	OperatorEncoderStream irEncoderStream(irCodeByteStream);
-	CodeValidationStream codeValidationStream(*moduleState.validationState, functionDef);
 	while(bodyStream.capacity())
 	{
 		Opcode opcode;
@@ -1048,7 +1065,6 @@ static void serializeFunctionBody(InputStream& sectionStream,
 	case Uptr(Opcode::name): {                                                                     \
 		Imm imm;                                                                                   \
 		serialize(bodyStream, imm, functionDef, moduleState);                                      \
-		codeValidationStream.name(imm);                                                            \
 		irEncoderStream.name(imm);                                                                 \
 		break;                                                                                     \
 	}
@@ -1057,16 +1073,12 @@ static void serializeFunctionBody(InputStream& sectionStream,
 		// Explicitly handle both select opcodes here:
 		case 0x1b: {
 			SelectImm imm{ValueType::any};
-
-			codeValidationStream.select(imm);
 			irEncoderStream.select(imm);
 			break;
 		}
 		case 0x1c: {
 			SelectImm imm;
 			serialize(bodyStream, imm, functionDef, moduleState);
-
-			codeValidationStream.select(imm);
 			irEncoderStream.select(imm);
 			break;
 		}
@@ -1075,7 +1087,6 @@ static void serializeFunctionBody(InputStream& sectionStream,
 											  + std::to_string(Uptr(opcode)) + ")");
 		};
 	};
-	codeValidationStream.finish();
 
 	functionDef.code = std::move(irCodeByteStream.getBytes());
 }
@@ -1507,6 +1518,15 @@ static void serializeModule(OutputStream& moduleStream, Module& module)
 	serializeCustomSectionsAfterKnownSection(moduleStream, module, OrderedSectionID::data);
 }
 
+static Metrics::Histogram& getLoadPhaseDurationHistogram(const char* phase)
+{
+	return Metrics::getHistogram("wavm_load_phase_duration_seconds",
+								 "Time spent in each phase of loading binary modules.",
+								 Metrics::Unit::nanoseconds,
+								 "phase",
+								 phase);
+}
+
 static void serializeModule(InputStream& moduleStream, Module& module)
 {
 	serializeConstant(moduleStream, "magic number", U32(magicNumber));
@@ -1604,10 +1624,33 @@ static void serializeModule(InputStream& moduleStream, Module& module)
 			serializeDataCountSection(moduleStream, module);
 			moduleState.hadDataCountSection = true;
 			break;
-		case SectionID::code:
-			serializeCodeSection(moduleStream, module, moduleState);
+		case SectionID::code: {
+			static Metrics::Histogram& decodeDurationHistogram
+				= getLoadPhaseDurationHistogram("decode_code");
+			static Metrics::Histogram& validateDurationHistogram
+				= getLoadPhaseDurationHistogram("validate_code");
+
+			Timing::Timer decodeTimer;
+			{
+				Metrics::Timer decodeMetricsTimer(decodeDurationHistogram);
+				serializeCodeSection(moduleStream, module, moduleState);
+			}
 			hadFunctionDefinitions = true;
+			const F64 numFunctionDefs = F64(module.functions.defs.size());
+			Timing::logRatePerSecond(
+				"Decoded WASM code", decodeTimer, numFunctionDefs, "functions");
+
+			// Validate the function bodies once they have all been decoded, so they can be
+			// validated in parallel.
+			Timing::Timer validateTimer;
+			{
+				Metrics::Timer validateMetricsTimer(validateDurationHistogram);
+				IR::validateCodeSectionInParallel(*moduleState.validationState);
+			}
+			Timing::logRatePerSecond(
+				"Validated WASM code", validateTimer, numFunctionDefs, "functions");
 			break;
+		}
 		case SectionID::data:
 			serializeDataSection(moduleStream, module, moduleState.hadDataCountSection);
 			hadDataSection = true;
@@ -2,13 +2,16 @@
 #include <inttypes.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <string>
 #include <tuple>
 #include <utility>
+#include "LexerTables.h"
 #include "WAVM/Inline/Assert.h"
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/Inline/CLI.h"
 #include "WAVM/Inline/Errors.h"
+#include "WAVM/Inline/Hash.h"
 #include "WAVM/Inline/Timing.h"
 #include "WAVM/Logging/Logging.h"
 #include "WAVM/NFA/NFA.h"
@@ -110,9 +113,7 @@ static void addLiteralTokenToNFA(const char* literalString,
 	addLiteralStringToNFA(literalString, builder, 0, finalState);
 }
 
-StaticData::StaticData(bool allowLegacyInstructionNames)
-{
-	// clang-format off
+// clang-format off
 static const std::pair<TokenType, const char*> regexpTokenPairs[] = {
 	{t_decimalInt, "[+\\-]?\\d+(_\\d+)*"},
 	{t_decimalFloat, "[+\\-]?\\d+(_\\d+)*\\.(\\d+(_\\d+)*)*([eE][+\\-]?\\d+(_\\d+)*)?"},
@@ -184,8 +185,41 @@ static const std::tuple<TokenType, const char*> legacyOperatorAliasTuples[] = {
 	std::make_tuple(t_f32_reinterpret_i32, "f32.reinterpret/i32"),
 	std::make_tuple(t_f64_reinterpret_i64, "f64.reinterpret/i64")
 };
-	// clang-format on
+// clang-format on
+
+// Computes a hash of the token definitions that are compiled into the lexer's DFA, which is used to
+// detect when the precomputed tables in LexerTables.h are out of date.
+static U64 hashTokenDefinitions(bool allowLegacyInstructionNames)
+{
+	U64 hash = 0;
+	auto hashToken = [&hash](TokenType tokenType, const char* string, bool isTokenSeparator) {
+		const U64 stringHash = XXH<U64>(string, strlen(string), 0);
+		hash = XXH64_fixed(stringHash ^ (U64(tokenType) << 1) ^ U64(isTokenSeparator), hash);
+	};
+
+	for(auto regexpTokenPair : regexpTokenPairs)
+	{ hashToken(regexpTokenPair.first, regexpTokenPair.second, false); }
+
+	for(auto literalTokenTuple : literalTokenTuples)
+	{
+		hashToken(std::get<0>(literalTokenTuple),
+				  std::get<1>(literalTokenTuple),
+				  std::get<2>(literalTokenTuple));
+	}
+
+	for(auto legacyOperatorAliasTuple : legacyOperatorAliasTuples)
+	{
+		hashToken(allowLegacyInstructionNames ? std::get<0>(legacyOperatorAliasTuple)
+											  : TokenType(t_legacyInstructionName),
+				  std::get<1>(legacyOperatorAliasTuple),
+				  false);
+	}
 
+	return hash;
+}
+
+static NFA::Machine buildLexerMachine(bool allowLegacyInstructionNames)
+{
 	Timing::Timer timer;
 
 	NFA::Builder* nfaBuilder = NFA::createBuilder();
@@ -222,7 +256,7 @@ static const std::tuple<TokenType, const char*> legacyOperatorAliasTuples[] = {
 			saveFile("nfaGraph.dot", nfaGraphVizString.data(), nfaGraphVizString.size()));
 	}
 
-	nfaMachine = NFA::Machine(nfaBuilder);
+	NFA::Machine nfaMachine(nfaBuilder);
 
 	if(DUMP_DFA_GRAPH)
 	{
@@ -232,6 +266,61 @@ static const std::tuple<TokenType, const char*> legacyOperatorAliasTuples[] = {
 	}
 
 	Timing::logTimer("built lexer tables", timer);
+
+	return nfaMachine;
+}
+
+template<Uptr numRunLengthEncodedTransitions>
+static NFA::Machine createPrecomputedMachine(
+	const U32* charToOffsetMap,
+	const I16 (&runLengthEncodedTransitions)[numRunLengthEncodedTransitions],
+	Uptr numClasses,
+	Uptr numStates)
+{
+	return NFA::Machine(charToOffsetMap,
+						runLengthEncodedTransitions,
+						numRunLengthEncodedTransitions,
+						numClasses,
+						numStates);
+}
+
+static NFA::Machine getPrecomputedLexerMachine(bool allowLegacyInstructionNames)
+{
+	if(allowLegacyInstructionNames)
+	{
+		return createPrecomputedMachine(precomputedLegacyLexerCharToOffsetMap,
+										precomputedLegacyLexerRunLengthEncodedTransitions,
+										precomputedLegacyLexerNumClasses,
+										precomputedLegacyLexerNumStates);
+	}
+	else
+	{
+		return createPrecomputedMachine(precomputedLexerCharToOffsetMap,
+										precomputedLexerRunLengthEncodedTransitions,
+										precomputedLexerNumClasses,
+										precomputedLexerNumStates);
+	}
+}
+
+static bool isPrecomputedLexerMachineUpToDate(bool allowLegacyInstructionNames)
+{
+	return hashTokenDefinitions(allowLegacyInstructionNames)
+		   == (allowLegacyInstructionNames ? precomputedLegacyLexerTokenDefinitionsHash
+										   : precomputedLexerTokenDefinitionsHash);
+}
+
+StaticData::StaticData(bool allowLegacyInstructionNames)
+{
+	// Use the DFA tables that were precomputed by GenerateLexerTables if they were built from the
+	// same token definitions, and otherwise fall back to building the DFA at runtime.
+	if(isPrecomputedLexerMachineUpToDate(allowLegacyInstructionNames))
+	{ nfaMachine = getPrecomputedLexerMachine(allowLegacyInstructionNames); }
+	else
+	{
+		Log::printf(Log::debug,
+					"Precomputed lexer tables are out of date: building them at runtime.\n");
+		nfaMachine = buildLexerMachine(allowLegacyInstructionNames);
+	}
 }
 
 StaticData& StaticData::get(bool allowLegacyInstructionNames)
@@ -248,6 +337,63 @@ StaticData& StaticData::get(bool allowLegacyInstructionNames)
 	}
 }
 
+std::string WAST::generatePrecomputedLexerTables()
+{
+	std::string result;
+	result += "// This file is generated by the GenerateLexerTables build target from the token\n";
+	result += "// definitions in Lexer.cpp. Do not edit it by hand.\n";
+	result += "// clang-format off\n";
+	result += "#pragma once\n\n";
+	result += "#include \"WAVM/Inline/BasicTypes.h\"\n\n";
+
+	for(bool allowLegacyInstructionNames : {false, true})
+	{
+		const char* namePrefix
+			= allowLegacyInstructionNames ? "precomputedLegacyLexer" : "precomputedLexer";
+
+		char hashBuffer[32];
+		snprintf(hashBuffer,
+				 sizeof(hashBuffer),
+				 "0x%016" PRIx64,
+				 hashTokenDefinitions(allowLegacyInstructionNames));
+
+		result += "static constexpr WAVM::U64 " + std::string(namePrefix)
+				  + "TokenDefinitionsHash = " + hashBuffer + ";\n";
+		result += buildLexerMachine(allowLegacyInstructionNames).dumpCPPTables(namePrefix);
+		result += "\n";
+	}
+
+	result += "// clang-format on\n";
+	return result;
+}
+
+bool WAST::validatePrecomputedLexerTables()
+{
+	bool result = true;
+	for(bool allowLegacyInstructionNames : {false, true})
+	{
+		const char* description
+			= allowLegacyInstructionNames ? "legacy instruction name lexer" : "lexer";
+		if(!isPrecomputedLexerMachineUpToDate(allowLegacyInstructionNames))
+		{
+			Log::printf(Log::error,
+						"The precomputed %s tables were generated from different token "
+						"definitions.\n",
+						description);
+			result = false;
+		}
+		else if(buildLexerMachine(allowLegacyInstructionNames)
+				!= getPrecomputedLexerMachine(allowLegacyInstructionNames))
+		{
+			Log::printf(Log::error,
+						"The precomputed %s tables differ from the tables built at runtime.\n",
+						description);
+			result = false;
+		}
+	}
+	return result;
+}
+
 inline bool isRecoveryPointChar(char c)
 {
 	switch(c)
@@ -0,0 +1,3586 @@
+// This file is generated by the GenerateLexerTables build target from the token
+// definitions in Lexer.cpp. Do not edit it by hand.
+// clang-format off
+#pragma once
+
+#include "WAVM/Inline/BasicTypes.h"
+
+static constexpr WAVM::U64 precomputedLexerTokenDefinitionsHash = 0xcc156dd334180cea;
+static constexpr WAVM::Uptr precomputedLexerNumClasses = 57;
+static constexpr WAVM::Uptr precomputedLexerNumStates = 3134;
+static constexpr WAVM::U32 precomputedLexerCharToOffsetMap[256] = {
+	0,6268,6268,6268,6268,6268,6268,6268,6268,15670,3134,6268,6268,15670,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	15670,18804,65814,18804,68948,18804,18804,18804,175504,172370,18804,72082,6268,72082,53278,25072,
+	75216,94020,90886,100288,87752,81484,103422,84618,97154,78350,34474,15670,18804,169236,18804,18804,
+	18804,31340,31340,31340,31340,56412,31340,18804,18804,18804,18804,18804,18804,18804,18804,18804,
+	21938,18804,18804,18804,18804,18804,18804,18804,47010,18804,18804,6268,62680,6268,18804,59546,
+	18804,106556,109690,112824,115958,119092,122226,125360,43876,128494,18804,28206,131628,134762,137896,141030,
+	144164,147298,150432,153566,156700,159834,162968,166102,50144,40742,37608,12536,18804,9402,18804,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+};
+static constexpr WAVM::I16 precomputedLexerRunLengthEncodedTransitions[28190] = {
+	-16384,4,-6,2,-16384,2,-86,1,-16384,19,-49,1,-16384,27,-176,1,
+	-177,1,-178,1,-16384,16,-164,1,-165,1,-166,1,-16384,23,-185,1,
+	-186,1,-187,1,-16384,16,-173,1,-174,1,-175,1,-16384,23,-182,1,
+	-183,1,-184,1,-16384,16,-170,1,-171,1,-172,1,-16384,24,-179,1,
+	-180,1,-181,1,-16384,16,-167,1,-168,1,-169,1,-76,1,-16384,10,
+	-467,1,-16384,3,-153,1,-16384,8,-158,1,-16384,5,-161,1,-16384,5,
+	-160,1,-16384,5,-159,1,-466,1,-16384,1,-463,1,-16384,2,-142,1,
+	-16384,8,-143,1,-144,1,-16384,5,-149,1,-16384,2,-154,1,-16384,7,
+	-163,1,-16384,3,-152,1,-16384,2,-157,1,-16384,5,-147,1,-148,1,
+	-16384,5,-162,1,-16384,3,-151,1,-16384,2,-156,1,-16384,5,-145,1,
+	-146,1,-16384,5,-150,1,-16384,2,-155,1,-16384,3,-398,1,-16384,7,
+	-468,1,-16384,1,-464,1,-16384,5,-469,1,-16384,2,-465,1,-16384,9,
+	-89,1,-16384,6,-21,1,-638,1,-16384,4,-106,1,-16384,1,-48,1,
+	-56,1,-16384,6,-4,1,-16384,2,-22,1,-16384,9,-141,1,-103,1,
+	-16384,2,-139,1,-16384,3,-104,1,-102,1,-16384,2,-105,1,-16384,2,
+	-140,1,-16384,5,-28,1,-16384,3,-73,1,-16384,8,-4,1,-16384,4,
+	-4,1,-16384,2,-110,1,-16384,8,-93,1,-16384,2,-107,1,-16384,2,
+	-30,1,-16384,4,-57,1,-16384,7,-108,1,-16384,5,-109,1,-16384,2,
+	-387,1,-16384,4,-88,1,-16384,3,-74,1,-16384,3,-29,1,-16384,4,
+	-54,1,-16384,2,-254,1,-9,1,-16384,11,-11,1,-16384,8,-12,1,
+	-16384,1,-9,1,-16384,1,-9,1,-16384,3,-58,1,-16384,3,-19,1,
+	-16384,3,-25,1,-16384,9,-134,1,-16384,2,-136,1,-16384,2,-135,1,
+	-16384,2,-138,1,-16384,2,-137,1,-16384,13,-190,1,-189,1,-16384,4,
+	-188,1,-16384,3,-634,1,-16384,1,-31,1,-16384,5,-99,1,-16384,1,
+	-98,1,-16384,1,-97,1,-16384,4,-635,1,-16384,4,-55,1,-10,1,
+	-16384,4,-51,1,-16384,5,-84,1,-16384,19,-85,1,-16384,3,-24,1,
+	-16384,2,-63,1,-16384,19,-400,1,-489,1,-16384,5,-490,1,-491,1,
+	-16384,2,-401,1,-483,1,-16384,5,-399,1,-16384,1,-484,1,-485,1,
+	-16384,11,-409,1,-16384,12,-612,1,-16384,8,-621,1,-16384,4,-474,1,
+	-16384,1,-422,1,-473,1,-16384,11,-477,1,-478,1,-16384,4,-494,1,
+	-495,1,-16384,2,-496,1,-497,1,-16384,3,-423,1,-424,1,-16384,1,
+	-427,1,-428,1,-16384,3,-425,1,-426,1,-16384,1,-429,1,-430,1,
+	-421,1,-16384,12,-407,1,-408,1,-16384,5,-476,1,-16384,7,-499,1,
+	-16384,5,-475,1,-486,1,-16384,5,-487,1,-488,1,-472,1,-60,1,
+	-16384,2,-66,1,-16384,13,-570,1,-16384,2,-404,1,-566,1,-16384,2,
+	-567,1,-568,1,-16384,11,-416,1,-16384,14,-624,1,-573,1,-559,1,
+	-16384,1,-571,1,-16384,3,-574,1,-16384,1,-576,1,-16384,3,-575,1,
+	-16384,1,-577,1,-572,1,-16384,12,-415,1,-16384,14,-578,1,-580,1,
+	-16384,10,-579,1,-581,1,-16384,14,-562,1,-564,1,-16384,10,-563,1,
+	-565,1,-16384,5,-561,1,-16384,8,-560,1,-569,1,-558,1,-16384,15,
+	-323,1,-16384,12,-4,2,-16384,9,-394,1,-395,1,-16384,2,-392,1,
+	-393,1,-16384,3,-4,2,-16384,4,-366,1,-367,1,-16384,2,-364,1,
+	-365,1,-16384,3,-315,1,-16384,2,-126,1,-16384,2,-131,1,-133,1,
+	-132,1,-324,1,-16384,2,-325,1,-326,1,-16384,3,-327,1,-328,1,
+	-16384,3,-319,1,-320,1,-16384,12,-379,1,-16384,2,-4,1,-16384,4,
+	-313,1,-322,1,-272,1,-16384,1,-316,1,-16384,4,-273,1,-274,1,
+	-16384,1,-112,1,-16384,4,-119,1,-120,1,-16384,2,-123,1,-124,1,
+	-16384,2,-121,1,-122,1,-16384,1,-277,1,-278,1,-16384,3,-275,1,
+	-276,1,-16384,1,-279,1,-280,1,-271,1,-16384,15,-4,1,-16384,3,
+	-4,1,-16384,3,-362,1,-363,1,-16384,1,-384,1,-16384,2,-386,1,
+	-16384,2,-385,1,-270,1,-16384,3,-317,1,-318,1,-16384,3,-312,1,
+	-16384,2,-256,1,-311,1,-16384,14,-199,1,-16384,2,-202,1,-204,1,
+	-203,1,-16384,16,-237,1,-16384,3,-244,1,-16384,3,-216,1,-16384,2,
+	-230,1,-16384,7,-251,1,-16384,4,-223,1,-16384,2,-209,1,-16384,11,
+	-239,1,-16384,3,-246,1,-16384,3,-218,1,-16384,2,-232,1,-16384,7,
+	-253,1,-16384,4,-225,1,-16384,2,-211,1,-16384,11,-238,1,-16384,3,
+	-245,1,-16384,3,-217,1,-16384,2,-231,1,-16384,7,-252,1,-16384,4,
+	-224,1,-16384,2,-210,1,-16384,7,-234,1,-16384,1,-241,1,-16384,1,
+	-213,1,-227,1,-16384,5,-248,1,-16384,2,-220,1,-206,1,-16384,2,
+	-192,1,-16384,4,-195,1,-16384,2,-197,1,-16384,2,-196,1,-321,1,
+	-314,1,-59,1,-16384,2,-65,1,-16384,34,-609,1,-16384,4,-608,1,
+	-16384,4,-604,1,-605,1,-16384,3,-547,1,-16384,2,-403,1,-543,1,
+	-16384,2,-544,1,-545,1,-16384,11,-414,1,-16384,26,-616,1,-16384,4,
+	-615,1,-16384,4,-613,1,-614,1,-16384,8,-623,1,-16384,19,-631,1,
+	-442,1,-536,1,-16384,3,-548,1,-16384,2,-549,1,-550,1,-16384,2,
+	-551,1,-552,1,-16384,3,-443,1,-444,1,-16384,1,-447,1,-448,1,
+	-16384,3,-445,1,-446,1,-16384,1,-449,1,-450,1,-441,1,-16384,13,
+	-413,1,-16384,14,-554,1,-556,1,-16384,10,-555,1,-557,1,-16384,14,
+	-539,1,-541,1,-16384,10,-540,1,-542,1,-16384,18,-502,1,-503,1,
+	-16384,9,-553,1,-16384,5,-538,1,-16384,8,-537,1,-546,1,-535,1,
+	-16384,16,-305,1,-16384,7,-357,1,-16384,2,-4,1,-16384,12,-4,2,
+	-16384,9,-390,1,-391,1,-16384,2,-388,1,-389,1,-16384,3,-4,2,
+	-16384,4,-360,1,-361,1,-16384,2,-358,1,-359,1,-16384,3,-297,1,
+	-16384,2,-125,1,-16384,1,-129,1,-130,1,-306,1,-16384,2,-307,1,
+	-308,1,-16384,3,-309,1,-310,1,-16384,3,-301,1,-302,1,-16384,12,
+	-378,1,-16384,2,-4,1,-16384,4,-295,1,-304,1,-261,1,-16384,1,
+	-298,1,-16384,4,-262,1,-263,1,-16384,1,-111,1,-16384,3,-115,1,
+	-116,1,-16384,2,-117,1,-118,1,-16384,1,-266,1,-267,1,-16384,3,
+	-264,1,-265,1,-16384,1,-268,1,-269,1,-260,1,-16384,8,-382,1,
+	-16384,2,-383,1,-259,1,-16384,3,-299,1,-300,1,-16384,3,-294,1,
+	-16384,2,-255,1,-293,1,-16384,14,-198,1,-16384,1,-200,1,-201,1,
+	-16384,15,-235,1,-16384,3,-242,1,-16384,3,-214,1,-16384,2,-228,1,
+	-16384,7,-249,1,-16384,4,-221,1,-16384,2,-207,1,-16384,11,-236,1,
+	-16384,3,-243,1,-16384,3,-215,1,-16384,2,-229,1,-16384,7,-250,1,
+	-16384,4,-222,1,-16384,2,-208,1,-16384,7,-233,1,-16384,1,-240,1,
+	-16384,1,-212,1,-226,1,-16384,5,-247,1,-16384,2,-219,1,-205,1,
+	-16384,2,-191,1,-16384,3,-193,1,-16384,2,-194,1,-303,1,-296,1,
+	-16384,2,-64,1,-16384,14,-521,1,-16384,5,-522,1,-523,1,-16384,2,
+	-402,1,-515,1,-16384,2,-516,1,-517,1,-16384,11,-412,1,-16384,15,
+	-629,1,-16384,8,-622,1,-16384,15,-630,1,-16384,11,-506,1,-16384,1,
+	-432,1,-505,1,-16384,11,-509,1,-510,1,-16384,3,-525,1,-16384,2,
+	-526,1,-527,1,-16384,2,-528,1,-529,1,-16384,3,-433,1,-434,1,
+	-16384,1,-437,1,-438,1,-16384,3,-435,1,-436,1,-16384,1,-439,1,
+	-440,1,-431,1,-16384,15,-410,1,-411,1,-16384,14,-531,1,-533,1,
+	-16384,10,-532,1,-534,1,-16384,14,-511,1,-513,1,-16384,10,-512,1,
+	-514,1,-16384,18,-500,1,-501,1,-16384,5,-508,1,-16384,7,-530,1,
+	-16384,5,-507,1,-518,1,-16384,5,-519,1,-520,1,-504,1,-16384,5,
+	-32,1,-16384,4,-101,1,-16384,1,-100,1,-52,1,-16384,6,-4,1,
+	-16384,4,-4,1,-16384,4,-20,1,-16384,2,-70,1,-62,1,-16384,2,
+	-68,1,-16384,17,-498,1,-16384,3,-597,1,-16384,1,-595,1,-16384,2,
+	-406,1,-16384,11,-420,1,-16384,10,-620,1,-16384,2,-627,1,-16384,1,
+	-628,1,-619,1,-16384,16,-471,1,-16384,2,-602,1,-603,1,-458,1,
+	-16384,1,-594,1,-16384,3,-524,1,-16384,3,-598,1,-600,1,-601,1,
+	-461,1,-459,1,-462,1,-460,1,-16384,3,-493,1,-457,1,-16384,10,
+	-419,1,-16384,1,-599,1,-16384,18,-610,1,-611,1,-16384,1,-492,1,
+	-16384,2,-596,1,-593,1,-16384,16,-347,1,-16384,3,-351,1,-16384,2,
+	-128,1,-16384,1,-349,1,-16384,14,-381,1,-16384,2,-4,1,-16384,10,
+	-377,1,-16384,2,-4,1,-288,1,-16384,1,-344,1,-16384,3,-348,1,
+	-16384,3,-352,1,-354,1,-355,1,-291,1,-16384,1,-289,1,-16384,1,
+	-114,1,-292,1,-290,1,-16384,3,-346,1,-287,1,-16384,1,-353,1,
+	-16384,8,-356,1,-16384,13,-4,2,-16384,4,-4,2,-16384,4,-375,1,
+	-376,1,-16384,2,-373,1,-374,1,-258,1,-16384,1,-345,1,-16384,2,
+	-350,1,-343,1,-61,1,-16384,2,-67,1,-16384,17,-481,1,-16384,3,
+	-586,1,-16384,1,-584,1,-16384,2,-405,1,-16384,11,-418,1,-16384,10,
+	-618,1,-16384,2,-625,1,-16384,1,-626,1,-617,1,-16384,3,-591,1,
+	-592,1,-452,1,-16384,1,-583,1,-16384,3,-482,1,-16384,3,-587,1,
+	-589,1,-590,1,-455,1,-453,1,-456,1,-454,1,-16384,3,-480,1,
+	-451,1,-16384,10,-417,1,-16384,2,-588,1,-16384,14,-470,1,-16384,14,
+	-606,1,-607,1,-16384,1,-479,1,-16384,2,-585,1,-582,1,-16384,15,
+	-333,1,-16384,3,-337,1,-16384,2,-127,1,-16384,1,-335,1,-16384,14,
+	-380,1,-16384,2,-4,1,-282,1,-16384,1,-330,1,-16384,3,-334,1,
+	-16384,3,-338,1,-340,1,-341,1,-285,1,-16384,1,-283,1,-16384,1,
+	-113,1,-286,1,-284,1,-16384,3,-332,1,-281,1,-16384,2,-339,1,
+	-16384,8,-372,1,-16384,2,-4,1,-16384,8,-342,1,-16384,13,-4,2,
+	-16384,4,-4,2,-16384,4,-370,1,-371,1,-16384,2,-368,1,-369,1,
+	-257,1,-16384,1,-331,1,-16384,2,-336,1,-329,1,-16384,9,-71,1,
+	-16384,2,-69,1,-16384,2,-23,1,-16384,10,-77,1,-637,1,-16384,2,
+	-636,1,-27,1,-16384,4,-397,1,-16384,3,-50,1,-16384,4,-96,1,
+	-16384,4,-72,1,-16384,1,-26,1,-16384,6,-81,1,-16384,3,-396,1,
+	-16384,15,-78,1,-16384,1,-82,1,-16384,3,-639,1,-16384,3,-640,1,
+	-94,1,-16384,8,-83,1,-16384,7,-95,1,-16384,11,-87,1,-16384,3,
+	-90,1,-16384,6,-92,1,-91,1,-16384,2,-633,1,-16384,3,-75,1,
+	-16384,7,-47,1,-16384,2,-80,1,-16384,14,-632,1,-16384,19,-44,1,
+	-16384,3,-41,1,-16384,3,-42,1,-16384,4,-33,1,-16384,6,-40,1,
+	-16384,11,-35,1,-16384,6,-39,1,-16384,2,-37,1,-16384,12,-34,1,
+	-16384,6,-38,1,-16384,2,-36,1,-16384,7,-45,1,-16384,5,-43,1,
+	-16384,8,-46,1,-16384,4,-4,1,-16384,2,-53,1,-16384,2,-79,1,
+	-5,1,-16384,2,-6,1,-16384,1,-5,1,-16384,1,-5,2,-16384,2,
+	-5,1,-16384,1,-5,1,-16384,1,-5,2,-16384,1,-8,1,-7,1,
+	-16384,2,-8,1,-16384,1,-7,1,-16384,1,-7,2,-16384,2,-7,1,
+	-16384,1,-7,1,-16384,1,-7,2,-6,2,-16384,3,-9,1,-16384,3,
+	-6,1,-16384,1,-8,1,-16384,1,-8,1,-14,1,-16384,1,-15,1,
+	-16384,5,-14,1,-13,1,-16384,9,-6,2,-16384,2,-86,1,-16384,19,
+	-49,1,-16384,27,-176,1,-177,1,-178,1,-16384,16,-164,1,-165,1,
+	-166,1,-16384,23,-185,1,-186,1,-187,1,-16384,16,-173,1,-174,1,
+	-175,1,-16384,23,-182,1,-183,1,-184,1,-16384,16,-170,1,-171,1,
+	-172,1,-16384,24,-179,1,-180,1,-181,1,-16384,16,-167,1,-168,1,
+	-169,1,-76,1,-16384,10,-467,1,-16384,3,-153,1,-16384,8,-158,1,
+	-16384,5,-161,1,-16384,5,-160,1,-16384,5,-159,1,-466,1,-16384,1,
+	-463,1,-16384,2,-142,1,-16384,8,-143,1,-144,1,-16384,5,-149,1,
+	-16384,2,-154,1,-16384,7,-163,1,-16384,3,-152,1,-16384,2,-157,1,
+	-16384,5,-147,1,-148,1,-16384,5,-162,1,-16384,3,-151,1,-16384,2,
+	-156,1,-16384,5,-145,1,-146,1,-16384,5,-150,1,-16384,2,-155,1,
+	-16384,3,-398,1,-16384,7,-468,1,-16384,1,-464,1,-16384,5,-469,1,
+	-16384,2,-465,1,-16384,9,-89,1,-16384,6,-21,1,-638,1,-16384,4,
+	-106,1,-16384,1,-48,1,-56,1,-16384,6,-4,1,-16384,2,-22,1,
+	-16384,9,-141,1,-103,1,-16384,2,-139,1,-16384,3,-104,1,-102,1,
+	-16384,2,-105,1,-16384,2,-140,1,-16384,5,-28,1,-16384,3,-73,1,
+	-16384,8,-4,1,-16384,4,-4,1,-16384,2,-110,1,-16384,8,-93,1,
+	-16384,2,-107,1,-16384,2,-30,1,-16384,4,-57,1,-16384,7,-108,1,
+	-16384,5,-109,1,-16384,2,-387,1,-16384,4,-88,1,-16384,3,-74,1,
+	-16384,3,-29,1,-16384,4,-54,1,-16384,2,-254,1,-9,1,-16384,11,
+	-11,1,-16384,8,-12,1,-16384,1,-9,1,-16384,1,-9,1,-16384,3,
+	-58,1,-16384,3,-19,1,-16384,3,-25,1,-16384,9,-134,1,-16384,2,
+	-136,1,-16384,2,-135,1,-16384,2,-138,1,-16384,2,-137,1,-16384,13,
+	-190,1,-189,1,-16384,4,-188,1,-16384,3,-634,1,-16384,1,-31,1,
+	-16384,5,-99,1,-16384,1,-98,1,-16384,1,-97,1,-16384,4,-635,1,
+	-16384,4,-55,1,-10,1,-16384,4,-51,1,-16384,5,-84,1,-16384,19,
+	-85,1,-16384,3,-24,1,-16384,2,-63,1,-16384,19,-400,1,-489,1,
+	-16384,5,-490,1,-491,1,-16384,2,-401,1,-483,1,-16384,5,-399,1,
+	-16384,1,-484,1,-485,1,-16384,11,-409,1,-16384,12,-612,1,-16384,8,
+	-621,1,-16384,4,-474,1,-16384,1,-422,1,-473,1,-16384,11,-477,1,
+	-478,1,-16384,4,-494,1,-495,1,-16384,2,-496,1,-497,1,-16384,3,
+	-423,1,-424,1,-16384,1,-427,1,-428,1,-16384,3,-425,1,-426,1,
+	-16384,1,-429,1,-430,1,-421,1,-16384,12,-407,1,-408,1,-16384,5,
+	-476,1,-16384,7,-499,1,-16384,5,-475,1,-486,1,-16384,5,-487,1,
+	-488,1,-472,1,-60,1,-16384,2,-66,1,-16384,13,-570,1,-16384,2,
+	-404,1,-566,1,-16384,2,-567,1,-568,1,-16384,11,-416,1,-16384,14,
+	-624,1,-573,1,-559,1,-16384,1,-571,1,-16384,3,-574,1,-16384,1,
+	-576,1,-16384,3,-575,1,-16384,1,-577,1,-572,1,-16384,12,-415,1,
+	-16384,14,-578,1,-580,1,-16384,10,-579,1,-581,1,-16384,14,-562,1,
+	-564,1,-16384,10,-563,1,-565,1,-16384,5,-561,1,-16384,8,-560,1,
+	-569,1,-558,1,-16384,15,-323,1,-16384,12,-4,2,-16384,9,-394,1,
+	-395,1,-16384,2,-392,1,-393,1,-16384,3,-4,2,-16384,4,-366,1,
+	-367,1,-16384,2,-364,1,-365,1,-16384,3,-315,1,-16384,2,-126,1,
+	-16384,2,-131,1,-133,1,-132,1,-324,1,-16384,2,-325,1,-326,1,
+	-16384,3,-327,1,-328,1,-16384,3,-319,1,-320,1,-16384,12,-379,1,
+	-16384,2,-4,1,-16384,4,-313,1,-322,1,-272,1,-16384,1,-316,1,
+	-16384,4,-273,1,-274,1,-16384,1,-112,1,-16384,4,-119,1,-120,1,
+	-16384,2,-123,1,-124,1,-16384,2,-121,1,-122,1,-16384,1,-277,1,
+	-278,1,-16384,3,-275,1,-276,1,-16384,1,-279,1,-280,1,-271,1,
+	-16384,15,-4,1,-16384,3,-4,1,-16384,3,-362,1,-363,1,-16384,1,
+	-384,1,-16384,2,-386,1,-16384,2,-385,1,-270,1,-16384,3,-317,1,
+	-318,1,-16384,3,-312,1,-16384,2,-256,1,-311,1,-16384,14,-199,1,
+	-16384,2,-202,1,-204,1,-203,1,-16384,16,-237,1,-16384,3,-244,1,
+	-16384,3,-216,1,-16384,2,-230,1,-16384,7,-251,1,-16384,4,-223,1,
+	-16384,2,-209,1,-16384,11,-239,1,-16384,3,-246,1,-16384,3,-218,1,
+	-16384,2,-232,1,-16384,7,-253,1,-16384,4,-225,1,-16384,2,-211,1,
+	-16384,11,-238,1,-16384,3,-245,1,-16384,3,-217,1,-16384,2,-231,1,
+	-16384,7,-252,1,-16384,4,-224,1,-16384,2,-210,1,-16384,7,-234,1,
+	-16384,1,-241,1,-16384,1,-213,1,-227,1,-16384,5,-248,1,-16384,2,
+	-220,1,-206,1,-16384,2,-192,1,-16384,4,-195,1,-16384,2,-197,1,
+	-16384,2,-196,1,-321,1,-314,1,-59,1,-16384,2,-65,1,-16384,34,
+	-609,1,-16384,4,-608,1,-16384,4,-604,1,-605,1,-16384,3,-547,1,
+	-16384,2,-403,1,-543,1,-16384,2,-544,1,-545,1,-16384,11,-414,1,
+	-16384,26,-616,1,-16384,4,-615,1,-16384,4,-613,1,-614,1,-16384,8,
+	-623,1,-16384,19,-631,1,-442,1,-536,1,-16384,3,-548,1,-16384,2,
+	-549,1,-550,1,-16384,2,-551,1,-552,1,-16384,3,-443,1,-444,1,
+	-16384,1,-447,1,-448,1,-16384,3,-445,1,-446,1,-16384,1,-449,1,
+	-450,1,-441,1,-16384,13,-413,1,-16384,14,-554,1,-556,1,-16384,10,
+	-555,1,-557,1,-16384,14,-539,1,-541,1,-16384,10,-540,1,-542,1,
+	-16384,18,-502,1,-503,1,-16384,9,-553,1,-16384,5,-538,1,-16384,8,
+	-537,1,-546,1,-535,1,-16384,16,-305,1,-16384,7,-357,1,-16384,2,
+	-4,1,-16384,12,-4,2,-16384,9,-390,1,-391,1,-16384,2,-388,1,
+	-389,1,-16384,3,-4,2,-16384,4,-360,1,-361,1,-16384,2,-358,1,
+	-359,1,-16384,3,-297,1,-16384,2,-125,1,-16384,1,-129,1,-130,1,
+	-306,1,-16384,2,-307,1,-308,1,-16384,3,-309,1,-310,1,-16384,3,
+	-301,1,-302,1,-16384,12,-378,1,-16384,2,-4,1,-16384,4,-295,1,
+	-304,1,-261,1,-16384,1,-298,1,-16384,4,-262,1,-263,1,-16384,1,
+	-111,1,-16384,3,-115,1,-116,1,-16384,2,-117,1,-118,1,-16384,1,
+	-266,1,-267,1,-16384,3,-264,1,-265,1,-16384,1,-268,1,-269,1,
+	-260,1,-16384,8,-382,1,-16384,2,-383,1,-259,1,-16384,3,-299,1,
+	-300,1,-16384,3,-294,1,-16384,2,-255,1,-293,1,-16384,14,-198,1,
+	-16384,1,-200,1,-201,1,-16384,15,-235,1,-16384,3,-242,1,-16384,3,
+	-214,1,-16384,2,-228,1,-16384,7,-249,1,-16384,4,-221,1,-16384,2,
+	-207,1,-16384,11,-236,1,-16384,3,-243,1,-16384,3,-215,1,-16384,2,
+	-229,1,-16384,7,-250,1,-16384,4,-222,1,-16384,2,-208,1,-16384,7,
+	-233,1,-16384,1,-240,1,-16384,1,-212,1,-226,1,-16384,5,-247,1,
+	-16384,2,-219,1,-205,1,-16384,2,-191,1,-16384,3,-193,1,-16384,2,
+	-194,1,-303,1,-296,1,-16384,2,-64,1,-16384,14,-521,1,-16384,5,
+	-522,1,-523,1,-16384,2,-402,1,-515,1,-16384,2,-516,1,-517,1,
+	-16384,11,-412,1,-16384,15,-629,1,-16384,8,-622,1,-16384,15,-630,1,
+	-16384,11,-506,1,-16384,1,-432,1,-505,1,-16384,11,-509,1,-510,1,
+	-16384,3,-525,1,-16384,2,-526,1,-527,1,-16384,2,-528,1,-529,1,
+	-16384,3,-433,1,-434,1,-16384,1,-437,1,-438,1,-16384,3,-435,1,
+	-436,1,-16384,1,-439,1,-440,1,-431,1,-16384,15,-410,1,-411,1,
+	-16384,14,-531,1,-533,1,-16384,10,-532,1,-534,1,-16384,14,-511,1,
+	-513,1,-16384,10,-512,1,-514,1,-16384,18,-500,1,-501,1,-16384,5,
+	-508,1,-16384,7,-530,1,-16384,5,-507,1,-518,1,-16384,5,-519,1,
+	-520,1,-504,1,-16384,5,-32,1,-16384,4,-101,1,-16384,1,-100,1,
+	-52,1,-16384,6,-4,1,-16384,4,-4,1,-16384,4,-20,1,-16384,2,
+	-70,1,-62,1,-16384,2,-68,1,-16384,17,-498,1,-16384,3,-597,1,
+	-16384,1,-595,1,-16384,2,-406,1,-16384,11,-420,1,-16384,10,-620,1,
+	-16384,2,-627,1,-16384,1,-628,1,-619,1,-16384,16,-471,1,-16384,2,
+	-602,1,-603,1,-458,1,-16384,1,-594,1,-16384,3,-524,1,-16384,3,
+	-598,1,-600,1,-601,1,-461,1,-459,1,-462,1,-460,1,-16384,3,
+	-493,1,-457,1,-16384,10,-419,1,-16384,1,-599,1,-16384,18,-610,1,
+	-611,1,-16384,1,-492,1,-16384,2,-596,1,-593,1,-16384,16,-347,1,
+	-16384,3,-351,1,-16384,2,-128,1,-16384,1,-349,1,-16384,14,-381,1,
+	-16384,2,-4,1,-16384,10,-377,1,-16384,2,-4,1,-288,1,-16384,1,
+	-344,1,-16384,3,-348,1,-16384,3,-352,1,-354,1,-355,1,-291,1,
+	-16384,1,-289,1,-16384,1,-114,1,-292,1,-290,1,-16384,3,-346,1,
+	-287,1,-16384,1,-353,1,-16384,8,-356,1,-16384,13,-4,2,-16384,4,
+	-4,2,-16384,4,-375,1,-376,1,-16384,2,-373,1,-374,1,-258,1,
+	-16384,1,-345,1,-16384,2,-350,1,-343,1,-61,1,-16384,2,-67,1,
+	-16384,17,-481,1,-16384,3,-586,1,-16384,1,-584,1,-16384,2,-405,1,
+	-16384,11,-418,1,-16384,10,-618,1,-16384,2,-625,1,-16384,1,-626,1,
+	-617,1,-16384,3,-591,1,-592,1,-452,1,-16384,1,-583,1,-16384,3,
+	-482,1,-16384,3,-587,1,-589,1,-590,1,-455,1,-453,1,-456,1,
+	-454,1,-16384,3,-480,1,-451,1,-16384,10,-417,1,-16384,2,-588,1,
+	-16384,14,-470,1,-16384,14,-606,1,-607,1,-16384,1,-479,1,-16384,2,
+	-585,1,-582,1,-16384,15,-333,1,-16384,3,-337,1,-16384,2,-127,1,
+	-16384,1,-335,1,-16384,14,-380,1,-16384,2,-4,1,-282,1,-16384,1,
+	-330,1,-16384,3,-334,1,-16384,3,-338,1,-340,1,-341,1,-285,1,
+	-16384,1,-283,1,-16384,1,-113,1,-286,1,-284,1,-16384,3,-332,1,
+	-281,1,-16384,2,-339,1,-16384,8,-372,1,-16384,2,-4,1,-16384,8,
+	-342,1,-16384,13,-4,2,-16384,4,-4,2,-16384,4,-370,1,-371,1,
+	-16384,2,-368,1,-369,1,-257,1,-16384,1,-331,1,-16384,2,-336,1,
+	-329,1,-16384,9,-71,1,-16384,2,-69,1,-16384,2,-23,1,-16384,10,
+	-77,1,-637,1,-16384,2,-636,1,-27,1,-16384,4,-397,1,-16384,3,
+	-50,1,-16384,4,-96,1,-16384,4,-72,1,-16384,1,-26,1,-16384,6,
+	-81,1,-16384,3,-396,1,-16384,15,-78,1,-16384,1,-82,1,-16384,3,
+	-639,1,-16384,3,-640,1,-94,1,-16384,8,-83,1,-16384,7,-95,1,
+	-16384,11,-87,1,-16384,3,-90,1,-16384,6,-92,1,-91,1,-16384,2,
+	-633,1,-16384,3,-75,1,-16384,7,-47,1,-16384,2,-80,1,-16384,14,
+	-632,1,-16384,19,-44,1,-16384,3,-41,1,-16384,3,-42,1,-16384,4,
+	-33,1,-16384,6,-40,1,-16384,11,-35,1,-16384,6,-39,1,-16384,2,
+	-37,1,-16384,12,-34,1,-16384,6,-38,1,-16384,2,-36,1,-16384,7,
+	-45,1,-16384,5,-43,1,-16384,8,-46,1,-16384,4,-4,1,-16384,2,
+	-53,1,-16384,2,-79,1,-5,1,-16384,2,-6,1,-16384,1,-5,1,
+	-16384,1,-5,2,-16384,2,-5,1,-16384,1,-5,1,-16384,1,-5,2,
+	-16384,1,-8,1,-7,1,-16384,2,-8,1,-16384,1,-7,1,-16384,1,
+	-7,2,-16384,2,-7,1,-16384,1,-7,1,-16384,1,-7,2,-6,2,
+	-16384,3,-9,1,-16384,3,-6,1,-16384,1,-8,1,-16384,1,-8,1,
+	-14,1,-16384,1,-15,1,3120,1,-16384,4,-14,1,-13,1,1,1,
+	-16384,5,1,1,-16384,3118,3120,1,-16384,1,3120,1,-16384,4,-14,1,
+	-16384,1,1,1,-16384,5,1,1,-16384,3118,3120,1,-16384,1,3120,1,
+	-16384,3,3120,1,-14,1,-16384,1,1,1,-16384,3,1,1,-16384,1,
+	1,1,-16384,3118,3120,1,-16384,1,3120,1,-16384,1,3125,1,-16384,2,
+	-14,1,-16384,1,1,1,-16384,1,3132,1,-16384,3,1,1,-16384,2,
+	-6,2,-16384,2,-86,1,-16384,19,-49,1,-16384,27,-176,1,-177,1,
+	-178,1,-16384,16,-164,1,-165,1,-166,1,-16384,23,-185,1,-186,1,
+	-187,1,-16384,16,-173,1,-174,1,-175,1,-16384,23,-182,1,-183,1,
+	-184,1,-16384,16,-170,1,-171,1,-172,1,-16384,24,-179,1,-180,1,
+	-181,1,-16384,16,-167,1,-168,1,-169,1,-76,1,-16384,10,-467,1,
+	-16384,3,-153,1,-16384,8,-158,1,-16384,5,-161,1,-16384,5,-160,1,
+	-16384,5,-159,1,-466,1,-16384,1,-463,1,-16384,2,-142,1,-16384,8,
+	-143,1,-144,1,-16384,5,-149,1,-16384,2,-154,1,-16384,7,-163,1,
+	-16384,3,-152,1,-16384,2,-157,1,-16384,5,-147,1,-148,1,-16384,5,
+	-162,1,-16384,3,-151,1,-16384,2,-156,1,-16384,5,-145,1,-146,1,
+	-16384,5,-150,1,-16384,2,-155,1,-16384,3,-398,1,-16384,7,-468,1,
+	-16384,1,-464,1,-16384,5,-469,1,-16384,2,-465,1,-16384,9,-89,1,
+	-16384,6,-21,1,-638,1,-16384,4,-106,1,-16384,1,-48,1,-56,1,
+	-16384,6,-4,1,-16384,2,-22,1,-16384,9,-141,1,-103,1,-16384,2,
+	-139,1,-16384,3,-104,1,-102,1,-16384,2,-105,1,-16384,2,-140,1,
+	-16384,5,-28,1,-16384,3,-73,1,-16384,8,-4,1,-16384,4,-4,1,
+	-16384,2,-110,1,-16384,8,-93,1,-16384,2,-107,1,-16384,2,-30,1,
+	-16384,4,-57,1,-16384,7,-108,1,-16384,5,-109,1,-16384,2,-387,1,
+	-16384,4,-88,1,-16384,3,-74,1,-16384,3,-29,1,-16384,4,-54,1,
+	-16384,2,-254,1,-9,1,-16384,11,-11,1,-16384,8,-12,1,-16384,1,
+	-9,1,-16384,1,-9,1,-16384,3,-58,1,-16384,3,-19,1,-16384,3,
+	-25,1,-16384,9,-134,1,-16384,2,-136,1,-16384,2,-135,1,-16384,2,
+	-138,1,-16384,2,-137,1,-16384,13,-190,1,-189,1,-16384,4,-188,1,
+	-16384,3,-634,1,-16384,1,-31,1,-16384,5,-99,1,-16384,1,-98,1,
+	-16384,1,-97,1,-16384,4,-635,1,-16384,4,-55,1,-10,1,-16384,4,
+	-51,1,-16384,5,-84,1,-16384,19,-85,1,-16384,3,-24,1,-16384,2,
+	-63,1,-16384,19,-400,1,-489,1,-16384,5,-490,1,-491,1,-16384,2,
+	-401,1,-483,1,-16384,5,-399,1,-16384,1,-484,1,-485,1,-16384,11,
+	-409,1,-16384,12,-612,1,-16384,8,-621,1,-16384,4,-474,1,-16384,1,
+	-422,1,-473,1,-16384,11,-477,1,-478,1,-16384,4,-494,1,-495,1,
+	-16384,2,-496,1,-497,1,-16384,3,-423,1,-424,1,-16384,1,-427,1,
+	-428,1,-16384,3,-425,1,-426,1,-16384,1,-429,1,-430,1,-421,1,
+	-16384,12,-407,1,-408,1,-16384,5,-476,1,-16384,7,-499,1,-16384,5,
+	-475,1,-486,1,-16384,5,-487,1,-488,1,-472,1,-60,1,-16384,2,
+	-66,1,-16384,13,-570,1,-16384,2,-404,1,-566,1,-16384,2,-567,1,
+	-568,1,-16384,11,-416,1,-16384,14,-624,1,-573,1,-559,1,-16384,1,
+	-571,1,-16384,3,-574,1,-16384,1,-576,1,-16384,3,-575,1,-16384,1,
+	-577,1,-572,1,-16384,12,-415,1,-16384,14,-578,1,-580,1,-16384,10,
+	-579,1,-581,1,-16384,14,-562,1,-564,1,-16384,10,-563,1,-565,1,
+	-16384,5,-561,1,-16384,8,-560,1,-569,1,-558,1,-16384,15,-323,1,
+	-16384,12,-4,2,-16384,9,-394,1,-395,1,-16384,2,-392,1,-393,1,
+	-16384,3,-4,2,-16384,4,-366,1,-367,1,-16384,2,-364,1,-365,1,
+	-16384,3,-315,1,-16384,2,-126,1,-16384,2,-131,1,-133,1,-132,1,
+	-324,1,-16384,2,-325,1,-326,1,-16384,3,-327,1,-328,1,-16384,3,
+	-319,1,-320,1,-16384,12,-379,1,-16384,2,-4,1,-16384,4,-313,1,
+	-322,1,-272,1,-16384,1,-316,1,-16384,4,-273,1,-274,1,-16384,1,
+	-112,1,-16384,4,-119,1,-120,1,-16384,2,-123,1,-124,1,-16384,2,
+	-121,1,-122,1,-16384,1,-277,1,-278,1,-16384,3,-275,1,-276,1,
+	-16384,1,-279,1,-280,1,-271,1,-16384,15,-4,1,-16384,3,-4,1,
+	-16384,3,-362,1,-363,1,-16384,1,-384,1,-16384,2,-386,1,-16384,2,
+	-385,1,-270,1,-16384,3,-317,1,-318,1,-16384,3,-312,1,-16384,2,
+	-256,1,-311,1,-16384,14,-199,1,-16384,2,-202,1,-204,1,-203,1,
+	-16384,16,-237,1,-16384,3,-244,1,-16384,3,-216,1,-16384,2,-230,1,
+	-16384,7,-251,1,-16384,4,-223,1,-16384,2,-209,1,-16384,11,-239,1,
+	-16384,3,-246,1,-16384,3,-218,1,-16384,2,-232,1,-16384,7,-253,1,
+	-16384,4,-225,1,-16384,2,-211,1,-16384,11,-238,1,-16384,3,-245,1,
+	-16384,3,-217,1,-16384,2,-231,1,-16384,7,-252,1,-16384,4,-224,1,
+	-16384,2,-210,1,-16384,7,-234,1,-16384,1,-241,1,-16384,1,-213,1,
+	-227,1,-16384,5,-248,1,-16384,2,-220,1,-206,1,-16384,2,-192,1,
+	-16384,4,-195,1,-16384,2,-197,1,-16384,2,-196,1,-321,1,-314,1,
+	-59,1,-16384,2,-65,1,-16384,34,-609,1,-16384,4,-608,1,-16384,4,
+	-604,1,-605,1,-16384,3,-547,1,-16384,2,-403,1,-543,1,-16384,2,
+	-544,1,-545,1,-16384,11,-414,1,-16384,26,-616,1,-16384,4,-615,1,
+	-16384,4,-613,1,-614,1,-16384,8,-623,1,-16384,19,-631,1,-442,1,
+	-536,1,-16384,3,-548,1,-16384,2,-549,1,-550,1,-16384,2,-551,1,
+	-552,1,-16384,3,-443,1,-444,1,-16384,1,-447,1,-448,1,-16384,3,
+	-445,1,-446,1,-16384,1,-449,1,-450,1,-441,1,-16384,13,-413,1,
+	-16384,14,-554,1,-556,1,-16384,10,-555,1,-557,1,-16384,14,-539,1,
+	-541,1,-16384,10,-540,1,-542,1,-16384,18,-502,1,-503,1,-16384,9,
+	-553,1,-16384,5,-538,1,-16384,8,-537,1,-546,1,-535,1,-16384,16,
+	-305,1,-16384,7,-357,1,-16384,2,-4,1,-16384,12,-4,2,-16384,9,
+	-390,1,-391,1,-16384,2,-388,1,-389,1,-16384,3,-4,2,-16384,4,
+	-360,1,-361,1,-16384,2,-358,1,-359,1,-16384,3,-297,1,-16384,2,
+	-125,1,-16384,1,-129,1,-130,1,-306,1,-16384,2,-307,1,-308,1,
+	-16384,3,-309,1,-310,1,-16384,3,-301,1,-302,1,-16384,12,-378,1,
+	-16384,2,-4,1,-16384,4,-295,1,-304,1,-261,1,-16384,1,-298,1,
+	-16384,4,-262,1,-263,1,-16384,1,-111,1,-16384,3,-115,1,-116,1,
+	-16384,2,-117,1,-118,1,-16384,1,-266,1,-267,1,-16384,3,-264,1,
+	-265,1,-16384,1,-268,1,-269,1,-260,1,-16384,8,-382,1,-16384,2,
+	-383,1,-259,1,-16384,3,-299,1,-300,1,-16384,3,-294,1,-16384,2,
+	-255,1,-293,1,-16384,14,-198,1,-16384,1,-200,1,-201,1,-16384,15,
+	-235,1,-16384,3,-242,1,-16384,3,-214,1,-16384,2,-228,1,-16384,7,
+	-249,1,-16384,4,-221,1,-16384,2,-207,1,-16384,11,-236,1,-16384,3,
+	-243,1,-16384,3,-215,1,-16384,2,-229,1,-16384,7,-250,1,-16384,4,
+	-222,1,-16384,2,-208,1,-16384,7,-233,1,-16384,1,-240,1,-16384,1,
+	-212,1,-226,1,-16384,5,-247,1,-16384,2,-219,1,-205,1,-16384,2,
+	-191,1,-16384,3,-193,1,-16384,2,-194,1,-303,1,-296,1,-16384,2,
+	-64,1,-16384,14,-521,1,-16384,5,-522,1,-523,1,-16384,2,-402,1,
+	-515,1,-16384,2,-516,1,-517,1,-16384,11,-412,1,-16384,15,-629,1,
+	-16384,8,-622,1,-16384,15,-630,1,-16384,11,-506,1,-16384,1,-432,1,
+	-505,1,-16384,11,-509,1,-510,1,-16384,3,-525,1,-16384,2,-526,1,
+	-527,1,-16384,2,-528,1,-529,1,-16384,3,-433,1,-434,1,-16384,1,
+	-437,1,-438,1,-16384,3,-435,1,-436,1,-16384,1,-439,1,-440,1,
+	-431,1,-16384,15,-410,1,-411,1,-16384,14,-531,1,-533,1,-16384,10,
+	-532,1,-534,1,-16384,14,-511,1,-513,1,-16384,10,-512,1,-514,1,
+	-16384,18,-500,1,-501,1,-16384,5,-508,1,-16384,7,-530,1,-16384,5,
+	-507,1,-518,1,-16384,5,-519,1,-520,1,-504,1,-16384,5,-32,1,
+	-16384,4,-101,1,-16384,1,-100,1,-52,1,-16384,6,-4,1,-16384,4,
+	-4,1,-16384,4,-20,1,-16384,2,-70,1,-62,1,-16384,2,-68,1,
+	-16384,17,-498,1,-16384,3,-597,1,-16384,1,-595,1,-16384,2,-406,1,
+	-16384,11,-420,1,-16384,10,-620,1,-16384,2,-627,1,-16384,1,-628,1,
+	-619,1,-16384,16,-471,1,-16384,2,-602,1,-603,1,-458,1,-16384,1,
+	-594,1,-16384,3,-524,1,-16384,3,-598,1,-600,1,-601,1,-461,1,
+	-459,1,-462,1,-460,1,-16384,3,-493,1,-457,1,-16384,10,-419,1,
+	-16384,1,-599,1,-16384,18,-610,1,-611,1,-16384,1,-492,1,-16384,2,
+	-596,1,-593,1,-16384,16,-347,1,-16384,3,-351,1,-16384,2,-128,1,
+	-16384,1,-349,1,-16384,14,-381,1,-16384,2,-4,1,-16384,10,-377,1,
+	-16384,2,-4,1,-288,1,-16384,1,-344,1,-16384,3,-348,1,-16384,3,
+	-352,1,-354,1,-355,1,-291,1,-16384,1,-289,1,-16384,1,-114,1,
+	-292,1,-290,1,-16384,3,-346,1,-287,1,-16384,1,-353,1,-16384,8,
+	-356,1,-16384,13,-4,2,-16384,4,-4,2,-16384,4,-375,1,-376,1,
+	-16384,2,-373,1,-374,1,-258,1,-16384,1,-345,1,-16384,2,-350,1,
+	-343,1,-61,1,-16384,2,-67,1,-16384,17,-481,1,-16384,3,-586,1,
+	-16384,1,-584,1,-16384,2,-405,1,-16384,11,-418,1,-16384,10,-618,1,
+	-16384,2,-625,1,-16384,1,-626,1,-617,1,-16384,3,-591,1,-592,1,
+	-452,1,-16384,1,-583,1,-16384,3,-482,1,-16384,3,-587,1,-589,1,
+	-590,1,-455,1,-453,1,-456,1,-454,1,-16384,3,-480,1,-451,1,
+	-16384,10,-417,1,-16384,2,-588,1,-16384,14,-470,1,-16384,14,-606,1,
+	-607,1,-16384,1,-479,1,-16384,2,-585,1,-582,1,-16384,15,-333,1,
+	-16384,3,-337,1,-16384,2,-127,1,-16384,1,-335,1,-16384,14,-380,1,
+	-16384,2,-4,1,-282,1,-16384,1,-330,1,-16384,3,-334,1,-16384,3,
+	-338,1,-340,1,-341,1,-285,1,-16384,1,-283,1,-16384,1,-113,1,
+	-286,1,-284,1,-16384,3,-332,1,-281,1,-16384,2,-339,1,-16384,8,
+	-372,1,-16384,2,-4,1,-16384,8,-342,1,-16384,13,-4,2,-16384,4,
+	-4,2,-16384,4,-370,1,-371,1,-16384,2,-368,1,-369,1,-257,1,
+	-16384,1,-331,1,-16384,2,-336,1,-329,1,-16384,9,-71,1,-16384,2,
+	-69,1,-16384,2,-23,1,-16384,10,-77,1,-637,1,-16384,2,-636,1,
+	-27,1,-16384,4,-397,1,-16384,3,-50,1,-16384,4,-96,1,-16384,4,
+	-72,1,-16384,1,-26,1,-16384,6,-81,1,-16384,3,-396,1,-16384,15,
+	-78,1,-16384,1,-82,1,-16384,3,-639,1,-16384,3,-640,1,-94,1,
+	-16384,8,-83,1,-16384,7,-95,1,-16384,11,-87,1,-16384,3,-90,1,
+	-16384,6,-92,1,-91,1,-16384,2,-633,1,-16384,3,-75,1,-16384,7,
+	-47,1,-16384,2,-80,1,-16384,14,-632,1,-16384,19,-44,1,-16384,3,
+	-41,1,-16384,3,-42,1,-16384,4,-33,1,-16384,6,-40,1,-16384,11,
+	-35,1,-16384,6,-39,1,-16384,2,-37,1,-16384,12,-34,1,-16384,6,
+	-38,1,-16384,2,-36,1,-16384,7,-45,1,-16384,5,-43,1,-16384,8,
+	-46,1,-16384,4,-4,1,-16384,2,-53,1,-16384,2,-79,1,-5,1,
+	-16384,2,-6,1,-16384,1,-5,1,-16384,1,-5,2,-16384,2,-5,1,
+	-16384,1,-5,1,-16384,1,-5,2,-16384,1,-8,1,-7,1,-16384,2,
+	-8,1,-16384,1,-7,1,-16384,1,-7,2,-16384,2,-7,1,-16384,1,
+	-7,1,-16384,1,-7,2,-6,2,-16384,3,-9,1,-16384,3,-6,1,
+	-16384,1,-8,1,-16384,1,-8,1,-14,1,3120,1,-15,1,3120,1,
+	-16384,4,-14,1,-13,1,1,1,-16384,5,1,1,3119,1,-16384,3116,
+	3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,
+	-16384,5,1,1,3119,1,-16384,3084,3089,1,3097,1,-16384,2,3089,1,
+	-16384,4,3097,1,-16384,6,3097,2,-16384,11,3089,1,-16384,1,3089,1,
+	3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,
+	-16384,5,1,1,3119,1,-16384,988,999,1,993,1,-16384,70,1064,1,
+	-16384,61,1131,1,1127,1,-16384,524,1652,1,-16384,14,1674,1,1668,1,
+	-16384,68,1737,1,-16384,683,2421,1,-16384,13,2435,1,-16384,51,2494,1,
+	2488,1,-16384,201,2690,1,-16384,39,2730,1,-16384,24,2762,1,2756,1,
+	-16384,363,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,
+	1,1,-16384,5,1,1,3119,1,-16384,608,612,1,-16384,176,789,1,
+	-16384,167,957,1,-16384,662,1620,1,-16384,564,2185,1,-16384,718,2904,1,
+	-16384,14,2919,1,-16384,11,2931,1,-16384,33,2965,1,-16384,154,3119,1,
+	3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,5,
+	1,1,3119,1,-16384,521,525,2,527,2,-16384,2558,3087,2,3096,1,
+	-16384,1,3091,2,-16384,4,3096,1,-16384,5,3103,1,3104,2,-16384,10,
+	3116,2,3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,
+	3126,2,3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,-16384,1,
+	1,1,3119,1,-16384,499,503,1,-16384,2607,3111,1,-16384,8,3119,1,
+	3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,5,
+	1,1,3119,1,-16384,280,286,1,-16384,14,306,1,-16384,100,400,1,
+	-16384,147,548,1,-16384,114,663,1,664,1,-16384,44,709,1,710,1,
+	-16384,404,1148,1,-16384,39,1161,1,-16384,1,1157,1,-16384,220,1378,1,
+	-16384,4,1383,1,-16384,56,1440,1,-16384,4,1445,1,-16384,337,1795,1,
+	-16384,18,1808,1,-16384,1,1804,1,-16384,824,2629,1,-16384,490,3119,1,
+	3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,5,
+	1,1,3119,1,-16384,19,370,1,-16384,322,347,1,-16384,23,373,1,
+	-16384,45,416,1,-16384,122,539,1,-16384,21,561,1,-16384,19,581,1,
+	-16384,1892,2474,1,-16384,267,2742,1,-16384,66,2809,1,-16384,113,2923,1,
+	-16384,14,3058,1,-16384,181,3119,1,3120,1,-16384,1,3120,1,-16384,4,
+	3119,1,-16384,1,1,1,-16384,5,1,1,3119,1,-16384,18,418,1,
+	368,1,-16384,337,361,1,-16384,87,449,1,-16384,68,518,1,-16384,105,
+	624,1,-16384,14,639,1,-16384,18,658,1,-16384,168,827,1,-16384,71,
+	899,1,-16384,14,914,1,-16384,12,927,1,-16384,14,942,1,-16384,38,
+	1029,1,-16384,213,1199,1,-16384,18,1214,1,-16384,19,1238,1,-16384,18,
+	1253,1,-16384,19,1277,1,-16384,18,1292,1,-16384,17,1312,1,-16384,10,
+	1321,1,-16384,36,1393,1,-16384,173,1532,1,-16384,14,1547,1,-16384,12,
+	1560,1,-16384,14,1575,1,-16384,68,1704,1,-16384,194,1843,1,-16384,18,
+	1858,1,-16384,19,1882,1,-16384,18,1897,1,-16384,17,1917,1,-16384,10,
+	1926,1,-16384,31,1958,1,-16384,148,2107,1,-16384,14,2122,1,-16384,12,
+	2135,1,-16384,14,2150,1,-16384,672,2823,1,-16384,46,2870,1,-16384,56,
+	2927,1,-16384,32,2970,1,-16384,54,3015,1,-16384,34,3050,1,-16384,69,
+	3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,
+	-16384,5,1,1,3119,1,-16384,1,3086,1,-16384,499,524,1,-16384,2600,
+	3115,1,-16384,13,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,
+	-16384,1,1,1,-16384,5,1,1,3119,1,-16384,1,3086,1,-16384,5,
+	2788,1,-16384,21,33,1,-16384,45,79,1,-16384,44,124,1,-16384,45,
+	170,1,-16384,45,223,1,-16384,50,268,1,-16384,30,299,1,-16384,19,
+	319,1,-16384,147,481,1,-16384,38,524,1,-16384,96,644,1,-16384,28,
+	631,1,-16384,19,770,1,-16384,49,701,1,-16384,36,738,1,-16384,5,
+	749,1,-16384,69,815,1,982,1,-16384,5,883,1,-16384,30,852,1,
+	-16384,54,907,1,-16384,11,919,1,-16384,15,935,1,-16384,11,947,1,
+	-16384,25,1115,1,-16384,211,1308,1,-16384,3,1193,1,-16384,22,1212,1,
+	-16384,15,1232,1,-16384,22,1251,1,-16384,15,1271,1,-16384,22,1290,1,
+	-16384,28,1319,1,-16384,24,1345,1,1646,1,-16384,6,1515,1,-16384,19,
+	1372,1,-16384,15,1388,1,-16384,29,1418,1,-16384,15,1434,1,-16384,15,
+	1450,1,-16384,18,1469,1,-16384,5,1475,1,-16384,11,1494,1,-16384,52,
+	1540,1,-16384,11,1552,1,-16384,15,1568,1,-16384,11,1580,1,-16384,19,
+	1600,1,-16384,10,1611,1,-16384,24,1783,1,-16384,193,1913,1,-16384,2,
+	1837,1,-16384,22,1856,1,-16384,15,1876,1,-16384,22,1895,1,-16384,28,
+	1924,1,-16384,20,1945,1,-16384,5,2087,1,-16384,38,1990,1,-16384,28,
+	2019,1,-16384,5,2025,1,-16384,27,2053,1,-16384,5,2066,1,-16384,54,
+	2114,1,-16384,11,2126,1,-16384,15,2142,1,-16384,11,2154,1,-16384,19,
+	2174,1,-16384,69,2245,1,-16384,7,2346,1,-16384,34,2287,1,-16384,10,
+	2301,1,-16384,19,2318,1,-16384,2,2323,1,-16384,10,2336,1,-16384,41,
+	2374,1,-16384,76,2455,1,-16384,66,2519,1,-16384,7,2604,1,-16384,34,
+	2561,1,-16384,10,2575,1,-16384,6,2581,1,-16384,10,2594,1,-16384,35,
+	2626,1,-16384,17,2644,1,-16384,61,2710,1,-16384,249,3049,1,-16384,50,
+	3007,1,-16384,2,3010,1,-16384,19,3030,1,-16384,2,3033,1,-16384,72,
+	3115,1,-16384,13,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,
+	-16384,1,1,1,-16384,5,1,1,3119,1,-16384,1,3069,2,-16384,29,
+	36,1,-16384,44,81,1,-16384,44,126,1,-16384,45,172,1,-16384,42,
+	215,1,-16384,176,392,1,-16384,53,464,1,-16384,93,540,1,-16384,26,
+	567,1,-16384,20,588,1,-16384,58,647,1,-16384,166,814,1,-16384,2,
+	817,1,-16384,351,1169,1,-16384,14,1184,1,-16384,3,1188,1,-16384,38,
+	1227,1,-16384,38,1266,1,-16384,77,1344,1,-16384,2,1347,1,-16384,468,
+	1816,1,-16384,12,1829,1,-16384,2,1832,1,-16384,38,1871,1,-16384,75,
+	1947,1,-16384,267,2215,1,-16384,28,2244,1,-16384,2,2247,1,-16384,270,
+	2518,1,-16384,2,2521,1,-16384,295,2817,1,-16384,20,2838,1,-16384,105,
+	2944,1,-16384,128,3069,1,-16384,14,3088,1,-16384,3,3088,1,-16384,13,
+	3069,2,-16384,7,3069,1,-16384,1,3088,1,-16384,1,3088,1,3119,1,
+	3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,5,
+	1,1,3119,1,-16384,1,3070,2,-16384,518,525,2,527,2,-16384,2541,
+	3078,1,-16384,2,3070,1,-16384,4,3078,1,-16384,6,3078,2,3087,2,
+	3096,1,-16384,1,3091,2,-16384,4,3096,1,-16384,5,3103,1,3104,2,
+	3070,2,-16384,7,3070,1,3116,2,3118,2,3119,1,3120,1,-16384,1,
+	3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,3130,1,1,1,
+	-16384,1,3133,2,-16384,1,1,1,3119,1,-16384,1,3071,2,-16384,2,
+	2849,1,-16384,33,43,1,-16384,11,55,1,-16384,6,62,1,-16384,11,
+	74,1,-16384,13,88,1,-16384,11,100,1,-16384,6,107,1,-16384,11,
+	119,1,-16384,13,133,1,-16384,11,145,1,-16384,6,152,1,-16384,11,
+	164,1,-16384,14,179,1,-16384,11,191,1,-16384,6,198,1,-16384,11,
+	210,1,-16384,23,234,1,-16384,5,240,1,-16384,5,246,1,-16384,5,
+	252,1,-16384,14,267,1,-16384,2,270,1,-16384,12,283,1,-16384,14,
+	298,1,-16384,2,301,1,-16384,16,318,1,-16384,2,321,1,-16384,26,
+	348,1,-16384,34,383,1,-16384,45,429,1,-16384,43,473,1,-16384,52,
+	526,1,-16384,1,526,1,-16384,91,620,1,-16384,4,625,1,-16384,7,
+	633,1,-16384,34,668,1,-16384,3,672,1,-16384,7,685,1,-16384,14,
+	695,1,-16384,8,704,1,-16384,29,734,1,-16384,5,740,1,-16384,5,
+	746,1,-16384,3,750,1,-16384,3,758,1,755,1,-16384,6,766,1,
+	763,1,-16384,12,776,1,-16384,4,781,1,-16384,14,796,1,-16384,2,
+	799,1,-16384,5,805,1,-16384,3,809,1,-16384,26,836,1,-16384,9,
+	846,1,-16384,8,855,1,-16384,15,874,1,872,1,-16384,4,880,1,
+	878,1,-16384,12,891,1,-16384,6,898,1,-16384,4,903,1,-16384,5,
+	909,1,-16384,5,915,1,-16384,5,921,1,-16384,4,926,1,-16384,4,
+	931,1,-16384,5,937,1,-16384,5,943,1,-16384,5,949,1,-16384,12,
+	962,1,-16384,26,989,1,-16384,12,1002,1,-16384,4,1007,1,-16384,3,
+	1011,1,-16384,10,1022,1,-16384,3,1026,1,-16384,16,1043,1,-16384,9,
+	1053,1,-16384,10,1065,1,-16384,17,1103,1,-16384,1,1084,1,-16384,7,
+	1092,1,-16384,3,1096,1,-16384,3,1100,1,-16384,6,1111,1,1108,1,
+	-16384,11,1123,1,-16384,2,1140,1,-16384,13,1137,1,-16384,5,1143,1,
+	-16384,2,1146,1,-16384,4,1151,1,-16384,45,1197,1,-16384,3,1201,1,
+	-16384,3,1205,1,-16384,2,1208,1,-16384,7,1216,1,-16384,4,1221,1,
+	-16384,2,1224,1,-16384,11,1236,1,-16384,3,1240,1,-16384,3,1244,1,
+	-16384,2,1247,1,-16384,7,1255,1,-16384,4,1260,1,-16384,2,1263,1,
+	-16384,11,1275,1,-16384,3,1279,1,-16384,3,1283,1,-16384,2,1286,1,
+	-16384,7,1294,1,-16384,4,1299,1,-16384,2,1302,1,-16384,30,1333,1,
+	-16384,2,1336,1,-16384,2,1339,1,-16384,23,1363,1,-16384,3,1367,1,
+	-16384,6,1374,1,-16384,1,1382,1,1377,1,-16384,12,1390,1,-16384,11,
+	1402,1,-16384,9,1412,1,-16384,8,1421,1,-16384,7,1429,1,-16384,6,
+	1436,1,-16384,1,1444,1,1439,1,-16384,12,1452,1,-16384,13,1466,1,
+	-16384,5,1472,1,-16384,5,1478,1,-16384,3,1482,1,-16384,8,1491,1,
+	-16384,3,1495,1,-16384,3,1503,1,1500,1,-16384,6,1511,1,1508,1,
+	-16384,15,1524,1,-16384,6,1531,1,-16384,4,1536,1,-16384,5,1542,1,
+	-16384,5,1548,1,-16384,5,1554,1,-16384,4,1559,1,-16384,4,1564,1,
+	-16384,5,1570,1,-16384,5,1576,1,-16384,5,1582,1,-16384,4,1587,1,
+	-16384,8,1596,1,-16384,5,1602,1,-16384,4,1607,1,-16384,5,1613,1,
+	-16384,11,1625,1,-16384,26,1653,1,-16384,11,1664,1,-16384,12,1677,1,
+	-16384,4,1682,1,-16384,3,1686,1,-16384,10,1697,1,-16384,3,1701,1,
+	-16384,14,1716,1,-16384,9,1726,1,-16384,10,1738,1,-16384,17,1771,1,
+	-16384,1,1757,1,-16384,6,1764,1,-16384,3,1768,1,-16384,6,1779,1,
+	1776,1,-16384,13,1790,1,-16384,2,1793,1,-16384,4,1798,1,-16384,42,
+	1841,1,-16384,3,1845,1,-16384,3,1849,1,-16384,2,1852,1,-16384,7,
+	1860,1,-16384,4,1865,1,-16384,2,1868,1,-16384,11,1880,1,-16384,3,
+	1884,1,-16384,3,1888,1,-16384,2,1891,1,-16384,7,1899,1,-16384,4,
+	1904,1,-16384,2,1907,1,-16384,29,1937,1,-16384,2,1940,1,-16384,21,
+	1962,1,-16384,3,1966,1,-16384,7,1974,1,-16384,9,1984,1,-16384,8,
+	1993,1,-16384,9,2003,1,-16384,12,2016,1,-16384,5,2022,1,-16384,5,
+	2028,1,-16384,7,2036,1,-16384,3,2040,1,-16384,8,2049,1,-16384,5,
+	2055,1,-16384,7,2063,1,-16384,3,2067,1,-16384,3,2075,1,2072,1,
+	-16384,6,2083,1,2080,1,-16384,15,2096,1,-16384,4,2101,1,-16384,4,
+	2106,1,-16384,4,2111,1,-16384,5,2117,1,-16384,5,2123,1,-16384,5,
+	2129,1,-16384,4,2134,1,-16384,4,2139,1,-16384,5,2145,1,-16384,5,
+	2151,1,-16384,5,2157,1,-16384,4,2162,1,-16384,8,2171,1,-16384,5,
+	2177,1,-16384,14,2192,1,-16384,2,2195,1,-16384,5,2201,1,-16384,3,
+	2205,1,-16384,17,2223,1,-16384,57,2281,1,-16384,8,2290,1,-16384,19,
+	2310,1,-16384,3,2314,1,-16384,37,2352,1,-16384,13,2366,1,-16384,3,
+	2370,1,-16384,5,2376,1,-16384,44,2422,1,-16384,13,2436,1,-16384,48,
+	2484,1,-16384,18,2503,1,-16384,3,2507,1,-16384,47,2555,1,-16384,8,
+	2564,1,-16384,45,2610,1,-16384,11,2622,1,-16384,5,2628,1,-16384,11,
+	2640,1,-16384,5,2646,1,-16384,43,2691,1,-16384,39,2731,1,-16384,21,
+	2752,1,-16384,18,2771,1,-16384,3,2775,1,-16384,31,2807,1,-16384,30,
+	2839,1,-16384,18,2857,1,-16384,13,2871,1,-16384,4,2876,1,-16384,3,
+	2880,1,-16384,15,2896,1,-16384,12,2909,1,-16384,44,2954,1,-16384,28,
+	2983,1,-16384,14,2998,1,-16384,3,3002,1,-16384,18,3021,1,-16384,3,
+	3025,1,-16384,47,3071,1,-16384,1,3075,1,-16384,1,3075,1,3083,1,
+	-16384,2,3081,1,-16384,1,3081,1,-16384,1,3083,2,-16384,1,3090,1,
+	-16384,3,3090,1,-16384,1,3094,1,-16384,1,3094,1,3102,1,-16384,2,
+	3100,1,-16384,1,3100,1,-16384,1,3102,2,3113,2,-16384,7,3113,1,
+	-16384,1,3117,1,-16384,1,3117,1,3119,1,3120,1,-16384,1,3120,1,
+	-16384,4,3119,1,-16384,1,1,1,-16384,5,3129,1,3119,1,-16384,3116,
+	3119,1,3122,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,
+	-16384,4,1,1,3128,1,3120,1,-16384,3117,3121,1,-16384,1,3120,1,
+	-16384,4,-14,1,-16384,1,1,1,-16384,4,2,1,1,1,3119,1,
+	-16384,3116,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,
+	1,1,-16384,4,3,1,1,1,3119,1,-16384,3067,3073,1,-16384,7,
+	3079,1,-16384,10,3092,1,-16384,7,3098,1,-16384,21,3119,1,3120,1,
+	-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,4,1,
+	1,1,3119,1,3105,1,5,2,-16384,497,504,1,-16384,20,525,2,
+	527,2,-16384,2541,3077,1,3074,1,3072,2,3074,2,3076,2,3077,1,
+	3080,3,3082,2,3084,1,3085,2,3087,2,3096,1,3093,1,3091,2,
+	3093,2,3095,2,3096,1,3099,3,3101,2,3103,1,3104,2,3106,2,
+	-16384,4,504,1,-16384,1,3114,2,3116,2,3118,2,3119,1,3120,1,
+	-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,3130,1,
+	1,1,-16384,1,3133,2,5,1,1,1,3119,1,3106,1,5,2,
+	-16384,518,525,2,527,2,-16384,2541,3077,1,3074,1,3072,2,3074,2,
+	3076,2,3077,1,3080,3,3082,2,3084,1,3085,2,3087,2,3096,1,
+	3093,1,3091,2,3093,2,3095,2,3096,1,3099,3,3101,2,3103,1,
+	3104,2,3106,2,-16384,6,3114,2,3116,2,3118,2,3119,1,3120,1,
+	-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,3130,1,
+	1,1,-16384,1,3133,2,5,1,1,1,3119,1,3106,1,5,2,
+	-16384,518,525,2,527,2,-16384,1469,1998,1,-16384,32,2031,1,-16384,1038,
+	3077,1,3074,1,3072,2,3074,2,3076,2,3077,1,3080,3,3082,2,
+	3084,1,3085,2,3087,2,3096,1,3093,1,3091,2,3093,2,3095,2,
+	3096,1,3099,3,3101,2,3103,1,3104,2,3106,2,-16384,6,3114,2,
+	3116,2,3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,
+	3126,2,3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,5,1,
+	1,1,3119,1,3106,1,5,2,-16384,518,525,2,527,2,-16384,945,
+	1474,1,-16384,549,2024,1,-16384,1045,3077,1,3074,1,3072,2,3074,2,
+	3076,2,3077,1,3080,3,3082,2,3084,1,3085,2,3087,2,3096,1,
+	3093,1,3091,2,3093,2,3095,2,3096,1,3099,3,3101,2,3103,1,
+	3104,2,3106,2,-16384,6,3114,2,3116,2,3118,2,3119,1,3120,1,
+	-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,3130,1,
+	1,1,-16384,1,3133,2,5,1,1,1,3119,1,3106,1,5,2,
+	-16384,25,78,1,-16384,23,58,1,-16384,18,77,1,-16384,25,103,1,
+	-16384,18,122,1,-16384,4,125,1,-16384,20,148,1,-16384,18,167,1,
+	-16384,26,194,1,-16384,18,213,1,-16384,21,239,1,-16384,32,282,1,
+	-16384,53,320,1,-16384,204,525,2,527,2,-16384,46,575,1,-16384,25,
+	813,1,-16384,306,908,1,-16384,11,920,1,-16384,15,936,1,-16384,11,
+	948,1,-16384,48,997,1,-16384,8,1006,1,-16384,10,1017,1,-16384,3,
+	1021,1,-16384,46,1068,1,-16384,2,1071,1,-16384,274,1346,1,-16384,24,
+	1371,1,-16384,17,1389,1,-16384,43,1433,1,-16384,17,1451,1,-16384,204,
+	1656,1,-16384,2,1659,1,-16384,12,1672,1,-16384,8,1681,1,-16384,10,
+	1692,1,-16384,3,1696,1,-16384,357,2054,1,-16384,182,2243,1,-16384,81,
+	2319,1,-16384,55,2375,1,-16384,49,2425,1,-16384,2,2428,1,-16384,63,
+	2492,1,-16384,5,2498,1,-16384,3,2502,1,-16384,17,2520,1,-16384,104,
+	2625,1,-16384,19,2645,1,-16384,88,2734,1,-16384,2,2737,1,-16384,22,
+	2760,1,-16384,5,2766,1,-16384,3,2770,1,-16384,235,3006,1,-16384,4,
+	3011,1,-16384,17,3029,1,-16384,4,3034,1,-16384,35,3077,1,3074,1,
+	3072,2,3074,2,3076,2,3077,1,3080,3,3082,2,3084,1,3085,2,
+	3087,2,3096,1,3093,1,3091,2,3093,2,3095,2,3096,1,3099,3,
+	3101,2,3103,1,3104,2,3106,2,-16384,6,3114,2,3116,2,3118,2,
+	3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,
+	-16384,1,3130,1,1,1,-16384,1,3133,2,5,1,1,1,3119,1,
+	3106,1,5,2,-16384,23,168,1,123,1,-16384,24,56,1,-16384,18,
+	75,1,-16384,4,80,1,-16384,20,101,1,-16384,18,120,1,-16384,25,
+	146,1,-16384,18,165,1,-16384,26,192,1,-16384,18,211,1,-16384,20,
+	245,1,-16384,32,297,1,-16384,34,300,1,-16384,224,525,2,527,2,
+	-16384,45,576,1,-16384,25,1343,1,-16384,215,816,1,-16384,89,906,1,
+	-16384,11,918,1,-16384,15,934,1,-16384,11,946,1,-16384,49,998,1,
+	-16384,8,1010,1,-16384,10,1018,1,-16384,3,1025,1,-16384,17,1039,1,
+	-16384,52,1095,1,-16384,30,1142,1,-16384,7,1130,1,-16384,3,1134,1,
+	-16384,1,1136,1,-16384,42,1180,1,-16384,7,1226,1,-16384,144,1335,1,
+	-16384,37,1387,1,-16384,2,1373,1,-16384,58,1449,1,-16384,2,1435,1,
+	-16384,235,1673,1,-16384,8,1685,1,-16384,10,1693,1,-16384,3,1700,1,
+	-16384,45,1741,1,-16384,2,1744,1,-16384,307,2052,1,-16384,183,2517,1,
+	-16384,9,2246,1,-16384,70,2317,1,-16384,55,2373,1,-16384,65,2439,1,
+	-16384,2,2442,1,-16384,48,2493,1,-16384,5,2499,1,-16384,3,2506,1,
+	-16384,125,2627,1,-16384,15,2643,1,-16384,50,2694,1,-16384,2,2697,1,
+	-16384,61,2761,1,-16384,5,2767,1,-16384,3,2774,1,-16384,235,3009,1,
+	-16384,2,3008,1,-16384,19,3032,1,-16384,2,3031,1,-16384,38,3077,1,
+	3074,1,3072,2,3074,2,3076,2,3077,1,3080,3,3082,2,3084,1,
+	3085,2,3087,2,3096,1,3093,1,3091,2,3093,2,3095,2,3096,1,
+	3099,3,3101,2,3103,1,3104,2,3106,2,-16384,6,3114,2,3116,2,
+	3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,
+	3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,5,1,1,1,
+	3119,1,3106,1,5,2,-16384,7,598,1,-16384,10,29,1,-16384,8,
+	34,1,-16384,195,230,1,-16384,32,263,1,-16384,261,525,2,527,2,
+	-16384,116,645,1,-16384,90,736,1,-16384,299,1036,1,-16384,52,1089,1,
+	-16384,30,1120,1,-16384,56,1177,1,-16384,6,1185,1,-16384,145,1330,1,
+	-16384,139,1470,1,-16384,5,1476,1,-16384,61,1538,1,-16384,11,1550,1,
+	-16384,15,1566,1,-16384,11,1578,1,-16384,19,1598,1,-16384,10,1609,1,
+	-16384,101,1711,1,-16384,50,1762,1,-16384,25,1788,1,-16384,35,1824,1,
+	-16384,4,1830,1,-16384,105,1935,1,-16384,20,2030,1,-16384,40,1997,1,
+	-16384,22,2020,1,-16384,5,2026,1,-16384,88,2115,1,-16384,11,2127,1,
+	-16384,15,2143,1,-16384,11,2155,1,-16384,19,2175,1,-16384,894,3077,1,
+	3074,1,3072,2,3074,2,3076,2,3077,1,3080,3,3082,2,3084,1,
+	3085,2,3087,2,3096,1,3093,1,3091,2,3093,2,3095,2,3096,1,
+	3099,3,3101,2,3103,1,3104,2,3106,2,-16384,6,3114,2,3116,2,
+	3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,
+	3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,5,1,1,1,
+	3119,1,3106,1,5,2,-16384,7,601,1,-16384,10,32,1,-16384,143,
+	214,1,-16384,1,171,1,-16384,58,233,1,-16384,32,266,1,-16384,5,
+	269,1,-16384,255,525,2,527,2,-16384,210,739,1,-16384,296,1038,1,
+	-16384,52,1091,1,-16384,30,1122,1,-16384,56,1179,1,-16384,6,1187,1,
+	-16384,145,1332,1,-16384,137,1468,1,-16384,72,1541,1,-16384,11,1553,1,
+	-16384,15,1569,1,-16384,11,1581,1,-16384,19,1601,1,-16384,10,1612,1,
+	-16384,98,1712,1,-16384,50,1763,1,-16384,25,1789,1,-16384,35,1825,1,
+	-16384,4,1831,1,-16384,105,1936,1,-16384,10,1946,1,-16384,71,2018,1,
+	-16384,94,2113,1,-16384,11,2125,1,-16384,15,2141,1,-16384,11,2153,1,
+	-16384,19,2173,1,-16384,896,3077,1,3074,1,3072,2,3074,2,3076,2,
+	3077,1,3080,3,3082,2,3084,1,3085,2,3087,2,3096,1,3093,1,
+	3091,2,3093,2,3095,2,3096,1,3099,3,3101,2,3103,1,3104,2,
+	3106,2,-16384,6,3114,2,3116,2,3118,2,3119,1,3120,1,-16384,1,
+	3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,3130,1,1,1,
+	-16384,1,3133,2,5,1,1,1,3119,1,3106,1,5,2,-16384,5,
+	2235,1,-16384,1,599,1,-16384,10,30,1,-16384,30,57,1,-16384,18,
+	76,1,-16384,25,102,1,-16384,18,121,1,-16384,25,147,1,-16384,18,
+	166,1,-16384,26,193,1,-16384,18,212,1,-16384,18,231,1,-16384,32,
+	264,1,-16384,261,525,2,527,2,-16384,44,573,1,-16384,331,905,1,
+	-16384,11,917,1,-16384,15,933,1,-16384,11,945,1,-16384,45,1019,1,
+	-16384,3,995,1,-16384,8,1004,1,-16384,10,1015,1,-16384,20,1037,1,
+	-16384,52,1090,1,-16384,30,1121,1,-16384,4,1135,1,-16384,3,1129,1,
+	-16384,3,1133,1,-16384,43,1178,1,-16384,6,1186,1,-16384,145,1331,1,
+	-16384,38,1369,1,-16384,61,1431,1,-16384,234,1694,1,-16384,3,1670,1,
+	-16384,8,1679,1,-16384,10,1690,1,-16384,49,1740,1,-16384,2,1743,1,
+	-16384,307,2051,1,-16384,264,2316,1,-16384,55,2372,1,-16384,65,2438,1,
+	-16384,2,2441,1,-16384,44,2500,1,-16384,3,2490,1,-16384,5,2496,1,
+	-16384,145,2642,1,-16384,50,2693,1,-16384,2,2696,1,-16384,57,2768,1,
+	-16384,3,2758,1,-16384,5,2764,1,-16384,239,3004,1,-16384,22,3027,1,
+	-16384,42,3077,1,3074,1,3072,2,3074,2,3076,2,3077,1,3080,3,
+	3082,2,3084,1,3085,2,3087,2,3096,1,3093,1,3091,2,3093,2,
+	3095,2,3096,1,3099,3,3101,2,3103,1,3104,2,3106,2,-16384,6,
+	3114,2,3116,2,3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,
+	-16384,1,3126,2,3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,
+	5,1,1,1,3119,1,3106,1,5,2,-16384,5,2236,1,-16384,1,
+	600,1,-16384,10,31,1,-16384,4,169,1,-16384,4,35,1,-16384,194,
+	232,1,251,1,-16384,31,265,1,317,1,-16384,260,525,2,527,2,
+	-16384,44,574,1,-16384,25,1944,1,-16384,46,646,1,-16384,90,737,1,
+	-16384,253,1020,1,-16384,3,996,1,-16384,8,1005,1,-16384,10,1016,1,
+	-16384,21,1040,1,-16384,29,1067,1,-16384,2,1070,1,-16384,19,1099,1,
+	-16384,30,1145,1,-16384,56,1181,1,-16384,7,1265,1,-16384,144,1338,1,
+	-16384,37,1370,1,-16384,61,1432,1,-16384,39,1471,1,-16384,5,1477,1,
+	-16384,61,1539,1,-16384,11,1551,1,-16384,15,1567,1,-16384,11,1579,1,
+	-16384,19,1599,1,-16384,10,1610,1,-16384,44,1655,1,-16384,2,1658,1,
+	-16384,7,1695,1,-16384,3,1671,1,-16384,8,1680,1,-16384,10,1691,1,
+	-16384,21,1713,1,-16384,50,1767,1,-16384,25,1792,1,-16384,35,1826,1,
+	-16384,5,1870,1,-16384,104,1939,1,-16384,84,2021,1,-16384,5,2027,1,
+	-16384,88,2116,1,-16384,11,2128,1,-16384,15,2144,1,-16384,11,2156,1,
+	-16384,19,2176,1,-16384,247,2424,1,-16384,2,2427,1,-16384,58,2501,1,
+	-16384,3,2491,1,-16384,5,2497,1,-16384,127,2624,1,-16384,108,2733,1,
+	-16384,2,2736,1,-16384,17,2769,1,-16384,3,2759,1,-16384,5,2765,1,
+	-16384,239,3005,1,-16384,22,3028,1,-16384,42,3077,1,3074,1,3072,2,
+	3074,2,3076,2,3077,1,3080,3,3082,2,3084,1,3085,2,3087,2,
+	3096,1,3093,1,3091,2,3093,2,3095,2,3096,1,3099,3,3101,2,
+	3103,1,3104,2,3106,2,-16384,6,3114,2,3116,2,3118,2,3119,1,
+	3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,
+	3130,1,1,1,-16384,1,3133,2,6,1,1,1,3119,1,-16384,5,
+	2850,1,2826,1,-16384,6,499,1,-16384,1,490,1,-16384,3,366,1,
+	-16384,2,26,1,-16384,24,51,1,-16384,8,60,1,-16384,9,70,1,
+	-16384,25,96,1,-16384,8,105,1,-16384,9,115,1,-16384,25,141,1,
+	-16384,8,150,1,-16384,9,160,1,-16384,26,187,1,-16384,8,196,1,
+	-16384,9,206,1,-16384,9,216,1,-16384,19,236,1,-16384,5,242,1,
+	-16384,5,248,1,-16384,5,254,1,-16384,6,261,1,-16384,12,279,1,
+	-16384,2,277,1,-16384,7,294,1,-16384,6,292,1,-16384,12,314,1,
+	-16384,6,312,1,-16384,12,330,1,-16384,2,328,1,-16384,30,359,1,
+	-16384,2,362,1,-16384,14,379,1,-16384,9,387,1,-16384,31,423,1,
+	420,1,-16384,13,434,1,-16384,4,439,1,-16384,52,492,1,-16384,11,
+	505,1,-16384,2,507,1,-16384,5,513,1,-16384,11,525,2,527,2,
+	-16384,12,541,1,-16384,28,570,1,-16384,13,586,1,-16384,63,648,1,
+	-16384,5,743,1,727,1,-16384,14,670,1,-16384,5,676,1,-16384,13,
+	700,1,-16384,1,692,1,-16384,4,697,1,-16384,8,713,1,-16384,66,
+	773,1,-16384,4,778,1,-16384,8,787,1,-16384,19,807,1,-16384,7,
+	969,1,-16384,2,818,1,-16384,13,832,1,-16384,8,851,1,-16384,1,
+	843,1,-16384,4,848,1,-16384,8,857,1,-16384,30,888,1,-16384,4,
+	893,1,-16384,61,955,1,-16384,36,1000,1,-16384,90,1087,1,-16384,101,
+	1304,1,-16384,3,1189,1,-16384,38,1228,1,-16384,38,1267,1,-16384,60,
+	1328,1,-16384,16,1632,1,-16384,2,1348,1,-16384,6,1486,1,-16384,9,
+	1365,1,-16384,32,1398,1,-16384,8,1417,1,-16384,1,1409,1,-16384,4,
+	1414,1,-16384,9,1455,1,-16384,54,1479,1,-16384,37,1517,1,-16384,3,
+	1521,1,-16384,4,1526,1,-16384,62,1589,1,-16384,28,1618,1,-16384,31,
+	1650,1,-16384,16,1675,1,-16384,88,1760,1,-16384,73,1909,1,-16384,2,
+	1833,1,-16384,38,1872,1,-16384,60,1933,1,-16384,14,1948,1,-16384,5,
+	2058,1,2042,1,-16384,8,1964,1,-16384,5,1970,1,-16384,8,1989,1,
+	-16384,1,1981,1,-16384,4,1986,1,-16384,9,2005,1,-16384,41,2038,1,
+	-16384,50,2089,1,-16384,3,2093,1,-16384,4,2098,1,-16384,65,2164,1,
+	-16384,18,2183,1,-16384,19,2203,1,-16384,9,2213,1,-16384,14,2228,1,
+	-16384,4,2233,1,-16384,11,2385,1,-16384,2,2248,1,-16384,7,2331,1,
+	-16384,15,2272,1,-16384,3,2286,1,-16384,1,2278,1,-16384,4,2283,1,
+	-16384,8,2297,1,-16384,1,2294,1,-16384,9,2320,1,-16384,20,2325,1,
+	-16384,23,2349,1,-16384,4,2354,1,-16384,38,2450,1,-16384,50,2444,1,
+	-16384,13,2459,1,-16384,60,2655,1,-16384,2,2522,1,-16384,7,2589,1,
+	-16384,15,2546,1,-16384,3,2560,1,-16384,1,2552,1,-16384,4,2557,1,
+	-16384,8,2571,1,-16384,1,2568,1,-16384,9,2578,1,-16384,4,2583,1,
+	-16384,23,2607,1,-16384,4,2612,1,-16384,50,2705,1,-16384,35,2699,1,
+	-16384,13,2714,1,-16384,119,2833,1,-16384,3,2837,1,-16384,12,2893,1,
+	-16384,21,2872,1,-16384,25,2898,1,-16384,3,2902,1,-16384,9,2912,1,
+	-16384,8,2921,1,-16384,7,2929,1,-16384,28,3035,1,-16384,7,2966,1,
+	-16384,5,2972,1,-16384,11,2984,1,-16384,1,2990,1,-16384,9,2996,1,
+	-16384,3,3000,1,-16384,22,3023,1,-16384,21,3045,1,-16384,5,3051,1,
+	-16384,35,3087,2,3096,1,-16384,1,3091,2,-16384,4,3096,1,-16384,5,
+	3103,1,3104,2,-16384,3,3109,1,-16384,6,3116,2,3118,2,3119,1,
+	3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,
+	3130,1,1,1,-16384,1,3133,2,7,1,1,1,3119,1,-16384,212,
+	217,1,-16384,146,363,1,-16384,3,389,1,-16384,70,438,1,-16384,86,
+	525,2,527,2,-16384,119,649,1,790,1,-16384,11,667,1,-16384,156,
+	819,1,958,1,-16384,10,830,1,-16384,201,1032,1,-16384,171,1204,1,
+	-16384,38,1243,1,-16384,38,1282,1,-16384,32,1315,1,-16384,32,1349,1,
+	1621,1,-16384,46,1396,1,-16384,310,1707,1,-16384,140,1848,1,-16384,38,
+	1887,1,-16384,32,1920,1,-16384,27,1949,1,2186,1,-16384,11,1961,1,
+	-16384,250,2212,1,-16384,19,2232,1,-16384,16,2381,1,-16384,18,2268,1,
+	-16384,117,2513,1,-16384,18,2405,1,-16384,117,2651,1,-16384,18,2542,1,
+	-16384,113,2781,1,-16384,17,2674,1,-16384,226,2901,1,-16384,11,2913,1,
+	-16384,53,2967,1,-16384,119,3087,2,3096,1,-16384,1,3091,2,-16384,4,
+	3096,1,-16384,5,3103,1,3104,2,-16384,10,3116,2,3118,2,3119,1,
+	3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,
+	3130,1,1,1,-16384,1,3133,2,8,1,1,1,3119,1,-16384,212,
+	218,1,-16384,126,343,1,-16384,16,360,1,-16384,25,386,1,-16384,6,
+	393,1,-16384,39,433,1,-16384,8,442,1,-16384,37,480,1,-16384,23,
+	506,1,-16384,7,512,1,-16384,10,523,1,-16384,1,525,2,527,2,
+	-16384,12,542,1,-16384,24,566,1,-16384,16,583,1,-16384,35,619,1,
+	-16384,6,626,1,-16384,11,638,1,-16384,54,693,1,-16384,26,720,1,
+	-16384,3,724,1,-16384,49,774,1,-16384,40,970,1,-16384,28,844,1,
+	-16384,19,864,1,-16384,24,889,1,-16384,98,988,1,-16384,85,1074,1,
+	-16384,93,1168,1,-16384,16,1305,1,-16384,3,1190,1,-16384,4,1194,1,
+	-16384,18,1213,1,-16384,14,1229,1,-16384,4,1233,1,-16384,18,1252,1,
+	-16384,14,1268,1,-16384,4,1272,1,-16384,18,1291,1,-16384,17,1309,1,
+	-16384,10,1320,1,-16384,24,1633,1,-16384,16,1362,1,-16384,47,1410,1,
+	-16384,17,1428,1,-16384,33,1462,1,-16384,59,1522,1,-16384,140,1663,1,
+	-16384,83,1747,1,-16384,67,1815,1,-16384,14,1910,1,-16384,2,1834,1,
+	-16384,4,1838,1,-16384,18,1857,1,-16384,14,1873,1,-16384,4,1877,1,
+	-16384,18,1896,1,-16384,17,1914,1,-16384,10,1925,1,-16384,56,1982,1,
+	-16384,29,2012,1,-16384,81,2094,1,-16384,132,2227,1,-16384,11,2239,1,
+	-16384,5,2386,1,-16384,2,2249,1,-16384,15,2264,1,-16384,14,2279,1,
+	-16384,70,2350,1,-16384,50,2401,1,-16384,117,2656,1,-16384,2,2523,1,
+	-16384,15,2538,1,-16384,14,2553,1,-16384,54,2608,1,-16384,61,2670,1,
+	-16384,118,2789,1,-16384,38,2831,1,-16384,11,2840,1,-16384,19,2860,1,
+	-16384,8,2869,1,-16384,11,2881,1,-16384,9,2891,1,-16384,5,2897,1,
+	-16384,5,2903,1,-16384,14,2918,1,-16384,7,2926,1,-16384,16,2943,1,
+	-16384,4,2948,1,-16384,35,2985,1,-16384,4,2989,1,-16384,5,2995,1,
+	-16384,24,3020,1,-16384,41,3062,1,-16384,24,3087,2,3096,1,-16384,1,
+	3091,2,-16384,4,3096,1,-16384,5,3103,1,3104,2,-16384,10,3116,2,
+	3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,
+	3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,9,1,1,1,
+	3119,1,-16384,50,54,1,-16384,6,61,1,-16384,11,73,1,-16384,25,
+	99,1,-16384,6,106,1,-16384,11,118,1,-16384,25,144,1,-16384,6,
+	151,1,-16384,11,163,1,-16384,26,190,1,-16384,6,197,1,-16384,11,
+	209,1,-16384,52,262,1,-16384,83,346,1,-16384,33,380,1,-16384,45,
+	426,1,-16384,98,525,2,527,2,-16384,1,532,1,-16384,118,791,1,
+	-16384,53,703,1,-16384,88,804,1,-16384,22,971,1,-16384,3,959,1,
+	-16384,34,854,1,-16384,70,925,1,-16384,34,967,1,-16384,9,1162,1,
+	-16384,117,1088,1,-16384,30,1119,1,-16384,43,1342,1,1341,1,-16384,25,
+	1218,1,-16384,28,1223,1,1220,1,-16384,8,1257,1,-16384,28,1262,1,
+	1259,1,-16384,8,1296,1,-16384,28,1301,1,1298,1,-16384,6,1323,1,
+	-16384,18,1326,1,1325,1,-16384,3,1329,1,-16384,15,1634,1,-16384,2,
+	1350,1,1622,1,-16384,70,1420,1,-16384,1,1422,1,-16384,57,1480,1,
+	1481,1,-16384,36,1585,1,-16384,39,1558,1,-16384,27,1586,1,-16384,36,
+	1630,1,-16384,9,1809,1,-16384,127,1761,1,-16384,25,1787,1,-16384,22,
+	1943,1,1942,1,-16384,22,1862,1,-16384,28,1867,1,1864,1,-16384,8,
+	1901,1,-16384,28,1906,1,1903,1,-16384,6,1928,1,-16384,18,1931,1,
+	1930,1,-16384,3,1934,1,-16384,14,2187,1,-16384,42,1992,1,-16384,1,
+	1994,1,-16384,95,2160,1,-16384,42,2133,1,-16384,27,2161,1,-16384,26,
+	2200,1,-16384,56,2387,1,-16384,2,2250,1,2382,1,-16384,39,2289,1,
+	-16384,5,2295,1,2296,1,-16384,1,2300,1,-16384,2,2302,1,-16384,81,
+	2383,1,-16384,2,2514,1,-16384,73,2460,1,-16384,54,2515,1,-16384,3,
+	2657,1,-16384,2,2524,1,2652,1,-16384,39,2563,1,-16384,5,2569,1,
+	2570,1,-16384,1,2574,1,-16384,2,2576,1,-16384,77,2653,1,-16384,2,
+	2782,1,-16384,58,2715,1,-16384,67,2783,1,-16384,4,2812,1,-16384,29,
+	2818,1,-16384,20,2845,1,-16384,12,2865,1,-16384,34,2887,1,-16384,154,
+	3042,1,-16384,5,3048,1,-16384,38,3087,2,3096,1,-16384,1,3091,2,
+	-16384,4,3096,1,-16384,5,3103,1,3104,2,-16384,10,3116,2,3118,2,
+	3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,
+	-16384,1,3130,1,1,1,-16384,1,3133,2,10,1,1,1,3119,1,
+	-16384,1,3070,2,-16384,1,2905,1,-16384,1,2827,1,-16384,2,2209,1,
+	-16384,2,528,1,-16384,4,444,1,417,1,367,1,-16384,18,42,1,
+	-16384,4,47,1,-16384,2,50,1,-16384,2,53,1,-16384,12,66,1,
+	-16384,2,69,1,-16384,2,72,1,-16384,14,87,1,-16384,4,92,1,
+	-16384,2,95,1,-16384,2,98,1,-16384,12,111,1,-16384,2,114,1,
+	-16384,2,117,1,-16384,14,132,1,-16384,4,137,1,-16384,2,140,1,
+	-16384,2,143,1,-16384,12,156,1,-16384,2,159,1,-16384,2,162,1,
+	-16384,15,178,1,-16384,4,183,1,-16384,2,186,1,-16384,2,189,1,
+	-16384,12,202,1,-16384,2,205,1,-16384,2,208,1,-16384,20,229,1,
+	-16384,8,238,1,-16384,5,244,1,-16384,5,250,1,-16384,5,256,1,
+	-16384,24,281,1,-16384,5,287,1,-16384,8,296,1,-16384,10,307,1,
+	-16384,8,316,1,-16384,15,332,1,-16384,7,340,1,-16384,1,342,1,
+	-16384,9,352,1,-16384,5,358,1,-16384,6,365,1,-16384,2,382,1,
+	374,1,-16384,2,372,1,-16384,3,376,1,-16384,14,391,1,-16384,4,
+	406,1,-16384,1,398,1,-16384,2,401,1,-16384,23,425,1,-16384,2,
+	441,1,-16384,33,462,1,-16384,2,465,1,-16384,17,483,1,-16384,5,
+	489,1,-16384,7,497,1,-16384,22,520,1,-16384,4,525,2,527,2,
+	-16384,6,535,1,-16384,13,549,1,-16384,40,596,1,594,1,592,1,
+	593,1,-16384,12,606,1,-16384,6,613,1,-16384,16,630,1,-16384,17,
+	650,1,-16384,3,761,1,753,1,-16384,1,728,1,-16384,1,688,1,
+	-16384,8,666,1,-16384,17,684,1,-16384,9,694,1,-16384,4,699,1,
+	-16384,2,702,1,-16384,9,712,1,-16384,2,715,1,-16384,1,717,1,
+	-16384,1,719,1,-16384,60,780,1,-16384,22,803,1,-16384,11,972,1,
+	-16384,2,820,1,-16384,3,876,1,870,1,-16384,1,866,1,839,1,
+	-16384,18,845,1,-16384,4,850,1,-16384,2,853,1,-16384,5,859,1,
+	-16384,1,861,1,-16384,1,863,1,-16384,21,885,1,-16384,9,895,1,
+	-16384,70,966,1,-16384,7,1106,1,1081,1,-16384,1,1078,1,-16384,2,
+	1046,1,-16384,54,1035,1,-16384,22,1058,1,-16384,3,1062,1,-16384,54,
+	1117,1,-16384,58,1176,1,-16384,168,1635,1,-16384,2,1351,1,-16384,4,
+	1506,1,1498,1,-16384,1,1484,1,1405,1,-16384,21,1379,1,-16384,4,
+	1384,1,-16384,26,1411,1,-16384,4,1416,1,-16384,2,1419,1,-16384,21,
+	1441,1,-16384,4,1446,1,-16384,10,1457,1,-16384,1,1459,1,-16384,1,
+	1461,1,-16384,55,1518,1,-16384,10,1528,1,-16384,66,1595,1,-16384,33,
+	1629,1,-16384,7,1774,1,1754,1,-16384,1,1751,1,-16384,2,1719,1,
+	-16384,66,1710,1,-16384,20,1731,1,-16384,3,1735,1,-16384,49,1785,1,
+	-16384,37,1823,1,-16384,124,1950,1,-16384,3,2078,1,2070,1,-16384,1,
+	2043,1,-16384,1,1977,1,-16384,25,1983,1,-16384,4,1988,1,-16384,2,
+	1991,1,-16384,15,2007,1,-16384,1,2009,1,-16384,1,2011,1,-16384,77,
+	2090,1,-16384,10,2100,1,-16384,69,2170,1,-16384,28,2199,1,-16384,17,
+	2220,1,2218,1,-16384,22,2241,1,-16384,3,2388,1,-16384,2,2251,1,
+	-16384,1,2359,1,-16384,3,2339,1,2337,1,-16384,1,2324,1,-16384,1,
+	2274,1,-16384,20,2280,1,-16384,4,2285,1,-16384,2,2288,1,-16384,20,
+	2309,1,-16384,18,2328,1,-16384,27,2356,1,-16384,6,2363,1,-16384,23,
+	2470,1,-16384,3,2461,1,2456,1,-16384,1,2443,1,-16384,1,2411,1,
+	-16384,11,2408,1,-16384,6,2415,1,-16384,3,2419,1,-16384,14,2434,1,
+	-16384,12,2447,1,-16384,33,2481,1,-16384,37,2658,1,-16384,2,2525,1,
+	-16384,1,2633,1,2615,1,-16384,2,2597,1,2595,1,-16384,1,2582,1,
+	-16384,1,2548,1,-16384,20,2554,1,-16384,4,2559,1,-16384,2,2562,1,
+	-16384,23,2586,1,-16384,27,2614,1,-16384,6,2621,1,-16384,8,2630,1,
+	-16384,6,2637,1,-16384,19,2738,1,2723,1,-16384,2,2716,1,2711,1,
+	-16384,1,2698,1,2680,1,-16384,11,2677,1,-16384,6,2684,1,-16384,3,
+	2688,1,-16384,13,2702,1,-16384,26,2729,1,-16384,19,2749,1,-16384,37,
+	2813,1,-16384,2,2801,1,-16384,1,2792,1,-16384,3,2796,1,-16384,14,
+	2811,1,-16384,3,2815,1,-16384,8,2824,1,-16384,10,2835,1,-16384,23,
+	2859,1,-16384,6,2866,1,-16384,23,2890,1,-16384,24,2915,1,-16384,18,
+	2934,1,-16384,11,2946,1,-16384,2,2949,1,-16384,1,2951,1,-16384,3,
+	2955,1,-16384,3,2978,1,-16384,9,2969,1,-16384,47,3017,1,-16384,23,
+	3041,1,-16384,25,3067,1,-16384,2,3078,1,-16384,2,3070,1,-16384,4,
+	3078,1,-16384,6,3078,2,3087,2,3096,1,-16384,1,3091,2,-16384,4,
+	3096,1,-16384,5,3103,1,3104,2,3070,2,-16384,7,3070,1,3116,2,
+	3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,
+	3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,11,1,1,1,
+	3119,1,-16384,3,2935,1,-16384,6,602,1,-16384,3,494,1,-16384,374,
+	394,1,-16384,51,445,1,-16384,19,466,1,-16384,29,495,1,-16384,29,
+	525,2,527,2,-16384,12,543,1,-16384,38,580,1,-16384,24,608,1,
+	-16384,75,681,1,682,1,-16384,307,990,1,-16384,3,994,1,-16384,5,
+	1014,1,-16384,2,1003,1,-16384,61,1069,1,1066,1,-16384,301,1368,1,
+	-16384,61,1430,1,-16384,234,1665,1,-16384,3,1669,1,-16384,5,1689,1,
+	-16384,2,1678,1,-16384,59,1742,1,1739,1,-16384,502,2242,1,-16384,2,
+	2389,1,-16384,2,2252,1,-16384,66,2315,1,-16384,120,2440,1,2437,1,
+	-16384,81,2659,1,-16384,2,2526,1,-16384,100,2623,1,-16384,107,2735,1,
+	2732,1,-16384,64,2797,1,-16384,108,2924,1,-16384,4,2916,1,-16384,33,
+	2945,1,-16384,38,2986,1,-16384,18,3003,1,-16384,22,3026,1,-16384,10,
+	3037,1,-16384,21,3059,1,-16384,27,3087,2,3096,1,-16384,1,3091,2,
+	-16384,4,3096,1,-16384,5,3103,1,3104,2,-16384,7,608,1,-16384,2,
+	3116,2,3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,
+	3126,2,3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,12,1,
+	1,1,3119,1,-16384,389,395,1,-16384,36,430,1,-16384,14,446,1,
+	-16384,95,544,1,-16384,47,589,1,-16384,58,651,1,-16384,80,729,1,
+	-16384,64,794,1,-16384,20,973,1,-16384,2,821,1,-16384,48,867,1,
+	-16384,45,913,1,-16384,27,941,1,-16384,258,1200,1,-16384,14,1215,1,
+	-16384,23,1239,1,-16384,14,1254,1,-16384,23,1278,1,-16384,14,1293,1,
+	-16384,19,1313,1,-16384,8,1322,1,-16384,22,1636,1,-16384,2,1352,1,
+	-16384,136,1485,1,-16384,60,1546,1,-16384,27,1574,1,-16384,269,1844,1,
+	-16384,14,1859,1,-16384,23,1883,1,-16384,14,1898,1,-16384,19,1918,1,
+	-16384,8,1927,1,-16384,20,1951,1,-16384,95,2044,1,-16384,76,2121,1,
+	-16384,27,2149,1,-16384,40,2190,1,-16384,25,2216,1,-16384,7,2224,1,
+	-16384,20,2390,1,-16384,2,2253,1,-16384,76,2326,1,-16384,118,2445,1,
+	-16384,32,2477,1,-16384,41,2660,1,-16384,2,2527,1,-16384,60,2584,1,
+	-16384,115,2700,1,-16384,45,2745,1,-16384,133,2879,1,-16384,184,3064,1,
+	-16384,55,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,
+	1,1,-16384,4,13,1,1,1,3119,1,3107,1,-16384,3,2906,1,
+	-16384,2,2785,1,-16384,15,27,1,-16384,16,44,1,-16384,18,63,1,
+	-16384,25,89,1,-16384,18,108,1,-16384,25,134,1,-16384,18,153,1,
+	-16384,26,180,1,-16384,18,199,1,-16384,18,337,1,-16384,174,396,1,
+	-16384,1,411,1,-16384,2,399,1,-16384,5,404,1,-16384,42,459,1,
+	-16384,17,467,1,-16384,45,511,1,-16384,4,516,1,-16384,5,522,1,
+	-16384,18,545,1,-16384,2,556,1,-16384,2,547,1,-16384,3,551,1,
+	-16384,13,565,1,-16384,5,571,1,-16384,7,579,1,-16384,35,615,1,
+	-16384,2,618,1,-16384,3,622,1,-16384,13,636,1,-16384,13,784,1,
+	-16384,3,744,1,-16384,7,662,1,-16384,45,708,1,-16384,26,735,1,
+	-16384,84,952,1,-16384,79,912,1,-16384,3,904,1,-16384,11,916,1,
+	-16384,11,940,1,-16384,3,932,1,-16384,11,944,1,-16384,27,1149,1,
+	-16384,74,1051,1,-16384,76,1124,1,-16384,3,1128,1,-16384,3,1132,1,
+	-16384,34,1167,1,-16384,182,1615,1,-16384,4,1487,1,-16384,111,1467,1,
+	-16384,5,1473,1,-16384,59,1545,1,-16384,3,1537,1,-16384,11,1549,1,
+	-16384,11,1573,1,-16384,3,1565,1,-16384,11,1577,1,-16384,12,1590,1,
+	-16384,2,1593,1,-16384,3,1597,1,-16384,10,1608,1,-16384,26,1796,1,
+	-16384,17,1657,1,1654,1,-16384,65,1724,1,-16384,93,1814,1,-16384,135,
+	2180,1,-16384,3,2059,1,-16384,62,2017,1,-16384,5,2023,1,-16384,26,
+	2050,1,-16384,57,2120,1,-16384,3,2112,1,-16384,11,2124,1,-16384,11,
+	2148,1,-16384,3,2140,1,-16384,11,2152,1,-16384,12,2165,1,-16384,2,
+	2168,1,-16384,3,2172,1,-16384,78,2357,1,-16384,4,2332,1,-16384,35,
+	2298,1,-16384,11,2321,1,-16384,55,2379,1,-16384,10,2371,1,-16384,16,
+	2468,1,-16384,4,2451,1,-16384,18,2412,1,-16384,9,2426,1,2423,1,
+	-16384,47,2511,1,-16384,4,2476,1,-16384,8,2485,1,-16384,3,2489,1,
+	-16384,5,2495,1,-16384,29,2616,1,-16384,4,2590,1,-16384,35,2572,1,
+	-16384,11,2579,1,-16384,55,2649,1,-16384,6,2641,1,-16384,16,2724,1,
+	-16384,4,2706,1,-16384,17,2681,1,-16384,9,2695,1,2692,1,-16384,46,
+	2779,1,-16384,4,2744,1,-16384,8,2753,1,-16384,3,2757,1,-16384,5,
+	2763,1,-16384,40,2804,1,-16384,57,2862,1,-16384,13,2877,1,2885,1,
+	-16384,10,2888,1,-16384,6,2895,1,-16384,14,2910,1,-16384,26,3063,1,
+	-16384,4,2942,1,-16384,12,2956,1,-16384,7,2963,1,-16384,30,2994,1,
+	-16384,18,3013,1,-16384,5,3019,1,-16384,27,3047,1,-16384,7,3055,1,
+	-16384,64,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,
+	1,1,-16384,4,14,1,1,1,3119,1,-16384,3,2936,1,2907,1,
+	-16384,2,2786,1,-16384,1,2210,1,-16384,23,37,1,-16384,11,49,1,
+	-16384,18,68,1,-16384,13,82,1,-16384,11,94,1,-16384,18,113,1,
+	-16384,13,127,1,-16384,11,139,1,-16384,18,158,1,-16384,14,173,1,
+	-16384,11,185,1,-16384,18,204,1,-16384,11,219,1,-16384,18,235,1,
+	-16384,5,241,1,-16384,5,247,1,-16384,5,253,1,-16384,14,273,1,
+	-16384,7,276,1,-16384,7,284,1,-16384,6,291,1,-16384,7,304,1,
+	-16384,11,311,1,-16384,7,324,1,-16384,7,327,1,-16384,13,341,1,
+	-16384,22,364,1,-16384,19,384,1,-16384,3,388,1,-16384,1,390,1,
+	-16384,21,412,1,413,1,-16384,4,427,1,-16384,11,431,1,436,1,
+	-16384,3,435,1,-16384,4,440,1,-16384,16,457,1,-16384,12,470,1,
+	471,1,-16384,4,476,1,477,1,-16384,36,514,1,-16384,19,534,1,
+	-16384,22,557,1,558,1,-16384,28,587,1,-16384,60,652,1,792,1,
+	-16384,9,678,1,675,1,-16384,4,665,1,-16384,17,683,1,-16384,5,
+	689,1,-16384,1,691,1,-16384,4,696,1,-16384,8,705,1,-16384,5,
+	711,1,-16384,6,718,1,-16384,58,777,1,-16384,15,798,1,-16384,21,
+	974,1,-16384,2,822,1,960,1,-16384,8,834,1,831,1,-16384,10,
+	840,1,-16384,1,842,1,-16384,4,847,1,-16384,8,856,1,-16384,5,
+	862,1,-16384,6,869,1,-16384,22,892,1,-16384,4,897,1,-16384,1,
+	900,1,-16384,27,928,1,-16384,33,961,1,-16384,9,1154,1,-16384,58,
+	1041,1,-16384,18,1049,1,-16384,30,1080,1,-16384,89,1170,1,-16384,174,
+	1637,1,-16384,2,1353,1,1623,1,-16384,44,1400,1,1397,1,-16384,10,
+	1406,1,-16384,1,1408,1,-16384,4,1413,1,-16384,8,1423,1,-16384,37,
+	1460,1,-16384,28,1489,1,-16384,35,1525,1,-16384,4,1530,1,-16384,1,
+	1533,1,-16384,27,1561,1,-16384,63,1624,1,-16384,9,1801,1,-16384,70,
+	1714,1,-16384,16,1722,1,-16384,30,1753,1,-16384,63,1817,1,-16384,130,
+	1952,1,2188,1,-16384,9,1972,1,1969,1,-16384,17,1978,1,-16384,1,
+	1980,1,-16384,4,1985,1,-16384,8,1995,1,-16384,6,2001,1,-16384,8,
+	2010,1,-16384,23,2034,1,-16384,26,2061,1,-16384,35,2097,1,-16384,7,
+	2105,1,-16384,1,2108,1,-16384,27,2136,1,-16384,53,2194,1,-16384,24,
+	2214,1,-16384,9,2225,1,2230,1,-16384,3,2229,1,-16384,4,2234,1,
+	-16384,10,2391,1,-16384,2,2254,1,-16384,4,2341,1,-16384,12,2271,1,
+	-16384,8,2275,1,-16384,1,2277,1,-16384,4,2282,1,-16384,28,2311,1,
+	-16384,22,2334,1,-16384,18,2353,1,-16384,13,2367,1,-16384,12,2380,1,
+	-16384,9,2463,1,-16384,62,2453,1,-16384,58,2512,1,-16384,6,2661,1,
+	-16384,2,2528,1,-16384,4,2599,1,-16384,12,2545,1,-16384,8,2549,1,
+	-16384,1,2551,1,-16384,4,2556,1,-16384,35,2592,1,-16384,18,2611,1,
+	-16384,38,2650,1,-16384,9,2718,1,-16384,47,2708,1,-16384,71,2780,1,
+	-16384,51,2832,1,-16384,18,2867,1,-16384,16,2875,1,-16384,4,2873,1,
+	2874,1,-16384,24,2899,1,2900,1,-16384,13,2914,1,-16384,47,2962,1,
+	-16384,5,2968,1,-16384,28,2997,1,-16384,38,3036,1,-16384,9,3046,1,
+	-16384,73,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,
+	1,1,-16384,4,15,1,1,1,3119,1,-16384,10,603,1,-16384,478,
+	493,1,-16384,25,519,1,-16384,9,536,1,-16384,34,564,1,-16384,42,
+	607,1,-16384,40,653,1,-16384,137,786,1,-16384,28,975,1,-16384,2,
+	823,1,-16384,66,886,1,-16384,68,954,1,-16384,92,1052,1,-16384,118,
+	1166,1,-16384,5,1182,1,-16384,18,1210,1,-16384,38,1249,1,-16384,38,
+	1288,1,-16384,36,1317,1,-16384,38,1638,1,-16384,2,1354,1,-16384,168,
+	1519,1,-16384,99,1617,1,-16384,102,1725,1,-16384,92,1813,1,-16384,5,
+	1827,1,-16384,15,1854,1,-16384,38,1893,1,-16384,36,1922,1,-16384,36,
+	1953,1,-16384,50,1999,1,-16384,32,2032,1,-16384,56,2091,1,-16384,92,
+	2182,1,-16384,62,2392,1,-16384,2,2255,1,-16384,9,2303,1,-16384,32,
+	2291,1,-16384,1,2293,1,-16384,12,2306,1,-16384,124,2431,1,-16384,87,
+	2662,1,-16384,2,2529,1,-16384,9,2577,1,-16384,32,2565,1,-16384,1,
+	2567,1,-16384,48,2618,1,-16384,107,2726,1,-16384,89,2816,1,-16384,41,
+	2856,1,-16384,71,2928,1,-16384,12,2941,1,-16384,13,2957,1,-16384,60,
+	3016,1,-16384,23,3040,1,-16384,79,3119,1,3120,1,-16384,1,3120,1,
+	-16384,4,3119,1,-16384,1,1,1,-16384,4,16,1,1,1,3119,1,
+	3108,1,-16384,2,2937,1,-16384,3,2787,1,-16384,2,604,1,-16384,9,
+	356,1,-16384,20,45,1,-16384,18,64,1,-16384,25,90,1,-16384,18,
+	109,1,-16384,25,135,1,-16384,18,154,1,-16384,26,181,1,-16384,18,
+	200,1,-16384,15,220,1,345,1,-16384,19,237,1,-16384,5,243,1,
+	-16384,5,249,1,-16384,5,255,1,-16384,24,280,1,-16384,14,295,1,
+	-16384,19,315,1,-16384,15,331,1,-16384,2,334,1,-16384,12,353,1,
+	-16384,27,381,1,-16384,21,403,1,-16384,54,452,1,-16384,12,468,1,
+	-16384,8,474,1,-16384,4,479,1,-16384,5,485,1,-16384,14,502,1,
+	-16384,7,508,1,-16384,1,510,1,-16384,35,550,1,-16384,21,568,1,
+	-16384,47,616,1,-16384,11,628,1,-16384,19,654,1,-16384,49,698,1,
+	-16384,15,714,1,-16384,10,725,1,-16384,19,745,1,-16384,33,779,1,
+	-16384,35,976,1,-16384,2,824,1,-16384,30,849,1,-16384,8,858,1,
+	-16384,27,924,1,-16384,7,894,1,-16384,75,1163,1,-16384,16,987,1,
+	-16384,64,1056,1,-16384,22,1075,1,-16384,42,1118,1,-16384,37,1158,1,
+	-16384,33,1219,1,-16384,38,1258,1,-16384,38,1297,1,-16384,36,1324,1,
+	-16384,39,1639,1,-16384,2,1355,1,-16384,12,1361,1,-16384,53,1415,1,
+	-16384,11,1427,1,-16384,28,1456,1,-16384,31,1490,1,-16384,30,1557,1,
+	-16384,7,1527,1,-16384,105,1810,1,-16384,28,1662,1,-16384,62,1729,1,
+	-16384,22,1748,1,-16384,37,1786,1,-16384,16,1805,1,-16384,30,1863,1,
+	-16384,38,1902,1,-16384,36,1929,1,-16384,37,1954,1,-16384,38,1987,1,
+	-16384,18,2006,1,-16384,53,2062,1,-16384,30,2132,1,-16384,7,2099,1,
+	-16384,138,2238,1,-16384,6,2393,1,-16384,2,2256,1,-16384,14,2263,1,
+	-16384,20,2284,1,-16384,6,2292,1,-16384,7,2299,1,-16384,22,2322,1,
+	-16384,10,2335,1,-16384,21,2355,1,-16384,5,2361,1,-16384,38,2400,1,
+	-16384,12,2413,1,-16384,38,2454,1,-16384,19,2472,1,-16384,5,2478,1,
+	-16384,40,2663,1,-16384,2,2530,1,-16384,14,2537,1,-16384,20,2558,1,
+	-16384,6,2566,1,-16384,7,2573,1,-16384,6,2580,1,-16384,10,2593,1,
+	-16384,21,2613,1,-16384,21,2635,1,-16384,33,2669,1,-16384,12,2682,1,
+	-16384,24,2709,1,-16384,32,2740,1,-16384,5,2746,1,-16384,47,2794,1,
+	-16384,11,2806,1,-16384,36,2843,1,-16384,20,2864,1,-16384,13,2878,1,
+	-16384,4,2883,1,-16384,2,2886,1,-16384,19,2925,1,2920,1,-16384,39,
+	2947,1,-16384,9,3043,1,-16384,3,2961,1,-16384,2,2964,1,-16384,17,
+	2982,1,-16384,5,2988,1,-16384,2,2991,1,-16384,1,2993,1,-16384,5,
+	2999,1,-16384,1,3001,1,-16384,20,3022,1,-16384,1,3024,1,-16384,32,
+	3057,1,-16384,3,3061,1,-16384,3,3065,1,-16384,42,3112,1,-16384,1,
+	3110,1,-16384,9,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,
+	-16384,1,1,1,-16384,4,17,1,1,1,3119,1,-16384,5,2851,1,
+	-16384,5,582,1,529,1,500,1,-16384,20,59,1,-16384,1,40,1,
+	-16384,42,104,1,-16384,1,85,1,-16384,42,149,1,-16384,1,130,1,
+	-16384,43,195,1,-16384,1,176,1,-16384,39,221,1,-16384,2,333,1,
+	260,1,258,1,-16384,2,224,1,-16384,2,227,1,-16384,61,289,1,
+	-16384,19,309,1,-16384,44,354,1,-16384,21,377,1,-16384,8,385,1,
+	-16384,8,414,1,-16384,13,408,1,-16384,23,432,1,-16384,4,437,1,
+	-16384,16,454,1,-16384,32,487,1,-16384,21,509,1,-16384,27,537,1,
+	-16384,5,559,1,-16384,10,554,1,-16384,8,563,1,-16384,5,577,1,
+	-16384,13,584,1,-16384,27,611,1,-16384,15,627,1,-16384,13,641,1,
+	-16384,14,722,1,-16384,75,732,1,-16384,82,977,1,-16384,85,901,1,
+	-16384,27,929,1,-16384,41,1155,1,-16384,3,1082,1,-16384,3,1072,1,
+	1047,1,-16384,2,983,1,-16384,47,1033,1,-16384,133,1165,1,-16384,5,
+	1327,1,-16384,2,1174,1,-16384,10,1306,1,-16384,3,1191,1,-16384,4,
+	1195,1,-16384,33,1230,1,-16384,4,1234,1,-16384,33,1269,1,-16384,4,
+	1273,1,-16384,36,1310,1,-16384,35,1640,1,-16384,5,1605,1,-16384,29,
+	1381,1,-16384,4,1386,1,-16384,36,1464,1,-16384,19,1443,1,-16384,4,
+	1448,1,-16384,85,1534,1,-16384,27,1562,1,-16384,71,1802,1,-16384,3,
+	1755,1,-16384,3,1745,1,1720,1,-16384,3,1647,1,-16384,58,1708,1,
+	-16384,105,1812,1,-16384,5,1932,1,-16384,2,1821,1,-16384,8,1911,1,
+	-16384,2,1835,1,-16384,4,1839,1,-16384,33,1874,1,-16384,4,1878,1,
+	-16384,36,1915,1,-16384,80,2014,1,-16384,51,2047,1,-16384,61,2109,1,
+	-16384,27,2137,1,-16384,73,2211,1,-16384,14,2226,1,-16384,4,2231,1,
+	-16384,18,2360,1,-16384,54,2305,1,-16384,1,2307,1,-16384,4,2312,1,
+	-16384,29,2342,1,2343,1,-16384,24,2368,1,-16384,18,2471,1,-16384,4,
+	2457,1,-16384,11,2406,1,-16384,25,2430,1,-16384,1,2432,1,-16384,31,
+	2464,1,2465,1,-16384,58,2634,1,-16384,75,2600,1,2601,1,-16384,17,
+	2619,1,-16384,12,2632,1,-16384,24,2739,1,-16384,4,2712,1,-16384,10,
+	2675,1,-16384,45,2719,1,2720,1,-16384,6,2727,1,-16384,63,2798,1,
+	-16384,13,2805,1,-16384,14,2820,1,-16384,8,2829,1,-16384,11,2841,1,
+	-16384,5,2847,1,-16384,7,2855,1,-16384,7,2863,1,-16384,18,2882,1,
+	-16384,25,2917,1,-16384,16,2932,1,-16384,14,2940,1,-16384,34,2975,1,
+	-16384,16,2992,1,-16384,45,3038,1,-16384,17,3056,1,-16384,63,3119,1,
+	3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,
+	18,1,1,1,3119,1,-16384,271,275,1,-16384,10,290,1,-16384,19,
+	310,1,-16384,19,326,1,-16384,44,371,1,-16384,43,415,1,-16384,85,
+	501,1,-16384,58,560,1,-16384,24,585,1,-16384,18,640,1,-16384,43,
+	655,1,-16384,9,659,1,-16384,30,690,1,-16384,33,723,1,-16384,91,
+	978,1,-16384,11,828,1,-16384,12,841,1,-16384,219,1060,1,-16384,12,
+	1073,1,-16384,137,1211,1,-16384,38,1250,1,-16384,38,1289,1,-16384,28,
+	1318,1,-16384,26,1641,1,-16384,12,1394,1,-16384,47,1407,1,-16384,181,
+	1588,1,-16384,62,1651,1,-16384,81,1733,1,-16384,12,1746,1,-16384,108,
+	1855,1,-16384,38,1894,1,-16384,28,1923,1,-16384,34,1959,1,-16384,19,
+	1979,1,-16384,184,2163,1,-16384,81,2394,1,-16384,2,2257,1,-16384,11,
+	2265,1,-16384,14,2276,1,-16384,141,2417,1,-16384,54,2473,1,-16384,49,
+	2531,1,-16384,11,2539,1,-16384,14,2550,1,-16384,136,2686,1,-16384,53,
+	2741,1,-16384,48,2790,1,-16384,12,2802,1,-16384,7,2810,1,-16384,10,
+	2821,1,-16384,8,2830,1,-16384,17,2848,1,-16384,45,2894,1,-16384,78,
+	2973,1,-16384,114,3089,1,3097,1,-16384,2,3089,1,-16384,4,3097,1,
+	-16384,6,3097,2,-16384,11,3089,1,-16384,1,3089,1,3119,1,3120,1,
+	-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,19,1,
+	1,1,3119,1,-16384,647,769,1,-16384,169,882,1,-16384,151,1114,1,
+	-16384,378,1514,1,-16384,283,1782,1,-16384,311,1955,1,-16384,2,2086,1,
+	-16384,42,1996,1,-16384,257,2345,1,-16384,7,2266,1,-16384,128,2467,1,
+	-16384,7,2402,1,-16384,128,2603,1,-16384,7,2540,1,-16384,124,2722,1,
+	-16384,6,2671,1,-16384,453,3119,1,3120,1,-16384,1,3120,1,-16384,4,
+	3119,1,-16384,1,1,1,-16384,4,20,1,1,1,3119,1,-16384,4,
+	2908,1,-16384,1,2828,1,-16384,12,369,1,-16384,17,41,1,-16384,6,
+	48,1,-16384,18,67,1,-16384,18,86,1,-16384,6,93,1,-16384,18,
+	112,1,-16384,18,131,1,-16384,6,138,1,-16384,18,157,1,-16384,19,
+	177,1,-16384,6,184,1,-16384,18,203,1,-16384,18,257,1,-16384,2,
+	225,1,-16384,2,228,1,-16384,59,288,1,-16384,19,308,1,-16384,41,
+	350,1,-16384,6,357,1,-16384,11,375,1,-16384,26,407,1,-16384,24,
+	421,1,-16384,2,424,1,-16384,25,453,1,451,1,-16384,11,463,1,
+	-16384,20,484,1,-16384,6,491,1,-16384,14,515,1,-16384,31,538,1,
+	-16384,6,553,1,-16384,64,614,1,-16384,31,642,1,-16384,5,656,1,
+	-16384,10,679,1,-16384,68,730,1,-16384,2,731,1,-16384,40,772,1,
+	-16384,22,795,1,-16384,5,801,1,-16384,13,979,1,-16384,2,825,1,
+	-16384,9,835,1,-16384,56,887,1,-16384,78,964,1,-16384,13,1077,1,
+	-16384,3,985,1,-16384,1,984,1,-16384,45,1042,1,-16384,3,1034,1,
+	-16384,14,1050,1,-16384,9,1059,1,-16384,1,1061,1,-16384,108,1171,1,
+	-16384,4,1175,1,-16384,16,1207,1,-16384,3,1196,1,-16384,34,1246,1,
+	-16384,3,1235,1,-16384,34,1285,1,-16384,3,1274,1,-16384,32,1316,1,
+	-16384,3,1311,1,-16384,33,1642,1,-16384,2,1356,1,-16384,10,1359,1,
+	-16384,20,1380,1,-16384,4,1385,1,-16384,8,1401,1,-16384,30,1425,1,
+	-16384,16,1442,1,-16384,4,1447,1,-16384,69,1520,1,-16384,73,1591,1,
+	-16384,35,1627,1,-16384,13,1750,1,-16384,3,1660,1,1649,1,-16384,1,
+	1648,1,-16384,56,1715,1,-16384,3,1709,1,-16384,12,1723,1,-16384,9,
+	1732,1,-16384,1,1734,1,-16384,82,1818,1,-16384,4,1822,1,-16384,13,
+	1851,1,-16384,3,1840,1,-16384,34,1890,1,-16384,3,1879,1,-16384,32,
+	1921,1,-16384,3,1916,1,-16384,31,1956,1,-16384,10,1973,1,-16384,42,
+	2002,1,-16384,32,2035,1,-16384,7,2045,1,-16384,2,2046,1,-16384,42,
+	2092,1,-16384,76,2166,1,-16384,24,2191,1,-16384,5,2197,1,-16384,42,
+	2240,1,-16384,4,2395,1,-16384,2,2258,1,-16384,9,2304,1,-16384,2,
+	2261,1,-16384,5,2269,1,-16384,58,2327,1,-16384,17,2344,1,-16384,3,
+	2348,1,-16384,15,2364,1,-16384,30,2429,1,-16384,2,2398,1,-16384,4,
+	2409,1,-16384,3,2407,1,-16384,8,2416,1,-16384,1,2418,1,-16384,26,
+	2446,1,-16384,20,2466,1,-16384,15,2482,1,-16384,36,2664,1,-16384,2,
+	2532,1,-16384,12,2535,1,-16384,5,2543,1,-16384,42,2585,1,-16384,17,
+	2602,1,-16384,3,2606,1,-16384,24,2631,1,-16384,6,2638,1,-16384,28,
+	2667,1,-16384,4,2678,1,-16384,3,2676,1,-16384,8,2685,1,-16384,1,
+	2687,1,-16384,12,2701,1,-16384,20,2721,1,-16384,28,2750,1,-16384,42,
+	2793,1,-16384,1,2795,1,-16384,3,2799,1,-16384,19,2819,1,-16384,5,
+	2825,1,-16384,8,2834,1,-16384,11,2846,1,-16384,42,2889,1,-16384,32,
+	2922,1,-16384,7,2930,1,-16384,2,2933,1,-16384,18,2952,1,-16384,2,
+	2958,1,-16384,4,2971,1,-16384,10,2974,1,-16384,9,2981,1,-16384,3,
+	3012,1,-16384,53,3039,1,-16384,28,3068,1,-16384,51,3119,1,3120,1,
+	-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,21,1,
+	1,1,3119,1,-16384,3,2938,1,-16384,29,38,1,-16384,44,83,1,
+	-16384,44,128,1,-16384,45,174,1,-16384,42,222,1,-16384,51,274,1,
+	-16384,2,271,1,-16384,12,285,1,-16384,14,305,1,-16384,2,302,1,
+	-16384,16,325,1,-16384,2,322,1,-16384,12,335,1,-16384,3,339,1,
+	-16384,53,397,1,-16384,51,447,1,-16384,14,460,1,-16384,7,472,1,
+	-16384,27,496,1,-16384,44,546,1,-16384,47,590,1,-16384,27,617,1,
+	-16384,16,634,1,-16384,13,657,1,-16384,20,669,1,-16384,3,673,1,
+	-16384,12,686,1,-16384,18,706,1,-16384,10,716,1,-16384,24,741,1,
+	-16384,5,747,1,-16384,3,751,1,-16384,4,756,1,-16384,2,759,1,
+	-16384,4,764,1,-16384,2,767,1,-16384,14,782,1,-16384,5,788,1,
+	-16384,2,812,1,-16384,14,806,1,-16384,3,810,1,-16384,4,980,1,
+	-16384,2,826,1,-16384,18,837,1,-16384,22,860,1,-16384,12,873,1,
+	-16384,1,875,1,-16384,3,879,1,-16384,1,881,1,-16384,28,910,1,
+	-16384,11,922,1,-16384,15,938,1,-16384,11,950,1,-16384,5,956,1,
+	-16384,2,968,1,-16384,30,991,1,-16384,17,1008,1,-16384,3,1012,1,
+	-16384,10,1023,1,-16384,3,1027,1,-16384,16,1044,1,-16384,9,1054,1,
+	-16384,30,1085,1,-16384,7,1093,1,-16384,3,1097,1,-16384,3,1101,1,
+	-16384,2,1104,1,-16384,4,1109,1,-16384,2,1112,1,-16384,11,1125,1,
+	-16384,13,1138,1,-16384,2,1141,1,-16384,2,1144,1,-16384,2,1147,1,
+	-16384,4,1152,1,-16384,6,1159,1,-16384,10,1172,1,-16384,14,1307,1,
+	-16384,3,1192,1,-16384,38,1231,1,-16384,38,1270,1,-16384,77,1643,1,
+	-16384,2,1357,1,-16384,15,1364,1,-16384,10,1375,1,-16384,15,1391,1,
+	-16384,11,1403,1,-16384,33,1437,1,-16384,15,1453,1,-16384,4,1458,1,
+	-16384,24,1483,1,-16384,8,1492,1,-16384,3,1496,1,-16384,4,1501,1,
+	-16384,2,1504,1,-16384,4,1509,1,-16384,2,1512,1,-16384,30,1543,1,
+	-16384,11,1555,1,-16384,15,1571,1,-16384,11,1583,1,-16384,10,1594,1,
+	-16384,8,1603,1,-16384,10,1614,1,-16384,4,1619,1,-16384,2,1631,1,
+	-16384,42,1666,1,-16384,17,1683,1,-16384,3,1687,1,-16384,10,1698,1,
+	-16384,3,1702,1,-16384,14,1717,1,-16384,9,1727,1,-16384,30,1758,1,
+	-16384,6,1765,1,-16384,3,1769,1,-16384,2,1772,1,-16384,4,1777,1,
+	-16384,2,1780,1,-16384,10,1791,1,-16384,2,1794,1,-16384,4,1799,1,
+	-16384,6,1806,1,-16384,10,1819,1,-16384,12,1912,1,-16384,2,1836,1,
+	-16384,38,1875,1,-16384,75,1957,1,-16384,14,1963,1,-16384,3,1967,1,
+	-16384,7,1975,1,-16384,28,2004,1,-16384,3,2008,1,-16384,20,2029,1,
+	-16384,7,2037,1,-16384,3,2041,1,-16384,14,2056,1,-16384,7,2064,1,
+	-16384,3,2068,1,-16384,4,2073,1,-16384,2,2076,1,-16384,4,2081,1,
+	-16384,2,2084,1,-16384,17,2102,1,-16384,15,2118,1,-16384,11,2130,1,
+	-16384,15,2146,1,-16384,11,2158,1,-16384,10,2169,1,-16384,8,2178,1,
+	-16384,5,2184,1,-16384,2,2208,1,-16384,14,2202,1,-16384,3,2206,1,
+	-16384,9,2217,1,-16384,28,2396,1,-16384,2,2259,1,-16384,80,2329,1,
+	-16384,47,2377,1,-16384,4,2384,1,-16384,65,2448,1,-16384,24,2479,1,
+	-16384,1,2475,1,-16384,9,2486,1,-16384,18,2504,1,-16384,3,2508,1,
+	-16384,5,2516,1,-16384,4,2665,1,-16384,2,2533,1,-16384,64,2587,1,
+	-16384,59,2647,1,-16384,4,2654,1,-16384,50,2703,1,-16384,37,2747,1,
+	-16384,1,2743,1,-16384,9,2754,1,-16384,18,2772,1,-16384,3,2776,1,
+	-16384,5,2784,1,-16384,4,2814,1,-16384,65,2853,1,-16384,4,2858,1,
+	-16384,80,2950,1,-16384,37,2977,1,-16384,75,3053,1,-16384,66,3119,1,
+	3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,
+	22,1,1,1,3119,1,-16384,3,2939,1,-16384,6,605,1,-16384,7,
+	419,1,-16384,5,28,1,-16384,10,39,1,-16384,6,46,1,-16384,18,
+	65,1,-16384,18,84,1,-16384,6,91,1,-16384,18,110,1,-16384,18,
+	129,1,-16384,6,136,1,-16384,18,155,1,-16384,19,175,1,-16384,6,
+	182,1,-16384,18,201,1,-16384,21,226,1,-16384,35,259,1,-16384,18,
+	278,1,-16384,14,293,1,-16384,19,313,1,-16384,15,329,1,-16384,6,
+	336,1,-16384,1,338,1,-16384,5,344,1,-16384,4,349,1,-16384,5,
+	355,1,-16384,43,402,1,-16384,5,405,1,-16384,1,410,1,-16384,10,
+	428,1,-16384,3,422,1,-16384,20,443,1,-16384,1,448,1,-16384,12,
+	458,1,-16384,2,461,1,-16384,20,482,1,-16384,5,488,1,-16384,9,
+	498,1,-16384,18,517,1,-16384,3,521,1,-16384,9,531,1,-16384,10,
+	562,1,-16384,9,552,1,-16384,19,572,1,-16384,5,578,1,-16384,10,
+	591,1,-16384,5,595,1,-16384,1,597,1,-16384,7,609,1,-16384,17,
+	623,1,-16384,5,629,1,-16384,2,632,1,-16384,4,637,1,-16384,5,
+	643,1,-16384,8,762,1,754,1,-16384,17,671,1,-16384,5,677,1,
+	-16384,43,721,1,-16384,4,726,1,-16384,44,771,1,-16384,3,775,1,
+	-16384,9,785,1,-16384,14,800,1,-16384,7,808,1,-16384,6,981,1,
+	-16384,6,877,1,871,1,-16384,9,833,1,-16384,31,865,1,-16384,18,
+	884,1,-16384,5,890,1,-16384,62,953,1,-16384,9,963,1,-16384,6,
+	1164,1,1156,1,-16384,2,1107,1,1083,1,-16384,5,1030,1,-16384,19,
+	1001,1,-16384,46,1048,1,-16384,8,1057,1,-16384,5,1063,1,-16384,12,
+	1076,1,-16384,39,1116,1,-16384,43,1160,1,-16384,12,1173,1,-16384,171,
+	1644,1,-16384,2,1358,1,-16384,4,1507,1,1499,1,-16384,11,1366,1,
+	-16384,32,1399,1,-16384,22,1424,1,-16384,40,1463,1,-16384,1,1465,1,
+	-16384,50,1516,1,-16384,6,1523,1,-16384,82,1606,1,-16384,9,1616,1,
+	-16384,9,1626,1,-16384,6,1811,1,1803,1,-16384,2,1775,1,1756,1,
+	-16384,5,1705,1,-16384,31,1676,1,-16384,44,1721,1,-16384,8,1730,1,
+	-16384,5,1736,1,-16384,12,1749,1,-16384,34,1784,1,-16384,22,1807,1,
+	-16384,12,1820,1,-16384,131,2079,1,2071,1,-16384,11,1965,1,-16384,5,
+	1971,1,-16384,41,2013,1,-16384,1,2015,1,-16384,23,2039,1,-16384,48,
+	2088,1,-16384,6,2095,1,-16384,85,2181,1,-16384,14,2196,1,-16384,7,
+	2204,1,-16384,5,2222,1,-16384,8,2219,1,-16384,1,2221,1,-16384,23,
+	2397,1,-16384,2,2260,1,-16384,5,2340,1,2338,1,-16384,14,2270,1,
+	-16384,2,2273,1,-16384,34,2308,1,-16384,21,2330,1,-16384,16,2347,1,
+	-16384,3,2351,1,-16384,13,2365,1,-16384,25,2462,1,2458,1,-16384,4,
+	2403,1,-16384,12,2410,1,-16384,3,2414,1,-16384,5,2420,1,-16384,12,
+	2433,1,-16384,15,2449,1,-16384,30,2510,1,-16384,2,2483,1,-16384,35,
+	2666,1,-16384,2,2534,1,-16384,5,2598,1,2596,1,-16384,14,2544,1,
+	-16384,2,2547,1,-16384,40,2588,1,-16384,16,2605,1,-16384,3,2609,1,
+	-16384,10,2620,1,-16384,18,2639,1,-16384,21,2717,1,2713,1,-16384,3,
+	2672,1,-16384,12,2679,1,-16384,3,2683,1,-16384,5,2689,1,-16384,14,
+	2704,1,-16384,23,2728,1,-16384,19,2778,1,-16384,2,2751,1,-16384,34,
+	2822,1,-16384,2,2791,1,-16384,10,2800,1,-16384,2,2803,1,-16384,4,
+	2808,1,-16384,18,2836,1,-16384,16,2844,1,-16384,6,2868,1,-16384,2,
+	2854,1,-16384,6,2861,1,-16384,30,2892,1,-16384,17,2911,1,-16384,25,
+	3066,1,-16384,16,2953,1,-16384,1,2959,1,-16384,23,2979,1,-16384,34,
+	3014,1,-16384,3,3018,1,-16384,35,3054,1,-16384,65,3119,1,3120,1,
+	-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,23,1,
+	1,1,3119,1,-16384,5,2852,1,-16384,2,2237,1,-16384,3,530,1,
+	-16384,3,486,1,-16384,250,272,1,-16384,30,303,1,-16384,19,323,1,
+	-16384,28,351,1,-16384,96,456,1,450,1,-16384,17,478,1,-16384,1,
+	469,1,-16384,5,475,1,-16384,57,533,1,-16384,124,660,1,680,1,
+	-16384,13,674,1,-16384,12,687,1,-16384,54,742,1,-16384,5,748,1,
+	-16384,3,752,1,-16384,4,757,1,-16384,2,760,1,-16384,4,765,1,
+	-16384,2,768,1,-16384,14,783,1,-16384,14,797,1,-16384,4,802,1,
+	-16384,7,811,1,-16384,13,868,1,-16384,2,829,1,-16384,9,838,1,
+	-16384,49,896,1,-16384,22,911,1,-16384,11,923,1,-16384,15,939,1,
+	-16384,11,951,1,-16384,14,965,1,-16384,10,1079,1,-16384,4,1031,1,
+	-16384,4,986,1,-16384,3,992,1,-16384,17,1009,1,-16384,3,1013,1,
+	-16384,10,1024,1,-16384,3,1028,1,-16384,16,1045,1,-16384,9,1055,1,
+	-16384,30,1086,1,-16384,7,1094,1,-16384,3,1098,1,-16384,3,1102,1,
+	-16384,2,1105,1,-16384,4,1110,1,-16384,2,1113,1,-16384,11,1126,1,
+	-16384,13,1139,1,-16384,13,1153,1,-16384,40,1203,1,-16384,4,1198,1,
+	-16384,3,1202,1,-16384,3,1206,1,-16384,2,1209,1,-16384,7,1217,1,
+	-16384,4,1222,1,-16384,2,1225,1,-16384,6,1242,1,-16384,4,1237,1,
+	-16384,3,1241,1,-16384,3,1245,1,-16384,2,1248,1,-16384,7,1256,1,
+	-16384,4,1261,1,-16384,2,1264,1,-16384,6,1281,1,-16384,4,1276,1,
+	-16384,3,1280,1,-16384,3,1284,1,-16384,2,1287,1,-16384,7,1295,1,
+	-16384,4,1300,1,-16384,2,1303,1,-16384,4,1314,1,-16384,25,1334,1,
+	-16384,2,1337,1,-16384,2,1340,1,-16384,14,1488,1,-16384,2,1395,1,
+	-16384,1,1360,1,-16384,14,1376,1,-16384,15,1392,1,-16384,11,1404,1,
+	-16384,22,1426,1,-16384,10,1438,1,-16384,15,1454,1,-16384,38,1493,1,
+	-16384,3,1497,1,-16384,4,1502,1,-16384,2,1505,1,-16384,4,1510,1,
+	-16384,2,1513,1,-16384,7,1529,1,-16384,22,1544,1,-16384,11,1556,1,
+	-16384,15,1572,1,-16384,11,1584,1,-16384,19,1604,1,-16384,24,1628,1,
+	-16384,10,1752,1,-16384,4,1706,1,-16384,16,1661,1,-16384,3,1667,1,
+	-16384,17,1684,1,-16384,3,1688,1,-16384,10,1699,1,-16384,3,1703,1,
+	-16384,14,1718,1,-16384,9,1728,1,-16384,30,1759,1,-16384,6,1766,1,
+	-16384,3,1770,1,-16384,2,1773,1,-16384,4,1778,1,-16384,2,1781,1,
+	-16384,18,1800,1,-16384,37,1847,1,-16384,4,1842,1,-16384,3,1846,1,
+	-16384,3,1850,1,-16384,2,1853,1,-16384,7,1861,1,-16384,4,1866,1,
+	-16384,2,1869,1,-16384,6,1886,1,-16384,4,1881,1,-16384,3,1885,1,
+	-16384,3,1889,1,-16384,2,1892,1,-16384,7,1900,1,-16384,4,1905,1,
+	-16384,2,1908,1,-16384,4,1919,1,-16384,24,1938,1,-16384,2,1941,1,
+	-16384,12,2060,1,-16384,3,1960,1,-16384,8,1968,1,-16384,7,1976,1,
+	-16384,24,2000,1,-16384,32,2033,1,-16384,22,2057,1,-16384,7,2065,1,
+	-16384,3,2069,1,-16384,4,2074,1,-16384,2,2077,1,-16384,4,2082,1,
+	-16384,2,2085,1,-16384,7,2104,1,-16384,9,2103,1,-16384,15,2119,1,
+	-16384,11,2131,1,-16384,15,2147,1,-16384,11,2159,1,-16384,19,2179,1,
+	-16384,14,2193,1,-16384,4,2198,1,-16384,7,2207,1,-16384,49,2333,1,
+	-16384,3,2267,1,-16384,1,2262,1,-16384,114,2378,1,-16384,15,2452,1,
+	-16384,3,2404,1,-16384,1,2399,1,-16384,85,2487,1,-16384,18,2505,1,
+	-16384,3,2509,1,-16384,21,2591,1,-16384,3,2541,1,-16384,1,2536,1,
+	-16384,110,2648,1,-16384,15,2707,1,-16384,2,2673,1,-16384,1,2668,1,
+	-16384,84,2755,1,-16384,18,2773,1,-16384,3,2777,1,-16384,65,2842,1,
+	-16384,112,2960,1,-16384,24,2980,1,-16384,6,2987,1,-16384,64,3052,1,
+	-16384,7,3060,1,-16384,59,3119,1,3120,1,-16384,1,3124,1,-16384,4,
+	3119,1,-16384,1,3131,1,-16384,4,24,1,1,1,3119,1,-16384,48,
+	52,1,-16384,18,71,1,-16384,25,97,1,-16384,18,116,1,-16384,25,
+	142,1,-16384,18,161,1,-16384,26,188,1,-16384,18,207,1,-16384,397,
+	610,1,-16384,43,793,1,-16384,500,1150,1,-16384,646,1797,1,-16384,151,
+	2189,1,-16384,408,2358,1,-16384,3,2362,1,-16384,106,2469,1,-16384,3,
+	2480,1,-16384,143,2617,1,-16384,18,2636,1,-16384,88,2725,1,-16384,15,
+	2748,1,-16384,142,2884,1,-16384,159,3044,1,-16384,75,3119,1,3120,1,
+	-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,25,1,
+	1,1,3119,1,-16384,374,378,1,-16384,30,409,1,-16384,45,455,1,
+	-16384,99,555,1,-16384,12,569,1,-16384,52,621,1,-16384,13,635,1,
+	-16384,22,661,1,-16384,48,707,1,-16384,25,733,1,-16384,168,902,1,
+	-16384,27,930,1,-16384,252,1183,1,-16384,161,1645,1,-16384,189,1535,1,
+	-16384,27,1563,1,-16384,28,1592,1,-16384,235,1828,1,-16384,219,2048,1,
+	-16384,61,2110,1,-16384,27,2138,1,-16384,28,2167,1,-16384,145,2313,1,
+	-16384,55,2369,1,-16384,606,2976,1,-16384,143,3119,1,3120,1,-16384,1,
+	3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,-16402,1,1,1,
+	3119,1,-16384,1,-6,2,-16384,2,-86,1,-16384,19,-49,1,-16384,27,
+	-176,1,-177,1,-178,1,-16384,16,-164,1,-165,1,-166,1,-16384,23,
+	-185,1,-186,1,-187,1,-16384,16,-173,1,-174,1,-175,1,-16384,23,
+	-182,1,-183,1,-184,1,-16384,16,-170,1,-171,1,-172,1,-16384,24,
+	-179,1,-180,1,-181,1,-16384,16,-167,1,-168,1,-169,1,-76,1,
+	-16384,10,-467,1,-16384,3,-153,1,-16384,8,-158,1,-16384,5,-161,1,
+	-16384,5,-160,1,-16384,5,-159,1,-466,1,-16384,1,-463,1,-16384,2,
+	-142,1,-16384,8,-143,1,-144,1,-16384,5,-149,1,-16384,2,-154,1,
+	-16384,7,-163,1,-16384,3,-152,1,-16384,2,-157,1,-16384,5,-147,1,
+	-148,1,-16384,5,-162,1,-16384,3,-151,1,-16384,2,-156,1,-16384,5,
+	-145,1,-146,1,-16384,5,-150,1,-16384,2,-155,1,-16384,3,-398,1,
+	-16384,7,-468,1,-16384,1,-464,1,-16384,5,-469,1,-16384,2,-465,1,
+	-16384,9,-89,1,-16384,6,-21,1,-638,1,-16384,4,-106,1,-16384,1,
+	-48,1,-56,1,-16384,6,-4,1,-16384,2,-22,1,-16384,9,-141,1,
+	-103,1,-16384,2,-139,1,-16384,3,-104,1,-102,1,-16384,2,-105,1,
+	-16384,2,-140,1,-16384,5,-28,1,-16384,3,-73,1,-16384,8,-4,1,
+	-16384,4,-4,1,-16384,2,-110,1,-16384,8,-93,1,-16384,2,-107,1,
+	-16384,2,-30,1,-16384,4,-57,1,-16384,7,-108,1,-16384,5,-109,1,
+	-16384,2,-387,1,-16384,4,-88,1,-16384,3,-74,1,-16384,3,-29,1,
+	-16384,4,-54,1,-16384,2,-254,1,-9,1,-16384,11,-11,1,-16384,8,
+	-12,1,-16384,1,-9,1,-16384,1,-9,1,-16384,3,-58,1,-16384,3,
+	-19,1,-16384,3,-25,1,-16384,9,-134,1,-16384,2,-136,1,-16384,2,
+	-135,1,-16384,2,-138,1,-16384,2,-137,1,-16384,13,-190,1,-189,1,
+	-16384,4,-188,1,-16384,3,-634,1,-16384,1,-31,1,-16384,5,-99,1,
+	-16384,1,-98,1,-16384,1,-97,1,-16384,4,-635,1,-16384,4,-55,1,
+	-10,1,-16384,4,-51,1,-16384,5,-84,1,-16384,19,-85,1,-16384,3,
+	-24,1,-16384,2,-63,1,-16384,19,-400,1,-489,1,-16384,5,-490,1,
+	-491,1,-16384,2,-401,1,-483,1,-16384,5,-399,1,-16384,1,-484,1,
+	-485,1,-16384,11,-409,1,-16384,12,-612,1,-16384,8,-621,1,-16384,4,
+	-474,1,-16384,1,-422,1,-473,1,-16384,11,-477,1,-478,1,-16384,4,
+	-494,1,-495,1,-16384,2,-496,1,-497,1,-16384,3,-423,1,-424,1,
+	-16384,1,-427,1,-428,1,-16384,3,-425,1,-426,1,-16384,1,-429,1,
+	-430,1,-421,1,-16384,12,-407,1,-408,1,-16384,5,-476,1,-16384,7,
+	-499,1,-16384,5,-475,1,-486,1,-16384,5,-487,1,-488,1,-472,1,
+	-60,1,-16384,2,-66,1,-16384,13,-570,1,-16384,2,-404,1,-566,1,
+	-16384,2,-567,1,-568,1,-16384,11,-416,1,-16384,14,-624,1,-573,1,
+	-559,1,-16384,1,-571,1,-16384,3,-574,1,-16384,1,-576,1,-16384,3,
+	-575,1,-16384,1,-577,1,-572,1,-16384,12,-415,1,-16384,14,-578,1,
+	-580,1,-16384,10,-579,1,-581,1,-16384,14,-562,1,-564,1,-16384,10,
+	-563,1,-565,1,-16384,5,-561,1,-16384,8,-560,1,-569,1,-558,1,
+	-16384,15,-323,1,-16384,12,-4,2,-16384,9,-394,1,-395,1,-16384,2,
+	-392,1,-393,1,-16384,3,-4,2,-16384,4,-366,1,-367,1,-16384,2,
+	-364,1,-365,1,-16384,3,-315,1,-16384,2,-126,1,-16384,2,-131,1,
+	-133,1,-132,1,-324,1,-16384,2,-325,1,-326,1,-16384,3,-327,1,
+	-328,1,-16384,3,-319,1,-320,1,-16384,12,-379,1,-16384,2,-4,1,
+	-16384,4,-313,1,-322,1,-272,1,-16384,1,-316,1,-16384,4,-273,1,
+	-274,1,-16384,1,-112,1,-16384,4,-119,1,-120,1,-16384,2,-123,1,
+	-124,1,-16384,2,-121,1,-122,1,-16384,1,-277,1,-278,1,-16384,3,
+	-275,1,-276,1,-16384,1,-279,1,-280,1,-271,1,-16384,15,-4,1,
+	-16384,3,-4,1,-16384,3,-362,1,-363,1,-16384,1,-384,1,-16384,2,
+	-386,1,-16384,2,-385,1,-270,1,-16384,3,-317,1,-318,1,-16384,3,
+	-312,1,-16384,2,-256,1,-311,1,-16384,14,-199,1,-16384,2,-202,1,
+	-204,1,-203,1,-16384,16,-237,1,-16384,3,-244,1,-16384,3,-216,1,
+	-16384,2,-230,1,-16384,7,-251,1,-16384,4,-223,1,-16384,2,-209,1,
+	-16384,11,-239,1,-16384,3,-246,1,-16384,3,-218,1,-16384,2,-232,1,
+	-16384,7,-253,1,-16384,4,-225,1,-16384,2,-211,1,-16384,11,-238,1,
+	-16384,3,-245,1,-16384,3,-217,1,-16384,2,-231,1,-16384,7,-252,1,
+	-16384,4,-224,1,-16384,2,-210,1,-16384,7,-234,1,-16384,1,-241,1,
+	-16384,1,-213,1,-227,1,-16384,5,-248,1,-16384,2,-220,1,-206,1,
+	-16384,2,-192,1,-16384,4,-195,1,-16384,2,-197,1,-16384,2,-196,1,
+	-321,1,-314,1,-59,1,-16384,2,-65,1,-16384,34,-609,1,-16384,4,
+	-608,1,-16384,4,-604,1,-605,1,-16384,3,-547,1,-16384,2,-403,1,
+	-543,1,-16384,2,-544,1,-545,1,-16384,11,-414,1,-16384,26,-616,1,
+	-16384,4,-615,1,-16384,4,-613,1,-614,1,-16384,8,-623,1,-16384,19,
+	-631,1,-442,1,-536,1,-16384,3,-548,1,-16384,2,-549,1,-550,1,
+	-16384,2,-551,1,-552,1,-16384,3,-443,1,-444,1,-16384,1,-447,1,
+	-448,1,-16384,3,-445,1,-446,1,-16384,1,-449,1,-450,1,-441,1,
+	-16384,13,-413,1,-16384,14,-554,1,-556,1,-16384,10,-555,1,-557,1,
+	-16384,14,-539,1,-541,1,-16384,10,-540,1,-542,1,-16384,18,-502,1,
+	-503,1,-16384,9,-553,1,-16384,5,-538,1,-16384,8,-537,1,-546,1,
+	-535,1,-16384,16,-305,1,-16384,7,-357,1,-16384,2,-4,1,-16384,12,
+	-4,2,-16384,9,-390,1,-391,1,-16384,2,-388,1,-389,1,-16384,3,
+	-4,2,-16384,4,-360,1,-361,1,-16384,2,-358,1,-359,1,-16384,3,
+	-297,1,-16384,2,-125,1,-16384,1,-129,1,-130,1,-306,1,-16384,2,
+	-307,1,-308,1,-16384,3,-309,1,-310,1,-16384,3,-301,1,-302,1,
+	-16384,12,-378,1,-16384,2,-4,1,-16384,4,-295,1,-304,1,-261,1,
+	-16384,1,-298,1,-16384,4,-262,1,-263,1,-16384,1,-111,1,-16384,3,
+	-115,1,-116,1,-16384,2,-117,1,-118,1,-16384,1,-266,1,-267,1,
+	-16384,3,-264,1,-265,1,-16384,1,-268,1,-269,1,-260,1,-16384,8,
+	-382,1,-16384,2,-383,1,-259,1,-16384,3,-299,1,-300,1,-16384,3,
+	-294,1,-16384,2,-255,1,-293,1,-16384,14,-198,1,-16384,1,-200,1,
+	-201,1,-16384,15,-235,1,-16384,3,-242,1,-16384,3,-214,1,-16384,2,
+	-228,1,-16384,7,-249,1,-16384,4,-221,1,-16384,2,-207,1,-16384,11,
+	-236,1,-16384,3,-243,1,-16384,3,-215,1,-16384,2,-229,1,-16384,7,
+	-250,1,-16384,4,-222,1,-16384,2,-208,1,-16384,7,-233,1,-16384,1,
+	-240,1,-16384,1,-212,1,-226,1,-16384,5,-247,1,-16384,2,-219,1,
+	-205,1,-16384,2,-191,1,-16384,3,-193,1,-16384,2,-194,1,-303,1,
+	-296,1,-16384,2,-64,1,-16384,14,-521,1,-16384,5,-522,1,-523,1,
+	-16384,2,-402,1,-515,1,-16384,2,-516,1,-517,1,-16384,11,-412,1,
+	-16384,15,-629,1,-16384,8,-622,1,-16384,15,-630,1,-16384,11,-506,1,
+	-16384,1,-432,1,-505,1,-16384,11,-509,1,-510,1,-16384,3,-525,1,
+	-16384,2,-526,1,-527,1,-16384,2,-528,1,-529,1,-16384,3,-433,1,
+	-434,1,-16384,1,-437,1,-438,1,-16384,3,-435,1,-436,1,-16384,1,
+	-439,1,-440,1,-431,1,-16384,15,-410,1,-411,1,-16384,14,-531,1,
+	-533,1,-16384,10,-532,1,-534,1,-16384,14,-511,1,-513,1,-16384,10,
+	-512,1,-514,1,-16384,18,-500,1,-501,1,-16384,5,-508,1,-16384,7,
+	-530,1,-16384,5,-507,1,-518,1,-16384,5,-519,1,-520,1,-504,1,
+	-16384,5,-32,1,-16384,4,-101,1,-16384,1,-100,1,-52,1,-16384,6,
+	-4,1,-16384,4,-4,1,-16384,4,-20,1,-16384,2,-70,1,-62,1,
+	-16384,2,-68,1,-16384,17,-498,1,-16384,3,-597,1,-16384,1,-595,1,
+	-16384,2,-406,1,-16384,11,-420,1,-16384,10,-620,1,-16384,2,-627,1,
+	-16384,1,-628,1,-619,1,-16384,16,-471,1,-16384,2,-602,1,-603,1,
+	-458,1,-16384,1,-594,1,-16384,3,-524,1,-16384,3,-598,1,-600,1,
+	-601,1,-461,1,-459,1,-462,1,-460,1,-16384,3,-493,1,-457,1,
+	-16384,10,-419,1,-16384,1,-599,1,-16384,18,-610,1,-611,1,-16384,1,
+	-492,1,-16384,2,-596,1,-593,1,-16384,16,-347,1,-16384,3,-351,1,
+	-16384,2,-128,1,-16384,1,-349,1,-16384,14,-381,1,-16384,2,-4,1,
+	-16384,10,-377,1,-16384,2,-4,1,-288,1,-16384,1,-344,1,-16384,3,
+	-348,1,-16384,3,-352,1,-354,1,-355,1,-291,1,-16384,1,-289,1,
+	-16384,1,-114,1,-292,1,-290,1,-16384,3,-346,1,-287,1,-16384,1,
+	-353,1,-16384,8,-356,1,-16384,13,-4,2,-16384,4,-4,2,-16384,4,
+	-375,1,-376,1,-16384,2,-373,1,-374,1,-258,1,-16384,1,-345,1,
+	-16384,2,-350,1,-343,1,-61,1,-16384,2,-67,1,-16384,17,-481,1,
+	-16384,3,-586,1,-16384,1,-584,1,-16384,2,-405,1,-16384,11,-418,1,
+	-16384,10,-618,1,-16384,2,-625,1,-16384,1,-626,1,-617,1,-16384,3,
+	-591,1,-592,1,-452,1,-16384,1,-583,1,-16384,3,-482,1,-16384,3,
+	-587,1,-589,1,-590,1,-455,1,-453,1,-456,1,-454,1,-16384,3,
+	-480,1,-451,1,-16384,10,-417,1,-16384,2,-588,1,-16384,14,-470,1,
+	-16384,14,-606,1,-607,1,-16384,1,-479,1,-16384,2,-585,1,-582,1,
+	-16384,15,-333,1,-16384,3,-337,1,-16384,2,-127,1,-16384,1,-335,1,
+	-16384,14,-380,1,-16384,2,-4,1,-282,1,-16384,1,-330,1,-16384,3,
+	-334,1,-16384,3,-338,1,-340,1,-341,1,-285,1,-16384,1,-283,1,
+	-16384,1,-113,1,-286,1,-284,1,-16384,3,-332,1,-281,1,-16384,2,
+	-339,1,-16384,8,-372,1,-16384,2,-4,1,-16384,8,-342,1,-16384,13,
+	-4,2,-16384,4,-4,2,-16384,4,-370,1,-371,1,-16384,2,-368,1,
+	-369,1,-257,1,-16384,1,-331,1,-16384,2,-336,1,-329,1,-16384,9,
+	-71,1,-16384,2,-69,1,-16384,2,-23,1,-16384,10,-77,1,-637,1,
+	-16384,2,-636,1,-27,1,-16384,4,-397,1,-16384,3,-50,1,-16384,4,
+	-96,1,-16384,4,-72,1,-16384,1,-26,1,-16384,6,-81,1,-16384,3,
+	-396,1,-16384,15,-78,1,-16384,1,-82,1,-16384,3,-639,1,-16384,3,
+	-640,1,-94,1,-16384,8,-83,1,-16384,7,-95,1,-16384,11,-87,1,
+	-16384,3,-90,1,-16384,6,-92,1,-91,1,-16384,2,-633,1,-16384,3,
+	-75,1,-16384,7,-47,1,-16384,2,-80,1,-16384,14,-632,1,-16384,19,
+	-44,1,-16384,3,-41,1,-16384,3,-42,1,-16384,4,-33,1,-16384,6,
+	-40,1,-16384,11,-35,1,-16384,6,-39,1,-16384,2,-37,1,-16384,12,
+	-34,1,-16384,6,-38,1,-16384,2,-36,1,-16384,7,-45,1,-16384,5,
+	-43,1,-16384,8,-46,1,-16384,4,-4,1,-16384,2,-53,1,-16384,2,
+	-79,1,-5,1,-16384,2,-6,1,-16384,1,-5,1,-16384,1,-5,2,
+	-16384,2,-5,1,-16384,1,-5,1,-16384,1,-5,2,-16384,1,-8,1,
+	-7,1,-16384,2,-8,1,-16384,1,-7,1,-16384,1,-7,2,-16384,2,
+	-7,1,-16384,1,-7,1,-16384,1,-7,2,-6,2,-16384,3,-9,1,
+	-16384,3,-6,1,-16384,1,-8,1,-16384,1,-8,1,3127,1,3120,1,
+	-15,1,3120,1,-16384,4,3127,1,-13,1,1,1,-16384,4,-16401,1,
+	1,1,-16384,2,-6,2,-16384,2,-86,1,-16384,19,-49,1,-16384,27,
+	-176,1,-177,1,-178,1,-16384,16,-164,1,-165,1,-166,1,-16384,23,
+	-185,1,-186,1,-187,1,-16384,16,-173,1,-174,1,-175,1,-16384,23,
+	-182,1,-183,1,-184,1,-16384,16,-170,1,-171,1,-172,1,-16384,24,
+	-179,1,-180,1,-181,1,-16384,16,-167,1,-168,1,-169,1,-76,1,
+	-16384,10,-467,1,-16384,3,-153,1,-16384,8,-158,1,-16384,5,-161,1,
+	-16384,5,-160,1,-16384,5,-159,1,-466,1,-16384,1,-463,1,-16384,2,
+	-142,1,-16384,8,-143,1,-144,1,-16384,5,-149,1,-16384,2,-154,1,
+	-16384,7,-163,1,-16384,3,-152,1,-16384,2,-157,1,-16384,5,-147,1,
+	-148,1,-16384,5,-162,1,-16384,3,-151,1,-16384,2,-156,1,-16384,5,
+	-145,1,-146,1,-16384,5,-150,1,-16384,2,-155,1,-16384,3,-398,1,
+	-16384,7,-468,1,-16384,1,-464,1,-16384,5,-469,1,-16384,2,-465,1,
+	-16384,9,-89,1,-16384,6,-21,1,-638,1,-16384,4,-106,1,-16384,1,
+	-48,1,-56,1,-16384,6,-4,1,-16384,2,-22,1,-16384,9,-141,1,
+	-103,1,-16384,2,-139,1,-16384,3,-104,1,-102,1,-16384,2,-105,1,
+	-16384,2,-140,1,-16384,5,-28,1,-16384,3,-73,1,-16384,8,-4,1,
+	-16384,4,-4,1,-16384,2,-110,1,-16384,8,-93,1,-16384,2,-107,1,
+	-16384,2,-30,1,-16384,4,-57,1,-16384,7,-108,1,-16384,5,-109,1,
+	-16384,2,-387,1,-16384,4,-88,1,-16384,3,-74,1,-16384,3,-29,1,
+	-16384,4,-54,1,-16384,2,-254,1,-9,1,-16384,11,-11,1,-16384,8,
+	-12,1,-16384,1,-9,1,-16384,1,-9,1,-16384,3,-58,1,-16384,3,
+	-19,1,-16384,3,-25,1,-16384,9,-134,1,-16384,2,-136,1,-16384,2,
+	-135,1,-16384,2,-138,1,-16384,2,-137,1,-16384,13,-190,1,-189,1,
+	-16384,4,-188,1,-16384,3,-634,1,-16384,1,-31,1,-16384,5,-99,1,
+	-16384,1,-98,1,-16384,1,-97,1,-16384,4,-635,1,-16384,4,-55,1,
+	-10,1,-16384,4,-51,1,-16384,5,-84,1,-16384,19,-85,1,-16384,3,
+	-24,1,-16384,2,-63,1,-16384,19,-400,1,-489,1,-16384,5,-490,1,
+	-491,1,-16384,2,-401,1,-483,1,-16384,5,-399,1,-16384,1,-484,1,
+	-485,1,-16384,11,-409,1,-16384,12,-612,1,-16384,8,-621,1,-16384,4,
+	-474,1,-16384,1,-422,1,-473,1,-16384,11,-477,1,-478,1,-16384,4,
+	-494,1,-495,1,-16384,2,-496,1,-497,1,-16384,3,-423,1,-424,1,
+	-16384,1,-427,1,-428,1,-16384,3,-425,1,-426,1,-16384,1,-429,1,
+	-430,1,-421,1,-16384,12,-407,1,-408,1,-16384,5,-476,1,-16384,7,
+	-499,1,-16384,5,-475,1,-486,1,-16384,5,-487,1,-488,1,-472,1,
+	-60,1,-16384,2,-66,1,-16384,13,-570,1,-16384,2,-404,1,-566,1,
+	-16384,2,-567,1,-568,1,-16384,11,-416,1,-16384,14,-624,1,-573,1,
+	-559,1,-16384,1,-571,1,-16384,3,-574,1,-16384,1,-576,1,-16384,3,
+	-575,1,-16384,1,-577,1,-572,1,-16384,12,-415,1,-16384,14,-578,1,
+	-580,1,-16384,10,-579,1,-581,1,-16384,14,-562,1,-564,1,-16384,10,
+	-563,1,-565,1,-16384,5,-561,1,-16384,8,-560,1,-569,1,-558,1,
+	-16384,15,-323,1,-16384,12,-4,2,-16384,9,-394,1,-395,1,-16384,2,
+	-392,1,-393,1,-16384,3,-4,2,-16384,4,-366,1,-367,1,-16384,2,
+	-364,1,-365,1,-16384,3,-315,1,-16384,2,-126,1,-16384,2,-131,1,
+	-133,1,-132,1,-324,1,-16384,2,-325,1,-326,1,-16384,3,-327,1,
+	-328,1,-16384,3,-319,1,-320,1,-16384,12,-379,1,-16384,2,-4,1,
+	-16384,4,-313,1,-322,1,-272,1,-16384,1,-316,1,-16384,4,-273,1,
+	-274,1,-16384,1,-112,1,-16384,4,-119,1,-120,1,-16384,2,-123,1,
+	-124,1,-16384,2,-121,1,-122,1,-16384,1,-277,1,-278,1,-16384,3,
+	-275,1,-276,1,-16384,1,-279,1,-280,1,-271,1,-16384,15,-4,1,
+	-16384,3,-4,1,-16384,3,-362,1,-363,1,-16384,1,-384,1,-16384,2,
+	-386,1,-16384,2,-385,1,-270,1,-16384,3,-317,1,-318,1,-16384,3,
+	-312,1,-16384,2,-256,1,-311,1,-16384,14,-199,1,-16384,2,-202,1,
+	-204,1,-203,1,-16384,16,-237,1,-16384,3,-244,1,-16384,3,-216,1,
+	-16384,2,-230,1,-16384,7,-251,1,-16384,4,-223,1,-16384,2,-209,1,
+	-16384,11,-239,1,-16384,3,-246,1,-16384,3,-218,1,-16384,2,-232,1,
+	-16384,7,-253,1,-16384,4,-225,1,-16384,2,-211,1,-16384,11,-238,1,
+	-16384,3,-245,1,-16384,3,-217,1,-16384,2,-231,1,-16384,7,-252,1,
+	-16384,4,-224,1,-16384,2,-210,1,-16384,7,-234,1,-16384,1,-241,1,
+	-16384,1,-213,1,-227,1,-16384,5,-248,1,-16384,2,-220,1,-206,1,
+	-16384,2,-192,1,-16384,4,-195,1,-16384,2,-197,1,-16384,2,-196,1,
+	-321,1,-314,1,-59,1,-16384,2,-65,1,-16384,34,-609,1,-16384,4,
+	-608,1,-16384,4,-604,1,-605,1,-16384,3,-547,1,-16384,2,-403,1,
+	-543,1,-16384,2,-544,1,-545,1,-16384,11,-414,1,-16384,26,-616,1,
+	-16384,4,-615,1,-16384,4,-613,1,-614,1,-16384,8,-623,1,-16384,19,
+	-631,1,-442,1,-536,1,-16384,3,-548,1,-16384,2,-549,1,-550,1,
+	-16384,2,-551,1,-552,1,-16384,3,-443,1,-444,1,-16384,1,-447,1,
+	-448,1,-16384,3,-445,1,-446,1,-16384,1,-449,1,-450,1,-441,1,
+	-16384,13,-413,1,-16384,14,-554,1,-556,1,-16384,10,-555,1,-557,1,
+	-16384,14,-539,1,-541,1,-16384,10,-540,1,-542,1,-16384,18,-502,1,
+	-503,1,-16384,9,-553,1,-16384,5,-538,1,-16384,8,-537,1,-546,1,
+	-535,1,-16384,16,-305,1,-16384,7,-357,1,-16384,2,-4,1,-16384,12,
+	-4,2,-16384,9,-390,1,-391,1,-16384,2,-388,1,-389,1,-16384,3,
+	-4,2,-16384,4,-360,1,-361,1,-16384,2,-358,1,-359,1,-16384,3,
+	-297,1,-16384,2,-125,1,-16384,1,-129,1,-130,1,-306,1,-16384,2,
+	-307,1,-308,1,-16384,3,-309,1,-310,1,-16384,3,-301,1,-302,1,
+	-16384,12,-378,1,-16384,2,-4,1,-16384,4,-295,1,-304,1,-261,1,
+	-16384,1,-298,1,-16384,4,-262,1,-263,1,-16384,1,-111,1,-16384,3,
+	-115,1,-116,1,-16384,2,-117,1,-118,1,-16384,1,-266,1,-267,1,
+	-16384,3,-264,1,-265,1,-16384,1,-268,1,-269,1,-260,1,-16384,8,
+	-382,1,-16384,2,-383,1,-259,1,-16384,3,-299,1,-300,1,-16384,3,
+	-294,1,-16384,2,-255,1,-293,1,-16384,14,-198,1,-16384,1,-200,1,
+	-201,1,-16384,15,-235,1,-16384,3,-242,1,-16384,3,-214,1,-16384,2,
+	-228,1,-16384,7,-249,1,-16384,4,-221,1,-16384,2,-207,1,-16384,11,
+	-236,1,-16384,3,-243,1,-16384,3,-215,1,-16384,2,-229,1,-16384,7,
+	-250,1,-16384,4,-222,1,-16384,2,-208,1,-16384,7,-233,1,-16384,1,
+	-240,1,-16384,1,-212,1,-226,1,-16384,5,-247,1,-16384,2,-219,1,
+	-205,1,-16384,2,-191,1,-16384,3,-193,1,-16384,2,-194,1,-303,1,
+	-296,1,-16384,2,-64,1,-16384,14,-521,1,-16384,5,-522,1,-523,1,
+	-16384,2,-402,1,-515,1,-16384,2,-516,1,-517,1,-16384,11,-412,1,
+	-16384,15,-629,1,-16384,8,-622,1,-16384,15,-630,1,-16384,11,-506,1,
+	-16384,1,-432,1,-505,1,-16384,11,-509,1,-510,1,-16384,3,-525,1,
+	-16384,2,-526,1,-527,1,-16384,2,-528,1,-529,1,-16384,3,-433,1,
+	-434,1,-16384,1,-437,1,-438,1,-16384,3,-435,1,-436,1,-16384,1,
+	-439,1,-440,1,-431,1,-16384,15,-410,1,-411,1,-16384,14,-531,1,
+	-533,1,-16384,10,-532,1,-534,1,-16384,14,-511,1,-513,1,-16384,10,
+	-512,1,-514,1,-16384,18,-500,1,-501,1,-16384,5,-508,1,-16384,7,
+	-530,1,-16384,5,-507,1,-518,1,-16384,5,-519,1,-520,1,-504,1,
+	-16384,5,-32,1,-16384,4,-101,1,-16384,1,-100,1,-52,1,-16384,6,
+	-4,1,-16384,4,-4,1,-16384,4,-20,1,-16384,2,-70,1,-62,1,
+	-16384,2,-68,1,-16384,17,-498,1,-16384,3,-597,1,-16384,1,-595,1,
+	-16384,2,-406,1,-16384,11,-420,1,-16384,10,-620,1,-16384,2,-627,1,
+	-16384,1,-628,1,-619,1,-16384,16,-471,1,-16384,2,-602,1,-603,1,
+	-458,1,-16384,1,-594,1,-16384,3,-524,1,-16384,3,-598,1,-600,1,
+	-601,1,-461,1,-459,1,-462,1,-460,1,-16384,3,-493,1,-457,1,
+	-16384,10,-419,1,-16384,1,-599,1,-16384,18,-610,1,-611,1,-16384,1,
+	-492,1,-16384,2,-596,1,-593,1,-16384,16,-347,1,-16384,3,-351,1,
+	-16384,2,-128,1,-16384,1,-349,1,-16384,14,-381,1,-16384,2,-4,1,
+	-16384,10,-377,1,-16384,2,-4,1,-288,1,-16384,1,-344,1,-16384,3,
+	-348,1,-16384,3,-352,1,-354,1,-355,1,-291,1,-16384,1,-289,1,
+	-16384,1,-114,1,-292,1,-290,1,-16384,3,-346,1,-287,1,-16384,1,
+	-353,1,-16384,8,-356,1,-16384,13,-4,2,-16384,4,-4,2,-16384,4,
+	-375,1,-376,1,-16384,2,-373,1,-374,1,-258,1,-16384,1,-345,1,
+	-16384,2,-350,1,-343,1,-61,1,-16384,2,-67,1,-16384,17,-481,1,
+	-16384,3,-586,1,-16384,1,-584,1,-16384,2,-405,1,-16384,11,-418,1,
+	-16384,10,-618,1,-16384,2,-625,1,-16384,1,-626,1,-617,1,-16384,3,
+	-591,1,-592,1,-452,1,-16384,1,-583,1,-16384,3,-482,1,-16384,3,
+	-587,1,-589,1,-590,1,-455,1,-453,1,-456,1,-454,1,-16384,3,
+	-480,1,-451,1,-16384,10,-417,1,-16384,2,-588,1,-16384,14,-470,1,
+	-16384,14,-606,1,-607,1,-16384,1,-479,1,-16384,2,-585,1,-582,1,
+	-16384,15,-333,1,-16384,3,-337,1,-16384,2,-127,1,-16384,1,-335,1,
+	-16384,14,-380,1,-16384,2,-4,1,-282,1,-16384,1,-330,1,-16384,3,
+	-334,1,-16384,3,-338,1,-340,1,-341,1,-285,1,-16384,1,-283,1,
+	-16384,1,-113,1,-286,1,-284,1,-16384,3,-332,1,-281,1,-16384,2,
+	-339,1,-16384,8,-372,1,-16384,2,-4,1,-16384,8,-342,1,-16384,13,
+	-4,2,-16384,4,-4,2,-16384,4,-370,1,-371,1,-16384,2,-368,1,
+	-369,1,-257,1,-16384,1,-331,1,-16384,2,-336,1,-329,1,-16384,9,
+	-71,1,-16384,2,-69,1,-16384,2,-23,1,-16384,10,-77,1,-637,1,
+	-16384,2,-636,1,-27,1,-16384,4,-397,1,-16384,3,-50,1,-16384,4,
+	-96,1,-16384,4,-72,1,-16384,1,-26,1,-16384,6,-81,1,-16384,3,
+	-396,1,-16384,15,-78,1,-16384,1,-82,1,-16384,3,-639,1,-16384,3,
+	-640,1,-94,1,-16384,8,-83,1,-16384,7,-95,1,-16384,11,-87,1,
+	-16384,3,-90,1,-16384,6,-92,1,-91,1,-16384,2,-633,1,-16384,3,
+	-75,1,-16384,7,-47,1,-16384,2,-80,1,-16384,14,-632,1,-16384,19,
+	-44,1,-16384,3,-41,1,-16384,3,-42,1,-16384,4,-33,1,-16384,6,
+	-40,1,-16384,11,-35,1,-16384,6,-39,1,-16384,2,-37,1,-16384,12,
+	-34,1,-16384,6,-38,1,-16384,2,-36,1,-16384,7,-45,1,-16384,5,
+	-43,1,-16384,8,-46,1,-16384,4,-4,1,-16384,2,-53,1,-16384,2,
+	-79,1,-5,1,-16384,2,-6,1,-16384,1,-5,1,-16384,1,-5,2,
+	-16384,2,-5,1,-16384,1,-5,1,-16384,1,-5,2,-16384,1,-8,1,
+	-7,1,-16384,2,-8,1,-16384,1,-7,1,-16384,1,-7,2,-16384,2,
+	-7,1,-16384,1,-7,1,-16384,1,-7,2,-6,2,-16384,3,-9,1,
+	-16384,3,-6,1,-16384,1,-8,1,-16384,1,-8,1,-14,1,3120,1,
+	-15,1,3120,1,-16384,4,-14,1,-13,1,1,1,-16384,4,-16400,1,
+	1,1,-16384,2,-6,2,-16384,2,-86,1,-16384,19,-49,1,-16384,27,
+	-176,1,-177,1,-178,1,-16384,16,-164,1,-165,1,-166,1,-16384,23,
+	-185,1,-186,1,-187,1,-16384,16,-173,1,-174,1,-175,1,-16384,23,
+	-182,1,-183,1,-184,1,-16384,16,-170,1,-171,1,-172,1,-16384,24,
+	-179,1,-180,1,-181,1,-16384,16,-167,1,-168,1,-169,1,-76,1,
+	-16384,10,-467,1,-16384,3,-153,1,-16384,8,-158,1,-16384,5,-161,1,
+	-16384,5,-160,1,-16384,5,-159,1,-466,1,-16384,1,-463,1,-16384,2,
+	-142,1,-16384,8,-143,1,-144,1,-16384,5,-149,1,-16384,2,-154,1,
+	-16384,7,-163,1,-16384,3,-152,1,-16384,2,-157,1,-16384,5,-147,1,
+	-148,1,-16384,5,-162,1,-16384,3,-151,1,-16384,2,-156,1,-16384,5,
+	-145,1,-146,1,-16384,5,-150,1,-16384,2,-155,1,-16384,3,-398,1,
+	-16384,7,-468,1,-16384,1,-464,1,-16384,5,-469,1,-16384,2,-465,1,
+	-16384,9,-89,1,-16384,6,-21,1,-638,1,-16384,4,-106,1,-16384,1,
+	-48,1,-56,1,-16384,6,-4,1,-16384,2,-22,1,-16384,9,-141,1,
+	-103,1,-16384,2,-139,1,-16384,3,-104,1,-102,1,-16384,2,-105,1,
+	-16384,2,-140,1,-16384,5,-28,1,-16384,3,-73,1,-16384,8,-4,1,
+	-16384,4,-4,1,-16384,2,-110,1,-16384,8,-93,1,-16384,2,-107,1,
+	-16384,2,-30,1,-16384,4,-57,1,-16384,7,-108,1,-16384,5,-109,1,
+	-16384,2,-387,1,-16384,4,-88,1,-16384,3,-74,1,-16384,3,-29,1,
+	-16384,4,-54,1,-16384,2,-254,1,-9,1,-16384,11,-11,1,-16384,8,
+	-12,1,-16384,1,-9,1,-16384,1,-9,1,-16384,3,-58,1,-16384,3,
+	-19,1,-16384,3,-25,1,-16384,9,-134,1,-16384,2,-136,1,-16384,2,
+	-135,1,-16384,2,-138,1,-16384,2,-137,1,-16384,13,-190,1,-189,1,
+	-16384,4,-188,1,-16384,3,-634,1,-16384,1,-31,1,-16384,5,-99,1,
+	-16384,1,-98,1,-16384,1,-97,1,-16384,4,-635,1,-16384,4,-55,1,
+	-10,1,-16384,4,-51,1,-16384,5,-84,1,-16384,19,-85,1,-16384,3,
+	-24,1,-16384,2,-63,1,-16384,19,-400,1,-489,1,-16384,5,-490,1,
+	-491,1,-16384,2,-401,1,-483,1,-16384,5,-399,1,-16384,1,-484,1,
+	-485,1,-16384,11,-409,1,-16384,12,-612,1,-16384,8,-621,1,-16384,4,
+	-474,1,-16384,1,-422,1,-473,1,-16384,11,-477,1,-478,1,-16384,4,
+	-494,1,-495,1,-16384,2,-496,1,-497,1,-16384,3,-423,1,-424,1,
+	-16384,1,-427,1,-428,1,-16384,3,-425,1,-426,1,-16384,1,-429,1,
+	-430,1,-421,1,-16384,12,-407,1,-408,1,-16384,5,-476,1,-16384,7,
+	-499,1,-16384,5,-475,1,-486,1,-16384,5,-487,1,-488,1,-472,1,
+	-60,1,-16384,2,-66,1,-16384,13,-570,1,-16384,2,-404,1,-566,1,
+	-16384,2,-567,1,-568,1,-16384,11,-416,1,-16384,14,-624,1,-573,1,
+	-559,1,-16384,1,-571,1,-16384,3,-574,1,-16384,1,-576,1,-16384,3,
+	-575,1,-16384,1,-577,1,-572,1,-16384,12,-415,1,-16384,14,-578,1,
+	-580,1,-16384,10,-579,1,-581,1,-16384,14,-562,1,-564,1,-16384,10,
+	-563,1,-565,1,-16384,5,-561,1,-16384,8,-560,1,-569,1,-558,1,
+	-16384,15,-323,1,-16384,12,-4,2,-16384,9,-394,1,-395,1,-16384,2,
+	-392,1,-393,1,-16384,3,-4,2,-16384,4,-366,1,-367,1,-16384,2,
+	-364,1,-365,1,-16384,3,-315,1,-16384,2,-126,1,-16384,2,-131,1,
+	-133,1,-132,1,-324,1,-16384,2,-325,1,-326,1,-16384,3,-327,1,
+	-328,1,-16384,3,-319,1,-320,1,-16384,12,-379,1,-16384,2,-4,1,
+	-16384,4,-313,1,-322,1,-272,1,-16384,1,-316,1,-16384,4,-273,1,
+	-274,1,-16384,1,-112,1,-16384,4,-119,1,-120,1,-16384,2,-123,1,
+	-124,1,-16384,2,-121,1,-122,1,-16384,1,-277,1,-278,1,-16384,3,
+	-275,1,-276,1,-16384,1,-279,1,-280,1,-271,1,-16384,15,-4,1,
+	-16384,3,-4,1,-16384,3,-362,1,-363,1,-16384,1,-384,1,-16384,2,
+	-386,1,-16384,2,-385,1,-270,1,-16384,3,-317,1,-318,1,-16384,3,
+	-312,1,-16384,2,-256,1,-311,1,-16384,14,-199,1,-16384,2,-202,1,
+	-204,1,-203,1,-16384,16,-237,1,-16384,3,-244,1,-16384,3,-216,1,
+	-16384,2,-230,1,-16384,7,-251,1,-16384,4,-223,1,-16384,2,-209,1,
+	-16384,11,-239,1,-16384,3,-246,1,-16384,3,-218,1,-16384,2,-232,1,
+	-16384,7,-253,1,-16384,4,-225,1,-16384,2,-211,1,-16384,11,-238,1,
+	-16384,3,-245,1,-16384,3,-217,1,-16384,2,-231,1,-16384,7,-252,1,
+	-16384,4,-224,1,-16384,2,-210,1,-16384,7,-234,1,-16384,1,-241,1,
+	-16384,1,-213,1,-227,1,-16384,5,-248,1,-16384,2,-220,1,-206,1,
+	-16384,2,-192,1,-16384,4,-195,1,-16384,2,-197,1,-16384,2,-196,1,
+	-321,1,-314,1,-59,1,-16384,2,-65,1,-16384,34,-609,1,-16384,4,
+	-608,1,-16384,4,-604,1,-605,1,-16384,3,-547,1,-16384,2,-403,1,
+	-543,1,-16384,2,-544,1,-545,1,-16384,11,-414,1,-16384,26,-616,1,
+	-16384,4,-615,1,-16384,4,-613,1,-614,1,-16384,8,-623,1,-16384,19,
+	-631,1,-442,1,-536,1,-16384,3,-548,1,-16384,2,-549,1,-550,1,
+	-16384,2,-551,1,-552,1,-16384,3,-443,1,-444,1,-16384,1,-447,1,
+	-448,1,-16384,3,-445,1,-446,1,-16384,1,-449,1,-450,1,-441,1,
+	-16384,13,-413,1,-16384,14,-554,1,-556,1,-16384,10,-555,1,-557,1,
+	-16384,14,-539,1,-541,1,-16384,10,-540,1,-542,1,-16384,18,-502,1,
+	-503,1,-16384,9,-553,1,-16384,5,-538,1,-16384,8,-537,1,-546,1,
+	-535,1,-16384,16,-305,1,-16384,7,-357,1,-16384,2,-4,1,-16384,12,
+	-4,2,-16384,9,-390,1,-391,1,-16384,2,-388,1,-389,1,-16384,3,
+	-4,2,-16384,4,-360,1,-361,1,-16384,2,-358,1,-359,1,-16384,3,
+	-297,1,-16384,2,-125,1,-16384,1,-129,1,-130,1,-306,1,-16384,2,
+	-307,1,-308,1,-16384,3,-309,1,-310,1,-16384,3,-301,1,-302,1,
+	-16384,12,-378,1,-16384,2,-4,1,-16384,4,-295,1,-304,1,-261,1,
+	-16384,1,-298,1,-16384,4,-262,1,-263,1,-16384,1,-111,1,-16384,3,
+	-115,1,-116,1,-16384,2,-117,1,-118,1,-16384,1,-266,1,-267,1,
+	-16384,3,-264,1,-265,1,-16384,1,-268,1,-269,1,-260,1,-16384,8,
+	-382,1,-16384,2,-383,1,-259,1,-16384,3,-299,1,-300,1,-16384,3,
+	-294,1,-16384,2,-255,1,-293,1,-16384,14,-198,1,-16384,1,-200,1,
+	-201,1,-16384,15,-235,1,-16384,3,-242,1,-16384,3,-214,1,-16384,2,
+	-228,1,-16384,7,-249,1,-16384,4,-221,1,-16384,2,-207,1,-16384,11,
+	-236,1,-16384,3,-243,1,-16384,3,-215,1,-16384,2,-229,1,-16384,7,
+	-250,1,-16384,4,-222,1,-16384,2,-208,1,-16384,7,-233,1,-16384,1,
+	-240,1,-16384,1,-212,1,-226,1,-16384,5,-247,1,-16384,2,-219,1,
+	-205,1,-16384,2,-191,1,-16384,3,-193,1,-16384,2,-194,1,-303,1,
+	-296,1,-16384,2,-64,1,-16384,14,-521,1,-16384,5,-522,1,-523,1,
+	-16384,2,-402,1,-515,1,-16384,2,-516,1,-517,1,-16384,11,-412,1,
+	-16384,15,-629,1,-16384,8,-622,1,-16384,15,-630,1,-16384,11,-506,1,
+	-16384,1,-432,1,-505,1,-16384,11,-509,1,-510,1,-16384,3,-525,1,
+	-16384,2,-526,1,-527,1,-16384,2,-528,1,-529,1,-16384,3,-433,1,
+	-434,1,-16384,1,-437,1,-438,1,-16384,3,-435,1,-436,1,-16384,1,
+	-439,1,-440,1,-431,1,-16384,15,-410,1,-411,1,-16384,14,-531,1,
+	-533,1,-16384,10,-532,1,-534,1,-16384,14,-511,1,-513,1,-16384,10,
+	-512,1,-514,1,-16384,18,-500,1,-501,1,-16384,5,-508,1,-16384,7,
+	-530,1,-16384,5,-507,1,-518,1,-16384,5,-519,1,-520,1,-504,1,
+	-16384,5,-32,1,-16384,4,-101,1,-16384,1,-100,1,-52,1,-16384,6,
+	-4,1,-16384,4,-4,1,-16384,4,-20,1,-16384,2,-70,1,-62,1,
+	-16384,2,-68,1,-16384,17,-498,1,-16384,3,-597,1,-16384,1,-595,1,
+	-16384,2,-406,1,-16384,11,-420,1,-16384,10,-620,1,-16384,2,-627,1,
+	-16384,1,-628,1,-619,1,-16384,16,-471,1,-16384,2,-602,1,-603,1,
+	-458,1,-16384,1,-594,1,-16384,3,-524,1,-16384,3,-598,1,-600,1,
+	-601,1,-461,1,-459,1,-462,1,-460,1,-16384,3,-493,1,-457,1,
+	-16384,10,-419,1,-16384,1,-599,1,-16384,18,-610,1,-611,1,-16384,1,
+	-492,1,-16384,2,-596,1,-593,1,-16384,16,-347,1,-16384,3,-351,1,
+	-16384,2,-128,1,-16384,1,-349,1,-16384,14,-381,1,-16384,2,-4,1,
+	-16384,10,-377,1,-16384,2,-4,1,-288,1,-16384,1,-344,1,-16384,3,
+	-348,1,-16384,3,-352,1,-354,1,-355,1,-291,1,-16384,1,-289,1,
+	-16384,1,-114,1,-292,1,-290,1,-16384,3,-346,1,-287,1,-16384,1,
+	-353,1,-16384,8,-356,1,-16384,13,-4,2,-16384,4,-4,2,-16384,4,
+	-375,1,-376,1,-16384,2,-373,1,-374,1,-258,1,-16384,1,-345,1,
+	-16384,2,-350,1,-343,1,-61,1,-16384,2,-67,1,-16384,17,-481,1,
+	-16384,3,-586,1,-16384,1,-584,1,-16384,2,-405,1,-16384,11,-418,1,
+	-16384,10,-618,1,-16384,2,-625,1,-16384,1,-626,1,-617,1,-16384,3,
+	-591,1,-592,1,-452,1,-16384,1,-583,1,-16384,3,-482,1,-16384,3,
+	-587,1,-589,1,-590,1,-455,1,-453,1,-456,1,-454,1,-16384,3,
+	-480,1,-451,1,-16384,10,-417,1,-16384,2,-588,1,-16384,14,-470,1,
+	-16384,14,-606,1,-607,1,-16384,1,-479,1,-16384,2,-585,1,-582,1,
+	-16384,15,-333,1,-16384,3,-337,1,-16384,2,-127,1,-16384,1,-335,1,
+	-16384,14,-380,1,-16384,2,-4,1,-282,1,-16384,1,-330,1,-16384,3,
+	-334,1,-16384,3,-338,1,-340,1,-341,1,-285,1,-16384,1,-283,1,
+	-16384,1,-113,1,-286,1,-284,1,-16384,3,-332,1,-281,1,-16384,2,
+	-339,1,-16384,8,-372,1,-16384,2,-4,1,-16384,8,-342,1,-16384,13,
+	-4,2,-16384,4,-4,2,-16384,4,-370,1,-371,1,-16384,2,-368,1,
+	-369,1,-257,1,-16384,1,-331,1,-16384,2,-336,1,-329,1,-16384,9,
+	-71,1,-16384,2,-69,1,-16384,2,-23,1,-16384,10,-77,1,-637,1,
+	-16384,2,-636,1,-27,1,-16384,4,-397,1,-16384,3,-50,1,-16384,4,
+	-96,1,-16384,4,-72,1,-16384,1,-26,1,-16384,6,-81,1,-16384,3,
+	-396,1,-16384,15,-78,1,-16384,1,-82,1,-16384,3,-639,1,-16384,3,
+	-640,1,-94,1,-16384,8,-83,1,-16384,7,-95,1,-16384,11,-87,1,
+	-16384,3,-90,1,-16384,6,-92,1,-91,1,-16384,2,-633,1,-16384,3,
+	-75,1,-16384,7,-47,1,-16384,2,-80,1,-16384,14,-632,1,-16384,19,
+	-44,1,-16384,3,-41,1,-16384,3,-42,1,-16384,4,-33,1,-16384,6,
+	-40,1,-16384,11,-35,1,-16384,6,-39,1,-16384,2,-37,1,-16384,12,
+	-34,1,-16384,6,-38,1,-16384,2,-36,1,-16384,7,-45,1,-16384,5,
+	-43,1,-16384,8,-46,1,-16384,4,-4,1,-16384,2,-53,1,-16384,2,
+	-79,1,-5,1,-16384,2,-6,1,-16384,1,-5,1,-16384,1,-5,2,
+	-16384,2,-5,1,-16384,1,-5,1,-16384,1,-5,2,-16384,1,-8,1,
+	-7,1,-16384,2,-8,1,-16384,1,-7,1,-16384,1,-7,2,-16384,2,
+	-7,1,-16384,1,-7,1,-16384,1,-7,2,-6,2,-16384,3,-9,1,
+	-16384,3,-6,1,-16384,1,-8,1,-16384,1,-8,1,-14,1,3120,1,
+	-15,1,3120,1,-16384,4,-14,1,-13,1,1,1,-16384,4,
+};
+
+static constexpr WAVM::U64 precomputedLegacyLexerTokenDefinitionsHash = 0x146569c73399d581;
+static constexpr WAVM::Uptr precomputedLegacyLexerNumClasses = 57;
+static constexpr WAVM::Uptr precomputedLegacyLexerNumStates = 3134;
+static constexpr WAVM::U32 precomputedLegacyLexerCharToOffsetMap[256] = {
+	0,6268,6268,6268,6268,6268,6268,6268,6268,15670,3134,6268,6268,15670,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	15670,18804,65814,18804,68948,18804,18804,18804,175504,172370,18804,72082,6268,72082,53278,25072,
+	75216,94020,90886,100288,87752,81484,103422,84618,97154,78350,34474,15670,18804,169236,18804,18804,
+	18804,31340,31340,31340,31340,56412,31340,18804,18804,18804,18804,18804,18804,18804,18804,18804,
+	21938,18804,18804,18804,18804,18804,18804,18804,47010,18804,18804,6268,62680,6268,18804,59546,
+	18804,106556,109690,112824,115958,119092,122226,125360,43876,128494,18804,28206,131628,134762,137896,141030,
+	144164,147298,150432,153566,156700,159834,162968,166102,50144,40742,37608,12536,18804,9402,18804,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+	6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,6268,
+};
+static constexpr WAVM::I16 precomputedLegacyLexerRunLengthEncodedTransitions[28286] = {
+	-16384,4,-6,2,-16384,2,-86,1,-16384,19,-49,1,-16384,27,-176,1,
+	-177,1,-178,1,-16384,16,-164,1,-165,1,-166,1,-16384,23,-185,1,
+	-186,1,-187,1,-16384,16,-173,1,-174,1,-175,1,-16384,23,-182,1,
+	-183,1,-184,1,-16384,16,-170,1,-171,1,-172,1,-16384,24,-179,1,
+	-180,1,-181,1,-16384,16,-167,1,-168,1,-169,1,-76,1,-16384,10,
+	-467,1,-16384,3,-153,1,-16384,8,-158,1,-16384,5,-161,1,-16384,5,
+	-160,1,-16384,5,-159,1,-466,1,-16384,1,-463,1,-16384,2,-142,1,
+	-16384,8,-143,1,-144,1,-16384,5,-149,1,-16384,2,-154,1,-16384,7,
+	-163,1,-16384,3,-152,1,-16384,2,-157,1,-16384,5,-147,1,-148,1,
+	-16384,5,-162,1,-16384,3,-151,1,-16384,2,-156,1,-16384,5,-145,1,
+	-146,1,-16384,5,-150,1,-16384,2,-155,1,-16384,3,-398,1,-16384,7,
+	-468,1,-16384,1,-464,1,-16384,5,-469,1,-16384,2,-465,1,-16384,9,
+	-89,1,-16384,6,-21,1,-638,1,-16384,4,-106,1,-16384,1,-48,1,
+	-56,1,-16384,6,-99,1,-16384,2,-22,1,-16384,9,-141,1,-103,1,
+	-16384,2,-139,1,-16384,3,-104,1,-102,1,-16384,2,-105,1,-16384,2,
+	-140,1,-16384,5,-28,1,-16384,3,-73,1,-16384,8,-98,1,-16384,4,
+	-101,1,-16384,2,-110,1,-16384,8,-93,1,-16384,2,-107,1,-16384,2,
+	-30,1,-16384,4,-57,1,-16384,7,-108,1,-16384,5,-109,1,-16384,2,
+	-387,1,-16384,4,-88,1,-16384,3,-74,1,-16384,3,-29,1,-16384,4,
+	-54,1,-16384,2,-254,1,-9,1,-16384,11,-11,1,-16384,8,-12,1,
+	-16384,1,-9,1,-16384,1,-9,1,-16384,3,-58,1,-16384,3,-19,1,
+	-16384,3,-25,1,-16384,9,-134,1,-16384,2,-136,1,-16384,2,-135,1,
+	-16384,2,-138,1,-16384,2,-137,1,-16384,13,-190,1,-189,1,-16384,4,
+	-188,1,-16384,3,-634,1,-16384,1,-31,1,-16384,5,-99,1,-16384,1,
+	-98,1,-16384,1,-97,1,-16384,4,-635,1,-16384,4,-55,1,-10,1,
+	-16384,4,-51,1,-16384,5,-84,1,-16384,19,-85,1,-16384,3,-24,1,
+	-16384,2,-63,1,-16384,19,-400,1,-489,1,-16384,5,-490,1,-491,1,
+	-16384,2,-401,1,-483,1,-16384,5,-399,1,-16384,1,-484,1,-485,1,
+	-16384,11,-409,1,-16384,12,-612,1,-16384,8,-621,1,-16384,4,-474,1,
+	-16384,1,-422,1,-473,1,-16384,11,-477,1,-478,1,-16384,4,-494,1,
+	-495,1,-16384,2,-496,1,-497,1,-16384,3,-423,1,-424,1,-16384,1,
+	-427,1,-428,1,-16384,3,-425,1,-426,1,-16384,1,-429,1,-430,1,
+	-421,1,-16384,12,-407,1,-408,1,-16384,5,-476,1,-16384,7,-499,1,
+	-16384,5,-475,1,-486,1,-16384,5,-487,1,-488,1,-472,1,-60,1,
+	-16384,2,-66,1,-16384,13,-570,1,-16384,2,-404,1,-566,1,-16384,2,
+	-567,1,-568,1,-16384,11,-416,1,-16384,14,-624,1,-573,1,-559,1,
+	-16384,1,-571,1,-16384,3,-574,1,-16384,1,-576,1,-16384,3,-575,1,
+	-16384,1,-577,1,-572,1,-16384,12,-415,1,-16384,14,-578,1,-580,1,
+	-16384,10,-579,1,-581,1,-16384,14,-562,1,-564,1,-16384,10,-563,1,
+	-565,1,-16384,5,-561,1,-16384,8,-560,1,-569,1,-558,1,-16384,15,
+	-323,1,-16384,12,-367,1,-365,1,-16384,9,-394,1,-395,1,-16384,2,
+	-392,1,-393,1,-16384,3,-366,1,-364,1,-16384,4,-366,1,-367,1,
+	-16384,2,-364,1,-365,1,-16384,3,-315,1,-16384,2,-126,1,-16384,2,
+	-131,1,-133,1,-132,1,-324,1,-16384,2,-325,1,-326,1,-16384,3,
+	-327,1,-328,1,-16384,3,-319,1,-320,1,-16384,12,-379,1,-16384,2,
+	-379,1,-16384,4,-313,1,-322,1,-272,1,-16384,1,-316,1,-16384,4,
+	-273,1,-274,1,-16384,1,-112,1,-16384,4,-119,1,-120,1,-16384,2,
+	-123,1,-124,1,-16384,2,-121,1,-122,1,-16384,1,-277,1,-278,1,
+	-16384,3,-275,1,-276,1,-16384,1,-279,1,-280,1,-271,1,-16384,15,
+	-363,1,-16384,3,-362,1,-16384,3,-362,1,-363,1,-16384,1,-384,1,
+	-16384,2,-386,1,-16384,2,-385,1,-270,1,-16384,3,-317,1,-318,1,
+	-16384,3,-312,1,-16384,2,-256,1,-311,1,-16384,14,-199,1,-16384,2,
+	-202,1,-204,1,-203,1,-16384,16,-237,1,-16384,3,-244,1,-16384,3,
+	-216,1,-16384,2,-230,1,-16384,7,-251,1,-16384,4,-223,1,-16384,2,
+	-209,1,-16384,11,-239,1,-16384,3,-246,1,-16384,3,-218,1,-16384,2,
+	-232,1,-16384,7,-253,1,-16384,4,-225,1,-16384,2,-211,1,-16384,11,
+	-238,1,-16384,3,-245,1,-16384,3,-217,1,-16384,2,-231,1,-16384,7,
+	-252,1,-16384,4,-224,1,-16384,2,-210,1,-16384,7,-234,1,-16384,1,
+	-241,1,-16384,1,-213,1,-227,1,-16384,5,-248,1,-16384,2,-220,1,
+	-206,1,-16384,2,-192,1,-16384,4,-195,1,-16384,2,-197,1,-16384,2,
+	-196,1,-321,1,-314,1,-59,1,-16384,2,-65,1,-16384,34,-609,1,
+	-16384,4,-608,1,-16384,4,-604,1,-605,1,-16384,3,-547,1,-16384,2,
+	-403,1,-543,1,-16384,2,-544,1,-545,1,-16384,11,-414,1,-16384,26,
+	-616,1,-16384,4,-615,1,-16384,4,-613,1,-614,1,-16384,8,-623,1,
+	-16384,19,-631,1,-442,1,-536,1,-16384,3,-548,1,-16384,2,-549,1,
+	-550,1,-16384,2,-551,1,-552,1,-16384,3,-443,1,-444,1,-16384,1,
+	-447,1,-448,1,-16384,3,-445,1,-446,1,-16384,1,-449,1,-450,1,
+	-441,1,-16384,13,-413,1,-16384,14,-554,1,-556,1,-16384,10,-555,1,
+	-557,1,-16384,14,-539,1,-541,1,-16384,10,-540,1,-542,1,-16384,18,
+	-502,1,-503,1,-16384,9,-553,1,-16384,5,-538,1,-16384,8,-537,1,
+	-546,1,-535,1,-16384,16,-305,1,-16384,7,-357,1,-16384,2,-357,1,
+	-16384,12,-361,1,-359,1,-16384,9,-390,1,-391,1,-16384,2,-388,1,
+	-389,1,-16384,3,-360,1,-358,1,-16384,4,-360,1,-361,1,-16384,2,
+	-358,1,-359,1,-16384,3,-297,1,-16384,2,-125,1,-16384,1,-129,1,
+	-130,1,-306,1,-16384,2,-307,1,-308,1,-16384,3,-309,1,-310,1,
+	-16384,3,-301,1,-302,1,-16384,12,-378,1,-16384,2,-378,1,-16384,4,
+	-295,1,-304,1,-261,1,-16384,1,-298,1,-16384,4,-262,1,-263,1,
+	-16384,1,-111,1,-16384,3,-115,1,-116,1,-16384,2,-117,1,-118,1,
+	-16384,1,-266,1,-267,1,-16384,3,-264,1,-265,1,-16384,1,-268,1,
+	-269,1,-260,1,-16384,8,-382,1,-16384,2,-383,1,-259,1,-16384,3,
+	-299,1,-300,1,-16384,3,-294,1,-16384,2,-255,1,-293,1,-16384,14,
+	-198,1,-16384,1,-200,1,-201,1,-16384,15,-235,1,-16384,3,-242,1,
+	-16384,3,-214,1,-16384,2,-228,1,-16384,7,-249,1,-16384,4,-221,1,
+	-16384,2,-207,1,-16384,11,-236,1,-16384,3,-243,1,-16384,3,-215,1,
+	-16384,2,-229,1,-16384,7,-250,1,-16384,4,-222,1,-16384,2,-208,1,
+	-16384,7,-233,1,-16384,1,-240,1,-16384,1,-212,1,-226,1,-16384,5,
+	-247,1,-16384,2,-219,1,-205,1,-16384,2,-191,1,-16384,3,-193,1,
+	-16384,2,-194,1,-303,1,-296,1,-16384,2,-64,1,-16384,14,-521,1,
+	-16384,5,-522,1,-523,1,-16384,2,-402,1,-515,1,-16384,2,-516,1,
+	-517,1,-16384,11,-412,1,-16384,15,-629,1,-16384,8,-622,1,-16384,15,
+	-630,1,-16384,11,-506,1,-16384,1,-432,1,-505,1,-16384,11,-509,1,
+	-510,1,-16384,3,-525,1,-16384,2,-526,1,-527,1,-16384,2,-528,1,
+	-529,1,-16384,3,-433,1,-434,1,-16384,1,-437,1,-438,1,-16384,3,
+	-435,1,-436,1,-16384,1,-439,1,-440,1,-431,1,-16384,15,-410,1,
+	-411,1,-16384,14,-531,1,-533,1,-16384,10,-532,1,-534,1,-16384,14,
+	-511,1,-513,1,-16384,10,-512,1,-514,1,-16384,18,-500,1,-501,1,
+	-16384,5,-508,1,-16384,7,-530,1,-16384,5,-507,1,-518,1,-16384,5,
+	-519,1,-520,1,-504,1,-16384,5,-32,1,-16384,4,-101,1,-16384,1,
+	-100,1,-52,1,-16384,6,-97,1,-16384,4,-100,1,-16384,4,-20,1,
+	-16384,2,-70,1,-62,1,-16384,2,-68,1,-16384,17,-498,1,-16384,3,
+	-597,1,-16384,1,-595,1,-16384,2,-406,1,-16384,11,-420,1,-16384,10,
+	-620,1,-16384,2,-627,1,-16384,1,-628,1,-619,1,-16384,16,-471,1,
+	-16384,2,-602,1,-603,1,-458,1,-16384,1,-594,1,-16384,3,-524,1,
+	-16384,3,-598,1,-600,1,-601,1,-461,1,-459,1,-462,1,-460,1,
+	-16384,3,-493,1,-457,1,-16384,10,-419,1,-16384,1,-599,1,-16384,18,
+	-610,1,-611,1,-16384,1,-492,1,-16384,2,-596,1,-593,1,-16384,16,
+	-347,1,-16384,3,-351,1,-16384,2,-128,1,-16384,1,-349,1,-16384,14,
+	-381,1,-16384,2,-381,1,-16384,10,-377,1,-16384,2,-377,1,-288,1,
+	-16384,1,-344,1,-16384,3,-348,1,-16384,3,-352,1,-354,1,-355,1,
+	-291,1,-16384,1,-289,1,-16384,1,-114,1,-292,1,-290,1,-16384,3,
+	-346,1,-287,1,-16384,1,-353,1,-16384,8,-356,1,-16384,13,-376,1,
+	-374,1,-16384,4,-375,1,-373,1,-16384,4,-375,1,-376,1,-16384,2,
+	-373,1,-374,1,-258,1,-16384,1,-345,1,-16384,2,-350,1,-343,1,
+	-61,1,-16384,2,-67,1,-16384,17,-481,1,-16384,3,-586,1,-16384,1,
+	-584,1,-16384,2,-405,1,-16384,11,-418,1,-16384,10,-618,1,-16384,2,
+	-625,1,-16384,1,-626,1,-617,1,-16384,3,-591,1,-592,1,-452,1,
+	-16384,1,-583,1,-16384,3,-482,1,-16384,3,-587,1,-589,1,-590,1,
+	-455,1,-453,1,-456,1,-454,1,-16384,3,-480,1,-451,1,-16384,10,
+	-417,1,-16384,2,-588,1,-16384,14,-470,1,-16384,14,-606,1,-607,1,
+	-16384,1,-479,1,-16384,2,-585,1,-582,1,-16384,15,-333,1,-16384,3,
+	-337,1,-16384,2,-127,1,-16384,1,-335,1,-16384,14,-380,1,-16384,2,
+	-380,1,-282,1,-16384,1,-330,1,-16384,3,-334,1,-16384,3,-338,1,
+	-340,1,-341,1,-285,1,-16384,1,-283,1,-16384,1,-113,1,-286,1,
+	-284,1,-16384,3,-332,1,-281,1,-16384,2,-339,1,-16384,8,-372,1,
+	-16384,2,-372,1,-16384,8,-342,1,-16384,13,-371,1,-369,1,-16384,4,
+	-370,1,-368,1,-16384,4,-370,1,-371,1,-16384,2,-368,1,-369,1,
+	-257,1,-16384,1,-331,1,-16384,2,-336,1,-329,1,-16384,9,-71,1,
+	-16384,2,-69,1,-16384,2,-23,1,-16384,10,-77,1,-637,1,-16384,2,
+	-636,1,-27,1,-16384,4,-397,1,-16384,3,-50,1,-16384,4,-96,1,
+	-16384,4,-72,1,-16384,1,-26,1,-16384,6,-81,1,-16384,3,-396,1,
+	-16384,15,-78,1,-16384,1,-82,1,-16384,3,-639,1,-16384,3,-640,1,
+	-94,1,-16384,8,-83,1,-16384,7,-95,1,-16384,11,-87,1,-16384,3,
+	-90,1,-16384,6,-92,1,-91,1,-16384,2,-633,1,-16384,3,-75,1,
+	-16384,7,-47,1,-16384,2,-80,1,-16384,14,-632,1,-16384,19,-44,1,
+	-16384,3,-41,1,-16384,3,-42,1,-16384,4,-33,1,-16384,6,-40,1,
+	-16384,11,-35,1,-16384,6,-39,1,-16384,2,-37,1,-16384,12,-34,1,
+	-16384,6,-38,1,-16384,2,-36,1,-16384,7,-45,1,-16384,5,-43,1,
+	-16384,8,-46,1,-16384,4,-70,1,-16384,2,-53,1,-16384,2,-79,1,
+	-5,1,-16384,2,-6,1,-16384,1,-5,1,-16384,1,-5,2,-16384,2,
+	-5,1,-16384,1,-5,1,-16384,1,-5,2,-16384,1,-8,1,-7,1,
+	-16384,2,-8,1,-16384,1,-7,1,-16384,1,-7,2,-16384,2,-7,1,
+	-16384,1,-7,1,-16384,1,-7,2,-6,2,-16384,3,-9,1,-16384,3,
+	-6,1,-16384,1,-8,1,-16384,1,-8,1,-14,1,-16384,1,-15,1,
+	-16384,5,-14,1,-13,1,-16384,9,-6,2,-16384,2,-86,1,-16384,19,
+	-49,1,-16384,27,-176,1,-177,1,-178,1,-16384,16,-164,1,-165,1,
+	-166,1,-16384,23,-185,1,-186,1,-187,1,-16384,16,-173,1,-174,1,
+	-175,1,-16384,23,-182,1,-183,1,-184,1,-16384,16,-170,1,-171,1,
+	-172,1,-16384,24,-179,1,-180,1,-181,1,-16384,16,-167,1,-168,1,
+	-169,1,-76,1,-16384,10,-467,1,-16384,3,-153,1,-16384,8,-158,1,
+	-16384,5,-161,1,-16384,5,-160,1,-16384,5,-159,1,-466,1,-16384,1,
+	-463,1,-16384,2,-142,1,-16384,8,-143,1,-144,1,-16384,5,-149,1,
+	-16384,2,-154,1,-16384,7,-163,1,-16384,3,-152,1,-16384,2,-157,1,
+	-16384,5,-147,1,-148,1,-16384,5,-162,1,-16384,3,-151,1,-16384,2,
+	-156,1,-16384,5,-145,1,-146,1,-16384,5,-150,1,-16384,2,-155,1,
+	-16384,3,-398,1,-16384,7,-468,1,-16384,1,-464,1,-16384,5,-469,1,
+	-16384,2,-465,1,-16384,9,-89,1,-16384,6,-21,1,-638,1,-16384,4,
+	-106,1,-16384,1,-48,1,-56,1,-16384,6,-99,1,-16384,2,-22,1,
+	-16384,9,-141,1,-103,1,-16384,2,-139,1,-16384,3,-104,1,-102,1,
+	-16384,2,-105,1,-16384,2,-140,1,-16384,5,-28,1,-16384,3,-73,1,
+	-16384,8,-98,1,-16384,4,-101,1,-16384,2,-110,1,-16384,8,-93,1,
+	-16384,2,-107,1,-16384,2,-30,1,-16384,4,-57,1,-16384,7,-108,1,
+	-16384,5,-109,1,-16384,2,-387,1,-16384,4,-88,1,-16384,3,-74,1,
+	-16384,3,-29,1,-16384,4,-54,1,-16384,2,-254,1,-9,1,-16384,11,
+	-11,1,-16384,8,-12,1,-16384,1,-9,1,-16384,1,-9,1,-16384,3,
+	-58,1,-16384,3,-19,1,-16384,3,-25,1,-16384,9,-134,1,-16384,2,
+	-136,1,-16384,2,-135,1,-16384,2,-138,1,-16384,2,-137,1,-16384,13,
+	-190,1,-189,1,-16384,4,-188,1,-16384,3,-634,1,-16384,1,-31,1,
+	-16384,5,-99,1,-16384,1,-98,1,-16384,1,-97,1,-16384,4,-635,1,
+	-16384,4,-55,1,-10,1,-16384,4,-51,1,-16384,5,-84,1,-16384,19,
+	-85,1,-16384,3,-24,1,-16384,2,-63,1,-16384,19,-400,1,-489,1,
+	-16384,5,-490,1,-491,1,-16384,2,-401,1,-483,1,-16384,5,-399,1,
+	-16384,1,-484,1,-485,1,-16384,11,-409,1,-16384,12,-612,1,-16384,8,
+	-621,1,-16384,4,-474,1,-16384,1,-422,1,-473,1,-16384,11,-477,1,
+	-478,1,-16384,4,-494,1,-495,1,-16384,2,-496,1,-497,1,-16384,3,
+	-423,1,-424,1,-16384,1,-427,1,-428,1,-16384,3,-425,1,-426,1,
+	-16384,1,-429,1,-430,1,-421,1,-16384,12,-407,1,-408,1,-16384,5,
+	-476,1,-16384,7,-499,1,-16384,5,-475,1,-486,1,-16384,5,-487,1,
+	-488,1,-472,1,-60,1,-16384,2,-66,1,-16384,13,-570,1,-16384,2,
+	-404,1,-566,1,-16384,2,-567,1,-568,1,-16384,11,-416,1,-16384,14,
+	-624,1,-573,1,-559,1,-16384,1,-571,1,-16384,3,-574,1,-16384,1,
+	-576,1,-16384,3,-575,1,-16384,1,-577,1,-572,1,-16384,12,-415,1,
+	-16384,14,-578,1,-580,1,-16384,10,-579,1,-581,1,-16384,14,-562,1,
+	-564,1,-16384,10,-563,1,-565,1,-16384,5,-561,1,-16384,8,-560,1,
+	-569,1,-558,1,-16384,15,-323,1,-16384,12,-367,1,-365,1,-16384,9,
+	-394,1,-395,1,-16384,2,-392,1,-393,1,-16384,3,-366,1,-364,1,
+	-16384,4,-366,1,-367,1,-16384,2,-364,1,-365,1,-16384,3,-315,1,
+	-16384,2,-126,1,-16384,2,-131,1,-133,1,-132,1,-324,1,-16384,2,
+	-325,1,-326,1,-16384,3,-327,1,-328,1,-16384,3,-319,1,-320,1,
+	-16384,12,-379,1,-16384,2,-379,1,-16384,4,-313,1,-322,1,-272,1,
+	-16384,1,-316,1,-16384,4,-273,1,-274,1,-16384,1,-112,1,-16384,4,
+	-119,1,-120,1,-16384,2,-123,1,-124,1,-16384,2,-121,1,-122,1,
+	-16384,1,-277,1,-278,1,-16384,3,-275,1,-276,1,-16384,1,-279,1,
+	-280,1,-271,1,-16384,15,-363,1,-16384,3,-362,1,-16384,3,-362,1,
+	-363,1,-16384,1,-384,1,-16384,2,-386,1,-16384,2,-385,1,-270,1,
+	-16384,3,-317,1,-318,1,-16384,3,-312,1,-16384,2,-256,1,-311,1,
+	-16384,14,-199,1,-16384,2,-202,1,-204,1,-203,1,-16384,16,-237,1,
+	-16384,3,-244,1,-16384,3,-216,1,-16384,2,-230,1,-16384,7,-251,1,
+	-16384,4,-223,1,-16384,2,-209,1,-16384,11,-239,1,-16384,3,-246,1,
+	-16384,3,-218,1,-16384,2,-232,1,-16384,7,-253,1,-16384,4,-225,1,
+	-16384,2,-211,1,-16384,11,-238,1,-16384,3,-245,1,-16384,3,-217,1,
+	-16384,2,-231,1,-16384,7,-252,1,-16384,4,-224,1,-16384,2,-210,1,
+	-16384,7,-234,1,-16384,1,-241,1,-16384,1,-213,1,-227,1,-16384,5,
+	-248,1,-16384,2,-220,1,-206,1,-16384,2,-192,1,-16384,4,-195,1,
+	-16384,2,-197,1,-16384,2,-196,1,-321,1,-314,1,-59,1,-16384,2,
+	-65,1,-16384,34,-609,1,-16384,4,-608,1,-16384,4,-604,1,-605,1,
+	-16384,3,-547,1,-16384,2,-403,1,-543,1,-16384,2,-544,1,-545,1,
+	-16384,11,-414,1,-16384,26,-616,1,-16384,4,-615,1,-16384,4,-613,1,
+	-614,1,-16384,8,-623,1,-16384,19,-631,1,-442,1,-536,1,-16384,3,
+	-548,1,-16384,2,-549,1,-550,1,-16384,2,-551,1,-552,1,-16384,3,
+	-443,1,-444,1,-16384,1,-447,1,-448,1,-16384,3,-445,1,-446,1,
+	-16384,1,-449,1,-450,1,-441,1,-16384,13,-413,1,-16384,14,-554,1,
+	-556,1,-16384,10,-555,1,-557,1,-16384,14,-539,1,-541,1,-16384,10,
+	-540,1,-542,1,-16384,18,-502,1,-503,1,-16384,9,-553,1,-16384,5,
+	-538,1,-16384,8,-537,1,-546,1,-535,1,-16384,16,-305,1,-16384,7,
+	-357,1,-16384,2,-357,1,-16384,12,-361,1,-359,1,-16384,9,-390,1,
+	-391,1,-16384,2,-388,1,-389,1,-16384,3,-360,1,-358,1,-16384,4,
+	-360,1,-361,1,-16384,2,-358,1,-359,1,-16384,3,-297,1,-16384,2,
+	-125,1,-16384,1,-129,1,-130,1,-306,1,-16384,2,-307,1,-308,1,
+	-16384,3,-309,1,-310,1,-16384,3,-301,1,-302,1,-16384,12,-378,1,
+	-16384,2,-378,1,-16384,4,-295,1,-304,1,-261,1,-16384,1,-298,1,
+	-16384,4,-262,1,-263,1,-16384,1,-111,1,-16384,3,-115,1,-116,1,
+	-16384,2,-117,1,-118,1,-16384,1,-266,1,-267,1,-16384,3,-264,1,
+	-265,1,-16384,1,-268,1,-269,1,-260,1,-16384,8,-382,1,-16384,2,
+	-383,1,-259,1,-16384,3,-299,1,-300,1,-16384,3,-294,1,-16384,2,
+	-255,1,-293,1,-16384,14,-198,1,-16384,1,-200,1,-201,1,-16384,15,
+	-235,1,-16384,3,-242,1,-16384,3,-214,1,-16384,2,-228,1,-16384,7,
+	-249,1,-16384,4,-221,1,-16384,2,-207,1,-16384,11,-236,1,-16384,3,
+	-243,1,-16384,3,-215,1,-16384,2,-229,1,-16384,7,-250,1,-16384,4,
+	-222,1,-16384,2,-208,1,-16384,7,-233,1,-16384,1,-240,1,-16384,1,
+	-212,1,-226,1,-16384,5,-247,1,-16384,2,-219,1,-205,1,-16384,2,
+	-191,1,-16384,3,-193,1,-16384,2,-194,1,-303,1,-296,1,-16384,2,
+	-64,1,-16384,14,-521,1,-16384,5,-522,1,-523,1,-16384,2,-402,1,
+	-515,1,-16384,2,-516,1,-517,1,-16384,11,-412,1,-16384,15,-629,1,
+	-16384,8,-622,1,-16384,15,-630,1,-16384,11,-506,1,-16384,1,-432,1,
+	-505,1,-16384,11,-509,1,-510,1,-16384,3,-525,1,-16384,2,-526,1,
+	-527,1,-16384,2,-528,1,-529,1,-16384,3,-433,1,-434,1,-16384,1,
+	-437,1,-438,1,-16384,3,-435,1,-436,1,-16384,1,-439,1,-440,1,
+	-431,1,-16384,15,-410,1,-411,1,-16384,14,-531,1,-533,1,-16384,10,
+	-532,1,-534,1,-16384,14,-511,1,-513,1,-16384,10,-512,1,-514,1,
+	-16384,18,-500,1,-501,1,-16384,5,-508,1,-16384,7,-530,1,-16384,5,
+	-507,1,-518,1,-16384,5,-519,1,-520,1,-504,1,-16384,5,-32,1,
+	-16384,4,-101,1,-16384,1,-100,1,-52,1,-16384,6,-97,1,-16384,4,
+	-100,1,-16384,4,-20,1,-16384,2,-70,1,-62,1,-16384,2,-68,1,
+	-16384,17,-498,1,-16384,3,-597,1,-16384,1,-595,1,-16384,2,-406,1,
+	-16384,11,-420,1,-16384,10,-620,1,-16384,2,-627,1,-16384,1,-628,1,
+	-619,1,-16384,16,-471,1,-16384,2,-602,1,-603,1,-458,1,-16384,1,
+	-594,1,-16384,3,-524,1,-16384,3,-598,1,-600,1,-601,1,-461,1,
+	-459,1,-462,1,-460,1,-16384,3,-493,1,-457,1,-16384,10,-419,1,
+	-16384,1,-599,1,-16384,18,-610,1,-611,1,-16384,1,-492,1,-16384,2,
+	-596,1,-593,1,-16384,16,-347,1,-16384,3,-351,1,-16384,2,-128,1,
+	-16384,1,-349,1,-16384,14,-381,1,-16384,2,-381,1,-16384,10,-377,1,
+	-16384,2,-377,1,-288,1,-16384,1,-344,1,-16384,3,-348,1,-16384,3,
+	-352,1,-354,1,-355,1,-291,1,-16384,1,-289,1,-16384,1,-114,1,
+	-292,1,-290,1,-16384,3,-346,1,-287,1,-16384,1,-353,1,-16384,8,
+	-356,1,-16384,13,-376,1,-374,1,-16384,4,-375,1,-373,1,-16384,4,
+	-375,1,-376,1,-16384,2,-373,1,-374,1,-258,1,-16384,1,-345,1,
+	-16384,2,-350,1,-343,1,-61,1,-16384,2,-67,1,-16384,17,-481,1,
+	-16384,3,-586,1,-16384,1,-584,1,-16384,2,-405,1,-16384,11,-418,1,
+	-16384,10,-618,1,-16384,2,-625,1,-16384,1,-626,1,-617,1,-16384,3,
+	-591,1,-592,1,-452,1,-16384,1,-583,1,-16384,3,-482,1,-16384,3,
+	-587,1,-589,1,-590,1,-455,1,-453,1,-456,1,-454,1,-16384,3,
+	-480,1,-451,1,-16384,10,-417,1,-16384,2,-588,1,-16384,14,-470,1,
+	-16384,14,-606,1,-607,1,-16384,1,-479,1,-16384,2,-585,1,-582,1,
+	-16384,15,-333,1,-16384,3,-337,1,-16384,2,-127,1,-16384,1,-335,1,
+	-16384,14,-380,1,-16384,2,-380,1,-282,1,-16384,1,-330,1,-16384,3,
+	-334,1,-16384,3,-338,1,-340,1,-341,1,-285,1,-16384,1,-283,1,
+	-16384,1,-113,1,-286,1,-284,1,-16384,3,-332,1,-281,1,-16384,2,
+	-339,1,-16384,8,-372,1,-16384,2,-372,1,-16384,8,-342,1,-16384,13,
+	-371,1,-369,1,-16384,4,-370,1,-368,1,-16384,4,-370,1,-371,1,
+	-16384,2,-368,1,-369,1,-257,1,-16384,1,-331,1,-16384,2,-336,1,
+	-329,1,-16384,9,-71,1,-16384,2,-69,1,-16384,2,-23,1,-16384,10,
+	-77,1,-637,1,-16384,2,-636,1,-27,1,-16384,4,-397,1,-16384,3,
+	-50,1,-16384,4,-96,1,-16384,4,-72,1,-16384,1,-26,1,-16384,6,
+	-81,1,-16384,3,-396,1,-16384,15,-78,1,-16384,1,-82,1,-16384,3,
+	-639,1,-16384,3,-640,1,-94,1,-16384,8,-83,1,-16384,7,-95,1,
+	-16384,11,-87,1,-16384,3,-90,1,-16384,6,-92,1,-91,1,-16384,2,
+	-633,1,-16384,3,-75,1,-16384,7,-47,1,-16384,2,-80,1,-16384,14,
+	-632,1,-16384,19,-44,1,-16384,3,-41,1,-16384,3,-42,1,-16384,4,
+	-33,1,-16384,6,-40,1,-16384,11,-35,1,-16384,6,-39,1,-16384,2,
+	-37,1,-16384,12,-34,1,-16384,6,-38,1,-16384,2,-36,1,-16384,7,
+	-45,1,-16384,5,-43,1,-16384,8,-46,1,-16384,4,-70,1,-16384,2,
+	-53,1,-16384,2,-79,1,-5,1,-16384,2,-6,1,-16384,1,-5,1,
+	-16384,1,-5,2,-16384,2,-5,1,-16384,1,-5,1,-16384,1,-5,2,
+	-16384,1,-8,1,-7,1,-16384,2,-8,1,-16384,1,-7,1,-16384,1,
+	-7,2,-16384,2,-7,1,-16384,1,-7,1,-16384,1,-7,2,-6,2,
+	-16384,3,-9,1,-16384,3,-6,1,-16384,1,-8,1,-16384,1,-8,1,
+	-14,1,-16384,1,-15,1,3120,1,-16384,4,-14,1,-13,1,1,1,
+	-16384,5,1,1,-16384,3118,3120,1,-16384,1,3120,1,-16384,4,-14,1,
+	-16384,1,1,1,-16384,5,1,1,-16384,3118,3120,1,-16384,1,3120,1,
+	-16384,3,3120,1,-14,1,-16384,1,1,1,-16384,3,1,1,-16384,1,
+	1,1,-16384,3118,3120,1,-16384,1,3120,1,-16384,1,3125,1,-16384,2,
+	-14,1,-16384,1,1,1,-16384,1,3132,1,-16384,3,1,1,-16384,2,
+	-6,2,-16384,2,-86,1,-16384,19,-49,1,-16384,27,-176,1,-177,1,
+	-178,1,-16384,16,-164,1,-165,1,-166,1,-16384,23,-185,1,-186,1,
+	-187,1,-16384,16,-173,1,-174,1,-175,1,-16384,23,-182,1,-183,1,
+	-184,1,-16384,16,-170,1,-171,1,-172,1,-16384,24,-179,1,-180,1,
+	-181,1,-16384,16,-167,1,-168,1,-169,1,-76,1,-16384,10,-467,1,
+	-16384,3,-153,1,-16384,8,-158,1,-16384,5,-161,1,-16384,5,-160,1,
+	-16384,5,-159,1,-466,1,-16384,1,-463,1,-16384,2,-142,1,-16384,8,
+	-143,1,-144,1,-16384,5,-149,1,-16384,2,-154,1,-16384,7,-163,1,
+	-16384,3,-152,1,-16384,2,-157,1,-16384,5,-147,1,-148,1,-16384,5,
+	-162,1,-16384,3,-151,1,-16384,2,-156,1,-16384,5,-145,1,-146,1,
+	-16384,5,-150,1,-16384,2,-155,1,-16384,3,-398,1,-16384,7,-468,1,
+	-16384,1,-464,1,-16384,5,-469,1,-16384,2,-465,1,-16384,9,-89,1,
+	-16384,6,-21,1,-638,1,-16384,4,-106,1,-16384,1,-48,1,-56,1,
+	-16384,6,-99,1,-16384,2,-22,1,-16384,9,-141,1,-103,1,-16384,2,
+	-139,1,-16384,3,-104,1,-102,1,-16384,2,-105,1,-16384,2,-140,1,
+	-16384,5,-28,1,-16384,3,-73,1,-16384,8,-98,1,-16384,4,-101,1,
+	-16384,2,-110,1,-16384,8,-93,1,-16384,2,-107,1,-16384,2,-30,1,
+	-16384,4,-57,1,-16384,7,-108,1,-16384,5,-109,1,-16384,2,-387,1,
+	-16384,4,-88,1,-16384,3,-74,1,-16384,3,-29,1,-16384,4,-54,1,
+	-16384,2,-254,1,-9,1,-16384,11,-11,1,-16384,8,-12,1,-16384,1,
+	-9,1,-16384,1,-9,1,-16384,3,-58,1,-16384,3,-19,1,-16384,3,
+	-25,1,-16384,9,-134,1,-16384,2,-136,1,-16384,2,-135,1,-16384,2,
+	-138,1,-16384,2,-137,1,-16384,13,-190,1,-189,1,-16384,4,-188,1,
+	-16384,3,-634,1,-16384,1,-31,1,-16384,5,-99,1,-16384,1,-98,1,
+	-16384,1,-97,1,-16384,4,-635,1,-16384,4,-55,1,-10,1,-16384,4,
+	-51,1,-16384,5,-84,1,-16384,19,-85,1,-16384,3,-24,1,-16384,2,
+	-63,1,-16384,19,-400,1,-489,1,-16384,5,-490,1,-491,1,-16384,2,
+	-401,1,-483,1,-16384,5,-399,1,-16384,1,-484,1,-485,1,-16384,11,
+	-409,1,-16384,12,-612,1,-16384,8,-621,1,-16384,4,-474,1,-16384,1,
+	-422,1,-473,1,-16384,11,-477,1,-478,1,-16384,4,-494,1,-495,1,
+	-16384,2,-496,1,-497,1,-16384,3,-423,1,-424,1,-16384,1,-427,1,
+	-428,1,-16384,3,-425,1,-426,1,-16384,1,-429,1,-430,1,-421,1,
+	-16384,12,-407,1,-408,1,-16384,5,-476,1,-16384,7,-499,1,-16384,5,
+	-475,1,-486,1,-16384,5,-487,1,-488,1,-472,1,-60,1,-16384,2,
+	-66,1,-16384,13,-570,1,-16384,2,-404,1,-566,1,-16384,2,-567,1,
+	-568,1,-16384,11,-416,1,-16384,14,-624,1,-573,1,-559,1,-16384,1,
+	-571,1,-16384,3,-574,1,-16384,1,-576,1,-16384,3,-575,1,-16384,1,
+	-577,1,-572,1,-16384,12,-415,1,-16384,14,-578,1,-580,1,-16384,10,
+	-579,1,-581,1,-16384,14,-562,1,-564,1,-16384,10,-563,1,-565,1,
+	-16384,5,-561,1,-16384,8,-560,1,-569,1,-558,1,-16384,15,-323,1,
+	-16384,12,-367,1,-365,1,-16384,9,-394,1,-395,1,-16384,2,-392,1,
+	-393,1,-16384,3,-366,1,-364,1,-16384,4,-366,1,-367,1,-16384,2,
+	-364,1,-365,1,-16384,3,-315,1,-16384,2,-126,1,-16384,2,-131,1,
+	-133,1,-132,1,-324,1,-16384,2,-325,1,-326,1,-16384,3,-327,1,
+	-328,1,-16384,3,-319,1,-320,1,-16384,12,-379,1,-16384,2,-379,1,
+	-16384,4,-313,1,-322,1,-272,1,-16384,1,-316,1,-16384,4,-273,1,
+	-274,1,-16384,1,-112,1,-16384,4,-119,1,-120,1,-16384,2,-123,1,
+	-124,1,-16384,2,-121,1,-122,1,-16384,1,-277,1,-278,1,-16384,3,
+	-275,1,-276,1,-16384,1,-279,1,-280,1,-271,1,-16384,15,-363,1,
+	-16384,3,-362,1,-16384,3,-362,1,-363,1,-16384,1,-384,1,-16384,2,
+	-386,1,-16384,2,-385,1,-270,1,-16384,3,-317,1,-318,1,-16384,3,
+	-312,1,-16384,2,-256,1,-311,1,-16384,14,-199,1,-16384,2,-202,1,
+	-204,1,-203,1,-16384,16,-237,1,-16384,3,-244,1,-16384,3,-216,1,
+	-16384,2,-230,1,-16384,7,-251,1,-16384,4,-223,1,-16384,2,-209,1,
+	-16384,11,-239,1,-16384,3,-246,1,-16384,3,-218,1,-16384,2,-232,1,
+	-16384,7,-253,1,-16384,4,-225,1,-16384,2,-211,1,-16384,11,-238,1,
+	-16384,3,-245,1,-16384,3,-217,1,-16384,2,-231,1,-16384,7,-252,1,
+	-16384,4,-224,1,-16384,2,-210,1,-16384,7,-234,1,-16384,1,-241,1,
+	-16384,1,-213,1,-227,1,-16384,5,-248,1,-16384,2,-220,1,-206,1,
+	-16384,2,-192,1,-16384,4,-195,1,-16384,2,-197,1,-16384,2,-196,1,
+	-321,1,-314,1,-59,1,-16384,2,-65,1,-16384,34,-609,1,-16384,4,
+	-608,1,-16384,4,-604,1,-605,1,-16384,3,-547,1,-16384,2,-403,1,
+	-543,1,-16384,2,-544,1,-545,1,-16384,11,-414,1,-16384,26,-616,1,
+	-16384,4,-615,1,-16384,4,-613,1,-614,1,-16384,8,-623,1,-16384,19,
+	-631,1,-442,1,-536,1,-16384,3,-548,1,-16384,2,-549,1,-550,1,
+	-16384,2,-551,1,-552,1,-16384,3,-443,1,-444,1,-16384,1,-447,1,
+	-448,1,-16384,3,-445,1,-446,1,-16384,1,-449,1,-450,1,-441,1,
+	-16384,13,-413,1,-16384,14,-554,1,-556,1,-16384,10,-555,1,-557,1,
+	-16384,14,-539,1,-541,1,-16384,10,-540,1,-542,1,-16384,18,-502,1,
+	-503,1,-16384,9,-553,1,-16384,5,-538,1,-16384,8,-537,1,-546,1,
+	-535,1,-16384,16,-305,1,-16384,7,-357,1,-16384,2,-357,1,-16384,12,
+	-361,1,-359,1,-16384,9,-390,1,-391,1,-16384,2,-388,1,-389,1,
+	-16384,3,-360,1,-358,1,-16384,4,-360,1,-361,1,-16384,2,-358,1,
+	-359,1,-16384,3,-297,1,-16384,2,-125,1,-16384,1,-129,1,-130,1,
+	-306,1,-16384,2,-307,1,-308,1,-16384,3,-309,1,-310,1,-16384,3,
+	-301,1,-302,1,-16384,12,-378,1,-16384,2,-378,1,-16384,4,-295,1,
+	-304,1,-261,1,-16384,1,-298,1,-16384,4,-262,1,-263,1,-16384,1,
+	-111,1,-16384,3,-115,1,-116,1,-16384,2,-117,1,-118,1,-16384,1,
+	-266,1,-267,1,-16384,3,-264,1,-265,1,-16384,1,-268,1,-269,1,
+	-260,1,-16384,8,-382,1,-16384,2,-383,1,-259,1,-16384,3,-299,1,
+	-300,1,-16384,3,-294,1,-16384,2,-255,1,-293,1,-16384,14,-198,1,
+	-16384,1,-200,1,-201,1,-16384,15,-235,1,-16384,3,-242,1,-16384,3,
+	-214,1,-16384,2,-228,1,-16384,7,-249,1,-16384,4,-221,1,-16384,2,
+	-207,1,-16384,11,-236,1,-16384,3,-243,1,-16384,3,-215,1,-16384,2,
+	-229,1,-16384,7,-250,1,-16384,4,-222,1,-16384,2,-208,1,-16384,7,
+	-233,1,-16384,1,-240,1,-16384,1,-212,1,-226,1,-16384,5,-247,1,
+	-16384,2,-219,1,-205,1,-16384,2,-191,1,-16384,3,-193,1,-16384,2,
+	-194,1,-303,1,-296,1,-16384,2,-64,1,-16384,14,-521,1,-16384,5,
+	-522,1,-523,1,-16384,2,-402,1,-515,1,-16384,2,-516,1,-517,1,
+	-16384,11,-412,1,-16384,15,-629,1,-16384,8,-622,1,-16384,15,-630,1,
+	-16384,11,-506,1,-16384,1,-432,1,-505,1,-16384,11,-509,1,-510,1,
+	-16384,3,-525,1,-16384,2,-526,1,-527,1,-16384,2,-528,1,-529,1,
+	-16384,3,-433,1,-434,1,-16384,1,-437,1,-438,1,-16384,3,-435,1,
+	-436,1,-16384,1,-439,1,-440,1,-431,1,-16384,15,-410,1,-411,1,
+	-16384,14,-531,1,-533,1,-16384,10,-532,1,-534,1,-16384,14,-511,1,
+	-513,1,-16384,10,-512,1,-514,1,-16384,18,-500,1,-501,1,-16384,5,
+	-508,1,-16384,7,-530,1,-16384,5,-507,1,-518,1,-16384,5,-519,1,
+	-520,1,-504,1,-16384,5,-32,1,-16384,4,-101,1,-16384,1,-100,1,
+	-52,1,-16384,6,-97,1,-16384,4,-100,1,-16384,4,-20,1,-16384,2,
+	-70,1,-62,1,-16384,2,-68,1,-16384,17,-498,1,-16384,3,-597,1,
+	-16384,1,-595,1,-16384,2,-406,1,-16384,11,-420,1,-16384,10,-620,1,
+	-16384,2,-627,1,-16384,1,-628,1,-619,1,-16384,16,-471,1,-16384,2,
+	-602,1,-603,1,-458,1,-16384,1,-594,1,-16384,3,-524,1,-16384,3,
+	-598,1,-600,1,-601,1,-461,1,-459,1,-462,1,-460,1,-16384,3,
+	-493,1,-457,1,-16384,10,-419,1,-16384,1,-599,1,-16384,18,-610,1,
+	-611,1,-16384,1,-492,1,-16384,2,-596,1,-593,1,-16384,16,-347,1,
+	-16384,3,-351,1,-16384,2,-128,1,-16384,1,-349,1,-16384,14,-381,1,
+	-16384,2,-381,1,-16384,10,-377,1,-16384,2,-377,1,-288,1,-16384,1,
+	-344,1,-16384,3,-348,1,-16384,3,-352,1,-354,1,-355,1,-291,1,
+	-16384,1,-289,1,-16384,1,-114,1,-292,1,-290,1,-16384,3,-346,1,
+	-287,1,-16384,1,-353,1,-16384,8,-356,1,-16384,13,-376,1,-374,1,
+	-16384,4,-375,1,-373,1,-16384,4,-375,1,-376,1,-16384,2,-373,1,
+	-374,1,-258,1,-16384,1,-345,1,-16384,2,-350,1,-343,1,-61,1,
+	-16384,2,-67,1,-16384,17,-481,1,-16384,3,-586,1,-16384,1,-584,1,
+	-16384,2,-405,1,-16384,11,-418,1,-16384,10,-618,1,-16384,2,-625,1,
+	-16384,1,-626,1,-617,1,-16384,3,-591,1,-592,1,-452,1,-16384,1,
+	-583,1,-16384,3,-482,1,-16384,3,-587,1,-589,1,-590,1,-455,1,
+	-453,1,-456,1,-454,1,-16384,3,-480,1,-451,1,-16384,10,-417,1,
+	-16384,2,-588,1,-16384,14,-470,1,-16384,14,-606,1,-607,1,-16384,1,
+	-479,1,-16384,2,-585,1,-582,1,-16384,15,-333,1,-16384,3,-337,1,
+	-16384,2,-127,1,-16384,1,-335,1,-16384,14,-380,1,-16384,2,-380,1,
+	-282,1,-16384,1,-330,1,-16384,3,-334,1,-16384,3,-338,1,-340,1,
+	-341,1,-285,1,-16384,1,-283,1,-16384,1,-113,1,-286,1,-284,1,
+	-16384,3,-332,1,-281,1,-16384,2,-339,1,-16384,8,-372,1,-16384,2,
+	-372,1,-16384,8,-342,1,-16384,13,-371,1,-369,1,-16384,4,-370,1,
+	-368,1,-16384,4,-370,1,-371,1,-16384,2,-368,1,-369,1,-257,1,
+	-16384,1,-331,1,-16384,2,-336,1,-329,1,-16384,9,-71,1,-16384,2,
+	-69,1,-16384,2,-23,1,-16384,10,-77,1,-637,1,-16384,2,-636,1,
+	-27,1,-16384,4,-397,1,-16384,3,-50,1,-16384,4,-96,1,-16384,4,
+	-72,1,-16384,1,-26,1,-16384,6,-81,1,-16384,3,-396,1,-16384,15,
+	-78,1,-16384,1,-82,1,-16384,3,-639,1,-16384,3,-640,1,-94,1,
+	-16384,8,-83,1,-16384,7,-95,1,-16384,11,-87,1,-16384,3,-90,1,
+	-16384,6,-92,1,-91,1,-16384,2,-633,1,-16384,3,-75,1,-16384,7,
+	-47,1,-16384,2,-80,1,-16384,14,-632,1,-16384,19,-44,1,-16384,3,
+	-41,1,-16384,3,-42,1,-16384,4,-33,1,-16384,6,-40,1,-16384,11,
+	-35,1,-16384,6,-39,1,-16384,2,-37,1,-16384,12,-34,1,-16384,6,
+	-38,1,-16384,2,-36,1,-16384,7,-45,1,-16384,5,-43,1,-16384,8,
+	-46,1,-16384,4,-70,1,-16384,2,-53,1,-16384,2,-79,1,-5,1,
+	-16384,2,-6,1,-16384,1,-5,1,-16384,1,-5,2,-16384,2,-5,1,
+	-16384,1,-5,1,-16384,1,-5,2,-16384,1,-8,1,-7,1,-16384,2,
+	-8,1,-16384,1,-7,1,-16384,1,-7,2,-16384,2,-7,1,-16384,1,
+	-7,1,-16384,1,-7,2,-6,2,-16384,3,-9,1,-16384,3,-6,1,
+	-16384,1,-8,1,-16384,1,-8,1,-14,1,3120,1,-15,1,3120,1,
+	-16384,4,-14,1,-13,1,1,1,-16384,5,1,1,3119,1,-16384,3116,
+	3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,
+	-16384,5,1,1,3119,1,-16384,3084,3089,1,3097,1,-16384,2,3089,1,
+	-16384,4,3097,1,-16384,6,3097,2,-16384,11,3089,1,-16384,1,3089,1,
+	3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,
+	-16384,5,1,1,3119,1,-16384,988,999,1,993,1,-16384,70,1064,1,
+	-16384,61,1131,1,1127,1,-16384,524,1652,1,-16384,14,1674,1,1668,1,
+	-16384,68,1737,1,-16384,683,2421,1,-16384,13,2435,1,-16384,51,2494,1,
+	2488,1,-16384,201,2690,1,-16384,39,2730,1,-16384,24,2762,1,2756,1,
+	-16384,363,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,
+	1,1,-16384,5,1,1,3119,1,-16384,608,612,1,-16384,176,789,1,
+	-16384,167,957,1,-16384,662,1620,1,-16384,564,2185,1,-16384,718,2904,1,
+	-16384,14,2919,1,-16384,11,2931,1,-16384,33,2965,1,-16384,154,3119,1,
+	3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,5,
+	1,1,3119,1,-16384,521,525,2,527,2,-16384,2558,3087,2,3096,1,
+	-16384,1,3091,2,-16384,4,3096,1,-16384,5,3103,1,3104,2,-16384,10,
+	3116,2,3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,
+	3126,2,3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,-16384,1,
+	1,1,3119,1,-16384,499,503,1,-16384,2607,3111,1,-16384,8,3119,1,
+	3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,5,
+	1,1,3119,1,-16384,280,286,1,-16384,14,306,1,-16384,100,400,1,
+	-16384,147,548,1,-16384,114,663,1,664,1,-16384,44,709,1,710,1,
+	-16384,404,1148,1,-16384,39,1161,1,-16384,1,1157,1,-16384,220,1378,1,
+	-16384,4,1383,1,-16384,56,1440,1,-16384,4,1445,1,-16384,337,1795,1,
+	-16384,18,1808,1,-16384,1,1804,1,-16384,824,2629,1,-16384,490,3119,1,
+	3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,5,
+	1,1,3119,1,-16384,19,370,1,-16384,322,347,1,-16384,23,373,1,
+	-16384,45,416,1,-16384,122,539,1,-16384,21,561,1,-16384,19,581,1,
+	-16384,1892,2474,1,-16384,267,2742,1,-16384,66,2809,1,-16384,113,2923,1,
+	-16384,14,3058,1,-16384,181,3119,1,3120,1,-16384,1,3120,1,-16384,4,
+	3119,1,-16384,1,1,1,-16384,5,1,1,3119,1,-16384,18,418,1,
+	368,1,-16384,337,361,1,-16384,87,449,1,-16384,68,518,1,-16384,105,
+	624,1,-16384,14,639,1,-16384,18,658,1,-16384,168,827,1,-16384,71,
+	899,1,-16384,14,914,1,-16384,12,927,1,-16384,14,942,1,-16384,38,
+	1029,1,-16384,213,1199,1,-16384,18,1214,1,-16384,19,1238,1,-16384,18,
+	1253,1,-16384,19,1277,1,-16384,18,1292,1,-16384,17,1312,1,-16384,10,
+	1321,1,-16384,36,1393,1,-16384,173,1532,1,-16384,14,1547,1,-16384,12,
+	1560,1,-16384,14,1575,1,-16384,68,1704,1,-16384,194,1843,1,-16384,18,
+	1858,1,-16384,19,1882,1,-16384,18,1897,1,-16384,17,1917,1,-16384,10,
+	1926,1,-16384,31,1958,1,-16384,148,2107,1,-16384,14,2122,1,-16384,12,
+	2135,1,-16384,14,2150,1,-16384,672,2823,1,-16384,46,2870,1,-16384,56,
+	2927,1,-16384,32,2970,1,-16384,54,3015,1,-16384,34,3050,1,-16384,69,
+	3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,
+	-16384,5,1,1,3119,1,-16384,1,3086,1,-16384,499,524,1,-16384,2600,
+	3115,1,-16384,13,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,
+	-16384,1,1,1,-16384,5,1,1,3119,1,-16384,1,3086,1,-16384,5,
+	2788,1,-16384,21,33,1,-16384,45,79,1,-16384,44,124,1,-16384,45,
+	170,1,-16384,45,223,1,-16384,50,268,1,-16384,30,299,1,-16384,19,
+	319,1,-16384,147,481,1,-16384,38,524,1,-16384,96,644,1,-16384,28,
+	631,1,-16384,19,770,1,-16384,49,701,1,-16384,36,738,1,-16384,5,
+	749,1,-16384,69,815,1,982,1,-16384,5,883,1,-16384,30,852,1,
+	-16384,54,907,1,-16384,11,919,1,-16384,15,935,1,-16384,11,947,1,
+	-16384,25,1115,1,-16384,211,1308,1,-16384,3,1193,1,-16384,22,1212,1,
+	-16384,15,1232,1,-16384,22,1251,1,-16384,15,1271,1,-16384,22,1290,1,
+	-16384,28,1319,1,-16384,24,1345,1,1646,1,-16384,6,1515,1,-16384,19,
+	1372,1,-16384,15,1388,1,-16384,29,1418,1,-16384,15,1434,1,-16384,15,
+	1450,1,-16384,18,1469,1,-16384,5,1475,1,-16384,11,1494,1,-16384,52,
+	1540,1,-16384,11,1552,1,-16384,15,1568,1,-16384,11,1580,1,-16384,19,
+	1600,1,-16384,10,1611,1,-16384,24,1783,1,-16384,193,1913,1,-16384,2,
+	1837,1,-16384,22,1856,1,-16384,15,1876,1,-16384,22,1895,1,-16384,28,
+	1924,1,-16384,20,1945,1,-16384,5,2087,1,-16384,38,1990,1,-16384,28,
+	2019,1,-16384,5,2025,1,-16384,27,2053,1,-16384,5,2066,1,-16384,54,
+	2114,1,-16384,11,2126,1,-16384,15,2142,1,-16384,11,2154,1,-16384,19,
+	2174,1,-16384,69,2245,1,-16384,7,2346,1,-16384,34,2287,1,-16384,10,
+	2301,1,-16384,19,2318,1,-16384,2,2323,1,-16384,10,2336,1,-16384,41,
+	2374,1,-16384,76,2455,1,-16384,66,2519,1,-16384,7,2604,1,-16384,34,
+	2561,1,-16384,10,2575,1,-16384,6,2581,1,-16384,10,2594,1,-16384,35,
+	2626,1,-16384,17,2644,1,-16384,61,2710,1,-16384,249,3049,1,-16384,50,
+	3007,1,-16384,2,3010,1,-16384,19,3030,1,-16384,2,3033,1,-16384,72,
+	3115,1,-16384,13,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,
+	-16384,1,1,1,-16384,5,1,1,3119,1,-16384,1,3069,2,-16384,29,
+	36,1,-16384,44,81,1,-16384,44,126,1,-16384,45,172,1,-16384,42,
+	215,1,-16384,176,392,1,-16384,53,464,1,-16384,93,540,1,-16384,26,
+	567,1,-16384,20,588,1,-16384,58,647,1,-16384,166,814,1,-16384,2,
+	817,1,-16384,351,1169,1,-16384,14,1184,1,-16384,3,1188,1,-16384,38,
+	1227,1,-16384,38,1266,1,-16384,77,1344,1,-16384,2,1347,1,-16384,468,
+	1816,1,-16384,12,1829,1,-16384,2,1832,1,-16384,38,1871,1,-16384,75,
+	1947,1,-16384,267,2215,1,-16384,28,2244,1,-16384,2,2247,1,-16384,270,
+	2518,1,-16384,2,2521,1,-16384,295,2817,1,-16384,20,2838,1,-16384,105,
+	2944,1,-16384,128,3069,1,-16384,14,3088,1,-16384,3,3088,1,-16384,13,
+	3069,2,-16384,7,3069,1,-16384,1,3088,1,-16384,1,3088,1,3119,1,
+	3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,5,
+	1,1,3119,1,-16384,1,3070,2,-16384,518,525,2,527,2,-16384,2541,
+	3078,1,-16384,2,3070,1,-16384,4,3078,1,-16384,6,3078,2,3087,2,
+	3096,1,-16384,1,3091,2,-16384,4,3096,1,-16384,5,3103,1,3104,2,
+	3070,2,-16384,7,3070,1,3116,2,3118,2,3119,1,3120,1,-16384,1,
+	3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,3130,1,1,1,
+	-16384,1,3133,2,-16384,1,1,1,3119,1,-16384,1,3071,2,-16384,2,
+	2849,1,-16384,33,43,1,-16384,11,55,1,-16384,6,62,1,-16384,11,
+	74,1,-16384,13,88,1,-16384,11,100,1,-16384,6,107,1,-16384,11,
+	119,1,-16384,13,133,1,-16384,11,145,1,-16384,6,152,1,-16384,11,
+	164,1,-16384,14,179,1,-16384,11,191,1,-16384,6,198,1,-16384,11,
+	210,1,-16384,23,234,1,-16384,5,240,1,-16384,5,246,1,-16384,5,
+	252,1,-16384,14,267,1,-16384,2,270,1,-16384,12,283,1,-16384,14,
+	298,1,-16384,2,301,1,-16384,16,318,1,-16384,2,321,1,-16384,26,
+	348,1,-16384,34,383,1,-16384,45,429,1,-16384,43,473,1,-16384,52,
+	526,1,-16384,1,526,1,-16384,91,620,1,-16384,4,625,1,-16384,7,
+	633,1,-16384,34,668,1,-16384,3,672,1,-16384,7,685,1,-16384,14,
+	695,1,-16384,8,704,1,-16384,29,734,1,-16384,5,740,1,-16384,5,
+	746,1,-16384,3,750,1,-16384,3,758,1,755,1,-16384,6,766,1,
+	763,1,-16384,12,776,1,-16384,4,781,1,-16384,14,796,1,-16384,2,
+	799,1,-16384,5,805,1,-16384,3,809,1,-16384,26,836,1,-16384,9,
+	846,1,-16384,8,855,1,-16384,15,874,1,872,1,-16384,4,880,1,
+	878,1,-16384,12,891,1,-16384,6,898,1,-16384,4,903,1,-16384,5,
+	909,1,-16384,5,915,1,-16384,5,921,1,-16384,4,926,1,-16384,4,
+	931,1,-16384,5,937,1,-16384,5,943,1,-16384,5,949,1,-16384,12,
+	962,1,-16384,26,989,1,-16384,12,1002,1,-16384,4,1007,1,-16384,3,
+	1011,1,-16384,10,1022,1,-16384,3,1026,1,-16384,16,1043,1,-16384,9,
+	1053,1,-16384,10,1065,1,-16384,17,1103,1,-16384,1,1084,1,-16384,7,
+	1092,1,-16384,3,1096,1,-16384,3,1100,1,-16384,6,1111,1,1108,1,
+	-16384,11,1123,1,-16384,2,1140,1,-16384,13,1137,1,-16384,5,1143,1,
+	-16384,2,1146,1,-16384,4,1151,1,-16384,45,1197,1,-16384,3,1201,1,
+	-16384,3,1205,1,-16384,2,1208,1,-16384,7,1216,1,-16384,4,1221,1,
+	-16384,2,1224,1,-16384,11,1236,1,-16384,3,1240,1,-16384,3,1244,1,
+	-16384,2,1247,1,-16384,7,1255,1,-16384,4,1260,1,-16384,2,1263,1,
+	-16384,11,1275,1,-16384,3,1279,1,-16384,3,1283,1,-16384,2,1286,1,
+	-16384,7,1294,1,-16384,4,1299,1,-16384,2,1302,1,-16384,30,1333,1,
+	-16384,2,1336,1,-16384,2,1339,1,-16384,23,1363,1,-16384,3,1367,1,
+	-16384,6,1374,1,-16384,1,1382,1,1377,1,-16384,12,1390,1,-16384,11,
+	1402,1,-16384,9,1412,1,-16384,8,1421,1,-16384,7,1429,1,-16384,6,
+	1436,1,-16384,1,1444,1,1439,1,-16384,12,1452,1,-16384,13,1466,1,
+	-16384,5,1472,1,-16384,5,1478,1,-16384,3,1482,1,-16384,8,1491,1,
+	-16384,3,1495,1,-16384,3,1503,1,1500,1,-16384,6,1511,1,1508,1,
+	-16384,15,1524,1,-16384,6,1531,1,-16384,4,1536,1,-16384,5,1542,1,
+	-16384,5,1548,1,-16384,5,1554,1,-16384,4,1559,1,-16384,4,1564,1,
+	-16384,5,1570,1,-16384,5,1576,1,-16384,5,1582,1,-16384,4,1587,1,
+	-16384,8,1596,1,-16384,5,1602,1,-16384,4,1607,1,-16384,5,1613,1,
+	-16384,11,1625,1,-16384,26,1653,1,-16384,11,1664,1,-16384,12,1677,1,
+	-16384,4,1682,1,-16384,3,1686,1,-16384,10,1697,1,-16384,3,1701,1,
+	-16384,14,1716,1,-16384,9,1726,1,-16384,10,1738,1,-16384,17,1771,1,
+	-16384,1,1757,1,-16384,6,1764,1,-16384,3,1768,1,-16384,6,1779,1,
+	1776,1,-16384,13,1790,1,-16384,2,1793,1,-16384,4,1798,1,-16384,42,
+	1841,1,-16384,3,1845,1,-16384,3,1849,1,-16384,2,1852,1,-16384,7,
+	1860,1,-16384,4,1865,1,-16384,2,1868,1,-16384,11,1880,1,-16384,3,
+	1884,1,-16384,3,1888,1,-16384,2,1891,1,-16384,7,1899,1,-16384,4,
+	1904,1,-16384,2,1907,1,-16384,29,1937,1,-16384,2,1940,1,-16384,21,
+	1962,1,-16384,3,1966,1,-16384,7,1974,1,-16384,9,1984,1,-16384,8,
+	1993,1,-16384,9,2003,1,-16384,12,2016,1,-16384,5,2022,1,-16384,5,
+	2028,1,-16384,7,2036,1,-16384,3,2040,1,-16384,8,2049,1,-16384,5,
+	2055,1,-16384,7,2063,1,-16384,3,2067,1,-16384,3,2075,1,2072,1,
+	-16384,6,2083,1,2080,1,-16384,15,2096,1,-16384,4,2101,1,-16384,4,
+	2106,1,-16384,4,2111,1,-16384,5,2117,1,-16384,5,2123,1,-16384,5,
+	2129,1,-16384,4,2134,1,-16384,4,2139,1,-16384,5,2145,1,-16384,5,
+	2151,1,-16384,5,2157,1,-16384,4,2162,1,-16384,8,2171,1,-16384,5,
+	2177,1,-16384,14,2192,1,-16384,2,2195,1,-16384,5,2201,1,-16384,3,
+	2205,1,-16384,17,2223,1,-16384,57,2281,1,-16384,8,2290,1,-16384,19,
+	2310,1,-16384,3,2314,1,-16384,37,2352,1,-16384,13,2366,1,-16384,3,
+	2370,1,-16384,5,2376,1,-16384,44,2422,1,-16384,13,2436,1,-16384,48,
+	2484,1,-16384,18,2503,1,-16384,3,2507,1,-16384,47,2555,1,-16384,8,
+	2564,1,-16384,45,2610,1,-16384,11,2622,1,-16384,5,2628,1,-16384,11,
+	2640,1,-16384,5,2646,1,-16384,43,2691,1,-16384,39,2731,1,-16384,21,
+	2752,1,-16384,18,2771,1,-16384,3,2775,1,-16384,31,2807,1,-16384,30,
+	2839,1,-16384,18,2857,1,-16384,13,2871,1,-16384,4,2876,1,-16384,3,
+	2880,1,-16384,15,2896,1,-16384,12,2909,1,-16384,44,2954,1,-16384,28,
+	2983,1,-16384,14,2998,1,-16384,3,3002,1,-16384,18,3021,1,-16384,3,
+	3025,1,-16384,47,3071,1,-16384,1,3075,1,-16384,1,3075,1,3083,1,
+	-16384,2,3081,1,-16384,1,3081,1,-16384,1,3083,2,-16384,1,3090,1,
+	-16384,3,3090,1,-16384,1,3094,1,-16384,1,3094,1,3102,1,-16384,2,
+	3100,1,-16384,1,3100,1,-16384,1,3102,2,3113,2,-16384,7,3113,1,
+	-16384,1,3117,1,-16384,1,3117,1,3119,1,3120,1,-16384,1,3120,1,
+	-16384,4,3119,1,-16384,1,1,1,-16384,5,3129,1,3119,1,-16384,3116,
+	3119,1,3122,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,
+	-16384,4,1,1,3128,1,3120,1,-16384,3117,3121,1,-16384,1,3120,1,
+	-16384,4,-14,1,-16384,1,1,1,-16384,4,2,1,1,1,3119,1,
+	-16384,3116,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,
+	1,1,-16384,4,3,1,1,1,3119,1,-16384,3067,3073,1,-16384,7,
+	3079,1,-16384,10,3092,1,-16384,7,3098,1,-16384,21,3119,1,3120,1,
+	-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,4,1,
+	1,1,3119,1,3105,1,5,2,-16384,497,504,1,-16384,20,525,2,
+	527,2,-16384,2541,3077,1,3074,1,3072,2,3074,2,3076,2,3077,1,
+	3080,3,3082,2,3084,1,3085,2,3087,2,3096,1,3093,1,3091,2,
+	3093,2,3095,2,3096,1,3099,3,3101,2,3103,1,3104,2,3106,2,
+	-16384,4,504,1,-16384,1,3114,2,3116,2,3118,2,3119,1,3120,1,
+	-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,3130,1,
+	1,1,-16384,1,3133,2,5,1,1,1,3119,1,3106,1,5,2,
+	-16384,518,525,2,527,2,-16384,2541,3077,1,3074,1,3072,2,3074,2,
+	3076,2,3077,1,3080,3,3082,2,3084,1,3085,2,3087,2,3096,1,
+	3093,1,3091,2,3093,2,3095,2,3096,1,3099,3,3101,2,3103,1,
+	3104,2,3106,2,-16384,6,3114,2,3116,2,3118,2,3119,1,3120,1,
+	-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,3130,1,
+	1,1,-16384,1,3133,2,5,1,1,1,3119,1,3106,1,5,2,
+	-16384,518,525,2,527,2,-16384,1469,1998,1,-16384,32,2031,1,-16384,1038,
+	3077,1,3074,1,3072,2,3074,2,3076,2,3077,1,3080,3,3082,2,
+	3084,1,3085,2,3087,2,3096,1,3093,1,3091,2,3093,2,3095,2,
+	3096,1,3099,3,3101,2,3103,1,3104,2,3106,2,-16384,6,3114,2,
+	3116,2,3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,
+	3126,2,3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,5,1,
+	1,1,3119,1,3106,1,5,2,-16384,518,525,2,527,2,-16384,945,
+	1474,1,-16384,549,2024,1,-16384,1045,3077,1,3074,1,3072,2,3074,2,
+	3076,2,3077,1,3080,3,3082,2,3084,1,3085,2,3087,2,3096,1,
+	3093,1,3091,2,3093,2,3095,2,3096,1,3099,3,3101,2,3103,1,
+	3104,2,3106,2,-16384,6,3114,2,3116,2,3118,2,3119,1,3120,1,
+	-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,3130,1,
+	1,1,-16384,1,3133,2,5,1,1,1,3119,1,3106,1,5,2,
+	-16384,25,78,1,-16384,23,58,1,-16384,18,77,1,-16384,25,103,1,
+	-16384,18,122,1,-16384,4,125,1,-16384,20,148,1,-16384,18,167,1,
+	-16384,26,194,1,-16384,18,213,1,-16384,21,239,1,-16384,32,282,1,
+	-16384,53,320,1,-16384,204,525,2,527,2,-16384,46,575,1,-16384,25,
+	813,1,-16384,306,908,1,-16384,11,920,1,-16384,15,936,1,-16384,11,
+	948,1,-16384,48,997,1,-16384,8,1006,1,-16384,10,1017,1,-16384,3,
+	1021,1,-16384,46,1068,1,-16384,2,1071,1,-16384,274,1346,1,-16384,24,
+	1371,1,-16384,17,1389,1,-16384,43,1433,1,-16384,17,1451,1,-16384,204,
+	1656,1,-16384,2,1659,1,-16384,12,1672,1,-16384,8,1681,1,-16384,10,
+	1692,1,-16384,3,1696,1,-16384,357,2054,1,-16384,182,2243,1,-16384,81,
+	2319,1,-16384,55,2375,1,-16384,49,2425,1,-16384,2,2428,1,-16384,63,
+	2492,1,-16384,5,2498,1,-16384,3,2502,1,-16384,17,2520,1,-16384,104,
+	2625,1,-16384,19,2645,1,-16384,88,2734,1,-16384,2,2737,1,-16384,22,
+	2760,1,-16384,5,2766,1,-16384,3,2770,1,-16384,235,3006,1,-16384,4,
+	3011,1,-16384,17,3029,1,-16384,4,3034,1,-16384,35,3077,1,3074,1,
+	3072,2,3074,2,3076,2,3077,1,3080,3,3082,2,3084,1,3085,2,
+	3087,2,3096,1,3093,1,3091,2,3093,2,3095,2,3096,1,3099,3,
+	3101,2,3103,1,3104,2,3106,2,-16384,6,3114,2,3116,2,3118,2,
+	3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,
+	-16384,1,3130,1,1,1,-16384,1,3133,2,5,1,1,1,3119,1,
+	3106,1,5,2,-16384,23,168,1,123,1,-16384,24,56,1,-16384,18,
+	75,1,-16384,4,80,1,-16384,20,101,1,-16384,18,120,1,-16384,25,
+	146,1,-16384,18,165,1,-16384,26,192,1,-16384,18,211,1,-16384,20,
+	245,1,-16384,32,297,1,-16384,34,300,1,-16384,224,525,2,527,2,
+	-16384,45,576,1,-16384,25,1343,1,-16384,215,816,1,-16384,89,906,1,
+	-16384,11,918,1,-16384,15,934,1,-16384,11,946,1,-16384,49,998,1,
+	-16384,8,1010,1,-16384,10,1018,1,-16384,3,1025,1,-16384,17,1039,1,
+	-16384,52,1095,1,-16384,30,1142,1,-16384,7,1130,1,-16384,3,1134,1,
+	-16384,1,1136,1,-16384,42,1180,1,-16384,7,1226,1,-16384,144,1335,1,
+	-16384,37,1387,1,-16384,2,1373,1,-16384,58,1449,1,-16384,2,1435,1,
+	-16384,235,1673,1,-16384,8,1685,1,-16384,10,1693,1,-16384,3,1700,1,
+	-16384,45,1741,1,-16384,2,1744,1,-16384,307,2052,1,-16384,183,2517,1,
+	-16384,9,2246,1,-16384,70,2317,1,-16384,55,2373,1,-16384,65,2439,1,
+	-16384,2,2442,1,-16384,48,2493,1,-16384,5,2499,1,-16384,3,2506,1,
+	-16384,125,2627,1,-16384,15,2643,1,-16384,50,2694,1,-16384,2,2697,1,
+	-16384,61,2761,1,-16384,5,2767,1,-16384,3,2774,1,-16384,235,3009,1,
+	-16384,2,3008,1,-16384,19,3032,1,-16384,2,3031,1,-16384,38,3077,1,
+	3074,1,3072,2,3074,2,3076,2,3077,1,3080,3,3082,2,3084,1,
+	3085,2,3087,2,3096,1,3093,1,3091,2,3093,2,3095,2,3096,1,
+	3099,3,3101,2,3103,1,3104,2,3106,2,-16384,6,3114,2,3116,2,
+	3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,
+	3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,5,1,1,1,
+	3119,1,3106,1,5,2,-16384,7,598,1,-16384,10,29,1,-16384,8,
+	34,1,-16384,195,230,1,-16384,32,263,1,-16384,261,525,2,527,2,
+	-16384,116,645,1,-16384,90,736,1,-16384,299,1036,1,-16384,52,1089,1,
+	-16384,30,1120,1,-16384,56,1177,1,-16384,6,1185,1,-16384,145,1330,1,
+	-16384,139,1470,1,-16384,5,1476,1,-16384,61,1538,1,-16384,11,1550,1,
+	-16384,15,1566,1,-16384,11,1578,1,-16384,19,1598,1,-16384,10,1609,1,
+	-16384,101,1711,1,-16384,50,1762,1,-16384,25,1788,1,-16384,35,1824,1,
+	-16384,4,1830,1,-16384,105,1935,1,-16384,20,2030,1,-16384,40,1997,1,
+	-16384,22,2020,1,-16384,5,2026,1,-16384,88,2115,1,-16384,11,2127,1,
+	-16384,15,2143,1,-16384,11,2155,1,-16384,19,2175,1,-16384,894,3077,1,
+	3074,1,3072,2,3074,2,3076,2,3077,1,3080,3,3082,2,3084,1,
+	3085,2,3087,2,3096,1,3093,1,3091,2,3093,2,3095,2,3096,1,
+	3099,3,3101,2,3103,1,3104,2,3106,2,-16384,6,3114,2,3116,2,
+	3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,
+	3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,5,1,1,1,
+	3119,1,3106,1,5,2,-16384,7,601,1,-16384,10,32,1,-16384,143,
+	214,1,-16384,1,171,1,-16384,58,233,1,-16384,32,266,1,-16384,5,
+	269,1,-16384,255,525,2,527,2,-16384,210,739,1,-16384,296,1038,1,
+	-16384,52,1091,1,-16384,30,1122,1,-16384,56,1179,1,-16384,6,1187,1,
+	-16384,145,1332,1,-16384,137,1468,1,-16384,72,1541,1,-16384,11,1553,1,
+	-16384,15,1569,1,-16384,11,1581,1,-16384,19,1601,1,-16384,10,1612,1,
+	-16384,98,1712,1,-16384,50,1763,1,-16384,25,1789,1,-16384,35,1825,1,
+	-16384,4,1831,1,-16384,105,1936,1,-16384,10,1946,1,-16384,71,2018,1,
+	-16384,94,2113,1,-16384,11,2125,1,-16384,15,2141,1,-16384,11,2153,1,
+	-16384,19,2173,1,-16384,896,3077,1,3074,1,3072,2,3074,2,3076,2,
+	3077,1,3080,3,3082,2,3084,1,3085,2,3087,2,3096,1,3093,1,
+	3091,2,3093,2,3095,2,3096,1,3099,3,3101,2,3103,1,3104,2,
+	3106,2,-16384,6,3114,2,3116,2,3118,2,3119,1,3120,1,-16384,1,
+	3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,3130,1,1,1,
+	-16384,1,3133,2,5,1,1,1,3119,1,3106,1,5,2,-16384,5,
+	2235,1,-16384,1,599,1,-16384,10,30,1,-16384,30,57,1,-16384,18,
+	76,1,-16384,25,102,1,-16384,18,121,1,-16384,25,147,1,-16384,18,
+	166,1,-16384,26,193,1,-16384,18,212,1,-16384,18,231,1,-16384,32,
+	264,1,-16384,261,525,2,527,2,-16384,44,573,1,-16384,331,905,1,
+	-16384,11,917,1,-16384,15,933,1,-16384,11,945,1,-16384,45,1019,1,
+	-16384,3,995,1,-16384,8,1004,1,-16384,10,1015,1,-16384,20,1037,1,
+	-16384,52,1090,1,-16384,30,1121,1,-16384,4,1135,1,-16384,3,1129,1,
+	-16384,3,1133,1,-16384,43,1178,1,-16384,6,1186,1,-16384,145,1331,1,
+	-16384,38,1369,1,-16384,61,1431,1,-16384,234,1694,1,-16384,3,1670,1,
+	-16384,8,1679,1,-16384,10,1690,1,-16384,49,1740,1,-16384,2,1743,1,
+	-16384,307,2051,1,-16384,264,2316,1,-16384,55,2372,1,-16384,65,2438,1,
+	-16384,2,2441,1,-16384,44,2500,1,-16384,3,2490,1,-16384,5,2496,1,
+	-16384,145,2642,1,-16384,50,2693,1,-16384,2,2696,1,-16384,57,2768,1,
+	-16384,3,2758,1,-16384,5,2764,1,-16384,239,3004,1,-16384,22,3027,1,
+	-16384,42,3077,1,3074,1,3072,2,3074,2,3076,2,3077,1,3080,3,
+	3082,2,3084,1,3085,2,3087,2,3096,1,3093,1,3091,2,3093,2,
+	3095,2,3096,1,3099,3,3101,2,3103,1,3104,2,3106,2,-16384,6,
+	3114,2,3116,2,3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,
+	-16384,1,3126,2,3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,
+	5,1,1,1,3119,1,3106,1,5,2,-16384,5,2236,1,-16384,1,
+	600,1,-16384,10,31,1,-16384,4,169,1,-16384,4,35,1,-16384,194,
+	232,1,251,1,-16384,31,265,1,317,1,-16384,260,525,2,527,2,
+	-16384,44,574,1,-16384,25,1944,1,-16384,46,646,1,-16384,90,737,1,
+	-16384,253,1020,1,-16384,3,996,1,-16384,8,1005,1,-16384,10,1016,1,
+	-16384,21,1040,1,-16384,29,1067,1,-16384,2,1070,1,-16384,19,1099,1,
+	-16384,30,1145,1,-16384,56,1181,1,-16384,7,1265,1,-16384,144,1338,1,
+	-16384,37,1370,1,-16384,61,1432,1,-16384,39,1471,1,-16384,5,1477,1,
+	-16384,61,1539,1,-16384,11,1551,1,-16384,15,1567,1,-16384,11,1579,1,
+	-16384,19,1599,1,-16384,10,1610,1,-16384,44,1655,1,-16384,2,1658,1,
+	-16384,7,1695,1,-16384,3,1671,1,-16384,8,1680,1,-16384,10,1691,1,
+	-16384,21,1713,1,-16384,50,1767,1,-16384,25,1792,1,-16384,35,1826,1,
+	-16384,5,1870,1,-16384,104,1939,1,-16384,84,2021,1,-16384,5,2027,1,
+	-16384,88,2116,1,-16384,11,2128,1,-16384,15,2144,1,-16384,11,2156,1,
+	-16384,19,2176,1,-16384,247,2424,1,-16384,2,2427,1,-16384,58,2501,1,
+	-16384,3,2491,1,-16384,5,2497,1,-16384,127,2624,1,-16384,108,2733,1,
+	-16384,2,2736,1,-16384,17,2769,1,-16384,3,2759,1,-16384,5,2765,1,
+	-16384,239,3005,1,-16384,22,3028,1,-16384,42,3077,1,3074,1,3072,2,
+	3074,2,3076,2,3077,1,3080,3,3082,2,3084,1,3085,2,3087,2,
+	3096,1,3093,1,3091,2,3093,2,3095,2,3096,1,3099,3,3101,2,
+	3103,1,3104,2,3106,2,-16384,6,3114,2,3116,2,3118,2,3119,1,
+	3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,
+	3130,1,1,1,-16384,1,3133,2,6,1,1,1,3119,1,-16384,5,
+	2850,1,2826,1,-16384,6,499,1,-16384,1,490,1,-16384,3,366,1,
+	-16384,2,26,1,-16384,24,51,1,-16384,8,60,1,-16384,9,70,1,
+	-16384,25,96,1,-16384,8,105,1,-16384,9,115,1,-16384,25,141,1,
+	-16384,8,150,1,-16384,9,160,1,-16384,26,187,1,-16384,8,196,1,
+	-16384,9,206,1,-16384,9,216,1,-16384,19,236,1,-16384,5,242,1,
+	-16384,5,248,1,-16384,5,254,1,-16384,6,261,1,-16384,12,279,1,
+	-16384,2,277,1,-16384,7,294,1,-16384,6,292,1,-16384,12,314,1,
+	-16384,6,312,1,-16384,12,330,1,-16384,2,328,1,-16384,30,359,1,
+	-16384,2,362,1,-16384,14,379,1,-16384,9,387,1,-16384,31,423,1,
+	420,1,-16384,13,434,1,-16384,4,439,1,-16384,52,492,1,-16384,11,
+	505,1,-16384,2,507,1,-16384,5,513,1,-16384,11,525,2,527,2,
+	-16384,12,541,1,-16384,28,570,1,-16384,13,586,1,-16384,63,648,1,
+	-16384,5,743,1,727,1,-16384,14,670,1,-16384,5,676,1,-16384,13,
+	700,1,-16384,1,692,1,-16384,4,697,1,-16384,8,713,1,-16384,66,
+	773,1,-16384,4,778,1,-16384,8,787,1,-16384,19,807,1,-16384,7,
+	969,1,-16384,2,818,1,-16384,13,832,1,-16384,8,851,1,-16384,1,
+	843,1,-16384,4,848,1,-16384,8,857,1,-16384,30,888,1,-16384,4,
+	893,1,-16384,61,955,1,-16384,36,1000,1,-16384,90,1087,1,-16384,101,
+	1304,1,-16384,3,1189,1,-16384,38,1228,1,-16384,38,1267,1,-16384,60,
+	1328,1,-16384,16,1632,1,-16384,2,1348,1,-16384,6,1486,1,-16384,9,
+	1365,1,-16384,32,1398,1,-16384,8,1417,1,-16384,1,1409,1,-16384,4,
+	1414,1,-16384,9,1455,1,-16384,54,1479,1,-16384,37,1517,1,-16384,3,
+	1521,1,-16384,4,1526,1,-16384,62,1589,1,-16384,28,1618,1,-16384,31,
+	1650,1,-16384,16,1675,1,-16384,88,1760,1,-16384,73,1909,1,-16384,2,
+	1833,1,-16384,38,1872,1,-16384,60,1933,1,-16384,14,1948,1,-16384,5,
+	2058,1,2042,1,-16384,8,1964,1,-16384,5,1970,1,-16384,8,1989,1,
+	-16384,1,1981,1,-16384,4,1986,1,-16384,9,2005,1,-16384,41,2038,1,
+	-16384,50,2089,1,-16384,3,2093,1,-16384,4,2098,1,-16384,65,2164,1,
+	-16384,18,2183,1,-16384,19,2203,1,-16384,9,2213,1,-16384,14,2228,1,
+	-16384,4,2233,1,-16384,11,2385,1,-16384,2,2248,1,-16384,7,2331,1,
+	-16384,15,2272,1,-16384,3,2286,1,-16384,1,2278,1,-16384,4,2283,1,
+	-16384,8,2297,1,-16384,1,2294,1,-16384,9,2320,1,-16384,20,2325,1,
+	-16384,23,2349,1,-16384,4,2354,1,-16384,38,2450,1,-16384,50,2444,1,
+	-16384,13,2459,1,-16384,60,2655,1,-16384,2,2522,1,-16384,7,2589,1,
+	-16384,15,2546,1,-16384,3,2560,1,-16384,1,2552,1,-16384,4,2557,1,
+	-16384,8,2571,1,-16384,1,2568,1,-16384,9,2578,1,-16384,4,2583,1,
+	-16384,23,2607,1,-16384,4,2612,1,-16384,50,2705,1,-16384,35,2699,1,
+	-16384,13,2714,1,-16384,119,2833,1,-16384,3,2837,1,-16384,12,2893,1,
+	-16384,21,2872,1,-16384,25,2898,1,-16384,3,2902,1,-16384,9,2912,1,
+	-16384,8,2921,1,-16384,7,2929,1,-16384,28,3035,1,-16384,7,2966,1,
+	-16384,5,2972,1,-16384,11,2984,1,-16384,1,2990,1,-16384,9,2996,1,
+	-16384,3,3000,1,-16384,22,3023,1,-16384,21,3045,1,-16384,5,3051,1,
+	-16384,35,3087,2,3096,1,-16384,1,3091,2,-16384,4,3096,1,-16384,5,
+	3103,1,3104,2,-16384,3,3109,1,-16384,6,3116,2,3118,2,3119,1,
+	3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,
+	3130,1,1,1,-16384,1,3133,2,7,1,1,1,3119,1,-16384,212,
+	217,1,-16384,146,363,1,-16384,3,389,1,-16384,70,438,1,-16384,86,
+	525,2,527,2,-16384,119,649,1,790,1,-16384,11,667,1,-16384,156,
+	819,1,958,1,-16384,10,830,1,-16384,201,1032,1,-16384,171,1204,1,
+	-16384,38,1243,1,-16384,38,1282,1,-16384,32,1315,1,-16384,32,1349,1,
+	1621,1,-16384,46,1396,1,-16384,310,1707,1,-16384,140,1848,1,-16384,38,
+	1887,1,-16384,32,1920,1,-16384,27,1949,1,2186,1,-16384,11,1961,1,
+	-16384,250,2212,1,-16384,19,2232,1,-16384,16,2381,1,-16384,18,2268,1,
+	-16384,117,2513,1,-16384,18,2405,1,-16384,117,2651,1,-16384,18,2542,1,
+	-16384,113,2781,1,-16384,17,2674,1,-16384,226,2901,1,-16384,11,2913,1,
+	-16384,53,2967,1,-16384,119,3087,2,3096,1,-16384,1,3091,2,-16384,4,
+	3096,1,-16384,5,3103,1,3104,2,-16384,10,3116,2,3118,2,3119,1,
+	3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,-16384,1,
+	3130,1,1,1,-16384,1,3133,2,8,1,1,1,3119,1,-16384,212,
+	218,1,-16384,126,343,1,-16384,16,360,1,-16384,25,386,1,-16384,6,
+	393,1,-16384,39,433,1,-16384,8,442,1,-16384,37,480,1,-16384,23,
+	506,1,-16384,7,512,1,-16384,10,523,1,-16384,1,525,2,527,2,
+	-16384,12,542,1,-16384,24,566,1,-16384,16,583,1,-16384,35,619,1,
+	-16384,6,626,1,-16384,11,638,1,-16384,54,693,1,-16384,26,720,1,
+	-16384,3,724,1,-16384,49,774,1,-16384,40,970,1,-16384,28,844,1,
+	-16384,19,864,1,-16384,24,889,1,-16384,98,988,1,-16384,85,1074,1,
+	-16384,93,1168,1,-16384,16,1305,1,-16384,3,1190,1,-16384,4,1194,1,
+	-16384,18,1213,1,-16384,14,1229,1,-16384,4,1233,1,-16384,18,1252,1,
+	-16384,14,1268,1,-16384,4,1272,1,-16384,18,1291,1,-16384,17,1309,1,
+	-16384,10,1320,1,-16384,24,1633,1,-16384,16,1362,1,-16384,47,1410,1,
+	-16384,17,1428,1,-16384,33,1462,1,-16384,59,1522,1,-16384,140,1663,1,
+	-16384,83,1747,1,-16384,67,1815,1,-16384,14,1910,1,-16384,2,1834,1,
+	-16384,4,1838,1,-16384,18,1857,1,-16384,14,1873,1,-16384,4,1877,1,
+	-16384,18,1896,1,-16384,17,1914,1,-16384,10,1925,1,-16384,56,1982,1,
+	-16384,29,2012,1,-16384,81,2094,1,-16384,132,2227,1,-16384,11,2239,1,
+	-16384,5,2386,1,-16384,2,2249,1,-16384,15,2264,1,-16384,14,2279,1,
+	-16384,70,2350,1,-16384,50,2401,1,-16384,117,2656,1,-16384,2,2523,1,
+	-16384,15,2538,1,-16384,14,2553,1,-16384,54,2608,1,-16384,61,2670,1,
+	-16384,118,2789,1,-16384,38,2831,1,-16384,11,2840,1,-16384,19,2860,1,
+	-16384,8,2869,1,-16384,11,2881,1,-16384,9,2891,1,-16384,5,2897,1,
+	-16384,5,2903,1,-16384,14,2918,1,-16384,7,2926,1,-16384,16,2943,1,
+	-16384,4,2948,1,-16384,35,2985,1,-16384,4,2989,1,-16384,5,2995,1,
+	-16384,24,3020,1,-16384,41,3062,1,-16384,24,3087,2,3096,1,-16384,1,
+	3091,2,-16384,4,3096,1,-16384,5,3103,1,3104,2,-16384,10,3116,2,
+	3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,
+	3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,9,1,1,1,
+	3119,1,-16384,50,54,1,-16384,6,61,1,-16384,11,73,1,-16384,25,
+	99,1,-16384,6,106,1,-16384,11,118,1,-16384,25,144,1,-16384,6,
+	151,1,-16384,11,163,1,-16384,26,190,1,-16384,6,197,1,-16384,11,
+	209,1,-16384,52,262,1,-16384,83,346,1,-16384,33,380,1,-16384,45,
+	426,1,-16384,98,525,2,527,2,-16384,1,532,1,-16384,118,791,1,
+	-16384,53,703,1,-16384,88,804,1,-16384,22,971,1,-16384,3,959,1,
+	-16384,34,854,1,-16384,70,925,1,-16384,34,967,1,-16384,9,1162,1,
+	-16384,117,1088,1,-16384,30,1119,1,-16384,43,1342,1,1341,1,-16384,25,
+	1218,1,-16384,28,1223,1,1220,1,-16384,8,1257,1,-16384,28,1262,1,
+	1259,1,-16384,8,1296,1,-16384,28,1301,1,1298,1,-16384,6,1323,1,
+	-16384,18,1326,1,1325,1,-16384,3,1329,1,-16384,15,1634,1,-16384,2,
+	1350,1,1622,1,-16384,70,1420,1,-16384,1,1422,1,-16384,57,1480,1,
+	1481,1,-16384,36,1585,1,-16384,39,1558,1,-16384,27,1586,1,-16384,36,
+	1630,1,-16384,9,1809,1,-16384,127,1761,1,-16384,25,1787,1,-16384,22,
+	1943,1,1942,1,-16384,22,1862,1,-16384,28,1867,1,1864,1,-16384,8,
+	1901,1,-16384,28,1906,1,1903,1,-16384,6,1928,1,-16384,18,1931,1,
+	1930,1,-16384,3,1934,1,-16384,14,2187,1,-16384,42,1992,1,-16384,1,
+	1994,1,-16384,95,2160,1,-16384,42,2133,1,-16384,27,2161,1,-16384,26,
+	2200,1,-16384,56,2387,1,-16384,2,2250,1,2382,1,-16384,39,2289,1,
+	-16384,5,2295,1,2296,1,-16384,1,2300,1,-16384,2,2302,1,-16384,81,
+	2383,1,-16384,2,2514,1,-16384,73,2460,1,-16384,54,2515,1,-16384,3,
+	2657,1,-16384,2,2524,1,2652,1,-16384,39,2563,1,-16384,5,2569,1,
+	2570,1,-16384,1,2574,1,-16384,2,2576,1,-16384,77,2653,1,-16384,2,
+	2782,1,-16384,58,2715,1,-16384,67,2783,1,-16384,4,2812,1,-16384,29,
+	2818,1,-16384,20,2845,1,-16384,12,2865,1,-16384,34,2887,1,-16384,154,
+	3042,1,-16384,5,3048,1,-16384,38,3087,2,3096,1,-16384,1,3091,2,
+	-16384,4,3096,1,-16384,5,3103,1,3104,2,-16384,10,3116,2,3118,2,
+	3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,3119,1,
+	-16384,1,3130,1,1,1,-16384,1,3133,2,10,1,1,1,3119,1,
+	-16384,1,3070,2,-16384,1,2905,1,-16384,1,2827,1,-16384,2,2209,1,
+	-16384,2,528,1,-16384,4,444,1,417,1,367,1,-16384,18,42,1,
+	-16384,4,47,1,-16384,2,50,1,-16384,2,53,1,-16384,12,66,1,
+	-16384,2,69,1,-16384,2,72,1,-16384,14,87,1,-16384,4,92,1,
+	-16384,2,95,1,-16384,2,98,1,-16384,12,111,1,-16384,2,114,1,
+	-16384,2,117,1,-16384,14,132,1,-16384,4,137,1,-16384,2,140,1,
+	-16384,2,143,1,-16384,12,156,1,-16384,2,159,1,-16384,2,162,1,
+	-16384,15,178,1,-16384,4,183,1,-16384,2,186,1,-16384,2,189,1,
+	-16384,12,202,1,-16384,2,205,1,-16384,2,208,1,-16384,20,229,1,
+	-16384,8,238,1,-16384,5,244,1,-16384,5,250,1,-16384,5,256,1,
+	-16384,24,281,1,-16384,5,287,1,-16384,8,296,1,-16384,10,307,1,
+	-16384,8,316,1,-16384,15,332,1,-16384,7,340,1,-16384,1,342,1,
+	-16384,9,352,1,-16384,5,358,1,-16384,6,365,1,-16384,2,382,1,
+	374,1,-16384,2,372,1,-16384,3,376,1,-16384,14,391,1,-16384,4,
+	406,1,-16384,1,398,1,-16384,2,401,1,-16384,23,425,1,-16384,2,
+	441,1,-16384,33,462,1,-16384,2,465,1,-16384,17,483,1,-16384,5,
+	489,1,-16384,7,497,1,-16384,22,520,1,-16384,4,525,2,527,2,
+	-16384,6,535,1,-16384,13,549,1,-16384,40,596,1,594,1,592,1,
+	593,1,-16384,12,606,1,-16384,6,613,1,-16384,16,630,1,-16384,17,
+	650,1,-16384,3,761,1,753,1,-16384,1,728,1,-16384,1,688,1,
+	-16384,8,666,1,-16384,17,684,1,-16384,9,694,1,-16384,4,699,1,
+	-16384,2,702,1,-16384,9,712,1,-16384,2,715,1,-16384,1,717,1,
+	-16384,1,719,1,-16384,60,780,1,-16384,22,803,1,-16384,11,972,1,
+	-16384,2,820,1,-16384,3,876,1,870,1,-16384,1,866,1,839,1,
+	-16384,18,845,1,-16384,4,850,1,-16384,2,853,1,-16384,5,859,1,
+	-16384,1,861,1,-16384,1,863,1,-16384,21,885,1,-16384,9,895,1,
+	-16384,70,966,1,-16384,7,1106,1,1081,1,-16384,1,1078,1,-16384,2,
+	1046,1,-16384,54,1035,1,-16384,22,1058,1,-16384,3,1062,1,-16384,54,
+	1117,1,-16384,58,1176,1,-16384,168,1635,1,-16384,2,1351,1,-16384,4,
+	1506,1,1498,1,-16384,1,1484,1,1405,1,-16384,21,1379,1,-16384,4,
+	1384,1,-16384,26,1411,1,-16384,4,1416,1,-16384,2,1419,1,-16384,21,
+	1441,1,-16384,4,1446,1,-16384,10,1457,1,-16384,1,1459,1,-16384,1,
+	1461,1,-16384,55,1518,1,-16384,10,1528,1,-16384,66,1595,1,-16384,33,
+	1629,1,-16384,7,1774,1,1754,1,-16384,1,1751,1,-16384,2,1719,1,
+	-16384,66,1710,1,-16384,20,1731,1,-16384,3,1735,1,-16384,49,1785,1,
+	-16384,37,1823,1,-16384,124,1950,1,-16384,3,2078,1,2070,1,-16384,1,
+	2043,1,-16384,1,1977,1,-16384,25,1983,1,-16384,4,1988,1,-16384,2,
+	1991,1,-16384,15,2007,1,-16384,1,2009,1,-16384,1,2011,1,-16384,77,
+	2090,1,-16384,10,2100,1,-16384,69,2170,1,-16384,28,2199,1,-16384,17,
+	2220,1,2218,1,-16384,22,2241,1,-16384,3,2388,1,-16384,2,2251,1,
+	-16384,1,2359,1,-16384,3,2339,1,2337,1,-16384,1,2324,1,-16384,1,
+	2274,1,-16384,20,2280,1,-16384,4,2285,1,-16384,2,2288,1,-16384,20,
+	2309,1,-16384,18,2328,1,-16384,27,2356,1,-16384,6,2363,1,-16384,23,
+	2470,1,-16384,3,2461,1,2456,1,-16384,1,2443,1,-16384,1,2411,1,
+	-16384,11,2408,1,-16384,6,2415,1,-16384,3,2419,1,-16384,14,2434,1,
+	-16384,12,2447,1,-16384,33,2481,1,-16384,37,2658,1,-16384,2,2525,1,
+	-16384,1,2633,1,2615,1,-16384,2,2597,1,2595,1,-16384,1,2582,1,
+	-16384,1,2548,1,-16384,20,2554,1,-16384,4,2559,1,-16384,2,2562,1,
+	-16384,23,2586,1,-16384,27,2614,1,-16384,6,2621,1,-16384,8,2630,1,
+	-16384,6,2637,1,-16384,19,2738,1,2723,1,-16384,2,2716,1,2711,1,
+	-16384,1,2698,1,2680,1,-16384,11,2677,1,-16384,6,2684,1,-16384,3,
+	2688,1,-16384,13,2702,1,-16384,26,2729,1,-16384,19,2749,1,-16384,37,
+	2813,1,-16384,2,2801,1,-16384,1,2792,1,-16384,3,2796,1,-16384,14,
+	2811,1,-16384,3,2815,1,-16384,8,2824,1,-16384,10,2835,1,-16384,23,
+	2859,1,-16384,6,2866,1,-16384,23,2890,1,-16384,24,2915,1,-16384,18,
+	2934,1,-16384,11,2946,1,-16384,2,2949,1,-16384,1,2951,1,-16384,3,
+	2955,1,-16384,3,2978,1,-16384,9,2969,1,-16384,47,3017,1,-16384,23,
+	3041,1,-16384,25,3067,1,-16384,2,3078,1,-16384,2,3070,1,-16384,4,
+	3078,1,-16384,6,3078,2,3087,2,3096,1,-16384,1,3091,2,-16384,4,
+	3096,1,-16384,5,3103,1,3104,2,3070,2,-16384,7,3070,1,3116,2,
+	3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,3126,2,
+	3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,11,1,1,1,
+	3119,1,-16384,3,2935,1,-16384,6,602,1,-16384,3,494,1,-16384,374,
+	394,1,-16384,51,445,1,-16384,19,466,1,-16384,29,495,1,-16384,29,
+	525,2,527,2,-16384,12,543,1,-16384,38,580,1,-16384,24,608,1,
+	-16384,75,681,1,682,1,-16384,307,990,1,-16384,3,994,1,-16384,5,
+	1014,1,-16384,2,1003,1,-16384,61,1069,1,1066,1,-16384,301,1368,1,
+	-16384,61,1430,1,-16384,234,1665,1,-16384,3,1669,1,-16384,5,1689,1,
+	-16384,2,1678,1,-16384,59,1742,1,1739,1,-16384,502,2242,1,-16384,2,
+	2389,1,-16384,2,2252,1,-16384,66,2315,1,-16384,120,2440,1,2437,1,
+	-16384,81,2659,1,-16384,2,2526,1,-16384,100,2623,1,-16384,107,2735,1,
+	2732,1,-16384,64,2797,1,-16384,108,2924,1,-16384,4,2916,1,-16384,33,
+	2945,1,-16384,38,2986,1,-16384,18,3003,1,-16384,22,3026,1,-16384,10,
+	3037,1,-16384,21,3059,1,-16384,27,3087,2,3096,1,-16384,1,3091,2,
+	-16384,4,3096,1,-16384,5,3103,1,3104,2,-16384,7,608,1,-16384,2,
+	3116,2,3118,2,3119,1,3120,1,-16384,1,3123,1,3120,1,-16384,1,
+	3126,2,3119,1,-16384,1,3130,1,1,1,-16384,1,3133,2,12,1,
+	1,1,3119,1,-16384,389,395,1,-16384,36,430,1,-16384,14,446,1,
+	-16384,95,544,1,-16384,47,589,1,-16384,58,651,1,-16384,80,729,1,
+	-16384,64,794,1,-16384,20,973,1,-16384,2,821,1,-16384,48,867,1,
+	-16384,45,913,1,-16384,27,941,1,-16384,258,1200,1,-16384,14,1215,1,
+	-16384,23,1239,1,-16384,14,1254,1,-16384,23,1278,1,-16384,14,1293,1,
+	-16384,19,1313,1,-16384,8,1322,1,-16384,22,1636,1,-16384,2,1352,1,
+	-16384,136,1485,1,-16384,60,1546,1,-16384,27,1574,1,-16384,269,1844,1,
+	-16384,14,1859,1,-16384,23,1883,1,-16384,14,1898,1,-16384,19,1918,1,
+	-16384,8,1927,1,-16384,20,1951,1,-16384,95,2044,1,-16384,76,2121,1,
+	-16384,27,2149,1,-16384,40,2190,1,-16384,25,2216,1,-16384,7,2224,1,
+	-16384,20,2390,1,-16384,2,2253,1,-16384,76,2326,1,-16384,118,2445,1,
+	-16384,32,2477,1,-16384,41,2660,1,-16384,2,2527,1,-16384,60,2584,1,
+	-16384,115,2700,1,-16384,45,2745,1,-16384,133,2879,1,-16384,184,3064,1,
+	-16384,55,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,
+	1,1,-16384,4,13,1,1,1,3119,1,3107,1,-16384,3,2906,1,
+	-16384,2,2785,1,-16384,15,27,1,-16384,16,44,1,-16384,18,63,1,
+	-16384,25,89,1,-16384,18,108,1,-16384,25,134,1,-16384,18,153,1,
+	-16384,26,180,1,-16384,18,199,1,-16384,18,337,1,-16384,174,396,1,
+	-16384,1,411,1,-16384,2,399,1,-16384,5,404,1,-16384,42,459,1,
+	-16384,17,467,1,-16384,45,511,1,-16384,4,516,1,-16384,5,522,1,
+	-16384,18,545,1,-16384,2,556,1,-16384,2,547,1,-16384,3,551,1,
+	-16384,13,565,1,-16384,5,571,1,-16384,7,579,1,-16384,35,615,1,
+	-16384,2,618,1,-16384,3,622,1,-16384,13,636,1,-16384,13,784,1,
+	-16384,3,744,1,-16384,7,662,1,-16384,45,708,1,-16384,26,735,1,
+	-16384,84,952,1,-16384,79,912,1,-16384,3,904,1,-16384,11,916,1,
+	-16384,11,940,1,-16384,3,932,1,-16384,11,944,1,-16384,27,1149,1,
+	-16384,74,1051,1,-16384,76,1124,1,-16384,3,1128,1,-16384,3,1132,1,
+	-16384,34,1167,1,-16384,182,1615,1,-16384,4,1487,1,-16384,111,1467,1,
+	-16384,5,1473,1,-16384,59,1545,1,-16384,3,1537,1,-16384,11,1549,1,
+	-16384,11,1573,1,-16384,3,1565,1,-16384,11,1577,1,-16384,12,1590,1,
+	-16384,2,1593,1,-16384,3,1597,1,-16384,10,1608,1,-16384,26,1796,1,
+	-16384,17,1657,1,1654,1,-16384,65,1724,1,-16384,93,1814,1,-16384,135,
+	2180,1,-16384,3,2059,1,-16384,62,2017,1,-16384,5,2023,1,-16384,26,
+	2050,1,-16384,57,2120,1,-16384,3,2112,1,-16384,11,2124,1,-16384,11,
+	2148,1,-16384,3,2140,1,-16384,11,2152,1,-16384,12,2165,1,-16384,2,
+	2168,1,-16384,3,2172,1,-16384,78,2357,1,-16384,4,2332,1,-16384,35,
+	2298,1,-16384,11,2321,1,-16384,55,2379,1,-16384,10,2371,1,-16384,16,
+	2468,1,-16384,4,2451,1,-16384,18,2412,1,-16384,9,2426,1,2423,1,
+	-16384,47,2511,1,-16384,4,2476,1,-16384,8,2485,1,-16384,3,2489,1,
+	-16384,5,2495,1,-16384,29,2616,1,-16384,4,2590,1,-16384,35,2572,1,
+	-16384,11,2579,1,-16384,55,2649,1,-16384,6,2641,1,-16384,16,2724,1,
+	-16384,4,2706,1,-16384,17,2681,1,-16384,9,2695,1,2692,1,-16384,46,
+	2779,1,-16384,4,2744,1,-16384,8,2753,1,-16384,3,2757,1,-16384,5,
+	2763,1,-16384,40,2804,1,-16384,57,2862,1,-16384,13,2877,1,2885,1,
+	-16384,10,2888,1,-16384,6,2895,1,-16384,14,2910,1,-16384,26,3063,1,
+	-16384,4,2942,1,-16384,12,2956,1,-16384,7,2963,1,-16384,30,2994,1,
+	-16384,18,3013,1,-16384,5,3019,1,-16384,27,3047,1,-16384,7,3055,1,
+	-16384,64,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,
+	1,1,-16384,4,14,1,1,1,3119,1,-16384,3,2936,1,2907,1,
+	-16384,2,2786,1,-16384,1,2210,1,-16384,23,37,1,-16384,11,49,1,
+	-16384,18,68,1,-16384,13,82,1,-16384,11,94,1,-16384,18,113,1,
+	-16384,13,127,1,-16384,11,139,1,-16384,18,158,1,-16384,14,173,1,
+	-16384,11,185,1,-16384,18,204,1,-16384,11,219,1,-16384,18,235,1,
+	-16384,5,241,1,-16384,5,247,1,-16384,5,253,1,-16384,14,273,1,
+	-16384,7,276,1,-16384,7,284,1,-16384,6,291,1,-16384,7,304,1,
+	-16384,11,311,1,-16384,7,324,1,-16384,7,327,1,-16384,13,341,1,
+	-16384,22,364,1,-16384,19,384,1,-16384,3,388,1,-16384,1,390,1,
+	-16384,21,412,1,413,1,-16384,4,427,1,-16384,11,431,1,436,1,
+	-16384,3,435,1,-16384,4,440,1,-16384,16,457,1,-16384,12,470,1,
+	471,1,-16384,4,476,1,477,1,-16384,36,514,1,-16384,19,534,1,
+	-16384,22,557,1,558,1,-16384,28,587,1,-16384,60,652,1,792,1,
+	-16384,9,678,1,675,1,-16384,4,665,1,-16384,17,683,1,-16384,5,
+	689,1,-16384,1,691,1,-16384,4,696,1,-16384,8,705,1,-16384,5,
+	711,1,-16384,6,718,1,-16384,58,777,1,-16384,15,798,1,-16384,21,
+	974,1,-16384,2,822,1,960,1,-16384,8,834,1,831,1,-16384,10,
+	840,1,-16384,1,842,1,-16384,4,847,1,-16384,8,856,1,-16384,5,
+	862,1,-16384,6,869,1,-16384,22,892,1,-16384,4,897,1,-16384,1,
+	900,1,-16384,27,928,1,-16384,33,961,1,-16384,9,1154,1,-16384,58,
+	1041,1,-16384,18,1049,1,-16384,30,1080,1,-16384,89,1170,1,-16384,174,
+	1637,1,-16384,2,1353,1,1623,1,-16384,44,1400,1,1397,1,-16384,10,
+	1406,1,-16384,1,1408,1,-16384,4,1413,1,-16384,8,1423,1,-16384,37,
+	1460,1,-16384,28,1489,1,-16384,35,1525,1,-16384,4,1530,1,-16384,1,
+	1533,1,-16384,27,1561,1,-16384,63,1624,1,-16384,9,1801,1,-16384,70,
+	1714,1,-16384,16,1722,1,-16384,30,1753,1,-16384,63,1817,1,-16384,130,
+	1952,1,2188,1,-16384,9,1972,1,1969,1,-16384,17,1978,1,-16384,1,
+	1980,1,-16384,4,1985,1,-16384,8,1995,1,-16384,6,2001,1,-16384,8,
+	2010,1,-16384,23,2034,1,-16384,26,2061,1,-16384,35,2097,1,-16384,7,
+	2105,1,-16384,1,2108,1,-16384,27,2136,1,-16384,53,2194,1,-16384,24,
+	2214,1,-16384,9,2225,1,2230,1,-16384,3,2229,1,-16384,4,2234,1,
+	-16384,10,2391,1,-16384,2,2254,1,-16384,4,2341,1,-16384,12,2271,1,
+	-16384,8,2275,1,-16384,1,2277,1,-16384,4,2282,1,-16384,28,2311,1,
+	-16384,22,2334,1,-16384,18,2353,1,-16384,13,2367,1,-16384,12,2380,1,
+	-16384,9,2463,1,-16384,62,2453,1,-16384,58,2512,1,-16384,6,2661,1,
+	-16384,2,2528,1,-16384,4,2599,1,-16384,12,2545,1,-16384,8,2549,1,
+	-16384,1,2551,1,-16384,4,2556,1,-16384,35,2592,1,-16384,18,2611,1,
+	-16384,38,2650,1,-16384,9,2718,1,-16384,47,2708,1,-16384,71,2780,1,
+	-16384,51,2832,1,-16384,18,2867,1,-16384,16,2875,1,-16384,4,2873,1,
+	2874,1,-16384,24,2899,1,2900,1,-16384,13,2914,1,-16384,47,2962,1,
+	-16384,5,2968,1,-16384,28,2997,1,-16384,38,3036,1,-16384,9,3046,1,
+	-16384,73,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,
+	1,1,-16384,4,15,1,1,1,3119,1,-16384,10,603,1,-16384,478,
+	493,1,-16384,25,519,1,-16384,9,536,1,-16384,34,564,1,-16384,42,
+	607,1,-16384,40,653,1,-16384,137,786,1,-16384,28,975,1,-16384,2,
+	823,1,-16384,66,886,1,-16384,68,954,1,-16384,92,1052,1,-16384,118,
+	1166,1,-16384,5,1182,1,-16384,18,1210,1,-16384,38,1249,1,-16384,38,
+	1288,1,-16384,36,1317,1,-16384,38,1638,1,-16384,2,1354,1,-16384,168,
+	1519,1,-16384,99,1617,1,-16384,102,1725,1,-16384,92,1813,1,-16384,5,
+	1827,1,-16384,15,1854,1,-16384,38,1893,1,-16384,36,1922,1,-16384,36,
+	1953,1,-16384,50,1999,1,-16384,32,2032,1,-16384,56,2091,1,-16384,92,
+	2182,1,-16384,62,2392,1,-16384,2,2255,1,-16384,9,2303,1,-16384,32,
+	2291,1,-16384,1,2293,1,-16384,12,2306,1,-16384,124,2431,1,-16384,87,
+	2662,1,-16384,2,2529,1,-16384,9,2577,1,-16384,32,2565,1,-16384,1,
+	2567,1,-16384,48,2618,1,-16384,107,2726,1,-16384,89,2816,1,-16384,41,
+	2856,1,-16384,71,2928,1,-16384,12,2941,1,-16384,13,2957,1,-16384,60,
+	3016,1,-16384,23,3040,1,-16384,79,3119,1,3120,1,-16384,1,3120,1,
+	-16384,4,3119,1,-16384,1,1,1,-16384,4,16,1,1,1,3119,1,
+	3108,1,-16384,2,2937,1,-16384,3,2787,1,-16384,2,604,1,-16384,9,
+	356,1,-16384,20,45,1,-16384,18,64,1,-16384,25,90,1,-16384,18,
+	109,1,-16384,25,135,1,-16384,18,154,1,-16384,26,181,1,-16384,18,
+	200,1,-16384,15,220,1,345,1,-16384,19,237,1,-16384,5,243,1,
+	-16384,5,249,1,-16384,5,255,1,-16384,24,280,1,-16384,14,295,1,
+	-16384,19,315,1,-16384,15,331,1,-16384,2,334,1,-16384,12,353,1,
+	-16384,27,381,1,-16384,21,403,1,-16384,54,452,1,-16384,12,468,1,
+	-16384,8,474,1,-16384,4,479,1,-16384,5,485,1,-16384,14,502,1,
+	-16384,7,508,1,-16384,1,510,1,-16384,35,550,1,-16384,21,568,1,
+	-16384,47,616,1,-16384,11,628,1,-16384,19,654,1,-16384,49,698,1,
+	-16384,15,714,1,-16384,10,725,1,-16384,19,745,1,-16384,33,779,1,
+	-16384,35,976,1,-16384,2,824,1,-16384,30,849,1,-16384,8,858,1,
+	-16384,27,924,1,-16384,7,894,1,-16384,75,1163,1,-16384,16,987,1,
+	-16384,64,1056,1,-16384,22,1075,1,-16384,42,1118,1,-16384,37,1158,1,
+	-16384,33,1219,1,-16384,38,1258,1,-16384,38,1297,1,-16384,36,1324,1,
+	-16384,39,1639,1,-16384,2,1355,1,-16384,12,1361,1,-16384,53,1415,1,
+	-16384,11,1427,1,-16384,28,1456,1,-16384,31,1490,1,-16384,30,1557,1,
+	-16384,7,1527,1,-16384,105,1810,1,-16384,28,1662,1,-16384,62,1729,1,
+	-16384,22,1748,1,-16384,37,1786,1,-16384,16,1805,1,-16384,30,1863,1,
+	-16384,38,1902,1,-16384,36,1929,1,-16384,37,1954,1,-16384,38,1987,1,
+	-16384,18,2006,1,-16384,53,2062,1,-16384,30,2132,1,-16384,7,2099,1,
+	-16384,138,2238,1,-16384,6,2393,1,-16384,2,2256,1,-16384,14,2263,1,
+	-16384,20,2284,1,-16384,6,2292,1,-16384,7,2299,1,-16384,22,2322,1,
+	-16384,10,2335,1,-16384,21,2355,1,-16384,5,2361,1,-16384,38,2400,1,
+	-16384,12,2413,1,-16384,38,2454,1,-16384,19,2472,1,-16384,5,2478,1,
+	-16384,40,2663,1,-16384,2,2530,1,-16384,14,2537,1,-16384,20,2558,1,
+	-16384,6,2566,1,-16384,7,2573,1,-16384,6,2580,1,-16384,10,2593,1,
+	-16384,21,2613,1,-16384,21,2635,1,-16384,33,2669,1,-16384,12,2682,1,
+	-16384,24,2709,1,-16384,32,2740,1,-16384,5,2746,1,-16384,47,2794,1,
+	-16384,11,2806,1,-16384,36,2843,1,-16384,20,2864,1,-16384,13,2878,1,
+	-16384,4,2883,1,-16384,2,2886,1,-16384,19,2925,1,2920,1,-16384,39,
+	2947,1,-16384,9,3043,1,-16384,3,2961,1,-16384,2,2964,1,-16384,17,
+	2982,1,-16384,5,2988,1,-16384,2,2991,1,-16384,1,2993,1,-16384,5,
+	2999,1,-16384,1,3001,1,-16384,20,3022,1,-16384,1,3024,1,-16384,32,
+	3057,1,-16384,3,3061,1,-16384,3,3065,1,-16384,42,3112,1,-16384,1,
+	3110,1,-16384,9,3119,1,3120,1,-16384,1,3120,1,-16384,4,3119,1,
+	-16384,1,1,1,-16384,4,17,1,1,1,3119,1,-16384,5,2851,1,
+	-16384,5,582,1,529,1,500,1,-16384,20,59,1,-16384,1,40,1,
+	-16384,42,104,1,-16384,1,85,1,-16384,42,149,1,-16384,1,130,1,
+	-16384,43,195,1,-16384,1,176,1,-16384,39,221,1,-16384,2,333,1,
+	260,1,258,1,-16384,2,224,1,-16384,2,227,1,-16384,61,289,1,
+	-16384,19,309,1,-16384,44,354,1,-16384,21,377,1,-16384,8,385,1,
+	-16384,8,414,1,-16384,13,408,1,-16384,23,432,1,-16384,4,437,1,
+	-16384,16,454,1,-16384,32,487,1,-16384,21,509,1,-16384,27,537,1,
+	-16384,5,559,1,-16384,10,554,1,-16384,8,563,1,-16384,5,577,1,
+	-16384,13,584,1,-16384,27,611,1,-16384,15,627,1,-16384,13,641,1,
+	-16384,14,722,1,-16384,75,732,1,-16384,82,977,1,-16384,85,901,1,
+	-16384,27,929,1,-16384,41,1155,1,-16384,3,1082,1,-16384,3,1072,1,
+	1047,1,-16384,2,983,1,-16384,47,1033,1,-16384,133,1165,1,-16384,5,
+	1327,1,-16384,2,1174,1,-16384,10,1306,1,-16384,3,1191,1,-16384,4,
+	1195,1,-16384,33,1230,1,-16384,4,1234,1,-16384,33,1269,1,-16384,4,
+	1273,1,-16384,36,1310,1,-16384,35,1640,1,-16384,5,1605,1,-16384,29,
+	1381,1,-16384,4,1386,1,-16384,36,1464,1,-16384,19,1443,1,-16384,4,
+	1448,1,-16384,85,1534,1,-16384,27,1562,1,-16384,71,1802,1,-16384,3,
+	1755,1,-16384,3,1745,1,1720,1,-16384,3,1647,1,-16384,58,1708,1,
+	-16384,105,1812,1,-16384,5,1932,1,-16384,2,1821,1,-16384,8,1911,1,
+	-16384,2,1835,1,-16384,4,1839,1,-16384,33,1874,1,-16384,4,1878,1,
+	-16384,36,1915,1,-16384,80,2014,1,-16384,51,2047,1,-16384,61,2109,1,
+	-16384,27,2137,1,-16384,73,2211,1,-16384,14,2226,1,-16384,4,2231,1,
+	-16384,18,2360,1,-16384,54,2305,1,-16384,1,2307,1,-16384,4,2312,1,
+	-16384,29,2342,1,2343,1,-16384,24,2368,1,-16384,18,2471,1,-16384,4,
+	2457,1,-16384,11,2406,1,-16384,25,2430,1,-16384,1,2432,1,-16384,31,
+	2464,1,2465,1,-16384,58,2634,1,-16384,75,2600,1,2601,1,-16384,17,
+	2619,1,-16384,12,2632,1,-16384,24,2739,1,-16384,4,2712,1,-16384,10,
+	2675,1,-16384,45,2719,1,2720,1,-16384,6,2727,1,-16384,63,2798,1,
+	-16384,13,2805,1,-16384,14,2820,1,-16384,8,2829,1,-16384,11,2841,1,
+	-16384,5,2847,1,-16384,7,2855,1,-16384,7,2863,1,-16384,18,2882,1,
+	-16384,25,2917,1,-16384,16,2932,1,-16384,14,2940,1,-16384,34,2975,1,
+	-16384,16,2992,1,-16384,45,3038,1,-16384,17,3056,1,-16384,63,3119,1,
+	3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,
+	18,1,1,1,3119,1,-16384,271,275,1,-16384,10,290,1,-16384,19,
+	310,1,-16384,19,326,1,-16384,44,371,1,-16384,43,415,1,-16384,85,
+	501,1,-16384,58,560,1,-16384,24,585,1,-16384,18,640,1,-16384,43,
+	655,1,-16384,9,659,1,-16384,30,690,1,-16384,33,723,1,-16384,91,
+	978,1,-16384,11,828,1,-16384,12,841,1,-16384,219,1060,1,-16384,12,
+	1073,1,-16384,137,1211,1,-16384,38,1250,1,-16384,38,1289,1,-16384,28,
+	1318,1,-16384,26,1641,1,-16384,12,1394,1,-16384,47,1407,1,-16384,181,
+	1588,1,-16384,62,1651,1,-16384,81,1733,1,-16384,12,1746,1,-16384,108,
+	1855,1,-16384,38,1894,1,-16384,28,1923,1,-16384,34,1959,1,-16384,19,
+	1979,1,-16384,184,2163,1,-16384,81,2394,1,-16384,2,2257,1,-16384,11,
+	2265,1,-16384,14,2276,1,-16384,141,2417,1,-16384,54,2473,1,-16384,49,
+	2531,1,-16384,11,2539,1,-16384,14,2550,1,-16384,136,2686,1,-16384,53,
+	2741,1,-16384,48,2790,1,-16384,12,2802,1,-16384,7,2810,1,-16384,10,
+	2821,1,-16384,8,2830,1,-16384,17,2848,1,-16384,45,2894,1,-16384,78,
+	2973,1,-16384,114,3089,1,3097,1,-16384,2,3089,1,-16384,4,3097,1,
+	-16384,6,3097,2,-16384,11,3089,1,-16384,1,3089,1,3119,1,3120,1,
+	-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,19,1,
+	1,1,3119,1,-16384,647,769,1,-16384,169,882,1,-16384,151,1114,1,
+	-16384,378,1514,1,-16384,283,1782,1,-16384,311,1955,1,-16384,2,2086,1,
+	-16384,42,1996,1,-16384,257,2345,1,-16384,7,2266,1,-16384,128,2467,1,
+	-16384,7,2402,1,-16384,128,2603,1,-16384,7,2540,1,-16384,124,2722,1,
+	-16384,6,2671,1,-16384,453,3119,1,3120,1,-16384,1,3120,1,-16384,4,
+	3119,1,-16384,1,1,1,-16384,4,20,1,1,1,3119,1,-16384,4,
+	2908,1,-16384,1,2828,1,-16384,12,369,1,-16384,17,41,1,-16384,6,
+	48,1,-16384,18,67,1,-16384,18,86,1,-16384,6,93,1,-16384,18,
+	112,1,-16384,18,131,1,-16384,6,138,1,-16384,18,157,1,-16384,19,
+	177,1,-16384,6,184,1,-16384,18,203,1,-16384,18,257,1,-16384,2,
+	225,1,-16384,2,228,1,-16384,59,288,1,-16384,19,308,1,-16384,41,
+	350,1,-16384,6,357,1,-16384,11,375,1,-16384,26,407,1,-16384,24,
+	421,1,-16384,2,424,1,-16384,25,453,1,451,1,-16384,11,463,1,
+	-16384,20,484,1,-16384,6,491,1,-16384,14,515,1,-16384,31,538,1,
+	-16384,6,553,1,-16384,64,614,1,-16384,31,642,1,-16384,5,656,1,
+	-16384,10,679,1,-16384,68,730,1,-16384,2,731,1,-16384,40,772,1,
+	-16384,22,795,1,-16384,5,801,1,-16384,13,979,1,-16384,2,825,1,
+	-16384,9,835,1,-16384,56,887,1,-16384,78,964,1,-16384,13,1077,1,
+	-16384,3,985,1,-16384,1,984,1,-16384,45,1042,1,-16384,3,1034,1,
+	-16384,14,1050,1,-16384,9,1059,1,-16384,1,1061,1,-16384,108,1171,1,
+	-16384,4,1175,1,-16384,16,1207,1,-16384,3,1196,1,-16384,34,1246,1,
+	-16384,3,1235,1,-16384,34,1285,1,-16384,3,1274,1,-16384,32,1316,1,
+	-16384,3,1311,1,-16384,33,1642,1,-16384,2,1356,1,-16384,10,1359,1,
+	-16384,20,1380,1,-16384,4,1385,1,-16384,8,1401,1,-16384,30,1425,1,
+	-16384,16,1442,1,-16384,4,1447,1,-16384,69,1520,1,-16384,73,1591,1,
+	-16384,35,1627,1,-16384,13,1750,1,-16384,3,1660,1,1649,1,-16384,1,
+	1648,1,-16384,56,1715,1,-16384,3,1709,1,-16384,12,1723,1,-16384,9,
+	1732,1,-16384,1,1734,1,-16384,82,1818,1,-16384,4,1822,1,-16384,13,
+	1851,1,-16384,3,1840,1,-16384,34,1890,1,-16384,3,1879,1,-16384,32,
+	1921,1,-16384,3,1916,1,-16384,31,1956,1,-16384,10,1973,1,-16384,42,
+	2002,1,-16384,32,2035,1,-16384,7,2045,1,-16384,2,2046,1,-16384,42,
+	2092,1,-16384,76,2166,1,-16384,24,2191,1,-16384,5,2197,1,-16384,42,
+	2240,1,-16384,4,2395,1,-16384,2,2258,1,-16384,9,2304,1,-16384,2,
+	2261,1,-16384,5,2269,1,-16384,58,2327,1,-16384,17,2344,1,-16384,3,
+	2348,1,-16384,15,2364,1,-16384,30,2429,1,-16384,2,2398,1,-16384,4,
+	2409,1,-16384,3,2407,1,-16384,8,2416,1,-16384,1,2418,1,-16384,26,
+	2446,1,-16384,20,2466,1,-16384,15,2482,1,-16384,36,2664,1,-16384,2,
+	2532,1,-16384,12,2535,1,-16384,5,2543,1,-16384,42,2585,1,-16384,17,
+	2602,1,-16384,3,2606,1,-16384,24,2631,1,-16384,6,2638,1,-16384,28,
+	2667,1,-16384,4,2678,1,-16384,3,2676,1,-16384,8,2685,1,-16384,1,
+	2687,1,-16384,12,2701,1,-16384,20,2721,1,-16384,28,2750,1,-16384,42,
+	2793,1,-16384,1,2795,1,-16384,3,2799,1,-16384,19,2819,1,-16384,5,
+	2825,1,-16384,8,2834,1,-16384,11,2846,1,-16384,42,2889,1,-16384,32,
+	2922,1,-16384,7,2930,1,-16384,2,2933,1,-16384,18,2952,1,-16384,2,
+	2958,1,-16384,4,2971,1,-16384,10,2974,1,-16384,9,2981,1,-16384,3,
+	3012,1,-16384,53,3039,1,-16384,28,3068,1,-16384,51,3119,1,3120,1,
+	-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,21,1,
+	1,1,3119,1,-16384,3,2938,1,-16384,29,38,1,-16384,44,83,1,
+	-16384,44,128,1,-16384,45,174,1,-16384,42,222,1,-16384,51,274,1,
+	-16384,2,271,1,-16384,12,285,1,-16384,14,305,1,-16384,2,302,1,
+	-16384,16,325,1,-16384,2,322,1,-16384,12,335,1,-16384,3,339,1,
+	-16384,53,397,1,-16384,51,447,1,-16384,14,460,1,-16384,7,472,1,
+	-16384,27,496,1,-16384,44,546,1,-16384,47,590,1,-16384,27,617,1,
+	-16384,16,634,1,-16384,13,657,1,-16384,20,669,1,-16384,3,673,1,
+	-16384,12,686,1,-16384,18,706,1,-16384,10,716,1,-16384,24,741,1,
+	-16384,5,747,1,-16384,3,751,1,-16384,4,756,1,-16384,2,759,1,
+	-16384,4,764,1,-16384,2,767,1,-16384,14,782,1,-16384,5,788,1,
+	-16384,2,812,1,-16384,14,806,1,-16384,3,810,1,-16384,4,980,1,
+	-16384,2,826,1,-16384,18,837,1,-16384,22,860,1,-16384,12,873,1,
+	-16384,1,875,1,-16384,3,879,1,-16384,1,881,1,-16384,28,910,1,
+	-16384,11,922,1,-16384,15,938,1,-16384,11,950,1,-16384,5,956,1,
+	-16384,2,968,1,-16384,30,991,1,-16384,17,1008,1,-16384,3,1012,1,
+	-16384,10,1023,1,-16384,3,1027,1,-16384,16,1044,1,-16384,9,1054,1,
+	-16384,30,1085,1,-16384,7,1093,1,-16384,3,1097,1,-16384,3,1101,1,
+	-16384,2,1104,1,-16384,4,1109,1,-16384,2,1112,1,-16384,11,1125,1,
+	-16384,13,1138,1,-16384,2,1141,1,-16384,2,1144,1,-16384,2,1147,1,
+	-16384,4,1152,1,-16384,6,1159,1,-16384,10,1172,1,-16384,14,1307,1,
+	-16384,3,1192,1,-16384,38,1231,1,-16384,38,1270,1,-16384,77,1643,1,
+	-16384,2,1357,1,-16384,15,1364,1,-16384,10,1375,1,-16384,15,1391,1,
+	-16384,11,1403,1,-16384,33,1437,1,-16384,15,1453,1,-16384,4,1458,1,
+	-16384,24,1483,1,-16384,8,1492,1,-16384,3,1496,1,-16384,4,1501,1,
+	-16384,2,1504,1,-16384,4,1509,1,-16384,2,1512,1,-16384,30,1543,1,
+	-16384,11,1555,1,-16384,15,1571,1,-16384,11,1583,1,-16384,10,1594,1,
+	-16384,8,1603,1,-16384,10,1614,1,-16384,4,1619,1,-16384,2,1631,1,
+	-16384,42,1666,1,-16384,17,1683,1,-16384,3,1687,1,-16384,10,1698,1,
+	-16384,3,1702,1,-16384,14,1717,1,-16384,9,1727,1,-16384,30,1758,1,
+	-16384,6,1765,1,-16384,3,1769,1,-16384,2,1772,1,-16384,4,1777,1,
+	-16384,2,1780,1,-16384,10,1791,1,-16384,2,1794,1,-16384,4,1799,1,
+	-16384,6,1806,1,-16384,10,1819,1,-16384,12,1912,1,-16384,2,1836,1,
+	-16384,38,1875,1,-16384,75,1957,1,-16384,14,1963,1,-16384,3,1967,1,
+	-16384,7,1975,1,-16384,28,2004,1,-16384,3,2008,1,-16384,20,2029,1,
+	-16384,7,2037,1,-16384,3,2041,1,-16384,14,2056,1,-16384,7,2064,1,
+	-16384,3,2068,1,-16384,4,2073,1,-16384,2,2076,1,-16384,4,2081,1,
+	-16384,2,2084,1,-16384,17,2102,1,-16384,15,2118,1,-16384,11,2130,1,
+	-16384,15,2146,1,-16384,11,2158,1,-16384,10,2169,1,-16384,8,2178,1,
+	-16384,5,2184,1,-16384,2,2208,1,-16384,14,2202,1,-16384,3,2206,1,
+	-16384,9,2217,1,-16384,28,2396,1,-16384,2,2259,1,-16384,80,2329,1,
+	-16384,47,2377,1,-16384,4,2384,1,-16384,65,2448,1,-16384,24,2479,1,
+	-16384,1,2475,1,-16384,9,2486,1,-16384,18,2504,1,-16384,3,2508,1,
+	-16384,5,2516,1,-16384,4,2665,1,-16384,2,2533,1,-16384,64,2587,1,
+	-16384,59,2647,1,-16384,4,2654,1,-16384,50,2703,1,-16384,37,2747,1,
+	-16384,1,2743,1,-16384,9,2754,1,-16384,18,2772,1,-16384,3,2776,1,
+	-16384,5,2784,1,-16384,4,2814,1,-16384,65,2853,1,-16384,4,2858,1,
+	-16384,80,2950,1,-16384,37,2977,1,-16384,75,3053,1,-16384,66,3119,1,
+	3120,1,-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,
+	22,1,1,1,3119,1,-16384,3,2939,1,-16384,6,605,1,-16384,7,
+	419,1,-16384,5,28,1,-16384,10,39,1,-16384,6,46,1,-16384,18,
+	65,1,-16384,18,84,1,-16384,6,91,1,-16384,18,110,1,-16384,18,
+	129,1,-16384,6,136,1,-16384,18,155,1,-16384,19,175,1,-16384,6,
+	182,1,-16384,18,201,1,-16384,21,226,1,-16384,35,259,1,-16384,18,
+	278,1,-16384,14,293,1,-16384,19,313,1,-16384,15,329,1,-16384,6,
+	336,1,-16384,1,338,1,-16384,5,344,1,-16384,4,349,1,-16384,5,
+	355,1,-16384,43,402,1,-16384,5,405,1,-16384,1,410,1,-16384,10,
+	428,1,-16384,3,422,1,-16384,20,443,1,-16384,1,448,1,-16384,12,
+	458,1,-16384,2,461,1,-16384,20,482,1,-16384,5,488,1,-16384,9,
+	498,1,-16384,18,517,1,-16384,3,521,1,-16384,9,531,1,-16384,10,
+	562,1,-16384,9,552,1,-16384,19,572,1,-16384,5,578,1,-16384,10,
+	591,1,-16384,5,595,1,-16384,1,597,1,-16384,7,609,1,-16384,17,
+	623,1,-16384,5,629,1,-16384,2,632,1,-16384,4,637,1,-16384,5,
+	643,1,-16384,8,762,1,754,1,-16384,17,671,1,-16384,5,677,1,
+	-16384,43,721,1,-16384,4,726,1,-16384,44,771,1,-16384,3,775,1,
+	-16384,9,785,1,-16384,14,800,1,-16384,7,808,1,-16384,6,981,1,
+	-16384,6,877,1,871,1,-16384,9,833,1,-16384,31,865,1,-16384,18,
+	884,1,-16384,5,890,1,-16384,62,953,1,-16384,9,963,1,-16384,6,
+	1164,1,1156,1,-16384,2,1107,1,1083,1,-16384,5,1030,1,-16384,19,
+	1001,1,-16384,46,1048,1,-16384,8,1057,1,-16384,5,1063,1,-16384,12,
+	1076,1,-16384,39,1116,1,-16384,43,1160,1,-16384,12,1173,1,-16384,171,
+	1644,1,-16384,2,1358,1,-16384,4,1507,1,1499,1,-16384,11,1366,1,
+	-16384,32,1399,1,-16384,22,1424,1,-16384,40,1463,1,-16384,1,1465,1,
+	-16384,50,1516,1,-16384,6,1523,1,-16384,82,1606,1,-16384,9,1616,1,
+	-16384,9,1626,1,-16384,6,1811,1,1803,1,-16384,2,1775,1,1756,1,
+	-16384,5,1705,1,-16384,31,1676,1,-16384,44,1721,1,-16384,8,1730,1,
+	-16384,5,1736,1,-16384,12,1749,1,-16384,34,1784,1,-16384,22,1807,1,
+	-16384,12,1820,1,-16384,131,2079,1,2071,1,-16384,11,1965,1,-16384,5,
+	1971,1,-16384,41,2013,1,-16384,1,2015,1,-16384,23,2039,1,-16384,48,
+	2088,1,-16384,6,2095,1,-16384,85,2181,1,-16384,14,2196,1,-16384,7,
+	2204,1,-16384,5,2222,1,-16384,8,2219,1,-16384,1,2221,1,-16384,23,
+	2397,1,-16384,2,2260,1,-16384,5,2340,1,2338,1,-16384,14,2270,1,
+	-16384,2,2273,1,-16384,34,2308,1,-16384,21,2330,1,-16384,16,2347,1,
+	-16384,3,2351,1,-16384,13,2365,1,-16384,25,2462,1,2458,1,-16384,4,
+	2403,1,-16384,12,2410,1,-16384,3,2414,1,-16384,5,2420,1,-16384,12,
+	2433,1,-16384,15,2449,1,-16384,30,2510,1,-16384,2,2483,1,-16384,35,
+	2666,1,-16384,2,2534,1,-16384,5,2598,1,2596,1,-16384,14,2544,1,
+	-16384,2,2547,1,-16384,40,2588,1,-16384,16,2605,1,-16384,3,2609,1,
+	-16384,10,2620,1,-16384,18,2639,1,-16384,21,2717,1,2713,1,-16384,3,
+	2672,1,-16384,12,2679,1,-16384,3,2683,1,-16384,5,2689,1,-16384,14,
+	2704,1,-16384,23,2728,1,-16384,19,2778,1,-16384,2,2751,1,-16384,34,
+	2822,1,-16384,2,2791,1,-16384,10,2800,1,-16384,2,2803,1,-16384,4,
+	2808,1,-16384,18,2836,1,-16384,16,2844,1,-16384,6,2868,1,-16384,2,
+	2854,1,-16384,6,2861,1,-16384,30,2892,1,-16384,17,2911,1,-16384,25,
+	3066,1,-16384,16,2953,1,-16384,1,2959,1,-16384,23,2979,1,-16384,34,
+	3014,1,-16384,3,3018,1,-16384,35,3054,1,-16384,65,3119,1,3120,1,
+	-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,23,1,
+	1,1,3119,1,-16384,5,2852,1,-16384,2,2237,1,-16384,3,530,1,
+	-16384,3,486,1,-16384,250,272,1,-16384,30,303,1,-16384,19,323,1,
+	-16384,28,351,1,-16384,96,456,1,450,1,-16384,17,478,1,-16384,1,
+	469,1,-16384,5,475,1,-16384,57,533,1,-16384,124,660,1,680,1,
+	-16384,13,674,1,-16384,12,687,1,-16384,54,742,1,-16384,5,748,1,
+	-16384,3,752,1,-16384,4,757,1,-16384,2,760,1,-16384,4,765,1,
+	-16384,2,768,1,-16384,14,783,1,-16384,14,797,1,-16384,4,802,1,
+	-16384,7,811,1,-16384,13,868,1,-16384,2,829,1,-16384,9,838,1,
+	-16384,49,896,1,-16384,22,911,1,-16384,11,923,1,-16384,15,939,1,
+	-16384,11,951,1,-16384,14,965,1,-16384,10,1079,1,-16384,4,1031,1,
+	-16384,4,986,1,-16384,3,992,1,-16384,17,1009,1,-16384,3,1013,1,
+	-16384,10,1024,1,-16384,3,1028,1,-16384,16,1045,1,-16384,9,1055,1,
+	-16384,30,1086,1,-16384,7,1094,1,-16384,3,1098,1,-16384,3,1102,1,
+	-16384,2,1105,1,-16384,4,1110,1,-16384,2,1113,1,-16384,11,1126,1,
+	-16384,13,1139,1,-16384,13,1153,1,-16384,40,1203,1,-16384,4,1198,1,
+	-16384,3,1202,1,-16384,3,1206,1,-16384,2,1209,1,-16384,7,1217,1,
+	-16384,4,1222,1,-16384,2,1225,1,-16384,6,1242,1,-16384,4,1237,1,
+	-16384,3,1241,1,-16384,3,1245,1,-16384,2,1248,1,-16384,7,1256,1,
+	-16384,4,1261,1,-16384,2,1264,1,-16384,6,1281,1,-16384,4,1276,1,
+	-16384,3,1280,1,-16384,3,1284,1,-16384,2,1287,1,-16384,7,1295,1,
+	-16384,4,1300,1,-16384,2,1303,1,-16384,4,1314,1,-16384,25,1334,1,
+	-16384,2,1337,1,-16384,2,1340,1,-16384,14,1488,1,-16384,2,1395,1,
+	-16384,1,1360,1,-16384,14,1376,1,-16384,15,1392,1,-16384,11,1404,1,
+	-16384,22,1426,1,-16384,10,1438,1,-16384,15,1454,1,-16384,38,1493,1,
+	-16384,3,1497,1,-16384,4,1502,1,-16384,2,1505,1,-16384,4,1510,1,
+	-16384,2,1513,1,-16384,7,1529,1,-16384,22,1544,1,-16384,11,1556,1,
+	-16384,15,1572,1,-16384,11,1584,1,-16384,19,1604,1,-16384,24,1628,1,
+	-16384,10,1752,1,-16384,4,1706,1,-16384,16,1661,1,-16384,3,1667,1,
+	-16384,17,1684,1,-16384,3,1688,1,-16384,10,1699,1,-16384,3,1703,1,
+	-16384,14,1718,1,-16384,9,1728,1,-16384,30,1759,1,-16384,6,1766,1,
+	-16384,3,1770,1,-16384,2,1773,1,-16384,4,1778,1,-16384,2,1781,1,
+	-16384,18,1800,1,-16384,37,1847,1,-16384,4,1842,1,-16384,3,1846,1,
+	-16384,3,1850,1,-16384,2,1853,1,-16384,7,1861,1,-16384,4,1866,1,
+	-16384,2,1869,1,-16384,6,1886,1,-16384,4,1881,1,-16384,3,1885,1,
+	-16384,3,1889,1,-16384,2,1892,1,-16384,7,1900,1,-16384,4,1905,1,
+	-16384,2,1908,1,-16384,4,1919,1,-16384,24,1938,1,-16384,2,1941,1,
+	-16384,12,2060,1,-16384,3,1960,1,-16384,8,1968,1,-16384,7,1976,1,
+	-16384,24,2000,1,-16384,32,2033,1,-16384,22,2057,1,-16384,7,2065,1,
+	-16384,3,2069,1,-16384,4,2074,1,-16384,2,2077,1,-16384,4,2082,1,
+	-16384,2,2085,1,-16384,7,2104,1,-16384,9,2103,1,-16384,15,2119,1,
+	-16384,11,2131,1,-16384,15,2147,1,-16384,11,2159,1,-16384,19,2179,1,
+	-16384,14,2193,1,-16384,4,2198,1,-16384,7,2207,1,-16384,49,2333,1,
+	-16384,3,2267,1,-16384,1,2262,1,-16384,114,2378,1,-16384,15,2452,1,
+	-16384,3,2404,1,-16384,1,2399,1,-16384,85,2487,1,-16384,18,2505,1,
+	-16384,3,2509,1,-16384,21,2591,1,-16384,3,2541,1,-16384,1,2536,1,
+	-16384,110,2648,1,-16384,15,2707,1,-16384,2,2673,1,-16384,1,2668,1,
+	-16384,84,2755,1,-16384,18,2773,1,-16384,3,2777,1,-16384,65,2842,1,
+	-16384,112,2960,1,-16384,24,2980,1,-16384,6,2987,1,-16384,64,3052,1,
+	-16384,7,3060,1,-16384,59,3119,1,3120,1,-16384,1,3124,1,-16384,4,
+	3119,1,-16384,1,3131,1,-16384,4,24,1,1,1,3119,1,-16384,48,
+	52,1,-16384,18,71,1,-16384,25,97,1,-16384,18,116,1,-16384,25,
+	142,1,-16384,18,161,1,-16384,26,188,1,-16384,18,207,1,-16384,397,
+	610,1,-16384,43,793,1,-16384,500,1150,1,-16384,646,1797,1,-16384,151,
+	2189,1,-16384,408,2358,1,-16384,3,2362,1,-16384,106,2469,1,-16384,3,
+	2480,1,-16384,143,2617,1,-16384,18,2636,1,-16384,88,2725,1,-16384,15,
+	2748,1,-16384,142,2884,1,-16384,159,3044,1,-16384,75,3119,1,3120,1,
+	-16384,1,3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,25,1,
+	1,1,3119,1,-16384,374,378,1,-16384,30,409,1,-16384,45,455,1,
+	-16384,99,555,1,-16384,12,569,1,-16384,52,621,1,-16384,13,635,1,
+	-16384,22,661,1,-16384,48,707,1,-16384,25,733,1,-16384,168,902,1,
+	-16384,27,930,1,-16384,252,1183,1,-16384,161,1645,1,-16384,189,1535,1,
+	-16384,27,1563,1,-16384,28,1592,1,-16384,235,1828,1,-16384,219,2048,1,
+	-16384,61,2110,1,-16384,27,2138,1,-16384,28,2167,1,-16384,145,2313,1,
+	-16384,55,2369,1,-16384,606,2976,1,-16384,143,3119,1,3120,1,-16384,1,
+	3120,1,-16384,4,3119,1,-16384,1,1,1,-16384,4,-16402,1,1,1,
+	3119,1,-16384,1,-6,2,-16384,2,-86,1,-16384,19,-49,1,-16384,27,
+	-176,1,-177,1,-178,1,-16384,16,-164,1,-165,1,-166,1,-16384,23,
+	-185,1,-186,1,-187,1,-16384,16,-173,1,-174,1,-175,1,-16384,23,
+	-182,1,-183,1,-184,1,-16384,16,-170,1,-171,1,-172,1,-16384,24,
+	-179,1,-180,1,-181,1,-16384,16,-167,1,-168,1,-169,1,-76,1,
+	-16384,10,-467,1,-16384,3,-153,1,-16384,8,-158,1,-16384,5,-161,1,
+	-16384,5,-160,1,-16384,5,-159,1,-466,1,-16384,1,-463,1,-16384,2,
+	-142,1,-16384,8,-143,1,-144,1,-16384,5,-149,1,-16384,2,-154,1,
+	-16384,7,-163,1,-16384,3,-152,1,-16384,2,-157,1,-16384,5,-147,1,
+	-148,1,-16384,5,-162,1,-16384,3,-151,1,-16384,2,-156,1,-16384,5,
+	-145,1,-146,1,-16384,5,-150,1,-16384,2,-155,1,-16384,3,-398,1,
+	-16384,7,-468,1,-16384,1,-464,1,-16384,5,-469,1,-16384,2,-465,1,
+	-16384,9,-89,1,-16384,6,-21,1,-638,1,-16384,4,-106,1,-16384,1,
+	-48,1,-56,1,-16384,6,-99,1,-16384,2,-22,1,-16384,9,-141,1,
+	-103,1,-16384,2,-139,1,-16384,3,-104,1,-102,1,-16384,2,-105,1,
+	-16384,2,-140,1,-16384,5,-28,1,-16384,3,-73,1,-16384,8,-98,1,
+	-16384,4,-101,1,-16384,2,-110,1,-16384,8,-93,1,-16384,2,-107,1,
+	-16384,2,-30,1,-16384,4,-57,1,-16384,7,-108,1,-16384,5,-109,1,
+	-16384,2,-387,1,-16384,4,-88,1,-16384,3,-74,1,-16384,3,-29,1,
+	-16384,4,-54,1,-16384,2,-254,1,-9,1,-16384,11,-11,1,-16384,8,
+	-12,1,-16384,1,-9,1,-16384,1,-9,1,-16384,3,-58,1,-16384,3,
+	-19,1,-16384,3,-25,1,-16384,9,-134,1,-16384,2,-136,1,-16384,2,
+	-135,1,-16384,2,-138,1,-16384,2,-137,1,-16384,13,-190,1,-189,1,
+	-16384,4,-188,1,-16384,3,-634,1,-16384,1,-31,1,-16384,5,-99,1,
+	-16384,1,-98,1,-16384,1,-97,1,-16384,4,-635,1,-16384,4,-55,1,
+	-10,1,-16384,4,-51,1,-16384,5,-84,1,-16384,19,-85,1,-16384,3,
+	-24,1,-16384,2,-63,1,-16384,19,-400,1,-489,1,-16384,5,-490,1,
+	-491,1,-16384,2,-401,1,-483,1,-16384,5,-399,1,-16384,1,-484,1,
+	-485,1,-16384,11,-409,1,-16384,12,-612,1,-16384,8,-621,1,-16384,4,
+	-474,1,-16384,1,-422,1,-473,1,-16384,11,-477,1,-478,1,-16384,4,
+	-494,1,-495,1,-16384,2,-496,1,-497,1,-16384,3,-423,1,-424,1,
+	-16384,1,-427,1,-428,1,-16384,3,-425,1,-426,1,-16384,1,-429,1,
+	-430,1,-421,1,-16384,12,-407,1,-408,1,-16384,5,-476,1,-16384,7,
+	-499,1,-16384,5,-475,1,-486,1,-16384,5,-487,1,-488,1,-472,1,
+	-60,1,-16384,2,-66,1,-16384,13,-570,1,-16384,2,-404,1,-566,1,
+	-16384,2,-567,1,-568,1,-16384,11,-416,1,-16384,14,-624,1,-573,1,
+	-559,1,-16384,1,-571,1,-16384,3,-574,1,-16384,1,-576,1,-16384,3,
+	-575,1,-16384,1,-577,1,-572,1,-16384,12,-415,1,-16384,14,-578,1,
+	-580,1,-16384,10,-579,1,-581,1,-16384,14,-562,1,-564,1,-16384,10,
+	-563,1,-565,1,-16384,5,-561,1,-16384,8,-560,1,-569,1,-558,1,
+	-16384,15,-323,1,-16384,12,-367,1,-365,1,-16384,9,-394,1,-395,1,
+	-16384,2,-392,1,-393,1,-16384,3,-366,1,-364,1,-16384,4,-366,1,
+	-367,1,-16384,2,-364,1,-365,1,-16384,3,-315,1,-16384,2,-126,1,
+	-16384,2,-131,1,-133,1,-132,1,-324,1,-16384,2,-325,1,-326,1,
+	-16384,3,-327,1,-328,1,-16384,3,-319,1,-320,1,-16384,12,-379,1,
+	-16384,2,-379,1,-16384,4,-313,1,-322,1,-272,1,-16384,1,-316,1,
+	-16384,4,-273,1,-274,1,-16384,1,-112,1,-16384,4,-119,1,-120,1,
+	-16384,2,-123,1,-124,1,-16384,2,-121,1,-122,1,-16384,1,-277,1,
+	-278,1,-16384,3,-275,1,-276,1,-16384,1,-279,1,-280,1,-271,1,
+	-16384,15,-363,1,-16384,3,-362,1,-16384,3,-362,1,-363,1,-16384,1,
+	-384,1,-16384,2,-386,1,-16384,2,-385,1,-270,1,-16384,3,-317,1,
+	-318,1,-16384,3,-312,1,-16384,2,-256,1,-311,1,-16384,14,-199,1,
+	-16384,2,-202,1,-204,1,-203,1,-16384,16,-237,1,-16384,3,-244,1,
+	-16384,3,-216,1,-16384,2,-230,1,-16384,7,-251,1,-16384,4,-223,1,
+	-16384,2,-209,1,-16384,11,-239,1,-16384,3,-246,1,-16384,3,-218,1,
+	-16384,2,-232,1,-16384,7,-253,1,-16384,4,-225,1,-16384,2,-211,1,
+	-16384,11,-238,1,-16384,3,-245,1,-16384,3,-217,1,-16384,2,-231,1,
+	-16384,7,-252,1,-16384,4,-224,1,-16384,2,-210,1,-16384,7,-234,1,
+	-16384,1,-241,1,-16384,1,-213,1,-227,1,-16384,5,-248,1,-16384,2,
+	-220,1,-206,1,-16384,2,-192,1,-16384,4,-195,1,-16384,2,-197,1,
+	-16384,2,-196,1,-321,1,-314,1,-59,1,-16384,2,-65,1,-16384,34,
+	-609,1,-16384,4,-608,1,-16384,4,-604,1,-605,1,-16384,3,-547,1,
+	-16384,2,-403,1,-543,1,-16384,2,-544,1,-545,1,-16384,11,-414,1,
+	-16384,26,-616,1,-16384,4,-615,1,-16384,4,-613,1,-614,1,-16384,8,
+	-623,1,-16384,19,-631,1,-442,1,-536,1,-16384,3,-548,1,-16384,2,
+	-549,1,-550,1,-16384,2,-551,1,-552,1,-16384,3,-443,1,-444,1,
+	-16384,1,-447,1,-448,1,-16384,3,-445,1,-446,1,-16384,1,-449,1,
+	-450,1,-441,1,-16384,13,-413,1,-16384,14,-554,1,-556,1,-16384,10,
+	-555,1,-557,1,-16384,14,-539,1,-541,1,-16384,10,-540,1,-542,1,
+	-16384,18,-502,1,-503,1,-16384,9,-553,1,-16384,5,-538,1,-16384,8,
+	-537,1,-546,1,-535,1,-16384,16,-305,1,-16384,7,-357,1,-16384,2,
+	-357,1,-16384,12,-361,1,-359,1,-16384,9,-390,1,-391,1,-16384,2,
+	-388,1,-389,1,-16384,3,-360,1,-358,1,-16384,4,-360,1,-361,1,
+	-16384,2,-358,1,-359,1,-16384,3,-297,1,-16384,2,-125,1,-16384,1,
+	-129,1,-130,1,-306,1,-16384,2,-307,1,-308,1,-16384,3,-309,1,
+	-310,1,-16384,3,-301,1,-302,1,-16384,12,-378,1,-16384,2,-378,1,
+	-16384,4,-295,1,-304,1,-261,1,-16384,1,-298,1,-16384,4,-262,1,
+	-263,1,-16384,1,-111,1,-16384,3,-115,1,-116,1,-16384,2,-117,1,
+	-118,1,-16384,1,-266,1,-267,1,-16384,3,-264,1,-265,1,-16384,1,
+	-268,1,-269,1,-260,1,-16384,8,-382,1,-16384,2,-383,1,-259,1,
+	-16384,3,-299,1,-300,1,-16384,3,-294,1,-16384,2,-255,1,-293,1,
+	-16384,14,-198,1,-16384,1,-200,1,-201,1,-16384,15,-235,1,-16384,3,
+	-242,1,-16384,3,-214,1,-16384,2,-228,1,-16384,7,-249,1,-16384,4,
+	-221,1,-16384,2,-207,1,-16384,11,-236,1,-16384,3,-243,1,-16384,3,
+	-215,1,-16384,2,-229,1,-16384,7,-250,1,-16384,4,-222,1,-16384,2,
+	-208,1,-16384,7,-233,1,-16384,1,-240,1,-16384,1,-212,1,-226,1,
+	-16384,5,-247,1,-16384,2,-219,1,-205,1,-16384,2,-191,1,-16384,3,
+	-193,1,-16384,2,-194,1,-303,1,-296,1,-16384,2,-64,1,-16384,14,
+	-521,1,-16384,5,-522,1,-523,1,-16384,2,-402,1,-515,1,-16384,2,
+	-516,1,-517,1,-16384,11,-412,1,-16384,15,-629,1,-16384,8,-622,1,
+	-16384,15,-630,1,-16384,11,-506,1,-16384,1,-432,1,-505,1,-16384,11,
+	-509,1,-510,1,-16384,3,-525,1,-16384,2,-526,1,-527,1,-16384,2,
+	-528,1,-529,1,-16384,3,-433,1,-434,1,-16384,1,-437,1,-438,1,
+	-16384,3,-435,1,-436,1,-16384,1,-439,1,-440,1,-431,1,-16384,15,
+	-410,1,-411,1,-16384,14,-531,1,-533,1,-16384,10,-532,1,-534,1,
+	-16384,14,-511,1,-513,1,-16384,10,-512,1,-514,1,-16384,18,-500,1,
+	-501,1,-16384,5,-508,1,-16384,7,-530,1,-16384,5,-507,1,-518,1,
+	-16384,5,-519,1,-520,1,-504,1,-16384,5,-32,1,-16384,4,-101,1,
+	-16384,1,-100,1,-52,1,-16384,6,-97,1,-16384,4,-100,1,-16384,4,
+	-20,1,-16384,2,-70,1,-62,1,-16384,2,-68,1,-16384,17,-498,1,
+	-16384,3,-597,1,-16384,1,-595,1,-16384,2,-406,1,-16384,11,-420,1,
+	-16384,10,-620,1,-16384,2,-627,1,-16384,1,-628,1,-619,1,-16384,16,
+	-471,1,-16384,2,-602,1,-603,1,-458,1,-16384,1,-594,1,-16384,3,
+	-524,1,-16384,3,-598,1,-600,1,-601,1,-461,1,-459,1,-462,1,
+	-460,1,-16384,3,-493,1,-457,1,-16384,10,-419,1,-16384,1,-599,1,
+	-16384,18,-610,1,-611,1,-16384,1,-492,1,-16384,2,-596,1,-593,1,
+	-16384,16,-347,1,-16384,3,-351,1,-16384,2,-128,1,-16384,1,-349,1,
+	-16384,14,-381,1,-16384,2,-381,1,-16384,10,-377,1,-16384,2,-377,1,
+	-288,1,-16384,1,-344,1,-16384,3,-348,1,-16384,3,-352,1,-354,1,
+	-355,1,-291,1,-16384,1,-289,1,-16384,1,-114,1,-292,1,-290,1,
+	-16384,3,-346,1,-287,1,-16384,1,-353,1,-16384,8,-356,1,-16384,13,
+	-376,1,-374,1,-16384,4,-375,1,-373,1,-16384,4,-375,1,-376,1,
+	-16384,2,-373,1,-374,1,-258,1,-16384,1,-345,1,-16384,2,-350,1,
+	-343,1,-61,1,-16384,2,-67,1,-16384,17,-481,1,-16384,3,-586,1,
+	-16384,1,-584,1,-16384,2,-405,1,-16384,11,-418,1,-16384,10,-618,1,
+	-16384,2,-625,1,-16384,1,-626,1,-617,1,-16384,3,-591,1,-592,1,
+	-452,1,-16384,1,-583,1,-16384,3,-482,1,-16384,3,-587,1,-589,1,
+	-590,1,-455,1,-453,1,-456,1,-454,1,-16384,3,-480,1,-451,1,
+	-16384,10,-417,1,-16384,2,-588,1,-16384,14,-470,1,-16384,14,-606,1,
+	-607,1,-16384,1,-479,1,-16384,2,-585,1,-582,1,-16384,15,-333,1,
+	-16384,3,-337,1,-16384,2,-127,1,-16384,1,-335,1,-16384,14,-380,1,
+	-16384,2,-380,1,-282,1,-16384,1,-330,1,-16384,3,-334,1,-16384,3,
+	-338,1,-340,1,-341,1,-285,1,-16384,1,-283,1,-16384,1,-113,1,
+	-286,1,-284,1,-16384,3,-332,1,-281,1,-16384,2,-339,1,-16384,8,
+	-372,1,-16384,2,-372,1,-16384,8,-342,1,-16384,13,-371,1,-369,1,
+	-16384,4,-370,1,-368,1,-16384,4,-370,1,-371,1,-16384,2,-368,1,
+	-369,1,-257,1,-16384,1,-331,1,-16384,2,-336,1,-329,1,-16384,9,
+	-71,1,-16384,2,-69,1,-16384,2,-23,1,-16384,10,-77,1,-637,1,
+	-16384,2,-636,1,-27,1,-16384,4,-397,1,-16384,3,-50,1,-16384,4,
+	-96,1,-16384,4,-72,1,-16384,1,-26,1,-16384,6,-81,1,-16384,3,
+	-396,1,-16384,15,-78,1,-16384,1,-82,1,-16384,3,-639,1,-16384,3,
+	-640,1,-94,1,-16384,8,-83,1,-16384,7,-95,1,-16384,11,-87,1,
+	-16384,3,-90,1,-16384,6,-92,1,-91,1,-16384,2,-633,1,-16384,3,
+	-75,1,-16384,7,-47,1,-16384,2,-80,1,-16384,14,-632,1,-16384,19,
+	-44,1,-16384,3,-41,1,-16384,3,-42,1,-16384,4,-33,1,-16384,6,
+	-40,1,-16384,11,-35,1,-16384,6,-39,1,-16384,2,-37,1,-16384,12,
+	-34,1,-16384,6,-38,1,-16384,2,-36,1,-16384,7,-45,1,-16384,5,
+	-43,1,-16384,8,-46,1,-16384,4,-70,1,-16384,2,-53,1,-16384,2,
+	-79,1,-5,1,-16384,2,-6,1,-16384,1,-5,1,-16384,1,-5,2,
+	-16384,2,-5,1,-16384,1,-5,1,-16384,1,-5,2,-16384,1,-8,1,
+	-7,1,-16384,2,-8,1,-16384,1,-7,1,-16384,1,-7,2,-16384,2,
+	-7,1,-16384,1,-7,1,-16384,1,-7,2,-6,2,-16384,3,-9,1,
+	-16384,3,-6,1,-16384,1,-8,1,-16384,1,-8,1,3127,1,3120,1,
+	-15,1,3120,1,-16384,4,3127,1,-13,1,1,1,-16384,4,-16401,1,
+	1,1,-16384,2,-6,2,-16384,2,-86,1,-16384,19,-49,1,-16384,27,
+	-176,1,-177,1,-178,1,-16384,16,-164,1,-165,1,-166,1,-16384,23,
+	-185,1,-186,1,-187,1,-16384,16,-173,1,-174,1,-175,1,-16384,23,
+	-182,1,-183,1,-184,1,-16384,16,-170,1,-171,1,-172,1,-16384,24,
+	-179,1,-180,1,-181,1,-16384,16,-167,1,-168,1,-169,1,-76,1,
+	-16384,10,-467,1,-16384,3,-153,1,-16384,8,-158,1,-16384,5,-161,1,
+	-16384,5,-160,1,-16384,5,-159,1,-466,1,-16384,1,-463,1,-16384,2,
+	-142,1,-16384,8,-143,1,-144,1,-16384,5,-149,1,-16384,2,-154,1,
+	-16384,7,-163,1,-16384,3,-152,1,-16384,2,-157,1,-16384,5,-147,1,
+	-148,1,-16384,5,-162,1,-16384,3,-151,1,-16384,2,-156,1,-16384,5,
+	-145,1,-146,1,-16384,5,-150,1,-16384,2,-155,1,-16384,3,-398,1,
+	-16384,7,-468,1,-16384,1,-464,1,-16384,5,-469,1,-16384,2,-465,1,
+	-16384,9,-89,1,-16384,6,-21,1,-638,1,-16384,4,-106,1,-16384,1,
+	-48,1,-56,1,-16384,6,-99,1,-16384,2,-22,1,-16384,9,-141,1,
+	-103,1,-16384,2,-139,1,-16384,3,-104,1,-102,1,-16384,2,-105,1,
+	-16384,2,-140,1,-16384,5,-28,1,-16384,3,-73,1,-16384,8,-98,1,
+	-16384,4,-101,1,-16384,2,-110,1,-16384,8,-93,1,-16384,2,-107,1,
+	-16384,2,-30,1,-16384,4,-57,1,-16384,7,-108,1,-16384,5,-109,1,
+	-16384,2,-387,1,-16384,4,-88,1,-16384,3,-74,1,-16384,3,-29,1,
+	-16384,4,-54,1,-16384,2,-254,1,-9,1,-16384,11,-11,1,-16384,8,
+	-12,1,-16384,1,-9,1,-16384,1,-9,1,-16384,3,-58,1,-16384,3,
+	-19,1,-16384,3,-25,1,-16384,9,-134,1,-16384,2,-136,1,-16384,2,
+	-135,1,-16384,2,-138,1,-16384,2,-137,1,-16384,13,-190,1,-189,1,
+	-16384,4,-188,1,-16384,3,-634,1,-16384,1,-31,1,-16384,5,-99,1,
+	-16384,1,-98,1,-16384,1,-97,1,-16384,4,-635,1,-16384,4,-55,1,
+	-10,1,-16384,4,-51,1,-16384,5,-84,1,-16384,19,-85,1,-16384,3,
+	-24,1,-16384,2,-63,1,-16384,19,-400,1,-489,1,-16384,5,-490,1,
+	-491,1,-16384,2,-401,1,-483,1,-16384,5,-399,1,-16384,1,-484,1,
+	-485,1,-16384,11,-409,1,-16384,12,-612,1,-16384,8,-621,1,-16384,4,
+	-474,1,-16384,1,-422,1,-473,1,-16384,11,-477,1,-478,1,-16384,4,
+	-494,1,-495,1,-16384,2,-496,1,-497,1,-16384,3,-423,1,-424,1,
+	-16384,1,-427,1,-428,1,-16384,3,-425,1,-426,1,-16384,1,-429,1,
+	-430,1,-421,1,-16384,12,-407,1,-408,1,-16384,5,-476,1,-16384,7,
+	-499,1,-16384,5,-475,1,-486,1,-16384,5,-487,1,-488,1,-472,1,
+	-60,1,-16384,2,-66,1,-16384,13,-570,1,-16384,2,-404,1,-566,1,
+	-16384,2,-567,1,-568,1,-16384,11,-416,1,-16384,14,-624,1,-573,1,
+	-559,1,-16384,1,-571,1,-16384,3,-574,1,-16384,1,-576,1,-16384,3,
+	-575,1,-16384,1,-577,1,-572,1,-16384,12,-415,1,-16384,14,-578,1,
+	-580,1,-16384,10,-579,1,-581,1,-16384,14,-562,1,-564,1,-16384,10,
+	-563,1,-565,1,-16384,5,-561,1,-16384,8,-560,1,-569,1,-558,1,
+	-16384,15,-323,1,-16384,12,-367,1,-365,1,-16384,9,-394,1,-395,1,
+	-16384,2,-392,1,-393,1,-16384,3,-366,1,-364,1,-16384,4,-366,1,
+	-367,1,-16384,2,-364,1,-365,1,-16384,3,-315,1,-16384,2,-126,1,
+	-16384,2,-131,1,-133,1,-132,1,-324,1,-16384,2,-325,1,-326,1,
+	-16384,3,-327,1,-328,1,-16384,3,-319,1,-320,1,-16384,12,-379,1,
+	-16384,2,-379,1,-16384,4,-313,1,-322,1,-272,1,-16384,1,-316,1,
+	-16384,4,-273,1,-274,1,-16384,1,-112,1,-16384,4,-119,1,-120,1,
+	-16384,2,-123,1,-124,1,-16384,2,-121,1,-122,1,-16384,1,-277,1,
+	-278,1,-16384,3,-275,1,-276,1,-16384,1,-279,1,-280,1,-271,1,
+	-16384,15,-363,1,-16384,3,-362,1,-16384,3,-362,1,-363,1,-16384,1,
+	-384,1,-16384,2,-386,1,-16384,2,-385,1,-270,1,-16384,3,-317,1,
+	-318,1,-16384,3,-312,1,-16384,2,-256,1,-311,1,-16384,14,-199,1,
+	-16384,2,-202,1,-204,1,-203,1,-16384,16,-237,1,-16384,3,-244,1,
+	-16384,3,-216,1,-16384,2,-230,1,-16384,7,-251,1,-16384,4,-223,1,
+	-16384,2,-209,1,-16384,11,-239,1,-16384,3,-246,1,-16384,3,-218,1,
+	-16384,2,-232,1,-16384,7,-253,1,-16384,4,-225,1,-16384,2,-211,1,
+	-16384,11,-238,1,-16384,3,-245,1,-16384,3,-217,1,-16384,2,-231,1,
+	-16384,7,-252,1,-16384,4,-224,1,-16384,2,-210,1,-16384,7,-234,1,
+	-16384,1,-241,1,-16384,1,-213,1,-227,1,-16384,5,-248,1,-16384,2,
+	-220,1,-206,1,-16384,2,-192,1,-16384,4,-195,1,-16384,2,-197,1,
+	-16384,2,-196,1,-321,1,-314,1,-59,1,-16384,2,-65,1,-16384,34,
+	-609,1,-16384,4,-608,1,-16384,4,-604,1,-605,1,-16384,3,-547,1,
+	-16384,2,-403,1,-543,1,-16384,2,-544,1,-545,1,-16384,11,-414,1,
+	-16384,26,-616,1,-16384,4,-615,1,-16384,4,-613,1,-614,1,-16384,8,
+	-623,1,-16384,19,-631,1,-442,1,-536,1,-16384,3,-548,1,-16384,2,
+	-549,1,-550,1,-16384,2,-551,1,-552,1,-16384,3,-443,1,-444,1,
+	-16384,1,-447,1,-448,1,-16384,3,-445,1,-446,1,-16384,1,-449,1,
+	-450,1,-441,1,-16384,13,-413,1,-16384,14,-554,1,-556,1,-16384,10,
+	-555,1,-557,1,-16384,14,-539,1,-541,1,-16384,10,-540,1,-542,1,
+	-16384,18,-502,1,-503,1,-16384,9,-553,1,-16384,5,-538,1,-16384,8,
+	-537,1,-546,1,-535,1,-16384,16,-305,1,-16384,7,-357,1,-16384,2,
+	-357,1,-16384,12,-361,1,-359,1,-16384,9,-390,1,-391,1,-16384,2,
+	-388,1,-389,1,-16384,3,-360,1,-358,1,-16384,4,-360,1,-361,1,
+	-16384,2,-358,1,-359,1,-16384,3,-297,1,-16384,2,-125,1,-16384,1,
+	-129,1,-130,1,-306,1,-16384,2,-307,1,-308,1,-16384,3,-309,1,
+	-310,1,-16384,3,-301,1,-302,1,-16384,12,-378,1,-16384,2,-378,1,
+	-16384,4,-295,1,-304,1,-261,1,-16384,1,-298,1,-16384,4,-262,1,
+	-263,1,-16384,1,-111,1,-16384,3,-115,1,-116,1,-16384,2,-117,1,
+	-118,1,-16384,1,-266,1,-267,1,-16384,3,-264,1,-265,1,-16384,1,
+	-268,1,-269,1,-260,1,-16384,8,-382,1,-16384,2,-383,1,-259,1,
+	-16384,3,-299,1,-300,1,-16384,3,-294,1,-16384,2,-255,1,-293,1,
+	-16384,14,-198,1,-16384,1,-200,1,-201,1,-16384,15,-235,1,-16384,3,
+	-242,1,-16384,3,-214,1,-16384,2,-228,1,-16384,7,-249,1,-16384,4,
+	-221,1,-16384,2,-207,1,-16384,11,-236,1,-16384,3,-243,1,-16384,3,
+	-215,1,-16384,2,-229,1,-16384,7,-250,1,-16384,4,-222,1,-16384,2,
+	-208,1,-16384,7,-233,1,-16384,1,-240,1,-16384,1,-212,1,-226,1,
+	-16384,5,-247,1,-16384,2,-219,1,-205,1,-16384,2,-191,1,-16384,3,
+	-193,1,-16384,2,-194,1,-303,1,-296,1,-16384,2,-64,1,-16384,14,
+	-521,1,-16384,5,-522,1,-523,1,-16384,2,-402,1,-515,1,-16384,2,
+	-516,1,-517,1,-16384,11,-412,1,-16384,15,-629,1,-16384,8,-622,1,
+	-16384,15,-630,1,-16384,11,-506,1,-16384,1,-432,1,-505,1,-16384,11,
+	-509,1,-510,1,-16384,3,-525,1,-16384,2,-526,1,-527,1,-16384,2,
+	-528,1,-529,1,-16384,3,-433,1,-434,1,-16384,1,-437,1,-438,1,
+	-16384,3,-435,1,-436,1,-16384,1,-439,1,-440,1,-431,1,-16384,15,
+	-410,1,-411,1,-16384,14,-531,1,-533,1,-16384,10,-532,1,-534,1,
+	-16384,14,-511,1,-513,1,-16384,10,-512,1,-514,1,-16384,18,-500,1,
+	-501,1,-16384,5,-508,1,-16384,7,-530,1,-16384,5,-507,1,-518,1,
+	-16384,5,-519,1,-520,1,-504,1,-16384,5,-32,1,-16384,4,-101,1,
+	-16384,1,-100,1,-52,1,-16384,6,-97,1,-16384,4,-100,1,-16384,4,
+	-20,1,-16384,2,-70,1,-62,1,-16384,2,-68,1,-16384,17,-498,1,
+	-16384,3,-597,1,-16384,1,-595,1,-16384,2,-406,1,-16384,11,-420,1,
+	-16384,10,-620,1,-16384,2,-627,1,-16384,1,-628,1,-619,1,-16384,16,
+	-471,1,-16384,2,-602,1,-603,1,-458,1,-16384,1,-594,1,-16384,3,
+	-524,1,-16384,3,-598,1,-600,1,-601,1,-461,1,-459,1,-462,1,
+	-460,1,-16384,3,-493,1,-457,1,-16384,10,-419,1,-16384,1,-599,1,
+	-16384,18,-610,1,-611,1,-16384,1,-492,1,-16384,2,-596,1,-593,1,
+	-16384,16,-347,1,-16384,3,-351,1,-16384,2,-128,1,-16384,1,-349,1,
+	-16384,14,-381,1,-16384,2,-381,1,-16384,10,-377,1,-16384,2,-377,1,
+	-288,1,-16384,1,-344,1,-16384,3,-348,1,-16384,3,-352,1,-354,1,
+	-355,1,-291,1,-16384,1,-289,1,-16384,1,-114,1,-292,1,-290,1,
+	-16384,3,-346,1,-287,1,-16384,1,-353,1,-16384,8,-356,1,-16384,13,
+	-376,1,-374,1,-16384,4,-375,1,-373,1,-16384,4,-375,1,-376,1,
+	-16384,2,-373,1,-374,1,-258,1,-16384,1,-345,1,-16384,2,-350,1,
+	-343,1,-61,1,-16384,2,-67,1,-16384,17,-481,1,-16384,3,-586,1,
+	-16384,1,-584,1,-16384,2,-405,1,-16384,11,-418,1,-16384,10,-618,1,
+	-16384,2,-625,1,-16384,1,-626,1,-617,1,-16384,3,-591,1,-592,1,
+	-452,1,-16384,1,-583,1,-16384,3,-482,1,-16384,3,-587,1,-589,1,
+	-590,1,-455,1,-453,1,-456,1,-454,1,-16384,3,-480,1,-451,1,
+	-16384,10,-417,1,-16384,2,-588,1,-16384,14,-470,1,-16384,14,-606,1,
+	-607,1,-16384,1,-479,1,-16384,2,-585,1,-582,1,-16384,15,-333,1,
+	-16384,3,-337,1,-16384,2,-127,1,-16384,1,-335,1,-16384,14,-380,1,
+	-16384,2,-380,1,-282,1,-16384,1,-330,1,-16384,3,-334,1,-16384,3,
+	-338,1,-340,1,-341,1,-285,1,-16384,1,-283,1,-16384,1,-113,1,
+	-286,1,-284,1,-16384,3,-332,1,-281,1,-16384,2,-339,1,-16384,8,
+	-372,1,-16384,2,-372,1,-16384,8,-342,1,-16384,13,-371,1,-369,1,
+	-16384,4,-370,1,-368,1,-16384,4,-370,1,-371,1,-16384,2,-368,1,
+	-369,1,-257,1,-16384,1,-331,1,-16384,2,-336,1,-329,1,-16384,9,
+	-71,1,-16384,2,-69,1,-16384,2,-23,1,-16384,10,-77,1,-637,1,
+	-16384,2,-636,1,-27,1,-16384,4,-397,1,-16384,3,-50,1,-16384,4,
+	-96,1,-16384,4,-72,1,-16384,1,-26,1,-16384,6,-81,1,-16384,3,
+	-396,1,-16384,15,-78,1,-16384,1,-82,1,-16384,3,-639,1,-16384,3,
+	-640,1,-94,1,-16384,8,-83,1,-16384,7,-95,1,-16384,11,-87,1,
+	-16384,3,-90,1,-16384,6,-92,1,-91,1,-16384,2,-633,1,-16384,3,
+	-75,1,-16384,7,-47,1,-16384,2,-80,1,-16384,14,-632,1,-16384,19,
+	-44,1,-16384,3,-41,1,-16384,3,-42,1,-16384,4,-33,1,-16384,6,
+	-40,1,-16384,11,-35,1,-16384,6,-39,1,-16384,2,-37,1,-16384,12,
+	-34,1,-16384,6,-38,1,-16384,2,-36,1,-16384,7,-45,1,-16384,5,
+	-43,1,-16384,8,-46,1,-16384,4,-70,1,-16384,2,-53,1,-16384,2,
+	-79,1,-5,1,-16384,2,-6,1,-16384,1,-5,1,-16384,1,-5,2,
+	-16384,2,-5,1,-16384,1,-5,1,-16384,1,-5,2,-16384,1,-8,1,
+	-7,1,-16384,2,-8,1,-16384,1,-7,1,-16384,1,-7,2,-16384,2,
+	-7,1,-16384,1,-7,1,-16384,1,-7,2,-6,2,-16384,3,-9,1,
+	-16384,3,-6,1,-16384,1,-8,1,-16384,1,-8,1,-14,1,3120,1,
+	-15,1,3120,1,-16384,4,-14,1,-13,1,1,1,-16384,4,-16400,1,
+	1,1,-16384,2,-6,2,-16384,2,-86,1,-16384,19,-49,1,-16384,27,
+	-176,1,-177,1,-178,1,-16384,16,-164,1,-165,1,-166,1,-16384,23,
+	-185,1,-186,1,-187,1,-16384,16,-173,1,-174,1,-175,1,-16384,23,
+	-182,1,-183,1,-184,1,-16384,16,-170,1,-171,1,-172,1,-16384,24,
+	-179,1,-180,1,-181,1,-16384,16,-167,1,-168,1,-169,1,-76,1,
+	-16384,10,-467,1,-16384,3,-153,1,-16384,8,-158,1,-16384,5,-161,1,
+	-16384,5,-160,1,-16384,5,-159,1,-466,1,-16384,1,-463,1,-16384,2,
+	-142,1,-16384,8,-143,1,-144,1,-16384,5,-149,1,-16384,2,-154,1,
+	-16384,7,-163,1,-16384,3,-152,1,-16384,2,-157,1,-16384,5,-147,1,
+	-148,1,-16384,5,-162,1,-16384,3,-151,1,-16384,2,-156,1,-16384,5,
+	-145,1,-146,1,-16384,5,-150,1,-16384,2,-155,1,-16384,3,-398,1,
+	-16384,7,-468,1,-16384,1,-464,1,-16384,5,-469,1,-16384,2,-465,1,
+	-16384,9,-89,1,-16384,6,-21,1,-638,1,-16384,4,-106,1,-16384,1,
+	-48,1,-56,1,-16384,6,-99,1,-16384,2,-22,1,-16384,9,-141,1,
+	-103,1,-16384,2,-139,1,-16384,3,-104,1,-102,1,-16384,2,-105,1,
+	-16384,2,-140,1,-16384,5,-28,1,-16384,3,-73,1,-16384,8,-98,1,
+	-16384,4,-101,1,-16384,2,-110,1,-16384,8,-93,1,-16384,2,-107,1,
+	-16384,2,-30,1,-16384,4,-57,1,-16384,7,-108,1,-16384,5,-109,1,
+	-16384,2,-387,1,-16384,4,-88,1,-16384,3,-74,1,-16384,3,-29,1,
+	-16384,4,-54,1,-16384,2,-254,1,-9,1,-16384,11,-11,1,-16384,8,
+	-12,1,-16384,1,-9,1,-16384,1,-9,1,-16384,3,-58,1,-16384,3,
+	-19,1,-16384,3,-25,1,-16384,9,-134,1,-16384,2,-136,1,-16384,2,
+	-135,1,-16384,2,-138,1,-16384,2,-137,1,-16384,13,-190,1,-189,1,
+	-16384,4,-188,1,-16384,3,-634,1,-16384,1,-31,1,-16384,5,-99,1,
+	-16384,1,-98,1,-16384,1,-97,1,-16384,4,-635,1,-16384,4,-55,1,
+	-10,1,-16384,4,-51,1,-16384,5,-84,1,-16384,19,-85,1,-16384,3,
+	-24,1,-16384,2,-63,1,-16384,19,-400,1,-489,1,-16384,5,-490,1,
+	-491,1,-16384,2,-401,1,-483,1,-16384,5,-399,1,-16384,1,-484,1,
+	-485,1,-16384,11,-409,1,-16384,12,-612,1,-16384,8,-621,1,-16384,4,
+	-474,1,-16384,1,-422,1,-473,1,-16384,11,-477,1,-478,1,-16384,4,
+	-494,1,-495,1,-16384,2,-496,1,-497,1,-16384,3,-423,1,-424,1,
+	-16384,1,-427,1,-428,1,-16384,3,-425,1,-426,1,-16384,1,-429,1,
+	-430,1,-421,1,-16384,12,-407,1,-408,1,-16384,5,-476,1,-16384,7,
+	-499,1,-16384,5,-475,1,-486,1,-16384,5,-487,1,-488,1,-472,1,
+	-60,1,-16384,2,-66,1,-16384,13,-570,1,-16384,2,-404,1,-566,1,
+	-16384,2,-567,1,-568,1,-16384,11,-416,1,-16384,14,-624,1,-573,1,
+	-559,1,-16384,1,-571,1,-16384,3,-574,1,-16384,1,-576,1,-16384,3,
+	-575,1,-16384,1,-577,1,-572,1,-16384,12,-415,1,-16384,14,-578,1,
+	-580,1,-16384,10,-579,1,-581,1,-16384,14,-562,1,-564,1,-16384,10,
+	-563,1,-565,1,-16384,5,-561,1,-16384,8,-560,1,-569,1,-558,1,
+	-16384,15,-323,1,-16384,12,-367,1,-365,1,-16384,9,-394,1,-395,1,
+	-16384,2,-392,1,-393,1,-16384,3,-366,1,-364,1,-16384,4,-366,1,
+	-367,1,-16384,2,-364,1,-365,1,-16384,3,-315,1,-16384,2,-126,1,
+	-16384,2,-131,1,-133,1,-132,1,-324,1,-16384,2,-325,1,-326,1,
+	-16384,3,-327,1,-328,1,-16384,3,-319,1,-320,1,-16384,12,-379,1,
+	-16384,2,-379,1,-16384,4,-313,1,-322,1,-272,1,-16384,1,-316,1,
+	-16384,4,-273,1,-274,1,-16384,1,-112,1,-16384,4,-119,1,-120,1,
+	-16384,2,-123,1,-124,1,-16384,2,-121,1,-122,1,-16384,1,-277,1,
+	-278,1,-16384,3,-275,1,-276,1,-16384,1,-279,1,-280,1,-271,1,
+	-16384,15,-363,1,-16384,3,-362,1,-16384,3,-362,1,-363,1,-16384,1,
+	-384,1,-16384,2,-386,1,-16384,2,-385,1,-270,1,-16384,3,-317,1,
+	-318,1,-16384,3,-312,1,-16384,2,-256,1,-311,1,-16384,14,-199,1,
+	-16384,2,-202,1,-204,1,-203,1,-16384,16,-237,1,-16384,3,-244,1,
+	-16384,3,-216,1,-16384,2,-230,1,-16384,7,-251,1,-16384,4,-223,1,
+	-16384,2,-209,1,-16384,11,-239,1,-16384,3,-246,1,-16384,3,-218,1,
+	-16384,2,-232,1,-16384,7,-253,1,-16384,4,-225,1,-16384,2,-211,1,
+	-16384,11,-238,1,-16384,3,-245,1,-16384,3,-217,1,-16384,2,-231,1,
+	-16384,7,-252,1,-16384,4,-224,1,-16384,2,-210,1,-16384,7,-234,1,
+	-16384,1,-241,1,-16384,1,-213,1,-227,1,-16384,5,-248,1,-16384,2,
+	-220,1,-206,1,-16384,2,-192,1,-16384,4,-195,1,-16384,2,-197,1,
+	-16384,2,-196,1,-321,1,-314,1,-59,1,-16384,2,-65,1,-16384,34,
+	-609,1,-16384,4,-608,1,-16384,4,-604,1,-605,1,-16384,3,-547,1,
+	-16384,2,-403,1,-543,1,-16384,2,-544,1,-545,1,-16384,11,-414,1,
+	-16384,26,-616,1,-16384,4,-615,1,-16384,4,-613,1,-614,1,-16384,8,
+	-623,1,-16384,19,-631,1,-442,1,-536,1,-16384,3,-548,1,-16384,2,
+	-549,1,-550,1,-16384,2,-551,1,-552,1,-16384,3,-443,1,-444,1,
+	-16384,1,-447,1,-448,1,-16384,3,-445,1,-446,1,-16384,1,-449,1,
+	-450,1,-441,1,-16384,13,-413,1,-16384,14,-554,1,-556,1,-16384,10,
+	-555,1,-557,1,-16384,14,-539,1,-541,1,-16384,10,-540,1,-542,1,
+	-16384,18,-502,1,-503,1,-16384,9,-553,1,-16384,5,-538,1,-16384,8,
+	-537,1,-546,1,-535,1,-16384,16,-305,1,-16384,7,-357,1,-16384,2,
+	-357,1,-16384,12,-361,1,-359,1,-16384,9,-390,1,-391,1,-16384,2,
+	-388,1,-389,1,-16384,3,-360,1,-358,1,-16384,4,-360,1,-361,1,
+	-16384,2,-358,1,-359,1,-16384,3,-297,1,-16384,2,-125,1,-16384,1,
+	-129,1,-130,1,-306,1,-16384,2,-307,1,-308,1,-16384,3,-309,1,
+	-310,1,-16384,3,-301,1,-302,1,-16384,12,-378,1,-16384,2,-378,1,
+	-16384,4,-295,1,-304,1,-261,1,-16384,1,-298,1,-16384,4,-262,1,
+	-263,1,-16384,1,-111,1,-16384,3,-115,1,-116,1,-16384,2,-117,1,
+	-118,1,-16384,1,-266,1,-267,1,-16384,3,-264,1,-265,1,-16384,1,
+	-268,1,-269,1,-260,1,-16384,8,-382,1,-16384,2,-383,1,-259,1,
+	-16384,3,-299,1,-300,1,-16384,3,-294,1,-16384,2,-255,1,-293,1,
+	-16384,14,-198,1,-16384,1,-200,1,-201,1,-16384,15,-235,1,-16384,3,
+	-242,1,-16384,3,-214,1,-16384,2,-228,1,-16384,7,-249,1,-16384,4,
+	-221,1,-16384,2,-207,1,-16384,11,-236,1,-16384,3,-243,1,-16384,3,
+	-215,1,-16384,2,-229,1,-16384,7,-250,1,-16384,4,-222,1,-16384,2,
+	-208,1,-16384,7,-233,1,-16384,1,-240,1,-16384,1,-212,1,-226,1,
+	-16384,5,-247,1,-16384,2,-219,1,-205,1,-16384,2,-191,1,-16384,3,
+	-193,1,-16384,2,-194,1,-303,1,-296,1,-16384,2,-64,1,-16384,14,
+	-521,1,-16384,5,-522,1,-523,1,-16384,2,-402,1,-515,1,-16384,2,
+	-516,1,-517,1,-16384,11,-412,1,-16384,15,-629,1,-16384,8,-622,1,
+	-16384,15,-630,1,-16384,11,-506,1,-16384,1,-432,1,-505,1,-16384,11,
+	-509,1,-510,1,-16384,3,-525,1,-16384,2,-526,1,-527,1,-16384,2,
+	-528,1,-529,1,-16384,3,-433,1,-434,1,-16384,1,-437,1,-438,1,
+	-16384,3,-435,1,-436,1,-16384,1,-439,1,-440,1,-431,1,-16384,15,
+	-410,1,-411,1,-16384,14,-531,1,-533,1,-16384,10,-532,1,-534,1,
+	-16384,14,-511,1,-513,1,-16384,10,-512,1,-514,1,-16384,18,-500,1,
+	-501,1,-16384,5,-508,1,-16384,7,-530,1,-16384,5,-507,1,-518,1,
+	-16384,5,-519,1,-520,1,-504,1,-16384,5,-32,1,-16384,4,-101,1,
+	-16384,1,-100,1,-52,1,-16384,6,-97,1,-16384,4,-100,1,-16384,4,
+	-20,1,-16384,2,-70,1,-62,1,-16384,2,-68,1,-16384,17,-498,1,
+	-16384,3,-597,1,-16384,1,-595,1,-16384,2,-406,1,-16384,11,-420,1,
+	-16384,10,-620,1,-16384,2,-627,1,-16384,1,-628,1,-619,1,-16384,16,
+	-471,1,-16384,2,-602,1,-603,1,-458,1,-16384,1,-594,1,-16384,3,
+	-524,1,-16384,3,-598,1,-600,1,-601,1,-461,1,-459,1,-462,1,
+	-460,1,-16384,3,-493,1,-457,1,-16384,10,-419,1,-16384,1,-599,1,
+	-16384,18,-610,1,-611,1,-16384,1,-492,1,-16384,2,-596,1,-593,1,
+	-16384,16,-347,1,-16384,3,-351,1,-16384,2,-128,1,-16384,1,-349,1,
+	-16384,14,-381,1,-16384,2,-381,1,-16384,10,-377,1,-16384,2,-377,1,
+	-288,1,-16384,1,-344,1,-16384,3,-348,1,-16384,3,-352,1,-354,1,
+	-355,1,-291,1,-16384,1,-289,1,-16384,1,-114,1,-292,1,-290,1,
+	-16384,3,-346,1,-287,1,-16384,1,-353,1,-16384,8,-356,1,-16384,13,
+	-376,1,-374,1,-16384,4,-375,1,-373,1,-16384,4,-375,1,-376,1,
+	-16384,2,-373,1,-374,1,-258,1,-16384,1,-345,1,-16384,2,-350,1,
+	-343,1,-61,1,-16384,2,-67,1,-16384,17,-481,1,-16384,3,-586,1,
+	-16384,1,-584,1,-16384,2,-405,1,-16384,11,-418,1,-16384,10,-618,1,
+	-16384,2,-625,1,-16384,1,-626,1,-617,1,-16384,3,-591,1,-592,1,
+	-452,1,-16384,1,-583,1,-16384,3,-482,1,-16384,3,-587,1,-589,1,
+	-590,1,-455,1,-453,1,-456,1,-454,1,-16384,3,-480,1,-451,1,
+	-16384,10,-417,1,-16384,2,-588,1,-16384,14,-470,1,-16384,14,-606,1,
+	-607,1,-16384,1,-479,1,-16384,2,-585,1,-582,1,-16384,15,-333,1,
+	-16384,3,-337,1,-16384,2,-127,1,-16384,1,-335,1,-16384,14,-380,1,
+	-16384,2,-380,1,-282,1,-16384,1,-330,1,-16384,3,-334,1,-16384,3,
+	-338,1,-340,1,-341,1,-285,1,-16384,1,-283,1,-16384,1,-113,1,
+	-286,1,-284,1,-16384,3,-332,1,-281,1,-16384,2,-339,1,-16384,8,
+	-372,1,-16384,2,-372,1,-16384,8,-342,1,-16384,13,-371,1,-369,1,
+	-16384,4,-370,1,-368,1,-16384,4,-370,1,-371,1,-16384,2,-368,1,
+	-369,1,-257,1,-16384,1,-331,1,-16384,2,-336,1,-329,1,-16384,9,
+	-71,1,-16384,2,-69,1,-16384,2,-23,1,-16384,10,-77,1,-637,1,
+	-16384,2,-636,1,-27,1,-16384,4,-397,1,-16384,3,-50,1,-16384,4,
+	-96,1,-16384,4,-72,1,-16384,1,-26,1,-16384,6,-81,1,-16384,3,
+	-396,1,-16384,15,-78,1,-16384,1,-82,1,-16384,3,-639,1,-16384,3,
+	-640,1,-94,1,-16384,8,-83,1,-16384,7,-95,1,-16384,11,-87,1,
+	-16384,3,-90,1,-16384,6,-92,1,-91,1,-16384,2,-633,1,-16384,3,
+	-75,1,-16384,7,-47,1,-16384,2,-80,1,-16384,14,-632,1,-16384,19,
+	-44,1,-16384,3,-41,1,-16384,3,-42,1,-16384,4,-33,1,-16384,6,
+	-40,1,-16384,11,-35,1,-16384,6,-39,1,-16384,2,-37,1,-16384,12,
+	-34,1,-16384,6,-38,1,-16384,2,-36,1,-16384,7,-45,1,-16384,5,
+	-43,1,-16384,8,-46,1,-16384,4,-70,1,-16384,2,-53,1,-16384,2,
+	-79,1,-5,1,-16384,2,-6,1,-16384,1,-5,1,-16384,1,-5,2,
+	-16384,2,-5,1,-16384,1,-5,1,-16384,1,-5,2,-16384,1,-8,1,
+	-7,1,-16384,2,-8,1,-16384,1,-7,1,-16384,1,-7,2,-16384,2,
+	-7,1,-16384,1,-7,1,-16384,1,-7,2,-6,2,-16384,3,-9,1,
+	-16384,3,-6,1,-16384,1,-8,1,-16384,1,-8,1,-14,1,3120,1,
+	-15,1,3120,1,-16384,4,-14,1,-13,1,1,1,-16384,4,
+};
+
+// clang-format on
@@ -291,6 +291,7 @@ UnresolvedFunctionType WAST::parseFunctionTypeRefAndOrDecl(
 }
 
 IndexedFunctionType WAST::resolveFunctionType(ModuleState* moduleState,
+											  ParseState* parseState,
 											  const UnresolvedFunctionType& unresolvedType)
 {
 	if(!unresolvedType.reference)
@@ -298,7 +299,7 @@ IndexedFunctionType WAST::resolveFunctionType(ModuleState* moduleState,
 	else
 	{
 		// Resolve the referenced type.
-		const Uptr referencedFunctionTypeIndex = resolveRef(moduleState->parseState,
+		const Uptr referencedFunctionTypeIndex = resolveRef(parseState,
 															moduleState->typeNameToIndexMap,
 															moduleState->module.types.size(),
 															unresolvedType.reference);
@@ -314,7 +315,7 @@ IndexedFunctionType WAST::resolveFunctionType(ModuleState* moduleState,
 					  != unresolvedType.explicitType)
 			{
 				parseErrorf(
-					moduleState->parseState,
+					parseState,
 					unresolvedType.reference.token,
 					"referenced function type (%s) does not match declared parameters and "
 					"results (%s)",
@@ -330,15 +331,15 @@ IndexedFunctionType WAST::resolveFunctionType(ModuleState* moduleState,
 IndexedFunctionType WAST::getUniqueFunctionTypeIndex(ModuleState* moduleState,
 													 FunctionType functionType)
 {
+	const Uptr* existingFunctionTypeIndex = moduleState->functionTypeToIndexMap.get(functionType);
+	if(existingFunctionTypeIndex) { return IndexedFunctionType{*existingFunctionTypeIndex}; }
+
 	// If this type is not in the module's type table yet, add it.
-	Uptr& functionTypeIndex
-		= moduleState->functionTypeToIndexMap.getOrAdd(functionType, UINTPTR_MAX);
-	if(functionTypeIndex == UINTPTR_MAX)
-	{
-		functionTypeIndex = moduleState->module.types.size();
-		moduleState->module.types.push_back(functionType);
-		moduleState->disassemblyNames.types.emplace_back();
-	}
+	if(moduleState->isParsingFunctionBodiesInParallel) { throw DeferFunctionBodyException(); }
+	const Uptr functionTypeIndex = moduleState->module.types.size();
+	moduleState->functionTypeToIndexMap.addOrFail(functionType, functionTypeIndex);
+	moduleState->module.types.push_back(functionType);
+	moduleState->disassemblyNames.types.emplace_back();
 	return IndexedFunctionType{functionTypeIndex};
 }
 
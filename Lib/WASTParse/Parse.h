@@ -22,6 +22,12 @@ namespace WAVM { namespace WAST {
 	{
 	};
 
+	// Thrown while parsing function bodies in parallel to defer parsing a function body until the
+	// other bodies have been parsed: see ModuleState::isParsingFunctionBodiesInParallel.
+	struct DeferFunctionBodyException
+	{
+	};
+
 	// Like WAST::Error, but only has an offset in the input string instead of a full
 	// TextFileLocus.
 	struct UnresolvedError
@@ -42,6 +48,10 @@ namespace WAVM { namespace WAST {
 
 		std::vector<std::unique_ptr<std::string>> quotedNameStrings;
 
+		// The maximum number of threads to parse function bodies on, or 0 to choose it from the
+		// number of hardware threads and the size of the module.
+		Uptr maxFunctionBodyThreads{0};
+
 		ParseState(const char* inString, const LineInfo* inLineInfo)
 		: string(inString), lineInfo(inLineInfo)
 		{
@@ -158,8 +168,17 @@ namespace WAVM { namespace WAST {
 		// Thunks that are called after parsing all declarations.
 		std::vector<std::function<void(ModuleState*)>> postDeclarationCallbacks;
 
-		// Thunks that are called to parse function bodies.
-		std::vector<std::function<void(ModuleState*)>> functionBodyCallbacks;
+		// Thunks that are called to parse function bodies. The bodies may be parsed on multiple
+		// threads, so the thunks report errors to the ParseState they are passed, and must not
+		// modify any module state other than the definition and disassembly names of the function
+		// they parse.
+		std::vector<std::function<void(ModuleState*, ParseState*)>> functionBodyCallbacks;
+
+		// While function bodies are parsed in parallel, the module's types may not be modified, so
+		// getUniqueFunctionTypeIndex throws DeferFunctionBodyException instead of adding a type.
+		// The deferred function bodies are parsed again after the others, in order, so the types
+		// are added in the same order they would be if the bodies were parsed serially.
+		bool isParsingFunctionBodiesInParallel{false};
 
 		ModuleState(ParseState* inParseState, IR::Module& inModule)
 		: parseState(inParseState)
@@ -215,6 +234,7 @@ namespace WAVM { namespace WAST {
 		NameToIndexMap& outLocalNameToIndexMap,
 		std::vector<std::string>& outLocalDisassemblyNames);
 	IR::IndexedFunctionType resolveFunctionType(ModuleState* moduleState,
+												ParseState* parseState,
 												const UnresolvedFunctionType& unresolvedType);
 	IR::IndexedFunctionType getUniqueFunctionTypeIndex(ModuleState* moduleState,
 													   IR::FunctionType functionType);
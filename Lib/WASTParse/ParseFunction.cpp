@@ -28,11 +28,12 @@ namespace WAVM { namespace WAST {
 		const Token* validationErrorToken{nullptr};
 
 		ResumableCodeValidationProxyStream(ModuleState* moduleState,
+										   ParseState* inParseState,
 										   const FunctionDef& function,
 										   InnerStream& inInnerStream)
 		: codeValidationStream(*moduleState->validationState, function)
 		, innerStream(inInnerStream)
-		, parseState(moduleState->parseState)
+		, parseState(inParseState)
 		{
 		}
 
@@ -100,14 +101,15 @@ namespace WAVM { namespace WAST {
 
 		FunctionState(const std::shared_ptr<NameToIndexMap>& inLocalNameToIndexMap,
 					  FunctionDef& inFunctionDef,
-					  ModuleState* moduleState)
+					  ModuleState* moduleState,
+					  ParseState* parseState)
 		: functionDef(inFunctionDef)
 		, localNameToIndexMap(inLocalNameToIndexMap)
 		, numLocals(inFunctionDef.nonParameterLocalTypes.size()
 					+ moduleState->module.types[inFunctionDef.type.index].params().size())
 		, branchTargetDepth(0)
 		, operationEncoder(codeByteStream)
-		, validatingCodeStream(moduleState, inFunctionDef, operationEncoder)
+		, validatingCodeStream(moduleState, parseState, inFunctionDef, operationEncoder)
 		{
 		}
 	};
@@ -396,7 +398,9 @@ static void parseImm(CursorState* cursor, CallIndirectImm& outImm)
 	NameToIndexMap paramNameToIndexMap;
 	const UnresolvedFunctionType unresolvedFunctionType
 		= parseFunctionTypeRefAndOrDecl(cursor, paramNameToIndexMap, paramDisassemblyNames);
-	outImm.type.index = resolveFunctionType(cursor->moduleState, unresolvedFunctionType).index;
+	outImm.type.index
+		= resolveFunctionType(cursor->moduleState, cursor->parseState, unresolvedFunctionType)
+			  .index;
 
 	// Disallow named parameters.
 	if(paramNameToIndexMap.size())
@@ -707,7 +711,9 @@ static void parseControlImm(CursorState* cursor,
 			// If there was a type reference, resolve it. This also verifies that if there were also
 			// params and/or results declared inline that they match the resolved type reference.
 			const Uptr referencedFunctionTypeIndex
-				= resolveFunctionType(cursor->moduleState, unresolvedFunctionType).index;
+				= resolveFunctionType(
+					  cursor->moduleState, cursor->parseState, unresolvedFunctionType)
+					  .index;
 			if(referencedFunctionTypeIndex != UINTPTR_MAX)
 			{
 				WAVM_ASSERT(referencedFunctionTypeIndex < cursor->moduleState->module.types.size());
@@ -1060,7 +1066,7 @@ FunctionDef WAST::parseFunctionDef(CursorState* cursor, const Token* funcToken)
 														 ModuleState* moduleState) {
 		// Resolve the function type and set it on the FunctionDef.
 		const IndexedFunctionType functionTypeIndex
-			= resolveFunctionType(moduleState, unresolvedFunctionType);
+			= resolveFunctionType(moduleState, moduleState->parseState, unresolvedFunctionType);
 		moduleState->module.functions.defs[functionDefIndex].type = functionTypeIndex;
 
 		// Defer parsing the body of the function until all function types have been resolved.
@@ -1069,24 +1075,36 @@ FunctionDef WAST::parseFunctionDef(CursorState* cursor, const Token* funcToken)
 													  firstBodyToken,
 													  localNameToIndexMap,
 													  localDisassemblyNames,
-													  functionTypeIndex](ModuleState* moduleState) {
+													  functionTypeIndex](ModuleState* moduleState,
+																		 ParseState* parseState) {
 			FunctionDef& functionDef = moduleState->module.functions.defs[functionDefIndex];
 			FunctionType functionType = functionTypeIndex.index == UINTPTR_MAX
 											? FunctionType()
 											: moduleState->module.types[functionTypeIndex.index];
 
+			// The body is parsed again if parsing it was deferred, so bind the local names in a
+			// copy of the parameter names instead of modifying the captured state, and discard
+			// anything a previous parse added to the FunctionDef.
+			std::shared_ptr<NameToIndexMap> functionLocalNameToIndexMap
+				= std::make_shared<NameToIndexMap>(*localNameToIndexMap);
+			std::vector<std::string> functionLocalDisassemblyNames = *localDisassemblyNames;
+			functionDef.nonParameterLocalTypes.clear();
+			functionDef.code.clear();
+			functionDef.branchTables.clear();
+			moduleState->disassemblyNames.functions[functionIndex].labels.clear();
+
 			// Parse the function's local variables.
-			CursorState functionCursorState(firstBodyToken, moduleState->parseState, moduleState);
+			CursorState functionCursorState(firstBodyToken, parseState, moduleState);
 			while(tryParseParenthesizedTagged(&functionCursorState, t_local, [&] {
 				Name localName;
 				if(tryParseName(&functionCursorState, localName))
 				{
 					bindName(
-						moduleState->parseState,
-						*localNameToIndexMap,
+						parseState,
+						*functionLocalNameToIndexMap,
 						localName,
 						functionType.params().size() + functionDef.nonParameterLocalTypes.size());
-					localDisassemblyNames->push_back(localName.getString());
+					functionLocalDisassemblyNames.push_back(localName.getString());
 					functionDef.nonParameterLocalTypes.push_back(
 						parseValueType(&functionCursorState));
 				}
@@ -1094,7 +1112,7 @@ FunctionDef WAST::parseFunctionDef(CursorState* cursor, const Token* funcToken)
 				{
 					while(functionCursorState.nextToken->type != t_rightParenthesis)
 					{
-						localDisassemblyNames->push_back(std::string());
+						functionLocalDisassemblyNames.push_back(std::string());
 						functionDef.nonParameterLocalTypes.push_back(
 							parseValueType(&functionCursorState));
 					};
@@ -1103,18 +1121,19 @@ FunctionDef WAST::parseFunctionDef(CursorState* cursor, const Token* funcToken)
 			{};
 
 			moduleState->disassemblyNames.functions[functionIndex].locals
-				= std::move(*localDisassemblyNames);
+				= std::move(functionLocalDisassemblyNames);
 
 			// Parse the function's code.
 			const Token* validationErrorToken = firstBodyToken;
 			try
 			{
-				FunctionState functionState(localNameToIndexMap, functionDef, moduleState);
+				FunctionState functionState(
+					functionLocalNameToIndexMap, functionDef, moduleState, parseState);
 				functionCursorState.functionState = &functionState;
 				try
 				{
 					parseInstrSequence(&functionCursorState, 0);
-					if(!moduleState->parseState->unresolvedErrors.size())
+					if(!parseState->unresolvedErrors.size())
 					{
 						validationErrorToken = functionCursorState.nextToken;
 						functionState.validatingCodeStream.end();
@@ -1133,7 +1152,7 @@ FunctionDef WAST::parseFunctionDef(CursorState* cursor, const Token* funcToken)
 			}
 			catch(ValidationException const& exception)
 			{
-				parseErrorf(moduleState->parseState,
+				parseErrorf(parseState,
 							validationErrorToken,
 							"validation error: %s",
 							exception.message.c_str());
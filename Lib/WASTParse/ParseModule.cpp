@@ -1,5 +1,7 @@
 #include <inttypes.h>
 #include <stdint.h>
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -19,6 +21,8 @@
 #include "WAVM/Inline/HashMap.h"
 #include "WAVM/Inline/Timing.h"
 #include "WAVM/Logging/Logging.h"
+#include "WAVM/Platform/Mutex.h"
+#include "WAVM/Platform/Thread.h"
 #include "WAVM/WASTParse/WASTParse.h"
 
 using namespace WAVM;
@@ -329,8 +333,8 @@ static void parseImport(CursorState* cursor)
 			// Resolve the function import type after all type declarations have been parsed.
 			cursor->moduleState->postTypeCallbacks.push_back(
 				[unresolvedFunctionType, importIndex](ModuleState* moduleState) {
-					moduleState->module.functions.imports[importIndex].type
-						= resolveFunctionType(moduleState, unresolvedFunctionType);
+					moduleState->module.functions.imports[importIndex].type = resolveFunctionType(
+						moduleState, moduleState->parseState, unresolvedFunctionType);
 				});
 			break;
 		}
@@ -933,8 +937,8 @@ static void parseFunc(CursorState* cursor)
 			const Uptr importIndex = cursor->moduleState->module.functions.imports.size();
 			cursor->moduleState->postTypeCallbacks.push_back(
 				[unresolvedFunctionType, importIndex](ModuleState* moduleState) {
-					moduleState->module.functions.imports[importIndex].type
-						= resolveFunctionType(moduleState, unresolvedFunctionType);
+					moduleState->module.functions.imports[importIndex].type = resolveFunctionType(
+						moduleState, moduleState->parseState, unresolvedFunctionType);
 				});
 			return IndexedFunctionType{UINTPTR_MAX};
 		},
@@ -1339,6 +1343,178 @@ template<typename Map> void dumpHashMapSpaceAnalysis(const Map& map, const char*
 	}
 }
 
+namespace {
+	enum class FunctionBodyParseResult : U8
+	{
+		parsed,
+		deferred,
+		recoverParseException,
+		fatalParseException,
+	};
+
+	struct ParallelFunctionBodyParse
+	{
+		ModuleState* moduleState;
+		std::atomic<Uptr> nextFunctionBodyIndex{0};
+
+		// The result of parsing each function body, and the errors that were found in it.
+		std::vector<FunctionBodyParseResult> results;
+		std::vector<std::vector<UnresolvedError>> errors;
+
+		// The index of the lowest-indexed function body that threw a parse exception, or
+		// UINTPTR_MAX if none has. The bodies after it don't need to be parsed.
+		std::atomic<Uptr> firstExceptionFunctionBodyIndex{UINTPTR_MAX};
+
+		// The quoted name strings that were parsed by all threads.
+		Platform::Mutex quotedNameStringsMutex;
+		std::vector<std::unique_ptr<std::string>> quotedNameStrings;
+
+		ParallelFunctionBodyParse(ModuleState* inModuleState)
+		: moduleState(inModuleState)
+		, results(inModuleState->functionBodyCallbacks.size())
+		, errors(inModuleState->functionBodyCallbacks.size())
+		{
+		}
+	};
+}
+
+static FunctionBodyParseResult parseFunctionBody(ModuleState* moduleState,
+												 Uptr functionBodyIndex,
+												 ParseState* parseState)
+{
+	try
+	{
+		moduleState->functionBodyCallbacks[functionBodyIndex](moduleState, parseState);
+		return FunctionBodyParseResult::parsed;
+	}
+	catch(DeferFunctionBodyException const&)
+	{
+		// Discard the errors, since the body will be parsed again.
+		parseState->unresolvedErrors.clear();
+		return FunctionBodyParseResult::deferred;
+	}
+	catch(RecoverParseException const&)
+	{
+		return FunctionBodyParseResult::recoverParseException;
+	}
+	catch(FatalParseException const&)
+	{
+		return FunctionBodyParseResult::fatalParseException;
+	}
+}
+
+static I64 parallelFunctionBodyParseThreadMain(void* parseVoid)
+{
+	ParallelFunctionBodyParse& parse = *(ParallelFunctionBodyParse*)parseVoid;
+	ModuleState* moduleState = parse.moduleState;
+
+	// Each thread collects the errors in the function body it is parsing in its own ParseState.
+	ParseState threadParseState(moduleState->parseState->string, moduleState->parseState->lineInfo);
+	while(true)
+	{
+		const Uptr functionBodyIndex = parse.nextFunctionBodyIndex++;
+		if(functionBodyIndex >= moduleState->functionBodyCallbacks.size()
+		   || functionBodyIndex > parse.firstExceptionFunctionBodyIndex.load())
+		{ break; }
+
+		const FunctionBodyParseResult result
+			= parseFunctionBody(moduleState, functionBodyIndex, &threadParseState);
+		parse.results[functionBodyIndex] = result;
+		parse.errors[functionBodyIndex] = std::move(threadParseState.unresolvedErrors);
+		threadParseState.unresolvedErrors.clear();
+
+		if(result == FunctionBodyParseResult::recoverParseException
+		   || result == FunctionBodyParseResult::fatalParseException)
+		{
+			Uptr firstExceptionFunctionBodyIndex = parse.firstExceptionFunctionBodyIndex.load();
+			while(functionBodyIndex < firstExceptionFunctionBodyIndex
+				  && !parse.firstExceptionFunctionBodyIndex.compare_exchange_weak(
+					  firstExceptionFunctionBodyIndex, functionBodyIndex))
+			{
+			};
+		}
+	}
+
+	Platform::Mutex::Lock quotedNameStringsLock(parse.quotedNameStringsMutex);
+	for(std::unique_ptr<std::string>& quotedNameString : threadParseState.quotedNameStrings)
+	{ parse.quotedNameStrings.push_back(std::move(quotedNameString)); }
+
+	return 0;
+}
+
+// Parses the module's function bodies, on multiple threads if the module has enough tokens to
+// amortize the cost of creating them. The errors are reported in the same order they would be if
+// the bodies were parsed serially, regardless of the number of threads.
+static void parseFunctionBodies(ModuleState* moduleState, Uptr numModuleTokens)
+{
+	Timing::Timer timer;
+
+	Uptr numThreads = moduleState->parseState->maxFunctionBodyThreads;
+	if(!numThreads)
+	{
+		static constexpr Uptr minTokensPerThread = 64 * 1024;
+		numThreads = std::min(Platform::getNumberOfHardwareThreads(),
+							  numModuleTokens / minTokensPerThread + 1);
+	}
+	const Uptr numFunctionBodies = moduleState->functionBodyCallbacks.size();
+	numThreads = std::min(numThreads, numFunctionBodies);
+
+	// Parse the function bodies on numThreads - 1 new threads, and this thread.
+	ParallelFunctionBodyParse parse(moduleState);
+	moduleState->isParsingFunctionBodiesInParallel = numThreads > 1;
+	std::vector<Platform::Thread*> threads;
+	for(Uptr threadIndex = 1; threadIndex < numThreads; ++threadIndex)
+	{
+		threads.push_back(
+			Platform::createThread(0, parallelFunctionBodyParseThreadMain, &parse));
+	}
+	parallelFunctionBodyParseThreadMain(&parse);
+	for(Platform::Thread* thread : threads) { Platform::joinThread(thread); }
+	moduleState->isParsingFunctionBodiesInParallel = false;
+
+	ParseState* parseState = moduleState->parseState;
+	for(std::unique_ptr<std::string>& quotedNameString : parse.quotedNameStrings)
+	{ parseState->quotedNameStrings.push_back(std::move(quotedNameString)); }
+
+	// Report the errors in order, and parse the deferred function bodies in order, so they add
+	// function types to the module in the same order they would if the bodies were parsed serially.
+	ParseState deferredParseState(parseState->string, parseState->lineInfo);
+	for(Uptr functionBodyIndex = 0; functionBodyIndex < numFunctionBodies; ++functionBodyIndex)
+	{
+		FunctionBodyParseResult result = parse.results[functionBodyIndex];
+		std::vector<UnresolvedError>& errors = parse.errors[functionBodyIndex];
+		if(result == FunctionBodyParseResult::deferred)
+		{
+			result = parseFunctionBody(moduleState, functionBodyIndex, &deferredParseState);
+			errors = std::move(deferredParseState.unresolvedErrors);
+			deferredParseState.unresolvedErrors.clear();
+		}
+
+		for(UnresolvedError& error : errors)
+		{ parseState->unresolvedErrors.push_back(std::move(error)); }
+
+		if(result == FunctionBodyParseResult::recoverParseException
+		   || result == FunctionBodyParseResult::fatalParseException)
+		{
+			for(std::unique_ptr<std::string>& quotedNameString :
+				deferredParseState.quotedNameStrings)
+			{ parseState->quotedNameStrings.push_back(std::move(quotedNameString)); }
+
+			if(result == FunctionBodyParseResult::recoverParseException)
+			{ throw RecoverParseException(); }
+			else
+			{
+				throw FatalParseException();
+			}
+		}
+	}
+	for(std::unique_ptr<std::string>& quotedNameString : deferredParseState.quotedNameStrings)
+	{ parseState->quotedNameStrings.push_back(std::move(quotedNameString)); }
+
+	Timing::logRatePerSecond(
+		"parsed WAST function bodies", timer, F64(numFunctionBodies), "functions");
+}
+
 void WAST::parseModuleBody(CursorState* cursor, IR::Module& outModule)
 {
 	try
@@ -1382,12 +1558,9 @@ void WAST::parseModuleBody(CursorState* cursor, IR::Module& outModule)
 			}
 		}
 
-		// Process the function body parsing callbacks.
+		// Parse the function bodies.
 		if(!cursor->parseState->unresolvedErrors.size())
-		{
-			for(const auto& callback : cursor->moduleState->functionBodyCallbacks)
-			{ callback(&moduleState); }
-		}
+		{ parseFunctionBodies(&moduleState, Uptr(cursor->nextToken - firstToken)); }
 
 		// After function bodies have been parsed, validate the parts of the module that correspond
 		// to post-code sections in binary modules.
@@ -1428,7 +1601,8 @@ void WAST::parseModuleBody(CursorState* cursor, IR::Module& outModule)
 bool WAST::parseModule(const char* string,
 					   Uptr stringLength,
 					   IR::Module& outModule,
-					   std::vector<Error>& outErrors)
+					   std::vector<Error>& outErrors,
+					   Uptr numThreads)
 {
 	Timing::Timer timer;
 
@@ -1437,6 +1611,7 @@ bool WAST::parseModule(const char* string,
 	Token* tokens
 		= lex(string, stringLength, lineInfo, outModule.featureSpec.allowLegacyInstructionNames);
 	ParseState parseState(string, lineInfo);
+	parseState.maxFunctionBodyThreads = numThreads;
 	CursorState cursor(tokens, &parseState);
 
 	try
@@ -731,17 +731,17 @@ static std::unique_ptr<Command> parseCommand(CursorState* cursor,
 				}
 
 				if(cursor->nextToken[0].type != t_leftParenthesis
-				   || cursor->nextToken[1].type != t_invoke)
+				   || (cursor->nextToken[1].type != t_invoke
+					   && cursor->nextToken[1].type != t_module))
 				{
-					parseErrorf(cursor->parseState, cursor->nextToken, "expected invoke");
+					parseErrorf(cursor->parseState, cursor->nextToken, "expected invoke or module");
 					throw RecoverParseException();
 				}
 
-				std::unique_ptr<InvokeAction> invokeAction(
-					(InvokeAction*)parseAction(cursor, featureSpec).release());
+				std::unique_ptr<Action> action = parseAction(cursor, featureSpec);
 
-				result = std::unique_ptr<Command>(new BenchmarkCommand(
-					std::move(locus), std::move(name), std::move(invokeAction)));
+				result = std::unique_ptr<Command>(
+					new BenchmarkCommand(std::move(locus), std::move(name), std::move(action)));
 
 				break;
 			}
@@ -1,10 +1,13 @@
 #include <string.h>
+#include <memory>
 #include <string>
+#include <vector>
 #include "WAVM/IR/Module.h"
 #include "WAVM/IR/Types.h"
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/LLVMJIT/LLVMJIT.h"
 #include "WAVM/Logging/Logging.h"
+#include "WAVM/Metrics/Metrics.h"
 #include "WAVM/Platform/Diagnostics.h"
 #include "WAVM/Runtime/Intrinsics.h"
 #include "WAVM/Runtime/Runtime.h"
@@ -257,6 +260,7 @@ IMPLEMENT_FEATURE(multivalue, multipleResultsAndBlockParams)
 IMPLEMENT_FEATURE(reference_types, referenceTypes)
 IMPLEMENT_FEATURE(extended_name_section, extendedNameSection)
 IMPLEMENT_FEATURE(multimemory, multipleMemories)
+IMPLEMENT_FEATURE(relaxed_simd, relaxedSIMD)
 
 IMPLEMENT_FEATURE(shared_tables, sharedTables)
 IMPLEMENT_FEATURE(allow_legacy_inst_names, allowLegacyInstructionNames)
@@ -896,14 +900,176 @@ wasm_func_t* wasm_func_new(wasm_compartment_t* compartment,
 	addGCRoot(function);
 	return function;
 }
-wasm_func_t* wasm_func_new_with_env(wasm_compartment_t*,
+// The environment of a function created by wasm_func_new_with_env or wasm_func_new_batch. The
+// intrinsic thunk passes a pointer to it as the first argument of the callback.
+struct HostFunctionEnv
+{
+	wasm_func_callback_with_env_t callback;
+	void* env;
+	void (*finalizer)(void*);
+};
+
+// The environments of all the functions created by a batch, owned by the batch's instance.
+struct HostFunctionBatch
+{
+	std::vector<HostFunctionEnv> envs;
+};
+
+static wasm_trap_t* callHostFunctionWithEnv(const wasm_val_t args[], wasm_val_t results[])
+{
+	const HostFunctionEnv* hostFunctionEnv
+		= reinterpret_cast<const HostFunctionEnv*>(Uptr(args[0].i64));
+	return hostFunctionEnv->callback(hostFunctionEnv->env, args + 1, results);
+}
+
+static void finalizeHostFunctionBatch(void* userData)
+{
+	HostFunctionBatch* batch = (HostFunctionBatch*)userData;
+	for(const HostFunctionEnv& hostFunctionEnv : batch->envs)
+	{
+		if(hostFunctionEnv.finalizer) { hostFunctionEnv.finalizer(hostFunctionEnv.env); }
+	}
+	delete batch;
+}
+
+static bool isRawCallbackValueType(ValueType type)
+{
+	switch(type)
+	{
+	case ValueType::i32:
+	case ValueType::i64:
+	case ValueType::f32:
+	case ValueType::f64: return true;
+
+	case ValueType::v128:
+	case ValueType::externref:
+	case ValueType::funcref: return false;
+
+	case ValueType::none:
+	case ValueType::any:
+	default: WAVM_UNREACHABLE();
+	};
+}
+
+static bool isRawCallbackFunctionType(const FunctionType& type)
+{
+	if(type.results().size() > 1) { return false; }
+	for(ValueType result : type.results())
+	{
+		if(!isRawCallbackValueType(result)) { return false; }
+	}
+	for(ValueType param : type.params())
+	{
+		if(!isRawCallbackValueType(param)) { return false; }
+	}
+	return true;
+}
+
+static TypeTuple prependEnvParam(const TypeTuple& params)
+{
+	std::vector<ValueType> paramsWithEnv;
+	paramsWithEnv.reserve(params.size() + 1);
+	paramsWithEnv.push_back(ValueType::i64);
+	paramsWithEnv.insert(paramsWithEnv.end(), params.begin(), params.end());
+	return TypeTuple(paramsWithEnv);
+}
+
+bool wasm_func_new_batch(wasm_compartment_t* compartment,
+						 size_t num_funcs,
+						 const wasm_func_desc_t descs[],
+						 wasm_func_t* out_funcs[])
+{
+	for(Uptr funcIndex = 0; funcIndex < num_funcs; ++funcIndex)
+	{
+		if(descs[funcIndex].raw_callback && !isRawCallbackFunctionType(descs[funcIndex].type->type))
+		{ return false; }
+	}
+	if(!num_funcs) { return true; }
+
+	// Allocate all the environments up front, so their addresses are stable.
+	HostFunctionBatch* batch = new HostFunctionBatch;
+	batch->envs.resize(num_funcs);
+
+	// The intrinsic functions need a unique name to look them up in the instance, and the names
+	// must remain valid until instantiateModule returns.
+	std::vector<std::string> names(num_funcs);
+	std::vector<std::unique_ptr<Intrinsics::Function>> intrinsicFunctions(num_funcs);
+	Intrinsics::Module intrinsicModule;
+	for(Uptr funcIndex = 0; funcIndex < num_funcs; ++funcIndex)
+	{
+		const wasm_func_desc_t& desc = descs[funcIndex];
+		HostFunctionEnv& hostFunctionEnv = batch->envs[funcIndex];
+		hostFunctionEnv.callback = desc.callback;
+		hostFunctionEnv.env = desc.env;
+		hostFunctionEnv.finalizer = desc.finalizer;
+
+		names[funcIndex] = std::to_string(funcIndex) + ":" + desc.debug_name;
+
+		const TypeTuple paramsWithEnv = prependEnvParam(desc.type->type.params());
+		if(desc.raw_callback)
+		{
+			// Raw callbacks receive env directly, as a pointer-sized first argument.
+			static_assert(sizeof(void*) == sizeof(U64), "raw callbacks require 64-bit pointers");
+			intrinsicFunctions[funcIndex] = std::make_unique<Intrinsics::Function>(
+				&intrinsicModule,
+				names[funcIndex].c_str(),
+				desc.raw_callback,
+				FunctionType(desc.type->type.results(), paramsWithEnv, CallingConvention::c),
+				U64(reinterpret_cast<Uptr>(desc.env)));
+		}
+		else
+		{
+			intrinsicFunctions[funcIndex] = std::make_unique<Intrinsics::Function>(
+				&intrinsicModule,
+				names[funcIndex].c_str(),
+				(void*)&callHostFunctionWithEnv,
+				FunctionType(
+					desc.type->type.results(), paramsWithEnv, CallingConvention::cAPICallback),
+				U64(reinterpret_cast<Uptr>(&hostFunctionEnv)));
+		}
+	}
+
+	Instance* instance = Intrinsics::instantiateModule(
+		compartment, {&intrinsicModule}, num_funcs == 1 ? descs[0].debug_name : "host functions");
+
+	// The instance owns the environments: the functions keep it alive, so the finalizers are only
+	// called once all of them have been collected.
+	setUserData(instance, batch, finalizeHostFunctionBatch);
+
+	for(Uptr funcIndex = 0; funcIndex < num_funcs; ++funcIndex)
+	{
+		Function* function
+			= getTypedInstanceExport(instance, names[funcIndex], descs[funcIndex].type->type);
+		addGCRoot(function);
+		out_funcs[funcIndex] = function;
+	}
+	return true;
+}
+
+wasm_func_t* wasm_func_new_with_env(wasm_compartment_t* compartment,
 									const wasm_functype_t* type,
-									wasm_func_callback_with_env_t,
+									wasm_func_callback_with_env_t callback,
 									void* env,
 									void (*finalizer)(void*),
 									const char* debug_name)
 {
-	Errors::fatal("wasm_func_new_with_env is not yet supported");
+	wasm_func_desc_t desc = {type, callback, nullptr, env, finalizer, debug_name};
+	wasm_func_t* function = nullptr;
+	WAVM_ERROR_UNLESS(wasm_func_new_batch(compartment, 1, &desc, &function));
+	return function;
+}
+
+wasm_func_t* wasm_func_new_raw(wasm_compartment_t* compartment,
+							   const wasm_functype_t* type,
+							   void* raw_callback,
+							   void* env,
+							   void (*finalizer)(void*),
+							   const char* debug_name)
+{
+	wasm_func_desc_t desc = {type, nullptr, raw_callback, env, finalizer, debug_name};
+	wasm_func_t* function = nullptr;
+	if(!wasm_func_new_batch(compartment, 1, &desc, &function)) { return nullptr; }
+	return function;
 }
 wasm_functype_t* wasm_func_type(const wasm_func_t* function)
 {
@@ -1161,4 +1327,37 @@ wasm_extern_t* wasm_instance_export(const wasm_instance_t* instance, size_t inde
 {
 	return getInstanceExports(instance)[index];
 }
+
+void wasm_metrics_set_enabled(bool enable) { Metrics::setEnabled(enable); }
+
+void wasm_metrics_reset() { Metrics::reset(); }
+
+bool wasm_metrics_get(const char* name,
+					  const char* label_value,
+					  uint64_t* out_count,
+					  uint64_t* out_sum)
+{
+	for(const Metrics::MetricSnapshot& metric : Metrics::getSnapshot())
+	{
+		if(metric.name == name && metric.labelValue == (label_value ? label_value : ""))
+		{
+			*out_count = metric.count;
+			*out_sum = metric.sum;
+			return true;
+		}
+	}
+	return false;
+}
+
+char* wasm_metrics_print_prometheus(size_t* out_num_chars)
+{
+	const std::string text = Metrics::formatPrometheusText(Metrics::getSnapshot());
+
+	char* returnBuffer = (char*)malloc(text.size() + 1);
+	memcpy(returnBuffer, text.c_str(), text.size());
+	returnBuffer[text.size()] = 0;
+
+	*out_num_chars = text.size();
+	return returnBuffer;
+}
 }
@@ -17,9 +17,14 @@
 #include "WAVM/Logging/Logging.h"
 #include "WAVM/Platform/Thread.h"
 #include "WAVM/Runtime/Intrinsics.h"
+#include "WAVM/Runtime/Linker.h"
 #include "WAVM/Runtime/Runtime.h"
 #include "WAVM/RuntimeABI/RuntimeABI.h"
+#include "WAVM/VFS/MemoryFS.h"
+#include "WAVM/VFS/VFS.h"
+#include "WAVM/WASI/WASI.h"
 #include "WAVM/WASTParse/WASTParse.h"
+#include "WAVM/wavm-c/wavm-c.h"
 
 using namespace WAVM;
 using namespace WAVM::IR;
@@ -198,7 +203,9 @@ static constexpr const char* intrinsicBenchModuleWAST
 	  "  )\n"
 	  ")";
 
-void runIntrinsicBench()
+static void runIdentityCallBench(Compartment* compartment,
+								 Object* identityFunction,
+								 const char* description)
 {
 	// Parse the intrinsic benchmark module.
 	std::vector<WAST::Error> parseErrors;
@@ -211,16 +218,10 @@ void runIntrinsicBench()
 		Errors::fatal("Failed to parse intrinsic benchmark module WAST");
 	}
 
-	// Instantiate the intrinsic module
-	GCPointer<Compartment> compartment = Runtime::createCompartment();
-	auto intrinsicInstance = Intrinsics::instantiateModule(
-		compartment, {WAVM_INTRINSIC_MODULE_REF(benchmarkIntrinsics)}, "benchmarkIntrinsics");
-	auto intrinsicIdentityFunction = getInstanceExport(intrinsicInstance, "identity");
-
 	// Instantiate the WASM module.
 	auto module = compileModule(irModule);
-	auto instance = instantiateModule(
-		compartment, module, {intrinsicIdentityFunction}, "benchmarkIntrinsicModule");
+	auto instance
+		= instantiateModule(compartment, module, {identityFunction}, "benchmarkIntrinsicModule");
 	auto function = asFunction(getInstanceExport(instance, "benchmarkIntrinsicFunc"));
 
 	// Call the benchmark function once to ensure the time to create the invoke thunk isn't
@@ -237,7 +238,7 @@ void runIntrinsicBench()
 
 	// Run the benchmark.
 	runBenchmarkSingleAndMultiThreaded(
-		compartment, function, "intrinsic call", [](void* argument) -> I64 {
+		compartment, function, description, [](void* argument) -> I64 {
 			ThreadArgs* threadArgs = (ThreadArgs*)argument;
 
 			FunctionType invokeSig({ValueType::i32}, {ValueType::i32});
@@ -253,8 +254,460 @@ void runIntrinsicBench()
 
 			return 0;
 		});
+}
+
+void runIntrinsicBench()
+{
+	// Instantiate the intrinsic module
+	GCPointer<Compartment> compartment = Runtime::createCompartment();
+	auto intrinsicInstance = Intrinsics::instantiateModule(
+		compartment, {WAVM_INTRINSIC_MODULE_REF(benchmarkIntrinsics)}, "benchmarkIntrinsics");
+	auto intrinsicIdentityFunction = getInstanceExport(intrinsicInstance, "identity");
+
+	runIdentityCallBench(compartment, intrinsicIdentityFunction, "intrinsic call");
+
+	// Free the compartment.
+	WAVM_ERROR_UNLESS(tryCollectCompartment(std::move(compartment)));
+}
+
+static constexpr Uptr numWASICallsPerThread = 10000000;
+
+static constexpr const char* wasiBenchModuleWAST
+	= "(module\n"
+	  "  (import \"wasi_snapshot_preview1\" \"fd_write\"\n"
+	  "    (func $fd_write (param i32 i32 i32 i32) (result i32)))\n"
+	  "  (import \"wasi_snapshot_preview1\" \"clock_time_get\"\n"
+	  "    (func $clock_time_get (param i32 i64 i32) (result i32)))\n"
+	  "  (import \"wasi_snapshot_preview1\" \"random_get\"\n"
+	  "    (func $random_get (param i32 i32) (result i32)))\n"
+	  "  (memory (export \"memory\") 1)\n"
+	  "  (data (i32.const 0) \"\\10\\00\\00\\00\\01\\00\\00\\00\")\n"
+	  "  (data (i32.const 16) \"x\")\n"
+	  "  (func (export \"fdWrite\") (param $numIterations i32) (result i32)\n"
+	  "    (local $i i32)\n"
+	  "    loop $loop\n"
+	  "      (drop (call $fd_write (i32.const 1) (i32.const 0) (i32.const 1) (i32.const 8)))\n"
+	  "      (local.set $i (i32.add (local.get $i) (i32.const 1)))\n"
+	  "      (br_if $loop (i32.ne (local.get $i) (local.get $numIterations)))\n"
+	  "    end\n"
+	  "    (local.get $i)\n"
+	  "  )\n"
+	  "  (func (export \"clockTimeGet\") (param $numIterations i32) (result i32)\n"
+	  "    (local $i i32)\n"
+	  "    loop $loop\n"
+	  "      (drop (call $clock_time_get (i32.const 1) (i64.const 0) (i32.const 24)))\n"
+	  "      (local.set $i (i32.add (local.get $i) (i32.const 1)))\n"
+	  "      (br_if $loop (i32.ne (local.get $i) (local.get $numIterations)))\n"
+	  "    end\n"
+	  "    (local.get $i)\n"
+	  "  )\n"
+	  "  (func (export \"randomGet\") (param $numIterations i32) (result i32)\n"
+	  "    (local $i i32)\n"
+	  "    loop $loop\n"
+	  "      (drop (call $random_get (i32.const 32) (i32.const 16)))\n"
+	  "      (local.set $i (i32.add (local.get $i) (i32.const 1)))\n"
+	  "      (br_if $loop (i32.ne (local.get $i) (local.get $numIterations)))\n"
+	  "    end\n"
+	  "    (local.get $i)\n"
+	  "  )\n"
+	  ")";
+
+// A VFD that discards writes without any synchronization.
+struct NullVFD : VFS::VFD
+{
+	virtual VFS::Result close() override
+	{
+		delete this;
+		return VFS::Result::success;
+	}
+	virtual VFS::Result seek(I64 offset,
+							 VFS::SeekOrigin origin,
+							 U64* outAbsoluteOffset = nullptr) override
+	{
+		return VFS::Result::notSeekable;
+	}
+	virtual VFS::Result readv(const VFS::IOReadBuffer* buffers,
+							  Uptr numBuffers,
+							  Uptr* outNumBytesRead = nullptr,
+							  const U64* offset = nullptr) override
+	{
+		if(outNumBytesRead) { *outNumBytesRead = 0; }
+		return VFS::Result::success;
+	}
+	virtual VFS::Result writev(const VFS::IOWriteBuffer* buffers,
+							   Uptr numBuffers,
+							   Uptr* outNumBytesWritten = nullptr,
+							   const U64* offset = nullptr) override
+	{
+		Uptr numBytesWritten = 0;
+		for(Uptr bufferIndex = 0; bufferIndex < numBuffers; ++bufferIndex)
+		{ numBytesWritten += buffers[bufferIndex].numBytes; }
+		if(outNumBytesWritten) { *outNumBytesWritten = numBytesWritten; }
+		return VFS::Result::success;
+	}
+	virtual VFS::Result sync(VFS::SyncType type) override { return VFS::Result::success; }
+	virtual VFS::Result getVFDInfo(VFS::VFDInfo& outInfo) override
+	{
+		outInfo.type = VFS::FileType::characterDevice;
+		outInfo.flags = VFS::VFDFlags{};
+		return VFS::Result::success;
+	}
+	virtual VFS::Result getFileInfo(VFS::FileInfo& outInfo) override
+	{
+		return VFS::Result::notSupported;
+	}
+	virtual VFS::Result setVFDFlags(const VFS::VFDFlags& flags) override
+	{
+		return VFS::Result::notSupported;
+	}
+	virtual VFS::Result setFileSize(U64 numBytes) override { return VFS::Result::notSupported; }
+	virtual VFS::Result setFileTimes(bool setLastAccessTime,
+									 Time lastAccessTime,
+									 bool setLastWriteTime,
+									 Time lastWriteTime) override
+	{
+		return VFS::Result::notSupported;
+	}
+	virtual VFS::Result openDir(VFS::DirEntStream*& outStream) override
+	{
+		return VFS::Result::isNotDirectory;
+	}
+};
+
+static I64 wasiBenchThreadFunc(void* argument)
+{
+	ThreadArgs* threadArgs = (ThreadArgs*)argument;
+
+	FunctionType invokeSig({ValueType::i32}, {ValueType::i32});
+
+	Timing::Timer timer;
+	UntaggedValue args[1]{I32(numWASICallsPerThread)};
+	UntaggedValue results[1];
+	invokeFunction(threadArgs->context, threadArgs->function, invokeSig, args, results);
+	timer.stop();
+
+	threadArgs->elapsedNanoseconds = timer.getNanoseconds() / F64(numWASICallsPerThread);
+
+	return 0;
+}
+
+void runWASIBench()
+{
+	// Parse the WASI benchmark module.
+	std::vector<WAST::Error> parseErrors;
+	IR::Module irModule;
+	if(!WAST::parseModule(
+		   wasiBenchModuleWAST, strlen(wasiBenchModuleWAST) + 1, irModule, parseErrors))
+	{
+		WAST::reportParseErrors("WASI benchmark module", wasiBenchModuleWAST, parseErrors);
+		Errors::fatal("Failed to parse WASI benchmark module WAST");
+	}
+
+	// Create a WASI process whose stdin and stderr are backed by files in memory, and whose stdout
+	// discards writes, so the benchmark measures the cost of the syscalls rather than the cost of
+	// writing to the host's stdout.
+	std::shared_ptr<VFS::FileSystem> memoryFS = VFS::makeMemoryFS();
+	VFS::VFD* stdioVFDs[3] = {nullptr, new NullVFD, nullptr};
+	const char* stdioFileNames[3] = {"stdin", "stdout", "stderr"};
+	for(Uptr stdioIndex = 0; stdioIndex < 3; stdioIndex += 2)
+	{
+		WAVM_ERROR_UNLESS(memoryFS->open(stdioFileNames[stdioIndex],
+										 VFS::FileAccessMode::readWrite,
+										 VFS::FileCreateMode::createAlways,
+										 stdioVFDs[stdioIndex])
+						  == VFS::Result::success);
+	}
+
+	GCPointer<Compartment> compartment = Runtime::createCompartment();
+	std::shared_ptr<WASI::Process> process = WASI::createProcess(
+		compartment, {}, {}, nullptr, stdioVFDs[0], stdioVFDs[1], stdioVFDs[2]);
+
+	// Link and instantiate the WASM module.
+	LinkResult linkResult = linkModule(irModule, WASI::getProcessResolver(*process));
+	WAVM_ERROR_UNLESS(linkResult.success);
+	auto module = compileModule(irModule);
+	auto instance = instantiateModule(
+		compartment, module, std::move(linkResult.resolvedImports), "wasiBenchmarkModule");
+	WASI::setProcessMemory(*process, asMemory(getInstanceExport(instance, "memory")));
+
+	struct WASIBench
+	{
+		const char* functionName;
+		const char* description;
+		bool useCoarseClocks;
+		bool multiThreaded;
+	};
+	const WASIBench benches[4] = {
+		{"fdWrite", "WASI fd_write of 1 byte", false, true},
+		{"clockTimeGet", "WASI clock_time_get", false, false},
+		{"clockTimeGet", "WASI clock_time_get with coarse clocks", true, false},
+		{"randomGet", "WASI random_get of 16 bytes", false, false},
+	};
+	for(const WASIBench& bench : benches)
+	{
+		WASI::setProcessUsesCoarseClocks(*process, bench.useCoarseClocks);
+		Function* function = asFunction(getInstanceExport(instance, bench.functionName));
+
+		// Call the benchmark function once to ensure the time to create the invoke thunk isn't
+		// benchmarked.
+		{
+			IR::Value args[1]{I32(1)};
+			IR::Value results[1];
+			invokeFunction(createContext(compartment),
+						   function,
+						   FunctionType({ValueType::i32}, {ValueType::i32}),
+						   args,
+						   results);
+		}
+
+		// Writes to the null stdout don't share any state other than the WASI process's FD table,
+		// so run them on multiple threads to measure contention on it.
+		if(bench.multiThreaded)
+		{
+			runBenchmarkSingleAndMultiThreaded(
+				compartment, function, bench.description, wasiBenchThreadFunc);
+		}
+		else
+		{
+			runBenchmark(compartment, function, 1, bench.description, wasiBenchThreadFunc);
+		}
+	}
+
+	// Free the process and compartment.
+	process.reset();
+	WAVM_ERROR_UNLESS(tryCollectCompartment(std::move(compartment)));
+}
+
+static wasm_trap_t* capiIdentity(const wasm_val_t args[], wasm_val_t results[])
+{
+	results[0].i32 = args[0].i32;
+	return nullptr;
+}
+
+static wasm_trap_t* capiIdentityWithEnv(void* env, const wasm_val_t args[], wasm_val_t results[])
+{
+	results[0].i32 = args[0].i32;
+	return nullptr;
+}
+
+static I32 rawIdentity(void* env, I32 x) { return x; }
+
+void runHostCallBench()
+{
+	// The C API's opaque types are the same objects as the corresponding Runtime types.
+	GCPointer<Compartment> compartment = Runtime::createCompartment();
+	wasm_compartment_t* capiCompartment
+		= reinterpret_cast<wasm_compartment_t*>((Compartment*)compartment);
+
+	wasm_functype_t* identityType
+		= wasm_functype_new_1_1(wasm_valtype_new_i32(), wasm_valtype_new_i32());
+
+	wasm_func_t* capiFunctions[3]
+		= {wasm_func_new(capiCompartment, identityType, capiIdentity, "capiIdentity"),
+		   wasm_func_new_with_env(capiCompartment,
+								  identityType,
+								  capiIdentityWithEnv,
+								  nullptr,
+								  nullptr,
+								  "capiIdentityWithEnv"),
+		   wasm_func_new_raw(capiCompartment,
+							 identityType,
+							 (void*)&rawIdentity,
+							 nullptr,
+							 nullptr,
+							 "rawIdentity")};
+	WAVM_ERROR_UNLESS(capiFunctions[2]);
+	wasm_functype_delete(identityType);
+
+	const char* descriptions[3] = {"C API call", "C API call with env", "C API raw call"};
+	for(Uptr functionIndex = 0; functionIndex < 3; ++functionIndex)
+	{
+		runIdentityCallBench(compartment,
+							 reinterpret_cast<Object*>(capiFunctions[functionIndex]),
+							 descriptions[functionIndex]);
+		wasm_func_delete(capiFunctions[functionIndex]);
+	}
+
+	// Free the compartment.
+	WAVM_ERROR_UNLESS(tryCollectCompartment(std::move(compartment)));
+}
+
+static constexpr Uptr numContextsPerBatch = 64;
+static constexpr Uptr numContextBatches = 10000;
+
+void runContextBench()
+{
+	GCPointer<Compartment> compartment = Runtime::createCompartment();
+
+	// Create a few mutable globals, so creating a context needs to initialize them.
+	std::vector<GCPointer<Global>> globals;
+	for(Uptr globalIndex = 0; globalIndex < 4; ++globalIndex)
+	{
+		Global* global = createGlobal(compartment, GlobalType(ValueType::i64, true), "global");
+		initializeGlobal(global, I64(globalIndex));
+		globals.push_back(global);
+	}
+
+	// Create and destroy batches of contexts, collecting garbage after each batch to destroy them.
+	Timing::Timer timer;
+	for(Uptr batchIndex = 0; batchIndex < numContextBatches; ++batchIndex)
+	{
+		for(Uptr contextIndex = 0; contextIndex < numContextsPerBatch; ++contextIndex)
+		{ WAVM_ERROR_UNLESS(createContext(compartment)); }
+		collectCompartmentGarbage(compartment);
+	}
+	timer.stop();
+
+	Log::printf(Log::output,
+				"ns/context create+destroy: %.2f\n",
+				timer.getNanoseconds() / F64(numContextBatches * numContextsPerBatch));
+
+	// Free the compartment.
+	globals.clear();
+	WAVM_ERROR_UNLESS(tryCollectCompartment(std::move(compartment)));
+}
+
+static constexpr Uptr numDensityTenants = 10000;
+
+void runDensityBench()
+{
+	// Create many idle tenants, each with its own compartment and context. Limit each compartment
+	// to a single context, memory, and table, so it only needs a small address space reservation.
+	CompartmentLimits limits;
+	limits.maxContexts = 1;
+	limits.maxMemories = 1;
+	limits.maxTables = 1;
+
+	std::vector<GCPointer<Compartment>> compartments;
+	std::vector<GCPointer<Context>> contexts;
+	compartments.reserve(numDensityTenants);
+	contexts.reserve(numDensityTenants);
+
+	Timing::Timer createTimer;
+	for(Uptr tenantIndex = 0; tenantIndex < numDensityTenants; ++tenantIndex)
+	{
+		Compartment* compartment = createCompartment("tenant", limits);
+		WAVM_ERROR_UNLESS(compartment);
+		compartments.push_back(compartment);
+
+		Context* context = createContext(compartment);
+		WAVM_ERROR_UNLESS(context);
+		contexts.push_back(context);
+	}
+	createTimer.stop();
+
+	Timing::Timer destroyTimer;
+	contexts.clear();
+	for(GCPointer<Compartment>& compartment : compartments)
+	{ WAVM_ERROR_UNLESS(tryCollectCompartment(std::move(compartment))); }
+	destroyTimer.stop();
+
+	Log::printf(Log::output,
+				"ns/idle tenant create: %.2f\n"
+				"ns/idle tenant destroy: %.2f\n",
+				createTimer.getNanoseconds() / F64(numDensityTenants),
+				destroyTimer.getNanoseconds() / F64(numDensityTenants));
+}
+
+static constexpr const char* instantiateBenchModuleWAST
+	= "(module\n"
+	  "  (import \"benchmarkIntrinsics\" \"identity\" (func $identity (param i32) (result i32)))\n"
+	  "  (memory (export \"memory\") 1)\n"
+	  "  (table (export \"table\") 4 funcref)\n"
+	  "  (global $counter (export \"counter\") (mut i32) (i32.const 0))\n"
+	  "  (data (i32.const 0) \"benchmark data segment\")\n"
+	  "  (data (i32.const 64) \"another benchmark data segment\")\n"
+	  "  (elem (i32.const 0) $a $b $c)\n"
+	  "  (func $a (export \"a\") (result i32) (call $identity (i32.const 1)))\n"
+	  "  (func $b (export \"b\") (result i32) (call $identity (i32.const 2)))\n"
+	  "  (func $c (export \"c\") (result i32) (call $identity (i32.const 3)))\n"
+	  ")";
+
+// Resolves imports of the benchmarkIntrinsics module to the exports of an instance.
+struct BenchmarkIntrinsicsResolver : Resolver
+{
+	GCPointer<Instance> intrinsicInstance;
+
+	bool resolve(const std::string& moduleName,
+				 const std::string& exportName,
+				 ExternType type,
+				 Object*& outObject) override
+	{
+		if(moduleName != "benchmarkIntrinsics") { return false; }
+		outObject = getTypedInstanceExport(intrinsicInstance, exportName, type);
+		return outObject != nullptr;
+	}
+};
+
+static constexpr Uptr numInstancesPerBatch = 64;
+static constexpr Uptr numInstanceBatches = 100;
+
+void runInstantiateBench()
+{
+	// Parse and compile the instantiation benchmark module.
+	std::vector<WAST::Error> parseErrors;
+	IR::Module irModule;
+	if(!WAST::parseModule(instantiateBenchModuleWAST,
+						  strlen(instantiateBenchModuleWAST) + 1,
+						  irModule,
+						  parseErrors))
+	{
+		WAST::reportParseErrors(
+			"instantiate benchmark module", instantiateBenchModuleWAST, parseErrors);
+		Errors::fatal("Failed to parse instantiate benchmark module WAST");
+	}
+	auto module = compileModule(irModule);
+
+	GCPointer<Compartment> compartment = Runtime::createCompartment();
+	BenchmarkIntrinsicsResolver resolver;
+	resolver.intrinsicInstance = Intrinsics::instantiateModule(
+		compartment, {WAVM_INTRINSIC_MODULE_REF(benchmarkIntrinsics)}, "benchmarkIntrinsics");
+
+	// Link and instantiate the module for each instance, collecting garbage after each batch to
+	// destroy the instances.
+	Timing::Timer linkTimer;
+	for(Uptr batchIndex = 0; batchIndex < numInstanceBatches; ++batchIndex)
+	{
+		for(Uptr instanceIndex = 0; instanceIndex < numInstancesPerBatch; ++instanceIndex)
+		{
+			LinkResult linkResult = linkModule(irModule, resolver);
+			WAVM_ERROR_UNLESS(linkResult.success);
+			WAVM_ERROR_UNLESS(instantiateModule(compartment,
+												module,
+												std::move(linkResult.resolvedImports),
+												"instantiateBenchmarkModule"));
+		}
+		collectCompartmentGarbage(compartment);
+	}
+	linkTimer.stop();
+
+	// Link the module once, and instantiate each instance from an instantiation template.
+	Timing::Timer templateTimer;
+	{
+		LinkResult linkResult = linkModule(irModule, resolver);
+		WAVM_ERROR_UNLESS(linkResult.success);
+		InstantiationTemplateRef instantiationTemplate
+			= createInstantiationTemplate(compartment,
+										  module,
+										  std::move(linkResult.resolvedImports),
+										  "instantiateBenchmarkModule");
+		for(Uptr batchIndex = 0; batchIndex < numInstanceBatches; ++batchIndex)
+		{
+			for(Uptr instanceIndex = 0; instanceIndex < numInstancesPerBatch; ++instanceIndex)
+			{ WAVM_ERROR_UNLESS(instantiateModule(instantiationTemplate)); }
+			collectCompartmentGarbage(compartment);
+		}
+	}
+	templateTimer.stop();
+
+	Log::printf(Log::output,
+				"ns/link+instantiate+destroy: %.2f\n"
+				"ns/template instantiate+destroy: %.2f\n",
+				linkTimer.getNanoseconds() / F64(numInstanceBatches * numInstancesPerBatch),
+				templateTimer.getNanoseconds() / F64(numInstanceBatches * numInstancesPerBatch));
 
 	// Free the compartment.
+	resolver.intrinsicInstance = nullptr;
 	WAVM_ERROR_UNLESS(tryCollectCompartment(std::move(compartment)));
 }
 
@@ -274,6 +727,11 @@ int execBenchmark(int argc, char** argv)
 
 	runInvokeBench();
 	runIntrinsicBench();
+	runHostCallBench();
+	runWASIBench();
+	runContextBench();
+	runDensityBench();
+	runInstantiateBench();
 
 	return 0;
 }
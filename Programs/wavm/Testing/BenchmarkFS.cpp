@@ -0,0 +1,177 @@
+#include <stdlib.h>
+#include <string.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Errors.h"
+#include "WAVM/Inline/Timing.h"
+#include "WAVM/Logging/Logging.h"
+#include "WAVM/Platform/File.h"
+#include "WAVM/VFS/SandboxFS.h"
+#include "WAVM/VFS/VFS.h"
+#include "wavm-test.h"
+
+using namespace WAVM;
+
+static constexpr Uptr treeDepth = 16;
+static constexpr Uptr numFilesPerDir = 8;
+
+static void showFileSystemBenchmarkHelp(Log::Category outputCategory)
+{
+	Log::printf(outputCategory,
+				"Usage: wavm test fsbench [--iterations <n>] [<directory>]\n"
+				"  Creates a deep directory tree in <directory> (the current directory by\n"
+				"  default), and measures how long it takes to stat and open the files in it.\n");
+}
+
+static void checkVFSResult(VFS::Result result, const char* context, const std::string& path)
+{
+	if(result != VFS::Result::success)
+	{
+		Errors::fatalf(
+			"%s failed for '%s': %s", context, path.c_str(), VFS::describeResult(result));
+	}
+}
+
+// Creates a tree of nested directories, each containing some empty files, and returns the paths of
+// the directories and files relative to the tree root.
+static void createTree(VFS::FileSystem& fs,
+					   std::vector<std::string>& outDirPaths,
+					   std::vector<std::string>& outFilePaths)
+{
+	std::string dirPath;
+	for(Uptr depth = 0; depth < treeDepth; ++depth)
+	{
+		dirPath += "/dir" + std::to_string(depth);
+		checkVFSResult(fs.createDir(dirPath), "createDir", dirPath);
+		outDirPaths.push_back(dirPath);
+
+		for(Uptr fileIndex = 0; fileIndex < numFilesPerDir; ++fileIndex)
+		{
+			const std::string filePath = dirPath + "/file" + std::to_string(fileIndex);
+			VFS::VFD* vfd = nullptr;
+			checkVFSResult(fs.open(filePath,
+								   VFS::FileAccessMode::writeOnly,
+								   VFS::FileCreateMode::createNew,
+								   vfd),
+						   "open",
+						   filePath);
+			checkVFSResult(vfd->close(), "close", filePath);
+			outFilePaths.push_back(filePath);
+		}
+	}
+}
+
+static void deleteTree(VFS::FileSystem& fs,
+					   const std::vector<std::string>& dirPaths,
+					   const std::vector<std::string>& filePaths)
+{
+	for(const std::string& filePath : filePaths)
+	{ checkVFSResult(fs.unlinkFile(filePath), "unlinkFile", filePath); }
+	for(auto dirPathIt = dirPaths.rbegin(); dirPathIt != dirPaths.rend(); ++dirPathIt)
+	{ checkVFSResult(fs.removeDir(*dirPathIt), "removeDir", *dirPathIt); }
+}
+
+// Stats and opens every file in the tree, and returns the sum of their file numbers so the results
+// from different file systems can be compared.
+static U64 runFileSystemBenchmark(VFS::FileSystem& fs,
+								  const std::vector<std::string>& filePaths,
+								  Uptr numIterations,
+								  const char* description)
+{
+	U64 fileNumberSum = 0;
+
+	Timing::Timer timer;
+	for(Uptr iterationIndex = 0; iterationIndex < numIterations; ++iterationIndex)
+	{
+		for(const std::string& filePath : filePaths)
+		{
+			VFS::FileInfo fileInfo;
+			checkVFSResult(fs.getFileInfo(filePath, fileInfo), "getFileInfo", filePath);
+			fileNumberSum += fileInfo.fileNumber;
+
+			VFS::VFD* vfd = nullptr;
+			checkVFSResult(fs.open(filePath,
+								   VFS::FileAccessMode::readOnly,
+								   VFS::FileCreateMode::openExisting,
+								   vfd),
+						   "open",
+						   filePath);
+			checkVFSResult(vfd->close(), "close", filePath);
+		}
+	}
+	timer.stop();
+
+	Log::printf(Log::output,
+				"ns/stat+open with %s: %.2f\n",
+				description,
+				timer.getNanoseconds() / F64(numIterations * filePaths.size()));
+
+	return fileNumberSum;
+}
+
+int execFileSystemBenchmark(int argc, char** argv)
+{
+	std::string rootPath;
+	Uptr numIterations = 100;
+	for(Iptr argumentIndex = 0; argumentIndex < argc; ++argumentIndex)
+	{
+		if(!strcmp(argv[argumentIndex], "--iterations") && argumentIndex + 1 < argc)
+		{
+			numIterations = Uptr(atoi(argv[++argumentIndex]));
+			if(!numIterations)
+			{
+				showFileSystemBenchmarkHelp(Log::error);
+				return EXIT_FAILURE;
+			}
+		}
+		else if(rootPath.empty() && argv[argumentIndex][0] != '-')
+		{
+			rootPath = argv[argumentIndex];
+		}
+		else
+		{
+			showFileSystemBenchmarkHelp(Log::error);
+			return EXIT_FAILURE;
+		}
+	}
+	if(rootPath.empty()) { rootPath = Platform::getCurrentWorkingDirectory(); }
+
+	// Create the tree in its own subdirectory of the root.
+	const std::string treeRootPath = rootPath + "/wavm-fsbench";
+	VFS::Result result = Platform::getHostFS().createDir(treeRootPath);
+	if(result != VFS::Result::success)
+	{
+		Log::printf(Log::error,
+					"Couldn't create '%s': %s\n",
+					treeRootPath.c_str(),
+					VFS::describeResult(result));
+		return EXIT_FAILURE;
+	}
+
+	std::shared_ptr<VFS::FileSystem> sandboxFS
+		= VFS::makeSandboxFS(&Platform::getHostFS(), treeRootPath);
+	std::shared_ptr<VFS::FileSystem> hostSandboxFS = Platform::makeHostSandboxFS(treeRootPath);
+	WAVM_ERROR_UNLESS(hostSandboxFS);
+
+	std::vector<std::string> dirPaths;
+	std::vector<std::string> filePaths;
+	createTree(*hostSandboxFS, dirPaths, filePaths);
+
+	const U64 sandboxFSResult
+		= runFileSystemBenchmark(*sandboxFS, filePaths, numIterations, "SandboxFS");
+	const U64 hostSandboxFSResult
+		= runFileSystemBenchmark(*hostSandboxFS, filePaths, numIterations, "host SandboxFS");
+
+	deleteTree(*hostSandboxFS, dirPaths, filePaths);
+	checkVFSResult(Platform::getHostFS().removeDir(treeRootPath), "removeDir", treeRootPath);
+
+	if(sandboxFSResult != hostSandboxFSResult)
+	{
+		Log::printf(Log::error, "The file systems disagree about the files in the tree.\n");
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
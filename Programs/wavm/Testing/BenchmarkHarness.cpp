@@ -0,0 +1,578 @@
+#include "BenchmarkHarness.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/HashMap.h"
+#include "WAVM/Inline/Timing.h"
+#include "WAVM/Logging/Logging.h"
+#include "WAVM/Platform/Clock.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace WAVM;
+
+// Pins the calling thread to the CPU it is running on, and restores its CPU affinity when
+// destroyed.
+struct ScopedCPUPin
+{
+	ScopedCPUPin(bool enable)
+	{
+#ifdef __linux__
+		if(!enable) { return; }
+		const int cpu = sched_getcpu();
+		if(cpu < 0 || sched_getaffinity(0, sizeof(oldCPUSet), &oldCPUSet)) { return; }
+
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+		CPU_SET(cpu, &cpuSet);
+		isPinned = !sched_setaffinity(0, sizeof(cpuSet), &cpuSet);
+#endif
+	}
+
+	~ScopedCPUPin()
+	{
+#ifdef __linux__
+		if(isPinned) { WAVM_ERROR_UNLESS(!sched_setaffinity(0, sizeof(oldCPUSet), &oldCPUSet)); }
+#endif
+	}
+
+private:
+#ifdef __linux__
+	cpu_set_t oldCPUSet;
+	bool isPinned{false};
+#endif
+};
+
+// Counts CPU cycles, instructions, and cache misses in user mode on the calling thread using
+// perf_event_open. isValid() returns false if the counters aren't available.
+struct HardwareEventCounters
+{
+	HardwareEventCounters(bool enable)
+	{
+#ifdef __linux__
+		if(!enable) { return; }
+
+		const U64 eventConfigs[numEvents] = {
+			PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES};
+		for(Uptr eventIndex = 0; eventIndex < numEvents; ++eventIndex)
+		{
+			struct perf_event_attr eventAttr;
+			memset(&eventAttr, 0, sizeof(eventAttr));
+			eventAttr.type = PERF_TYPE_HARDWARE;
+			eventAttr.size = sizeof(eventAttr);
+			eventAttr.config = eventConfigs[eventIndex];
+			eventAttr.read_format = PERF_FORMAT_GROUP;
+			eventAttr.disabled = eventIndex == 0;
+			eventAttr.exclude_kernel = 1;
+			eventAttr.exclude_hv = 1;
+
+			// The first event is the group leader, and the others are read and enabled with it.
+			fds[eventIndex] = int(syscall(
+				__NR_perf_event_open, &eventAttr, 0, -1, eventIndex == 0 ? -1 : fds[0], 0));
+			if(fds[eventIndex] < 0)
+			{
+				closeFDs();
+				return;
+			}
+		}
+#endif
+	}
+
+	~HardwareEventCounters() { closeFDs(); }
+
+	bool isValid() const { return fds[0] >= 0; }
+
+	void start()
+	{
+#ifdef __linux__
+		if(isValid())
+		{
+			WAVM_ERROR_UNLESS(!ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP));
+			WAVM_ERROR_UNLESS(!ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP));
+		}
+#endif
+	}
+
+	// Stops counting, and writes the counts to the result divided by numIterations.
+	void stop(Uptr numIterations, BenchmarkResult& outResult)
+	{
+#ifdef __linux__
+		if(!isValid()) { return; }
+		WAVM_ERROR_UNLESS(!ioctl(fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP));
+
+		struct
+		{
+			U64 numValues;
+			U64 values[numEvents];
+		} readBuffer;
+		if(read(fds[0], &readBuffer, sizeof(readBuffer)) != sizeof(readBuffer)
+		   || readBuffer.numValues != numEvents)
+		{ return; }
+
+		outResult.hasHardwareEvents = true;
+		outResult.cycles = F64(readBuffer.values[0]) / F64(numIterations);
+		outResult.instructions = F64(readBuffer.values[1]) / F64(numIterations);
+		outResult.cacheMisses = F64(readBuffer.values[2]) / F64(numIterations);
+#endif
+	}
+
+private:
+	static constexpr Uptr numEvents = 3;
+	int fds[numEvents] = {-1, -1, -1};
+
+	void closeFDs()
+	{
+#ifdef __linux__
+		for(int& fd : fds)
+		{
+			if(fd >= 0) { WAVM_ERROR_UNLESS(!close(fd)); }
+			fd = -1;
+		}
+#endif
+	}
+};
+
+// Timing::Timer stops when it is first read, so use the clock directly to check the elapsed time
+// in a loop.
+static F64 getNanosecondsSince(Time startTime)
+{
+	return F64(Platform::getClockTime(Platform::Clock::monotonic).ns - startTime.ns);
+}
+
+BenchmarkResult measureBenchmark(std::string&& name,
+								 const BenchmarkConfig& config,
+								 const std::function<void(U32 numIterations)>& runIterations)
+{
+	BenchmarkResult result;
+	result.name = std::move(name);
+
+	ScopedCPUPin cpuPin(config.pinCPU);
+	HardwareEventCounters hardwareEventCounters(config.countHardwareEvents);
+
+	// Warm up, doubling the number of iterations per sample until a sample takes at least
+	// minSampleNS.
+	U32 numIterationsPerSample = 1;
+	const Time warmupStartTime = Platform::getClockTime(Platform::Clock::monotonic);
+	while(true)
+	{
+		Timing::Timer sampleTimer;
+		runIterations(numIterationsPerSample);
+		const F64 sampleNS = sampleTimer.getNanoseconds();
+
+		const bool isSampleLongEnough
+			= sampleNS >= config.minSampleNS || numIterationsPerSample >= UINT32_MAX / 2;
+		if(isSampleLongEnough && getNanosecondsSince(warmupStartTime) >= config.warmupNS) { break; }
+		if(!isSampleLongEnough) { numIterationsPerSample *= 2; }
+	};
+
+	// Sample the benchmark for a fixed time.
+	std::vector<F64> nsPerIterationSamples;
+	hardwareEventCounters.start();
+	const Time samplingStartTime = Platform::getClockTime(Platform::Clock::monotonic);
+	while(nsPerIterationSamples.size() < config.minSamples
+		  || getNanosecondsSince(samplingStartTime) < config.samplingNS)
+	{
+		Timing::Timer sampleTimer;
+		runIterations(numIterationsPerSample);
+		nsPerIterationSamples.push_back(sampleTimer.getNanoseconds() / numIterationsPerSample);
+	};
+	result.numIterations = nsPerIterationSamples.size() * Uptr(numIterationsPerSample);
+	hardwareEventCounters.stop(result.numIterations, result);
+
+	computeBenchmarkStatistics(std::move(nsPerIterationSamples), result);
+	return result;
+}
+
+void computeBenchmarkStatistics(std::vector<F64>&& samples, BenchmarkResult& inOutResult)
+{
+	WAVM_ASSERT(samples.size());
+	std::sort(samples.begin(), samples.end());
+
+	const Uptr numSamples = samples.size();
+	inOutResult.numSamples = numSamples;
+
+	F64 sum = 0.0;
+	for(F64 sample : samples) { sum += sample; }
+	inOutResult.meanNS = sum / numSamples;
+
+	F64 sumSquaredDeviations = 0.0;
+	for(F64 sample : samples)
+	{ sumSquaredDeviations += (sample - inOutResult.meanNS) * (sample - inOutResult.meanNS); }
+	inOutResult.stdDevNS
+		= numSamples > 1 ? sqrt(sumSquaredDeviations / F64(numSamples - 1)) : 0.0;
+
+	inOutResult.minNS = samples[0];
+	inOutResult.medianNS = numSamples % 2
+							   ? samples[numSamples / 2]
+							   : (samples[numSamples / 2 - 1] + samples[numSamples / 2]) / 2.0;
+
+	// Use the nearest rank for the 99th percentile.
+	const Uptr p99Rank = Uptr(ceil(0.99 * F64(numSamples)));
+	inOutResult.p99NS = samples[std::max(p99Rank, Uptr(1)) - 1];
+
+	// The number of samples below the median is binomially distributed, so use the normal
+	// approximation of the binomial distribution to find the ranks that bound a 95% confidence
+	// interval for the median, without assuming anything about the distribution of the samples.
+	const F64 rankRadius = 1.96 * sqrt(F64(numSamples)) / 2.0;
+	const F64 lowRank = floor(F64(numSamples) / 2.0 - rankRadius);
+	const F64 highRank = ceil(F64(numSamples) / 2.0 + rankRadius);
+	inOutResult.medianLowNS = samples[lowRank < 0.0 ? 0 : Uptr(lowRank)];
+	inOutResult.medianHighNS = samples[std::min(Uptr(highRank), numSamples - 1)];
+}
+
+void logBenchmarkResult(Log::Category category, const BenchmarkResult& result)
+{
+	Log::printf(category,
+				"%s: median %.1fns [%.1fns, %.1fns], p99 %.1fns, mean %.1fns +/- %.1fns"
+				" (%" WAVM_PRIuPTR " samples, %" WAVM_PRIuPTR " iterations)\n",
+				result.name.c_str(),
+				result.medianNS,
+				result.medianLowNS,
+				result.medianHighNS,
+				result.p99NS,
+				result.meanNS,
+				result.stdDevNS,
+				result.numSamples,
+				result.numIterations);
+	if(result.hasHardwareEvents)
+	{
+		Log::printf(category,
+					"  %.1f cycles, %.1f instructions, %.3f cache misses per iteration\n",
+					result.cycles,
+					result.instructions,
+					result.cacheMisses);
+	}
+}
+
+//
+// JSON serialization
+//
+
+static void appendJSONString(std::string& json, const std::string& string)
+{
+	json += '"';
+	for(char c : string)
+	{
+		if(c == '"' || c == '\\')
+		{
+			json += '\\';
+			json += c;
+		}
+		else if(U8(c) < 0x20)
+		{
+			char escape[8];
+			snprintf(escape, sizeof(escape), "\\u%04x", unsigned(U8(c)));
+			json += escape;
+		}
+		else
+		{
+			json += c;
+		}
+	}
+	json += '"';
+}
+
+static void appendJSONNumber(std::string& json, const char* key, F64 value)
+{
+	char buffer[64];
+	snprintf(buffer, sizeof(buffer), ",\n      \"%s\": %.17g", key, value);
+	json += buffer;
+}
+
+std::string benchmarkResultsToJSON(const std::vector<BenchmarkResult>& results)
+{
+	std::string json = "{\n  \"benchmarks\": [";
+	for(Uptr resultIndex = 0; resultIndex < results.size(); ++resultIndex)
+	{
+		const BenchmarkResult& result = results[resultIndex];
+		json += resultIndex ? ",\n    {\n      \"name\": " : "\n    {\n      \"name\": ";
+		appendJSONString(json, result.name);
+		appendJSONNumber(json, "samples", F64(result.numSamples));
+		appendJSONNumber(json, "iterations", F64(result.numIterations));
+		appendJSONNumber(json, "mean_ns", result.meanNS);
+		appendJSONNumber(json, "stddev_ns", result.stdDevNS);
+		appendJSONNumber(json, "min_ns", result.minNS);
+		appendJSONNumber(json, "median_ns", result.medianNS);
+		appendJSONNumber(json, "median_low_ns", result.medianLowNS);
+		appendJSONNumber(json, "median_high_ns", result.medianHighNS);
+		appendJSONNumber(json, "p99_ns", result.p99NS);
+		if(result.hasHardwareEvents)
+		{
+			appendJSONNumber(json, "cycles", result.cycles);
+			appendJSONNumber(json, "instructions", result.instructions);
+			appendJSONNumber(json, "cache_misses", result.cacheMisses);
+		}
+		json += "\n    }";
+	}
+	json += "\n  ]\n}\n";
+	return json;
+}
+
+// A minimal JSON parser: enough to read the files written by benchmarkResultsToJSON.
+struct JSONValue
+{
+	enum class Type
+	{
+		null,
+		boolean,
+		number,
+		string,
+		array,
+		object
+	};
+
+	Type type{Type::null};
+	F64 number{0.0};
+	std::string string;
+	std::vector<JSONValue> elements;
+	std::vector<std::pair<std::string, JSONValue>> members;
+
+	const JSONValue* getMember(const char* key) const
+	{
+		for(const auto& member : members)
+		{
+			if(member.first == key) { return &member.second; }
+		}
+		return nullptr;
+	}
+};
+
+struct JSONParser
+{
+	const char* next;
+
+	void skipWhitespace()
+	{
+		while(*next == ' ' || *next == '\t' || *next == '\n' || *next == '\r') { ++next; }
+	}
+
+	bool parseString(std::string& outString)
+	{
+		if(*next != '"') { return false; }
+		++next;
+		while(*next != '"')
+		{
+			if(!*next || U8(*next) < 0x20) { return false; }
+			else if(*next == '\\')
+			{
+				++next;
+				switch(*next)
+				{
+				case '"':
+				case '\\':
+				case '/': outString += *next++; break;
+				case 'b': outString += '\b'; ++next; break;
+				case 'f': outString += '\f'; ++next; break;
+				case 'n': outString += '\n'; ++next; break;
+				case 'r': outString += '\r'; ++next; break;
+				case 't': outString += '\t'; ++next; break;
+				case 'u':
+				{
+					// Only code points that are encoded as a single UTF-8 byte are supported.
+					char* hexEnd = nullptr;
+					char hexDigits[5] = {0};
+					for(Uptr digitIndex = 0; digitIndex < 4; ++digitIndex)
+					{
+						if(!next[1 + digitIndex]) { return false; }
+						hexDigits[digitIndex] = next[1 + digitIndex];
+					}
+					const unsigned long codePoint = strtoul(hexDigits, &hexEnd, 16);
+					if(hexEnd != hexDigits + 4 || codePoint >= 0x80) { return false; }
+					outString += char(codePoint);
+					next += 5;
+					break;
+				}
+				default: return false;
+				};
+			}
+			else
+			{
+				outString += *next++;
+			}
+		}
+		++next;
+		return true;
+	}
+
+	bool parseValue(JSONValue& outValue)
+	{
+		skipWhitespace();
+		if(*next == '{')
+		{
+			outValue.type = JSONValue::Type::object;
+			++next;
+			skipWhitespace();
+			if(*next == '}')
+			{
+				++next;
+				return true;
+			}
+			while(true)
+			{
+				std::pair<std::string, JSONValue> member;
+				skipWhitespace();
+				if(!parseString(member.first)) { return false; }
+				skipWhitespace();
+				if(*next++ != ':' || !parseValue(member.second)) { return false; }
+				outValue.members.push_back(std::move(member));
+
+				skipWhitespace();
+				if(*next == '}')
+				{
+					++next;
+					return true;
+				}
+				else if(*next++ != ',')
+				{
+					return false;
+				}
+			}
+		}
+		else if(*next == '[')
+		{
+			outValue.type = JSONValue::Type::array;
+			++next;
+			skipWhitespace();
+			if(*next == ']')
+			{
+				++next;
+				return true;
+			}
+			while(true)
+			{
+				outValue.elements.emplace_back();
+				if(!parseValue(outValue.elements.back())) { return false; }
+
+				skipWhitespace();
+				if(*next == ']')
+				{
+					++next;
+					return true;
+				}
+				else if(*next++ != ',')
+				{
+					return false;
+				}
+			}
+		}
+		else if(*next == '"')
+		{
+			outValue.type = JSONValue::Type::string;
+			return parseString(outValue.string);
+		}
+		else if(!strncmp(next, "true", 4) || !strncmp(next, "false", 5))
+		{
+			outValue.type = JSONValue::Type::boolean;
+			outValue.number = *next == 't' ? 1.0 : 0.0;
+			next += *next == 't' ? 4 : 5;
+			return true;
+		}
+		else if(!strncmp(next, "null", 4))
+		{
+			outValue.type = JSONValue::Type::null;
+			next += 4;
+			return true;
+		}
+		else
+		{
+			char* numberEnd = nullptr;
+			outValue.type = JSONValue::Type::number;
+			outValue.number = strtod(next, &numberEnd);
+			if(numberEnd == next) { return false; }
+			next = numberEnd;
+			return true;
+		}
+	}
+};
+
+bool parseBenchmarkResultsJSON(const char* json, std::vector<BenchmarkResult>& outResults)
+{
+	JSONParser parser{json};
+	JSONValue root;
+	if(!parser.parseValue(root)) { return false; }
+	parser.skipWhitespace();
+	if(*parser.next) { return false; }
+
+	const JSONValue* benchmarks = root.getMember("benchmarks");
+	if(!benchmarks || benchmarks->type != JSONValue::Type::array) { return false; }
+
+	for(const JSONValue& benchmark : benchmarks->elements)
+	{
+		const JSONValue* name = benchmark.getMember("name");
+		if(!name || name->type != JSONValue::Type::string) { return false; }
+
+		BenchmarkResult result;
+		result.name = name->string;
+
+		auto getNumber = [&benchmark](const char* key, F64& outNumber) {
+			const JSONValue* value = benchmark.getMember(key);
+			if(!value || value->type != JSONValue::Type::number) { return false; }
+			outNumber = value->number;
+			return true;
+		};
+		F64 numSamples;
+		F64 numIterations;
+		if(!getNumber("samples", numSamples) || !getNumber("iterations", numIterations)
+		   || !getNumber("mean_ns", result.meanNS) || !getNumber("stddev_ns", result.stdDevNS)
+		   || !getNumber("min_ns", result.minNS) || !getNumber("median_ns", result.medianNS)
+		   || !getNumber("median_low_ns", result.medianLowNS)
+		   || !getNumber("median_high_ns", result.medianHighNS)
+		   || !getNumber("p99_ns", result.p99NS))
+		{ return false; }
+		result.numSamples = Uptr(numSamples);
+		result.numIterations = Uptr(numIterations);
+
+		result.hasHardwareEvents = getNumber("cycles", result.cycles)
+								   && getNumber("instructions", result.instructions)
+								   && getNumber("cache_misses", result.cacheMisses);
+
+		outResults.push_back(std::move(result));
+	}
+
+	return true;
+}
+
+Uptr compareBenchmarkResults(const std::vector<BenchmarkResult>& baselineResults,
+							 const std::vector<BenchmarkResult>& results,
+							 F64 threshold,
+							 std::vector<BenchmarkComparison>& outComparisons)
+{
+	HashMap<std::string, const BenchmarkResult*> baselineResultMap;
+	for(const BenchmarkResult& baselineResult : baselineResults)
+	{ baselineResultMap.set(baselineResult.name, &baselineResult); }
+
+	Uptr numRegressions = 0;
+	for(const BenchmarkResult& result : results)
+	{
+		const BenchmarkResult* const* baselineResult = baselineResultMap.get(result.name);
+		if(!baselineResult) { continue; }
+
+		BenchmarkComparison comparison;
+		comparison.name = result.name;
+		comparison.baselineMedianNS = (*baselineResult)->medianNS;
+		comparison.medianNS = result.medianNS;
+		comparison.relativeChange
+			= (result.medianNS - comparison.baselineMedianNS) / comparison.baselineMedianNS;
+		comparison.isRegression = comparison.relativeChange > threshold
+								  && result.medianLowNS > (*baselineResult)->medianHighNS;
+		comparison.isImprovement = comparison.relativeChange < -threshold
+								   && result.medianHighNS < (*baselineResult)->medianLowNS;
+		if(comparison.isRegression) { ++numRegressions; }
+		outComparisons.push_back(std::move(comparison));
+	}
+
+	return numRegressions;
+}
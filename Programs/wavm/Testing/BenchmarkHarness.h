@@ -0,0 +1,96 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Config.h"
+#include "WAVM/Logging/Logging.h"
+
+namespace WAVM { namespace IR {
+	struct FeatureSpec;
+}}
+
+struct BenchmarkConfig
+{
+	// The benchmark is run for warmupNS before it is sampled. The warmup also determines how many
+	// iterations to run for each sample, so that each sample takes at least minSampleNS.
+	WAVM::F64 warmupNS{100000000.0};
+	WAVM::F64 minSampleNS{1000000.0};
+
+	// The benchmark is sampled until samplingNS has elapsed and minSamples have been collected.
+	WAVM::F64 samplingNS{1000000000.0};
+	WAVM::Uptr minSamples{10};
+
+	// Whether to pin the benchmark thread to the CPU it is running on while sampling.
+	bool pinCPU{true};
+
+	// Whether to count hardware events while sampling. The counts are omitted from the results if
+	// the hardware counters aren't available.
+	bool countHardwareEvents{true};
+};
+
+struct BenchmarkResult
+{
+	std::string name;
+
+	WAVM::Uptr numSamples{0};
+	WAVM::Uptr numIterations{0};
+
+	// Statistics of the nanoseconds per iteration in the samples. medianLowNS and medianHighNS are
+	// the bounds of a 95% confidence interval for the median.
+	WAVM::F64 meanNS{0.0};
+	WAVM::F64 stdDevNS{0.0};
+	WAVM::F64 minNS{0.0};
+	WAVM::F64 medianNS{0.0};
+	WAVM::F64 medianLowNS{0.0};
+	WAVM::F64 medianHighNS{0.0};
+	WAVM::F64 p99NS{0.0};
+
+	// Hardware events per iteration, if hasHardwareEvents is true.
+	bool hasHardwareEvents{false};
+	WAVM::F64 cycles{0.0};
+	WAVM::F64 instructions{0.0};
+	WAVM::F64 cacheMisses{0.0};
+};
+
+// Measures a benchmark. runIterations must run the benchmarked code numIterations times.
+BenchmarkResult measureBenchmark(std::string&& name,
+								 const BenchmarkConfig& config,
+								 const std::function<void(WAVM::U32 numIterations)>& runIterations);
+
+// Computes the statistics of the nanoseconds per iteration from a set of samples.
+void computeBenchmarkStatistics(std::vector<WAVM::F64>&& nsPerIterationSamples,
+								BenchmarkResult& inOutResult);
+
+void logBenchmarkResult(WAVM::Log::Category category, const BenchmarkResult& result);
+
+// Converts benchmark results to and from JSON.
+std::string benchmarkResultsToJSON(const std::vector<BenchmarkResult>& results);
+bool parseBenchmarkResultsJSON(const char* json, std::vector<BenchmarkResult>& outResults);
+
+// Compares benchmark results to a baseline. A benchmark is considered to have regressed if its
+// median is more than threshold (as a fraction of the baseline median) slower than the baseline,
+// and the confidence intervals for the medians don't overlap. Returns the number of regressions.
+struct BenchmarkComparison
+{
+	std::string name;
+	WAVM::F64 baselineMedianNS;
+	WAVM::F64 medianNS;
+	WAVM::F64 relativeChange;
+	bool isRegression;
+	bool isImprovement;
+};
+WAVM::Uptr compareBenchmarkResults(const std::vector<BenchmarkResult>& baselineResults,
+								   const std::vector<BenchmarkResult>& results,
+								   WAVM::F64 threshold,
+								   std::vector<BenchmarkComparison>& outComparisons);
+
+#if WAVM_ENABLE_RUNTIME
+// Runs the benchmark commands in a set of WAST scripts on a single thread with the given config,
+// and returns their results. Returns false if any of the scripts had an error.
+bool runBenchmarkScripts(const std::vector<const char*>& filenames,
+						 const WAVM::IR::FeatureSpec& featureSpec,
+						 const BenchmarkConfig& config,
+						 std::vector<BenchmarkResult>& outResults);
+#endif
@@ -0,0 +1,221 @@
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Hash.h"
+#include "WAVM/Inline/HashMap.h"
+#include "WAVM/Inline/HashSet.h"
+#include "WAVM/Inline/HashTable.h"
+#include "WAVM/Inline/SwissHashTable.h"
+#include "WAVM/Inline/Timing.h"
+#include "WAVM/Logging/Logging.h"
+#include "wavm-test.h"
+
+using namespace WAVM;
+
+static void showHashMapBenchmarkHelp(Log::Category outputCategory)
+{
+	Log::printf(outputCategory,
+				"Usage: wavm test hashmapbench [--iterations <n>]\n"
+				"  Measures how long it takes to add, find, and remove keys in a HashMap using\n"
+				"  the Robin Hood HashTable and the SwissHashTable.\n");
+}
+
+static U32 getRandomU32()
+{
+	return (U32(rand()) << 30) ^ (U32(rand()) << 15) ^ U32(rand());
+}
+
+static void logTime(const char* operation,
+					const char* tableName,
+					Uptr numElements,
+					Timing::Timer& timer,
+					Uptr numOperations)
+{
+	timer.stop();
+	Log::printf(Log::output,
+				"ns/%s with %s, %" WAVM_PRIuPTR " elements: %.2f\n",
+				operation,
+				tableName,
+				numElements,
+				timer.getNanoseconds() / F64(numOperations));
+}
+
+// Adds random keys to a map, looks up keys that are and aren't in the map, and then removes and
+// adds keys, and returns a checksum of the values that were found.
+template<template<typename...> class Table>
+static U64 benchmarkU32Keys(const char* tableName,
+							const std::vector<U32>& keys,
+							const std::vector<U32>& missingKeys,
+							Uptr numIterations)
+{
+	U64 checksum = 0;
+
+	Timing::Timer addTimer;
+	std::vector<HashMap<U32, U32, DefaultHashPolicy<U32>, Table>> maps(numIterations);
+	for(Uptr iterationIndex = 0; iterationIndex < numIterations; ++iterationIndex)
+	{
+		for(U32 key : keys) { maps[iterationIndex].add(key, key ^ 0x5555); }
+	}
+	logTime("add", tableName, keys.size(), addTimer, numIterations * keys.size());
+	HashMap<U32, U32, DefaultHashPolicy<U32>, Table>& map = maps[0];
+
+	Timing::Timer hitTimer;
+	for(Uptr iterationIndex = 0; iterationIndex < numIterations; ++iterationIndex)
+	{
+		for(U32 key : keys) { checksum += map[key]; }
+	}
+	logTime("hit", tableName, keys.size(), hitTimer, numIterations * keys.size());
+
+	Timing::Timer missTimer;
+	for(Uptr iterationIndex = 0; iterationIndex < numIterations; ++iterationIndex)
+	{
+		for(U32 key : missingKeys) { checksum += map.contains(key); }
+	}
+	logTime("miss", tableName, keys.size(), missTimer, numIterations * missingKeys.size());
+
+	// Remove each key and add it back with a different value, so the SwissHashTable accumulates
+	// deleted buckets.
+	Timing::Timer churnTimer;
+	for(Uptr iterationIndex = 0; iterationIndex < numIterations; ++iterationIndex)
+	{
+		for(U32 key : keys)
+		{
+			map.removeOrFail(key);
+			map.addOrFail(key, U32(iterationIndex));
+		}
+	}
+	logTime("remove+add", tableName, keys.size(), churnTimer, numIterations * keys.size());
+
+	for(const auto& pair : map) { checksum += pair.key ^ pair.value; }
+	return checksum;
+}
+
+// Looks up identifiers in a HashMap with std::string keys, either by constructing a std::string for
+// each identifier or by using a StringView, and returns a checksum of the values that were found.
+template<template<typename...> class Table>
+static U64 benchmarkStringKeys(const char* tableName,
+							   const std::vector<std::string>& keys,
+							   const std::string& text,
+							   const std::vector<Uptr>& keyOffsets,
+							   Uptr numIterations)
+{
+	HashMap<std::string, Uptr, DefaultHashPolicy<std::string>, Table> map;
+	for(Uptr keyIndex = 0; keyIndex < keys.size(); ++keyIndex)
+	{ map.add(keys[keyIndex], keyIndex); }
+
+	U64 checksum = 0;
+	Timing::Timer stringTimer;
+	for(Uptr iterationIndex = 0; iterationIndex < numIterations; ++iterationIndex)
+	{
+		for(Uptr keyIndex = 0; keyIndex < keys.size(); ++keyIndex)
+		{
+			const char* key = text.data() + keyOffsets[keyIndex];
+			const Uptr numChars = keys[keyIndex].size();
+			const Uptr* valuePtr = map.get(std::string(key, numChars));
+			checksum += valuePtr ? *valuePtr : UINT32_MAX;
+		}
+	}
+	logTime(
+		"std::string lookup", tableName, keys.size(), stringTimer, numIterations * keys.size());
+
+	Timing::Timer stringViewTimer;
+	for(Uptr iterationIndex = 0; iterationIndex < numIterations; ++iterationIndex)
+	{
+		for(Uptr keyIndex = 0; keyIndex < keys.size(); ++keyIndex)
+		{
+			const char* key = text.data() + keyOffsets[keyIndex];
+			const Uptr numChars = keys[keyIndex].size();
+			const Uptr* valuePtr = map.get(StringView(key, numChars));
+			checksum -= valuePtr ? *valuePtr : 0;
+		}
+	}
+	logTime(
+		"StringView lookup", tableName, keys.size(), stringViewTimer, numIterations * keys.size());
+
+	return checksum;
+}
+
+int execHashMapBenchmark(int argc, char** argv)
+{
+	Uptr numIterations = 10;
+	for(Iptr argumentIndex = 0; argumentIndex < argc; ++argumentIndex)
+	{
+		if(!strcmp(argv[argumentIndex], "--iterations") && argumentIndex + 1 < argc)
+		{
+			numIterations = Uptr(atoi(argv[++argumentIndex]));
+			if(!numIterations)
+			{
+				showHashMapBenchmarkHelp(Log::error);
+				return EXIT_FAILURE;
+			}
+		}
+		else
+		{
+			showHashMapBenchmarkHelp(Log::error);
+			return EXIT_FAILURE;
+		}
+	}
+
+	srand(0);
+	for(Uptr numElements : {Uptr(1000), Uptr(100000)})
+	{
+		// Generate distinct keys, and keys that aren't in the map.
+		HashSet<U32> keySet;
+		std::vector<U32> keys;
+		std::vector<U32> missingKeys;
+		while(keys.size() < numElements)
+		{
+			const U32 key = getRandomU32();
+			if(keySet.add(key)) { keys.push_back(key); }
+		}
+		while(missingKeys.size() < numElements)
+		{
+			const U32 key = getRandomU32();
+			if(!keySet.contains(key)) { missingKeys.push_back(key); }
+		}
+
+		const U64 hashTableChecksum
+			= benchmarkU32Keys<HashTable>("HashTable", keys, missingKeys, numIterations);
+		const U64 swissHashTableChecksum
+			= benchmarkU32Keys<SwissHashTable>("SwissHashTable", keys, missingKeys, numIterations);
+		if(hashTableChecksum != swissHashTableChecksum)
+		{
+			Log::printf(Log::error, "The hash tables disagree about the contents of the map.\n");
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Generate identifiers like those in a WAST file, and a text that contains them all.
+	static constexpr Uptr numStrings = 10000;
+	HashSet<std::string> stringSet;
+	std::vector<std::string> strings;
+	std::string text;
+	std::vector<Uptr> stringOffsets;
+	while(strings.size() < numStrings)
+	{
+		std::string string = "$";
+		const Uptr numChars = 4 + rand() % 28;
+		for(Uptr charIndex = 0; charIndex < numChars; ++charIndex)
+		{ string += char('a' + rand() % 26); }
+		if(stringSet.add(string))
+		{
+			stringOffsets.push_back(text.size());
+			text += string + " ";
+			strings.push_back(std::move(string));
+		}
+	}
+
+	const U64 hashTableChecksum = benchmarkStringKeys<HashTable>(
+		"HashTable", strings, text, stringOffsets, numIterations);
+	const U64 swissHashTableChecksum = benchmarkStringKeys<SwissHashTable>(
+		"SwissHashTable", strings, text, stringOffsets, numIterations);
+	if(hashTableChecksum || swissHashTableChecksum)
+	{
+		Log::printf(Log::error, "The std::string and StringView lookups found different values.\n");
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -116,6 +116,19 @@ static void dumpCommandModules(const char* filename,
 
 		break;
 	}
+	case Command::benchmark: {
+		auto benchmarkCommand = (BenchmarkCommand*)command;
+		if(benchmarkCommand->action->type == ActionType::_module)
+		{
+			auto moduleAction = (ModuleAction*)benchmarkCommand->action.get();
+			Log::printf(Log::output,
+						"Dumping benchmark module at %s:%s...\n",
+						filename,
+						moduleAction->locus.describe().c_str());
+			dumpModule(*moduleAction->module, outputDir, dumpFormat);
+		}
+		break;
+	}
 	case Command::thread: {
 		auto threadCommand = (ThreadCommand*)command;
 		for(auto& innerCommand : threadCommand->commands)
@@ -134,7 +147,6 @@ static void dumpCommandModules(const char* filename,
 	case Command::assert_return_func:
 	case Command::assert_trap:
 	case Command::assert_throws:
-	case Command::benchmark:
 	case Command::wait:
 	default: break;
 	};
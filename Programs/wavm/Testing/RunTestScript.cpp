@@ -32,6 +32,7 @@
 #include "WAVM/ThreadTest/ThreadTest.h"
 #include "WAVM/WASTParse/TestScript.h"
 #include "WAVM/WASTParse/WASTParse.h"
+#include "BenchmarkHarness.h"
 #include "wavm-test.h"
 
 using namespace WAVM;
@@ -58,6 +59,13 @@ struct Config
 	bool traceLLVMIR{false};
 	bool traceAssembly{false};
 	FeatureSpec featureSpec{FeatureLevel::standard};
+
+	// By default, benchmark commands are only sampled briefly to check that they work.
+	BenchmarkConfig benchmarkConfig{0.0, 100000.0, 20000000.0, 1, false, false};
+
+	// If non-null, the results of benchmark commands are added to this vector. This may only be
+	// used when running a single test thread.
+	std::vector<BenchmarkResult>* benchmarkResults{nullptr};
 };
 
 enum class TestScriptStateKind
@@ -1097,10 +1105,28 @@ static void processAssertUnlinkable(TestScriptState& state,
 		});
 }
 
-static void processBenchmark(TestScriptState& state, const BenchmarkCommand* benchmarkCommand)
+static std::string getFilenameAndExtension(const char* path)
+{
+	const char* filenameBegin = path;
+	for(Uptr charIndex = 0; path[charIndex]; ++charIndex)
+	{
+		if(path[charIndex] == '/' || path[charIndex] == '\\')
+		{ filenameBegin = path + charIndex + 1; }
+	}
+	return std::string(filenameBegin);
+}
+
+static void recordBenchmarkResult(TestScriptState& state, BenchmarkResult&& result)
 {
-	InvokeAction* invokeAction = benchmarkCommand->invokeAction.get();
+	logBenchmarkResult(Log::output, result);
+	if(state.config.benchmarkResults)
+	{ state.config.benchmarkResults->push_back(std::move(result)); }
+}
 
+static void processInvokeBenchmark(TestScriptState& state,
+								   const std::string& benchmarkName,
+								   const InvokeAction* invokeAction)
+{
 	// Look up the module this invoke uses.
 	Instance* invokeInstance = getModuleContextByInternalName(
 		state, invokeAction->locus, "invoke", invokeAction->internalModuleName);
@@ -1223,37 +1249,95 @@ static void processBenchmark(TestScriptState& state, const BenchmarkCommand* ben
 	Function* benchmarkFunction = getTypedInstanceExport(
 		benchmarkInstance, "benchmark", FunctionType({}, {ValueType::i32}));
 
-	// Run the benchmark once to warm up caches (not just CPU, also the cached invoke thunk).
-	UntaggedValue benchmarkArgs[1];
-	benchmarkArgs[0].u32 = 10;
-	Runtime::invokeFunction(state.context, benchmarkFunction, benchmarkFunctionSig, benchmarkArgs);
-
-	// Sample the benchmark until 20ms or 1 million samples have been collected.
-	static constexpr F64 minSamplingNS = 20000000.0;
-	static constexpr Uptr maxSamples = 1000000;
-	U32 numIterationsPerSample = 10;
-	F64 totalNS = 0.0;
-	Uptr numSamples = 0;
-	Uptr numIterations = 0;
-	while(numSamples < maxSamples && totalNS < minSamplingNS)
+	// Measure the benchmark.
+	recordBenchmarkResult(
+		state,
+		measureBenchmark(std::string(benchmarkName),
+						 state.config.benchmarkConfig,
+						 [&](U32 numIterations) {
+							 UntaggedValue benchmarkArgs[1];
+							 benchmarkArgs[0].u32 = numIterations;
+							 Runtime::invokeFunction(state.context,
+													 benchmarkFunction,
+													 benchmarkFunctionSig,
+													 benchmarkArgs);
+						 }));
+}
+
+static void processModuleBenchmark(TestScriptState& state,
+								   const std::string& benchmarkName,
+								   const ModuleAction* moduleAction)
+{
+	// The instances created by the benchmark are destroyed by collecting garbage after each sample,
+	// so it may only run on the root test script thread.
+	if(state.kind != TestScriptStateKind::root || state.threads.size())
 	{
-		benchmarkArgs[0].u32 = numIterationsPerSample;
-		Timing::Timer timer;
-		Runtime::invokeFunction(
-			state.context, benchmarkFunction, benchmarkFunctionSig, benchmarkArgs);
-		timer.stop();
-		totalNS += timer.getNanoseconds();
-		++numSamples;
-		numIterations += numIterationsPerSample;
-		numIterationsPerSample = numIterationsPerSample * 3 / 2;
-	};
-	const F64 nsPerIteration = totalNS / numIterations;
+		testErrorf(state,
+				   moduleAction->locus,
+				   "module benchmarks may not be run while test script threads are running");
+		return;
+	}
+
+	const IR::Module& irModule = *moduleAction->module;
+
+	// Link the module once: the benchmark measures compilation and instantiation.
+	TestScriptResolver resolver(state);
+	LinkResult linkResult = linkModule(irModule, resolver);
+	if(!linkResult.success)
+	{
+		testErrorf(state, moduleAction->locus, "benchmark module couldn't be linked");
+		return;
+	}
+
+	// Measure compiling the module.
+	ModuleRef compiledModule;
+	recordBenchmarkResult(state,
+						  measureBenchmark(benchmarkName + "/compile",
+										   state.config.benchmarkConfig,
+										   [&](U32 numIterations) {
+											   for(U32 iteration = 0; iteration < numIterations;
+												   ++iteration)
+											   { compiledModule = compileModule(irModule); }
+										   }));
+
+	// Measure instantiating and destroying the module.
+	InstantiationTemplateRef instantiationTemplate = createInstantiationTemplate(
+		state.compartment,
+		compiledModule,
+		std::move(linkResult.resolvedImports),
+		std::string(state.scriptFilename) + ":" + moduleAction->locus.describe());
+	recordBenchmarkResult(state,
+						  measureBenchmark(benchmarkName + "/instantiate",
+										   state.config.benchmarkConfig,
+										   [&](U32 numIterations) {
+											   for(U32 iteration = 0; iteration < numIterations;
+												   ++iteration)
+											   {
+												   WAVM_ERROR_UNLESS(
+													   instantiateModule(instantiationTemplate));
+											   }
+											   collectCompartmentGarbage(state.compartment);
+										   }));
+}
+
+static void processBenchmark(TestScriptState& state, const BenchmarkCommand* benchmarkCommand)
+{
+	const std::string benchmarkName
+		= getFilenameAndExtension(state.scriptFilename) + ':' + benchmarkCommand->name;
+	switch(benchmarkCommand->action->type)
+	{
+	case ActionType::invoke:
+		processInvokeBenchmark(
+			state, benchmarkName, (const InvokeAction*)benchmarkCommand->action.get());
+		break;
+	case ActionType::_module:
+		processModuleBenchmark(
+			state, benchmarkName, (const ModuleAction*)benchmarkCommand->action.get());
+		break;
 
-	Log::printf(Log::output,
-				"%s benchmark: %.1fns (%" WAVM_PRIuPTR " iterations)\n",
-				benchmarkCommand->name.c_str(),
-				nsPerIteration,
-				numIterations);
+	case ActionType::get:
+	default: WAVM_UNREACHABLE();
+	};
 }
 
 static void processCommands(TestScriptState& state,
@@ -1782,3 +1866,29 @@ int execRunTestScript(int argc, char** argv)
 		}
 	}
 }
+
+bool runBenchmarkScripts(const std::vector<const char*>& filenames,
+						 const FeatureSpec& featureSpec,
+						 const BenchmarkConfig& benchmarkConfig,
+						 std::vector<BenchmarkResult>& outResults)
+{
+	SharedState sharedState;
+	sharedState.config.featureSpec = featureSpec;
+	sharedState.config.benchmarkConfig = benchmarkConfig;
+	sharedState.config.benchmarkResults = &outResults;
+
+	// threadMain processes the filenames from the end of the vector, so reverse them to run the
+	// scripts in the order they were specified.
+	sharedState.pendingFilenames.assign(filenames.rbegin(), filenames.rend());
+
+	// Run the scripts on a single thread, so the benchmarks don't compete for the CPU.
+	Platform::Thread* thread
+		= Platform::createThread(threadStackNumBytes, threadMain, &sharedState);
+	const I64 numErrors = Platform::joinThread(thread);
+	if(numErrors)
+	{
+		Log::printf(Log::error, "Benchmarking failed with %" PRIi64 " error(s)\n", numErrors);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,147 @@
+#include <string>
+#include <utility>
+#include <vector>
+#include "BenchmarkHarness.h"
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Timing.h"
+#include "wavm-test.h"
+
+using namespace WAVM;
+
+static BenchmarkResult makeResult(std::string&& name, std::vector<F64>&& samples)
+{
+	BenchmarkResult result;
+	result.name = std::move(name);
+	computeBenchmarkStatistics(std::move(samples), result);
+	return result;
+}
+
+static void testStatistics()
+{
+	// 1..100 in a scrambled order.
+	std::vector<F64> samples;
+	for(Uptr i = 0; i < 100; ++i) { samples.push_back(F64((i * 37) % 100 + 1)); }
+	BenchmarkResult result = makeResult("test", std::move(samples));
+
+	WAVM_ERROR_UNLESS(result.numSamples == 100);
+	WAVM_ERROR_UNLESS(result.minNS == 1.0);
+	WAVM_ERROR_UNLESS(result.meanNS == 50.5);
+	WAVM_ERROR_UNLESS(result.medianNS == 50.5);
+	WAVM_ERROR_UNLESS(result.p99NS == 99.0);
+	WAVM_ERROR_UNLESS(result.stdDevNS > 29.0 && result.stdDevNS < 29.1);
+
+	// The 95% confidence interval for the median of 100 samples is between the 41st and 61st
+	// smallest samples.
+	WAVM_ERROR_UNLESS(result.medianLowNS == 41.0);
+	WAVM_ERROR_UNLESS(result.medianHighNS == 61.0);
+
+	// A single sample.
+	BenchmarkResult singleResult = makeResult("single", {7.0});
+	WAVM_ERROR_UNLESS(singleResult.medianNS == 7.0);
+	WAVM_ERROR_UNLESS(singleResult.medianLowNS == 7.0);
+	WAVM_ERROR_UNLESS(singleResult.medianHighNS == 7.0);
+	WAVM_ERROR_UNLESS(singleResult.p99NS == 7.0);
+	WAVM_ERROR_UNLESS(singleResult.stdDevNS == 0.0);
+}
+
+static void testJSON()
+{
+	std::vector<BenchmarkResult> results;
+	results.push_back(makeResult("a.wast:\"quoted\\name\"\n", {1.0, 2.0, 3.0}));
+	results.push_back(makeResult("b", {0.1, 0.2}));
+	results.back().hasHardwareEvents = true;
+	results.back().cycles = 12.5;
+	results.back().instructions = 40.0;
+	results.back().cacheMisses = 0.001;
+
+	std::vector<BenchmarkResult> parsedResults;
+	WAVM_ERROR_UNLESS(parseBenchmarkResultsJSON(benchmarkResultsToJSON(results).c_str(),
+												parsedResults));
+	WAVM_ERROR_UNLESS(parsedResults.size() == results.size());
+	for(Uptr resultIndex = 0; resultIndex < results.size(); ++resultIndex)
+	{
+		const BenchmarkResult& result = results[resultIndex];
+		const BenchmarkResult& parsedResult = parsedResults[resultIndex];
+		WAVM_ERROR_UNLESS(parsedResult.name == result.name);
+		WAVM_ERROR_UNLESS(parsedResult.numSamples == result.numSamples);
+		WAVM_ERROR_UNLESS(parsedResult.meanNS == result.meanNS);
+		WAVM_ERROR_UNLESS(parsedResult.stdDevNS == result.stdDevNS);
+		WAVM_ERROR_UNLESS(parsedResult.medianNS == result.medianNS);
+		WAVM_ERROR_UNLESS(parsedResult.medianLowNS == result.medianLowNS);
+		WAVM_ERROR_UNLESS(parsedResult.medianHighNS == result.medianHighNS);
+		WAVM_ERROR_UNLESS(parsedResult.p99NS == result.p99NS);
+		WAVM_ERROR_UNLESS(parsedResult.hasHardwareEvents == result.hasHardwareEvents);
+		WAVM_ERROR_UNLESS(parsedResult.cycles == result.cycles);
+		WAVM_ERROR_UNLESS(parsedResult.cacheMisses == result.cacheMisses);
+	}
+
+	std::vector<BenchmarkResult> invalidResults;
+	WAVM_ERROR_UNLESS(!parseBenchmarkResultsJSON("", invalidResults));
+	WAVM_ERROR_UNLESS(!parseBenchmarkResultsJSON("{\"benchmarks\": [", invalidResults));
+	WAVM_ERROR_UNLESS(!parseBenchmarkResultsJSON("{\"benchmarks\": [{}]}", invalidResults));
+	WAVM_ERROR_UNLESS(!parseBenchmarkResultsJSON("{\"benchmarks\": []} x", invalidResults));
+	WAVM_ERROR_UNLESS(parseBenchmarkResultsJSON("{\"benchmarks\": []}", invalidResults));
+	WAVM_ERROR_UNLESS(!invalidResults.size());
+}
+
+static void testComparison()
+{
+	auto makeSamples = [](F64 center) {
+		std::vector<F64> samples;
+		for(Uptr i = 0; i < 50; ++i) { samples.push_back(center + F64(i % 5) * 0.01 * center); }
+		return samples;
+	};
+
+	std::vector<BenchmarkResult> baselineResults;
+	baselineResults.push_back(makeResult("unchanged", makeSamples(100.0)));
+	baselineResults.push_back(makeResult("slower", makeSamples(100.0)));
+	baselineResults.push_back(makeResult("faster", makeSamples(100.0)));
+	baselineResults.push_back(makeResult("removed", makeSamples(100.0)));
+
+	std::vector<BenchmarkResult> results;
+	results.push_back(makeResult("unchanged", makeSamples(101.0)));
+	results.push_back(makeResult("slower", makeSamples(120.0)));
+	results.push_back(makeResult("faster", makeSamples(80.0)));
+	results.push_back(makeResult("added", makeSamples(100.0)));
+
+	std::vector<BenchmarkComparison> comparisons;
+	WAVM_ERROR_UNLESS(compareBenchmarkResults(baselineResults, results, 0.05, comparisons) == 1);
+	WAVM_ERROR_UNLESS(comparisons.size() == 3);
+	WAVM_ERROR_UNLESS(!comparisons[0].isRegression && !comparisons[0].isImprovement);
+	WAVM_ERROR_UNLESS(comparisons[1].isRegression && !comparisons[1].isImprovement);
+	WAVM_ERROR_UNLESS(!comparisons[2].isRegression && comparisons[2].isImprovement);
+
+	// A change within the threshold isn't a regression.
+	comparisons.clear();
+	WAVM_ERROR_UNLESS(compareBenchmarkResults(baselineResults, results, 0.5, comparisons) == 0);
+}
+
+static void testMeasure()
+{
+	BenchmarkConfig config;
+	config.warmupNS = 1000000.0;
+	config.minSampleNS = 10000.0;
+	config.samplingNS = 10000000.0;
+
+	volatile U64 sum = 0;
+	BenchmarkResult result = measureBenchmark("loop", config, [&sum](U32 numIterations) {
+		for(U32 iteration = 0; iteration < numIterations; ++iteration) { sum = sum + iteration; }
+	});
+	WAVM_ERROR_UNLESS(result.numSamples >= config.minSamples);
+	WAVM_ERROR_UNLESS(result.numIterations >= result.numSamples);
+	WAVM_ERROR_UNLESS(result.minNS <= result.medianNS && result.medianNS <= result.p99NS);
+	WAVM_ERROR_UNLESS(result.medianLowNS <= result.medianNS);
+	WAVM_ERROR_UNLESS(result.medianNS <= result.medianHighNS);
+}
+
+I32 execBenchmarkHarnessTest(int argc, char** argv)
+{
+	Timing::Timer timer;
+	testStatistics();
+	testJSON();
+	testComparison();
+	testMeasure();
+	Timing::logTimer("BenchmarkHarnessTest", timer);
+	return 0;
+}
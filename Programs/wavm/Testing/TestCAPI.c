@@ -1,4 +1,5 @@
 #include <inttypes.h>
+#include <stdlib.h>
 #include <string.h>
 #include "WAVM/wavm-c/wavm-c.h"
 #include "wavm-test.h"
@@ -14,9 +15,48 @@ own wasm_trap_t* hello_callback(const wasm_val_t args[], wasm_val_t results[])
 	return NULL;
 }
 
+static uintptr_t numFinalizedEnvs = 0;
+
+// A function with an environment to be called from Wasm code.
+own wasm_trap_t* hello_callback_with_env(void* env, const wasm_val_t args[], wasm_val_t results[])
+{
+	++*(uintptr_t*)env;
+	return NULL;
+}
+
+void hello_env_finalizer(void* env) { ++numFinalizedEnvs; }
+
+static uintptr_t numFinalizedAddEnvs = 0;
+
+// Adds the parameters to the addend in the environment, passing them through arrays.
+own wasm_trap_t* add_callback_with_env(void* env, const wasm_val_t args[], wasm_val_t results[])
+{
+	results[0].i64 = *(int64_t*)env + args[0].i32 + args[1].i64;
+	return NULL;
+}
+
+// Adds the parameters to the addend in the environment, receiving them directly as arguments.
+int64_t add_raw_callback(void* env, int32_t a, int64_t b) { return *(int64_t*)env + a + b; }
+
+void add_env_finalizer(void* env) { ++numFinalizedAddEnvs; }
+
+// Calls a function of type (param i32 i64) (result i64), and returns whether it returned the
+// expected result.
+static bool callAdd(wasm_store_t* store, const wasm_func_t* func, int64_t expectedResult)
+{
+	wasm_val_t args[2];
+	args[0].i32 = 3;
+	args[1].i64 = 4;
+	wasm_val_t results[1];
+	results[0].i64 = 0;
+	if(wasm_func_call(store, func, args, results)) { return false; }
+	return results[0].i64 == expectedResult;
+}
+
 int execCAPITest(int argc, char** argv)
 {
 	// Initialize.
+	wasm_metrics_set_enabled(true);
 	wasm_engine_t* engine = wasm_engine_new();
 	wasm_compartment_t* compartment = wasm_compartment_new(engine, "compartment");
 	wasm_store_t* store = wasm_store_new(compartment, "store");
@@ -38,6 +78,14 @@ int execCAPITest(int argc, char** argv)
 	own wasm_func_t* hello_func
 		= wasm_func_new(compartment, hello_type, hello_callback, "hello_callback");
 
+	uintptr_t numEnvCallbacks = 0;
+	own wasm_func_t* hello_func_with_env = wasm_func_new_with_env(compartment,
+																  hello_type,
+																  hello_callback_with_env,
+																  &numEnvCallbacks,
+																  hello_env_finalizer,
+																  "hello_callback_with_env");
+
 	wasm_functype_delete(hello_type);
 
 	// Instantiate.
@@ -54,13 +102,73 @@ int execCAPITest(int argc, char** argv)
 	const wasm_func_t* run_func = wasm_extern_as_func(run_extern);
 	if(run_func == NULL) { return 1; }
 
-	wasm_module_delete(module);
 	wasm_instance_delete(instance);
 
 	// Call.
 	if(wasm_func_call(store, run_func, NULL, NULL)) { return 1; }
 
+	// Instantiate and call the module again with the function that has an environment.
+	imports[0] = wasm_func_as_extern(hello_func_with_env);
+	own wasm_instance_t* instance_with_env
+		= wasm_instance_new(store, module, imports, NULL, "instance_with_env");
+	if(!instance_with_env) { return 1; }
+	wasm_func_delete(hello_func_with_env);
+	run_func = wasm_extern_as_func(wasm_instance_export(instance_with_env, 0));
+	if(run_func == NULL) { return 1; }
+	wasm_instance_delete(instance_with_env);
+	if(wasm_func_call(store, run_func, NULL, NULL)) { return 1; }
+
+	// Create a function with a raw callback, and call it.
+	own wasm_functype_t* add_type = wasm_functype_new_2_1(
+		wasm_valtype_new_i32(), wasm_valtype_new_i64(), wasm_valtype_new_i64());
+	int64_t rawAddend = 10;
+	own wasm_func_t* raw_add_func = wasm_func_new_raw(compartment,
+													  add_type,
+													  (void*)&add_raw_callback,
+													  &rawAddend,
+													  add_env_finalizer,
+													  "raw_add");
+	if(!raw_add_func) { return 1; }
+	if(!callAdd(store, raw_add_func, 17)) { return 1; }
+	wasm_func_delete(raw_add_func);
+
+	// Raw callbacks don't support v128 parameters.
+	own wasm_functype_t* v128_type = wasm_functype_new_1_0(wasm_valtype_new_v128());
+	if(wasm_func_new_raw(
+		   compartment, v128_type, (void*)&add_raw_callback, NULL, NULL, "raw_v128"))
+	{ return 1; }
+
+	// Create a batch with a function that has an array callback, and a function that has a raw
+	// callback, and call both of them.
+	int64_t batchAddends[2] = {20, 30};
+	wasm_func_desc_t descs[2];
+	descs[0].type = add_type;
+	descs[0].callback = add_callback_with_env;
+	descs[0].raw_callback = NULL;
+	descs[0].env = &batchAddends[0];
+	descs[0].finalizer = add_env_finalizer;
+	descs[0].debug_name = "add_with_env";
+	descs[1].type = add_type;
+	descs[1].callback = NULL;
+	descs[1].raw_callback = (void*)&add_raw_callback;
+	descs[1].env = &batchAddends[1];
+	descs[1].finalizer = add_env_finalizer;
+	descs[1].debug_name = "raw_add";
+	own wasm_func_t* batch_funcs[2];
+	if(!wasm_func_new_batch(compartment, 2, descs, batch_funcs)) { return 1; }
+	if(!callAdd(store, batch_funcs[0], 27) || !callAdd(store, batch_funcs[1], 37)) { return 1; }
+	wasm_func_delete(batch_funcs[0]);
+	wasm_func_delete(batch_funcs[1]);
+
+	// A batch that contains an unsupported raw callback doesn't create any functions.
+	descs[1].type = v128_type;
+	if(wasm_func_new_batch(compartment, 2, descs, batch_funcs)) { return 1; }
+
+	wasm_functype_delete(v128_type);
+	wasm_functype_delete(add_type);
+
 	// Shut down.
+	wasm_module_delete(module);
 	wasm_store_delete(store);
 	wasm_compartment_delete(compartment);
 	wasm_engine_delete(engine);
@@ -68,5 +176,31 @@ int execCAPITest(int argc, char** argv)
 	// Assert that the callback was called exactly once.
 	if(numCallbacks != 1) { return 1; }
 
+	// Assert that the callback with an environment was called exactly once, and that its
+	// environment was finalized when the compartment was deleted.
+	if(numEnvCallbacks != 1 || numFinalizedEnvs != 1) { return 1; }
+
+	// Assert that the environments of the raw function and of both functions in the batch were
+	// finalized.
+	if(numFinalizedAddEnvs != 3) { return 1; }
+
+	// Assert that the two instantiations were recorded in the metrics.
+	uint64_t numInstantiations = 0;
+	uint64_t instantiateNanoseconds = 0;
+	if(!wasm_metrics_get("wavm_instantiate_duration_seconds",
+						 NULL,
+						 &numInstantiations,
+						 &instantiateNanoseconds)
+	   || numInstantiations != 2)
+	{ return 1; }
+
+	size_t num_metrics_chars = 0;
+	char* metrics_text = wasm_metrics_print_prometheus(&num_metrics_chars);
+	const bool printedInstantiations
+		= strstr(metrics_text, "wavm_instantiate_duration_seconds_count 2\n") != NULL;
+	free(metrics_text);
+	if(!printedInstantiations) { return 1; }
+	wasm_metrics_set_enabled(false);
+
 	return 0;
 }
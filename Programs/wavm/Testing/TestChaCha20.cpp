@@ -0,0 +1,82 @@
+#include <string.h>
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/ChaCha20.h"
+#include "WAVM/Inline/Timing.h"
+#include "wavm-test.h"
+
+using namespace WAVM;
+
+// The key used by the test vectors in RFC 7539: the bytes 00 01 02 ... 1f.
+static void getTestKey(U32 outKey[8])
+{
+	U8 keyBytes[32];
+	for(Uptr byteIndex = 0; byteIndex < sizeof(keyBytes); ++byteIndex)
+	{ keyBytes[byteIndex] = U8(byteIndex); }
+	memcpy(outKey, keyBytes, sizeof(keyBytes));
+}
+
+// RFC 7539 section 2.3.2: the block function with block counter 1 and nonce
+// 00:00:00:09:00:00:00:4a:00:00:00:00.
+static const U8 expectedBlock[ChaCha20::numBlockBytes] = {
+	0x10, 0xf1, 0xe7, 0xe4, 0xd1, 0x3b, 0x59, 0x15, 0x50, 0x0f, 0xdd, 0x1f, 0xa3, 0x20, 0x71, 0xc4,
+	0xc7, 0xd1, 0xf4, 0xc7, 0x33, 0xc0, 0x68, 0x03, 0x04, 0x22, 0xaa, 0x9a, 0xc3, 0xd4, 0x6c, 0x4e,
+	0xd2, 0x82, 0x64, 0x46, 0x07, 0x9f, 0xaa, 0x09, 0x14, 0xc2, 0xd7, 0x05, 0xd9, 0x8b, 0x02, 0xa2,
+	0xb5, 0x12, 0x9c, 0xd1, 0xde, 0x16, 0x4e, 0xb9, 0xcb, 0xd0, 0x83, 0xe8, 0xa2, 0x50, 0x3c, 0x4e,
+};
+
+static void testBlockFunction()
+{
+	U32 key[8];
+	getTestKey(key);
+	const U32 counterAndNonce[4] = {1, 0x09000000, 0x4a000000, 0};
+
+	U8 block[ChaCha20::numBlockBytes];
+	ChaCha20::generateBlock(key, counterAndNonce, block);
+	WAVM_ERROR_UNLESS(!memcmp(block, expectedBlock, sizeof(block)));
+}
+
+// RFC 7539 section 2.4.2: encrypting the plaintext with the keystream that starts at block
+// counter 1 with nonce 00:00:00:00:00:00:00:4a:00:00:00:00.
+static const char plaintext[]
+	= "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, "
+	  "sunscreen would be it.";
+static const U8 expectedCiphertext[sizeof(plaintext) - 1] = {
+	0x6e, 0x2e, 0x35, 0x9a, 0x25, 0x68, 0xf9, 0x80, 0x41, 0xba, 0x07, 0x28, 0xdd, 0x0d, 0x69, 0x81,
+	0xe9, 0x7e, 0x7a, 0xec, 0x1d, 0x43, 0x60, 0xc2, 0x0a, 0x27, 0xaf, 0xcc, 0xfd, 0x9f, 0xae, 0x0b,
+	0xf9, 0x1b, 0x65, 0xc5, 0x52, 0x47, 0x33, 0xab, 0x8f, 0x59, 0x3d, 0xab, 0xcd, 0x62, 0xb3, 0x57,
+	0x16, 0x39, 0xd6, 0x24, 0xe6, 0x51, 0x52, 0xab, 0x8f, 0x53, 0x0c, 0x35, 0x9f, 0x08, 0x61, 0xd8,
+	0x07, 0xca, 0x0d, 0xbf, 0x50, 0x0d, 0x6a, 0x61, 0x56, 0xa3, 0x8e, 0x08, 0x8a, 0x22, 0xb6, 0x5e,
+	0x52, 0xbc, 0x51, 0x4d, 0x16, 0xcc, 0xf8, 0x06, 0x81, 0x8c, 0xe9, 0x1a, 0xb7, 0x79, 0x37, 0x36,
+	0x5a, 0xf9, 0x0b, 0xbf, 0x74, 0xa3, 0x5b, 0xe6, 0xb4, 0x0b, 0x8e, 0xed, 0xf2, 0x78, 0x5e, 0x42,
+	0x87, 0x4d,
+};
+
+static void testEncryption()
+{
+	U32 key[8];
+	getTestKey(key);
+
+	U8 keystream[ChaCha20::numBlockBytes * 2];
+	for(U32 blockIndex = 0; blockIndex < 2; ++blockIndex)
+	{
+		const U32 counterAndNonce[4] = {1 + blockIndex, 0, 0x4a000000, 0};
+		ChaCha20::generateBlock(
+			key, counterAndNonce, keystream + blockIndex * ChaCha20::numBlockBytes);
+	}
+
+	for(Uptr byteIndex = 0; byteIndex < sizeof(expectedCiphertext); ++byteIndex)
+	{
+		WAVM_ERROR_UNLESS(U8(plaintext[byteIndex] ^ keystream[byteIndex])
+						  == expectedCiphertext[byteIndex]);
+	}
+}
+
+I32 execChaCha20Test(int argc, char** argv)
+{
+	Timing::Timer timer;
+	testBlockFunction();
+	testEncryption();
+	Timing::logTimer("ChaCha20Test", timer);
+	return 0;
+}
@@ -1,5 +1,6 @@
 #include <stdlib.h>
 #include <initializer_list>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -8,6 +9,7 @@
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/Inline/Hash.h"
 #include "WAVM/Inline/HashMap.h"
+#include "WAVM/Inline/HashTable.h"
 #include "WAVM/Inline/Timing.h"
 #include "wavm-test.h"
 
@@ -327,6 +329,133 @@ static void testMapBracketOperator()
 	WAVM_ERROR_UNLESS(map[17] == 7);
 }
 
+static void testMapStringViewLookup()
+{
+	HashMap<std::string, U32> map{{"a", 1}, {"bc", 2}, {"def", 3}, {"", 4}};
+
+	// Look up std::string keys without constructing a std::string.
+	const char* text = "xdefx";
+	WAVM_ERROR_UNLESS(map.contains("a"));
+	WAVM_ERROR_UNLESS(!map.contains("ab"));
+	WAVM_ERROR_UNLESS(map.contains(StringView(text + 1, 3)));
+	WAVM_ERROR_UNLESS(!map.contains(StringView(text, 3)));
+	WAVM_ERROR_UNLESS(map.contains(StringView(text, 0)));
+
+	const U32* valuePtr = map.get(StringView(text + 1, 3));
+	WAVM_ERROR_UNLESS(valuePtr && *valuePtr == 3);
+	const HashMapPair<std::string, U32>* pair = map.getPair("bc");
+	WAVM_ERROR_UNLESS(pair && pair->key == "bc" && pair->value == 2);
+
+	U32* mutableValuePtr = map.get("a");
+	WAVM_ERROR_UNLESS(mutableValuePtr);
+	*mutableValuePtr = 5;
+	WAVM_ERROR_UNLESS(map[std::string("a")] == 5);
+
+	WAVM_ERROR_UNLESS(map.remove(StringView(text + 1, 3)));
+	WAVM_ERROR_UNLESS(!map.remove("def"));
+	WAVM_ERROR_UNLESS(map.size() == 3);
+}
+
+// A hash policy that hashes every key to the same value, so every key is in one probe sequence.
+struct CollidingHashPolicy
+{
+	static bool areKeysEqual(Uptr left, Uptr right) { return left == right; }
+	static Uptr getKeyHash(Uptr) { return 0x1234; }
+};
+
+template<typename Map> static void testMapCollisions()
+{
+	static constexpr Uptr numKeys = 200;
+
+	Map map;
+	for(Uptr i = 0; i < numKeys; ++i) { WAVM_ERROR_UNLESS(map.add(i, i * 3)); }
+	WAVM_ERROR_UNLESS(map.size() == numKeys);
+
+	// Remove every other key, and check that the keys after them in the probe sequence are still
+	// found.
+	for(Uptr i = 0; i < numKeys; i += 2) { WAVM_ERROR_UNLESS(map.remove(i)); }
+	for(Uptr i = 0; i < numKeys; ++i)
+	{
+		const Uptr* valuePtr = map.get(i);
+		if(i & 1) { WAVM_ERROR_UNLESS(valuePtr && *valuePtr == i * 3); }
+		else
+		{
+			WAVM_ERROR_UNLESS(!valuePtr);
+		}
+	}
+
+	// Add the removed keys back, and check that the keys that weren't removed aren't duplicated.
+	for(Uptr i = 0; i < numKeys; ++i) { WAVM_ERROR_UNLESS(map.add(i, i * 3) == !(i & 1)); }
+	WAVM_ERROR_UNLESS(map.size() == numKeys);
+	for(Uptr i = 0; i < numKeys; ++i) { WAVM_ERROR_UNLESS(map[i] == i * 3); }
+}
+
+template<typename Map> static void testMapRandomOperations()
+{
+	// Compare the map against std::map while randomly adding and removing keys from a small range,
+	// so the map has many buckets that held removed elements.
+	static constexpr Uptr numOperations = 200000;
+	static constexpr Uptr numPossibleKeys = 1000;
+
+	Map map;
+	std::map<U32, U32> expectedMap;
+
+	srand(0);
+	for(Uptr operationIndex = 0; operationIndex < numOperations; ++operationIndex)
+	{
+		const U32 key = U32(rand() % numPossibleKeys);
+		switch(rand() % 4)
+		{
+		case 0:
+		case 1: {
+			const U32 value = U32(rand());
+			map.set(key, value);
+			expectedMap[key] = value;
+			break;
+		}
+		case 2: WAVM_ERROR_UNLESS(map.remove(key) == (expectedMap.erase(key) != 0)); break;
+		case 3: {
+			const U32* valuePtr = map.get(key);
+			auto it = expectedMap.find(key);
+			if(it == expectedMap.end()) { WAVM_ERROR_UNLESS(!valuePtr); }
+			else
+			{
+				WAVM_ERROR_UNLESS(valuePtr && *valuePtr == it->second);
+			}
+			break;
+		}
+		default: WAVM_UNREACHABLE();
+		};
+		WAVM_ERROR_UNLESS(map.size() == expectedMap.size());
+	}
+
+	Uptr numIteratedPairs = 0;
+	for(const auto& pair : map)
+	{
+		WAVM_ERROR_UNLESS(expectedMap.at(pair.key) == pair.value);
+		++numIteratedPairs;
+	}
+	WAVM_ERROR_UNLESS(numIteratedPairs == expectedMap.size());
+}
+
+static void testRobinHoodMap()
+{
+	// HashMap can also use the Robin Hood HashTable, including for heterogeneous lookups.
+	HashMap<std::string, U32, DefaultHashPolicy<std::string>, HashTable> map{{"a", 1}, {"bc", 2}};
+	WAVM_ERROR_UNLESS(map.contains("a"));
+	WAVM_ERROR_UNLESS(!map.contains("b"));
+	const char* text = "xbc";
+	const U32* valuePtr = map.get(StringView(text + 1, 2));
+	WAVM_ERROR_UNLESS(valuePtr && *valuePtr == 2);
+	WAVM_ERROR_UNLESS(map.remove("a"));
+	WAVM_ERROR_UNLESS(map.size() == 1);
+
+	HashMap<Uptr, Uptr, DefaultHashPolicy<Uptr>, HashTable> copy;
+	for(Uptr i = 0; i < 1000; ++i) { copy.add(i, i); }
+	HashMap<Uptr, Uptr, DefaultHashPolicy<Uptr>, HashTable> b{copy};
+	for(Uptr i = 0; i < 1000; ++i) { WAVM_ERROR_UNLESS(b[i] == i); }
+}
+
 I32 execHashMapTest(int argc, char** argv)
 {
 	Timing::Timer timer;
@@ -340,6 +469,12 @@ I32 execHashMapTest(int argc, char** argv)
 	testMapSet();
 	testMapEmplace();
 	testMapBracketOperator();
+	testMapStringViewLookup();
+	testMapCollisions<HashMap<Uptr, Uptr, CollidingHashPolicy>>();
+	testMapCollisions<HashMap<Uptr, Uptr, CollidingHashPolicy, HashTable>>();
+	testMapRandomOperations<HashMap<U32, U32>>();
+	testMapRandomOperations<HashMap<U32, U32, DefaultHashPolicy<U32>, HashTable>>();
+	testRobinHoodMap();
 	Timing::logTimer("HashMapTest", timer);
 	return 0;
 }
@@ -1,5 +1,6 @@
 #include <stdlib.h>
 #include <initializer_list>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -7,6 +8,7 @@
 #include "WAVM/Inline/BasicTypes.h"
 #include "WAVM/Inline/Hash.h"
 #include "WAVM/Inline/HashSet.h"
+#include "WAVM/Inline/HashTable.h"
 #include "WAVM/Inline/Timing.h"
 #include "wavm-test.h"
 
@@ -252,6 +254,60 @@ static void testSetBracketOperator()
 	WAVM_ERROR_UNLESS(set[17] == 17);
 }
 
+template<typename Set> static void testSetStringViewLookup()
+{
+	Set set{"a", "bc", "def"};
+
+	// Look up std::string elements without constructing a std::string.
+	const char* text = "xdefx";
+	WAVM_ERROR_UNLESS(set.contains("bc"));
+	WAVM_ERROR_UNLESS(!set.contains("b"));
+	WAVM_ERROR_UNLESS(set.contains(StringView(text + 1, 3)));
+	WAVM_ERROR_UNLESS(!set.contains(StringView(text, 3)));
+
+	const std::string* elementPtr = set.get(StringView(text + 1, 3));
+	WAVM_ERROR_UNLESS(elementPtr && *elementPtr == "def");
+
+	WAVM_ERROR_UNLESS(set.remove(StringView(text + 1, 3)));
+	WAVM_ERROR_UNLESS(!set.remove("def"));
+	WAVM_ERROR_UNLESS(set.size() == 2);
+}
+
+template<typename Set> static void testSetRandomOperations()
+{
+	// Compare the set against std::set while randomly adding and removing elements from a small
+	// range, so the set has many buckets that held removed elements.
+	static constexpr Uptr numOperations = 200000;
+	static constexpr Uptr numPossibleElements = 1000;
+
+	Set set;
+	std::set<U32> expectedSet;
+
+	srand(0);
+	for(Uptr operationIndex = 0; operationIndex < numOperations; ++operationIndex)
+	{
+		const U32 element = U32(rand() % numPossibleElements);
+		switch(rand() % 3)
+		{
+		case 0: WAVM_ERROR_UNLESS(set.add(element) == expectedSet.insert(element).second); break;
+		case 1: WAVM_ERROR_UNLESS(set.remove(element) == (expectedSet.erase(element) != 0)); break;
+		case 2:
+			WAVM_ERROR_UNLESS(set.contains(element) == (expectedSet.count(element) != 0));
+			break;
+		default: WAVM_UNREACHABLE();
+		};
+		WAVM_ERROR_UNLESS(set.size() == expectedSet.size());
+	}
+
+	Uptr numIteratedElements = 0;
+	for(U32 element : set)
+	{
+		WAVM_ERROR_UNLESS(expectedSet.count(element));
+		++numIteratedElements;
+	}
+	WAVM_ERROR_UNLESS(numIteratedElements == expectedSet.size());
+}
+
 I32 execHashSetTest(int argc, char** argv)
 {
 	Timing::Timer timer;
@@ -262,6 +318,10 @@ I32 execHashSetTest(int argc, char** argv)
 	testSetInitializerList();
 	testSetIterator();
 	testSetBracketOperator();
+	testSetStringViewLookup<HashSet<std::string>>();
+	testSetStringViewLookup<HashSet<std::string, DefaultHashPolicy<std::string>, HashTable>>();
+	testSetRandomOperations<HashSet<U32>>();
+	testSetRandomOperations<HashSet<U32, DefaultHashPolicy<U32>, HashTable>>();
 	Timing::logTimer("HashSetTest", timer);
 	return 0;
 }
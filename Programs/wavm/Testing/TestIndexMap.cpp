@@ -0,0 +1,177 @@
+#include <stdlib.h>
+#include <algorithm>
+#include <set>
+#include <vector>
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/IndexMap.h"
+#include "WAVM/Inline/Timing.h"
+#include "WAVM/Logging/Logging.h"
+#include "wavm-test.h"
+
+using namespace WAVM;
+
+static void testLowestFreeIndexReuse()
+{
+	IndexMap<Uptr, Uptr> map(0, 99);
+	for(Uptr i = 0; i < 10; ++i) { WAVM_ERROR_UNLESS(map.add(UINTPTR_MAX, i * 2) == i); }
+
+	map.removeOrFail(7);
+	map.removeOrFail(3);
+	map.removeOrFail(5);
+	WAVM_ERROR_UNLESS(map.size() == 7);
+	WAVM_ERROR_UNLESS(!map.contains(3));
+
+	// The removed indices are reused in ascending order before any new indices are allocated.
+	WAVM_ERROR_UNLESS(map.add(UINTPTR_MAX, 100) == 3);
+	WAVM_ERROR_UNLESS(map.add(UINTPTR_MAX, 101) == 5);
+	WAVM_ERROR_UNLESS(map.add(UINTPTR_MAX, 102) == 7);
+	WAVM_ERROR_UNLESS(map.add(UINTPTR_MAX, 103) == 10);
+	WAVM_ERROR_UNLESS(map[3] == 100);
+	WAVM_ERROR_UNLESS(map[4] == 8);
+	const Uptr* valuePtr = map.get(10);
+	WAVM_ERROR_UNLESS(valuePtr && *valuePtr == 103);
+	WAVM_ERROR_UNLESS(!map.get(11));
+}
+
+static void testFullMap()
+{
+	IndexMap<U32, U32> map(1, 4);
+	for(U32 i = 1; i <= 4; ++i) { WAVM_ERROR_UNLESS(map.add(0, i) == i); }
+	WAVM_ERROR_UNLESS(map.add(0, 5) == 0);
+
+	map.removeOrFail(2);
+	WAVM_ERROR_UNLESS(map.add(0, 6) == 2);
+	WAVM_ERROR_UNLESS(map.add(0, 7) == 0);
+	WAVM_ERROR_UNLESS(map.size() == 4);
+
+	// A map that covers the whole range of the index type.
+	IndexMap<U8, U8> fullRangeMap(0, 255);
+	for(Uptr i = 0; i < 256; ++i) { WAVM_ERROR_UNLESS(fullRangeMap.add(0, U8(i)) == i); }
+	WAVM_ERROR_UNLESS(fullRangeMap.size() == 256);
+	fullRangeMap.removeOrFail(255);
+	WAVM_ERROR_UNLESS(fullRangeMap.add(0, 0) == 255);
+}
+
+static void testInsert()
+{
+	IndexMap<Uptr, Uptr> map(0, UINTPTR_MAX);
+	map.insertOrFail(5, 5);
+
+	// The indices skipped over by insertOrFail are allocated by add.
+	for(Uptr i = 0; i < 5; ++i) { WAVM_ERROR_UNLESS(map.add(UINTPTR_MAX, i) == i); }
+	WAVM_ERROR_UNLESS(map.add(UINTPTR_MAX, 6) == 6);
+
+	// Inserting at a removed index means it isn't reused by add.
+	map.removeOrFail(1);
+	map.removeOrFail(2);
+	map.insertOrFail(1, 1);
+	WAVM_ERROR_UNLESS(map.add(UINTPTR_MAX, 2) == 2);
+	WAVM_ERROR_UNLESS(map.add(UINTPTR_MAX, 7) == 7);
+
+	// Inserting far above the allocated indices.
+	map.insertOrFail(1000, 1000);
+	WAVM_ERROR_UNLESS(map.add(UINTPTR_MAX, 8) == 8);
+	WAVM_ERROR_UNLESS(map.size() == 10);
+
+	Uptr numIterated = 0;
+	for(auto it = map.begin(); it != map.end(); ++it)
+	{
+		WAVM_ERROR_UNLESS(*it == it.getIndex());
+		++numIterated;
+	}
+	WAVM_ERROR_UNLESS(numIterated == 10);
+}
+
+static void testRandomOperations()
+{
+	// Compare the map against a simple model of the allocated indices.
+	static constexpr Uptr numOperations = 100000;
+	IndexMap<Uptr, Uptr> map(100, UINTPTR_MAX);
+	std::set<Uptr> allocatedIndices;
+	std::set<Uptr> freeIndices;
+	Uptr numUsedIndices = 0;
+
+	srand(0);
+	for(Uptr operationIndex = 0; operationIndex < numOperations; ++operationIndex)
+	{
+		if(allocatedIndices.size() && rand() % 5 < 2)
+		{
+			// Remove a random index.
+			auto it = allocatedIndices.lower_bound(100 + Uptr(rand()) % (numUsedIndices + 1));
+			if(it == allocatedIndices.end()) { it = allocatedIndices.begin(); }
+			map.removeOrFail(*it);
+			freeIndices.insert(*it);
+			allocatedIndices.erase(it);
+		}
+		else
+		{
+			const Uptr expectedIndex
+				= freeIndices.size() ? *freeIndices.begin() : 100 + numUsedIndices++;
+			freeIndices.erase(expectedIndex);
+			WAVM_ERROR_UNLESS(map.add(UINTPTR_MAX, expectedIndex) == expectedIndex);
+			allocatedIndices.insert(expectedIndex);
+		}
+	}
+
+	WAVM_ERROR_UNLESS(map.size() == allocatedIndices.size());
+	for(Uptr index : allocatedIndices) { WAVM_ERROR_UNLESS(map[index] == index); }
+	for(Uptr index : freeIndices) { WAVM_ERROR_UNLESS(!map.contains(index)); }
+}
+
+static void benchmarkChurn(Uptr numLiveElements)
+{
+	// Simulate a long-lived compartment that creates and destroys objects while many others are
+	// live: remove a batch of random indices, then allocate the same number of indices.
+	static constexpr Uptr numBatches = 1000;
+	static constexpr Uptr numElementsPerBatch = 100;
+
+	IndexMap<Uptr, Uptr> map(0, UINTPTR_MAX);
+	for(Uptr i = 0; i < numLiveElements; ++i) { map.add(UINTPTR_MAX, i); }
+
+	srand(0);
+	std::vector<Uptr> removedIndices;
+	Timing::Timer timer;
+	for(Uptr batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+	{
+		removedIndices.clear();
+		while(removedIndices.size() < numElementsPerBatch)
+		{
+			const Uptr randomNumber = Uptr(rand()) * (RAND_MAX + Uptr(1)) + Uptr(rand());
+			const Uptr index = randomNumber % numLiveElements;
+			if(map.contains(index))
+			{
+				map.removeOrFail(index);
+				removedIndices.push_back(index);
+			}
+		}
+
+		// The removed indices are reallocated in ascending order.
+		std::sort(removedIndices.begin(), removedIndices.end());
+		for(Uptr index : removedIndices)
+		{ WAVM_ERROR_UNLESS(map.add(UINTPTR_MAX, index) == index); }
+	}
+	timer.stop();
+
+	WAVM_ERROR_UNLESS(map.size() == numLiveElements);
+	Log::printf(Log::output,
+				"ns/remove+add with %" WAVM_PRIuPTR " live elements: %.2f\n",
+				numLiveElements,
+				timer.getNanoseconds() / F64(numBatches * numElementsPerBatch));
+}
+
+I32 execIndexMapTest(int argc, char** argv)
+{
+	Timing::Timer timer;
+	testLowestFreeIndexReuse();
+	testFullMap();
+	testInsert();
+	testRandomOperations();
+
+	// The time per remove+add shouldn't depend on the number of live elements.
+	benchmarkChurn(1000);
+	benchmarkChurn(100000);
+
+	Timing::logTimer("IndexMapTest", timer);
+	return 0;
+}
@@ -0,0 +1,219 @@
+#include <string.h>
+#include <string>
+#include <vector>
+#include "WAVM/IR/Module.h"
+#include "WAVM/IR/Types.h"
+#include "WAVM/IR/Value.h"
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Errors.h"
+#include "WAVM/Inline/Timing.h"
+#include "WAVM/Runtime/Runtime.h"
+#include "WAVM/WASTParse/WASTParse.h"
+#include "wavm-test.h"
+
+using namespace WAVM;
+using namespace WAVM::IR;
+using namespace WAVM::Runtime;
+
+// A module with a memory, table, and mutable global, and active data and elem segments. One of
+// each segment's offsets comes from an imported global.
+static constexpr const char* templateTestModuleWAST
+	= "(module\n"
+	  "  (import \"test\" \"base\" (global $base i32))\n"
+	  "  (memory (export \"memory\") 1)\n"
+	  "  (table (export \"table\") 8 funcref)\n"
+	  "  (global $counter (export \"counter\") (mut i32) (i32.const 100))\n"
+	  "  (data (i32.const 0) \"fixed data segment\")\n"
+	  "  (data (global.get $base) \"imported offset data segment\")\n"
+	  "  (elem (i32.const 0) $a)\n"
+	  "  (elem (global.get $base) $b $c)\n"
+	  "  (func $a (result i32) (i32.const 1))\n"
+	  "  (func $b (result i32) (i32.const 2))\n"
+	  "  (func $c (result i32) (i32.const 3))\n"
+	  "  (func (export \"increment\") (result i32)\n"
+	  "    (global.set $counter (i32.add (global.get $counter) (i32.const 1)))\n"
+	  "    (global.get $counter)\n"
+	  "  )\n"
+	  "  (func (export \"callIndirect\") (param $index i32) (result i32)\n"
+	  "    (call_indirect (result i32) (local.get $index))\n"
+	  "  )\n"
+	  ")";
+
+static constexpr Uptr numTableElements = 8;
+
+static I32 invokeI32(Context* context,
+					 Instance* instance,
+					 const char* exportName,
+					 std::vector<UntaggedValue>&& args = {})
+{
+	Function* function = asFunction(getInstanceExport(instance, exportName));
+	UntaggedValue result;
+	invokeFunction(context, function, getFunctionType(function), args.data(), &result);
+	return result.i32;
+}
+
+// Returns the value of each table element's function when called with call_indirect, or 0 for
+// null elements.
+static std::vector<I32> getTableElementValues(Context* context, Instance* instance)
+{
+	Table* table = asTable(getInstanceExport(instance, "table"));
+	WAVM_ERROR_UNLESS(getTableNumElements(table) == numTableElements);
+
+	std::vector<I32> values;
+	for(Uptr elementIndex = 0; elementIndex < numTableElements; ++elementIndex)
+	{
+		values.push_back(getTableElement(table, elementIndex)
+							 ? invokeI32(context, instance, "callIndirect", {I32(elementIndex)})
+							 : 0);
+	}
+	return values;
+}
+
+static std::vector<U8> getMemoryBytes(Instance* instance)
+{
+	Memory* memory = asMemory(getInstanceExport(instance, "memory"));
+	const U8* baseAddress = getMemoryBaseAddress(memory);
+	const Uptr numBytes = getMemoryNumPages(memory) * IR::numBytesPerPage;
+	return std::vector<U8>(baseAddress, baseAddress + numBytes);
+}
+
+static I32 getCounter(Context* context, Instance* instance)
+{
+	return getGlobalValue(context, asGlobal(getInstanceExport(instance, "counter"))).i32;
+}
+
+static Global* createBaseGlobal(Compartment* compartment, I32 base)
+{
+	Global* global = createGlobal(compartment, GlobalType(ValueType::i32, false), "base");
+	initializeGlobal(global, Value(base));
+	return global;
+}
+
+// Instantiates the module with instantiateModule, and from a template, and returns the types of
+// the exceptions thrown by each, or null if one didn't throw an exception.
+static void instantiateWithBadOffset(Compartment* compartment,
+									 ModuleConstRefParam module,
+									 Global* baseGlobal,
+									 Runtime::ExceptionType*& outExceptionType,
+									 Runtime::ExceptionType*& outTemplateExceptionType)
+{
+	outExceptionType = nullptr;
+	outTemplateExceptionType = nullptr;
+
+	catchRuntimeExceptions(
+		[&] {
+			instantiateModule(
+				compartment, module, ImportBindings{asObject(baseGlobal)}, "templateTestModule");
+		},
+		[&](Exception* exception) {
+			outExceptionType = getExceptionType(exception);
+			destroyException(exception);
+		});
+
+	InstantiationTemplateRef instantiationTemplate = createInstantiationTemplate(
+		compartment, module, ImportBindings{asObject(baseGlobal)}, "templateTestModule");
+	catchRuntimeExceptions([&] { instantiateModule(instantiationTemplate); },
+						   [&](Exception* exception) {
+							   outTemplateExceptionType = getExceptionType(exception);
+							   destroyException(exception);
+						   });
+}
+
+static void testInstantiationTemplate()
+{
+	std::vector<WAST::Error> parseErrors;
+	IR::Module irModule;
+	if(!WAST::parseModule(
+		   templateTestModuleWAST, strlen(templateTestModuleWAST) + 1, irModule, parseErrors))
+	{
+		WAST::reportParseErrors("template test module", templateTestModuleWAST, parseErrors);
+		Errors::fatal("Failed to parse template test module WAST");
+	}
+	ModuleRef module = compileModule(irModule);
+
+	GCPointer<Compartment> compartment = Runtime::createCompartment();
+	Context* context = createContext(compartment);
+	Global* baseGlobal = createBaseGlobal(compartment, 4);
+
+	{
+		// Instantiate the module twice from one template, and once with instantiateModule.
+		InstantiationTemplateRef instantiationTemplate = createInstantiationTemplate(
+			compartment, module, ImportBindings{asObject(baseGlobal)}, "templateTestModule");
+		Instance* instanceA = instantiateModule(instantiationTemplate);
+		Instance* instanceB = instantiateModule(instantiationTemplate);
+		Instance* expectedInstance = instantiateModule(
+			compartment, module, ImportBindings{asObject(baseGlobal)}, "templateTestModule");
+		WAVM_ERROR_UNLESS(instanceA && instanceB && expectedInstance);
+
+		// The segments are applied to each instance the same way as by instantiateModule.
+		const std::vector<U8> expectedMemoryBytes = getMemoryBytes(expectedInstance);
+		const std::vector<I32> expectedTableElementValues
+			= getTableElementValues(context, expectedInstance);
+		WAVM_ERROR_UNLESS(!memcmp(expectedMemoryBytes.data() + 4, "imported offset", 15));
+		WAVM_ERROR_UNLESS(expectedTableElementValues == std::vector<I32>({1, 0, 0, 0, 2, 3, 0, 0}));
+		for(Instance* instance : {instanceA, instanceB})
+		{
+			WAVM_ERROR_UNLESS(getMemoryBytes(instance) == expectedMemoryBytes);
+			WAVM_ERROR_UNLESS(getTableElementValues(context, instance)
+							  == expectedTableElementValues);
+			WAVM_ERROR_UNLESS(getCounter(context, instance) == 100);
+		}
+
+		// Each instance has its own memory, table, and global.
+		WAVM_ERROR_UNLESS(getInstanceExport(instanceA, "memory")
+						  != getInstanceExport(instanceB, "memory"));
+		WAVM_ERROR_UNLESS(getInstanceExport(instanceA, "table")
+						  != getInstanceExport(instanceB, "table"));
+		WAVM_ERROR_UNLESS(getInstanceExport(instanceA, "counter")
+						  != getInstanceExport(instanceB, "counter"));
+
+		getMemoryBaseAddress(asMemory(getInstanceExport(instanceA, "memory")))[0] = 'F';
+		WAVM_ERROR_UNLESS(getMemoryBytes(instanceB) == expectedMemoryBytes);
+
+		setTableElement(asTable(getInstanceExport(instanceA, "table")), 0, nullptr);
+		WAVM_ERROR_UNLESS(getTableElementValues(context, instanceA)[0] == 0);
+		WAVM_ERROR_UNLESS(getTableElementValues(context, instanceB)
+						  == expectedTableElementValues);
+
+		WAVM_ERROR_UNLESS(invokeI32(context, instanceA, "increment") == 101);
+		WAVM_ERROR_UNLESS(invokeI32(context, instanceA, "increment") == 102);
+		WAVM_ERROR_UNLESS(invokeI32(context, instanceB, "increment") == 101);
+		WAVM_ERROR_UNLESS(getCounter(context, expectedInstance) == 100);
+
+		// A new instance from the template doesn't see the changes to the earlier instances.
+		Instance* instanceC = instantiateModule(instantiationTemplate);
+		WAVM_ERROR_UNLESS(getMemoryBytes(instanceC) == expectedMemoryBytes);
+		WAVM_ERROR_UNLESS(getTableElementValues(context, instanceC)
+						  == expectedTableElementValues);
+		WAVM_ERROR_UNLESS(getCounter(context, instanceC) == 100);
+	}
+
+	// A template instantiation throws the same exceptions as instantiateModule when the imported
+	// offset puts a segment out of bounds.
+	Runtime::ExceptionType* exceptionType;
+	Runtime::ExceptionType* templateExceptionType;
+	instantiateWithBadOffset(compartment,
+							 module,
+							 createBaseGlobal(compartment, I32(IR::numBytesPerPage - 4)),
+							 exceptionType,
+							 templateExceptionType);
+	WAVM_ERROR_UNLESS(exceptionType && exceptionType == templateExceptionType);
+	instantiateWithBadOffset(compartment,
+							 module,
+							 createBaseGlobal(compartment, I32(numTableElements - 1)),
+							 exceptionType,
+							 templateExceptionType);
+	WAVM_ERROR_UNLESS(exceptionType && exceptionType == templateExceptionType);
+
+	// The templates have been destroyed, so the compartment can be freed.
+	WAVM_ERROR_UNLESS(tryCollectCompartment(std::move(compartment)));
+}
+
+I32 execInstantiationTemplateTest(int argc, char** argv)
+{
+	Timing::Timer timer;
+	testInstantiationTemplate();
+	Timing::logTimer("InstantiationTemplateTest", timer);
+	return 0;
+}
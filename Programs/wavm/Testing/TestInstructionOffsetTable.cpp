@@ -0,0 +1,145 @@
+#include <stdlib.h>
+#include <map>
+#include <vector>
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/InstructionOffsetTable.h"
+#include "WAVM/Inline/Timing.h"
+#include "wavm-test.h"
+
+using namespace WAVM;
+
+typedef InstructionOffsetTable::Entry Entry;
+
+static U32 randomU32() { return (U32(rand()) << 16) ^ U32(rand()); }
+
+// Generates a random offset delta, favoring small deltas, but covering deltas that are encoded as
+// any number of LEB128 bytes.
+static U32 randomDelta()
+{
+	switch(rand() % 8)
+	{
+	case 0: return 0;
+	case 1: return randomU32() % (1 << 14);
+	case 2: return randomU32() % (1 << 21);
+	case 3: return randomU32() >> (rand() % 32);
+	default: return randomU32() % 128;
+	};
+}
+
+// Looks up an offset in the reference map the same way InstructionOffsetTable::lookup does.
+static bool lookupReference(const std::map<U32, U32>& map, U32 offset, Entry& outEntry)
+{
+	auto it = map.upper_bound(offset);
+	if(it == map.begin()) { return false; }
+	--it;
+	outEntry = Entry(it->first, it->second);
+	return true;
+}
+
+static void checkLookup(const InstructionOffsetTable& table,
+						const std::map<U32, U32>& map,
+						U32 offset)
+{
+	Entry expectedEntry;
+	Entry entry;
+	const bool expectedFound = lookupReference(map, offset, expectedEntry);
+	WAVM_ERROR_UNLESS(table.lookup(offset, entry) == expectedFound);
+	if(expectedFound) { WAVM_ERROR_UNLESS(entry == expectedEntry); }
+}
+
+// Builds a table from the entries, and checks that it matches a std::map that keeps the first
+// entry for each offset.
+static void testEntries(const std::vector<Entry>& entries)
+{
+	std::map<U32, U32> map;
+	for(const Entry& entry : entries) { map.emplace(entry.first, entry.second); }
+
+	std::vector<Entry> tableEntries = entries;
+	const InstructionOffsetTable table(std::move(tableEntries));
+	WAVM_ERROR_UNLESS(table.getNumEntries() == map.size());
+
+	// Look up every offset in the map, and the offsets on either side of it.
+	for(const auto& pair : map)
+	{
+		checkLookup(table, map, pair.first);
+		checkLookup(table, map, pair.first - 1);
+		checkLookup(table, map, pair.first + 1);
+	}
+
+	// Look up the extremes, and some random offsets.
+	checkLookup(table, map, 0);
+	checkLookup(table, map, UINT32_MAX);
+	for(Uptr lookupIndex = 0; lookupIndex < 256; ++lookupIndex)
+	{ checkLookup(table, map, randomU32()); }
+}
+
+static void testEmptyTable()
+{
+	Entry entry;
+	WAVM_ERROR_UNLESS(!InstructionOffsetTable().lookup(0, entry));
+	testEntries({});
+}
+
+static void testBlockBoundaries()
+{
+	// Tables with a number of entries on either side of a multiple of the block size.
+	const Uptr numEntriesPerBlock = InstructionOffsetTable::numEntriesPerBlock;
+	for(Uptr numEntries : {Uptr(1),
+						   numEntriesPerBlock - 1,
+						   numEntriesPerBlock,
+						   numEntriesPerBlock + 1,
+						   numEntriesPerBlock * 2,
+						   numEntriesPerBlock * 2 + 1})
+	{
+		std::vector<Entry> entries;
+		for(Uptr entryIndex = 0; entryIndex < numEntries; ++entryIndex)
+		{ entries.push_back(Entry(U32(100 + entryIndex * 3), U32(numEntries - entryIndex))); }
+		testEntries(entries);
+	}
+}
+
+static void testExtremeDeltas()
+{
+	// Deltas that need the maximum number of LEB128 bytes, and operator index deltas that span
+	// the whole range of I32.
+	testEntries({{0, 0}, {UINT32_MAX, UINT32_MAX}});
+	testEntries({{1, UINT32_MAX}, {2, 0}, {UINT32_MAX - 1, 0x80000000}, {UINT32_MAX, 0x7fffffff}});
+}
+
+static void testRandomEntries()
+{
+	srand(0);
+	for(Uptr tableIndex = 0; tableIndex < 200; ++tableIndex)
+	{
+		// Generate entries in random order, with some duplicate offsets.
+		const Uptr numEntries = Uptr(rand()) % 2000;
+		std::vector<Entry> entries;
+		U32 offset = randomU32() % 1024;
+		U32 opIndex = randomU32() % 1024;
+		for(Uptr entryIndex = 0; entryIndex < numEntries; ++entryIndex)
+		{
+			offset += randomDelta();
+			opIndex += rand() % 4 ? U32(rand() % 64) - 16 : randomU32();
+			entries.push_back(Entry(offset, opIndex));
+		}
+		for(Uptr entryIndex = 1; entryIndex < entries.size(); ++entryIndex)
+		{
+			const Uptr swapIndex = Uptr(rand()) % (entryIndex + 1);
+			std::swap(entries[entryIndex], entries[swapIndex]);
+		}
+
+		testEntries(entries);
+	}
+}
+
+I32 execInstructionOffsetTableTest(int argc, char** argv)
+{
+	Timing::Timer timer;
+	testEmptyTable();
+	testBlockBoundaries();
+	testExtremeDeltas();
+	testRandomEntries();
+	Timing::logTimer("InstructionOffsetTableTest", timer);
+	return 0;
+}
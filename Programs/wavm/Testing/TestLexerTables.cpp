@@ -0,0 +1,63 @@
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/CLI.h"
+#include "WAVM/Inline/Timing.h"
+#include "WAVM/Logging/Logging.h"
+#include "WAVM/WASTParse/WASTParse.h"
+#include "wavm-test.h"
+
+using namespace WAVM;
+
+int execLexerTablesTest(int argc, char** argv)
+{
+	const char* outputPath = nullptr;
+	bool showHelpAndExit = false;
+
+	for(Iptr argumentIndex = 0; argumentIndex < argc; ++argumentIndex)
+	{
+		if(!strcmp(argv[argumentIndex], "--output"))
+		{
+			++argumentIndex;
+			if(argumentIndex < argc) { outputPath = argv[argumentIndex]; }
+			else
+			{
+				Log::printf(Log::error, "Expected filename after '--output'\n");
+				showHelpAndExit = true;
+				break;
+			}
+		}
+		else
+		{
+			Log::printf(Log::error, "Unrecognized argument: %s\n", argv[argumentIndex]);
+			showHelpAndExit = true;
+			break;
+		}
+	}
+
+	if(showHelpAndExit)
+	{
+		Log::printf(Log::error, "Usage: wavm test lexertables [--output <LexerTables.h>]\n");
+		return EXIT_FAILURE;
+	}
+
+	// If an output path was given, write the precomputed lexer tables to it instead of testing
+	// the tables that were compiled into WAVM.
+	if(outputPath)
+	{
+		const std::string tablesSource = WAST::generatePrecomputedLexerTables();
+		return saveFile(outputPath, tablesSource.data(), tablesSource.size()) ? EXIT_SUCCESS
+																			  : EXIT_FAILURE;
+	}
+
+	Timing::Timer timer;
+	if(!WAST::validatePrecomputedLexerTables())
+	{
+		Log::printf(Log::error,
+					"Build the GenerateLexerTables target to update Lib/WASTParse/LexerTables.h.\n");
+		return EXIT_FAILURE;
+	}
+	Timing::logTimer("LexerTablesTest", timer);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,208 @@
+#include <string>
+#include <vector>
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Timing.h"
+#include "WAVM/Metrics/Metrics.h"
+#include "WAVM/Platform/Thread.h"
+#include "wavm-test.h"
+
+using namespace WAVM;
+using namespace WAVM::Metrics;
+
+static const MetricSnapshot& findMetric(const std::vector<MetricSnapshot>& snapshot,
+										const char* name)
+{
+	for(const MetricSnapshot& metric : snapshot)
+	{
+		if(metric.name == name) { return metric; }
+	}
+	WAVM_UNREACHABLE();
+}
+
+static void testDisabled()
+{
+	Counter& counter = getCounter("test_disabled_total", "A counter added to while disabled.");
+	Histogram& histogram
+		= getHistogram("test_disabled_bytes", "A histogram recorded while disabled.", Unit::bytes);
+
+	setEnabled(false);
+	counter.add(10);
+	histogram.record(10);
+	{
+		Histogram& timerHistogram = getHistogram(
+			"test_disabled_seconds", "A timer run while disabled.", Unit::nanoseconds);
+		Timer timer(timerHistogram);
+		setEnabled(true);
+	}
+	WAVM_ERROR_UNLESS(counter.get() == 0);
+	WAVM_ERROR_UNLESS(histogram.getSum() == 0);
+	WAVM_ERROR_UNLESS(findMetric(getSnapshot(), "test_disabled_seconds").count == 0);
+}
+
+static void testCounter()
+{
+	Counter& counter = getCounter("test_counter_total", "A counter.");
+	WAVM_ERROR_UNLESS(&counter == &getCounter("test_counter_total", "A counter."));
+
+	counter.add();
+	counter.add(41);
+	WAVM_ERROR_UNLESS(counter.get() == 42);
+
+	// Metrics with the same name and different label values are distinct.
+	Counter& a = getCounter("test_labeled_total", "A labeled counter.", "kind", "a");
+	Counter& b = getCounter("test_labeled_total", "A labeled counter.", "kind", "b");
+	WAVM_ERROR_UNLESS(&a != &b);
+	a.add(1);
+	b.add(2);
+	WAVM_ERROR_UNLESS(a.get() == 1 && b.get() == 2);
+
+	counter.reset();
+	WAVM_ERROR_UNLESS(counter.get() == 0);
+}
+
+static void testHistogramBuckets()
+{
+	// Small values each have their own bucket.
+	for(U64 value = 0; value < Histogram::numSubBuckets; ++value)
+	{
+		WAVM_ERROR_UNLESS(Histogram::getBucketIndex(value) == value);
+		WAVM_ERROR_UNLESS(Histogram::getBucketUpperBound(Uptr(value)) == value);
+	}
+
+	// Each bucket's upper bound is in the bucket, and the next value is in the next bucket.
+	for(Uptr bucketIndex = 0; bucketIndex + 1 < Histogram::numBuckets; ++bucketIndex)
+	{
+		const U64 upperBound = Histogram::getBucketUpperBound(bucketIndex);
+		WAVM_ERROR_UNLESS(Histogram::getBucketIndex(upperBound) == bucketIndex);
+		WAVM_ERROR_UNLESS(Histogram::getBucketIndex(upperBound + 1) == bucketIndex + 1);
+	}
+	WAVM_ERROR_UNLESS(Histogram::getBucketIndex(UINT64_MAX) == Histogram::numBuckets - 1);
+	WAVM_ERROR_UNLESS(Histogram::getBucketUpperBound(Histogram::numBuckets - 1) == UINT64_MAX);
+
+	// A bucket's upper bound is within 12.5% of any value in the bucket.
+	for(U64 value : {U64(9), U64(100), U64(1000), U64(123456789), U64(1) << 40})
+	{
+		const U64 upperBound = Histogram::getBucketUpperBound(Histogram::getBucketIndex(value));
+		WAVM_ERROR_UNLESS(upperBound >= value && upperBound - value <= value / 8);
+	}
+
+	Histogram& histogram = getHistogram("test_histogram_bytes", "A histogram.", Unit::bytes);
+	histogram.record(1);
+	histogram.record(100);
+	histogram.record(100);
+	histogram.record(1000);
+	WAVM_ERROR_UNLESS(histogram.getSum() == 1201);
+	WAVM_ERROR_UNLESS(histogram.getBucketCount(Histogram::getBucketIndex(100)) == 2);
+
+	const std::vector<MetricSnapshot> snapshot = getSnapshot();
+	const MetricSnapshot& metric = findMetric(snapshot, "test_histogram_bytes");
+	WAVM_ERROR_UNLESS(metric.kind == MetricKind::histogram);
+	WAVM_ERROR_UNLESS(metric.count == 4 && metric.sum == 1201);
+	WAVM_ERROR_UNLESS(metric.buckets.size() == 3);
+	WAVM_ERROR_UNLESS(metric.buckets[0].upperBound == 1 && metric.buckets[0].count == 1);
+	WAVM_ERROR_UNLESS(metric.buckets[1].count == 2);
+	WAVM_ERROR_UNLESS(metric.buckets[2].upperBound >= 1000 && metric.buckets[2].count == 1);
+}
+
+static constexpr Uptr numThreads = 8;
+static constexpr Uptr numAddsPerThread = 100000;
+
+static I64 addFromThread(void*)
+{
+	Counter& counter = getCounter("test_threads_total", "A counter added to by many threads.");
+	Histogram& histogram
+		= getHistogram("test_threads_bytes", "A histogram recorded by many threads.", Unit::bytes);
+	for(Uptr addIndex = 0; addIndex < numAddsPerThread; ++addIndex)
+	{
+		counter.add();
+		histogram.record(addIndex % 16);
+	}
+	return 0;
+}
+
+static void testThreads()
+{
+	std::vector<Platform::Thread*> threads;
+	for(Uptr threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+	{ threads.push_back(Platform::createThread(0, addFromThread, nullptr)); }
+	for(Platform::Thread* thread : threads) { Platform::joinThread(thread); }
+
+	const std::vector<MetricSnapshot> snapshot = getSnapshot();
+	const MetricSnapshot& counter = findMetric(snapshot, "test_threads_total");
+	const MetricSnapshot& histogram = findMetric(snapshot, "test_threads_bytes");
+	WAVM_ERROR_UNLESS(counter.count == numThreads * numAddsPerThread);
+	WAVM_ERROR_UNLESS(histogram.count == numThreads * numAddsPerThread);
+	WAVM_ERROR_UNLESS(histogram.sum == numThreads * (numAddsPerThread / 16) * (15 * 16 / 2));
+}
+
+static void testPrometheusText()
+{
+	std::vector<MetricSnapshot> snapshot(3);
+
+	snapshot[0].name = "wavm_things_total";
+	snapshot[0].help = "Things.";
+	snapshot[0].labelName = "kind";
+	snapshot[0].labelValue = "a\"b";
+	snapshot[0].kind = MetricKind::counter;
+	snapshot[0].unit = Unit::none;
+	snapshot[0].count = 3;
+	snapshot[0].sum = 0;
+
+	snapshot[1] = snapshot[0];
+	snapshot[1].labelValue = "c";
+	snapshot[1].count = 4;
+
+	snapshot[2].name = "wavm_duration_seconds";
+	snapshot[2].help = "Durations.";
+	snapshot[2].kind = MetricKind::histogram;
+	snapshot[2].unit = Unit::nanoseconds;
+	snapshot[2].count = 3;
+	snapshot[2].sum = 2500000;
+	snapshot[2].buckets = {{1048575, 2}, {1179647, 1}};
+
+	const std::string text = formatPrometheusText(snapshot);
+	const char* expectedText
+		= "# HELP wavm_things_total Things.\n"
+		  "# TYPE wavm_things_total counter\n"
+		  "wavm_things_total{kind=\"a\\\"b\"} 3\n"
+		  "wavm_things_total{kind=\"c\"} 4\n"
+		  "# HELP wavm_duration_seconds Durations.\n"
+		  "# TYPE wavm_duration_seconds histogram\n"
+		  "wavm_duration_seconds_bucket{le=\"0.001048575\"} 2\n"
+		  "wavm_duration_seconds_bucket{le=\"0.001179647\"} 3\n"
+		  "wavm_duration_seconds_bucket{le=\"+Inf\"} 3\n"
+		  "wavm_duration_seconds_sum 0.0025\n"
+		  "wavm_duration_seconds_count 3\n";
+	WAVM_ERROR_UNLESS(text == expectedText);
+}
+
+static void testReset()
+{
+	Counter& counter = getCounter("test_reset_total", "A counter that is reset.");
+	Histogram& histogram
+		= getHistogram("test_reset_seconds", "A timer that is reset.", Unit::nanoseconds);
+	counter.add(5);
+	{
+		Timer timer(histogram);
+	}
+	WAVM_ERROR_UNLESS(findMetric(getSnapshot(), "test_reset_seconds").count == 1);
+
+	reset();
+	WAVM_ERROR_UNLESS(counter.get() == 0);
+	WAVM_ERROR_UNLESS(findMetric(getSnapshot(), "test_reset_seconds").count == 0);
+}
+
+I32 execMetricsTest(int argc, char** argv)
+{
+	Timing::Timer timer;
+	testDisabled();
+	testCounter();
+	testHistogramBuckets();
+	testThreads();
+	testPrometheusText();
+	testReset();
+	setEnabled(false);
+	Timing::logTimer("MetricsTest", timer);
+	return 0;
+}
@@ -0,0 +1,202 @@
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "WAVM/IR/Module.h"
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Errors.h"
+#include "WAVM/Inline/Timing.h"
+#include "WAVM/LLVMJIT/LLVMJIT.h"
+#include "WAVM/Runtime/Runtime.h"
+#include "WAVM/WASTParse/WASTParse.h"
+#include "wavm-test.h"
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+using namespace WAVM;
+using namespace WAVM::Runtime;
+
+static constexpr const char* perfMapTestModuleWAST
+	= "(module\n"
+	  "  (func $perfMapTestAdd (export \"add\") (param i32 i32) (result i32)\n"
+	  "    (i32.add (local.get 0) (local.get 1))\n"
+	  "  )\n"
+	  "  (func $perfMapTestMul (export \"mul\") (param i32 i32) (result i32)\n"
+	  "    (i32.mul (local.get 0) (local.get 1))\n"
+	  "  )\n"
+	  ")";
+
+static const char* const perfMapTestFunctionNames[2] = {"perfMapTestAdd", "perfMapTestMul"};
+
+#ifdef __linux__
+
+static std::vector<U8> readFile(const std::string& path)
+{
+	std::vector<U8> bytes;
+	FILE* file = fopen(path.c_str(), "rb");
+	WAVM_ERROR_UNLESS(file);
+	U8 buffer[4096];
+	Uptr numBytesRead;
+	while((numBytesRead = fread(buffer, 1, sizeof(buffer), file)) > 0)
+	{ bytes.insert(bytes.end(), buffer, buffer + numBytesRead); }
+	fclose(file);
+	return bytes;
+}
+
+template<typename Value> static Value readValue(const std::vector<U8>& bytes, Uptr offset)
+{
+	WAVM_ERROR_UNLESS(offset + sizeof(Value) <= bytes.size());
+	Value value;
+	memcpy(&value, bytes.data() + offset, sizeof(Value));
+	return value;
+}
+
+// Compiles and instantiates the test module in a new compartment, and returns the compartment.
+static GCPointer<Compartment> loadTestModule(const IR::Module& irModule, const char* debugName)
+{
+	GCPointer<Compartment> compartment = Runtime::createCompartment();
+	ModuleRef module = compileModule(irModule);
+	WAVM_ERROR_UNLESS(instantiateModule(compartment, module, {}, debugName));
+	return compartment;
+}
+
+// Loads a module with the map mode, and checks that each of its functions is in the map with the
+// module's name. Unloading the module must only leave the map's existing lines as they were.
+static void testMap(const IR::Module& irModule)
+{
+	const std::string path = "/tmp/perf-" + std::to_string(getpid()) + ".map";
+	WAVM_ERROR_UNLESS(LLVMJIT::setPerfMapMode(LLVMJIT::PerfMapMode::map));
+
+	GCPointer<Compartment> compartment = loadTestModule(irModule, "perfMapTestModule");
+	const std::vector<U8> mapBytes = readFile(path);
+	const std::string map(mapBytes.begin(), mapBytes.end());
+
+	for(const char* functionName : perfMapTestFunctionNames)
+	{
+		const std::string expectedName = std::string("wasm!perfMapTestModule!") + functionName;
+		bool foundFunction = false;
+		Uptr lineBegin = 0;
+		while(lineBegin < map.size())
+		{
+			Uptr lineEnd = map.find('\n', lineBegin);
+			WAVM_ERROR_UNLESS(lineEnd != std::string::npos);
+			const std::string line = map.substr(lineBegin, lineEnd - lineBegin);
+			lineBegin = lineEnd + 1;
+
+			unsigned long long address = 0;
+			unsigned long long numBytes = 0;
+			char name[256];
+			WAVM_ERROR_UNLESS(sscanf(line.c_str(), "%llx %llx %255s", &address, &numBytes, name)
+							  == 3);
+			if(expectedName == name)
+			{
+				WAVM_ERROR_UNLESS(!foundFunction && address && numBytes);
+				foundFunction = true;
+			}
+		}
+		WAVM_ERROR_UNLESS(foundFunction);
+	}
+
+	WAVM_ERROR_UNLESS(tryCollectCompartment(std::move(compartment)));
+	const std::vector<U8> mapBytesAfterUnload = readFile(path);
+	WAVM_ERROR_UNLESS(mapBytesAfterUnload.size() >= mapBytes.size());
+	WAVM_ERROR_UNLESS(!memcmp(mapBytesAfterUnload.data(), mapBytes.data(), mapBytes.size()));
+
+	WAVM_ERROR_UNLESS(LLVMJIT::setPerfMapMode(LLVMJIT::PerfMapMode::none));
+	unlink(path.c_str());
+}
+
+// Loads a module with the jitdump mode, and checks that the jitdump file has a valid header, a
+// code load record with the code of each of the module's functions, and a final close record.
+static void testJITDump(const IR::Module& irModule)
+{
+	const std::string path = "/tmp/jit-" + std::to_string(getpid()) + ".dump";
+	WAVM_ERROR_UNLESS(LLVMJIT::setPerfMapMode(LLVMJIT::PerfMapMode::jitdump));
+
+	GCPointer<Compartment> compartment = loadTestModule(irModule, "jitDumpTestModule");
+
+	// Check the code in the jitdump file against the loaded code before unloading it.
+	const std::vector<U8> dumpBytes = readFile(path);
+	WAVM_ERROR_UNLESS(readValue<U32>(dumpBytes, 0) == 0x4A695444);
+	WAVM_ERROR_UNLESS(readValue<U32>(dumpBytes, 4) == 1);
+	const U32 numHeaderBytes = readValue<U32>(dumpBytes, 8);
+	WAVM_ERROR_UNLESS(readValue<U32>(dumpBytes, 20) == U32(getpid()));
+
+	bool foundFunctions[2] = {false, false};
+	Uptr recordOffset = numHeaderBytes;
+	while(recordOffset < dumpBytes.size())
+	{
+		const U32 recordType = readValue<U32>(dumpBytes, recordOffset);
+		const U32 numRecordBytes = readValue<U32>(dumpBytes, recordOffset + 4);
+		WAVM_ERROR_UNLESS(numRecordBytes >= 16
+						  && recordOffset + numRecordBytes <= dumpBytes.size());
+
+		// Code load records: header, pid, tid, virtual address, code address, code size, code
+		// index, a null-terminated name, and the code.
+		if(recordType == 0)
+		{
+			const U64 codeAddress = readValue<U64>(dumpBytes, recordOffset + 32);
+			const U64 numCodeBytes = readValue<U64>(dumpBytes, recordOffset + 40);
+			const char* name = (const char*)dumpBytes.data() + recordOffset + 56;
+			const Uptr numNameBytes = strlen(name) + 1;
+			WAVM_ERROR_UNLESS(56 + numNameBytes + numCodeBytes == numRecordBytes);
+
+			for(Uptr functionIndex = 0; functionIndex < 2; ++functionIndex)
+			{
+				if(std::string("wasm!jitDumpTestModule!") + perfMapTestFunctionNames[functionIndex]
+				   == name)
+				{
+					WAVM_ERROR_UNLESS(!foundFunctions[functionIndex] && numCodeBytes);
+					WAVM_ERROR_UNLESS(!memcmp(name + numNameBytes,
+											  reinterpret_cast<const void*>(Uptr(codeAddress)),
+											  Uptr(numCodeBytes)));
+					foundFunctions[functionIndex] = true;
+				}
+			}
+		}
+
+		recordOffset += numRecordBytes;
+	}
+	WAVM_ERROR_UNLESS(recordOffset == dumpBytes.size());
+	WAVM_ERROR_UNLESS(foundFunctions[0] && foundFunctions[1]);
+
+	WAVM_ERROR_UNLESS(tryCollectCompartment(std::move(compartment)));
+
+	// Switching the mode closes the jitdump file with a close record.
+	WAVM_ERROR_UNLESS(LLVMJIT::setPerfMapMode(LLVMJIT::PerfMapMode::none));
+	const std::vector<U8> closedDumpBytes = readFile(path);
+	WAVM_ERROR_UNLESS(closedDumpBytes.size() == dumpBytes.size() + 16);
+	WAVM_ERROR_UNLESS(readValue<U32>(closedDumpBytes, dumpBytes.size()) == 3);
+	unlink(path.c_str());
+}
+
+#endif
+
+I32 execPerfMapTest(int argc, char** argv)
+{
+	Timing::Timer timer;
+
+	std::vector<WAST::Error> parseErrors;
+	IR::Module irModule;
+	if(!WAST::parseModule(
+		   perfMapTestModuleWAST, strlen(perfMapTestModuleWAST) + 1, irModule, parseErrors))
+	{
+		WAST::reportParseErrors("perf map test module", perfMapTestModuleWAST, parseErrors);
+		Errors::fatal("Failed to parse perf map test module WAST");
+	}
+
+#ifdef __linux__
+	testMap(irModule);
+	testJITDump(irModule);
+#else
+	// The perf map modes are only supported on Linux.
+	WAVM_ERROR_UNLESS(!LLVMJIT::setPerfMapMode(LLVMJIT::PerfMapMode::map));
+	WAVM_ERROR_UNLESS(!LLVMJIT::setPerfMapMode(LLVMJIT::PerfMapMode::jitdump));
+#endif
+
+	Timing::logTimer("PerfMapTest", timer);
+	return 0;
+}
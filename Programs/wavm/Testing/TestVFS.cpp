@@ -0,0 +1,574 @@
+#include <string.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/HashSet.h"
+#include "WAVM/Inline/Timing.h"
+#include "WAVM/Platform/File.h"
+#include "WAVM/Platform/Memory.h"
+#include "WAVM/Platform/Thread.h"
+#include "WAVM/VFS/BufferedStdio.h"
+#include "WAVM/VFS/ImageFS.h"
+#include "WAVM/VFS/MemoryFS.h"
+#include "WAVM/VFS/OverlayFS.h"
+#include "WAVM/VFS/VFS.h"
+#include "wavm-test.h"
+
+using namespace WAVM;
+using namespace WAVM::VFS;
+
+static void writeFile(FileSystem& fs, const std::string& path, const std::string& contents)
+{
+	VFD* vfd = nullptr;
+	WAVM_ERROR_UNLESS(
+		fs.open(path, FileAccessMode::writeOnly, FileCreateMode::createAlways, vfd)
+		== Result::success);
+	Uptr numBytesWritten = 0;
+	WAVM_ERROR_UNLESS(vfd->write(contents.data(), contents.size(), &numBytesWritten)
+					  == Result::success);
+	WAVM_ERROR_UNLESS(numBytesWritten == contents.size());
+	WAVM_ERROR_UNLESS(vfd->close() == Result::success);
+}
+
+static std::string readFile(FileSystem& fs, const std::string& path)
+{
+	VFD* vfd = nullptr;
+	WAVM_ERROR_UNLESS(
+		fs.open(path, FileAccessMode::readOnly, FileCreateMode::openExisting, vfd)
+		== Result::success);
+
+	std::string contents;
+	char buffer[16];
+	Uptr numBytesRead = 0;
+	do
+	{
+		WAVM_ERROR_UNLESS(vfd->read(buffer, sizeof(buffer), &numBytesRead) == Result::success);
+		contents.append(buffer, numBytesRead);
+	} while(numBytesRead);
+
+	WAVM_ERROR_UNLESS(vfd->close() == Result::success);
+	return contents;
+}
+
+static HashSet<std::string> listDir(FileSystem& fs, const std::string& path)
+{
+	DirEntStream* dirEntStream = nullptr;
+	WAVM_ERROR_UNLESS(fs.openDir(path, dirEntStream) == Result::success);
+
+	HashSet<std::string> names;
+	DirEnt dirEnt;
+	while(dirEntStream->getNext(dirEnt))
+	{
+		if(dirEnt.name != "." && dirEnt.name != "..") { WAVM_ERROR_UNLESS(names.add(dirEnt.name)); }
+	}
+	dirEntStream->close();
+	return names;
+}
+
+static bool exists(FileSystem& fs, const std::string& path)
+{
+	FileInfo fileInfo;
+	return fs.getFileInfo(path, fileInfo) == Result::success;
+}
+
+static void testMemoryFSFiles()
+{
+	std::shared_ptr<FileSystem> fs = makeMemoryFS();
+
+	writeFile(*fs, "/a", "hello");
+	WAVM_ERROR_UNLESS(readFile(*fs, "/a") == "hello");
+
+	VFD* vfd = nullptr;
+	WAVM_ERROR_UNLESS(fs->open("/a", FileAccessMode::readWrite, FileCreateMode::createNew, vfd)
+					  == Result::alreadyExists);
+
+	// Write past the end of the file, leaving a hole that should read as zeroes, and spanning a
+	// page boundary.
+	WAVM_ERROR_UNLESS(
+		fs->open("/a", FileAccessMode::readWrite, FileCreateMode::openExisting, vfd)
+		== Result::success);
+	U64 writeOffset = 4094;
+	WAVM_ERROR_UNLESS(vfd->write("world", 5, nullptr, &writeOffset) == Result::success);
+
+	FileInfo fileInfo;
+	WAVM_ERROR_UNLESS(vfd->getFileInfo(fileInfo) == Result::success);
+	WAVM_ERROR_UNLESS(fileInfo.type == FileType::file);
+	WAVM_ERROR_UNLESS(fileInfo.numBytes == 4099);
+
+	char buffer[8];
+	U64 holeOffset = 8;
+	Uptr numBytesRead = 0;
+	WAVM_ERROR_UNLESS(vfd->read(buffer, 8, &numBytesRead, &holeOffset) == Result::success);
+	WAVM_ERROR_UNLESS(numBytesRead == 8);
+	for(Uptr index = 0; index < 8; ++index) { WAVM_ERROR_UNLESS(buffer[index] == 0); }
+
+	// Read the bytes that span the page boundary with a vectored read.
+	char bufferA[2];
+	char bufferB[8];
+	const IOReadBuffer readBuffers[2] = {{bufferA, sizeof(bufferA)}, {bufferB, sizeof(bufferB)}};
+	const U64 readOffset = 4094;
+	WAVM_ERROR_UNLESS(vfd->readv(readBuffers, 2, &numBytesRead, &readOffset) == Result::success);
+	WAVM_ERROR_UNLESS(numBytesRead == 5);
+	WAVM_ERROR_UNLESS(!memcmp(bufferA, "wo", 2));
+	WAVM_ERROR_UNLESS(!memcmp(bufferB, "rld", 3));
+
+	// Truncating and extending the file should zero the truncated bytes.
+	WAVM_ERROR_UNLESS(vfd->setFileSize(2) == Result::success);
+	WAVM_ERROR_UNLESS(vfd->setFileSize(5) == Result::success);
+	WAVM_ERROR_UNLESS(vfd->close() == Result::success);
+	WAVM_ERROR_UNLESS(readFile(*fs, "/a") == std::string("he\0\0\0", 5));
+
+	// Writing to a read-only VFD should fail.
+	WAVM_ERROR_UNLESS(fs->open("/a", FileAccessMode::readOnly, FileCreateMode::openExisting, vfd)
+					  == Result::success);
+	WAVM_ERROR_UNLESS(vfd->write("x", 1) == Result::notPermitted);
+	WAVM_ERROR_UNLESS(vfd->close() == Result::success);
+
+	WAVM_ERROR_UNLESS(fs->unlinkFile("/a") == Result::success);
+	WAVM_ERROR_UNLESS(!exists(*fs, "/a"));
+	WAVM_ERROR_UNLESS(fs->unlinkFile("/a") == Result::doesNotExist);
+}
+
+static void testMemoryFSDirs()
+{
+	std::shared_ptr<FileSystem> fs = makeMemoryFS();
+
+	WAVM_ERROR_UNLESS(fs->createDir("/d") == Result::success);
+	WAVM_ERROR_UNLESS(fs->createDir("/d") == Result::alreadyExists);
+	WAVM_ERROR_UNLESS(fs->createDir("/x/y") == Result::doesNotExist);
+	writeFile(*fs, "/d/f", "f");
+	writeFile(*fs, "/d/../g", "g");
+
+	HashSet<std::string> rootNames = listDir(*fs, "/");
+	WAVM_ERROR_UNLESS(rootNames.size() == 2);
+	WAVM_ERROR_UNLESS(rootNames.contains("d") && rootNames.contains("g"));
+
+	WAVM_ERROR_UNLESS(fs->removeDir("/d") == Result::isNotEmpty);
+	WAVM_ERROR_UNLESS(fs->unlinkFile("/d") == Result::isDirectory);
+	WAVM_ERROR_UNLESS(fs->removeDir("/g") == Result::isNotDirectory);
+
+	// Rename a file over an existing file, and a directory into another directory.
+	WAVM_ERROR_UNLESS(fs->renameFile("/g", "/d/f") == Result::success);
+	WAVM_ERROR_UNLESS(readFile(*fs, "/d/f") == "g");
+	WAVM_ERROR_UNLESS(!exists(*fs, "/g"));
+
+	WAVM_ERROR_UNLESS(fs->createDir("/e") == Result::success);
+	WAVM_ERROR_UNLESS(fs->renameFile("/e", "/d/e") == Result::success);
+	WAVM_ERROR_UNLESS(fs->renameFile("/d", "/d/e/d") == Result::notPermitted);
+	WAVM_ERROR_UNLESS(fs->renameFile("/d/f", "/d/e") == Result::isDirectory);
+
+	HashSet<std::string> dNames = listDir(*fs, "/d");
+	WAVM_ERROR_UNLESS(dNames.size() == 2);
+	WAVM_ERROR_UNLESS(dNames.contains("e") && dNames.contains("f"));
+
+	WAVM_ERROR_UNLESS(fs->removeDir("/d/e") == Result::success);
+	WAVM_ERROR_UNLESS(fs->unlinkFile("/d/f") == Result::success);
+	WAVM_ERROR_UNLESS(fs->removeDir("/d") == Result::success);
+	WAVM_ERROR_UNLESS(listDir(*fs, "/").size() == 0);
+}
+
+static void testOverlayFS()
+{
+	std::shared_ptr<FileSystem> lowerFS = makeMemoryFS();
+	WAVM_ERROR_UNLESS(lowerFS->createDir("/d") == Result::success);
+	writeFile(*lowerFS, "/d/a", "lower a");
+	writeFile(*lowerFS, "/d/b", "lower b");
+	writeFile(*lowerFS, "/c", "lower c");
+
+	std::shared_ptr<FileSystem> upperFS = makeMemoryFS();
+	std::shared_ptr<FileSystem> fs = makeOverlayFS(lowerFS.get(), upperFS.get());
+
+	// Files in the lower FS should be visible, and reading them shouldn't copy them up.
+	WAVM_ERROR_UNLESS(readFile(*fs, "/d/a") == "lower a");
+	WAVM_ERROR_UNLESS(!exists(*upperFS, "/d"));
+
+	// VFDs opened read-only for files and directories in the lower FS shouldn't be able to modify
+	// the lower FS.
+	FileInfo lowerInfo;
+	WAVM_ERROR_UNLESS(lowerFS->getFileInfo("/d/b", lowerInfo) == Result::success);
+	VFD* vfd = nullptr;
+	WAVM_ERROR_UNLESS(
+		fs->open("/d/b", FileAccessMode::readOnly, FileCreateMode::openExisting, vfd)
+		== Result::success);
+	WAVM_ERROR_UNLESS(vfd->setFileTimes(true, Time{1000000000}, true, Time{2000000000})
+					  == Result::notPermitted);
+	WAVM_ERROR_UNLESS(vfd->setFileSize(0) == Result::notPermitted);
+	WAVM_ERROR_UNLESS(vfd->write("upper", 5) == Result::notPermitted);
+	WAVM_ERROR_UNLESS(vfd->close() == Result::success);
+	FileInfo lowerInfoAfterOpen;
+	WAVM_ERROR_UNLESS(lowerFS->getFileInfo("/d/b", lowerInfoAfterOpen) == Result::success);
+	WAVM_ERROR_UNLESS(lowerInfoAfterOpen.lastAccessTime.ns == lowerInfo.lastAccessTime.ns);
+	WAVM_ERROR_UNLESS(lowerInfoAfterOpen.lastWriteTime.ns == lowerInfo.lastWriteTime.ns);
+	WAVM_ERROR_UNLESS(lowerInfoAfterOpen.numBytes == lowerInfo.numBytes);
+	WAVM_ERROR_UNLESS(readFile(*lowerFS, "/d/b") == "lower b");
+
+	WAVM_ERROR_UNLESS(lowerFS->getFileInfo("/d", lowerInfo) == Result::success);
+	WAVM_ERROR_UNLESS(fs->open("/d", FileAccessMode::none, FileCreateMode::openExisting, vfd)
+					  == Result::success);
+	WAVM_ERROR_UNLESS(vfd->setFileTimes(true, Time{1000000000}, true, Time{2000000000})
+					  == Result::notPermitted);
+	WAVM_ERROR_UNLESS(vfd->close() == Result::success);
+	WAVM_ERROR_UNLESS(lowerFS->getFileInfo("/d", lowerInfoAfterOpen) == Result::success);
+	WAVM_ERROR_UNLESS(lowerInfoAfterOpen.lastWriteTime.ns == lowerInfo.lastWriteTime.ns);
+	WAVM_ERROR_UNLESS(!exists(*upperFS, "/d"));
+
+	// Writing a file in the lower FS should copy it up, without modifying the lower FS.
+	WAVM_ERROR_UNLESS(
+		fs->open("/d/a", FileAccessMode::writeOnly, FileCreateMode::openExisting, vfd)
+		== Result::success);
+	WAVM_ERROR_UNLESS(vfd->write("upper", 5) == Result::success);
+	WAVM_ERROR_UNLESS(vfd->close() == Result::success);
+	WAVM_ERROR_UNLESS(readFile(*fs, "/d/a") == "upper a");
+	WAVM_ERROR_UNLESS(readFile(*upperFS, "/d/a") == "upper a");
+	WAVM_ERROR_UNLESS(readFile(*lowerFS, "/d/a") == "lower a");
+
+	// New files should be created in the upper FS.
+	writeFile(*fs, "/d/e", "upper e");
+	WAVM_ERROR_UNLESS(!exists(*lowerFS, "/d/e"));
+
+	HashSet<std::string> dNames = listDir(*fs, "/d");
+	WAVM_ERROR_UNLESS(dNames.size() == 3);
+	WAVM_ERROR_UNLESS(dNames.contains("a") && dNames.contains("b") && dNames.contains("e"));
+
+	// Deleting a file in the lower FS should hide it.
+	WAVM_ERROR_UNLESS(fs->unlinkFile("/d/b") == Result::success);
+	WAVM_ERROR_UNLESS(!exists(*fs, "/d/b"));
+	WAVM_ERROR_UNLESS(exists(*lowerFS, "/d/b"));
+	WAVM_ERROR_UNLESS(!listDir(*fs, "/d").contains("b"));
+
+	// Renaming a file in the lower FS should hide the old path.
+	WAVM_ERROR_UNLESS(fs->renameFile("/c", "/d/c") == Result::success);
+	WAVM_ERROR_UNLESS(!exists(*fs, "/c"));
+	WAVM_ERROR_UNLESS(readFile(*fs, "/d/c") == "lower c");
+
+	// Removing a directory and recreating it shouldn't expose the files in the lower FS.
+	WAVM_ERROR_UNLESS(fs->removeDir("/d") == Result::isNotEmpty);
+	WAVM_ERROR_UNLESS(fs->unlinkFile("/d/a") == Result::success);
+	WAVM_ERROR_UNLESS(fs->unlinkFile("/d/c") == Result::success);
+	WAVM_ERROR_UNLESS(fs->unlinkFile("/d/e") == Result::success);
+	WAVM_ERROR_UNLESS(fs->removeDir("/d") == Result::success);
+	WAVM_ERROR_UNLESS(fs->createDir("/d") == Result::success);
+	WAVM_ERROR_UNLESS(listDir(*fs, "/d").size() == 0);
+	WAVM_ERROR_UNLESS(!exists(*fs, "/d/a"));
+
+	// Directory VFDs should list the merged directory.
+	WAVM_ERROR_UNLESS(fs->open("/", FileAccessMode::none, FileCreateMode::openExisting, vfd)
+					  == Result::success);
+	DirEntStream* dirEntStream = nullptr;
+	WAVM_ERROR_UNLESS(vfd->openDir(dirEntStream) == Result::success);
+	Uptr numDirEnts = 0;
+	DirEnt dirEnt;
+	while(dirEntStream->getNext(dirEnt))
+	{
+		WAVM_ERROR_UNLESS(dirEnt.name != "c");
+		++numDirEnts;
+	}
+	WAVM_ERROR_UNLESS(numDirEnts == 3);
+	dirEntStream->close();
+	WAVM_ERROR_UNLESS(vfd->close() == Result::success);
+
+	// Renaming a directory that was partially copied up should copy up the rest of its children.
+	WAVM_ERROR_UNLESS(lowerFS->createDir("/p") == Result::success);
+	WAVM_ERROR_UNLESS(lowerFS->createDir("/p/s") == Result::success);
+	writeFile(*lowerFS, "/p/x", "lower x");
+	writeFile(*lowerFS, "/p/y", "lower y");
+	writeFile(*lowerFS, "/p/s/z", "lower z");
+	writeFile(*fs, "/p/x", "upper x");
+	WAVM_ERROR_UNLESS(exists(*upperFS, "/p/x") && !exists(*upperFS, "/p/y"));
+	WAVM_ERROR_UNLESS(fs->renameFile("/p", "/q") == Result::success);
+	WAVM_ERROR_UNLESS(!exists(*fs, "/p"));
+	WAVM_ERROR_UNLESS(readFile(*fs, "/q/x") == "upper x");
+	WAVM_ERROR_UNLESS(readFile(*fs, "/q/y") == "lower y");
+	WAVM_ERROR_UNLESS(readFile(*fs, "/q/s/z") == "lower z");
+	HashSet<std::string> qNames = listDir(*fs, "/q");
+	WAVM_ERROR_UNLESS(qNames.size() == 3);
+	WAVM_ERROR_UNLESS(qNames.contains("x") && qNames.contains("y") && qNames.contains("s"));
+}
+
+static void testImageFS()
+{
+	// Build an image from a memory FS.
+	std::shared_ptr<FileSystem> sourceFS = makeMemoryFS();
+	WAVM_ERROR_UNLESS(sourceFS->createDir("/d") == Result::success);
+	WAVM_ERROR_UNLESS(sourceFS->createDir("/d/empty") == Result::success);
+	writeFile(*sourceFS, "/d/small", "small");
+	writeFile(*sourceFS, "/empty", "");
+	std::string largeContents;
+	for(Uptr index = 0; index < 5000; ++index) { largeContents += char('a' + index % 26); }
+	writeFile(*sourceFS, "/large", largeContents);
+
+	const std::string imagePath = Platform::getCurrentWorkingDirectory() + "/wavm-test-vfs.img";
+	VFD* imageFD = nullptr;
+	WAVM_ERROR_UNLESS(Platform::getHostFS().open(imagePath,
+												 FileAccessMode::writeOnly,
+												 FileCreateMode::createAlways,
+												 imageFD)
+					  == Result::success);
+	WAVM_ERROR_UNLESS(writeImage(sourceFS.get(), "/", imageFD) == Result::success);
+	WAVM_ERROR_UNLESS(imageFD->close() == Result::success);
+
+	std::shared_ptr<FileSystem> fs = makeImageFS(Platform::mapFile(imagePath));
+	WAVM_ERROR_UNLESS(Platform::getHostFS().unlinkFile(imagePath) == Result::success);
+	WAVM_ERROR_UNLESS(fs);
+
+	WAVM_ERROR_UNLESS(readFile(*fs, "/d/small") == "small");
+	WAVM_ERROR_UNLESS(readFile(*fs, "/d/../empty") == "");
+	WAVM_ERROR_UNLESS(readFile(*fs, "/large") == largeContents);
+	WAVM_ERROR_UNLESS(!exists(*fs, "/d/missing"));
+	WAVM_ERROR_UNLESS(!exists(*fs, "/small"));
+
+	HashSet<std::string> rootNames = listDir(*fs, "/");
+	WAVM_ERROR_UNLESS(rootNames.size() == 3);
+	WAVM_ERROR_UNLESS(rootNames.contains("d") && rootNames.contains("empty")
+					  && rootNames.contains("large"));
+	WAVM_ERROR_UNLESS(listDir(*fs, "/d/empty").size() == 0);
+
+	// The image is read-only.
+	VFD* vfd = nullptr;
+	WAVM_ERROR_UNLESS(
+		fs->open("/large", FileAccessMode::readWrite, FileCreateMode::openExisting, vfd)
+		== Result::notPermitted);
+	WAVM_ERROR_UNLESS(
+		fs->open("/new", FileAccessMode::writeOnly, FileCreateMode::createNew, vfd)
+		== Result::notPermitted);
+	WAVM_ERROR_UNLESS(fs->unlinkFile("/large") == Result::notPermitted);
+
+	// Map a file over some memory, and check that the bytes past the end of the file are zeroed.
+	WAVM_ERROR_UNLESS(
+		fs->open("/large", FileAccessMode::readOnly, FileCreateMode::openExisting, vfd)
+		== Result::success);
+	const Uptr numPages = 4;
+	const Uptr numMapBytes = numPages * Platform::getBytesPerPage();
+	U8* memory = Platform::allocateVirtualPages(numPages);
+	WAVM_ERROR_UNLESS(memory && Platform::commitVirtualPages(memory, numPages));
+	memset(memory, 0xff, numMapBytes);
+	const Result mapResult = vfd->mapCopyOnWrite(0, numMapBytes, memory);
+	WAVM_ERROR_UNLESS(mapResult == Result::success || mapResult == Result::notSupported);
+	if(mapResult == Result::success)
+	{
+		WAVM_ERROR_UNLESS(!memcmp(memory, largeContents.data(), largeContents.size()));
+		for(Uptr index = largeContents.size(); index < numMapBytes; ++index)
+		{ WAVM_ERROR_UNLESS(memory[index] == 0); }
+
+		// Writing to the mapped memory shouldn't modify the file.
+		memory[0] = 'X';
+		WAVM_ERROR_UNLESS(readFile(*fs, "/large") == largeContents);
+	}
+	Platform::freeVirtualPages(memory, numPages);
+	WAVM_ERROR_UNLESS(vfd->close() == Result::success);
+}
+
+// A character device VFD that appends the bytes written to it to a log shared by several VFDs,
+// prefixing each run of writes to the same VFD with its tag.
+struct LogVFD : VFD
+{
+	LogVFD(std::string& inLog, char inTag) : log(inLog), tag(inTag) {}
+
+	virtual Result close() override { return Result::success; }
+	virtual Result seek(I64 offset, SeekOrigin origin, U64* outAbsoluteOffset = nullptr) override
+	{
+		return Result::notSeekable;
+	}
+	virtual Result readv(const IOReadBuffer* buffers,
+						 Uptr numBuffers,
+						 Uptr* outNumBytesRead = nullptr,
+						 const U64* offset = nullptr) override
+	{
+		log += "<read>";
+		if(outNumBytesRead) { *outNumBytesRead = 0; }
+		return Result::success;
+	}
+	virtual Result writev(const IOWriteBuffer* buffers,
+						  Uptr numBuffers,
+						  Uptr* outNumBytesWritten = nullptr,
+						  const U64* offset = nullptr) override
+	{
+		Uptr numBytesWritten = 0;
+		for(Uptr bufferIndex = 0; bufferIndex < numBuffers; ++bufferIndex)
+		{
+			if(buffers[bufferIndex].numBytes && (log.empty() || lastTagInLog(log) != tag))
+			{ log += std::string("[") + tag + "]"; }
+			log.append((const char*)buffers[bufferIndex].data, buffers[bufferIndex].numBytes);
+			numBytesWritten += buffers[bufferIndex].numBytes;
+		}
+		if(outNumBytesWritten) { *outNumBytesWritten = numBytesWritten; }
+		return Result::success;
+	}
+	virtual Result sync(SyncType type) override { return Result::success; }
+	virtual Result getVFDInfo(VFDInfo& outInfo) override
+	{
+		outInfo.type = FileType::characterDevice;
+		outInfo.flags = VFDFlags{};
+		return Result::success;
+	}
+	virtual Result getFileInfo(FileInfo& outInfo) override { return Result::notSupported; }
+	virtual Result setVFDFlags(const VFDFlags& flags) override { return Result::notSupported; }
+	virtual Result setFileSize(U64 numBytes) override { return Result::notSupported; }
+	virtual Result setFileTimes(bool setLastAccessTime,
+								Time lastAccessTime,
+								bool setLastWriteTime,
+								Time lastWriteTime) override
+	{
+		return Result::notSupported;
+	}
+	virtual Result openDir(DirEntStream*& outStream) override { return Result::isNotDirectory; }
+
+private:
+	std::string& log;
+	char tag;
+
+	static char lastTagInLog(const std::string& log)
+	{
+		const Uptr tagIndex = log.rfind('[');
+		return tagIndex == std::string::npos ? 0 : log[tagIndex + 1];
+	}
+};
+
+static void writeString(VFD* vfd, const std::string& string)
+{
+	Uptr numBytesWritten = 0;
+	WAVM_ERROR_UNLESS(vfd->write(string.data(), string.size(), &numBytesWritten)
+					  == Result::success);
+	WAVM_ERROR_UNLESS(numBytesWritten == string.size());
+}
+
+struct BufferedStdioThreadArgs
+{
+	VFD* vfd;
+	char tag;
+};
+
+static constexpr Uptr numBufferedStdioWritesPerThread = 1000;
+
+static I64 bufferedStdioThreadEntry(void* argument)
+{
+	BufferedStdioThreadArgs* args = (BufferedStdioThreadArgs*)argument;
+	for(Uptr writeIndex = 0; writeIndex < numBufferedStdioWritesPerThread; ++writeIndex)
+	{ writeString(args->vfd, std::string(1 + writeIndex % 7, args->tag)); }
+	return 0;
+}
+
+static void testBufferedStdio()
+{
+	std::string log;
+	LogVFD innerIn(log, 'i');
+	LogVFD innerOut(log, 'o');
+	LogVFD innerErr(log, 'e');
+
+	{
+		std::shared_ptr<BufferedStdio> stdio
+			= makeBufferedStdio(&innerIn, &innerOut, &innerErr, 256, Time::infinity());
+		VFD* out = stdio->getStdOut();
+		VFD* err = stdio->getStdErr();
+
+		// Writes are buffered until a flush, and then written in the order they were buffered.
+		writeString(out, "a");
+		writeString(out, "b");
+		writeString(err, "c");
+		writeString(out, "d");
+		WAVM_ERROR_UNLESS(log.empty());
+		WAVM_ERROR_UNLESS(out->sync(SyncType::contents) == Result::success);
+		WAVM_ERROR_UNLESS(log == "[o]ab[e]c[o]d");
+
+		// Reading from stdin flushes the buffered output first.
+		log.clear();
+		writeString(err, "prompt");
+		U8 byte;
+		WAVM_ERROR_UNLESS(stdio->getStdIn()->read(&byte, 1) == Result::success);
+		WAVM_ERROR_UNLESS(log == "[e]prompt<read>");
+
+		// Writes larger than half the buffer are written directly after flushing the buffer.
+		log.clear();
+		const std::string largeString(200, 'x');
+		writeString(out, "y");
+		writeString(err, largeString);
+		WAVM_ERROR_UNLESS(log == "[o]y[e]" + largeString);
+
+		// Writing more than fits in the buffer flushes it, including across the end of the ring.
+		log.clear();
+		std::string expectedLog = "[o]";
+		for(Uptr writeIndex = 0; writeIndex < 100; ++writeIndex)
+		{
+			const std::string string(1 + writeIndex % 13, char('a' + writeIndex % 26));
+			writeString(out, string);
+			expectedLog += string;
+		}
+		WAVM_ERROR_UNLESS(stdio->flush() == Result::success);
+		WAVM_ERROR_UNLESS(log == expectedLog);
+
+		// Closing an output VFD flushes it, and destroying the BufferedStdio flushes the rest.
+		log.clear();
+		writeString(out, "z");
+		WAVM_ERROR_UNLESS(out->close() == Result::success);
+		WAVM_ERROR_UNLESS(log == "[o]z");
+		writeString(err, "w");
+	}
+	WAVM_ERROR_UNLESS(log == "[o]z[e]w");
+
+	// Write from several threads, and check that each thread's writes are in order.
+	log.clear();
+	{
+		std::shared_ptr<BufferedStdio> stdio
+			= makeBufferedStdio(&innerIn, &innerOut, &innerErr, 1024, Time{1000000});
+		BufferedStdioThreadArgs threadArgs[2] = {{stdio->getStdOut(), 'o'},
+												 {stdio->getStdErr(), 'e'}};
+		Platform::Thread* threads[2];
+		for(Uptr threadIndex = 0; threadIndex < 2; ++threadIndex)
+		{
+			threads[threadIndex]
+				= Platform::createThread(0, bufferedStdioThreadEntry, &threadArgs[threadIndex]);
+		}
+		for(Uptr threadIndex = 0; threadIndex < 2; ++threadIndex)
+		{ Platform::joinThread(threads[threadIndex]); }
+	}
+	std::string outputs[2];
+	char currentTag = 0;
+	for(Uptr charIndex = 0; charIndex < log.size(); ++charIndex)
+	{
+		if(log[charIndex] == '[')
+		{
+			currentTag = log[charIndex + 1];
+			charIndex += 2;
+		}
+		else
+		{
+			WAVM_ERROR_UNLESS(log[charIndex] == currentTag);
+			outputs[currentTag == 'o' ? 0 : 1] += log[charIndex];
+		}
+	}
+	for(Uptr threadIndex = 0; threadIndex < 2; ++threadIndex)
+	{
+		std::string expectedOutput;
+		for(Uptr writeIndex = 0; writeIndex < numBufferedStdioWritesPerThread; ++writeIndex)
+		{ expectedOutput += std::string(1 + writeIndex % 7, threadIndex == 0 ? 'o' : 'e'); }
+		WAVM_ERROR_UNLESS(outputs[threadIndex] == expectedOutput);
+	}
+
+	// Files aren't buffered.
+	std::shared_ptr<FileSystem> fs = makeMemoryFS();
+	VFD* fileVFD = nullptr;
+	WAVM_ERROR_UNLESS(
+		fs->open("/out", FileAccessMode::writeOnly, FileCreateMode::createAlways, fileVFD)
+		== Result::success);
+	{
+		std::shared_ptr<BufferedStdio> stdio
+			= makeBufferedStdio(&innerIn, fileVFD, &innerErr, 256, Time::infinity());
+		WAVM_ERROR_UNLESS(stdio->getStdOut() == fileVFD);
+		WAVM_ERROR_UNLESS(stdio->getStdErr() != &innerErr);
+	}
+	WAVM_ERROR_UNLESS(fileVFD->close() == Result::success);
+}
+
+int execVFSTest(int argc, char** argv)
+{
+	Timing::Timer timer;
+	testMemoryFSFiles();
+	testMemoryFSDirs();
+	testOverlayFS();
+	testImageFS();
+	testBufferedStdio();
+	Timing::logTimer("VFSTest", timer);
+	return 0;
+}
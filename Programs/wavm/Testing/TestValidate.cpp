@@ -0,0 +1,120 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include "WAVM/IR/IR.h"
+#include "WAVM/IR/Module.h"
+#include "WAVM/IR/Operators.h"
+#include "WAVM/IR/Types.h"
+#include "WAVM/IR/Validate.h"
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Serialization.h"
+#include "WAVM/Inline/Timing.h"
+#include "WAVM/WASM/WASM.h"
+#include "wavm-test.h"
+
+using namespace WAVM;
+using namespace WAVM::IR;
+
+static constexpr Uptr numFunctionDefs = 1000;
+
+// Creates a module with many function definitions. The functions with the given indices are
+// invalid, and each fails validation with a different message.
+static Module createModule(const std::vector<Uptr>& invalidFunctionDefIndices)
+{
+	Module module;
+	module.types.push_back(FunctionType({ValueType::i32}, {ValueType::i32}));
+	for(Uptr functionDefIndex = 0; functionDefIndex < numFunctionDefs; ++functionDefIndex)
+	{
+		bool isInvalid = false;
+		for(Uptr invalidFunctionDefIndex : invalidFunctionDefIndices)
+		{
+			if(invalidFunctionDefIndex == functionDefIndex) { isInvalid = true; }
+		}
+
+		// The valid functions return the sum of their parameter and a constant. The invalid
+		// functions read a local with an out-of-bounds index that depends on the function index.
+		Serialization::ArrayOutputStream codeStream;
+		OperatorEncoderStream encoder(codeStream);
+		encoder.local_get({isInvalid ? U32(100 + functionDefIndex) : 0});
+		encoder.i32_const({I32(functionDefIndex)});
+		encoder.i32_add();
+		encoder.end();
+
+		module.functions.defs.push_back({{0}, {}, std::move(codeStream.getBytes()), {}});
+	}
+	return module;
+}
+
+// Validates the module's code with validateCodeSection, and returns the validation error message,
+// or an empty string if the code is valid.
+static std::string validateSerially(const Module& module)
+{
+	std::shared_ptr<ModuleValidationState> state = createModuleValidationState(module);
+	validatePreCodeSections(*state);
+	try
+	{
+		validateCodeSection(*state);
+		return std::string();
+	}
+	catch(ValidationException const& exception)
+	{
+		return exception.message;
+	}
+}
+
+static std::string validateInParallel(const Module& module, Uptr numThreads)
+{
+	std::shared_ptr<ModuleValidationState> state = createModuleValidationState(module);
+	validatePreCodeSections(*state);
+	try
+	{
+		validateCodeSectionInParallel(*state, numThreads);
+		return std::string();
+	}
+	catch(ValidationException const& exception)
+	{
+		return exception.message;
+	}
+}
+
+static void testModule(const std::vector<Uptr>& invalidFunctionDefIndices)
+{
+	const Module module = createModule(invalidFunctionDefIndices);
+	const std::string expectedMessage = validateSerially(module);
+	WAVM_ERROR_UNLESS(expectedMessage.empty() == invalidFunctionDefIndices.empty());
+
+	// The parallel validation must report the same error as the serial validation, regardless of
+	// the number of threads and the order the threads happen to validate the functions in.
+	for(Uptr numThreads : {Uptr(0), Uptr(1), Uptr(2), Uptr(4), Uptr(8), Uptr(64)})
+	{
+		for(Uptr repeatIndex = 0; repeatIndex < 4; ++repeatIndex)
+		{ WAVM_ERROR_UNLESS(validateInParallel(module, numThreads) == expectedMessage); }
+	}
+
+	// Loading the module from a binary also reports the error for the lowest-indexed invalid
+	// function.
+	const std::vector<U8> wasmBytes = WASM::saveBinaryModule(module);
+	Module loadedModule;
+	WASM::LoadError loadError;
+	const bool loaded
+		= WASM::loadBinaryModule(wasmBytes.data(), wasmBytes.size(), loadedModule, &loadError);
+	WAVM_ERROR_UNLESS(loaded == expectedMessage.empty());
+	if(!loaded)
+	{
+		WAVM_ERROR_UNLESS(loadError.type == WASM::LoadError::Type::invalid);
+		WAVM_ERROR_UNLESS(loadError.message == "Module was invalid: " + expectedMessage);
+	}
+}
+
+I32 execValidateTest(int argc, char** argv)
+{
+	Timing::Timer timer;
+	testModule({});
+	testModule({0});
+	testModule({numFunctionDefs - 1});
+	testModule({numFunctionDefs - 1, numFunctionDefs / 2});
+	testModule({997, 3, 500, 4, 999});
+	Timing::logTimer("ValidateTest", timer);
+	return 0;
+}
@@ -0,0 +1,248 @@
+#include <string.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include "WAVM/IR/Module.h"
+#include "WAVM/IR/Types.h"
+#include "WAVM/IR/Value.h"
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Errors.h"
+#include "WAVM/Inline/Time.h"
+#include "WAVM/Inline/Timing.h"
+#include "WAVM/Platform/Event.h"
+#include "WAVM/Platform/Thread.h"
+#include "WAVM/Runtime/Linker.h"
+#include "WAVM/Runtime/Runtime.h"
+#include "WAVM/VFS/VFS.h"
+#include "WAVM/WASI/WASI.h"
+#include "WAVM/WASI/WASIABI.h"
+#include "WAVM/WASTParse/WASTParse.h"
+#include "wavm-test.h"
+
+using namespace WAVM;
+using namespace WAVM::IR;
+using namespace WAVM::Runtime;
+
+// How long to wait for a syscall that should finish before deciding that it is stuck.
+static constexpr Time syscallTimeout = Time{10000000000};
+
+static constexpr const char* wasiTestModuleWAST
+	= "(module\n"
+	  "  (import \"wasi_snapshot_preview1\" \"fd_read\"\n"
+	  "    (func $fd_read (param i32 i32 i32 i32) (result i32)))\n"
+	  "  (import \"wasi_snapshot_preview1\" \"fd_close\"\n"
+	  "    (func $fd_close (param i32) (result i32)))\n"
+	  "  (import \"wasi_snapshot_preview1\" \"fd_renumber\"\n"
+	  "    (func $fd_renumber (param i32 i32) (result i32)))\n"
+	  "  (memory (export \"memory\") 1)\n"
+	  "  (data (i32.const 0) \"\\10\\00\\00\\00\\10\\00\\00\\00\")\n"
+	  "  (func (export \"read\") (param $fd i32) (result i32)\n"
+	  "    (call $fd_read (local.get $fd) (i32.const 0) (i32.const 1) (i32.const 8))\n"
+	  "  )\n"
+	  "  (func (export \"getNumBytesRead\") (result i32) (i32.load (i32.const 8)))\n"
+	  "  (func (export \"close\") (param $fd i32) (result i32)\n"
+	  "    (call $fd_close (local.get $fd))\n"
+	  "  )\n"
+	  "  (func (export \"renumber\") (param $fromFD i32) (param $toFD i32) (result i32)\n"
+	  "    (call $fd_renumber (local.get $fromFD) (local.get $toFD))\n"
+	  "  )\n"
+	  ")";
+
+// A VFD whose reads block until the test releases them, and that records when it is closed.
+struct BlockingVFD : VFS::VFD
+{
+	Platform::Event& readStartedEvent;
+	Platform::Event& readReleasedEvent;
+	std::atomic<bool>& isClosed;
+
+	BlockingVFD(Platform::Event& inReadStartedEvent,
+				Platform::Event& inReadReleasedEvent,
+				std::atomic<bool>& inIsClosed)
+	: readStartedEvent(inReadStartedEvent)
+	, readReleasedEvent(inReadReleasedEvent)
+	, isClosed(inIsClosed)
+	{
+	}
+
+	virtual VFS::Result close() override
+	{
+		isClosed.store(true);
+		delete this;
+		return VFS::Result::success;
+	}
+	virtual VFS::Result seek(I64 offset,
+							 VFS::SeekOrigin origin,
+							 U64* outAbsoluteOffset = nullptr) override
+	{
+		return VFS::Result::notSeekable;
+	}
+	virtual VFS::Result readv(const VFS::IOReadBuffer* buffers,
+							  Uptr numBuffers,
+							  Uptr* outNumBytesRead = nullptr,
+							  const U64* offset = nullptr) override
+	{
+		readStartedEvent.signal();
+		WAVM_ERROR_UNLESS(readReleasedEvent.wait(syscallTimeout));
+
+		WAVM_ERROR_UNLESS(numBuffers && buffers[0].numBytes);
+		*(U8*)buffers[0].data = 'x';
+		if(outNumBytesRead) { *outNumBytesRead = 1; }
+		return VFS::Result::success;
+	}
+	virtual VFS::Result writev(const VFS::IOWriteBuffer* buffers,
+							   Uptr numBuffers,
+							   Uptr* outNumBytesWritten = nullptr,
+							   const U64* offset = nullptr) override
+	{
+		return VFS::Result::notPermitted;
+	}
+	virtual VFS::Result sync(VFS::SyncType type) override { return VFS::Result::success; }
+	virtual VFS::Result getVFDInfo(VFS::VFDInfo& outInfo) override
+	{
+		outInfo.type = VFS::FileType::pipe;
+		outInfo.flags = VFS::VFDFlags{};
+		return VFS::Result::success;
+	}
+	virtual VFS::Result getFileInfo(VFS::FileInfo& outInfo) override
+	{
+		return VFS::Result::notSupported;
+	}
+	virtual VFS::Result setVFDFlags(const VFS::VFDFlags& flags) override
+	{
+		return VFS::Result::notSupported;
+	}
+	virtual VFS::Result setFileSize(U64 numBytes) override { return VFS::Result::notSupported; }
+	virtual VFS::Result setFileTimes(bool setLastAccessTime,
+									 Time lastAccessTime,
+									 bool setLastWriteTime,
+									 Time lastWriteTime) override
+	{
+		return VFS::Result::notSupported;
+	}
+	virtual VFS::Result openDir(VFS::DirEntStream*& outStream) override
+	{
+		return VFS::Result::isNotDirectory;
+	}
+};
+
+struct ThreadArgs
+{
+	Context* context;
+	Instance* instance;
+	Platform::Event finishedEvent;
+	I32 result = -1;
+};
+
+static I32 invokeI32(Context* context,
+					 Instance* instance,
+					 const char* exportName,
+					 std::vector<UntaggedValue>&& args)
+{
+	Function* function = asFunction(getInstanceExport(instance, exportName));
+	UntaggedValue result;
+	invokeFunction(context, function, getFunctionType(function), args.data(), &result);
+	return result.i32;
+}
+
+static I64 readThreadEntry(void* argument)
+{
+	ThreadArgs* threadArgs = (ThreadArgs*)argument;
+	threadArgs->result = invokeI32(threadArgs->context, threadArgs->instance, "read", {I32(0)});
+	threadArgs->finishedEvent.signal();
+	return 0;
+}
+
+static I64 closeThreadEntry(void* argument)
+{
+	ThreadArgs* threadArgs = (ThreadArgs*)argument;
+	threadArgs->result = invokeI32(threadArgs->context, threadArgs->instance, "close", {I32(2)});
+	threadArgs->finishedEvent.signal();
+	return 0;
+}
+
+// Checks that a read that is blocked on one FD doesn't block closing or renumbering other FDs, and
+// that closing the FD being read defers closing its VFD until the read finishes.
+static void testCloseDuringBlockedRead()
+{
+	std::vector<WAST::Error> parseErrors;
+	IR::Module irModule;
+	if(!WAST::parseModule(
+		   wasiTestModuleWAST, strlen(wasiTestModuleWAST) + 1, irModule, parseErrors))
+	{
+		WAST::reportParseErrors("WASI test module", wasiTestModuleWAST, parseErrors);
+		Errors::fatal("Failed to parse WASI test module WAST");
+	}
+
+	Platform::Event readStartedEvent;
+	Platform::Event readReleasedEvent;
+	std::atomic<bool> isStdioClosed[3]{{false}, {false}, {false}};
+	VFS::VFD* stdioVFDs[3];
+	for(Uptr stdioIndex = 0; stdioIndex < 3; ++stdioIndex)
+	{
+		stdioVFDs[stdioIndex]
+			= new BlockingVFD(readStartedEvent, readReleasedEvent, isStdioClosed[stdioIndex]);
+	}
+
+	GCPointer<Compartment> compartment = Runtime::createCompartment();
+	std::shared_ptr<WASI::Process> process = WASI::createProcess(
+		compartment, {}, {}, nullptr, stdioVFDs[0], stdioVFDs[1], stdioVFDs[2]);
+
+	LinkResult linkResult = linkModule(irModule, WASI::getProcessResolver(*process));
+	WAVM_ERROR_UNLESS(linkResult.success);
+	ModuleRef module = compileModule(irModule);
+	Instance* instance = instantiateModule(
+		compartment, module, std::move(linkResult.resolvedImports), "wasiTestModule");
+	WASI::setProcessMemory(*process, asMemory(getInstanceExport(instance, "memory")));
+
+	// Start a read from stdin, and wait for it to block in the VFD.
+	ThreadArgs readThreadArgs;
+	readThreadArgs.context = createContext(compartment);
+	readThreadArgs.instance = instance;
+	Platform::Thread* readThread
+		= Platform::createThread(512 * 1024, readThreadEntry, &readThreadArgs);
+	WAVM_ERROR_UNLESS(readStartedEvent.wait(syscallTimeout));
+
+	// Close stderr on another thread. This must finish while the read is still blocked.
+	ThreadArgs closeThreadArgs;
+	closeThreadArgs.context = createContext(compartment);
+	closeThreadArgs.instance = instance;
+	Platform::Thread* closeThread
+		= Platform::createThread(512 * 1024, closeThreadEntry, &closeThreadArgs);
+	WAVM_ERROR_UNLESS(closeThreadArgs.finishedEvent.wait(syscallTimeout));
+	Platform::joinThread(closeThread);
+	WAVM_ERROR_UNLESS(closeThreadArgs.result == __WASI_ESUCCESS);
+	WAVM_ERROR_UNLESS(isStdioClosed[2].load());
+
+	// Renumbering and closing the FD being read also finish while the read is blocked, but the
+	// VFD isn't closed until the read finishes with it.
+	Context* context = createContext(compartment);
+	WAVM_ERROR_UNLESS(invokeI32(context, instance, "renumber", {I32(0), I32(1)})
+					  == __WASI_ESUCCESS);
+	WAVM_ERROR_UNLESS(isStdioClosed[1].load());
+	WAVM_ERROR_UNLESS(invokeI32(context, instance, "close", {I32(1)}) == __WASI_ESUCCESS);
+	WAVM_ERROR_UNLESS(invokeI32(context, instance, "close", {I32(0)}) == __WASI_EBADF);
+	WAVM_ERROR_UNLESS(!isStdioClosed[0].load());
+
+	// Release the read, and check that it succeeded and closed the VFD when it finished.
+	readReleasedEvent.signal();
+	WAVM_ERROR_UNLESS(readThreadArgs.finishedEvent.wait(syscallTimeout));
+	Platform::joinThread(readThread);
+	WAVM_ERROR_UNLESS(readThreadArgs.result == __WASI_ESUCCESS);
+	WAVM_ERROR_UNLESS(invokeI32(context, instance, "getNumBytesRead", {}) == 1);
+	WAVM_ERROR_UNLESS(isStdioClosed[0].load());
+	WAVM_ERROR_UNLESS(invokeI32(context, instance, "read", {I32(1)}) == __WASI_EBADF);
+
+	// Free the process and compartment.
+	process.reset();
+	WAVM_ERROR_UNLESS(tryCollectCompartment(std::move(compartment)));
+}
+
+I32 execWASITest(int argc, char** argv)
+{
+	Timing::Timer timer;
+	testCloseDuringBlockedRead();
+	Timing::logTimer("WASITest", timer);
+	return 0;
+}
@@ -0,0 +1,183 @@
+#include <string>
+#include <vector>
+#include "WAVM/IR/Module.h"
+#include "WAVM/IR/OperatorPrinter.h"
+#include "WAVM/IR/Operators.h"
+#include "WAVM/IR/Types.h"
+#include "WAVM/Inline/Assert.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Timing.h"
+#include "WAVM/WASM/WASM.h"
+#include "WAVM/WASTParse/WASTParse.h"
+#include "wavm-test.h"
+
+using namespace WAVM;
+using namespace WAVM::IR;
+
+static constexpr Uptr numFunctions = 2000;
+
+// Generates a module with a function on each line after the first. Some functions use block
+// and call_indirect types that aren't declared by the module, so parsing them must add types to the
+// module. The functions with the given indices reference an unknown local.
+static std::string generateModule(const std::vector<Uptr>& invalidFunctionIndices)
+{
+	std::string wast = "(module (type $t (func (param i32) (result i32))) (table 1 funcref)\n";
+	for(Uptr functionIndex = 0; functionIndex < numFunctions; ++functionIndex)
+	{
+		wast += "(func (param $x i32) (result i32) (local $y i32) (local $\"quoted y\" i64)";
+		for(Uptr instructionIndex = 0; instructionIndex < 20; ++instructionIndex)
+		{
+			wast += " (local.set $y (i32.add (local.get $x) (i32.const "
+					+ std::to_string(functionIndex + instructionIndex) + ")))";
+		}
+
+		// The functions that add types have a br_table before the instruction that adds the type,
+		// so if their bodies are parsed again, the second parse must not append to the branch
+		// tables from the first.
+		switch(functionIndex)
+		{
+		case 300:
+		case 700:
+		case 1100:
+		case 1500: wast += " block block i32.const 0 br_table 0 1 end end"; break;
+		default: break;
+		};
+
+		switch(functionIndex)
+		{
+		case 300:
+		case 1100: wast += " i64.const 1 block (param i64) (result i64) end drop"; break;
+		case 700:
+			wast += " f64.const 1 f64.const 2 i32.const 0"
+					" call_indirect (param f64 f64) (result f64) drop";
+			break;
+		case 1500: wast += " f32.const 1 block $b (param f32) (result f32) end drop"; break;
+		default: break;
+		};
+
+		for(Uptr invalidFunctionIndex : invalidFunctionIndices)
+		{
+			if(invalidFunctionIndex == functionIndex) { wast += " (local.set $z (i32.const 0))"; }
+		}
+
+		wast += " (local.get $\"quoted y\") drop (local.get $y))\n";
+	}
+	wast += ")";
+	return wast;
+}
+
+static bool parseModule(const std::string& wast,
+						Module& outModule,
+						std::vector<WAST::Error>& outErrors,
+						Uptr numThreads)
+{
+	outModule.featureSpec.quotedNamesInTextFormat = true;
+	return WAST::parseModule(wast.c_str(), wast.size() + 1, outModule, outErrors, numThreads);
+}
+
+// Returns the text of each operator in a function's code. The encoded operators may include
+// uninitialized padding, so the code is compared by its operators instead of its bytes.
+static std::vector<std::string> disassembleCode(const Module& module,
+												const FunctionDef& functionDef)
+{
+	std::vector<std::string> operators;
+	OperatorDecoderStream decoder(functionDef.code);
+	OperatorPrinter operatorPrinter(module, functionDef);
+	while(decoder) { operators.push_back(decoder.decodeOp(operatorPrinter)); }
+	return operators;
+}
+
+// Checks that parsing the module on any number of threads produces the same module and errors as
+// parsing it on one thread.
+static void testNumThreads(const std::string& wast,
+						   const Module& expectedModule,
+						   const std::vector<WAST::Error>& expectedErrors)
+{
+	const std::vector<U8> expectedWASMBytes = WASM::saveBinaryModule(expectedModule);
+	for(Uptr numThreads : {Uptr(0), Uptr(2), Uptr(4), Uptr(8), Uptr(64)})
+	{
+		for(Uptr repeatIndex = 0; repeatIndex < 4; ++repeatIndex)
+		{
+			Module module;
+			std::vector<WAST::Error> errors;
+			WAVM_ERROR_UNLESS(parseModule(wast, module, errors, numThreads)
+							  == expectedErrors.empty());
+			WAVM_ERROR_UNLESS(errors == expectedErrors);
+			WAVM_ERROR_UNLESS(module.types == expectedModule.types);
+			WAVM_ERROR_UNLESS(module.functions.defs.size() == expectedModule.functions.defs.size());
+			for(Uptr defIndex = 0; defIndex < module.functions.defs.size(); ++defIndex)
+			{
+				const FunctionDef& functionDef = module.functions.defs[defIndex];
+				const FunctionDef& expectedFunctionDef = expectedModule.functions.defs[defIndex];
+				WAVM_ERROR_UNLESS(functionDef.type.index == expectedFunctionDef.type.index);
+				WAVM_ERROR_UNLESS(functionDef.nonParameterLocalTypes
+								  == expectedFunctionDef.nonParameterLocalTypes);
+				WAVM_ERROR_UNLESS(functionDef.branchTables == expectedFunctionDef.branchTables);
+				WAVM_ERROR_UNLESS(disassembleCode(module, functionDef)
+								  == disassembleCode(expectedModule, expectedFunctionDef));
+			}
+			if(expectedErrors.empty())
+			{ WAVM_ERROR_UNLESS(WASM::saveBinaryModule(module) == expectedWASMBytes); }
+		}
+	}
+}
+
+static void testValidModule()
+{
+	const std::string wast = generateModule({});
+
+	Module module;
+	std::vector<WAST::Error> errors;
+	WAVM_ERROR_UNLESS(parseModule(wast, module, errors, 1));
+	WAVM_ERROR_UNLESS(module.functions.defs.size() == numFunctions);
+
+	// The types used by the function bodies are added in the order of the functions that use them.
+	WAVM_ERROR_UNLESS(module.types.size() == 4);
+	WAVM_ERROR_UNLESS(module.types[0] == FunctionType({ValueType::i32}, {ValueType::i32}));
+	WAVM_ERROR_UNLESS(module.types[1] == FunctionType({ValueType::i64}, {ValueType::i64}));
+	WAVM_ERROR_UNLESS(module.types[2]
+					  == FunctionType({ValueType::f64}, {ValueType::f64, ValueType::f64}));
+	WAVM_ERROR_UNLESS(module.types[3] == FunctionType({ValueType::f32}, {ValueType::f32}));
+
+	// The module is valid when loaded from a binary.
+	const std::vector<U8> wasmBytes = WASM::saveBinaryModule(module);
+	Module loadedModule;
+	WAVM_ERROR_UNLESS(WASM::loadBinaryModule(wasmBytes.data(), wasmBytes.size(), loadedModule));
+
+	testNumThreads(wast, module, errors);
+}
+
+static void testInvalidModule()
+{
+	// Include functions that must be parsed again after adding a type to the module when the
+	// bodies are parsed in parallel.
+	const std::vector<Uptr> invalidFunctionIndices = {200, 700, 1100, 1999};
+	const std::string wast = generateModule(invalidFunctionIndices);
+
+	Module module;
+	std::vector<WAST::Error> errors;
+	WAVM_ERROR_UNLESS(!parseModule(wast, module, errors, 1));
+
+	// The errors are reported in the order of the functions they are in.
+	std::vector<Uptr> errorFunctionIndices;
+	for(const WAST::Error& error : errors)
+	{
+		const Uptr functionIndex = error.locus.newlines - 1;
+		WAVM_ERROR_UNLESS(!errorFunctionIndices.size()
+						  || functionIndex >= errorFunctionIndices.back());
+		if(!errorFunctionIndices.size() || functionIndex != errorFunctionIndices.back())
+		{ errorFunctionIndices.push_back(functionIndex); }
+	}
+	WAVM_ERROR_UNLESS(errorFunctionIndices == invalidFunctionIndices);
+
+	testNumThreads(wast, module, errors);
+}
+
+I32 execWASTParseTest(int argc, char** argv)
+{
+	Timing::Timer timer;
+	testValidModule();
+	testInvalidModule();
+	Timing::logTimer("WASTParseTest", timer);
+	return 0;
+}
@@ -9,15 +9,29 @@ enum class TestCommand
 {
 	invalid,
 
+	benchHarness,
+	chaCha20,
 	dumpModules,
+	fsBench,
 	hashMap,
+	hashMapBench,
 	hashSet,
 	i128,
+	indexMap,
+	instructionOffsetTable,
+	lexerTables,
+	metrics,
+	validate,
+	vfs,
+	wastParse,
 
 #if WAVM_ENABLE_RUNTIME
 	cAPI,
 	benchmark,
+	instantiationTemplate,
+	perfMap,
 	script,
+	wasi,
 #endif
 };
 
@@ -27,13 +41,27 @@ static const char* getTestCommandListHelpText()
 #if WAVM_ENABLE_RUNTIME
 		   "  c-api         Test the C API\n"
 #endif
+		   "  benchharness  Test the benchmark harness's statistics and JSON files\n"
+		   "  chacha20      Test the ChaCha20 block function\n"
 		   "  dumpmodules   Dump WAST/WASM modules from WAST test scripts\n"
+		   "  fsbench       Benchmark host file system path resolution\n"
 		   "  hashmap       Test HashMap\n"
+		   "  hashmapbench  Benchmark HashMap with each hash table implementation\n"
 		   "  hashset       Test HashSet\n"
 		   "  i128          Test I128\n"
+		   "  indexmap      Test and benchmark IndexMap\n"
+		   "  instoffsets   Test InstructionOffsetTable\n"
+		   "  lexertables   Test the precomputed lexer tables\n"
+		   "  metrics       Test the metrics registry\n"
+		   "  validate      Test parallel validation of function code\n"
+		   "  vfs           Test the memory, overlay, and image file systems\n"
+		   "  wastparse     Test parsing WAST modules with many functions\n"
 #if WAVM_ENABLE_RUNTIME
 		   "  benchmark     Benchmark WAVM\n"
+		   "  insttemplate  Test instantiating modules from an instantiation template\n"
+		   "  perfmap       Test the perf map and jitdump output for JIT code\n"
 		   "  script        Run WAST test scripts\n"
+		   "  wasi          Test WASI syscalls that run concurrently\n"
 #endif
 		;
 }
@@ -49,11 +77,27 @@ void showTestHelp(Log::Category outputCategory)
 
 static TestCommand parseTestCommand(const char* string)
 {
-	if(!strcmp(string, "dumpmodules")) { return TestCommand::dumpModules; }
+	if(!strcmp(string, "benchharness")) { return TestCommand::benchHarness; }
+	else if(!strcmp(string, "chacha20"))
+	{
+		return TestCommand::chaCha20;
+	}
+	else if(!strcmp(string, "dumpmodules"))
+	{
+		return TestCommand::dumpModules;
+	}
+	else if(!strcmp(string, "fsbench"))
+	{
+		return TestCommand::fsBench;
+	}
 	else if(!strcmp(string, "hashmap"))
 	{
 		return TestCommand::hashMap;
 	}
+	else if(!strcmp(string, "hashmapbench"))
+	{
+		return TestCommand::hashMapBench;
+	}
 	else if(!strcmp(string, "hashset"))
 	{
 		return TestCommand::hashSet;
@@ -62,6 +106,34 @@ static TestCommand parseTestCommand(const char* string)
 	{
 		return TestCommand::i128;
 	}
+	else if(!strcmp(string, "indexmap"))
+	{
+		return TestCommand::indexMap;
+	}
+	else if(!strcmp(string, "instoffsets"))
+	{
+		return TestCommand::instructionOffsetTable;
+	}
+	else if(!strcmp(string, "lexertables"))
+	{
+		return TestCommand::lexerTables;
+	}
+	else if(!strcmp(string, "metrics"))
+	{
+		return TestCommand::metrics;
+	}
+	else if(!strcmp(string, "validate"))
+	{
+		return TestCommand::validate;
+	}
+	else if(!strcmp(string, "vfs"))
+	{
+		return TestCommand::vfs;
+	}
+	else if(!strcmp(string, "wastparse"))
+	{
+		return TestCommand::wastParse;
+	}
 #if WAVM_ENABLE_RUNTIME
 	else if(!strcmp(string, "c-api"))
 	{
@@ -71,10 +143,22 @@ static TestCommand parseTestCommand(const char* string)
 	{
 		return TestCommand::benchmark;
 	}
+	else if(!strcmp(string, "insttemplate"))
+	{
+		return TestCommand::instantiationTemplate;
+	}
+	else if(!strcmp(string, "perfmap"))
+	{
+		return TestCommand::perfMap;
+	}
 	else if(!strcmp(string, "script"))
 	{
 		return TestCommand::script;
 	}
+	else if(!strcmp(string, "wasi"))
+	{
+		return TestCommand::wasi;
+	}
 #endif
 	else
 	{
@@ -94,14 +178,30 @@ int execTestCommand(int argc, char** argv)
 		const TestCommand command = parseTestCommand(argv[0]);
 		switch(command)
 		{
+		case TestCommand::benchHarness: return execBenchmarkHarnessTest(argc - 1, argv + 1);
+		case TestCommand::chaCha20: return execChaCha20Test(argc - 1, argv + 1);
 		case TestCommand::dumpModules: return execDumpTestModules(argc - 1, argv + 1);
+		case TestCommand::fsBench: return execFileSystemBenchmark(argc - 1, argv + 1);
 		case TestCommand::hashMap: return execHashMapTest(argc - 1, argv + 1);
+		case TestCommand::hashMapBench: return execHashMapBenchmark(argc - 1, argv + 1);
 		case TestCommand::hashSet: return execHashSetTest(argc - 1, argv + 1);
 		case TestCommand::i128: return execI128Test(argc - 1, argv + 1);
+		case TestCommand::indexMap: return execIndexMapTest(argc - 1, argv + 1);
+		case TestCommand::instructionOffsetTable:
+			return execInstructionOffsetTableTest(argc - 1, argv + 1);
+		case TestCommand::lexerTables: return execLexerTablesTest(argc - 1, argv + 1);
+		case TestCommand::metrics: return execMetricsTest(argc - 1, argv + 1);
+		case TestCommand::validate: return execValidateTest(argc - 1, argv + 1);
+		case TestCommand::vfs: return execVFSTest(argc - 1, argv + 1);
+		case TestCommand::wastParse: return execWASTParseTest(argc - 1, argv + 1);
 #if WAVM_ENABLE_RUNTIME
 		case TestCommand::cAPI: return execCAPITest(argc - 1, argv + 1);
 		case TestCommand::benchmark: return execBenchmark(argc - 1, argv + 1);
+		case TestCommand::instantiationTemplate:
+			return execInstantiationTemplateTest(argc - 1, argv + 1);
+		case TestCommand::perfMap: return execPerfMapTest(argc - 1, argv + 1);
 		case TestCommand::script: return execRunTestScript(argc - 1, argv + 1);
+		case TestCommand::wasi: return execWASITest(argc - 1, argv + 1);
 #endif
 
 		case TestCommand::invalid:
@@ -2,14 +2,28 @@
 
 #include "WAVM/Inline/Config.h"
 
+int execBenchmarkHarnessTest(int argc, char** argv);
+int execChaCha20Test(int argc, char** argv);
 int execDumpTestModules(int argc, char** argv);
+int execFileSystemBenchmark(int argc, char** argv);
+int execHashMapBenchmark(int argc, char** argv);
 int execHashMapTest(int argc, char** argv);
 int execHashSetTest(int argc, char** argv);
 int execI128Test(int argc, char** argv);
+int execIndexMapTest(int argc, char** argv);
+int execInstructionOffsetTableTest(int argc, char** argv);
+int execLexerTablesTest(int argc, char** argv);
+int execMetricsTest(int argc, char** argv);
+int execValidateTest(int argc, char** argv);
+int execVFSTest(int argc, char** argv);
+int execWASTParseTest(int argc, char** argv);
 
 #if WAVM_ENABLE_RUNTIME
 int execBenchmark(int argc, char** argv);
+int execInstantiationTemplateTest(int argc, char** argv);
+int execPerfMapTest(int argc, char** argv);
 int execRunTestScript(int argc, char** argv);
+int execWASITest(int argc, char** argv);
 
 #ifdef __cplusplus
 extern "C"
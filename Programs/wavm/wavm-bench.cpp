@@ -0,0 +1,187 @@
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Testing/BenchmarkHarness.h"
+#include "WAVM/IR/FeatureSpec.h"
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/CLI.h"
+#include "WAVM/Logging/Logging.h"
+#include "wavm.h"
+
+using namespace WAVM;
+
+void showBenchHelp(Log::Category outputCategory)
+{
+	Log::printf(outputCategory,
+				"Usage: wavm bench [options] <in.wast> [in.wast...]\n"
+				"  --enable <feature>     Enable the specified feature. See the list of\n"
+				"                         supported features below.\n"
+				"  --warmup-ms=<ms>       Run each benchmark for <ms> before sampling it\n"
+				"                         (default: 100)\n"
+				"  --time-ms=<ms>         Sample each benchmark for <ms> (default: 1000)\n"
+				"  --no-pin               Don't pin the benchmark thread to a CPU\n"
+				"  --no-counters          Don't count hardware events\n"
+				"  --output=<file>        Write the results to <file> as JSON\n"
+				"  --baseline=<file>      Compare the results to a JSON file written by\n"
+				"                         --output, and fail if any benchmark regressed\n"
+				"  --threshold=<percent>  The change in the median time that is considered a\n"
+				"                         regression (default: 5)\n"
+				"\n"
+				"Runs the benchmark commands in WAST scripts. Each benchmark is warmed up, then\n"
+				"sampled for a fixed time, and its median, 99th percentile, and a confidence\n"
+				"interval for the median are reported.\n"
+				"\n"
+				"Features:\n"
+				"%s"
+				"\n",
+				getFeatureListHelpText().c_str());
+}
+
+static bool parsePositiveNumber(const char* arg, const char* prefix, F64& outNumber)
+{
+	const char* numberString = arg + strlen(prefix);
+	char* numberEnd = nullptr;
+	outNumber = strtod(numberString, &numberEnd);
+	if(!*numberString || *numberEnd || !(outNumber > 0.0))
+	{
+		Log::printf(Log::error, "Invalid number following '%s': %s\n", prefix, numberString);
+		return false;
+	}
+	return true;
+}
+
+int execBenchCommand(int argc, char** argv)
+{
+	IR::FeatureSpec featureSpec;
+	BenchmarkConfig config;
+	const char* outputPath = nullptr;
+	const char* baselinePath = nullptr;
+	F64 thresholdPercent = 5.0;
+	std::vector<const char*> filenames;
+	for(int argIndex = 0; argIndex < argc; ++argIndex)
+	{
+		const char* arg = argv[argIndex];
+		F64 milliseconds;
+		if(!strcmp(arg, "--enable"))
+		{
+			++argIndex;
+			if(argIndex >= argc)
+			{
+				Log::printf(Log::error, "Expected feature name following '--enable'.\n");
+				return EXIT_FAILURE;
+			}
+
+			if(!parseAndSetFeature(argv[argIndex], featureSpec, true))
+			{
+				Log::printf(Log::error,
+							"Unknown feature '%s'. Supported features:\n"
+							"%s"
+							"\n",
+							argv[argIndex],
+							getFeatureListHelpText().c_str());
+				return EXIT_FAILURE;
+			}
+		}
+		else if(!strncmp(arg, "--warmup-ms=", strlen("--warmup-ms=")))
+		{
+			if(!parsePositiveNumber(arg, "--warmup-ms=", milliseconds)) { return EXIT_FAILURE; }
+			config.warmupNS = milliseconds * 1000000.0;
+		}
+		else if(!strncmp(arg, "--time-ms=", strlen("--time-ms=")))
+		{
+			if(!parsePositiveNumber(arg, "--time-ms=", milliseconds)) { return EXIT_FAILURE; }
+			config.samplingNS = milliseconds * 1000000.0;
+		}
+		else if(!strcmp(arg, "--no-pin"))
+		{
+			config.pinCPU = false;
+		}
+		else if(!strcmp(arg, "--no-counters"))
+		{
+			config.countHardwareEvents = false;
+		}
+		else if(!strncmp(arg, "--output=", strlen("--output=")))
+		{
+			outputPath = arg + strlen("--output=");
+		}
+		else if(!strncmp(arg, "--baseline=", strlen("--baseline=")))
+		{
+			baselinePath = arg + strlen("--baseline=");
+		}
+		else if(!strncmp(arg, "--threshold=", strlen("--threshold=")))
+		{
+			if(!parsePositiveNumber(arg, "--threshold=", thresholdPercent)) { return EXIT_FAILURE; }
+		}
+		else if(arg[0] != '-')
+		{
+			filenames.push_back(arg);
+		}
+		else
+		{
+			Log::printf(Log::error, "Unknown command-line argument: '%s'\n", arg);
+			showBenchHelp(Log::error);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if(!filenames.size())
+	{
+		showBenchHelp(Log::error);
+		return EXIT_FAILURE;
+	}
+
+	// Read the baseline before running the benchmarks, so an invalid baseline fails quickly.
+	std::vector<BenchmarkResult> baselineResults;
+	if(baselinePath)
+	{
+		std::vector<U8> baselineBytes;
+		if(!loadFile(baselinePath, baselineBytes)) { return EXIT_FAILURE; }
+		baselineBytes.push_back(0);
+		if(!parseBenchmarkResultsJSON((const char*)baselineBytes.data(), baselineResults))
+		{
+			Log::printf(Log::error, "Couldn't parse benchmark baseline '%s'.\n", baselinePath);
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Run the benchmarks.
+	std::vector<BenchmarkResult> results;
+	if(!runBenchmarkScripts(filenames, featureSpec, config, results)) { return EXIT_FAILURE; }
+
+	if(outputPath)
+	{
+		const std::string json = benchmarkResultsToJSON(results);
+		if(!saveFile(outputPath, json.data(), json.size())) { return EXIT_FAILURE; }
+	}
+
+	// Compare the results to the baseline.
+	if(baselinePath)
+	{
+		std::vector<BenchmarkComparison> comparisons;
+		const Uptr numRegressions = compareBenchmarkResults(
+			baselineResults, results, thresholdPercent / 100.0, comparisons);
+		for(const BenchmarkComparison& comparison : comparisons)
+		{
+			Log::printf(comparison.isRegression ? Log::error : Log::output,
+						"%s: %.1fns -> %.1fns (%+.1f%%)%s\n",
+						comparison.name.c_str(),
+						comparison.baselineMedianNS,
+						comparison.medianNS,
+						comparison.relativeChange * 100.0,
+						comparison.isRegression ? " REGRESSION"
+												: comparison.isImprovement ? " improvement" : "");
+		}
+
+		if(numRegressions)
+		{
+			Log::printf(Log::error,
+						"%" WAVM_PRIuPTR " benchmark(s) regressed by more than %.1f%%\n",
+						numRegressions,
+						thresholdPercent);
+			return EXIT_FAILURE;
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
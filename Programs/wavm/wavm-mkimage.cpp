@@ -0,0 +1,58 @@
+#include <stdlib.h>
+#include "WAVM/Inline/BasicTypes.h"
+#include "WAVM/Inline/Timing.h"
+#include "WAVM/Logging/Logging.h"
+#include "WAVM/Platform/File.h"
+#include "WAVM/VFS/ImageFS.h"
+#include "WAVM/VFS/VFS.h"
+#include "wavm.h"
+
+using namespace WAVM;
+
+void showMakeImageHelp(Log::Category outputCategory)
+{
+	Log::printf(outputCategory,
+				"Usage: wavm mkimage <directory> <image file>\n"
+				"  Packs the files and directories in <directory> into a read-only image that\n"
+				"  can be mounted with 'wavm run --mount-image'.\n");
+}
+
+int execMakeImageCommand(int argc, char** argv)
+{
+	if(argc != 2)
+	{
+		showMakeImageHelp(Log::error);
+		return EXIT_FAILURE;
+	}
+	const char* sourcePath = argv[0];
+	const char* imagePath = argv[1];
+
+	VFS::FileSystem& hostFS = Platform::getHostFS();
+	VFS::VFD* imageFD = nullptr;
+	VFS::Result result = hostFS.open(
+		imagePath, VFS::FileAccessMode::writeOnly, VFS::FileCreateMode::createAlways, imageFD);
+	if(result != VFS::Result::success)
+	{
+		Log::printf(
+			Log::error, "Couldn't create '%s': %s\n", imagePath, VFS::describeResult(result));
+		return EXIT_FAILURE;
+	}
+
+	Timing::Timer timer;
+	result = VFS::writeImage(&hostFS, sourcePath, imageFD);
+	const VFS::Result closeResult = imageFD->close();
+	if(result == VFS::Result::success) { result = closeResult; }
+	if(result != VFS::Result::success)
+	{
+		Log::printf(Log::error,
+					"Couldn't write an image of '%s' to '%s': %s\n",
+					sourcePath,
+					imagePath,
+					VFS::describeResult(result));
+		hostFS.unlinkFile(imagePath);
+		return EXIT_FAILURE;
+	}
+	Timing::logTimer("Wrote image", timer);
+
+	return EXIT_SUCCESS;
+}
@@ -1,6 +1,7 @@
 #include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -22,12 +23,20 @@
 #include "WAVM/Inline/Version.h"
 #include "WAVM/LLVMJIT/LLVMJIT.h"
 #include "WAVM/Logging/Logging.h"
+#include "WAVM/Metrics/Metrics.h"
 #include "WAVM/ObjectCache/ObjectCache.h"
 #include "WAVM/Platform/File.h"
+#include "WAVM/Platform/Event.h"
 #include "WAVM/Platform/Memory.h"
+#include "WAVM/Platform/Mutex.h"
+#include "WAVM/Platform/Sampling.h"
+#include "WAVM/Platform/Thread.h"
 #include "WAVM/Runtime/Linker.h"
 #include "WAVM/Runtime/Runtime.h"
-#include "WAVM/VFS/SandboxFS.h"
+#include "WAVM/VFS/BufferedStdio.h"
+#include "WAVM/VFS/ImageFS.h"
+#include "WAVM/VFS/OverlayFS.h"
+#include "WAVM/VFS/VFS.h"
 #include "WAVM/WASI/WASI.h"
 #include "WAVM/WASM/WASM.h"
 #include "WAVM/WASTParse/WASTParse.h"
@@ -187,9 +196,29 @@ void showRunHelp(Log::Category outputCategory)
 				"                        of supported ABIs below. The default is to detect the\n"
 				"                        ABI based on the module imports/exports.\n"
 				"  --mount-root <dir>    Mounts <dir> as the WASI root directory\n"
+				"  --mount-image <file>  Mounts an image built by 'wavm mkimage' as the WASI root\n"
+				"                        directory. If --mount-root is also specified, <dir> is\n"
+				"                        layered over the image, and receives any writes.\n"
 				"  --wasi-trace=<level>  Sets the level of WASI tracing:\n"
 				"                        - syscalls\n"
 				"                        - syscalls-with-callstacks\n"
+				"  --wasi-coarse-clocks  Use cheaper, lower resolution clocks for WASI's realtime\n"
+				"                        and monotonic clocks\n"
+				"  --buffered-stdio[=<bytes>]\n"
+				"                        Buffer the WASI or Emscripten process's writes to stdout\n"
+				"                        and stderr when they are terminals or pipes, in a buffer\n"
+				"                        of <bytes> (default: 65536)\n"
+				"  --perf-map            Write /tmp/perf-<pid>.map so Linux perf can name JIT\n"
+				"                        compiled functions\n"
+				"  --perf-jitdump        Write /tmp/jit-<pid>.dump with the code and WebAssembly\n"
+				"                        operator indices of JIT compiled functions, for use with\n"
+				"                        'perf record -k mono' and 'perf inject --jit'\n"
+				"  --profile=<file>      Sample the program's call stacks, and write the number\n"
+				"                        of samples of each call stack to <file> in the\n"
+				"                        collapsed stack format used by flame graph tools\n"
+				"  --metrics=<file>      Record metrics of loading, compilation, instantiation,\n"
+				"                        memory growth, traps, and WASI syscalls, and write\n"
+				"                        them to <file> in the Prometheus text format\n"
 				"\n"
 				"ABIs:\n"
 				"%s"
@@ -218,6 +247,137 @@ static std::string getFilenameAndExtension(const char* path)
 	return std::string(filenameBegin);
 }
 
+// Samples the call stacks of the threads running the program, and writes the number of times each
+// call stack was sampled to a file in the collapsed stack format used by flame graph tools.
+struct Profiler
+{
+	Profiler(const char* inOutputPath) : outputPath(inOutputPath) {}
+	~Profiler()
+	{
+		if(readerThread) { stopReaderThread(); }
+	}
+
+	bool start()
+	{
+		// Start the thread that reads the samples before sampling is started, so it isn't sampled.
+		readerThread = Platform::createThread(0, readerThreadEntry, this);
+		if(!Platform::startSampling(samplingInterval))
+		{
+			Log::printf(Log::error, "Sampling isn't supported on this platform.\n");
+			stopReaderThread();
+			return false;
+		}
+		Platform::startSamplingCurrentThread();
+		return true;
+	}
+
+	// Stops sampling and writes the profile. This must be called before the program's code is
+	// unloaded, since the samples are symbolized as they are read.
+	bool stop()
+	{
+		Platform::stopSamplingCurrentThread();
+		Platform::stopSampling();
+		stopReaderThread();
+
+		Platform::Mutex::Lock lock(mutex);
+		readSamples();
+
+		if(numDroppedSamples)
+		{
+			Log::printf(Log::metrics,
+						"Profiler dropped %" WAVM_PRIuPTR " samples\n",
+						numDroppedSamples);
+		}
+
+		std::string collapsedStacks;
+		for(const auto& pair : stackCounts)
+		{
+			collapsedStacks += pair.key;
+			collapsedStacks += ' ';
+			collapsedStacks += std::to_string(pair.value);
+			collapsedStacks += '\n';
+		}
+		return saveFile(outputPath, collapsedStacks.data(), collapsedStacks.size());
+	}
+
+private:
+	const char* outputPath;
+	const Time samplingInterval{1000000};
+
+	Platform::Thread* readerThread = nullptr;
+	Platform::Event stopEvent;
+	std::atomic<bool> isStopping{false};
+
+	Platform::Mutex mutex;
+	HashMap<Uptr, std::string> ipNames;
+	HashMap<std::string, Uptr> stackCounts;
+	Uptr numDroppedSamples = 0;
+
+	void stopReaderThread()
+	{
+		isStopping.store(true);
+		stopEvent.signal();
+		Platform::joinThread(readerThread);
+		readerThread = nullptr;
+	}
+
+	// Periodically reads the samples, so the threads' sample buffers don't fill up.
+	static I64 readerThreadEntry(void* profilerVoid)
+	{
+		Profiler* profiler = (Profiler*)profilerVoid;
+		while(!profiler->isStopping.load())
+		{
+			profiler->stopEvent.wait(Time{100000000});
+
+			Platform::Mutex::Lock lock(profiler->mutex);
+			profiler->readSamples();
+		}
+		return 0;
+	}
+
+	// Returns the name of the function containing an IP. Names don't include the offset within the
+	// function, so samples at different points in a function are aggregated.
+	const std::string& getIPName(Uptr ip)
+	{
+		if(const std::string* name = ipNames.get(ip)) { return *name; }
+
+		std::string name = "<unknown>";
+		InstructionSource source;
+		if(getInstructionSourceByAddress(ip, source))
+		{
+			name = asString(source);
+			const Uptr offsetBegin = name.rfind('+');
+			if(offsetBegin != std::string::npos) { name.resize(offsetBegin); }
+		}
+		return ipNames.getOrAdd(ip, std::move(name));
+	}
+
+	void readSamples()
+	{
+		WAVM_ASSERT_MUTEX_IS_LOCKED_BY_CURRENT_THREAD(mutex);
+		numDroppedSamples += Platform::readSamples([this](const Platform::CallStack& callStack) {
+			// The collapsed stack format lists the frames from the root to the leaf, separated by
+			// semicolons. The leaf frame is described with its WebAssembly operator index.
+			std::string stack;
+			for(Uptr frameIndex = callStack.frames.size(); frameIndex > 1; --frameIndex)
+			{
+				stack += getIPName(callStack.frames[frameIndex - 1].ip);
+				stack += ';';
+			}
+			InstructionSource leafSource;
+			if(callStack.frames.size()
+			   && getInstructionSourceByAddress(callStack.frames[0].ip, leafSource)
+			   && leafSource.type == InstructionSource::Type::wasm)
+			{ stack += asString(leafSource); }
+			else if(callStack.frames.size())
+			{
+				stack += getIPName(callStack.frames[0].ip);
+			}
+			++stackCounts.getOrAdd(stack, 0);
+		});
+	}
+};
+
 enum class ABI
 {
 	detect,
@@ -234,22 +394,32 @@ struct State
 	const char* filename = nullptr;
 	const char* functionName = nullptr;
 	const char* rootMountPath = nullptr;
+	const char* imageMountPath = nullptr;
 	std::vector<std::string> runArgs;
 	ABI abi = ABI::detect;
 	bool precompiled = false;
 	bool allowCaching = true;
 	WASI::SyscallTraceLevel wasiTraceLavel = WASI::SyscallTraceLevel::none;
+	bool wasiCoarseClocks = false;
+	Uptr numStdioBufferBytes = 0;
+	LLVMJIT::PerfMapMode perfMapMode = LLVMJIT::PerfMapMode::none;
+	const char* profilePath = nullptr;
+	const char* metricsPath = nullptr;
 
 	// Objects that need to be cleaned up before exiting.
 	GCPointer<Compartment> compartment = createCompartment();
 	std::shared_ptr<Emscripten::Process> emscriptenProcess;
 	std::shared_ptr<WASI::Process> wasiProcess;
 	std::shared_ptr<VFS::FileSystem> sandboxFS;
+	std::shared_ptr<VFS::FileSystem> imageFS;
+	std::shared_ptr<VFS::FileSystem> rootFS;
+	std::shared_ptr<VFS::BufferedStdio> bufferedStdio;
 
 	~State()
 	{
 		emscriptenProcess.reset();
 		wasiProcess.reset();
+		bufferedStdio.reset();
 
 		WAVM_ERROR_UNLESS(tryCollectCompartment(std::move(compartment)));
 	}
@@ -345,6 +515,24 @@ struct State
 
 				rootMountPath = *nextArg;
 			}
+			else if(!strcmp(*nextArg, "--mount-image"))
+			{
+				if(imageMountPath)
+				{
+					Log::printf(Log::error,
+								"'--mount-image' may only occur once on the command line.\n");
+					return false;
+				}
+
+				++nextArg;
+				if(!*nextArg)
+				{
+					Log::printf(Log::error, "Expected path following '--mount-image'.\n");
+					return false;
+				}
+
+				imageMountPath = *nextArg;
+			}
 			else if(stringStartsWith(*nextArg, "--wasi-trace="))
 			{
 				if(wasiTraceLavel != WASI::SyscallTraceLevel::none)
@@ -368,6 +556,51 @@ struct State
 					return false;
 				}
 			}
+			else if(!strcmp(*nextArg, "--wasi-coarse-clocks"))
+			{
+				wasiCoarseClocks = true;
+			}
+			else if(!strcmp(*nextArg, "--buffered-stdio"))
+			{
+				numStdioBufferBytes = 65536;
+			}
+			else if(stringStartsWith(*nextArg, "--buffered-stdio="))
+			{
+				const char* numBytesString = *nextArg + strlen("--buffered-stdio=");
+				char* numBytesEnd = nullptr;
+				numStdioBufferBytes = Uptr(strtoull(numBytesString, &numBytesEnd, 10));
+				if(!*numBytesString || *numBytesEnd || !numStdioBufferBytes)
+				{
+					Log::printf(Log::error, "Invalid stdio buffer size: %s\n", numBytesString);
+					return false;
+				}
+			}
+			else if(!strcmp(*nextArg, "--perf-map"))
+			{
+				perfMapMode = LLVMJIT::PerfMapMode::map;
+			}
+			else if(!strcmp(*nextArg, "--perf-jitdump"))
+			{
+				perfMapMode = LLVMJIT::PerfMapMode::jitdump;
+			}
+			else if(stringStartsWith(*nextArg, "--profile="))
+			{
+				profilePath = *nextArg + strlen("--profile=");
+				if(!*profilePath)
+				{
+					Log::printf(Log::error, "Expected path following '--profile='.\n");
+					return false;
+				}
+			}
+			else if(stringStartsWith(*nextArg, "--metrics="))
+			{
+				metricsPath = *nextArg + strlen("--metrics=");
+				if(!*metricsPath)
+				{
+					Log::printf(Log::error, "Expected path following '--metrics='.\n");
+					return false;
+				}
+			}
 			else if((*nextArg)[0] != '-')
 			{
 				filename = *nextArg;
@@ -392,6 +625,13 @@ struct State
 
 		while(*nextArg) { runArgs.push_back(*nextArg++); };
 
+		// Enable the perf map before any code is loaded, so it includes the intrinsic thunks.
+		if(perfMapMode != LLVMJIT::PerfMapMode::none && !LLVMJIT::setPerfMapMode(perfMapMode))
+		{ return false; }
+
+		// Enable metrics before any code is compiled, so they include the compilation.
+		if(metricsPath) { Metrics::setEnabled(true); }
+
 		// Check that the requested features are supported by the host CPU.
 		switch(LLVMJIT::validateTarget(LLVMJIT::getHostTargetSpec(), featureSpec))
 		{
@@ -568,7 +808,53 @@ struct State
 				absoluteRootMountPath
 					= Platform::getCurrentWorkingDirectory() + '/' + rootMountPath;
 			}
-			sandboxFS = VFS::makeSandboxFS(&Platform::getHostFS(), absoluteRootMountPath);
+			sandboxFS = Platform::makeHostSandboxFS(absoluteRootMountPath);
+			if(!sandboxFS)
+			{
+				Log::printf(Log::error,
+							"Couldn't open root mount directory '%s'.\n",
+							absoluteRootMountPath.c_str());
+				return false;
+			}
+			rootFS = sandboxFS;
+		}
+
+		// If an image to mount as the root filesystem was passed on the command-line, map it. If
+		// a root directory was also passed, layer the directory over the image.
+		if(imageMountPath)
+		{
+			if(abi != ABI::wasi)
+			{
+				Log::printf(Log::error, "--mount-image may only be used with the WASI ABI.\n");
+				return false;
+			}
+
+			imageFS = VFS::makeImageFS(Platform::mapFile(imageMountPath));
+			if(!imageFS)
+			{
+				Log::printf(Log::error, "Couldn't load image '%s'.\n", imageMountPath);
+				return false;
+			}
+			rootFS = sandboxFS ? VFS::makeOverlayFS(imageFS.get(), sandboxFS.get()) : imageFS;
+		}
+
+		// If buffered stdio was requested, wrap the host's stdio VFDs.
+		VFS::VFD* stdIn = Platform::getStdFD(Platform::StdDevice::in);
+		VFS::VFD* stdOut = Platform::getStdFD(Platform::StdDevice::out);
+		VFS::VFD* stdErr = Platform::getStdFD(Platform::StdDevice::err);
+		if(numStdioBufferBytes)
+		{
+			if(abi != ABI::wasi && abi != ABI::emscripten)
+			{
+				Log::printf(Log::error,
+							"--buffered-stdio may only be used with the WASI or Emscripten ABI.\n");
+				return false;
+			}
+
+			bufferedStdio = VFS::makeBufferedStdio(stdIn, stdOut, stdErr, numStdioBufferBytes);
+			stdIn = bufferedStdio->getStdIn();
+			stdOut = bufferedStdio->getStdOut();
+			stdErr = bufferedStdio->getStdErr();
 		}
 
 		if(abi == ABI::emscripten)
@@ -577,13 +863,8 @@ struct State
 			args.insert(args.begin(), getFilenameAndExtension(filename));
 
 			// Instantiate the Emscripten environment.
-			emscriptenProcess
-				= Emscripten::createProcess(compartment,
-											std::move(args),
-											{},
-											Platform::getStdFD(Platform::StdDevice::in),
-											Platform::getStdFD(Platform::StdDevice::out),
-											Platform::getStdFD(Platform::StdDevice::err));
+			emscriptenProcess = Emscripten::createProcess(
+				compartment, std::move(args), {}, stdIn, stdOut, stdErr);
 		}
 		else if(abi == ABI::wasi)
 		{
@@ -591,13 +872,8 @@ struct State
 			args.insert(args.begin(), getFilenameAndExtension(filename));
 
 			// Create the WASI process.
-			wasiProcess = WASI::createProcess(compartment,
-											  std::move(args),
-											  {},
-											  sandboxFS.get(),
-											  Platform::getStdFD(Platform::StdDevice::in),
-											  Platform::getStdFD(Platform::StdDevice::out),
-											  Platform::getStdFD(Platform::StdDevice::err));
+			wasiProcess = WASI::createProcess(
+				compartment, std::move(args), {}, rootFS.get(), stdIn, stdOut, stdErr);
 		}
 		else if(abi == ABI::bare)
 		{
@@ -623,6 +899,18 @@ struct State
 			WASI::setSyscallTraceLevel(wasiTraceLavel);
 		}
 
+		if(wasiCoarseClocks)
+		{
+			if(abi != ABI::wasi)
+			{
+				Log::printf(Log::error,
+							"--wasi-coarse-clocks may only be used with the WASI ABI.\n");
+				return false;
+			}
+
+			WASI::setProcessUsesCoarseClocks(*wasiProcess, true);
+		}
+
 		return true;
 	}
 
@@ -818,6 +1106,14 @@ struct State
 			WASI::setProcessMemory(*wasiProcess, memory);
 		}
 
+		// Start the profiler.
+		std::unique_ptr<Profiler> profiler;
+		if(profilePath)
+		{
+			profiler = std::make_unique<Profiler>(profilePath);
+			if(!profiler->start()) { return EXIT_FAILURE; }
+		}
+
 		// Execute the program.
 		Timing::Timer executionTimer;
 		auto executeThunk = [&] { return execute(irModule, instance); };
@@ -833,6 +1129,17 @@ struct State
 		}
 		Timing::logTimer("Executed program", executionTimer);
 
+		// Write the profile while the program's code is still loaded to symbolize the samples.
+		if(profiler && !profiler->stop()) { return EXIT_FAILURE; }
+
+		// Write the metrics.
+		if(metricsPath)
+		{
+			const std::string metricsText = Metrics::formatPrometheusText(Metrics::getSnapshot());
+			if(!saveFile(metricsPath, metricsText.data(), metricsText.size()))
+			{ return EXIT_FAILURE; }
+		}
+
 		// Log the peak memory usage.
 		Uptr peakMemoryUsage = Platform::getPeakMemoryUsageBytes();
 		Log::printf(
@@ -844,12 +1151,15 @@ struct State
 	int runAndCatchRuntimeExceptions(char** argv)
 	{
 		int result = EXIT_FAILURE;
-		Runtime::catchRuntimeExceptions([&result, argv, this]() { result = run(argv); },
-										[](Runtime::Exception* exception) {
-											// Treat any unhandled exception as a fatal error.
-											Errors::fatalf("Runtime exception: %s",
-														   describeException(exception).c_str());
-										});
+		Runtime::catchRuntimeExceptions(
+			[&result, argv, this]() { result = run(argv); },
+			[this](Runtime::Exception* exception) {
+				// Write any buffered output before the error message.
+				if(bufferedStdio) { bufferedStdio->flush(); }
+
+				// Treat any unhandled exception as a fatal error.
+				Errors::fatalf("Runtime exception: %s", describeException(exception).c_str());
+			});
 		return result;
 	}
 };
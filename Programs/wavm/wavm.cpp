@@ -17,10 +17,12 @@ enum class Command
 	assemble,
 	disassemble,
 	help,
+	mkimage,
 	test,
 	version,
 
 #if WAVM_ENABLE_RUNTIME
+	bench,
 	compile,
 	run,
 #endif
@@ -37,6 +39,10 @@ static Command parseCommand(const char* string)
 	{
 		return Command::help;
 	}
+	else if(!strcmp(string, "mkimage"))
+	{
+		return Command::mkimage;
+	}
 	else if(!strcmp(string, "test"))
 	{
 		return Command::test;
@@ -46,6 +52,10 @@ static Command parseCommand(const char* string)
 		return Command::version;
 	}
 #if WAVM_ENABLE_RUNTIME
+	else if(!strcmp(string, "bench"))
+	{
+		return Command::bench;
+	}
 	else if(!strcmp(string, "compile"))
 	{
 		return Command::compile;
@@ -65,11 +75,15 @@ static const char* getCommandListHelpText()
 {
 	return "Commands:\n"
 		   "  assemble     Assemble WAST/WAT to WASM\n"
+#if WAVM_ENABLE_RUNTIME
+		   "  bench        Run benchmarks in WAST scripts, and compare them to a baseline\n"
+#endif
 		   "  disassemble  Disassemble WASM to WAST/WAT\n"
 #if WAVM_ENABLE_RUNTIME
 		   "  compile      Compile a WebAssembly module\n"
 #endif
 		   "  help         Display help about command-line usage of WAVM\n"
+		   "  mkimage      Build a read-only file system image from a directory\n"
 #if WAVM_ENABLE_RUNTIME
 		   "  run          Run a WebAssembly program\n"
 #endif
@@ -183,9 +197,11 @@ static int execHelpCommand(int argc, char** argv)
 		case Command::assemble: showAssembleHelp(Log::output); return EXIT_SUCCESS;
 		case Command::disassemble: showDisassembleHelp(Log::output); return EXIT_SUCCESS;
 		case Command::help: showHelpHelp(Log::output); return EXIT_SUCCESS;
+		case Command::mkimage: showMakeImageHelp(Log::output); return EXIT_SUCCESS;
 		case Command::test: showTestHelp(Log::output); return EXIT_SUCCESS;
 		case Command::version: showVersionHelp(Log::output); return EXIT_SUCCESS;
 #if WAVM_ENABLE_RUNTIME
+		case Command::bench: showBenchHelp(Log::output); return EXIT_SUCCESS;
 		case Command::compile: showCompileHelp(Log::output); return EXIT_SUCCESS;
 		case Command::run: showRunHelp(Log::output); return EXIT_SUCCESS;
 #endif
@@ -252,9 +268,11 @@ int main(int argc, char** argv)
 		case Command::assemble: return execAssembleCommand(argc - 2, argv + 2);
 		case Command::disassemble: return execDisassembleCommand(argc - 2, argv + 2);
 		case Command::help: return execHelpCommand(argc - 2, argv + 2);
+		case Command::mkimage: return execMakeImageCommand(argc - 2, argv + 2);
 		case Command::test: return execTestCommand(argc - 2, argv + 2);
 		case Command::version: return execVersionCommand(argc - 2, argv + 2);
 #if WAVM_ENABLE_RUNTIME
+		case Command::bench: return execBenchCommand(argc - 2, argv + 2);
 		case Command::compile: return execCompileCommand(argc - 2, argv + 2);
 		case Command::run: return execRunCommand(argc - 2, argv + 2);
 #endif
@@ -10,18 +10,22 @@ namespace WAVM { namespace IR {
 
 int execAssembleCommand(int argc, char** argv);
 int execDisassembleCommand(int argc, char** argv);
+int execMakeImageCommand(int argc, char** argv);
 int execTestCommand(int argc, char** argv);
 int execVersionCommand(int argc, char** argv);
 
 void showAssembleHelp(WAVM::Log::Category outputCategory);
 void showDisassembleHelp(WAVM::Log::Category outputCategory);
+void showMakeImageHelp(WAVM::Log::Category outputCategory);
 void showTestHelp(WAVM::Log::Category outputCategory);
 void showVersionHelp(WAVM::Log::Category outputCategory);
 
 #if WAVM_ENABLE_RUNTIME
+int execBenchCommand(int argc, char** argv);
 int execCompileCommand(int argc, char** argv);
 int execRunCommand(int argc, char** argv);
 
+void showBenchHelp(WAVM::Log::Category outputCategory);
 void showCompileHelp(WAVM::Log::Category outputCategory);
 void showRunHelp(WAVM::Log::Category outputCategory);
 #endif
@@ -0,0 +1,207 @@
+;; A compression workload: a greedy LZ77 compressor and decompressor, and zlib's Adler-32 checksum,
+;; over 16KB of generated text with repeated phrases.
+(module
+  ;; 0x0000: the 16KB input
+  ;; 0x4000: the compressed data
+  ;; 0x8000: the compressor's hash table of 4096 positions
+  ;; 0xc000: the decompressed data
+  (memory 1)
+
+  (global $compressedSize (mut i32) (i32.const 0))
+
+  ;; Generate the input: each step either appends a random letter from a-p, or copies a run of
+  ;; 4-19 bytes from up to 1024 bytes back.
+  (func $init
+    (local $p i32)
+    (local $seed i32)
+    (local $random i32)
+    (local $length i32)
+    (local $distance i32)
+    (local.set $seed (i32.const 12345))
+    block $done
+      loop $loop
+        (br_if $done (i32.ge_u (local.get $p) (i32.const 0x4000)))
+        (local.set $seed (i32.add (i32.mul (local.get $seed) (i32.const 1103515245))
+                                  (i32.const 12345)))
+        (local.set $random (i32.shr_u (local.get $seed) (i32.const 16)))
+        (if (i32.and (i32.ne (local.get $p) (i32.const 0))
+                     (i32.and (local.get $random) (i32.const 1)))
+          (then
+            (local.set $length
+              (i32.add (i32.const 4) (i32.and (i32.shr_u (local.get $random) (i32.const 2))
+                                              (i32.const 15))))
+            (local.set $distance
+              (i32.add (i32.const 1) (i32.and (i32.shr_u (local.get $random) (i32.const 6))
+                                              (i32.const 1023))))
+            (if (i32.gt_u (local.get $distance) (local.get $p))
+              (then (local.set $distance (local.get $p))))
+            loop $copy_loop
+              (i32.store8 (local.get $p)
+                          (i32.load8_u (i32.sub (local.get $p) (local.get $distance))))
+              (local.set $p (i32.add (local.get $p) (i32.const 1)))
+              (local.set $length (i32.sub (local.get $length) (i32.const 1)))
+              (br_if $copy_loop (i32.and (i32.ne (local.get $length) (i32.const 0))
+                                         (i32.lt_u (local.get $p) (i32.const 0x4000))))
+            end)
+          (else
+            (i32.store8 (local.get $p)
+                        (i32.add (i32.const 97)
+                                 (i32.and (i32.shr_u (local.get $random) (i32.const 2))
+                                          (i32.const 15))))
+            (local.set $p (i32.add (local.get $p) (i32.const 1)))))
+        (br $loop)
+      end
+    end
+  )
+  (start $init)
+
+  ;; Compresses the input, and returns the compressed size. The input only contains bytes < 0x80,
+  ;; which are emitted as literals. A match of 3-129 bytes is emitted as 0x80 + length - 3,
+  ;; followed by the 16-bit distance back to the matching bytes.
+  (func (export "compress") (result i32)
+    (local $p i32)
+    (local $out i32)
+    (local $hash_address i32)
+    (local $candidate i32)
+    (local $length i32)
+    (local $max_length i32)
+    (memory.fill (i32.const 0x8000) (i32.const 0) (i32.const 0x4000))
+    (local.set $out (i32.const 0x4000))
+    block $done
+      loop $loop
+        (br_if $done (i32.gt_u (i32.add (local.get $p) (i32.const 3)) (i32.const 0x4000)))
+
+        ;; Look up the last position with the same 3 byte prefix, and replace it with this one.
+        (local.set $hash_address
+          (i32.add (i32.const 0x8000)
+                   (i32.shl (i32.shr_u (i32.mul (i32.and (i32.load (local.get $p))
+                                                         (i32.const 0xffffff))
+                                                (i32.const 0x9e3779b1))
+                                       (i32.const 20))
+                            (i32.const 2))))
+        (local.set $candidate (i32.load (local.get $hash_address)))
+        (i32.store (local.get $hash_address) (i32.add (local.get $p) (i32.const 1)))
+
+        ;; Measure the length of the match.
+        (local.set $length (i32.const 0))
+        (if (local.get $candidate)
+          (then
+            (local.set $candidate (i32.sub (local.get $candidate) (i32.const 1)))
+            (local.set $max_length (i32.sub (i32.const 0x4000) (local.get $p)))
+            (if (i32.gt_u (local.get $max_length) (i32.const 129))
+              (then (local.set $max_length (i32.const 129))))
+            block $match_end
+              loop $match_loop
+                (br_if $match_end (i32.ge_u (local.get $length) (local.get $max_length)))
+                (br_if $match_end
+                  (i32.ne (i32.load8_u (i32.add (local.get $candidate) (local.get $length)))
+                          (i32.load8_u (i32.add (local.get $p) (local.get $length)))))
+                (local.set $length (i32.add (local.get $length) (i32.const 1)))
+                (br $match_loop)
+              end
+            end))
+
+        (if (i32.ge_u (local.get $length) (i32.const 3))
+          (then
+            (i32.store8 (local.get $out) (i32.add (local.get $length) (i32.const 125)))
+            (i32.store16 offset=1 (local.get $out) (i32.sub (local.get $p) (local.get $candidate)))
+            (local.set $out (i32.add (local.get $out) (i32.const 3)))
+            (local.set $p (i32.add (local.get $p) (local.get $length))))
+          (else
+            (i32.store8 (local.get $out) (i32.load8_u (local.get $p)))
+            (local.set $out (i32.add (local.get $out) (i32.const 1)))
+            (local.set $p (i32.add (local.get $p) (i32.const 1)))))
+        (br $loop)
+      end
+    end
+
+    ;; Emit the last bytes as literals.
+    block $literals_end
+      loop $literal_loop
+        (br_if $literals_end (i32.ge_u (local.get $p) (i32.const 0x4000)))
+        (i32.store8 (local.get $out) (i32.load8_u (local.get $p)))
+        (local.set $out (i32.add (local.get $out) (i32.const 1)))
+        (local.set $p (i32.add (local.get $p) (i32.const 1)))
+        (br $literal_loop)
+      end
+    end
+
+    (global.set $compressedSize (i32.sub (local.get $out) (i32.const 0x4000)))
+    (global.get $compressedSize)
+  )
+
+  ;; Decompresses the output of the last call to "compress", and returns the decompressed size.
+  (func (export "decompress") (result i32)
+    (local $in i32)
+    (local $end i32)
+    (local $out i32)
+    (local $token i32)
+    (local $source i32)
+    (local $length i32)
+    (local.set $in (i32.const 0x4000))
+    (local.set $end (i32.add (i32.const 0x4000) (global.get $compressedSize)))
+    (local.set $out (i32.const 0xc000))
+    block $done
+      loop $loop
+        (br_if $done (i32.ge_u (local.get $in) (local.get $end)))
+        (local.set $token (i32.load8_u (local.get $in)))
+        (if (i32.lt_u (local.get $token) (i32.const 0x80))
+          (then
+            (i32.store8 (local.get $out) (local.get $token))
+            (local.set $in (i32.add (local.get $in) (i32.const 1)))
+            (local.set $out (i32.add (local.get $out) (i32.const 1))))
+          (else
+            (local.set $length (i32.sub (local.get $token) (i32.const 125)))
+            (local.set $source (i32.sub (local.get $out) (i32.load16_u offset=1 (local.get $in))))
+            (local.set $in (i32.add (local.get $in) (i32.const 3)))
+
+            ;; Copy the match a byte at a time, since it may overlap the bytes being written.
+            loop $copy_loop
+              (i32.store8 (local.get $out) (i32.load8_u (local.get $source)))
+              (local.set $out (i32.add (local.get $out) (i32.const 1)))
+              (local.set $source (i32.add (local.get $source) (i32.const 1)))
+              (local.set $length (i32.sub (local.get $length) (i32.const 1)))
+              (br_if $copy_loop (local.get $length))
+            end))
+        (br $loop)
+      end
+    end
+    (i32.sub (local.get $out) (i32.const 0xc000))
+  )
+
+  ;; Returns 1 if the decompressed data matches the input.
+  (func (export "verify") (result i32)
+    (local $p i32)
+    loop $loop
+      (if (i64.ne (i64.load (local.get $p)) (i64.load offset=0xc000 (local.get $p)))
+        (then (return (i32.const 0))))
+      (local.set $p (i32.add (local.get $p) (i32.const 8)))
+      (br_if $loop (i32.lt_u (local.get $p) (i32.const 0x4000)))
+    end
+    (i32.const 1)
+  )
+
+  (func (export "adler32") (result i32)
+    (local $p i32)
+    (local $a i32)
+    (local $b i32)
+    (local.set $a (i32.const 1))
+    loop $loop
+      (local.set $a (i32.rem_u (i32.add (local.get $a) (i32.load8_u (local.get $p)))
+                               (i32.const 65521)))
+      (local.set $b (i32.rem_u (i32.add (local.get $b) (local.get $a)) (i32.const 65521)))
+      (local.set $p (i32.add (local.get $p) (i32.const 1)))
+      (br_if $loop (i32.lt_u (local.get $p) (i32.const 0x4000)))
+    end
+    (i32.or (i32.shl (local.get $b) (i32.const 16)) (local.get $a))
+  )
+)
+
+(assert_return (invoke "compress") (i32.const 9186))
+(assert_return (invoke "decompress") (i32.const 16384))
+(assert_return (invoke "verify") (i32.const 1))
+(assert_return (invoke "adler32") (i32.const 991750182))
+
+(benchmark "lz77 compress (16KB)" (invoke "compress"))
+(benchmark "lz77 decompress (16KB)" (invoke "decompress"))
+(benchmark "adler32 (16KB)" (invoke "adler32"))
@@ -0,0 +1,181 @@
+;; A CoreMark-style integer workload: a matrix multiply, a bitwise CRC, and a state machine that
+;; classifies a list of numbers. Each call to an export runs one iteration of the kernel over the
+;; data in memory, and returns a checksum of the result.
+(module
+  ;; 0x0000: matrix A (16x16 i32)
+  ;; 0x0400: matrix B (16x16 i32)
+  ;; 0x0800: matrix C (16x16 i32)
+  ;; 0x1000: the null-terminated list of numbers classified by the state machine
+  (memory 1)
+
+  ;; Fill matrices A and B with pseudo-random bytes.
+  (func $init
+    (local $i i32)
+    (local $seed i32)
+    (local.set $seed (i32.const 1))
+    loop $loop
+      (local.set $seed (i32.add (i32.mul (local.get $seed) (i32.const 1103515245))
+                                (i32.const 12345)))
+      (i32.store (i32.shl (local.get $i) (i32.const 2))
+                 (i32.and (i32.shr_u (local.get $seed) (i32.const 16)) (i32.const 0xff)))
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      (br_if $loop (i32.lt_u (local.get $i) (i32.const 512)))
+    end
+  )
+  (start $init)
+
+  ;; C = A * B
+  (func $matrix (export "matrix") (result i32)
+    (local $i i32)
+    (local $j i32)
+    (local $k i32)
+    (local $sum i32)
+    (local $result i32)
+    loop $i_loop
+      (local.set $j (i32.const 0))
+      loop $j_loop
+        (local.set $sum (i32.const 0))
+        (local.set $k (i32.const 0))
+        loop $k_loop
+          (local.set $sum (i32.add
+            (local.get $sum)
+            (i32.mul
+              (i32.load (i32.shl (i32.add (i32.shl (local.get $i) (i32.const 4)) (local.get $k))
+                                 (i32.const 2)))
+              (i32.load offset=0x400
+                (i32.shl (i32.add (i32.shl (local.get $k) (i32.const 4)) (local.get $j))
+                         (i32.const 2))))))
+          (local.set $k (i32.add (local.get $k) (i32.const 1)))
+          (br_if $k_loop (i32.lt_u (local.get $k) (i32.const 16)))
+        end
+        (i32.store offset=0x800
+          (i32.shl (i32.add (i32.shl (local.get $i) (i32.const 4)) (local.get $j)) (i32.const 2))
+          (local.get $sum))
+        (local.set $result (i32.add (i32.rotl (local.get $result) (i32.const 1)) (local.get $sum)))
+        (local.set $j (i32.add (local.get $j) (i32.const 1)))
+        (br_if $j_loop (i32.lt_u (local.get $j) (i32.const 16)))
+      end
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      (br_if $i_loop (i32.lt_u (local.get $i) (i32.const 16)))
+    end
+    (local.get $result)
+  )
+
+  ;; CoreMark's bit-at-a-time CRC-16 of matrices A and B.
+  (func $crc (export "crc") (result i32)
+    (local $address i32)
+    (local $crc i32)
+    (local $data i32)
+    (local $bit i32)
+    loop $byte_loop
+      (local.set $data (i32.load8_u (local.get $address)))
+      (local.set $bit (i32.const 0))
+      loop $bit_loop
+        (if (i32.and (i32.xor (local.get $data) (local.get $crc)) (i32.const 1))
+          (then
+            (local.set $crc (i32.or (i32.shr_u (i32.xor (local.get $crc) (i32.const 0x4002))
+                                               (i32.const 1))
+                                    (i32.const 0x8000))))
+          (else (local.set $crc (i32.shr_u (local.get $crc) (i32.const 1)))))
+        (local.set $data (i32.shr_u (local.get $data) (i32.const 1)))
+        (local.set $bit (i32.add (local.get $bit) (i32.const 1)))
+        (br_if $bit_loop (i32.lt_u (local.get $bit) (i32.const 8)))
+      end
+      (local.set $address (i32.add (local.get $address) (i32.const 1)))
+      (br_if $byte_loop (i32.lt_u (local.get $address) (i32.const 0x800)))
+    end
+    (local.get $crc)
+  )
+
+  (func $is_digit (param $c i32) (result i32)
+    (i32.lt_u (i32.sub (local.get $c) (i32.const 48)) (i32.const 10))
+  )
+
+  (func $is_sign (param $c i32) (result i32)
+    (i32.or (i32.eq (local.get $c) (i32.const 43)) (i32.eq (local.get $c) (i32.const 45)))
+  )
+
+  ;; States: 0=start 1=invalid 2=sign 3=exponent sign 4=int 5=float 6=exponent 7=scientific
+  (func $transition (param $state i32) (param $c i32) (result i32)
+    (block $scientific
+      (block $exponent
+        (block $float
+          (block $int
+            (block $exponent_sign
+              (block $sign
+                (block $invalid
+                  (block $start
+                    (br_table $start $invalid $sign $exponent_sign $int $float $exponent
+                              $scientific
+                      (local.get $state)))
+                  (if (call $is_digit (local.get $c)) (then (return (i32.const 4))))
+                  (if (call $is_sign (local.get $c)) (then (return (i32.const 2))))
+                  (if (i32.eq (local.get $c) (i32.const 46)) (then (return (i32.const 5))))
+                  (return (i32.const 1)))
+                (return (i32.const 1)))
+              (br $int))
+            (return (select (i32.const 6) (i32.const 1) (call $is_sign (local.get $c)))))
+          (if (call $is_digit (local.get $c)) (then (return (i32.const 4))))
+          (if (i32.eq (local.get $c) (i32.const 46)) (then (return (i32.const 5))))
+          (return (i32.const 1)))
+        (if (i32.eq (i32.or (local.get $c) (i32.const 32)) (i32.const 101))
+          (then (return (i32.const 3))))
+        (return (select (i32.const 5) (i32.const 1) (call $is_digit (local.get $c)))))
+      (br $scientific))
+    (select (i32.const 7) (i32.const 1) (call $is_digit (local.get $c)))
+  )
+
+  ;; Runs the state machine over each comma-separated number, and hashes the final states.
+  (func $state (export "state") (result i32)
+    (local $address i32)
+    (local $c i32)
+    (local $state i32)
+    (local $result i32)
+    (local.set $address (i32.const 0x1000))
+    loop $loop
+      (local.set $c (i32.load8_u (local.get $address)))
+      (if (i32.or (i32.eq (local.get $c) (i32.const 44)) (i32.eqz (local.get $c)))
+        (then
+          (local.set $result (i32.add (i32.mul (local.get $result) (i32.const 33))
+                                      (local.get $state)))
+          (local.set $state (i32.const 0)))
+        (else (local.set $state (call $transition (local.get $state) (local.get $c)))))
+      (local.set $address (i32.add (local.get $address) (i32.const 1)))
+      (br_if $loop (local.get $c))
+    end
+    (local.get $result)
+  )
+
+  (func (export "coremark") (result i32)
+    (i32.xor (call $matrix) (i32.xor (call $crc) (call $state)))
+  )
+
+  (data (i32.const 0x1000)
+    "5012,1234,-874,+122,35.54400,0.1234500,-110.700,+0.64400,"
+    "5.500e+3,-.123e-2,-87e+832,+0.6e-12,T0.3e-1F,-T.T++Tq,1T3.4e4z,34.0e-T^,"
+    "5012,1234,-874,+122,35.54400,0.1234500,-110.700,+0.64400,"
+    "5.500e+3,-.123e-2,-87e+832,+0.6e-12,T0.3e-1F,-T.T++Tq,1T3.4e4z,34.0e-T^,"
+    "5012,1234,-874,+122,35.54400,0.1234500,-110.700,+0.64400,"
+    "5.500e+3,-.123e-2,-87e+832,+0.6e-12,T0.3e-1F,-T.T++Tq,1T3.4e4z,34.0e-T^,"
+    "5012,1234,-874,+122,35.54400,0.1234500,-110.700,+0.64400,"
+    "5.500e+3,-.123e-2,-87e+832,+0.6e-12,T0.3e-1F,-T.T++Tq,1T3.4e4z,34.0e-T^,"
+    "5012,1234,-874,+122,35.54400,0.1234500,-110.700,+0.64400,"
+    "5.500e+3,-.123e-2,-87e+832,+0.6e-12,T0.3e-1F,-T.T++Tq,1T3.4e4z,34.0e-T^,"
+    "5012,1234,-874,+122,35.54400,0.1234500,-110.700,+0.64400,"
+    "5.500e+3,-.123e-2,-87e+832,+0.6e-12,T0.3e-1F,-T.T++Tq,1T3.4e4z,34.0e-T^,"
+    "5012,1234,-874,+122,35.54400,0.1234500,-110.700,+0.64400,"
+    "5.500e+3,-.123e-2,-87e+832,+0.6e-12,T0.3e-1F,-T.T++Tq,1T3.4e4z,34.0e-T^,"
+    "5012,1234,-874,+122,35.54400,0.1234500,-110.700,+0.64400,"
+    "5.500e+3,-.123e-2,-87e+832,+0.6e-12,T0.3e-1F,-T.T++Tq,1T3.4e4z,34.0e-T^\00"
+  )
+)
+
+(assert_return (invoke "matrix") (i32.const -45135022))
+(assert_return (invoke "crc") (i32.const 42561))
+(assert_return (invoke "state") (i32.const 1305061872))
+(assert_return (invoke "coremark") (i32.const -1333377821))
+
+(benchmark "matrix multiply (16x16)" (invoke "matrix"))
+(benchmark "crc16 (2KB)" (invoke "crc"))
+(benchmark "state machine (1KB)" (invoke "state"))
+(benchmark "coremark iteration" (invoke "coremark"))
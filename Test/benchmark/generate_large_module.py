@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+
+# Generates large_module.wast: a benchmark of compiling and instantiating a module with many
+# functions of varied shapes. The generated functions are deterministic, so the output only changes
+# if this script changes.
+
+import os
+import random
+
+NUM_FUNCTIONS = 256
+
+BINARY_OPS = ["i32.add", "i32.sub", "i32.mul", "i32.and", "i32.or", "i32.xor", "i32.shl",
+              "i32.shr_u", "i32.rotl"]
+
+
+def generate_expression(rng, depth):
+    if depth == 0 or rng.random() < 0.3:
+        return rng.choice(["(local.get $a)", "(local.get $b)", "(local.get $t)",
+                           "(i32.const %d)" % rng.randrange(-1000, 1000),
+                           "(global.get $g%d)" % rng.randrange(4),
+                           "(i32.load offset=%d (i32.and (local.get $a) (i32.const 0xfffc)))"
+                           % (rng.randrange(64) * 4)])
+    return "(%s %s %s)" % (rng.choice(BINARY_OPS),
+                           generate_expression(rng, depth - 1),
+                           generate_expression(rng, depth - 1))
+
+
+def generate_function(rng, function_index):
+    lines = ["  (func $f%d (type $binary) (param $a i32) (param $b i32) (result i32)"
+             % function_index,
+             "    (local $t i32)",
+             "    (local $i i32)"]
+    shape = function_index % 4
+    if shape == 0:
+        # Straight-line arithmetic.
+        for _ in range(rng.randrange(4, 12)):
+            lines.append("    (local.set $t %s)" % generate_expression(rng, 2))
+    elif shape == 1:
+        # A counted loop that accumulates into memory.
+        lines += ["    loop $loop",
+                  "      (local.set $t %s)" % generate_expression(rng, 2),
+                  "      (i32.store offset=%d (i32.and (local.get $t) (i32.const 0xfffc))"
+                  % (rng.randrange(64) * 4),
+                  "                 %s)" % generate_expression(rng, 2),
+                  "      (local.set $i (i32.add (local.get $i) (i32.const 1)))",
+                  "      (br_if $loop (i32.lt_u (local.get $i) (i32.const %d)))"
+                  % rng.randrange(2, 16),
+                  "    end"]
+    elif shape == 2:
+        # Nested conditionals.
+        lines += ["    (if (i32.lt_s %s %s)" % (generate_expression(rng, 2),
+                                                generate_expression(rng, 2)),
+                  "      (then (local.set $t %s))" % generate_expression(rng, 2),
+                  "      (else",
+                  "        (if (i32.eqz %s)" % generate_expression(rng, 2),
+                  "          (then (local.set $t %s))" % generate_expression(rng, 2),
+                  "          (else (local.set $t %s)))))" % generate_expression(rng, 2)]
+    else:
+        # A br_table dispatch.
+        lines += ["    block $default",
+                  "      block $case1",
+                  "        block $case0",
+                  "          (br_table $case0 $case1 $default",
+                  "            (i32.and %s (i32.const 3)))" % generate_expression(rng, 2),
+                  "        end",
+                  "        (local.set $t %s)" % generate_expression(rng, 2),
+                  "        (br $default)",
+                  "      end",
+                  "      (local.set $t %s)" % generate_expression(rng, 2),
+                  "    end"]
+
+    # Call an earlier function directly, and another indirectly through the table.
+    if function_index > 0:
+        lines.append("    (local.set $t (call $f%d (local.get $t) %s))"
+                     % (rng.randrange(function_index), generate_expression(rng, 1)))
+        lines.append("    (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)")
+        lines.append("                    (i32.const %d)))" % rng.randrange(function_index))
+    lines += ["    (global.set $g%d (i32.add (global.get $g%d) (local.get $t)))"
+              % ((function_index % 4,) * 2),
+              "    (local.get $t)",
+              "  )"]
+    return lines
+
+
+def generate_module(rng):
+    lines = ["(module",
+             "  (type $binary (func (param i32 i32) (result i32)))",
+             "  (memory 1)"]
+    for global_index in range(4):
+        lines.append("  (global $g%d (mut i32) (i32.const %d))" % (global_index, global_index))
+    lines.append("  (table %d funcref)" % NUM_FUNCTIONS)
+    lines.append("  (elem (i32.const 0) func")
+    for first_index in range(0, NUM_FUNCTIONS, 10):
+        lines.append("    " + " ".join("$f%d" % function_index for function_index in
+                                         range(first_index, min(first_index + 10, NUM_FUNCTIONS))))
+    lines.append("  )")
+    for function_index in range(NUM_FUNCTIONS):
+        lines += generate_function(rng, function_index)
+    lines.append("  (export \"f%d\" (func $f%d))" % (NUM_FUNCTIONS - 1, NUM_FUNCTIONS - 1))
+    lines.append(")")
+    return lines
+
+
+def main():
+    rng = random.Random(1)
+    lines = [";; Generated by generate_large_module.py: do not edit.",
+             ";; A module with %d functions of varied shapes, used to benchmark compilation and"
+             % NUM_FUNCTIONS,
+             ";; instantiation of a large module.",
+             "(benchmark \"large module\""]
+    lines += ["  " + line for line in generate_module(rng)]
+    lines[-1] += ")"
+    output_path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "large_module.wast")
+    with open(output_path, "w") as output_file:
+        output_file.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+
+# Generates table_segment_benchmark.wast: benchmarks of initializing a table from a large element
+# segment, both with table.init and when instantiating a module with an active segment.
+
+import os
+
+NUM_ELEMENTS = 4096
+NUM_ELEMENTS_PER_LINE = 16
+
+
+def generate_elements(indent):
+    return [indent + " ".join(["$f"] * NUM_ELEMENTS_PER_LINE)
+            for _ in range(NUM_ELEMENTS // NUM_ELEMENTS_PER_LINE)]
+
+
+def main():
+    lines = [";; Generated by generate_table_segment_benchmark.py: do not edit.",
+             ";; Benchmarks of initializing a table from an element segment with %d elements."
+             % NUM_ELEMENTS,
+             "",
+             ";; A passive segment, copied into a table by table.init.",
+             "(module",
+             "  (func $f)",
+             "",
+             "  (table $funcrefs 65536 funcref)",
+             "  (elem $segment func"]
+    lines += generate_elements("    ")
+    lines += ["  )",
+              "",
+              "  (func (export \"table.init\") (param $numRepeats i32)",
+              "    loop $initLoop",
+              "      (local.set $numRepeats (i32.sub (local.get $numRepeats) (i32.const 1)))",
+              "      (table.init $funcrefs $segment",
+              "        (i32.mul (i32.and (local.get $numRepeats) (i32.const 15)) (i32.const %d))"
+              % NUM_ELEMENTS,
+              "        (i32.const 0)",
+              "        (i32.const %d))" % NUM_ELEMENTS,
+              "      (br_if $initLoop (local.get $numRepeats))",
+              "    end",
+              "  )",
+              ")",
+              "",
+              "(benchmark \"table.init (4K elements x 16)\" (invoke \"table.init\" (i32.const 16)))",
+              "",
+              ";; An active segment, copied into the table when the module is instantiated.",
+              "(benchmark \"active segment (4K elements)\"",
+              "  (module",
+              "    (func $f)",
+              "    (table %d funcref)" % NUM_ELEMENTS,
+              "    (elem (i32.const 0) func"]
+    lines += generate_elements("      ")
+    lines += ["    )",
+              "  )",
+              ")"]
+    output_path = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                               "table_segment_benchmark.wast")
+    with open(output_path, "w") as output_file:
+        output_file.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
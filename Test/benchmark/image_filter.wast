@@ -0,0 +1,111 @@
+;; A SIMD image filter: a 3x3 box blur of a 64x64 8-bit grayscale image. Each call to
+;; "box_blur_3x3" blurs the image 16 pixels at a time, and "checksum" hashes the blurred image.
+(module
+  ;; 0x0000: the input image
+  ;; 0x1000: the blurred image
+  (memory 1)
+
+  ;; Fill the input image with pseudo-random pixels.
+  (func $init
+    (local $i i32)
+    (local $seed i32)
+    (local.set $seed (i32.const 7))
+    loop $loop
+      (local.set $seed (i32.add (i32.mul (local.get $seed) (i32.const 1103515245))
+                                (i32.const 12345)))
+      (i32.store8 (local.get $i) (i32.shr_u (local.get $seed) (i32.const 16)))
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      (br_if $loop (i32.lt_u (local.get $i) (i32.const 4096)))
+    end
+  )
+  (start $init)
+
+  ;; Blurs rows 1-62. The pixels at the left and right edges of a row are blurred with the pixels
+  ;; that wrap around from the adjacent rows.
+  (func (export "box_blur_3x3")
+    (local $y i32)
+    (local $x i32)
+    (local $base i32)
+    (local $pixels v128)
+    (local $low v128)
+    (local $high v128)
+    (local.set $y (i32.const 1))
+    loop $y_loop
+      (local.set $x (i32.const 0))
+      loop $x_loop
+        ;; The address of the pixel above and to the left of the first pixel.
+        (local.set $base (i32.sub (i32.add (i32.shl (local.get $y) (i32.const 6)) (local.get $x))
+                                  (i32.const 65)))
+
+        ;; Sum the 9 neighboring pixels of each pixel as 16-bit lanes.
+        (local.set $low (v128.const i64x2 0 0))
+        (local.set $high (v128.const i64x2 0 0))
+        (local.set $pixels (v128.load offset=0 (local.get $base)))
+        (local.set $low (i16x8.add (local.get $low) (i16x8.extend_low_i8x16_u (local.get $pixels))))
+        (local.set $high (i16x8.add (local.get $high)
+                                    (i16x8.extend_high_i8x16_u (local.get $pixels))))
+        (local.set $pixels (v128.load offset=1 (local.get $base)))
+        (local.set $low (i16x8.add (local.get $low) (i16x8.extend_low_i8x16_u (local.get $pixels))))
+        (local.set $high (i16x8.add (local.get $high)
+                                    (i16x8.extend_high_i8x16_u (local.get $pixels))))
+        (local.set $pixels (v128.load offset=2 (local.get $base)))
+        (local.set $low (i16x8.add (local.get $low) (i16x8.extend_low_i8x16_u (local.get $pixels))))
+        (local.set $high (i16x8.add (local.get $high)
+                                    (i16x8.extend_high_i8x16_u (local.get $pixels))))
+        (local.set $pixels (v128.load offset=64 (local.get $base)))
+        (local.set $low (i16x8.add (local.get $low) (i16x8.extend_low_i8x16_u (local.get $pixels))))
+        (local.set $high (i16x8.add (local.get $high)
+                                    (i16x8.extend_high_i8x16_u (local.get $pixels))))
+        (local.set $pixels (v128.load offset=65 (local.get $base)))
+        (local.set $low (i16x8.add (local.get $low) (i16x8.extend_low_i8x16_u (local.get $pixels))))
+        (local.set $high (i16x8.add (local.get $high)
+                                    (i16x8.extend_high_i8x16_u (local.get $pixels))))
+        (local.set $pixels (v128.load offset=66 (local.get $base)))
+        (local.set $low (i16x8.add (local.get $low) (i16x8.extend_low_i8x16_u (local.get $pixels))))
+        (local.set $high (i16x8.add (local.get $high)
+                                    (i16x8.extend_high_i8x16_u (local.get $pixels))))
+        (local.set $pixels (v128.load offset=128 (local.get $base)))
+        (local.set $low (i16x8.add (local.get $low) (i16x8.extend_low_i8x16_u (local.get $pixels))))
+        (local.set $high (i16x8.add (local.get $high)
+                                    (i16x8.extend_high_i8x16_u (local.get $pixels))))
+        (local.set $pixels (v128.load offset=129 (local.get $base)))
+        (local.set $low (i16x8.add (local.get $low) (i16x8.extend_low_i8x16_u (local.get $pixels))))
+        (local.set $high (i16x8.add (local.get $high)
+                                    (i16x8.extend_high_i8x16_u (local.get $pixels))))
+        (local.set $pixels (v128.load offset=130 (local.get $base)))
+        (local.set $low (i16x8.add (local.get $low) (i16x8.extend_low_i8x16_u (local.get $pixels))))
+        (local.set $high (i16x8.add (local.get $high)
+                                    (i16x8.extend_high_i8x16_u (local.get $pixels))))
+
+        ;; Divide the sums by 9: (sum * 3641 + 0x4000) >> 15 rounds sum / 9 for sum <= 9 * 255.
+        (v128.store offset=0x1041 (local.get $base)
+          (i8x16.narrow_i16x8_u
+            (i16x8.q15mulr_sat_s (local.get $low) (i16x8.splat (i32.const 3641)))
+            (i16x8.q15mulr_sat_s (local.get $high) (i16x8.splat (i32.const 3641)))))
+
+        (local.set $x (i32.add (local.get $x) (i32.const 16)))
+        (br_if $x_loop (i32.lt_u (local.get $x) (i32.const 64)))
+      end
+      (local.set $y (i32.add (local.get $y) (i32.const 1)))
+      (br_if $y_loop (i32.lt_u (local.get $y) (i32.const 63)))
+    end
+  )
+
+  (func (export "checksum") (result i32)
+    (local $address i32)
+    (local $result i32)
+    (local.set $address (i32.const 0x1000))
+    loop $loop
+      (local.set $result (i32.xor (i32.rotl (local.get $result) (i32.const 5))
+                                  (i32.load8_u (local.get $address))))
+      (local.set $address (i32.add (local.get $address) (i32.const 1)))
+      (br_if $loop (i32.lt_u (local.get $address) (i32.const 0x2000)))
+    end
+    (local.get $result)
+  )
+)
+
+(invoke "box_blur_3x3")
+(assert_return (invoke "checksum") (i32.const 640469806))
+
+(benchmark "box blur 3x3 (64x64)" (invoke "box_blur_3x3"))
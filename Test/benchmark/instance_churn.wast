@@ -0,0 +1,70 @@
+;; Instance churn: repeatedly instantiate and destroy modules that are typical of short-lived
+;; instances, to measure the fixed costs of compiling, linking, instantiating, and collecting
+;; instances.
+
+;; A minimal module.
+(benchmark "empty module" (module))
+
+;; A module with the usual imports, memory, table, globals, and segments of a small program.
+(benchmark "small module"
+  (module
+    (import "spectest" "print_i32" (func $print_i32 (param i32)))
+    (import "spectest" "global_i32" (global $imported_global i32))
+
+    (type $unary (func (param i32) (result i32)))
+
+    (memory 1)
+    (table 8 funcref)
+    (global $counter (mut i32) (global.get $imported_global))
+    (global $heap_base i32 (i32.const 0x1000))
+
+    (func $increment (type $unary) (i32.add (local.get 0) (i32.const 1)))
+    (func $double (type $unary) (i32.shl (local.get 0) (i32.const 1)))
+    (func $square (type $unary) (i32.mul (local.get 0) (local.get 0)))
+    (func $apply (export "apply") (param $function i32) (param $value i32) (result i32)
+      (global.set $counter (i32.add (global.get $counter) (i32.const 1)))
+      (call_indirect (type $unary) (local.get $value) (local.get $function))
+    )
+    (func $main (export "main")
+      (call $print_i32 (call $apply (i32.const 2) (i32.load (i32.const 0))))
+    )
+
+    (elem (i32.const 0) $increment $double $square)
+    (data (i32.const 0) "\2a\00\00\00")
+    (data (i32.const 0x100) "a string constant\00")
+    (data (i32.const 0x200) "another string constant\00")
+  )
+)
+
+;; A module with a large memory and many data and element segments.
+(benchmark "segments"
+  (module
+    (memory 16)
+    (table 64 funcref)
+    (func $f0) (func $f1) (func $f2) (func $f3) (func $f4) (func $f5) (func $f6) (func $f7)
+    (elem (i32.const 0) $f0 $f1 $f2 $f3 $f4 $f5 $f6 $f7)
+    (elem (i32.const 8) $f0 $f1 $f2 $f3 $f4 $f5 $f6 $f7)
+    (elem (i32.const 16) $f0 $f1 $f2 $f3 $f4 $f5 $f6 $f7)
+    (elem (i32.const 24) $f0 $f1 $f2 $f3 $f4 $f5 $f6 $f7)
+    (elem (i32.const 32) $f0 $f1 $f2 $f3 $f4 $f5 $f6 $f7)
+    (elem (i32.const 40) $f0 $f1 $f2 $f3 $f4 $f5 $f6 $f7)
+    (elem (i32.const 48) $f0 $f1 $f2 $f3 $f4 $f5 $f6 $f7)
+    (elem (i32.const 56) $f0 $f1 $f2 $f3 $f4 $f5 $f6 $f7)
+    (data (i32.const 0x00000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0x10000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0x20000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0x30000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0x40000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0x50000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0x60000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0x70000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0x80000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0x90000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0xa0000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0xb0000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0xc0000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0xd0000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0xe0000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+    (data (i32.const 0xf0000) "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef")
+  )
+)
@@ -0,0 +1,304 @@
+;; A JSON tokenizer: each call to "tokenize" scans a 2.7KB JSON document, decoding the integer part
+;; of each number, and returns a hash of the token sequence.
+(module
+  ;; 0x0000: the null-terminated JSON document
+  (memory 1)
+
+  (func $is_digit (param $c i32) (result i32)
+    (i32.lt_u (i32.sub (local.get $c) (i32.const 48)) (i32.const 10))
+  )
+
+  (func $is_lowercase_letter (param $c i32) (result i32)
+    (i32.lt_u (i32.sub (local.get $c) (i32.const 97)) (i32.const 26))
+  )
+
+  (func (export "tokenize") (result i32)
+    (local $p i32)
+    (local $c i32)
+    (local $value i32)
+    (local $hash i32)
+    block $done
+      loop $loop
+        (local.set $c (i32.load8_u (local.get $p)))
+        (br_if $done (i32.eqz (local.get $c)))
+        (local.set $p (i32.add (local.get $p) (i32.const 1)))
+
+        ;; Skip whitespace.
+        (br_if $loop (i32.le_u (local.get $c) (i32.const 32)))
+
+        ;; Set $c to the kind of the token: 's' for strings, 'n' for numbers, the first letter of
+        ;; literals, or the character of structural tokens.
+        block $token
+          ;; Strings
+          (if (i32.eq (local.get $c) (i32.const 34))
+            (then
+              block $string_end
+                loop $string_loop
+                  (local.set $c (i32.load8_u (local.get $p)))
+                  (local.set $p (i32.add (local.get $p) (i32.const 1)))
+                  (br_if $string_end (i32.eq (local.get $c) (i32.const 34)))
+
+                  ;; Skip the character following a backslash.
+                  (if (i32.eq (local.get $c) (i32.const 92))
+                    (then (local.set $p (i32.add (local.get $p) (i32.const 1)))))
+                  (br $string_loop)
+                end
+              end
+              (local.set $c (i32.const 115))
+              (br $token)))
+
+          ;; Numbers
+          (if (i32.or (i32.eq (local.get $c) (i32.const 45)) (call $is_digit (local.get $c)))
+            (then
+              (local.set $value (select (i32.const 0)
+                                        (i32.sub (local.get $c) (i32.const 48))
+                                        (i32.eq (local.get $c) (i32.const 45))))
+              block $integer_end
+                loop $integer_loop
+                  (local.set $c (i32.load8_u (local.get $p)))
+                  (br_if $integer_end (i32.eqz (call $is_digit (local.get $c))))
+                  (local.set $value (i32.add (i32.mul (local.get $value) (i32.const 10))
+                                             (i32.sub (local.get $c) (i32.const 48))))
+                  (local.set $p (i32.add (local.get $p) (i32.const 1)))
+                  (br $integer_loop)
+                end
+              end
+
+              ;; Skip the fraction and exponent.
+              block $number_end
+                loop $number_loop
+                  (local.set $c (i32.load8_u (local.get $p)))
+                  (br_if $number_end
+                    (i32.eqz (i32.or (i32.or (call $is_digit (local.get $c))
+                                             (i32.eq (local.get $c) (i32.const 46)))
+                                     (i32.or (i32.eq (i32.or (local.get $c) (i32.const 32))
+                                                     (i32.const 101))
+                                             (i32.or (i32.eq (local.get $c) (i32.const 43))
+                                                     (i32.eq (local.get $c) (i32.const 45)))))))
+                  (local.set $p (i32.add (local.get $p) (i32.const 1)))
+                  (br $number_loop)
+                end
+              end
+
+              (local.set $hash (i32.add (i32.mul (local.get $hash) (i32.const 31))
+                                        (local.get $value)))
+              (local.set $c (i32.const 110))
+              (br $token)))
+
+          ;; Literals: true, false, and null
+          (if (call $is_lowercase_letter (local.get $c))
+            (then
+              block $literal_end
+                loop $literal_loop
+                  (br_if $literal_end
+                    (i32.eqz (call $is_lowercase_letter (i32.load8_u (local.get $p)))))
+                  (local.set $p (i32.add (local.get $p) (i32.const 1)))
+                  (br $literal_loop)
+                end
+              end))
+        end
+
+        (local.set $hash (i32.add (i32.mul (local.get $hash) (i32.const 31)) (local.get $c)))
+        (br $loop)
+      end
+    end
+    (local.get $hash)
+  )
+
+  (data (i32.const 0)
+    "{\n"
+    " \"version\": 3,\n"
+    " \"items\": [\n"
+    "  {\n"
+    "   \"id\": 1000,\n"
+    "   \"name\": \"alpha\",\n"
+    "   \"score\": -40.0,\n"
+    "   \"active\": false,\n"
+    "   \"tags\": [],\n"
+    "   \"location\": {\n"
+    "    \"lat\": 37.5,\n"
+    "    \"lon\": -122.25,\n"
+    "    \"note\": \"line \\\"0\\\"\\\\n\\tend\"\n"
+    "   },\n"
+    "   \"ratio\": 0.0015\n"
+    "  },\n"
+    "  {\n"
+    "   \"id\": 1037,\n"
+    "   \"name\": \"beta\",\n"
+    "   \"score\": 74.875,\n"
+    "   \"active\": true,\n"
+    "   \"tags\": [\n"
+    "    \"beta\"\n"
+    "   ],\n"
+    "   \"location\": {\n"
+    "    \"lat\": 37.625,\n"
+    "    \"lon\": -122.75,\n"
+    "    \"note\": null\n"
+    "   },\n"
+    "   \"ratio\": 0.003\n"
+    "  },\n"
+    "  {\n"
+    "   \"id\": 1074,\n"
+    "   \"name\": \"gamma\",\n"
+    "   \"score\": 64.75,\n"
+    "   \"active\": true,\n"
+    "   \"tags\": [\n"
+    "    \"gamma\",\n"
+    "    \"delta\"\n"
+    "   ],\n"
+    "   \"location\": {\n"
+    "    \"lat\": 37.75,\n"
+    "    \"lon\": -123.25,\n"
+    "    \"note\": null\n"
+    "   },\n"
+    "   \"ratio\": 0.0045000000000000005\n"
+    "  },\n"
+    "  {\n"
+    "   \"id\": 1111,\n"
+    "   \"name\": \"delta\",\n"
+    "   \"score\": 54.625,\n"
+    "   \"active\": false,\n"
+    "   \"tags\": [\n"
+    "    \"delta\",\n"
+    "    \"epsilon\",\n"
+    "    \"zeta\"\n"
+    "   ],\n"
+    "   \"location\": {\n"
+    "    \"lat\": 37.875,\n"
+    "    \"lon\": -123.75,\n"
+    "    \"note\": null\n"
+    "   },\n"
+    "   \"ratio\": 0.006\n"
+    "  },\n"
+    "  {\n"
+    "   \"id\": 1148,\n"
+    "   \"name\": \"epsilon\",\n"
+    "   \"score\": 44.5,\n"
+    "   \"active\": true,\n"
+    "   \"tags\": [],\n"
+    "   \"location\": {\n"
+    "    \"lat\": 38.0,\n"
+    "    \"lon\": -124.25,\n"
+    "    \"note\": null\n"
+    "   },\n"
+    "   \"ratio\": 0.0075\n"
+    "  },\n"
+    "  {\n"
+    "   \"id\": 1185,\n"
+    "   \"name\": \"zeta\",\n"
+    "   \"score\": 34.375,\n"
+    "   \"active\": true,\n"
+    "   \"tags\": [\n"
+    "    \"zeta\"\n"
+    "   ],\n"
+    "   \"location\": {\n"
+    "    \"lat\": 38.125,\n"
+    "    \"lon\": -124.75,\n"
+    "    \"note\": \"line \\\"5\\\"\\\\n\\tend\"\n"
+    "   },\n"
+    "   \"ratio\": 0.009000000000000001\n"
+    "  },\n"
+    "  {\n"
+    "   \"id\": 1222,\n"
+    "   \"name\": \"eta\",\n"
+    "   \"score\": 24.25,\n"
+    "   \"active\": false,\n"
+    "   \"tags\": [\n"
+    "    \"eta\",\n"
+    "    \"theta\"\n"
+    "   ],\n"
+    "   \"location\": {\n"
+    "    \"lat\": 38.25,\n"
+    "    \"lon\": -125.25,\n"
+    "    \"note\": null\n"
+    "   },\n"
+    "   \"ratio\": 0.0105\n"
+    "  },\n"
+    "  {\n"
+    "   \"id\": 1259,\n"
+    "   \"name\": \"theta\",\n"
+    "   \"score\": 14.125,\n"
+    "   \"active\": true,\n"
+    "   \"tags\": [\n"
+    "    \"theta\",\n"
+    "    \"iota\",\n"
+    "    \"kappa\"\n"
+    "   ],\n"
+    "   \"location\": {\n"
+    "    \"lat\": 38.375,\n"
+    "    \"lon\": -125.75,\n"
+    "    \"note\": null\n"
+    "   },\n"
+    "   \"ratio\": 0.012\n"
+    "  },\n"
+    "  {\n"
+    "   \"id\": 1296,\n"
+    "   \"name\": \"iota\",\n"
+    "   \"score\": 4.0,\n"
+    "   \"active\": true,\n"
+    "   \"tags\": [],\n"
+    "   \"location\": {\n"
+    "    \"lat\": 38.5,\n"
+    "    \"lon\": -126.25,\n"
+    "    \"note\": null\n"
+    "   },\n"
+    "   \"ratio\": 0.0135\n"
+    "  },\n"
+    "  {\n"
+    "   \"id\": 1333,\n"
+    "   \"name\": \"kappa\",\n"
+    "   \"score\": -6.125,\n"
+    "   \"active\": false,\n"
+    "   \"tags\": [\n"
+    "    \"kappa\"\n"
+    "   ],\n"
+    "   \"location\": {\n"
+    "    \"lat\": 38.625,\n"
+    "    \"lon\": -126.75,\n"
+    "    \"note\": null\n"
+    "   },\n"
+    "   \"ratio\": 0.015\n"
+    "  },\n"
+    "  {\n"
+    "   \"id\": 1370,\n"
+    "   \"name\": \"lambda\",\n"
+    "   \"score\": -16.25,\n"
+    "   \"active\": true,\n"
+    "   \"tags\": [\n"
+    "    \"lambda\",\n"
+    "    \"mu\"\n"
+    "   ],\n"
+    "   \"location\": {\n"
+    "    \"lat\": 38.75,\n"
+    "    \"lon\": -127.25,\n"
+    "    \"note\": \"line \\\"10\\\"\\\\n\\tend\"\n"
+    "   },\n"
+    "   \"ratio\": 0.0165\n"
+    "  },\n"
+    "  {\n"
+    "   \"id\": 1407,\n"
+    "   \"name\": \"mu\",\n"
+    "   \"score\": -26.375,\n"
+    "   \"active\": true,\n"
+    "   \"tags\": [\n"
+    "    \"mu\",\n"
+    "    \"alpha\",\n"
+    "    \"beta\"\n"
+    "   ],\n"
+    "   \"location\": {\n"
+    "    \"lat\": 38.875,\n"
+    "    \"lon\": -127.75,\n"
+    "    \"note\": null\n"
+    "   },\n"
+    "   \"ratio\": 0.018000000000000002\n"
+    "  }\n"
+    " ],\n"
+    " \"count\": 12,\n"
+    " \"next\": null\n"
+    "}\00"
+  )
+)
+
+(assert_return (invoke "tokenize") (i32.const 896173550))
+
+(benchmark "json tokenize (2.7KB)" (invoke "tokenize"))
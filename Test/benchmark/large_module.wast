@@ -0,0 +1,4371 @@
+;; Generated by generate_large_module.py: do not edit.
+;; A module with 256 functions of varied shapes, used to benchmark compilation and
+;; instantiation of a large module.
+(benchmark "large module"
+  (module
+    (type $binary (func (param i32 i32) (result i32)))
+    (memory 1)
+    (global $g0 (mut i32) (i32.const 0))
+    (global $g1 (mut i32) (i32.const 1))
+    (global $g2 (mut i32) (i32.const 2))
+    (global $g3 (mut i32) (i32.const 3))
+    (table 256 funcref)
+    (elem (i32.const 0) func
+      $f0 $f1 $f2 $f3 $f4 $f5 $f6 $f7 $f8 $f9
+      $f10 $f11 $f12 $f13 $f14 $f15 $f16 $f17 $f18 $f19
+      $f20 $f21 $f22 $f23 $f24 $f25 $f26 $f27 $f28 $f29
+      $f30 $f31 $f32 $f33 $f34 $f35 $f36 $f37 $f38 $f39
+      $f40 $f41 $f42 $f43 $f44 $f45 $f46 $f47 $f48 $f49
+      $f50 $f51 $f52 $f53 $f54 $f55 $f56 $f57 $f58 $f59
+      $f60 $f61 $f62 $f63 $f64 $f65 $f66 $f67 $f68 $f69
+      $f70 $f71 $f72 $f73 $f74 $f75 $f76 $f77 $f78 $f79
+      $f80 $f81 $f82 $f83 $f84 $f85 $f86 $f87 $f88 $f89
+      $f90 $f91 $f92 $f93 $f94 $f95 $f96 $f97 $f98 $f99
+      $f100 $f101 $f102 $f103 $f104 $f105 $f106 $f107 $f108 $f109
+      $f110 $f111 $f112 $f113 $f114 $f115 $f116 $f117 $f118 $f119
+      $f120 $f121 $f122 $f123 $f124 $f125 $f126 $f127 $f128 $f129
+      $f130 $f131 $f132 $f133 $f134 $f135 $f136 $f137 $f138 $f139
+      $f140 $f141 $f142 $f143 $f144 $f145 $f146 $f147 $f148 $f149
+      $f150 $f151 $f152 $f153 $f154 $f155 $f156 $f157 $f158 $f159
+      $f160 $f161 $f162 $f163 $f164 $f165 $f166 $f167 $f168 $f169
+      $f170 $f171 $f172 $f173 $f174 $f175 $f176 $f177 $f178 $f179
+      $f180 $f181 $f182 $f183 $f184 $f185 $f186 $f187 $f188 $f189
+      $f190 $f191 $f192 $f193 $f194 $f195 $f196 $f197 $f198 $f199
+      $f200 $f201 $f202 $f203 $f204 $f205 $f206 $f207 $f208 $f209
+      $f210 $f211 $f212 $f213 $f214 $f215 $f216 $f217 $f218 $f219
+      $f220 $f221 $f222 $f223 $f224 $f225 $f226 $f227 $f228 $f229
+      $f230 $f231 $f232 $f233 $f234 $f235 $f236 $f237 $f238 $f239
+      $f240 $f241 $f242 $f243 $f244 $f245 $f246 $f247 $f248 $f249
+      $f250 $f251 $f252 $f253 $f254 $f255
+    )
+    (func $f0 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.sub (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.and (i32.const -808) (local.get $t))))
+      (local.set $t (i32.and (i32.sub (local.get $a) (i32.load offset=192 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.const -136)))
+      (local.set $t (i32.rotl (local.get $t) (i32.shl (i32.load offset=92 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.rotl (i32.shl (local.get $t) (global.get $g3)) (i32.shr_u (i32.load offset=212 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (i32.rotl (i32.const -665) (i32.shr_u (i32.load offset=200 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (i32.rotl (i32.rotl (global.get $g3) (i32.load offset=136 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.add (i32.const -215) (local.get $t))))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f1 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.and (i32.shl (local.get $t) (global.get $g2)) (local.get $a)))
+        (i32.store offset=128 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (local.get $a))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 9)))
+      end
+      (local.set $t (call $f0 (local.get $t) (i32.or (global.get $g2) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 0)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f2 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.load offset=136 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.shr_u (i32.shr_u (local.get $t) (local.get $b)) (local.get $a)))
+        (then (local.set $t (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc)))))
+        (else
+          (if (i32.eqz (i32.shr_u (i32.shl (local.get $b) (i32.load offset=200 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.xor (i32.load offset=28 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+            (then (local.set $t (i32.sub (i32.or (global.get $g1) (global.get $g1)) (i32.add (local.get $b) (local.get $b)))))
+            (else (local.set $t (i32.and (i32.shl (local.get $a) (global.get $g3)) (i32.xor (local.get $a) (global.get $g1))))))))
+      (local.set $t (call $f0 (local.get $t) (i32.and (global.get $g0) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 0)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f3 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (local.get $t) (i32.const 3)))
+          end
+          (local.set $t (i32.rotl (i32.xor (local.get $t) (global.get $g3)) (i32.sub (local.get $a) (local.get $t))))
+          (br $default)
+        end
+        (local.set $t (global.get $g3))
+      end
+      (local.set $t (call $f2 (local.get $t) (local.get $t)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 2)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f4 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.or (global.get $g2) (i32.sub (local.get $b) (local.get $a))))
+      (local.set $t (i32.and (i32.const 730) (i32.rotl (i32.load offset=128 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (i32.add (i32.const 611) (i32.shl (global.get $g0) (local.get $t))))
+      (local.set $t (local.get $t))
+      (local.set $t (local.get $b))
+      (local.set $t (call $f2 (local.get $t) (local.get $a)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 2)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f5 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.shl (i32.add (global.get $g1) (local.get $t)) (local.get $b)))
+        (i32.store offset=8 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.shl (local.get $a) (i32.or (i32.const 537) (global.get $g1))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 14)))
+      end
+      (local.set $t (call $f2 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 1)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f6 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.xor (i32.rotl (local.get $b) (global.get $g0)) (i32.rotl (local.get $t) (i32.load offset=24 (i32.and (local.get $a) (i32.const 0xfffc))))) (i32.and (global.get $g3) (i32.const -101)))
+        (then (local.set $t (i32.mul (local.get $a) (i32.mul (local.get $t) (global.get $g2)))))
+        (else
+          (if (i32.eqz (i32.sub (global.get $g1) (i32.shr_u (local.get $t) (i32.load offset=112 (i32.and (local.get $a) (i32.const 0xfffc))))))
+            (then (local.set $t (i32.rotl (i32.or (local.get $a) (global.get $g2)) (i32.and (global.get $g2) (global.get $g1)))))
+            (else (local.set $t (local.get $b))))))
+      (local.set $t (call $f2 (local.get $t) (i32.add (i32.const 13) (global.get $g1))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 0)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f7 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.sub (global.get $g0) (i32.sub (i32.const -89) (i32.const -187))) (i32.const 3)))
+          end
+          (local.set $t (local.get $a))
+          (br $default)
+        end
+        (local.set $t (i32.rotl (i32.sub (local.get $b) (global.get $g0)) (i32.add (local.get $b) (global.get $g2))))
+      end
+      (local.set $t (call $f1 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 4)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f8 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.sub (i32.shl (local.get $a) (i32.load offset=148 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.mul (i32.const -847) (local.get $a))))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.xor (i32.shr_u (local.get $b) (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.rotl (i32.load offset=208 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 458))))
+      (local.set $t (i32.rotl (global.get $g0) (i32.shl (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -493))))
+      (local.set $t (i32.mul (i32.shl (local.get $a) (local.get $t)) (i32.shl (i32.const 789) (local.get $b))))
+      (local.set $t (i32.add (local.get $t) (global.get $g0)))
+      (local.set $t (i32.mul (i32.shl (local.get $b) (local.get $t)) (global.get $g2)))
+      (local.set $t (i32.add (global.get $g2) (i32.shl (i32.const 149) (i32.load offset=168 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (global.get $g1))
+      (local.set $t (call $f6 (local.get $t) (i32.shl (local.get $b) (global.get $g1))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 2)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f9 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.or (i32.mul (local.get $t) (local.get $a)) (i32.or (i32.const -861) (local.get $b))))
+        (i32.store offset=20 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.load offset=108 (i32.and (local.get $a) (i32.const 0xfffc))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 2)))
+      end
+      (local.set $t (call $f7 (local.get $t) (i32.shr_u (global.get $g2) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 6)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f10 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (local.get $b) (local.get $b))
+        (then (local.set $t (i32.or (i32.sub (local.get $a) (local.get $t)) (i32.or (local.get $b) (local.get $a)))))
+        (else
+          (if (i32.eqz (i32.rotl (local.get $a) (i32.or (global.get $g0) (local.get $t))))
+            (then (local.set $t (i32.shl (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 673))))
+            (else (local.set $t (i32.or (i32.and (local.get $t) (global.get $g0)) (i32.and (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))))))
+      (local.set $t (call $f1 (local.get $t) (local.get $a)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 0)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f11 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.rotl (i32.xor (local.get $b) (i32.load offset=224 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.load offset=12 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.const 3)))
+          end
+          (local.set $t (i32.sub (local.get $a) (i32.add (i32.load offset=160 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+          (br $default)
+        end
+        (local.set $t (i32.or (local.get $t) (i32.rotl (local.get $a) (local.get $t))))
+      end
+      (local.set $t (call $f2 (local.get $t) (i32.const -203)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 5)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f12 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.add (i32.rotl (local.get $t) (i32.load offset=164 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.rotl (local.get $t) (global.get $g2))))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.shl (i32.sub (local.get $a) (local.get $b)) (i32.xor (local.get $t) (local.get $a))))
+      (local.set $t (local.get $a))
+      (local.set $t (global.get $g0))
+      (local.set $t (i32.sub (local.get $b) (i32.mul (global.get $g3) (local.get $b))))
+      (local.set $t (call $f3 (local.get $t) (i32.and (global.get $g3) (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 1)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f13 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.or (i32.add (local.get $a) (local.get $t)) (i32.shr_u (i32.load offset=152 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t))))
+        (i32.store offset=160 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.rotl (i32.rotl (global.get $g3) (local.get $t)) (local.get $t)))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 12)))
+      end
+      (local.set $t (call $f0 (local.get $t) (i32.add (local.get $t) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 0)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f14 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.shr_u (local.get $t) (i32.sub (i32.const -10) (local.get $t))) (i32.mul (i32.or (global.get $g3) (i32.const -412)) (i32.shr_u (i32.load offset=204 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+        (then (local.set $t (local.get $a)))
+        (else
+          (if (i32.eqz (i32.load offset=204 (i32.and (local.get $a) (i32.const 0xfffc))))
+            (then (local.set $t (i32.add (global.get $g0) (i32.add (i32.load offset=212 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=132 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+            (else (local.set $t (i32.load offset=108 (i32.and (local.get $a) (i32.const 0xfffc))))))))
+      (local.set $t (call $f10 (local.get $t) (local.get $t)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 10)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f15 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.shl (local.get $b) (i32.and (i32.load offset=212 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))))) (i32.const 3)))
+          end
+          (local.set $t (i32.rotl (i32.xor (local.get $a) (local.get $a)) (i32.shr_u (global.get $g0) (i32.const -438))))
+          (br $default)
+        end
+        (local.set $t (global.get $g1))
+      end
+      (local.set $t (call $f10 (local.get $t) (i32.add (local.get $t) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 7)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f16 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.shr_u (global.get $g1) (i32.load offset=68 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (i32.and (i32.shr_u (local.get $b) (local.get $b)) (i32.load offset=88 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (i32.const 153))
+      (local.set $t (i32.add (i32.and (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g2)) (i32.shl (local.get $t) (local.get $b))))
+      (local.set $t (i32.add (i32.sub (local.get $t) (local.get $t)) (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (i32.and (global.get $g2) (i32.sub (i32.const -279) (global.get $g3))))
+      (local.set $t (i32.or (i32.or (global.get $g1) (local.get $b)) (local.get $t)))
+      (local.set $t (call $f8 (local.get $t) (i32.or (i32.load offset=204 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 11)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f17 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.rotl (i32.add (i32.load offset=228 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g1)) (local.get $t)))
+        (i32.store offset=184 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.mul (i32.const 628) (local.get $t)))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 12)))
+      end
+      (local.set $t (call $f0 (local.get $t) (i32.add (i32.load offset=192 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 13)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f18 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.shl (global.get $g3) (i32.sub (local.get $a) (global.get $g0))) (i32.xor (i32.xor (global.get $g3) (local.get $b)) (i32.load offset=216 (i32.and (local.get $a) (i32.const 0xfffc)))))
+        (then (local.set $t (i32.add (i32.shl (local.get $t) (local.get $a)) (i32.sub (local.get $t) (i32.const 551)))))
+        (else
+          (if (i32.eqz (i32.shl (i32.mul (local.get $b) (i32.load offset=124 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shr_u (i32.const -244) (global.get $g3))))
+            (then (local.set $t (i32.or (i32.mul (local.get $a) (local.get $b)) (i32.shl (local.get $b) (local.get $a)))))
+            (else (local.set $t (i32.and (i32.shl (local.get $b) (i32.load offset=172 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.const 587)))))))
+      (local.set $t (call $f0 (local.get $t) (i32.shl (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 32))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 14)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f19 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (local.get $a) (i32.const 3)))
+          end
+          (local.set $t (i32.shr_u (local.get $a) (i32.or (local.get $b) (global.get $g1))))
+          (br $default)
+        end
+        (local.set $t (i32.rotl (i32.rotl (local.get $b) (local.get $b)) (i32.load offset=40 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      end
+      (local.set $t (call $f11 (local.get $t) (i32.mul (local.get $t) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 4)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f20 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.and (i32.load offset=216 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.mul (i32.load offset=200 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (i32.add (i32.load offset=212 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b)))
+      (local.set $t (i32.mul (i32.load offset=180 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.and (i32.const -391) (global.get $g2))))
+      (local.set $t (i32.and (i32.add (i32.const -406) (local.get $t)) (i32.const -729)))
+      (local.set $t (i32.and (i32.rotl (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=68 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.add (global.get $g0) (local.get $t))))
+      (local.set $t (local.get $t))
+      (local.set $t (call $f13 (local.get $t) (i32.shr_u (global.get $g1) (i32.const -968))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 6)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f21 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.rotl (i32.xor (local.get $a) (i32.const 388)) (global.get $g1)))
+        (i32.store offset=184 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (local.get $a))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 9)))
+      end
+      (local.set $t (call $f1 (local.get $t) (i32.mul (i32.const 825) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 12)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f22 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.or (i32.xor (local.get $a) (local.get $b)) (i32.rotl (global.get $g2) (i32.const 612))) (i32.add (i32.sub (local.get $t) (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.sub (local.get $t) (local.get $t))))
+        (then (local.set $t (i32.mul (i32.mul (local.get $t) (local.get $t)) (i32.xor (local.get $t) (global.get $g3)))))
+        (else
+          (if (i32.eqz (i32.sub (local.get $a) (local.get $b)))
+            (then (local.set $t (i32.load offset=24 (i32.and (local.get $a) (i32.const 0xfffc)))))
+            (else (local.set $t (i32.and (i32.sub (local.get $t) (i32.const 760)) (i32.add (i32.load offset=212 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))))))
+      (local.set $t (call $f6 (local.get $t) (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 8)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f23 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.add (i32.shr_u (i32.load offset=112 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (local.get $b)) (i32.const 3)))
+          end
+          (local.set $t (i32.sub (i32.mul (i32.const -929) (global.get $g1)) (i32.shl (global.get $g0) (global.get $g1))))
+          (br $default)
+        end
+        (local.set $t (i32.shr_u (i32.shr_u (i32.load offset=220 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (i32.and (global.get $g3) (local.get $b))))
+      end
+      (local.set $t (call $f8 (local.get $t) (i32.rotl (local.get $t) (i32.const -365))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 14)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f24 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (local.get $t))
+      (local.set $t (i32.mul (i32.shl (local.get $a) (i32.const -477)) (local.get $b)))
+      (local.set $t (i32.xor (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)))
+      (local.set $t (i32.mul (i32.rotl (local.get $t) (local.get $a)) (i32.shl (global.get $g1) (i32.load offset=124 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.and (i32.or (i32.load offset=0 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 442)) (i32.const -701)))
+      (local.set $t (i32.rotl (i32.sub (i32.const 195) (i32.load offset=44 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.rotl (local.get $t) (local.get $a))))
+      (local.set $t (i32.rotl (i32.mul (local.get $b) (i32.load offset=216 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.add (local.get $a) (local.get $a))))
+      (local.set $t (i32.rotl (global.get $g2) (i32.or (local.get $b) (global.get $g0))))
+      (local.set $t (i32.add (i32.shl (global.get $g0) (local.get $b)) (local.get $t)))
+      (local.set $t (call $f23 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 1)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f25 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.xor (local.get $b) (i32.sub (i32.load offset=24 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=44 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (i32.store offset=112 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.or (i32.and (local.get $b) (i32.const -333)) (i32.shl (i32.const 770) (local.get $t))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 4)))
+      end
+      (local.set $t (call $f19 (local.get $t) (i32.and (global.get $g3) (i32.const -378))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 14)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f26 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.xor (i32.shr_u (local.get $b) (global.get $g1)) (i32.const 123)) (i32.mul (local.get $t) (i32.mul (local.get $a) (i32.const -123))))
+        (then (local.set $t (i32.mul (i32.sub (global.get $g1) (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.xor (local.get $t) (i32.const 339)))))
+        (else
+          (if (i32.eqz (local.get $b))
+            (then (local.set $t (i32.or (i32.shl (local.get $b) (local.get $b)) (global.get $g1))))
+            (else (local.set $t (i32.mul (i32.const -846) (i32.shr_u (i32.const -626) (local.get $b))))))))
+      (local.set $t (call $f7 (local.get $t) (i32.mul (local.get $b) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 25)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f27 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.and (i32.and (global.get $g3) (local.get $b)) (i32.shr_u (local.get $t) (i32.const 23))) (i32.const 3)))
+          end
+          (local.set $t (global.get $g2))
+          (br $default)
+        end
+        (local.set $t (local.get $t))
+      end
+      (local.set $t (call $f2 (local.get $t) (i32.xor (local.get $b) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 15)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f28 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.or (i32.const -405) (i32.and (global.get $g2) (local.get $t))))
+      (local.set $t (global.get $g3))
+      (local.set $t (i32.and (i32.shr_u (local.get $a) (i32.load offset=40 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (i32.rotl (i32.shr_u (global.get $g0) (global.get $g3)) (i32.add (i32.const 721) (i32.const -514))))
+      (local.set $t (i32.xor (local.get $t) (i32.mul (local.get $a) (i32.const 179))))
+      (local.set $t (i32.rotl (local.get $t) (local.get $b)))
+      (local.set $t (i32.rotl (i32.rotl (i32.const 447) (global.get $g2)) (i32.or (i32.load offset=144 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (i32.rotl (i32.shr_u (local.get $b) (local.get $a)) (i32.mul (i32.const -92) (global.get $g0))))
+      (local.set $t (i32.shl (local.get $b) (i32.add (global.get $g0) (i32.const -530))))
+      (local.set $t (i32.sub (i32.shr_u (local.get $t) (i32.const 39)) (i32.shl (local.get $t) (global.get $g2))))
+      (local.set $t (call $f6 (local.get $t) (i32.load offset=232 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 4)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f29 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.const -790))
+        (i32.store offset=76 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.rotl (i32.or (i32.const -185) (i32.load offset=152 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shl (local.get $a) (local.get $b))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 9)))
+      end
+      (local.set $t (call $f3 (local.get $t) (i32.rotl (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g2))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 18)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f30 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.xor (i32.shl (local.get $b) (local.get $a)) (i32.add (local.get $t) (local.get $b))) (i32.or (i32.xor (local.get $a) (local.get $b)) (local.get $b)))
+        (then (local.set $t (i32.or (i32.const -992) (i32.sub (local.get $b) (global.get $g3)))))
+        (else
+          (if (i32.eqz (i32.rotl (i32.and (global.get $g1) (i32.const -672)) (i32.mul (global.get $g1) (local.get $a))))
+            (then (local.set $t (i32.mul (local.get $a) (i32.sub (local.get $b) (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+            (else (local.set $t (i32.sub (i32.add (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=0 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.add (local.get $a) (local.get $t))))))))
+      (local.set $t (call $f3 (local.get $t) (i32.rotl (local.get $b) (i32.const -117))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 13)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f31 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.rotl (i32.and (local.get $b) (i32.const -958)) (i32.shr_u (local.get $b) (i32.const 669))) (i32.const 3)))
+          end
+          (local.set $t (i32.or (i32.and (local.get $t) (local.get $b)) (i32.rotl (local.get $a) (i32.const 722))))
+          (br $default)
+        end
+        (local.set $t (i32.add (i32.mul (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g3)) (i32.shr_u (global.get $g0) (local.get $b))))
+      end
+      (local.set $t (call $f29 (local.get $t) (i32.shl (local.get $a) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 3)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f32 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.load offset=56 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.sub (local.get $t) (i32.add (i32.const 174) (local.get $t))))
+      (local.set $t (i32.shr_u (i32.or (i32.const 862) (global.get $g0)) (local.get $t)))
+      (local.set $t (i32.mul (i32.shl (i32.const 555) (local.get $a)) (local.get $t)))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.const -718))
+      (local.set $t (i32.xor (i32.mul (local.get $t) (local.get $t)) (local.get $a)))
+      (local.set $t (global.get $g3))
+      (local.set $t (i32.xor (i32.add (global.get $g1) (global.get $g0)) (i32.and (local.get $b) (local.get $t))))
+      (local.set $t (call $f8 (local.get $t) (global.get $g1)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 16)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f33 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.const -956))
+        (i32.store offset=216 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.sub (i32.const 572) (i32.xor (local.get $b) (local.get $a))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 15)))
+      end
+      (local.set $t (call $f28 (local.get $t) (i32.and (i32.load offset=76 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 825))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 0)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f34 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.or (i32.or (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 303)) (i32.add (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))) (i32.sub (i32.const 6) (i32.shl (i32.load offset=12 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+        (then (local.set $t (local.get $b)))
+        (else
+          (if (i32.eqz (i32.shr_u (i32.or (local.get $b) (global.get $g2)) (i32.sub (local.get $t) (local.get $b))))
+            (then (local.set $t (i32.shl (i32.shl (global.get $g3) (local.get $b)) (i32.shl (global.get $g0) (i32.const -828)))))
+            (else (local.set $t (local.get $a))))))
+      (local.set $t (call $f4 (local.get $t) (local.get $t)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 5)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f35 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.xor (i32.mul (local.get $t) (i32.load offset=124 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (i32.load offset=164 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t))) (i32.const 3)))
+          end
+          (local.set $t (i32.and (local.get $t) (i32.mul (i32.const -663) (local.get $a))))
+          (br $default)
+        end
+        (local.set $t (i32.shl (i32.or (global.get $g1) (local.get $a)) (global.get $g1)))
+      end
+      (local.set $t (call $f29 (local.get $t) (i32.rotl (i32.const -62) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 15)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f36 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (local.get $t))
+      (local.set $t (i32.or (local.get $a) (local.get $a)))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.const 855))
+      (local.set $t (i32.add (i32.shr_u (local.get $b) (local.get $t)) (i32.sub (i32.const 59) (local.get $t))))
+      (local.set $t (i32.shl (i32.rotl (local.get $a) (local.get $b)) (i32.and (local.get $t) (i32.const -704))))
+      (local.set $t (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (global.get $g3))
+      (local.set $t (call $f17 (local.get $t) (i32.and (local.get $t) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 34)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f37 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.rotl (i32.and (local.get $b) (local.get $a)) (i32.const -798)))
+        (i32.store offset=88 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.and (i32.sub (local.get $a) (i32.const -740)) (i32.xor (local.get $t) (i32.const 928))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 14)))
+      end
+      (local.set $t (call $f36 (local.get $t) (i32.load offset=92 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 22)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f38 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.const -141) (i32.and (i32.rotl (local.get $t) (global.get $g2)) (i32.load offset=224 (i32.and (local.get $a) (i32.const 0xfffc)))))
+        (then (local.set $t (global.get $g3)))
+        (else
+          (if (i32.eqz (global.get $g2))
+            (then (local.set $t (local.get $t)))
+            (else (local.set $t (i32.mul (i32.shl (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g0)) (local.get $a)))))))
+      (local.set $t (call $f17 (local.get $t) (global.get $g1)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 21)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f39 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (local.get $b) (i32.const 3)))
+          end
+          (local.set $t (i32.add (local.get $b) (i32.and (local.get $b) (global.get $g0))))
+          (br $default)
+        end
+        (local.set $t (i32.rotl (local.get $t) (i32.shr_u (i32.const -614) (i32.const -184))))
+      end
+      (local.set $t (call $f21 (local.get $t) (i32.add (local.get $b) (global.get $g3))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 32)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f40 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (local.get $t))
+      (local.set $t (i32.shr_u (i32.rotl (local.get $t) (local.get $a)) (i32.sub (local.get $t) (local.get $a))))
+      (local.set $t (local.get $b))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.shr_u (i32.add (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g1)) (i32.xor (i32.load offset=192 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (i32.shr_u (i32.shl (local.get $b) (local.get $t)) (i32.sub (local.get $b) (i32.const 564))))
+      (local.set $t (call $f14 (local.get $t) (i32.rotl (local.get $t) (i32.const -649))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 31)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f41 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.add (i32.add (local.get $b) (global.get $g3)) (i32.shl (local.get $t) (global.get $g0))))
+        (i32.store offset=240 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.sub (local.get $b) (i32.shl (global.get $g2) (i32.const -213))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 5)))
+      end
+      (local.set $t (call $f4 (local.get $t) (i32.xor (i32.load offset=192 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 1)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f42 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.shr_u (i32.add (i32.load offset=200 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=228 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.sub (global.get $g3) (global.get $g0))) (i32.xor (local.get $t) (i32.shl (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -399))))
+        (then (local.set $t (i32.shl (i32.xor (global.get $g3) (global.get $g1)) (i32.shl (i32.load offset=248 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=80 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+        (else
+          (if (i32.eqz (i32.shl (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.sub (local.get $b) (local.get $b))))
+            (then (local.set $t (global.get $g0)))
+            (else (local.set $t (i32.add (local.get $a) (i32.shl (global.get $g1) (local.get $t))))))))
+      (local.set $t (call $f38 (local.get $t) (i32.rotl (global.get $g1) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 36)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f43 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.load offset=0 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 3)))
+          end
+          (local.set $t (i32.const -425))
+          (br $default)
+        end
+        (local.set $t (i32.and (i32.mul (i32.load offset=184 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=220 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $b)))
+      end
+      (local.set $t (call $f21 (local.get $t) (i32.mul (local.get $b) (i32.load offset=180 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 8)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f44 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.shl (i32.shr_u (global.get $g2) (local.get $b)) (local.get $t)))
+      (local.set $t (i32.const -997))
+      (local.set $t (i32.sub (i32.or (i32.const -796) (i32.load offset=56 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.rotl (local.get $b) (local.get $t))))
+      (local.set $t (i32.mul (local.get $t) (local.get $t)))
+      (local.set $t (i32.and (local.get $b) (global.get $g3)))
+      (local.set $t (i32.shl (i32.or (local.get $t) (local.get $b)) (i32.xor (local.get $a) (global.get $g0))))
+      (local.set $t (i32.rotl (i32.or (local.get $a) (i32.const -188)) (i32.shl (i32.load offset=208 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (i32.rotl (i32.or (i32.load offset=128 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b)) (i32.rotl (local.get $a) (local.get $t))))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (call $f10 (local.get $t) (i32.shl (local.get $t) (i32.const -896))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 6)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f45 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.xor (global.get $g2) (i32.shl (local.get $a) (local.get $a))))
+        (i32.store offset=84 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.or (i32.and (i32.load offset=148 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -663)) (i32.rotl (local.get $t) (local.get $t))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 8)))
+      end
+      (local.set $t (call $f37 (local.get $t) (i32.and (i32.load offset=172 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g1))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 31)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f46 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.shl (i32.and (local.get $a) (global.get $g0)) (local.get $a)) (local.get $t))
+        (then (local.set $t (i32.mul (local.get $a) (i32.xor (global.get $g2) (local.get $b)))))
+        (else
+          (if (i32.eqz (i32.shl (i32.add (i32.load offset=8 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (i32.shl (local.get $b) (global.get $g0))))
+            (then (local.set $t (i32.or (local.get $b) (i32.or (local.get $t) (local.get $b)))))
+            (else (local.set $t (i32.add (local.get $b) (i32.const 321)))))))
+      (local.set $t (call $f16 (local.get $t) (local.get $a)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 2)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f47 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.shr_u (i32.or (local.get $t) (local.get $t)) (i32.or (local.get $b) (local.get $t))) (i32.const 3)))
+          end
+          (local.set $t (local.get $t))
+          (br $default)
+        end
+        (local.set $t (i32.const -310))
+      end
+      (local.set $t (call $f27 (local.get $t) (i32.xor (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 5)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f48 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.xor (i32.shl (i32.const -748) (local.get $b)) (i32.shr_u (local.get $b) (local.get $t))))
+      (local.set $t (i32.mul (i32.shr_u (global.get $g1) (local.get $a)) (local.get $t)))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.mul (local.get $t) (i32.mul (global.get $g1) (global.get $g1))))
+      (local.set $t (i32.mul (i32.shr_u (i32.load offset=36 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g1)) (i32.mul (global.get $g2) (local.get $t))))
+      (local.set $t (i32.mul (i32.shr_u (global.get $g1) (i32.load offset=220 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (i32.load offset=168 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (call $f23 (local.get $t) (i32.shr_u (local.get $t) (global.get $g3))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 30)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f49 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.and (i32.load offset=52 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=108 (i32.and (local.get $a) (i32.const 0xfffc)))))
+        (i32.store offset=152 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.add (i32.add (i32.const -368) (i32.const -975)) (i32.load offset=24 (i32.and (local.get $a) (i32.const 0xfffc)))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 8)))
+      end
+      (local.set $t (call $f10 (local.get $t) (i32.add (local.get $t) (i32.load offset=12 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 38)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f50 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.shl (i32.rotl (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b)) (i32.mul (local.get $t) (global.get $g3))) (local.get $t))
+        (then (local.set $t (i32.const 85)))
+        (else
+          (if (i32.eqz (i32.mul (i32.const 85) (i32.rotl (local.get $a) (global.get $g0))))
+            (then (local.set $t (i32.rotl (i32.shr_u (i32.load offset=208 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)) (i32.xor (i32.const -75) (local.get $t)))))
+            (else (local.set $t (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc))))))))
+      (local.set $t (call $f0 (local.get $t) (i32.load offset=156 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 11)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f51 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (local.get $t) (i32.const 3)))
+          end
+          (local.set $t (i32.load offset=8 (i32.and (local.get $a) (i32.const 0xfffc))))
+          (br $default)
+        end
+        (local.set $t (local.get $t))
+      end
+      (local.set $t (call $f37 (local.get $t) (i32.or (local.get $a) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 31)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f52 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.or (i32.and (local.get $a) (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.mul (global.get $g2) (local.get $b))))
+      (local.set $t (i32.xor (local.get $a) (i32.or (i32.load offset=72 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 710))))
+      (local.set $t (i32.shl (i32.or (i32.const 402) (local.get $t)) (local.get $a)))
+      (local.set $t (i32.add (i32.add (i32.load offset=0 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=200 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shl (i32.load offset=92 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t))))
+      (local.set $t (call $f22 (local.get $t) (local.get $t)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 50)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f53 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.shr_u (i32.sub (local.get $b) (local.get $b)) (i32.shr_u (i32.const 250) (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (i32.store offset=128 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.xor (i32.shl (i32.const 58) (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $t)))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 8)))
+      end
+      (local.set $t (call $f42 (local.get $t) (i32.mul (local.get $b) (i32.load offset=28 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 7)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f54 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.load offset=92 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.shr_u (i32.and (local.get $a) (global.get $g3)) (local.get $b)))
+        (then (local.set $t (i32.rotl (global.get $g0) (i32.add (local.get $a) (i32.load offset=120 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+        (else
+          (if (i32.eqz (i32.shl (i32.mul (local.get $b) (global.get $g0)) (local.get $b)))
+            (then (local.set $t (i32.mul (global.get $g3) (i32.rotl (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)))))
+            (else (local.set $t (i32.shl (i32.shl (global.get $g2) (i32.const 952)) (i32.const -748)))))))
+      (local.set $t (call $f4 (local.get $t) (i32.xor (i32.const -561) (i32.const -48))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 5)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f55 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.sub (i32.shr_u (local.get $b) (i32.load offset=192 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (local.get $t) (local.get $t))) (i32.const 3)))
+          end
+          (local.set $t (i32.sub (i32.const -86) (i32.const 492)))
+          (br $default)
+        end
+        (local.set $t (i32.mul (i32.rotl (global.get $g1) (i32.load offset=236 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.or (i32.load offset=8 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -76))))
+      end
+      (local.set $t (call $f45 (local.get $t) (i32.and (i32.load offset=104 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=136 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 39)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f56 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (local.get $a))
+      (local.set $t (i32.shr_u (i32.or (local.get $b) (i32.load offset=128 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (i32.const -157) (local.get $a))))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.or (local.get $t) (i32.or (i32.load offset=28 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (i32.shl (local.get $t) (local.get $t)))
+      (local.set $t (i32.load offset=132 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (global.get $g2))
+      (local.set $t (i32.add (local.get $t) (i32.shr_u (local.get $t) (global.get $g0))))
+      (local.set $t (i32.add (i32.rotl (local.get $a) (local.get $a)) (i32.and (i32.const -276) (local.get $a))))
+      (local.set $t (i32.load offset=220 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (call $f32 (local.get $t) (local.get $a)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 27)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f57 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (local.get $a))
+        (i32.store offset=232 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.xor (i32.sub (local.get $b) (local.get $a)) (i32.const 623)))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 11)))
+      end
+      (local.set $t (call $f29 (local.get $t) (i32.shr_u (local.get $b) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 19)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f58 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (local.get $b) (i32.shr_u (i32.sub (i32.const 854) (i32.const 250)) (local.get $a)))
+        (then (local.set $t (i32.or (i32.mul (i32.const -99) (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $t))))
+        (else
+          (if (i32.eqz (i32.load offset=200 (i32.and (local.get $a) (i32.const 0xfffc))))
+            (then (local.set $t (i32.sub (local.get $b) (i32.add (i32.load offset=172 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+            (else (local.set $t (i32.shl (local.get $t) (i32.sub (i32.const -979) (local.get $a))))))))
+      (local.set $t (call $f55 (local.get $t) (i32.mul (i32.load offset=164 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 28)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f59 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (global.get $g1) (i32.const 3)))
+          end
+          (local.set $t (i32.mul (i32.const -522) (local.get $a)))
+          (br $default)
+        end
+        (local.set $t (i32.and (global.get $g1) (i32.sub (i32.load offset=184 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      end
+      (local.set $t (call $f5 (local.get $t) (i32.shl (local.get $t) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 33)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f60 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.and (i32.sub (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -985)) (i32.and (local.get $b) (i32.const -114))))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.and (i32.shl (i32.load offset=232 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (global.get $g2)))
+      (local.set $t (i32.sub (i32.shl (local.get $a) (local.get $b)) (i32.shl (i32.load offset=156 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (i32.and (i32.or (local.get $t) (i32.const 492)) (i32.sub (local.get $a) (local.get $b))))
+      (local.set $t (call $f27 (local.get $t) (local.get $a)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 2)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f61 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.rotl (i32.xor (local.get $t) (i32.const 806)) (i32.or (local.get $a) (i32.load offset=216 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (i32.store offset=232 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.rotl (i32.and (local.get $t) (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc)))) (global.get $g3)))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 6)))
+      end
+      (local.set $t (call $f38 (local.get $t) (i32.sub (global.get $g1) (i32.const 791))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 1)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f62 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.const 45) (i32.const 39))
+        (then (local.set $t (i32.const 659)))
+        (else
+          (if (i32.eqz (local.get $a))
+            (then (local.set $t (i32.add (global.get $g0) (local.get $t))))
+            (else (local.set $t (i32.rotl (i32.mul (i32.const -838) (i32.const -252)) (i32.or (local.get $a) (global.get $g0))))))))
+      (local.set $t (call $f38 (local.get $t) (i32.xor (i32.load offset=88 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 22)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f63 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.or (i32.xor (i32.const -243) (local.get $t)) (i32.shl (local.get $t) (global.get $g2))) (i32.const 3)))
+          end
+          (local.set $t (i32.add (i32.const 649) (local.get $b)))
+          (br $default)
+        end
+        (local.set $t (i32.sub (i32.xor (local.get $t) (i32.load offset=4 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.sub (i32.load offset=248 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -196))))
+      end
+      (local.set $t (call $f16 (local.get $t) (i32.mul (i32.load offset=104 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 9)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f64 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.shr_u (i32.rotl (local.get $a) (i32.load offset=168 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shr_u (local.get $a) (i32.const -561))))
+      (local.set $t (i32.and (i32.shl (i32.load offset=164 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.or (local.get $a) (i32.const -472))))
+      (local.set $t (i32.or (i32.xor (local.get $a) (local.get $a)) (i32.shr_u (local.get $t) (local.get $b))))
+      (local.set $t (i32.xor (global.get $g1) (i32.or (i32.const 374) (local.get $a))))
+      (local.set $t (i32.and (i32.add (global.get $g0) (local.get $b)) (i32.sub (i32.const 636) (global.get $g2))))
+      (local.set $t (i32.load offset=56 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.mul (i32.sub (local.get $a) (local.get $a)) (i32.sub (i32.load offset=40 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -324))))
+      (local.set $t (i32.sub (i32.shr_u (i32.const -386) (global.get $g1)) (i32.sub (local.get $t) (local.get $b))))
+      (local.set $t (i32.add (local.get $b) (i32.add (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (local.get $t))
+      (local.set $t (global.get $g1))
+      (local.set $t (call $f18 (local.get $t) (i32.and (local.get $b) (i32.const 2))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 54)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f65 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.shl (i32.shl (global.get $g2) (global.get $g2)) (i32.and (global.get $g2) (local.get $a))))
+        (i32.store offset=44 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.shl (i32.shl (i32.const 878) (i32.const 99)) (i32.and (local.get $a) (local.get $a))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 5)))
+      end
+      (local.set $t (call $f18 (local.get $t) (i32.sub (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 37)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f66 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.rotl (i32.shr_u (local.get $a) (local.get $b)) (local.get $b)) (i32.or (i32.mul (local.get $t) (local.get $a)) (i32.rotl (global.get $g1) (local.get $b))))
+        (then (local.set $t (i32.or (i32.mul (i32.load offset=108 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -988)) (global.get $g0))))
+        (else
+          (if (i32.eqz (i32.const -585))
+            (then (local.set $t (i32.const -99)))
+            (else (local.set $t (i32.xor (i32.mul (local.get $a) (global.get $g3)) (i32.sub (local.get $t) (local.get $a))))))))
+      (local.set $t (call $f2 (local.get $t) (i32.xor (local.get $t) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 33)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f67 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 3)))
+          end
+          (local.set $t (i32.shr_u (i32.sub (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b)) (i32.shr_u (global.get $g3) (local.get $b))))
+          (br $default)
+        end
+        (local.set $t (local.get $a))
+      end
+      (local.set $t (call $f15 (local.get $t) (i32.xor (i32.load offset=144 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=84 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 52)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f68 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.mul (i32.sub (local.get $b) (local.get $t)) (i32.shr_u (local.get $a) (i32.const 822))))
+      (local.set $t (i32.shl (i32.xor (i32.load offset=164 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)) (i32.sub (local.get $t) (local.get $a))))
+      (local.set $t (i32.mul (i32.rotl (local.get $t) (local.get $a)) (i32.and (local.get $a) (i32.const 748))))
+      (local.set $t (i32.rotl (i32.sub (i32.const 806) (global.get $g3)) (i32.shl (i32.load offset=44 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 71))))
+      (local.set $t (i32.xor (local.get $a) (i32.rotl (global.get $g1) (local.get $a))))
+      (local.set $t (i32.shl (i32.shr_u (local.get $t) (local.get $t)) (i32.or (local.get $b) (local.get $b))))
+      (local.set $t (local.get $a))
+      (local.set $t (call $f26 (local.get $t) (i32.rotl (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 48)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f69 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (local.get $t))
+        (i32.store offset=188 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (local.get $t))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 3)))
+      end
+      (local.set $t (call $f58 (local.get $t) (i32.mul (i32.const -461) (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 59)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f70 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.shr_u (i32.add (local.get $b) (global.get $g2)) (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc)))) (global.get $g1))
+        (then (local.set $t (i32.rotl (i32.shl (local.get $a) (i32.load offset=136 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (local.get $t) (i32.load offset=200 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+        (else
+          (if (i32.eqz (i32.or (i32.const 238) (global.get $g3)))
+            (then (local.set $t (i32.rotl (i32.const -833) (local.get $b))))
+            (else (local.set $t (local.get $b))))))
+      (local.set $t (call $f63 (local.get $t) (local.get $t)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 1)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f71 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.rotl (i32.sub (local.get $b) (i32.const 928)) (global.get $g3)) (i32.const 3)))
+          end
+          (local.set $t (i32.or (i32.shl (i32.const 948) (i32.load offset=0 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.sub (local.get $a) (i32.load offset=36 (i32.and (local.get $a) (i32.const 0xfffc))))))
+          (br $default)
+        end
+        (local.set $t (i32.and (global.get $g3) (i32.mul (local.get $b) (local.get $t))))
+      end
+      (local.set $t (call $f69 (local.get $t) (i32.shr_u (local.get $b) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 58)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f72 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.shl (i32.sub (local.get $b) (global.get $g2)) (i32.sub (i32.load offset=116 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g1))))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.xor (i32.xor (local.get $a) (local.get $b)) (i32.mul (local.get $b) (i32.const -167))))
+      (local.set $t (i32.and (i32.shl (i32.load offset=0 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)) (global.get $g2)))
+      (local.set $t (i32.mul (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)))
+      (local.set $t (i32.and (i32.add (local.get $t) (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.xor (local.get $b) (local.get $b))))
+      (local.set $t (global.get $g3))
+      (local.set $t (global.get $g3))
+      (local.set $t (i32.and (global.get $g1) (i32.rotl (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=192 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call $f37 (local.get $t) (i32.xor (i32.load offset=212 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 29)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f73 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.const 397))
+        (i32.store offset=128 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.shl (i32.shr_u (local.get $t) (local.get $b)) (i32.rotl (i32.const 841) (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 7)))
+      end
+      (local.set $t (call $f33 (local.get $t) (global.get $g2)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 26)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f74 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.sub (i32.mul (i32.load offset=72 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)) (i32.shl (local.get $a) (i32.const -577))) (i32.rotl (local.get $a) (i32.const 901)))
+        (then (local.set $t (i32.and (i32.shr_u (local.get $a) (global.get $g2)) (i32.shr_u (global.get $g1) (i32.const -875)))))
+        (else
+          (if (i32.eqz (local.get $a))
+            (then (local.set $t (i32.load offset=212 (i32.and (local.get $a) (i32.const 0xfffc)))))
+            (else (local.set $t (local.get $t))))))
+      (local.set $t (call $f65 (local.get $t) (i32.or (global.get $g1) (global.get $g2))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 27)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f75 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.add (i32.load offset=180 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.add (local.get $b) (local.get $t))) (i32.const 3)))
+          end
+          (local.set $t (local.get $t))
+          (br $default)
+        end
+        (local.set $t (i32.rotl (i32.rotl (i32.const -555) (local.get $t)) (i32.rotl (i32.load offset=168 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=248 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      end
+      (local.set $t (call $f62 (local.get $t) (i32.add (local.get $t) (global.get $g3))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 51)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f76 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.const -9))
+      (local.set $t (i32.add (i32.xor (local.get $t) (local.get $a)) (i32.const 992)))
+      (local.set $t (i32.and (i32.sub (local.get $b) (i32.const -949)) (i32.or (local.get $t) (local.get $t))))
+      (local.set $t (i32.or (i32.rotl (local.get $b) (local.get $a)) (i32.shr_u (local.get $t) (i32.load offset=68 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call $f64 (local.get $t) (i32.xor (i32.const -183) (global.get $g2))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 29)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f77 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.mul (i32.rotl (local.get $a) (global.get $g3)) (i32.shr_u (local.get $a) (local.get $b))))
+        (i32.store offset=20 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.or (i32.shr_u (global.get $g2) (i32.const -252)) (i32.load offset=128 (i32.and (local.get $a) (i32.const 0xfffc)))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 13)))
+      end
+      (local.set $t (call $f31 (local.get $t) (local.get $t)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 61)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f78 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.mul (i32.rotl (global.get $g1) (local.get $a)) (i32.and (i32.load offset=72 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=160 (i32.and (local.get $a) (i32.const 0xfffc))))) (i32.and (i32.shr_u (local.get $b) (i32.const -897)) (i32.shl (i32.const -616) (i32.const -936))))
+        (then (local.set $t (global.get $g1)))
+        (else
+          (if (i32.eqz (i32.xor (i32.add (global.get $g1) (local.get $a)) (i32.or (i32.const -526) (i32.const -244))))
+            (then (local.set $t (i32.mul (i32.xor (i32.const -610) (local.get $t)) (i32.sub (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)))))
+            (else (local.set $t (i32.or (i32.sub (local.get $t) (i32.const 973)) (global.get $g1)))))))
+      (local.set $t (call $f23 (local.get $t) (i32.mul (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g3))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 27)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f79 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.load offset=136 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 3)))
+          end
+          (local.set $t (i32.shr_u (i32.sub (local.get $t) (local.get $a)) (i32.load offset=204 (i32.and (local.get $a) (i32.const 0xfffc)))))
+          (br $default)
+        end
+        (local.set $t (i32.const 156))
+      end
+      (local.set $t (call $f75 (local.get $t) (i32.mul (i32.const 404) (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 62)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f80 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (global.get $g2))
+      (local.set $t (i32.sub (i32.xor (i32.load offset=152 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (i32.load offset=88 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (i32.rotl (local.get $a) (i32.rotl (i32.const 326) (local.get $t))))
+      (local.set $t (i32.xor (local.get $b) (i32.and (local.get $a) (i32.load offset=52 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call $f79 (local.get $t) (i32.mul (local.get $t) (global.get $g0))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 56)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f81 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.or (i32.rotl (local.get $t) (i32.load offset=36 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.add (i32.const 163) (local.get $a))))
+        (i32.store offset=148 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.and (i32.sub (local.get $a) (local.get $t)) (local.get $b)))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 5)))
+      end
+      (local.set $t (call $f62 (local.get $t) (i32.shl (local.get $a) (global.get $g1))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 73)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f82 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.or (i32.mul (local.get $a) (local.get $a)) (i32.shr_u (i32.load offset=104 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -98))) (i32.shr_u (global.get $g2) (i32.sub (local.get $a) (global.get $g0))))
+        (then (local.set $t (i32.sub (i32.xor (global.get $g3) (local.get $a)) (i32.sub (local.get $a) (i32.const -317)))))
+        (else
+          (if (i32.eqz (i32.const 158))
+            (then (local.set $t (i32.shl (i32.rotl (i32.const 181) (i32.const 912)) (i32.sub (i32.const 114) (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+            (else (local.set $t (i32.mul (i32.or (i32.const -185) (local.get $a)) (i32.and (i32.const -781) (local.get $a))))))))
+      (local.set $t (call $f35 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 76)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f83 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (local.get $a) (i32.const 3)))
+          end
+          (local.set $t (i32.shl (i32.shr_u (i32.load offset=20 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g2)) (i32.or (local.get $b) (local.get $t))))
+          (br $default)
+        end
+        (local.set $t (i32.add (i32.or (local.get $b) (local.get $b)) (i32.add (local.get $t) (i32.const 9))))
+      end
+      (local.set $t (call $f73 (local.get $t) (i32.and (i32.const 506) (global.get $g3))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 1)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f84 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.shl (i32.and (local.get $a) (local.get $b)) (i32.shr_u (i32.load offset=136 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (i32.rotl (i32.rotl (i32.load offset=80 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 684)) (i32.and (i32.const -377) (global.get $g0))))
+      (local.set $t (i32.shr_u (i32.xor (local.get $t) (i32.const 367)) (i32.xor (i32.load offset=124 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (i32.xor (i32.rotl (local.get $a) (i32.const 690)) (i32.const -236)))
+      (local.set $t (i32.load offset=136 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.mul (i32.mul (i32.load offset=36 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b)) (global.get $g0)))
+      (local.set $t (i32.load offset=4 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.and (i32.or (global.get $g2) (local.get $t)) (local.get $a)))
+      (local.set $t (i32.shr_u (local.get $b) (i32.mul (i32.load offset=120 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g2))))
+      (local.set $t (call $f65 (local.get $t) (i32.const -935)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 16)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f85 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.shr_u (i32.and (local.get $b) (global.get $g1)) (global.get $g1)))
+        (i32.store offset=120 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (global.get $g2))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 4)))
+      end
+      (local.set $t (call $f16 (local.get $t) (i32.rotl (local.get $a) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 51)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f86 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (global.get $g3) (i32.shr_u (i32.load offset=88 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)))
+        (then (local.set $t (i32.shl (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.shr_u (local.get $a) (local.get $a)))))
+        (else
+          (if (i32.eqz (i32.or (i32.and (local.get $a) (local.get $t)) (i32.or (i32.load offset=124 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g1))))
+            (then (local.set $t (i32.load offset=52 (i32.and (local.get $a) (i32.const 0xfffc)))))
+            (else (local.set $t (i32.shl (i32.shr_u (local.get $a) (local.get $a)) (local.get $b)))))))
+      (local.set $t (call $f83 (local.get $t) (i32.xor (global.get $g3) (i32.const -975))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 33)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f87 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.or (local.get $b) (i32.mul (local.get $b) (local.get $t))) (i32.const 3)))
+          end
+          (local.set $t (global.get $g1))
+          (br $default)
+        end
+        (local.set $t (local.get $t))
+      end
+      (local.set $t (call $f79 (local.get $t) (i32.add (local.get $t) (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 54)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f88 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.or (global.get $g2) (i32.sub (local.get $t) (local.get $b))))
+      (local.set $t (i32.and (i32.sub (global.get $g3) (i32.const -618)) (i32.or (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 750))))
+      (local.set $t (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.sub (i32.add (i32.load offset=128 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g0)) (i32.add (local.get $b) (local.get $b))))
+      (local.set $t (i32.add (i32.rotl (i32.const 793) (global.get $g0)) (i32.and (i32.const 355) (local.get $t))))
+      (local.set $t (call $f45 (local.get $t) (i32.const -59)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 63)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f89 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.mul (i32.rotl (local.get $a) (local.get $b)) (i32.rotl (local.get $b) (i32.const 53))))
+        (i32.store offset=232 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.add (i32.load offset=36 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.add (i32.load offset=112 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 3)))
+      end
+      (local.set $t (call $f83 (local.get $t) (i32.xor (local.get $t) (i32.load offset=20 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 54)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f90 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.or (i32.rotl (i32.load offset=68 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 683)) (local.get $a)) (i32.rotl (global.get $g3) (i32.and (local.get $a) (i32.const 941))))
+        (then (local.set $t (global.get $g3)))
+        (else
+          (if (i32.eqz (i32.sub (i32.or (local.get $b) (local.get $a)) (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc)))))
+            (then (local.set $t (i32.const -123)))
+            (else (local.set $t (i32.mul (i32.shr_u (i32.const 22) (global.get $g1)) (i32.and (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=228 (i32.and (local.get $a) (i32.const 0xfffc))))))))))
+      (local.set $t (call $f22 (local.get $t) (local.get $a)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 23)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f91 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.mul (local.get $t) (i32.mul (local.get $t) (local.get $b))) (i32.const 3)))
+          end
+          (local.set $t (i32.add (global.get $g0) (global.get $g1)))
+          (br $default)
+        end
+        (local.set $t (i32.shl (i32.mul (local.get $b) (local.get $a)) (i32.or (local.get $t) (local.get $t))))
+      end
+      (local.set $t (call $f14 (local.get $t) (i32.shr_u (global.get $g0) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 35)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f92 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.const 544))
+      (local.set $t (i32.mul (i32.shl (i32.const -62) (i32.const 590)) (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.and (i32.or (i32.const -964) (i32.load offset=40 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.or (local.get $b) (local.get $a))))
+      (local.set $t (i32.load offset=112 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.and (i32.load offset=72 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.shr_u (global.get $g1) (local.get $a))))
+      (local.set $t (i32.load offset=108 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.shl (local.get $t) (i32.xor (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t))))
+      (local.set $t (i32.xor (i32.rotl (global.get $g2) (local.get $t)) (i32.xor (global.get $g1) (global.get $g2))))
+      (local.set $t (i32.mul (i32.load offset=112 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.shl (local.get $t) (i32.const -94))))
+      (local.set $t (call $f71 (local.get $t) (i32.sub (local.get $a) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 84)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f93 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.mul (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.xor (local.get $a) (i32.const -886))))
+        (i32.store offset=232 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.sub (i32.mul (i32.load offset=4 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g3)) (i32.and (local.get $b) (local.get $t))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 12)))
+      end
+      (local.set $t (call $f7 (local.get $t) (i32.shr_u (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 443))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 82)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f94 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (local.get $b) (global.get $g2))
+        (then (local.set $t (i32.add (i32.shr_u (global.get $g2) (local.get $b)) (i32.and (global.get $g3) (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+        (else
+          (if (i32.eqz (i32.load offset=4 (i32.and (local.get $a) (i32.const 0xfffc))))
+            (then (local.set $t (i32.xor (i32.or (i32.const 144) (global.get $g1)) (i32.xor (i32.const 415) (local.get $a)))))
+            (else (local.set $t (i32.sub (i32.and (local.get $a) (local.get $b)) (i32.shl (i32.const -229) (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc))))))))))
+      (local.set $t (call $f9 (local.get $t) (i32.const 743)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 59)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f95 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (local.get $b) (i32.const 3)))
+          end
+          (local.set $t (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc))))
+          (br $default)
+        end
+        (local.set $t (i32.sub (i32.add (local.get $t) (i32.const -876)) (i32.and (local.get $b) (local.get $b))))
+      end
+      (local.set $t (call $f52 (local.get $t) (i32.shr_u (i32.load offset=88 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -608))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 88)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f96 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.rotl (i32.rotl (local.get $t) (local.get $b)) (i32.shl (i32.const -336) (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.and (i32.const -808) (i32.sub (i32.const 600) (global.get $g1))))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.sub (i32.shl (i32.const 43) (local.get $b)) (i32.load offset=48 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (i32.xor (i32.mul (i32.const 352) (local.get $b)) (i32.mul (global.get $g0) (i32.load offset=180 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.mul (i32.or (i32.load offset=4 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b)) (local.get $t)))
+      (local.set $t (i32.load offset=24 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.shr_u (i32.load offset=112 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -653)))
+      (local.set $t (call $f5 (local.get $t) (i32.load offset=104 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 89)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f97 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.const -563))
+        (i32.store offset=8 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.shl (i32.xor (local.get $t) (local.get $t)) (i32.mul (i32.const -810) (i32.const 407))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 11)))
+      end
+      (local.set $t (call $f67 (local.get $t) (i32.sub (i32.const -463) (i32.load offset=0 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 93)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f98 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.shl (global.get $g3) (i32.or (local.get $b) (i32.load offset=208 (i32.and (local.get $a) (i32.const 0xfffc))))) (i32.load offset=84 (i32.and (local.get $a) (i32.const 0xfffc))))
+        (then (local.set $t (i32.shr_u (local.get $b) (i32.load offset=220 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (else
+          (if (i32.eqz (i32.load offset=80 (i32.and (local.get $a) (i32.const 0xfffc))))
+            (then (local.set $t (i32.and (i32.load offset=84 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.sub (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)))))
+            (else (local.set $t (local.get $a))))))
+      (local.set $t (call $f47 (local.get $t) (i32.mul (local.get $t) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 75)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f99 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.xor (i32.rotl (i32.load offset=84 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 184)) (i32.rotl (local.get $a) (global.get $g0))) (i32.const 3)))
+          end
+          (local.set $t (i32.shl (i32.sub (global.get $g1) (i32.load offset=128 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.or (i32.load offset=56 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc))))))
+          (br $default)
+        end
+        (local.set $t (i32.xor (local.get $b) (i32.rotl (local.get $t) (local.get $a))))
+      end
+      (local.set $t (call $f98 (local.get $t) (i32.const -501)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 43)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f100 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.const 766))
+      (local.set $t (i32.or (i32.and (i32.load offset=72 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (i32.load offset=220 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (i32.and (local.get $b) (i32.mul (local.get $b) (local.get $b))))
+      (local.set $t (i32.and (local.get $b) (local.get $t)))
+      (local.set $t (call $f91 (local.get $t) (i32.mul (global.get $g1) (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 33)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f101 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.add (i32.or (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g3)) (i32.add (local.get $a) (local.get $b))))
+        (i32.store offset=228 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (local.get $b))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 10)))
+      end
+      (local.set $t (call $f98 (local.get $t) (global.get $g1)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 27)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f102 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.sub (i32.rotl (local.get $a) (local.get $a)) (i32.xor (i32.load offset=72 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=236 (i32.and (local.get $a) (i32.const 0xfffc))))) (i32.xor (i32.mul (local.get $a) (i32.load offset=0 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.mul (local.get $a) (global.get $g3))))
+        (then (local.set $t (local.get $a)))
+        (else
+          (if (i32.eqz (global.get $g3))
+            (then (local.set $t (i32.add (i32.and (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g0)) (i32.shl (local.get $b) (local.get $a)))))
+            (else (local.set $t (i32.add (i32.shr_u (local.get $t) (global.get $g0)) (i32.mul (global.get $g2) (local.get $t))))))))
+      (local.set $t (call $f88 (local.get $t) (i32.or (i32.load offset=88 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 13)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f103 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.sub (i32.load offset=128 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 561)) (i32.const 3)))
+          end
+          (local.set $t (global.get $g0))
+          (br $default)
+        end
+        (local.set $t (i32.rotl (i32.shr_u (i32.const 226) (i32.const -48)) (local.get $b)))
+      end
+      (local.set $t (call $f63 (local.get $t) (i32.add (local.get $a) (i32.const 736))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 95)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f104 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.shl (local.get $t) (i32.shl (global.get $g3) (i32.const 450))))
+      (local.set $t (i32.mul (i32.or (local.get $t) (global.get $g0)) (i32.shr_u (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 118))))
+      (local.set $t (i32.shl (i32.xor (local.get $b) (global.get $g1)) (i32.load offset=20 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (i32.rotl (i32.shr_u (local.get $b) (local.get $a)) (i32.add (local.get $b) (i32.load offset=20 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.shl (i32.mul (i32.const -332) (local.get $b)) (i32.mul (i32.const 452) (local.get $a))))
+      (local.set $t (i32.sub (i32.add (i32.const 858) (local.get $t)) (local.get $a)))
+      (local.set $t (call $f11 (local.get $t) (i32.shl (local.get $b) (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 91)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f105 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.and (i32.sub (local.get $b) (i32.load offset=80 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.sub (local.get $b) (local.get $t))))
+        (i32.store offset=192 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.const 795))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 7)))
+      end
+      (local.set $t (call $f87 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 21)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f106 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (local.get $b) (i32.shl (i32.mul (global.get $g0) (local.get $a)) (local.get $b)))
+        (then (local.set $t (i32.const -198)))
+        (else
+          (if (i32.eqz (local.get $b))
+            (then (local.set $t (i32.and (i32.and (i32.load offset=204 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)) (i32.shr_u (i32.const -310) (i32.load offset=248 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+            (else (local.set $t (i32.add (i32.and (i32.const -809) (global.get $g2)) (i32.shl (global.get $g0) (local.get $t))))))))
+      (local.set $t (call $f81 (local.get $t) (i32.or (i32.const 632) (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 60)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f107 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.and (i32.or (global.get $g2) (i32.const -671)) (i32.rotl (global.get $g1) (local.get $a))) (i32.const 3)))
+          end
+          (local.set $t (local.get $a))
+          (br $default)
+        end
+        (local.set $t (i32.shr_u (i32.add (local.get $a) (local.get $b)) (i32.rotl (local.get $a) (i32.load offset=4 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      end
+      (local.set $t (call $f96 (local.get $t) (i32.add (local.get $t) (global.get $g1))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 99)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f108 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (local.get $b))
+      (local.set $t (i32.shr_u (i32.mul (local.get $t) (local.get $t)) (local.get $b)))
+      (local.set $t (i32.sub (local.get $b) (i32.and (i32.const 773) (local.get $t))))
+      (local.set $t (local.get $a))
+      (local.set $t (call $f42 (local.get $t) (i32.add (i32.const -496) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 78)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f109 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.sub (global.get $g1) (i32.mul (i32.const -23) (local.get $t))))
+        (i32.store offset=220 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.const -895))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 12)))
+      end
+      (local.set $t (call $f3 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 78)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f110 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.shl (i32.or (i32.const 547) (local.get $b)) (i32.load offset=4 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.sub (i32.sub (local.get $b) (i32.const 508)) (i32.const -995)))
+        (then (local.set $t (i32.xor (local.get $b) (i32.rotl (i32.const 596) (local.get $t)))))
+        (else
+          (if (i32.eqz (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc))))
+            (then (local.set $t (i32.rotl (global.get $g2) (i32.shl (local.get $a) (global.get $g1)))))
+            (else (local.set $t (i32.shr_u (i32.shl (local.get $t) (local.get $t)) (i32.or (i32.const 580) (local.get $t))))))))
+      (local.set $t (call $f51 (local.get $t) (i32.shl (local.get $b) (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 86)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f111 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.xor (i32.add (local.get $a) (global.get $g2)) (i32.or (local.get $t) (local.get $b))) (i32.const 3)))
+          end
+          (local.set $t (i32.xor (i32.shr_u (local.get $a) (local.get $b)) (i32.shr_u (local.get $a) (local.get $a))))
+          (br $default)
+        end
+        (local.set $t (i32.add (i32.and (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      end
+      (local.set $t (call $f12 (local.get $t) (i32.load offset=168 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 7)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f112 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (global.get $g1))
+      (local.set $t (i32.load offset=144 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.mul (i32.or (local.get $b) (local.get $b)) (i32.rotl (local.get $b) (i32.load offset=36 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.add (i32.const -893) (i32.or (local.get $b) (global.get $g1))))
+      (local.set $t (i32.shr_u (i32.or (local.get $b) (global.get $g1)) (local.get $t)))
+      (local.set $t (i32.rotl (i32.mul (i32.load offset=92 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (global.get $g1) (i32.const -315))))
+      (local.set $t (call $f91 (local.get $t) (local.get $a)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 11)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f113 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc))))
+        (i32.store offset=156 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.xor (i32.xor (local.get $b) (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.xor (local.get $b) (i32.load offset=200 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 9)))
+      end
+      (local.set $t (call $f26 (local.get $t) (i32.shr_u (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=4 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 32)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f114 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.add (i32.shl (local.get $b) (local.get $t)) (i32.const -921)) (local.get $a))
+        (then (local.set $t (i32.and (i32.mul (i32.load offset=120 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -461)) (i32.const 293))))
+        (else
+          (if (i32.eqz (local.get $a))
+            (then (local.set $t (i32.shr_u (i32.const -843) (i32.xor (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)))))
+            (else (local.set $t (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc))))))))
+      (local.set $t (call $f95 (local.get $t) (i32.shl (i32.load offset=180 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 80)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f115 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (local.get $t) (i32.const 3)))
+          end
+          (local.set $t (i32.or (i32.and (global.get $g2) (local.get $a)) (i32.shr_u (local.get $t) (local.get $a))))
+          (br $default)
+        end
+        (local.set $t (local.get $t))
+      end
+      (local.set $t (call $f70 (local.get $t) (i32.xor (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 31)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f116 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.xor (i32.rotl (i32.const 531) (local.get $b)) (i32.add (i32.load offset=220 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=104 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.xor (i32.shl (local.get $b) (local.get $a)) (i32.xor (i32.load offset=196 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (i32.mul (i32.and (local.get $a) (local.get $a)) (i32.sub (local.get $b) (local.get $t))))
+      (local.set $t (i32.and (i32.mul (local.get $a) (i32.load offset=52 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (i32.load offset=112 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t))))
+      (local.set $t (i32.shr_u (i32.and (global.get $g2) (i32.load offset=204 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.sub (local.get $t) (local.get $b))))
+      (local.set $t (i32.mul (i32.sub (i32.const 506) (local.get $t)) (i32.load offset=128 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.rotl (i32.rotl (local.get $b) (global.get $g2)) (local.get $a)))
+      (local.set $t (i32.add (i32.xor (global.get $g0) (global.get $g3)) (i32.xor (local.get $a) (local.get $a))))
+      (local.set $t (i32.add (local.get $b) (i32.and (local.get $a) (i32.const -540))))
+      (local.set $t (call $f38 (local.get $t) (i32.shr_u (local.get $a) (global.get $g3))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 54)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f117 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.and (i32.shl (global.get $g1) (i32.load offset=108 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $a)))
+        (i32.store offset=164 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.sub (i32.xor (local.get $b) (local.get $t)) (local.get $t)))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 14)))
+      end
+      (local.set $t (call $f92 (local.get $t) (local.get $t)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 12)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f118 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.xor (i32.rotl (i32.const 230) (global.get $g3)) (i32.xor (i32.const -857) (local.get $t))) (i32.xor (global.get $g2) (i32.and (i32.load offset=168 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+        (then (local.set $t (i32.mul (i32.add (local.get $t) (local.get $a)) (i32.shl (global.get $g1) (global.get $g2)))))
+        (else
+          (if (i32.eqz (i32.xor (i32.sub (global.get $g3) (global.get $g0)) (i32.shr_u (global.get $g1) (local.get $t))))
+            (then (local.set $t (i32.add (i32.rotl (local.get $a) (local.get $b)) (i32.sub (i32.load offset=24 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g2)))))
+            (else (local.set $t (local.get $b))))))
+      (local.set $t (call $f53 (local.get $t) (i32.mul (i32.const 920) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 59)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f119 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.xor (i32.shr_u (i32.const -148) (local.get $b)) (i32.sub (local.get $a) (i32.load offset=132 (i32.and (local.get $a) (i32.const 0xfffc))))) (i32.const 3)))
+          end
+          (local.set $t (i32.shr_u (i32.mul (global.get $g1) (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.or (global.get $g2) (global.get $g3))))
+          (br $default)
+        end
+        (local.set $t (i32.xor (i32.or (local.get $t) (local.get $b)) (i32.xor (i32.const 126) (local.get $a))))
+      end
+      (local.set $t (call $f104 (local.get $t) (i32.and (local.get $t) (i32.load offset=84 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 112)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f120 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.and (i32.shl (local.get $t) (local.get $b)) (local.get $b)))
+      (local.set $t (i32.sub (i32.sub (local.get $a) (i32.load offset=68 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $t)))
+      (local.set $t (i32.shr_u (i32.shr_u (i32.const 609) (local.get $t)) (i32.shr_u (i32.const 160) (local.get $b))))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.const -217))
+      (local.set $t (i32.const -403))
+      (local.set $t (i32.shl (i32.add (local.get $a) (i32.const -941)) (local.get $b)))
+      (local.set $t (call $f59 (local.get $t) (i32.rotl (i32.const -629) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 15)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f121 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.add (i32.const -348) (i32.add (global.get $g2) (local.get $t))))
+        (i32.store offset=148 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.xor (i32.add (local.get $a) (i32.const 145)) (local.get $b)))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 11)))
+      end
+      (local.set $t (call $f0 (local.get $t) (i32.rotl (local.get $b) (i32.load offset=76 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 28)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f122 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.and (local.get $b) (i32.mul (i32.const -225) (global.get $g1))) (i32.rotl (local.get $b) (i32.xor (local.get $b) (i32.const -87))))
+        (then (local.set $t (local.get $b)))
+        (else
+          (if (i32.eqz (i32.and (local.get $a) (i32.sub (i32.const 588) (local.get $t))))
+            (then (local.set $t (i32.and (global.get $g1) (local.get $t))))
+            (else (local.set $t (i32.add (i32.shl (local.get $t) (local.get $b)) (i32.xor (global.get $g1) (global.get $g3))))))))
+      (local.set $t (call $f5 (local.get $t) (i32.const 788)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 77)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f123 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.shl (local.get $t) (i32.mul (i32.const -81) (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc))))) (i32.const 3)))
+          end
+          (local.set $t (i32.shl (i32.load offset=24 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.mul (global.get $g1) (i32.load offset=220 (i32.and (local.get $a) (i32.const 0xfffc))))))
+          (br $default)
+        end
+        (local.set $t (i32.shl (local.get $a) (i32.or (local.get $a) (local.get $a))))
+      end
+      (local.set $t (call $f7 (local.get $t) (i32.load offset=216 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 5)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f124 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.shr_u (local.get $b) (i32.xor (global.get $g0) (i32.load offset=164 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.and (i32.const -457) (local.get $a)))
+      (local.set $t (i32.sub (i32.rotl (i32.const 366) (i32.load offset=20 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (i32.const -542) (i32.load offset=116 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.xor (i32.and (i32.load offset=108 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)) (i32.sub (global.get $g3) (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (local.get $t))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.const -897))
+      (local.set $t (i32.mul (i32.mul (global.get $g1) (local.get $t)) (local.get $a)))
+      (local.set $t (i32.and (i32.const -712) (local.get $a)))
+      (local.set $t (global.get $g2))
+      (local.set $t (call $f57 (local.get $t) (i32.shr_u (local.get $b) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 37)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f125 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.shr_u (i32.shl (local.get $b) (i32.const -865)) (i32.sub (global.get $g0) (local.get $b))))
+        (i32.store offset=176 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.const 767))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 15)))
+      end
+      (local.set $t (call $f56 (local.get $t) (i32.shl (local.get $t) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 78)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f126 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.mul (i32.mul (global.get $g1) (local.get $b)) (i32.or (local.get $t) (local.get $t))) (local.get $t))
+        (then (local.set $t (i32.xor (i32.mul (global.get $g0) (local.get $b)) (local.get $t))))
+        (else
+          (if (i32.eqz (i32.rotl (i32.const -201) (i32.shl (local.get $t) (i32.const -85))))
+            (then (local.set $t (i32.shr_u (i32.mul (i32.const -613) (local.get $b)) (i32.sub (i32.load offset=4 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -7)))))
+            (else (local.set $t (local.get $t))))))
+      (local.set $t (call $f107 (local.get $t) (i32.add (local.get $b) (global.get $g2))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 41)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f127 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (global.get $g2) (i32.const 3)))
+          end
+          (local.set $t (i32.xor (i32.xor (local.get $t) (global.get $g3)) (i32.and (local.get $t) (local.get $a))))
+          (br $default)
+        end
+        (local.set $t (i32.shr_u (i32.add (local.get $a) (i32.load offset=120 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shr_u (i32.const -112) (global.get $g3))))
+      end
+      (local.set $t (call $f112 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 86)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f128 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (local.get $t))
+      (local.set $t (i32.mul (local.get $b) (i32.shl (i32.const 162) (local.get $t))))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.or (local.get $a) (i32.sub (local.get $a) (local.get $t))))
+      (local.set $t (local.get $a))
+      (local.set $t (call $f19 (local.get $t) (i32.shl (i32.load offset=132 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 389))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 57)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f129 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.sub (i32.mul (local.get $t) (local.get $t)) (i32.shr_u (local.get $t) (i32.load offset=168 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (i32.store offset=92 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.shl (local.get $t) (i32.or (local.get $b) (local.get $a))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 14)))
+      end
+      (local.set $t (call $f0 (local.get $t) (i32.sub (local.get $b) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 95)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f130 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.xor (i32.rotl (local.get $t) (local.get $a)) (i32.or (local.get $t) (i32.load offset=192 (i32.and (local.get $a) (i32.const 0xfffc))))) (i32.const 725))
+        (then (local.set $t (global.get $g1)))
+        (else
+          (if (i32.eqz (i32.add (i32.rotl (local.get $t) (i32.const -892)) (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc)))))
+            (then (local.set $t (i32.rotl (i32.xor (local.get $b) (local.get $a)) (i32.const -328))))
+            (else (local.set $t (i32.add (i32.shr_u (global.get $g2) (i32.const -42)) (i32.sub (local.get $t) (local.get $t))))))))
+      (local.set $t (call $f31 (local.get $t) (i32.load offset=104 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 13)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f131 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.shl (local.get $b) (global.get $g1)) (i32.const 3)))
+          end
+          (local.set $t (i32.xor (i32.shr_u (local.get $a) (local.get $b)) (i32.const -946)))
+          (br $default)
+        end
+        (local.set $t (i32.xor (i32.and (i32.const 123) (local.get $a)) (local.get $t)))
+      end
+      (local.set $t (call $f62 (local.get $t) (i32.xor (local.get $a) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 110)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f132 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.and (i32.xor (i32.load offset=220 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b)) (i32.mul (local.get $t) (local.get $a))))
+      (local.set $t (global.get $g2))
+      (local.set $t (i32.or (i32.and (local.get $b) (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $b)))
+      (local.set $t (i32.shl (i32.sub (local.get $b) (local.get $t)) (i32.add (local.get $b) (local.get $a))))
+      (local.set $t (i32.shr_u (local.get $a) (local.get $t)))
+      (local.set $t (i32.or (global.get $g2) (i32.load offset=116 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call $f104 (local.get $t) (i32.sub (i32.const -558) (i32.load offset=0 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 122)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f133 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.xor (i32.rotl (local.get $a) (local.get $a)) (i32.add (i32.const -275) (local.get $a))))
+        (i32.store offset=28 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.shl (i32.rotl (i32.const 632) (local.get $t)) (i32.shl (i32.const -75) (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 13)))
+      end
+      (local.set $t (call $f13 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 58)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f134 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.shr_u (i32.add (local.get $t) (local.get $b)) (i32.and (local.get $a) (local.get $a))) (i32.sub (i32.rotl (local.get $b) (i32.const 979)) (i32.shr_u (i32.load offset=52 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+        (then (local.set $t (i32.shl (i32.shr_u (global.get $g2) (local.get $t)) (i32.shl (global.get $g3) (local.get $t)))))
+        (else
+          (if (i32.eqz (i32.sub (i32.and (local.get $t) (local.get $t)) (i32.and (local.get $a) (i32.load offset=212 (i32.and (local.get $a) (i32.const 0xfffc))))))
+            (then (local.set $t (i32.and (local.get $a) (global.get $g0))))
+            (else (local.set $t (global.get $g3))))))
+      (local.set $t (call $f66 (local.get $t) (i32.load offset=152 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 104)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f135 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.mul (i32.mul (local.get $b) (i32.load offset=236 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.xor (i32.const 356) (local.get $t))) (i32.const 3)))
+          end
+          (local.set $t (i32.add (i32.rotl (local.get $a) (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (i32.const -681) (local.get $t))))
+          (br $default)
+        end
+        (local.set $t (i32.shl (global.get $g3) (i32.add (local.get $a) (i32.const -626))))
+      end
+      (local.set $t (call $f58 (local.get $t) (i32.xor (local.get $a) (i32.const 58))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 47)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f136 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.add (i32.rotl (local.get $b) (global.get $g1)) (i32.mul (local.get $t) (local.get $b))))
+      (local.set $t (i32.or (i32.mul (global.get $g2) (local.get $b)) (local.get $a)))
+      (local.set $t (i32.mul (i32.mul (i32.const -103) (i32.load offset=232 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shl (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (i32.add (i32.and (local.get $a) (global.get $g3)) (local.get $a)))
+      (local.set $t (i32.const 739))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.mul (local.get $a) (local.get $b)))
+      (local.set $t (call $f131 (local.get $t) (i32.load offset=92 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 124)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f137 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.sub (i32.sub (local.get $t) (i32.load offset=228 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (local.get $b) (i32.load offset=28 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (i32.store offset=184 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.or (local.get $b) (local.get $a)))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 8)))
+      end
+      (local.set $t (call $f14 (local.get $t) (i32.rotl (local.get $t) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 99)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f138 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.add (i32.sub (i32.load offset=160 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g2)) (i32.xor (global.get $g0) (global.get $g0))) (i32.add (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.add (local.get $t) (local.get $b))))
+        (then (local.set $t (i32.or (i32.sub (i32.const -709) (global.get $g2)) (i32.mul (local.get $a) (local.get $a)))))
+        (else
+          (if (i32.eqz (local.get $t))
+            (then (local.set $t (i32.rotl (global.get $g0) (i32.const -945))))
+            (else (local.set $t (i32.add (i32.rotl (local.get $b) (local.get $t)) (i32.and (i32.load offset=4 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g1))))))))
+      (local.set $t (call $f39 (local.get $t) (i32.add (local.get $a) (i32.const -376))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 16)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f139 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.add (i32.shl (i32.load offset=88 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -685)) (local.get $b)) (i32.const 3)))
+          end
+          (local.set $t (local.get $t))
+          (br $default)
+        end
+        (local.set $t (i32.shr_u (i32.or (local.get $t) (i32.const 709)) (i32.shr_u (local.get $b) (local.get $a))))
+      end
+      (local.set $t (call $f119 (local.get $t) (i32.shl (i32.load offset=136 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 97)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f140 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.load offset=68 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.or (i32.const 940) (i32.rotl (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (local.get $t))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.add (global.get $g0) (i32.and (i32.const -954) (local.get $b))))
+      (local.set $t (i32.shr_u (i32.load offset=8 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.and (i32.const -534) (i32.load offset=40 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.load offset=20 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.add (i32.xor (local.get $t) (local.get $a)) (local.get $t)))
+      (local.set $t (i32.load offset=120 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (call $f120 (local.get $t) (i32.mul (i32.const -22) (i32.const -785))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 83)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f141 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.add (i32.xor (local.get $b) (local.get $t)) (i32.xor (global.get $g1) (global.get $g0))))
+        (i32.store offset=76 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.sub (i32.rotl (local.get $t) (i32.load offset=232 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.add (local.get $a) (i32.load offset=200 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 15)))
+      end
+      (local.set $t (call $f4 (local.get $t) (i32.shr_u (local.get $b) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 37)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f142 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.and (i32.shr_u (local.get $t) (local.get $a)) (i32.rotl (i32.const 504) (local.get $t))) (global.get $g1))
+        (then (local.set $t (i32.rotl (i32.or (local.get $a) (local.get $b)) (i32.mul (i32.load offset=208 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)))))
+        (else
+          (if (i32.eqz (local.get $b))
+            (then (local.set $t (i32.or (i32.shl (global.get $g2) (local.get $t)) (i32.mul (local.get $t) (i32.load offset=172 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+            (else (local.set $t (i32.xor (i32.rotl (local.get $b) (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (local.get $a) (global.get $g3))))))))
+      (local.set $t (call $f117 (local.get $t) (local.get $a)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 51)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f143 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.xor (i32.sub (local.get $a) (i32.load offset=228 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.rotl (i32.const -592) (local.get $t))) (i32.const 3)))
+          end
+          (local.set $t (i32.sub (i32.shl (global.get $g2) (local.get $a)) (i32.and (i32.const -372) (local.get $b))))
+          (br $default)
+        end
+        (local.set $t (local.get $t))
+      end
+      (local.set $t (call $f82 (local.get $t) (i32.add (global.get $g0) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 131)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f144 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (local.get $b))
+      (local.set $t (global.get $g2))
+      (local.set $t (i32.mul (i32.or (local.get $a) (local.get $b)) (i32.add (global.get $g3) (i32.const -514))))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.and (local.get $a) (i32.rotl (local.get $b) (local.get $t))))
+      (local.set $t (i32.and (global.get $g3) (i32.shl (global.get $g1) (i32.const 383))))
+      (local.set $t (i32.const -642))
+      (local.set $t (i32.mul (i32.mul (global.get $g0) (i32.load offset=180 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.rotl (i32.load offset=88 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (i32.add (i32.add (global.get $g3) (local.get $a)) (local.get $a)))
+      (local.set $t (call $f37 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 49)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f145 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.sub (i32.xor (global.get $g3) (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (local.get $t) (local.get $t))))
+        (i32.store offset=188 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.add (local.get $a) (local.get $b)))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 6)))
+      end
+      (local.set $t (call $f41 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 16)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f146 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (global.get $g3) (i32.or (i32.mul (i32.const 891) (local.get $b)) (local.get $b)))
+        (then (local.set $t (local.get $a)))
+        (else
+          (if (i32.eqz (i32.shr_u (local.get $a) (i32.xor (local.get $t) (local.get $b))))
+            (then (local.set $t (i32.shr_u (i32.shl (i32.const -425) (local.get $t)) (i32.xor (local.get $b) (local.get $b)))))
+            (else (local.set $t (i32.and (i32.xor (local.get $b) (i32.load offset=204 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (global.get $g2) (i32.const 526))))))))
+      (local.set $t (call $f72 (local.get $t) (i32.sub (local.get $a) (i32.const -441))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 13)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f147 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.and (i32.add (local.get $t) (local.get $t)) (i32.add (global.get $g1) (local.get $a))) (i32.const 3)))
+          end
+          (local.set $t (i32.load offset=208 (i32.and (local.get $a) (i32.const 0xfffc))))
+          (br $default)
+        end
+        (local.set $t (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc))))
+      end
+      (local.set $t (call $f62 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 87)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f148 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.sub (i32.or (global.get $g3) (i32.load offset=160 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shl (local.get $a) (i32.load offset=248 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.sub (i32.mul (i32.const 612) (i32.load offset=88 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $a)))
+      (local.set $t (i32.and (i32.mul (local.get $t) (i32.const 469)) (local.get $t)))
+      (local.set $t (i32.sub (i32.shl (i32.const -505) (global.get $g2)) (i32.and (i32.const -793) (i32.load offset=216 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.mul (i32.mul (local.get $a) (local.get $a)) (i32.shl (local.get $t) (local.get $b))))
+      (local.set $t (i32.shl (i32.sub (global.get $g2) (i32.const -161)) (local.get $b)))
+      (local.set $t (call $f92 (local.get $t) (i32.rotl (local.get $a) (i32.const -525))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 101)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f149 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.mul (i32.xor (local.get $t) (i32.const 816)) (i32.rotl (i32.load offset=236 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -503))))
+        (i32.store offset=176 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.load offset=28 (i32.and (local.get $a) (i32.const 0xfffc))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 10)))
+      end
+      (local.set $t (call $f31 (local.get $t) (i32.rotl (local.get $a) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 21)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f150 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (local.get $a) (i32.load offset=80 (i32.and (local.get $a) (i32.const 0xfffc))))
+        (then (local.set $t (local.get $a)))
+        (else
+          (if (i32.eqz (i32.mul (i32.const 882) (local.get $a)))
+            (then (local.set $t (i32.xor (local.get $a) (local.get $b))))
+            (else (local.set $t (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc))))))))
+      (local.set $t (call $f104 (local.get $t) (i32.shr_u (global.get $g0) (i32.load offset=48 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 64)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f151 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.xor (local.get $b) (i32.shl (i32.const -813) (i32.load offset=24 (i32.and (local.get $a) (i32.const 0xfffc))))) (i32.const 3)))
+          end
+          (local.set $t (local.get $b))
+          (br $default)
+        end
+        (local.set $t (i32.or (i32.rotl (i32.load offset=144 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g0)) (i32.shr_u (i32.const 572) (local.get $a))))
+      end
+      (local.set $t (call $f93 (local.get $t) (i32.const -652)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 42)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f152 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.shl (i32.rotl (local.get $a) (local.get $a)) (i32.and (local.get $a) (local.get $b))))
+      (local.set $t (i32.mul (i32.mul (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b)) (global.get $g3)))
+      (local.set $t (i32.rotl (i32.and (local.get $t) (i32.load offset=12 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shr_u (global.get $g1) (i32.load offset=72 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.const -232))
+      (local.set $t (call $f76 (local.get $t) (i32.shl (local.get $b) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 19)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f153 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.rotl (i32.and (local.get $t) (local.get $a)) (i32.shl (local.get $t) (i32.const 901))))
+        (i32.store offset=48 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.shr_u (i32.or (local.get $b) (local.get $t)) (i32.add (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 2)))
+      end
+      (local.set $t (call $f68 (local.get $t) (i32.shl (local.get $t) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 131)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f154 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (local.get $t) (i32.const -558))
+        (then (local.set $t (i32.xor (i32.sub (i32.load offset=232 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b)) (local.get $a))))
+        (else
+          (if (i32.eqz (i32.add (i32.add (i32.const -989) (i32.const 849)) (local.get $b)))
+            (then (local.set $t (i32.and (i32.and (local.get $b) (i32.const 857)) (i32.shr_u (global.get $g3) (local.get $b)))))
+            (else (local.set $t (i32.add (i32.xor (local.get $b) (local.get $a)) (i32.and (local.get $t) (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc))))))))))
+      (local.set $t (call $f8 (local.get $t) (i32.sub (local.get $a) (global.get $g3))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 102)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f155 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.shl (i32.xor (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g3)) (i32.const 944)) (i32.const 3)))
+          end
+          (local.set $t (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc))))
+          (br $default)
+        end
+        (local.set $t (i32.shl (i32.or (local.get $t) (i32.const -631)) (local.get $b)))
+      end
+      (local.set $t (call $f38 (local.get $t) (i32.xor (i32.const 188) (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 73)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f156 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.and (i32.or (global.get $g0) (global.get $g1)) (i32.mul (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -497))))
+      (local.set $t (i32.add (i32.add (i32.load offset=172 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const -324)) (global.get $g0)))
+      (local.set $t (i32.or (local.get $a) (i32.mul (i32.load offset=160 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t))))
+      (local.set $t (i32.sub (global.get $g0) (i32.const -212)))
+      (local.set $t (i32.and (i32.shl (local.get $a) (local.get $t)) (i32.xor (local.get $b) (local.get $b))))
+      (local.set $t (i32.const 398))
+      (local.set $t (call $f95 (local.get $t) (i32.rotl (i32.const -242) (global.get $g3))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 25)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f157 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.mul (local.get $t) (i32.shr_u (local.get $a) (local.get $b))))
+        (i32.store offset=228 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.mul (i32.add (local.get $b) (local.get $a)) (i32.or (local.get $a) (i32.const -836))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 12)))
+      end
+      (local.set $t (call $f109 (local.get $t) (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 34)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f158 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.shl (i32.sub (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 838)) (local.get $b)) (i32.or (local.get $t) (i32.and (i32.load offset=212 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+        (then (local.set $t (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc)))))
+        (else
+          (if (i32.eqz (i32.add (local.get $t) (i32.shl (i32.const 252) (i32.load offset=156 (i32.and (local.get $a) (i32.const 0xfffc))))))
+            (then (local.set $t (i32.and (i32.sub (i32.const 632) (i32.const -137)) (global.get $g1))))
+            (else (local.set $t (i32.load offset=120 (i32.and (local.get $a) (i32.const 0xfffc))))))))
+      (local.set $t (call $f74 (local.get $t) (i32.shl (i32.const -120) (global.get $g1))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 64)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f159 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.xor (i32.shl (local.get $t) (local.get $b)) (i32.rotl (i32.const 68) (global.get $g3))) (i32.const 3)))
+          end
+          (local.set $t (i32.shr_u (i32.rotl (local.get $t) (local.get $t)) (local.get $b)))
+          (br $default)
+        end
+        (local.set $t (i32.rotl (i32.shl (local.get $t) (local.get $a)) (local.get $t)))
+      end
+      (local.set $t (call $f98 (local.get $t) (local.get $a)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 115)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f160 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.xor (i32.sub (local.get $b) (local.get $a)) (i32.const 753)))
+      (local.set $t (local.get $a))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.or (i32.rotl (global.get $g0) (local.get $b)) (i32.const 510)))
+      (local.set $t (i32.sub (local.get $t) (i32.const -612)))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.and (local.get $b) (i32.mul (local.get $b) (i32.load offset=52 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.or (i32.rotl (local.get $a) (local.get $b)) (i32.shl (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=248 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call $f13 (local.get $t) (i32.shl (local.get $b) (i32.load offset=236 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 29)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f161 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.and (i32.load offset=184 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.xor (i32.const -141) (i32.load offset=40 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (i32.store offset=144 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.shr_u (i32.rotl (i32.const 905) (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.add (local.get $b) (local.get $t))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 12)))
+      end
+      (local.set $t (call $f44 (local.get $t) (i32.xor (i32.load offset=120 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 64)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f162 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.shl (i32.sub (global.get $g1) (local.get $b)) (i32.and (global.get $g1) (i32.const 45))) (i32.xor (i32.sub (local.get $t) (local.get $t)) (local.get $t)))
+        (then (local.set $t (i32.shl (i32.shr_u (global.get $g0) (global.get $g0)) (i32.mul (local.get $t) (local.get $b)))))
+        (else
+          (if (i32.eqz (i32.or (i32.mul (local.get $t) (global.get $g3)) (i32.or (global.get $g2) (i32.load offset=136 (i32.and (local.get $a) (i32.const 0xfffc))))))
+            (then (local.set $t (i32.sub (i32.add (i32.load offset=4 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b)) (i32.shr_u (global.get $g1) (local.get $a)))))
+            (else (local.set $t (i32.load offset=40 (i32.and (local.get $a) (i32.const 0xfffc))))))))
+      (local.set $t (call $f13 (local.get $t) (i32.mul (i32.load offset=72 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=224 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 159)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f163 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (local.get $a) (i32.const 3)))
+          end
+          (local.set $t (i32.or (i32.rotl (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (i32.const 171)))
+          (br $default)
+        end
+        (local.set $t (i32.or (global.get $g0) (i32.rotl (i32.const 181) (i32.load offset=144 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      end
+      (local.set $t (call $f92 (local.get $t) (i32.const -533)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 107)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f164 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.rotl (i32.shr_u (local.get $b) (local.get $b)) (local.get $b)))
+      (local.set $t (local.get $t))
+      (local.set $t (global.get $g3))
+      (local.set $t (i32.or (i32.xor (i32.const 908) (i32.const -762)) (i32.rotl (local.get $a) (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.mul (i32.mul (local.get $t) (local.get $a)) (i32.and (local.get $b) (global.get $g1))))
+      (local.set $t (i32.load offset=20 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.xor (i32.rotl (global.get $g1) (i32.const -148)) (global.get $g2)))
+      (local.set $t (i32.sub (global.get $g3) (i32.shr_u (i32.load offset=192 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.const 374))
+      (local.set $t (call $f148 (local.get $t) (i32.load offset=152 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 161)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f165 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.rotl (i32.or (local.get $t) (local.get $b)) (i32.and (local.get $a) (i32.const -783))))
+        (i32.store offset=88 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.load offset=172 (i32.and (local.get $a) (i32.const 0xfffc))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 9)))
+      end
+      (local.set $t (call $f119 (local.get $t) (local.get $t)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 49)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f166 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.or (i32.and (global.get $g3) (global.get $g2)) (local.get $t)) (i32.or (i32.mul (local.get $a) (i32.const -339)) (i32.add (i32.load offset=112 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+        (then (local.set $t (i32.and (i32.xor (i32.const -960) (global.get $g1)) (i32.mul (global.get $g3) (i32.const -17)))))
+        (else
+          (if (i32.eqz (i32.sub (i32.mul (global.get $g1) (local.get $a)) (local.get $a)))
+            (then (local.set $t (i32.rotl (i32.sub (local.get $b) (i32.load offset=112 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $t))))
+            (else (local.set $t (i32.const -234))))))
+      (local.set $t (call $f17 (local.get $t) (i32.shr_u (local.get $b) (i32.load offset=132 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 84)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f167 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (local.get $t) (i32.const 3)))
+          end
+          (local.set $t (local.get $b))
+          (br $default)
+        end
+        (local.set $t (local.get $b))
+      end
+      (local.set $t (call $f10 (local.get $t) (i32.rotl (global.get $g0) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 77)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f168 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (global.get $g0))
+      (local.set $t (i32.sub (i32.mul (global.get $g2) (local.get $b)) (i32.xor (global.get $g3) (local.get $b))))
+      (local.set $t (i32.mul (i32.xor (i32.const -143) (local.get $a)) (i32.sub (local.get $a) (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.rotl (i32.const 325) (global.get $g0)))
+      (local.set $t (i32.rotl (local.get $t) (i32.shl (i32.load offset=52 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=196 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.shr_u (local.get $a) (global.get $g0)))
+      (local.set $t (i32.load offset=220 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.rotl (i32.shr_u (local.get $t) (local.get $a)) (local.get $t)))
+      (local.set $t (i32.or (i32.shr_u (i32.load offset=40 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (i32.mul (i32.const -930) (local.get $a))))
+      (local.set $t (i32.and (local.get $b) (i32.shl (local.get $a) (local.get $b))))
+      (local.set $t (call $f9 (local.get $t) (i32.or (global.get $g3) (global.get $g2))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 91)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f169 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.shr_u (i32.shl (local.get $t) (i32.load offset=104 (i32.and (local.get $a) (i32.const 0xfffc)))) (global.get $g2)))
+        (i32.store offset=64 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (local.get $a))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 13)))
+      end
+      (local.set $t (call $f150 (local.get $t) (i32.sub (local.get $b) (global.get $g2))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 112)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f170 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (local.get $b) (local.get $b))
+        (then (local.set $t (i32.rotl (i32.mul (local.get $b) (local.get $b)) (i32.xor (global.get $g3) (i32.const 479)))))
+        (else
+          (if (i32.eqz (i32.const 538))
+            (then (local.set $t (i32.const 126)))
+            (else (local.set $t (i32.add (i32.or (local.get $a) (global.get $g1)) (i32.and (local.get $a) (local.get $b))))))))
+      (local.set $t (call $f155 (local.get $t) (global.get $g2)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 111)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f171 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.add (i32.rotl (global.get $g0) (i32.const 382)) (i32.add (global.get $g0) (global.get $g2))) (i32.const 3)))
+          end
+          (local.set $t (i32.shr_u (i32.rotl (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)) (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc)))))
+          (br $default)
+        end
+        (local.set $t (i32.xor (i32.or (global.get $g1) (local.get $t)) (i32.or (local.get $a) (i32.const -828))))
+      end
+      (local.set $t (call $f74 (local.get $t) (i32.or (i32.const -8) (global.get $g3))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 26)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f172 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (local.get $b))
+      (local.set $t (i32.sub (i32.shl (local.get $t) (global.get $g3)) (i32.xor (local.get $a) (local.get $t))))
+      (local.set $t (i32.load offset=156 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.sub (i32.load offset=236 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.shl (global.get $g0) (global.get $g1))))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.mul (i32.load offset=76 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.add (local.get $a) (i32.const -858))))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.sub (i32.add (local.get $t) (local.get $t)) (i32.or (global.get $g2) (i32.const -856))))
+      (local.set $t (i32.and (i32.shr_u (local.get $t) (global.get $g1)) (i32.rotl (global.get $g1) (global.get $g2))))
+      (local.set $t (i32.shl (i32.and (local.get $t) (i32.const 160)) (i32.add (i32.const -147) (global.get $g0))))
+      (local.set $t (i32.mul (global.get $g0) (i32.add (i32.const 535) (local.get $b))))
+      (local.set $t (call $f85 (local.get $t) (global.get $g1)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 46)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f173 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.mul (i32.and (global.get $g0) (i32.load offset=124 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $t)))
+        (i32.store offset=116 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.const -656))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 15)))
+      end
+      (local.set $t (call $f55 (local.get $t) (i32.or (local.get $t) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 123)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f174 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (local.get $b) (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc))))
+        (then (local.set $t (i32.rotl (i32.mul (global.get $g3) (local.get $a)) (i32.const 491))))
+        (else
+          (if (i32.eqz (local.get $t))
+            (then (local.set $t (i32.shl (i32.mul (local.get $a) (local.get $t)) (i32.mul (local.get $b) (local.get $t)))))
+            (else (local.set $t (i32.shl (local.get $b) (local.get $t)))))))
+      (local.set $t (call $f162 (local.get $t) (i32.rotl (global.get $g2) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 75)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f175 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (local.get $b) (i32.const 3)))
+          end
+          (local.set $t (i32.or (i32.or (local.get $t) (i32.load offset=48 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.mul (local.get $t) (local.get $t))))
+          (br $default)
+        end
+        (local.set $t (i32.add (i32.const 507) (i32.mul (i32.load offset=56 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      end
+      (local.set $t (call $f125 (local.get $t) (i32.const 767)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 78)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f176 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.or (i32.or (i32.const 952) (local.get $b)) (i32.or (local.get $a) (global.get $g0))))
+      (local.set $t (local.get $t))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.const -18))
+      (local.set $t (i32.rotl (i32.shl (global.get $g2) (local.get $a)) (i32.shl (local.get $t) (local.get $b))))
+      (local.set $t (i32.shr_u (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.shr_u (global.get $g0) (global.get $g3))))
+      (local.set $t (i32.shl (i32.and (global.get $g3) (local.get $t)) (i32.sub (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g0))))
+      (local.set $t (call $f52 (local.get $t) (i32.rotl (global.get $g2) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 94)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f177 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.shr_u (i32.sub (i32.load offset=28 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)) (i32.shr_u (i32.load offset=192 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 713))))
+        (i32.store offset=64 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.add (global.get $g1) (i32.load offset=128 (i32.and (local.get $a) (i32.const 0xfffc)))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 13)))
+      end
+      (local.set $t (call $f112 (local.get $t) (i32.shr_u (local.get $t) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 59)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f178 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.xor (global.get $g2) (i32.xor (local.get $b) (local.get $b))) (local.get $b))
+        (then (local.set $t (i32.or (i32.rotl (local.get $t) (i32.const 705)) (i32.xor (i32.load offset=144 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g2)))))
+        (else
+          (if (i32.eqz (i32.sub (local.get $a) (i32.shr_u (local.get $b) (local.get $a))))
+            (then (local.set $t (i32.mul (i32.add (local.get $t) (global.get $g1)) (i32.mul (i32.load offset=124 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)))))
+            (else (local.set $t (i32.const -110))))))
+      (local.set $t (call $f78 (local.get $t) (i32.sub (global.get $g2) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 17)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f179 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.mul (local.get $a) (i32.or (local.get $b) (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc))))) (i32.const 3)))
+          end
+          (local.set $t (i32.const -506))
+          (br $default)
+        end
+        (local.set $t (i32.load offset=172 (i32.and (local.get $a) (i32.const 0xfffc))))
+      end
+      (local.set $t (call $f139 (local.get $t) (i32.add (global.get $g1) (i32.load offset=108 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 128)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f180 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.shr_u (i32.add (i32.const 208) (global.get $g3)) (i32.load offset=136 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (i32.add (i32.shl (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=120 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.const -951)))
+      (local.set $t (i32.or (i32.sub (local.get $b) (i32.const 106)) (i32.or (local.get $t) (local.get $t))))
+      (local.set $t (i32.const -903))
+      (local.set $t (i32.and (i32.mul (local.get $a) (local.get $t)) (global.get $g1)))
+      (local.set $t (i32.shl (i32.and (local.get $b) (i32.load offset=112 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $t)))
+      (local.set $t (i32.rotl (i32.mul (i32.load offset=112 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=80 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shr_u (global.get $g2) (i32.const 298))))
+      (local.set $t (i32.or (i32.mul (local.get $t) (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shl (i32.const -174) (local.get $t))))
+      (local.set $t (global.get $g0))
+      (local.set $t (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (call $f3 (local.get $t) (i32.shl (i32.const -893) (i32.load offset=52 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 40)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f181 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.sub (i32.sub (global.get $g0) (global.get $g0)) (i32.xor (global.get $g1) (global.get $g2))))
+        (i32.store offset=92 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.shr_u (i32.sub (local.get $t) (global.get $g2)) (local.get $t)))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 2)))
+      end
+      (local.set $t (call $f155 (local.get $t) (i32.rotl (local.get $t) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 74)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f182 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.shl (i32.and (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 880)) (i32.sub (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 74))) (i32.and (i32.shr_u (i32.load offset=148 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b)) (i32.and (local.get $t) (global.get $g3))))
+        (then (local.set $t (i32.or (i32.load offset=72 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t))))
+        (else
+          (if (i32.eqz (i32.xor (local.get $t) (local.get $b)))
+            (then (local.set $t (local.get $b)))
+            (else (local.set $t (i32.and (local.get $t) (i32.rotl (local.get $b) (global.get $g1))))))))
+      (local.set $t (call $f45 (local.get $t) (local.get $a)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 179)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f183 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.load offset=136 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 3)))
+          end
+          (local.set $t (i32.sub (i32.or (i32.const -945) (i32.const -677)) (local.get $t)))
+          (br $default)
+        end
+        (local.set $t (global.get $g0))
+      end
+      (local.set $t (call $f92 (local.get $t) (i32.shl (i32.load offset=160 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 34)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f184 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (local.get $t))
+      (local.set $t (local.get $b))
+      (local.set $t (local.get $a))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.add (local.get $a) (i32.shl (global.get $g0) (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.add (local.get $a) (i32.xor (local.get $a) (global.get $g0))))
+      (local.set $t (i32.add (i32.or (i32.const -492) (i32.load offset=156 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.rotl (i32.load offset=8 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=52 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.rotl (global.get $g3) (local.get $b)))
+      (local.set $t (i32.shl (i32.shr_u (local.get $a) (local.get $t)) (i32.load offset=236 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.shl (i32.mul (local.get $a) (local.get $a)) (i32.and (i32.const 599) (global.get $g2))))
+      (local.set $t (call $f117 (local.get $t) (i32.and (global.get $g0) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 52)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f185 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.sub (i32.and (i32.load offset=168 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (i32.load offset=172 (i32.and (local.get $a) (i32.const 0xfffc)))))
+        (i32.store offset=252 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.xor (i32.const -889) (i32.and (global.get $g3) (local.get $a))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 12)))
+      end
+      (local.set $t (call $f52 (local.get $t) (i32.or (local.get $b) (global.get $g1))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 49)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f186 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.and (local.get $b) (i32.add (local.get $a) (local.get $b))) (i32.or (i32.mul (i32.const 453) (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.or (i32.const 655) (i32.load offset=204 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (then (local.set $t (local.get $a)))
+        (else
+          (if (i32.eqz (i32.rotl (i32.and (local.get $b) (global.get $g1)) (i32.or (local.get $b) (global.get $g2))))
+            (then (local.set $t (i32.shr_u (i32.mul (i32.load offset=36 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 354)) (local.get $b))))
+            (else (local.set $t (i32.or (i32.add (local.get $t) (local.get $a)) (local.get $t)))))))
+      (local.set $t (call $f114 (local.get $t) (i32.mul (i32.const 432) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 10)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f187 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.and (i32.and (local.get $b) (local.get $a)) (i32.sub (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))) (i32.const 3)))
+          end
+          (local.set $t (i32.and (i32.shl (i32.load offset=180 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (i32.shr_u (global.get $g3) (local.get $a))))
+          (br $default)
+        end
+        (local.set $t (i32.mul (i32.shr_u (i32.const -460) (global.get $g2)) (i32.shr_u (local.get $t) (i32.const -641))))
+      end
+      (local.set $t (call $f92 (local.get $t) (local.get $t)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 60)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f188 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (local.get $b))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.sub (global.get $g0) (i32.add (local.get $t) (local.get $t))))
+      (local.set $t (i32.mul (i32.and (i32.const -860) (local.get $b)) (i32.and (i32.const -543) (global.get $g1))))
+      (local.set $t (i32.and (i32.xor (local.get $b) (local.get $a)) (i32.load offset=0 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (i32.add (i32.or (local.get $b) (global.get $g2)) (i32.add (local.get $b) (local.get $a))))
+      (local.set $t (i32.const -864))
+      (local.set $t (i32.sub (local.get $a) (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.const 481))
+      (local.set $t (call $f72 (local.get $t) (i32.const -701)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 120)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f189 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.const -598))
+        (i32.store offset=72 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 12)))
+      end
+      (local.set $t (call $f143 (local.get $t) (i32.or (i32.load offset=212 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=124 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 6)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f190 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.add (i32.mul (i32.load offset=228 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 214)) (i32.mul (local.get $b) (local.get $a))) (i32.shl (global.get $g1) (i32.shl (local.get $a) (local.get $a))))
+        (then (local.set $t (i32.xor (i32.xor (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=168 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.mul (local.get $b) (i32.load offset=12 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+        (else
+          (if (i32.eqz (i32.shl (i32.const -808) (i32.const -72)))
+            (then (local.set $t (i32.or (i32.shr_u (local.get $t) (local.get $b)) (i32.sub (i32.const -229) (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+            (else (local.set $t (local.get $t))))))
+      (local.set $t (call $f103 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 38)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f191 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.shr_u (i32.shr_u (local.get $a) (i32.load offset=196 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.sub (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))) (i32.const 3)))
+          end
+          (local.set $t (i32.mul (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.shr_u (i32.const -938) (local.get $b))))
+          (br $default)
+        end
+        (local.set $t (i32.xor (i32.shl (local.get $t) (local.get $b)) (i32.xor (local.get $b) (i32.const -253))))
+      end
+      (local.set $t (call $f116 (local.get $t) (i32.shr_u (global.get $g3) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 52)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f192 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.rotl (i32.rotl (i32.load offset=36 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (i32.rotl (local.get $b) (i32.const 626))))
+      (local.set $t (i32.add (i32.shl (i32.const -142) (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.mul (local.get $a) (i32.const 618))))
+      (local.set $t (i32.shl (global.get $g3) (local.get $b)))
+      (local.set $t (local.get $a))
+      (local.set $t (global.get $g2))
+      (local.set $t (call $f88 (local.get $t) (i32.mul (local.get $a) (global.get $g3))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 122)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f193 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (local.get $t))
+        (i32.store offset=196 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.xor (i32.rotl (global.get $g1) (local.get $t)) (local.get $a)))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 4)))
+      end
+      (local.set $t (call $f133 (local.get $t) (i32.and (local.get $t) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 182)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f194 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.add (i32.load offset=4 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g0)) (i32.sub (i32.or (local.get $t) (i32.const 902)) (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc)))))
+        (then (local.set $t (i32.and (i32.add (local.get $b) (i32.load offset=128 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shr_u (local.get $b) (local.get $a)))))
+        (else
+          (if (i32.eqz (i32.or (i32.rotl (local.get $b) (local.get $b)) (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc)))))
+            (then (local.set $t (i32.sub (i32.const 3) (i32.shr_u (i32.load offset=68 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)))))
+            (else (local.set $t (i32.const 477))))))
+      (local.set $t (call $f168 (local.get $t) (i32.shl (local.get $a) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 160)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f195 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.add (i32.and (global.get $g0) (local.get $b)) (i32.rotl (local.get $t) (global.get $g1))) (i32.const 3)))
+          end
+          (local.set $t (local.get $a))
+          (br $default)
+        end
+        (local.set $t (i32.shr_u (i32.shl (local.get $a) (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (global.get $g1) (i32.const -371))))
+      end
+      (local.set $t (call $f64 (local.get $t) (local.get $a)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 87)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f196 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.and (i32.shl (i32.const -595) (global.get $g3)) (i32.xor (local.get $b) (local.get $a))))
+      (local.set $t (i32.mul (i32.and (global.get $g0) (local.get $t)) (i32.add (local.get $a) (global.get $g2))))
+      (local.set $t (i32.add (i32.rotl (local.get $a) (local.get $t)) (local.get $a)))
+      (local.set $t (i32.const 75))
+      (local.set $t (call $f93 (local.get $t) (i32.or (local.get $t) (i32.const -825))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 162)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f197 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (local.get $a))
+        (i32.store offset=24 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.mul (i32.sub (local.get $a) (i32.load offset=192 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.add (i32.load offset=12 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 2)))
+      end
+      (local.set $t (call $f190 (local.get $t) (i32.add (local.get $b) (i32.const -268))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 88)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f198 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.xor (i32.xor (local.get $b) (local.get $t)) (i32.shr_u (i32.const 533) (local.get $b))) (i32.mul (i32.shr_u (local.get $b) (i32.const 856)) (i32.const -802)))
+        (then (local.set $t (local.get $t)))
+        (else
+          (if (i32.eqz (i32.sub (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.rotl (local.get $t) (local.get $t))))
+            (then (local.set $t (i32.load offset=20 (i32.and (local.get $a) (i32.const 0xfffc)))))
+            (else (local.set $t (i32.load offset=216 (i32.and (local.get $a) (i32.const 0xfffc))))))))
+      (local.set $t (call $f28 (local.get $t) (i32.mul (local.get $t) (global.get $g0))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 86)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f199 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.const -880) (i32.const 3)))
+          end
+          (local.set $t (i32.mul (i32.add (local.get $t) (i32.const -920)) (i32.shr_u (local.get $a) (local.get $t))))
+          (br $default)
+        end
+        (local.set $t (i32.rotl (i32.sub (global.get $g2) (global.get $g3)) (i32.xor (local.get $t) (global.get $g0))))
+      end
+      (local.set $t (call $f32 (local.get $t) (i32.sub (local.get $t) (i32.const 589))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 79)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f200 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (local.get $t))
+      (local.set $t (i32.shr_u (i32.sub (local.get $b) (global.get $g0)) (i32.shr_u (global.get $g2) (global.get $g0))))
+      (local.set $t (i32.shr_u (i32.add (i32.const -792) (local.get $b)) (local.get $t)))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.xor (local.get $t) (i32.const -620)))
+      (local.set $t (local.get $b))
+      (local.set $t (call $f124 (local.get $t) (i32.shl (local.get $t) (i32.const 508))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 72)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f201 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.mul (i32.shr_u (i32.const -167) (i32.load offset=64 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $b)))
+        (i32.store offset=156 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.and (i32.xor (local.get $b) (i32.const -127)) (i32.shr_u (global.get $g1) (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 6)))
+      end
+      (local.set $t (call $f127 (local.get $t) (i32.and (local.get $t) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 121)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f202 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.and (i32.shr_u (i32.const -153) (local.get $a)) (i32.xor (i32.const -120) (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))))) (i32.or (i32.xor (local.get $b) (local.get $a)) (i32.shl (global.get $g0) (i32.const 883))))
+        (then (local.set $t (i32.const 139)))
+        (else
+          (if (i32.eqz (i32.add (i32.shr_u (i32.load offset=40 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)) (i32.shl (local.get $t) (local.get $b))))
+            (then (local.set $t (i32.rotl (local.get $a) (i32.and (global.get $g3) (local.get $a)))))
+            (else (local.set $t (i32.shr_u (i32.add (local.get $t) (local.get $a)) (i32.xor (local.get $b) (local.get $t))))))))
+      (local.set $t (call $f84 (local.get $t) (i32.shr_u (global.get $g1) (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 82)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f203 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.load offset=212 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 3)))
+          end
+          (local.set $t (i32.mul (i32.or (i32.const 463) (i32.const -627)) (i32.mul (local.get $b) (local.get $b))))
+          (br $default)
+        end
+        (local.set $t (i32.const 609))
+      end
+      (local.set $t (call $f167 (local.get $t) (i32.or (local.get $b) (i32.load offset=136 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 156)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f204 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.shr_u (local.get $b) (i32.xor (global.get $g0) (global.get $g3))))
+      (local.set $t (i32.or (i32.xor (local.get $b) (local.get $b)) (i32.sub (local.get $b) (i32.load offset=60 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.shr_u (i32.shl (local.get $b) (local.get $b)) (i32.shl (i32.const -185) (i32.const 836))))
+      (local.set $t (i32.shl (i32.add (local.get $a) (local.get $a)) (i32.load offset=108 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (i32.sub (i32.and (local.get $a) (global.get $g2)) (i32.rotl (i32.load offset=152 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (global.get $g0))
+      (local.set $t (i32.shl (local.get $t) (i32.shl (local.get $b) (global.get $g1))))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.and (i32.xor (local.get $t) (i32.const -311)) (i32.sub (local.get $t) (local.get $b))))
+      (local.set $t (i32.shl (i32.add (global.get $g1) (i32.load offset=28 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shr_u (local.get $a) (global.get $g2))))
+      (local.set $t (i32.xor (i32.shl (global.get $g2) (i32.load offset=160 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.add (i32.const 971) (local.get $b))))
+      (local.set $t (call $f156 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 134)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f205 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.shr_u (i32.shl (local.get $b) (i32.const 80)) (local.get $b)))
+        (i32.store offset=64 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.shl (global.get $g1) (i32.rotl (global.get $g3) (i32.const -306))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 3)))
+      end
+      (local.set $t (call $f149 (local.get $t) (i32.shl (local.get $b) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 193)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f206 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.or (i32.shr_u (i32.load offset=92 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g0)) (i32.shr_u (i32.load offset=200 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g3))) (i32.and (local.get $a) (i32.shr_u (local.get $t) (i32.const -124))))
+        (then (local.set $t (i32.shl (i32.mul (i32.const -306) (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $t))))
+        (else
+          (if (i32.eqz (i32.rotl (i32.load offset=56 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.or (local.get $t) (local.get $t))))
+            (then (local.set $t (i32.and (i32.add (local.get $t) (local.get $t)) (i32.rotl (local.get $t) (local.get $b)))))
+            (else (local.set $t (i32.sub (i32.mul (local.get $b) (local.get $b)) (i32.sub (local.get $a) (local.get $a))))))))
+      (local.set $t (call $f109 (local.get $t) (i32.const -398)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 161)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f207 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.mul (i32.rotl (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g1)) (i32.shl (i32.const -81) (local.get $b))) (i32.const 3)))
+          end
+          (local.set $t (i32.mul (i32.or (local.get $b) (global.get $g1)) (i32.shr_u (global.get $g3) (global.get $g0))))
+          (br $default)
+        end
+        (local.set $t (local.get $t))
+      end
+      (local.set $t (call $f123 (local.get $t) (i32.or (global.get $g3) (global.get $g1))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 134)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f208 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.shr_u (local.get $b) (i32.shl (global.get $g2) (local.get $t))))
+      (local.set $t (i32.mul (local.get $a) (i32.shr_u (local.get $t) (global.get $g0))))
+      (local.set $t (i32.shr_u (i32.mul (local.get $b) (local.get $a)) (local.get $b)))
+      (local.set $t (i32.shl (i32.and (global.get $g3) (i32.const -194)) (i32.xor (i32.load offset=112 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g3))))
+      (local.set $t (i32.mul (i32.add (i32.const 938) (local.get $a)) (i32.rotl (local.get $a) (local.get $t))))
+      (local.set $t (i32.rotl (i32.shr_u (local.get $b) (local.get $t)) (i32.add (local.get $b) (i32.const 408))))
+      (local.set $t (i32.load offset=88 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (call $f93 (local.get $t) (i32.mul (local.get $b) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 24)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f209 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (local.get $b))
+        (i32.store offset=132 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.const 744))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 15)))
+      end
+      (local.set $t (call $f13 (local.get $t) (i32.shl (i32.const -827) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 70)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f210 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.shr_u (i32.xor (global.get $g1) (local.get $a)) (i32.rotl (i32.const -154) (local.get $a))) (i32.shl (i32.load offset=56 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b)))
+        (then (local.set $t (i32.const 756)))
+        (else
+          (if (i32.eqz (i32.load offset=208 (i32.and (local.get $a) (i32.const 0xfffc))))
+            (then (local.set $t (global.get $g3)))
+            (else (local.set $t (i32.rotl (i32.sub (global.get $g2) (local.get $b)) (i32.or (local.get $a) (i32.const -634))))))))
+      (local.set $t (call $f122 (local.get $t) (i32.rotl (local.get $a) (i32.load offset=28 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 138)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f211 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.shl (i32.load offset=184 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.or (local.get $b) (local.get $b))) (i32.const 3)))
+          end
+          (local.set $t (local.get $a))
+          (br $default)
+        end
+        (local.set $t (i32.xor (i32.xor (global.get $g0) (local.get $a)) (i32.or (i32.load offset=160 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t))))
+      end
+      (local.set $t (call $f128 (local.get $t) (i32.shl (local.get $b) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 33)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f212 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.mul (i32.const 535) (i32.const -959)))
+      (local.set $t (i32.sub (i32.add (i32.const -478) (local.get $t)) (local.get $b)))
+      (local.set $t (i32.or (i32.sub (global.get $g3) (local.get $b)) (i32.shl (i32.load offset=144 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=92 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.rotl (i32.rotl (local.get $t) (local.get $a)) (local.get $t)))
+      (local.set $t (i32.add (i32.shl (local.get $a) (local.get $t)) (local.get $a)))
+      (local.set $t (local.get $a))
+      (local.set $t (call $f186 (local.get $t) (local.get $b)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 93)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f213 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (local.get $t))
+        (i32.store offset=80 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.mul (i32.rotl (local.get $a) (i32.const 86)) (i32.add (local.get $b) (i32.load offset=20 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 10)))
+      end
+      (local.set $t (call $f102 (local.get $t) (i32.or (i32.const 619) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 121)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f214 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.or (i32.and (global.get $g3) (local.get $a)) (i32.sub (i32.const 731) (global.get $g3))) (i32.mul (i32.sub (local.get $a) (global.get $g0)) (local.get $t)))
+        (then (local.set $t (i32.mul (i32.const 227) (i32.or (local.get $a) (i32.load offset=212 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+        (else
+          (if (i32.eqz (local.get $t))
+            (then (local.set $t (i32.mul (i32.and (local.get $a) (global.get $g2)) (i32.shl (local.get $b) (local.get $a)))))
+            (else (local.set $t (i32.rotl (i32.mul (local.get $a) (local.get $b)) (local.get $t)))))))
+      (local.set $t (call $f85 (local.get $t) (i32.load offset=196 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 190)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f215 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.shl (i32.shr_u (global.get $g0) (local.get $b)) (i32.load offset=248 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.const 3)))
+          end
+          (local.set $t (i32.sub (i32.shr_u (i32.const -39) (local.get $t)) (i32.and (local.get $t) (local.get $a))))
+          (br $default)
+        end
+        (local.set $t (i32.mul (local.get $a) (local.get $b)))
+      end
+      (local.set $t (call $f82 (local.get $t) (i32.xor (i32.const 796) (i32.const -110))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 116)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f216 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.add (i32.mul (local.get $a) (local.get $b)) (i32.shr_u (i32.load offset=48 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=128 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.rotl (i32.or (local.get $a) (i32.load offset=220 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $b)))
+      (local.set $t (i32.load offset=160 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.xor (i32.or (local.get $a) (local.get $t)) (local.get $a)))
+      (local.set $t (i32.sub (local.get $b) (i32.load offset=248 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (i32.sub (local.get $b) (local.get $t)))
+      (local.set $t (call $f123 (local.get $t) (i32.const -921)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 46)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f217 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.sub (i32.add (i32.load offset=196 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g1)) (i32.sub (i32.const -605) (global.get $g2))))
+        (i32.store offset=72 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.rotl (i32.const 749) (i32.shl (local.get $b) (local.get $a))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 2)))
+      end
+      (local.set $t (call $f109 (local.get $t) (i32.and (i32.const 888) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 126)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f218 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.xor (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.xor (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=128 (i32.and (local.get $a) (i32.const 0xfffc))))) (i32.const 547))
+        (then (local.set $t (i32.shr_u (i32.add (local.get $t) (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.add (local.get $a) (local.get $t)))))
+        (else
+          (if (i32.eqz (i32.shl (i32.const -273) (i32.rotl (global.get $g0) (local.get $a))))
+            (then (local.set $t (i32.const -637)))
+            (else (local.set $t (i32.shr_u (i32.rotl (local.get $b) (local.get $t)) (i32.mul (local.get $a) (global.get $g1))))))))
+      (local.set $t (call $f152 (local.get $t) (i32.or (global.get $g2) (global.get $g3))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 47)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f219 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 3)))
+          end
+          (local.set $t (local.get $b))
+          (br $default)
+        end
+        (local.set $t (i32.load offset=72 (i32.and (local.get $a) (i32.const 0xfffc))))
+      end
+      (local.set $t (call $f8 (local.get $t) (i32.sub (local.get $a) (i32.const -706))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 128)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f220 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.rotl (local.get $t) (i32.shl (local.get $a) (local.get $a))))
+      (local.set $t (i32.load offset=220 (i32.and (local.get $a) (i32.const 0xfffc))))
+      (local.set $t (i32.shl (i32.sub (local.get $a) (local.get $t)) (i32.add (i32.const 860) (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.or (i32.shr_u (global.get $g1) (global.get $g3)) (local.get $t)))
+      (local.set $t (i32.rotl (local.get $b) (local.get $t)))
+      (local.set $t (i32.or (local.get $a) (i32.load offset=124 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (i32.add (i32.load offset=24 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.shr_u (i32.load offset=76 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t))))
+      (local.set $t (i32.mul (local.get $b) (i32.sub (local.get $b) (local.get $t))))
+      (local.set $t (i32.sub (local.get $a) (i32.and (local.get $t) (local.get $t))))
+      (local.set $t (i32.sub (i32.and (local.get $a) (local.get $t)) (i32.and (global.get $g3) (global.get $g0))))
+      (local.set $t (call $f28 (local.get $t) (i32.sub (global.get $g0) (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 109)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f221 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.xor (i32.rotl (local.get $a) (i32.load offset=144 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.load offset=80 (i32.and (local.get $a) (i32.const 0xfffc)))))
+        (i32.store offset=48 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.or (local.get $b) (i32.rotl (i32.const 435) (global.get $g3))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 4)))
+      end
+      (local.set $t (call $f154 (local.get $t) (i32.or (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 167)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f222 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.and (global.get $g2) (i32.load offset=200 (i32.and (local.get $a) (i32.const 0xfffc)))) (local.get $a))
+        (then (local.set $t (i32.rotl (i32.const -465) (i32.or (local.get $t) (local.get $b)))))
+        (else
+          (if (i32.eqz (i32.shr_u (i32.and (i32.const -369) (local.get $a)) (i32.or (i32.const -288) (i32.const 96))))
+            (then (local.set $t (i32.or (i32.mul (local.get $t) (local.get $b)) (i32.shl (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)))))
+            (else (local.set $t (i32.shl (i32.const 854) (i32.xor (i32.const -584) (i32.load offset=124 (i32.and (local.get $a) (i32.const 0xfffc))))))))))
+      (local.set $t (call $f22 (local.get $t) (i32.sub (local.get $b) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 67)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f223 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.shr_u (i32.and (i32.const -271) (local.get $t)) (i32.xor (i32.load offset=116 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))) (i32.const 3)))
+          end
+          (local.set $t (i32.shr_u (i32.xor (global.get $g0) (local.get $b)) (i32.mul (local.get $b) (i32.const -13))))
+          (br $default)
+        end
+        (local.set $t (i32.shl (i32.xor (local.get $t) (i32.load offset=52 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.sub (i32.const 10) (i32.const 412))))
+      end
+      (local.set $t (call $f49 (local.get $t) (i32.sub (local.get $t) (global.get $g1))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 55)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f224 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.or (i32.add (global.get $g1) (local.get $t)) (i32.and (local.get $a) (local.get $a))))
+      (local.set $t (i32.add (i32.sub (local.get $b) (global.get $g0)) (i32.mul (global.get $g3) (local.get $a))))
+      (local.set $t (i32.const -278))
+      (local.set $t (local.get $t))
+      (local.set $t (local.get $t))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.or (i32.and (local.get $t) (local.get $t)) (i32.xor (local.get $b) (local.get $a))))
+      (local.set $t (i32.add (i32.sub (global.get $g0) (i32.const 301)) (i32.shr_u (i32.const 418) (i32.load offset=200 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (local.get $b))
+      (local.set $t (call $f96 (local.get $t) (i32.rotl (local.get $t) (i32.const -715))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 98)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f225 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.load offset=148 (i32.and (local.get $a) (i32.const 0xfffc))))
+        (i32.store offset=44 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.shr_u (i32.and (local.get $a) (i32.const -683)) (global.get $g0)))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 4)))
+      end
+      (local.set $t (call $f177 (local.get $t) (i32.sub (i32.const -880) (global.get $g3))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 169)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f226 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.add (global.get $g3) (i32.xor (global.get $g1) (local.get $t))) (global.get $g0))
+        (then (local.set $t (i32.or (local.get $a) (local.get $t))))
+        (else
+          (if (i32.eqz (local.get $t))
+            (then (local.set $t (i32.mul (local.get $b) (local.get $t))))
+            (else (local.set $t (i32.mul (i32.add (i32.const 557) (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.sub (i32.const -909) (local.get $t))))))))
+      (local.set $t (call $f135 (local.get $t) (local.get $a)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 17)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f227 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (local.get $b) (i32.const 3)))
+          end
+          (local.set $t (i32.mul (i32.shr_u (global.get $g0) (i32.const 612)) (i32.sub (i32.load offset=44 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g1))))
+          (br $default)
+        end
+        (local.set $t (i32.rotl (i32.sub (global.get $g1) (i32.const 221)) (i32.mul (local.get $b) (local.get $b))))
+      end
+      (local.set $t (call $f19 (local.get $t) (i32.const 983)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 202)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f228 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.sub (global.get $g3) (local.get $a)))
+      (local.set $t (i32.const 994))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.rotl (i32.const 729) (i32.or (local.get $b) (i32.load offset=68 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.or (i32.xor (i32.load offset=76 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)) (local.get $b)))
+      (local.set $t (i32.xor (local.get $t) (i32.xor (local.get $t) (i32.load offset=160 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.xor (local.get $b) (i32.shr_u (global.get $g1) (global.get $g1))))
+      (local.set $t (i32.mul (i32.and (global.get $g2) (local.get $a)) (i32.shl (i32.load offset=236 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))
+      (local.set $t (i32.or (i32.xor (local.get $a) (i32.const -13)) (i32.mul (local.get $b) (local.get $a))))
+      (local.set $t (i32.shl (i32.mul (i32.load offset=24 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=156 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.sub (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (call $f71 (local.get $t) (i32.shr_u (local.get $a) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 4)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f229 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.rotl (i32.xor (local.get $t) (global.get $g0)) (i32.xor (i32.const 353) (local.get $b))))
+        (i32.store offset=244 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (local.get $a))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 5)))
+      end
+      (local.set $t (call $f79 (local.get $t) (i32.shl (local.get $b) (global.get $g3))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 193)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f230 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.const 52) (i32.or (i32.shr_u (local.get $a) (i32.load offset=212 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.sub (local.get $a) (i32.const -505))))
+        (then (local.set $t (local.get $t)))
+        (else
+          (if (i32.eqz (i32.const 954))
+            (then (local.set $t (i32.shr_u (i32.shr_u (local.get $a) (local.get $a)) (global.get $g0))))
+            (else (local.set $t (i32.shl (local.get $a) (i32.shr_u (local.get $b) (local.get $t))))))))
+      (local.set $t (call $f209 (local.get $t) (local.get $t)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 124)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f231 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (local.get $b) (i32.const 3)))
+          end
+          (local.set $t (i32.const 845))
+          (br $default)
+        end
+        (local.set $t (i32.shl (i32.mul (local.get $b) (global.get $g2)) (i32.shr_u (local.get $b) (i32.load offset=220 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      end
+      (local.set $t (call $f160 (local.get $t) (i32.rotl (global.get $g3) (i32.load offset=164 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 56)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f232 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.shr_u (i32.const 72) (i32.xor (i32.load offset=232 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 283))))
+      (local.set $t (i32.and (local.get $b) (i32.rotl (local.get $t) (i32.const 606))))
+      (local.set $t (i32.shr_u (i32.const -625) (i32.shl (global.get $g2) (local.get $a))))
+      (local.set $t (i32.mul (i32.shl (local.get $b) (i32.const 323)) (i32.and (global.get $g0) (i32.load offset=200 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.and (i32.xor (local.get $b) (i32.const 821)) (i32.and (local.get $t) (i32.const -672))))
+      (local.set $t (i32.shl (i32.shl (local.get $a) (global.get $g3)) (i32.xor (local.get $b) (global.get $g0))))
+      (local.set $t (i32.rotl (i32.mul (i32.load offset=148 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 161)) (i32.sub (global.get $g1) (i32.load offset=104 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (local.get $t))
+      (local.set $t (call $f129 (local.get $t) (i32.sub (global.get $g2) (i32.const -134))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 21)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f233 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (local.get $a))
+        (i32.store offset=216 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.sub (i32.mul (local.get $b) (global.get $g0)) (i32.shl (global.get $g2) (local.get $b))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 3)))
+      end
+      (local.set $t (call $f217 (local.get $t) (i32.rotl (i32.const 127) (i32.load offset=20 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 93)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f234 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.sub (global.get $g3) (i32.rotl (local.get $a) (local.get $t))) (i32.and (i32.or (local.get $a) (local.get $b)) (local.get $a)))
+        (then (local.set $t (i32.and (i32.sub (local.get $t) (local.get $a)) (i32.rotl (global.get $g3) (local.get $b)))))
+        (else
+          (if (i32.eqz (local.get $t))
+            (then (local.set $t (i32.mul (i32.and (global.get $g0) (local.get $b)) (i32.rotl (local.get $t) (local.get $a)))))
+            (else (local.set $t (i32.and (i32.load offset=76 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.or (global.get $g3) (local.get $b))))))))
+      (local.set $t (call $f216 (local.get $t) (i32.shr_u (i32.const 96) (i32.const -762))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 129)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f235 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.or (i32.add (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (i32.and (local.get $a) (global.get $g1))) (i32.const 3)))
+          end
+          (local.set $t (i32.load offset=140 (i32.and (local.get $a) (i32.const 0xfffc))))
+          (br $default)
+        end
+        (local.set $t (i32.and (local.get $b) (local.get $t)))
+      end
+      (local.set $t (call $f62 (local.get $t) (i32.add (local.get $b) (global.get $g1))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 145)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f236 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.add (i32.sub (local.get $a) (global.get $g2)) (i32.xor (i32.const -818) (local.get $a))))
+      (local.set $t (i32.add (i32.mul (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)) (i32.xor (i32.const 236) (i32.load offset=104 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.rotl (i32.and (local.get $a) (global.get $g0)) (global.get $g3)))
+      (local.set $t (i32.sub (i32.mul (local.get $b) (local.get $t)) (i32.add (i32.const 227) (i32.const -902))))
+      (local.set $t (i32.add (i32.mul (i32.const 149) (local.get $a)) (i32.const -514)))
+      (local.set $t (call $f119 (local.get $t) (i32.sub (local.get $a) (i32.const -764))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 43)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f237 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.shr_u (i32.shl (local.get $a) (i32.load offset=32 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shr_u (i32.const -652) (global.get $g2))))
+        (i32.store offset=132 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.or (i32.xor (global.get $g3) (i32.load offset=20 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (global.get $g1) (local.get $b))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 8)))
+      end
+      (local.set $t (call $f143 (local.get $t) (i32.load offset=248 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 28)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f238 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.mul (i32.sub (i32.const 570) (local.get $a)) (i32.shr_u (local.get $t) (local.get $a))) (local.get $b))
+        (then (local.set $t (i32.add (local.get $t) (i32.shr_u (local.get $b) (local.get $a)))))
+        (else
+          (if (i32.eqz (i32.or (i32.add (local.get $b) (i32.const 75)) (global.get $g0)))
+            (then (local.set $t (i32.or (i32.shr_u (local.get $b) (i32.const -654)) (i32.and (i32.load offset=224 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a)))))
+            (else (local.set $t (i32.sub (i32.rotl (local.get $t) (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.rotl (global.get $g2) (local.get $t))))))))
+      (local.set $t (call $f203 (local.get $t) (i32.add (local.get $b) (i32.const -876))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 161)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f239 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.add (i32.shl (local.get $a) (global.get $g0)) (i32.mul (i32.const -168) (local.get $a))) (i32.const 3)))
+          end
+          (local.set $t (i32.or (i32.const 842) (i32.const 576)))
+          (br $default)
+        end
+        (local.set $t (i32.load offset=216 (i32.and (local.get $a) (i32.const 0xfffc))))
+      end
+      (local.set $t (call $f83 (local.get $t) (i32.xor (local.get $a) (local.get $a))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 103)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f240 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.mul (i32.sub (local.get $t) (local.get $a)) (i32.and (i32.const -412) (i32.const 930))))
+      (local.set $t (i32.xor (i32.rotl (local.get $a) (i32.const -97)) (local.get $b)))
+      (local.set $t (i32.xor (i32.load offset=224 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.or (global.get $g2) (global.get $g0))))
+      (local.set $t (i32.and (i32.add (local.get $a) (local.get $a)) (i32.shl (i32.load offset=156 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 905))))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.xor (global.get $g3) (i32.add (local.get $a) (i32.load offset=156 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.sub (i32.shl (local.get $t) (i32.const -687)) (local.get $a)))
+      (local.set $t (local.get $t))
+      (local.set $t (local.get $t))
+      (local.set $t (i32.rotl (i32.shl (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=176 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.xor (i32.const 536) (local.get $a))))
+      (local.set $t (call $f166 (local.get $t) (i32.or (global.get $g2) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 62)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f241 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (local.get $b))
+        (i32.store offset=92 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.rotl (local.get $t) (i32.shl (i32.load offset=128 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 131))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 7)))
+      end
+      (local.set $t (call $f48 (local.get $t) (i32.add (local.get $a) (i32.const -160))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 57)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f242 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.or (i32.add (i32.load offset=108 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=136 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shl (i32.const 313) (local.get $t))) (i32.sub (i32.or (i32.const -929) (i32.load offset=192 (i32.and (local.get $a) (i32.const 0xfffc)))) (global.get $g2)))
+        (then (local.set $t (local.get $t)))
+        (else
+          (if (i32.eqz (i32.and (i32.sub (local.get $b) (i32.const 473)) (i32.or (i32.const 209) (local.get $a))))
+            (then (local.set $t (i32.or (i32.xor (global.get $g0) (local.get $t)) (i32.sub (i32.load offset=44 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $t)))))
+            (else (local.set $t (i32.and (global.get $g0) (i32.xor (global.get $g2) (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc))))))))))
+      (local.set $t (call $f1 (local.get $t) (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 143)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f243 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.shl (i32.rotl (i32.const -226) (global.get $g3)) (i32.sub (i32.load offset=252 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))) (i32.const 3)))
+          end
+          (local.set $t (i32.sub (i32.add (i32.const 759) (i32.const 241)) (i32.load offset=232 (i32.and (local.get $a) (i32.const 0xfffc)))))
+          (br $default)
+        end
+        (local.set $t (i32.or (i32.shl (local.get $b) (i32.const -816)) (i32.rotl (local.get $b) (i32.const -421))))
+      end
+      (local.set $t (call $f117 (local.get $t) (i32.xor (local.get $a) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 180)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f244 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (local.get $a))
+      (local.set $t (i32.rotl (i32.add (local.get $t) (local.get $b)) (i32.mul (i32.const -177) (global.get $g0))))
+      (local.set $t (i32.rotl (i32.mul (local.get $a) (global.get $g1)) (i32.shl (global.get $g0) (local.get $a))))
+      (local.set $t (i32.rotl (i32.shr_u (i32.const 121) (local.get $a)) (i32.add (local.get $a) (global.get $g0))))
+      (local.set $t (global.get $g2))
+      (local.set $t (i32.or (i32.sub (global.get $g0) (i32.load offset=116 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.and (local.get $t) (global.get $g3))))
+      (local.set $t (i32.xor (i32.shl (global.get $g2) (local.get $a)) (i32.rotl (local.get $t) (local.get $t))))
+      (local.set $t (i32.shl (local.get $a) (i32.mul (i32.const -152) (local.get $a))))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.rotl (i32.rotl (global.get $g3) (local.get $t)) (i32.sub (global.get $g0) (i32.const -899))))
+      (local.set $t (call $f189 (local.get $t) (i32.xor (global.get $g1) (i32.load offset=160 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 129)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f245 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.add (i32.const 199) (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc)))))
+        (i32.store offset=100 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.shl (local.get $b) (i32.add (i32.const 621) (global.get $g1))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 9)))
+      end
+      (local.set $t (call $f194 (local.get $t) (i32.add (local.get $t) (i32.const 733))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 56)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f246 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.and (local.get $t) (i32.rotl (local.get $b) (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc))))) (i32.xor (i32.rotl (local.get $t) (local.get $a)) (i32.load offset=160 (i32.and (local.get $a) (i32.const 0xfffc)))))
+        (then (local.set $t (local.get $a)))
+        (else
+          (if (i32.eqz (local.get $a))
+            (then (local.set $t (local.get $t)))
+            (else (local.set $t (i32.xor (i32.sub (local.get $t) (local.get $t)) (i32.and (i32.const -217) (local.get $a))))))))
+      (local.set $t (call $f120 (local.get $t) (i32.shl (local.get $b) (local.get $t))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 73)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f247 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.sub (i32.const 557) (i32.add (local.get $b) (global.get $g3))) (i32.const 3)))
+          end
+          (local.set $t (i32.shr_u (i32.or (local.get $a) (local.get $b)) (i32.sub (i32.const -6) (local.get $a))))
+          (br $default)
+        end
+        (local.set $t (i32.const 181))
+      end
+      (local.set $t (call $f26 (local.get $t) (i32.const -486)))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 218)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f248 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.sub (i32.xor (local.get $b) (local.get $b)) (i32.add (local.get $b) (local.get $a))))
+      (local.set $t (i32.add (i32.sub (local.get $b) (i32.const 643)) (global.get $g2)))
+      (local.set $t (i32.rotl (i32.load offset=224 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.rotl (i32.const 493) (global.get $g3))))
+      (local.set $t (i32.add (i32.const -530) (i32.sub (global.get $g3) (i32.const -591))))
+      (local.set $t (i32.add (i32.rotl (global.get $g3) (i32.load offset=240 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.add (local.get $b) (i32.load offset=40 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (i32.sub (i32.add (local.get $b) (local.get $a)) (i32.const 45)))
+      (local.set $t (call $f97 (local.get $t) (i32.load offset=72 (i32.and (local.get $a) (i32.const 0xfffc)))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 95)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f249 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.rotl (i32.load offset=40 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.add (local.get $a) (local.get $a))))
+        (i32.store offset=148 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.rotl (i32.sub (local.get $t) (local.get $t)) (i32.add (i32.const -908) (i32.const 981))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 12)))
+      end
+      (local.set $t (call $f74 (local.get $t) (i32.shr_u (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $b))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 44)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f250 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.rotl (global.get $g3) (i32.add (local.get $a) (local.get $b))) (local.get $a))
+        (then (local.set $t (i32.or (local.get $b) (i32.shr_u (i32.load offset=24 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=248 (i32.and (local.get $a) (i32.const 0xfffc)))))))
+        (else
+          (if (i32.eqz (local.get $t))
+            (then (local.set $t (i32.rotl (i32.const -814) (i32.rotl (global.get $g0) (i32.const 30)))))
+            (else (local.set $t (i32.and (local.get $t) (i32.rotl (i32.load offset=248 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))))))))
+      (local.set $t (call $f231 (local.get $t) (i32.rotl (local.get $b) (global.get $g2))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 112)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f251 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.load offset=196 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 3)))
+          end
+          (local.set $t (i32.shr_u (global.get $g1) (i32.xor (local.get $t) (local.get $t))))
+          (br $default)
+        end
+        (local.set $t (i32.sub (i32.const -856) (i32.shl (local.get $a) (i32.load offset=12 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      end
+      (local.set $t (call $f23 (local.get $t) (i32.add (i32.const 158) (i32.load offset=172 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 191)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f252 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (local.set $t (i32.xor (local.get $a) (i32.sub (local.get $t) (i32.load offset=88 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (local.get $a))
+      (local.set $t (i32.and (i32.rotl (i32.const 728) (i32.load offset=184 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.rotl (i32.const -72) (local.get $t))))
+      (local.set $t (i32.xor (i32.shr_u (global.get $g2) (global.get $g1)) (global.get $g3)))
+      (local.set $t (i32.and (local.get $b) (i32.and (global.get $g3) (i32.const 292))))
+      (local.set $t (i32.shl (i32.mul (local.get $a) (global.get $g0)) (i32.shl (local.get $t) (i32.const -827))))
+      (local.set $t (i32.rotl (i32.const -128) (i32.xor (global.get $g3) (local.get $b))))
+      (local.set $t (local.get $b))
+      (local.set $t (i32.rotl (local.get $a) (i32.shl (global.get $g1) (local.get $t))))
+      (local.set $t (i32.xor (local.get $b) (i32.or (local.get $t) (i32.load offset=100 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call $f102 (local.get $t) (i32.shl (global.get $g1) (i32.const -876))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 192)))
+      (global.set $g0 (i32.add (global.get $g0) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f253 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      loop $loop
+        (local.set $t (i32.add (i32.shl (i32.load offset=96 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=188 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.rotl (i32.load offset=124 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=244 (i32.and (local.get $a) (i32.const 0xfffc))))))
+        (i32.store offset=72 (i32.and (local.get $t) (i32.const 0xfffc))
+                   (i32.or (i32.mul (i32.load offset=16 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.load offset=144 (i32.and (local.get $a) (i32.const 0xfffc)))) (i32.shl (i32.load offset=196 (i32.and (local.get $a) (i32.const 0xfffc))) (global.get $g2))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br_if $loop (i32.lt_u (local.get $i) (i32.const 9)))
+      end
+      (local.set $t (call $f79 (local.get $t) (i32.and (i32.const -139) (global.get $g0))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 54)))
+      (global.set $g1 (i32.add (global.get $g1) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f254 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      (if (i32.lt_s (i32.xor (i32.shl (global.get $g3) (local.get $a)) (i32.shl (i32.load offset=156 (i32.and (local.get $a) (i32.const 0xfffc))) (local.get $a))) (i32.and (local.get $b) (local.get $a)))
+        (then (local.set $t (i32.shl (i32.and (i32.load offset=216 (i32.and (local.get $a) (i32.const 0xfffc))) (i32.const 666)) (local.get $a))))
+        (else
+          (if (i32.eqz (local.get $t))
+            (then (local.set $t (i32.load offset=72 (i32.and (local.get $a) (i32.const 0xfffc)))))
+            (else (local.set $t (i32.shr_u (i32.rotl (local.get $a) (local.get $a)) (i32.shr_u (i32.const -492) (local.get $a))))))))
+      (local.set $t (call $f119 (local.get $t) (i32.xor (local.get $a) (i32.const 796))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 228)))
+      (global.set $g2 (i32.add (global.get $g2) (local.get $t)))
+      (local.get $t)
+    )
+    (func $f255 (type $binary) (param $a i32) (param $b i32) (result i32)
+      (local $t i32)
+      (local $i i32)
+      block $default
+        block $case1
+          block $case0
+            (br_table $case0 $case1 $default
+              (i32.and (i32.sub (i32.mul (local.get $a) (global.get $g2)) (local.get $b)) (i32.const 3)))
+          end
+          (local.set $t (i32.xor (i32.sub (global.get $g2) (local.get $a)) (i32.sub (local.get $b) (local.get $a))))
+          (br $default)
+        end
+        (local.set $t (i32.or (i32.const 686) (i32.rotl (global.get $g1) (i32.const 69))))
+      end
+      (local.set $t (call $f225 (local.get $t) (i32.xor (local.get $b) (i32.load offset=132 (i32.and (local.get $a) (i32.const 0xfffc))))))
+      (local.set $t (call_indirect (type $binary) (local.get $a) (local.get $t)
+                      (i32.const 46)))
+      (global.set $g3 (i32.add (global.get $g3) (local.get $t)))
+      (local.get $t)
+    )
+    (export "f255" (func $f255))
+  ))
@@ -0,0 +1,160 @@
+;; Machine learning kernels written with relaxed SIMD operators, and with the equivalent strict SIMD
+;; operators for comparison:
+;; - "gemv": a 64x64 f32 matrix times a 64 element vector, using f32x4.relaxed_madd.
+;; - "dot_i8": a 4096 element dot product of int8 activations and 7-bit weights, using
+;;   i32x4.relaxed_dot_i8x16_i7x16_add_s.
+(module
+  ;; 0x0000: the 64x64 f32 matrix
+  ;; 0x4000: the 64 element f32 input vector
+  ;; 0x4100: the 64 element f32 output vector
+  ;; 0x8000: 4096 int8 activations
+  ;; 0xa000: 4096 7-bit weights
+  (memory 1)
+
+  (func $init
+    (local $i i32)
+    (local $seed i32)
+    (local.set $seed (i32.const 1))
+    loop $loop
+      (local.set $seed (i32.add (i32.mul (local.get $seed) (i32.const 1103515245))
+                                (i32.const 12345)))
+      ;; The matrix and vector elements are small integers, so the results are exact.
+      (f32.store (i32.shl (local.get $i) (i32.const 2))
+        (f32.convert_i32_s
+          (i32.sub (i32.and (i32.shr_u (local.get $seed) (i32.const 16)) (i32.const 7))
+                   (i32.const 3))))
+      (i32.store8 offset=0x8000 (local.get $i) (i32.shr_u (local.get $seed) (i32.const 16)))
+      (i32.store8 offset=0xa000 (local.get $i)
+        (i32.and (i32.shr_u (local.get $seed) (i32.const 8)) (i32.const 127)))
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      ;; 64x64 matrix elements + 64 vector elements
+      (br_if $loop (i32.lt_u (local.get $i) (i32.const 4160)))
+    end
+  )
+  (start $init)
+
+  ;; Sums the lanes of the output vector.
+  (func (export "gemv_checksum") (result f32)
+    (local $i i32)
+    (local $sum f32)
+    loop $loop
+      (local.set $sum (f32.add (local.get $sum)
+                               (f32.load offset=0x4100 (i32.shl (local.get $i) (i32.const 2)))))
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      (br_if $loop (i32.lt_u (local.get $i) (i32.const 64)))
+    end
+    (local.get $sum)
+  )
+
+  (func (export "gemv_relaxed")
+    (local $row i32)
+    (local $column i32)
+    (local $sums v128)
+    loop $rowLoop
+      (local.set $sums (v128.const i32x4 0 0 0 0))
+      (local.set $column (i32.const 0))
+      loop $columnLoop
+        (local.set $sums
+          (f32x4.relaxed_madd
+            (v128.load (i32.add (i32.shl (local.get $row) (i32.const 8))
+                                (i32.shl (local.get $column) (i32.const 2))))
+            (v128.load offset=0x4000 (i32.shl (local.get $column) (i32.const 2)))
+            (local.get $sums)))
+        (local.set $column (i32.add (local.get $column) (i32.const 4)))
+        (br_if $columnLoop (i32.lt_u (local.get $column) (i32.const 64)))
+      end
+      (f32.store offset=0x4100 (i32.shl (local.get $row) (i32.const 2))
+        (f32.add (f32.add (f32x4.extract_lane 0 (local.get $sums))
+                          (f32x4.extract_lane 1 (local.get $sums)))
+                 (f32.add (f32x4.extract_lane 2 (local.get $sums))
+                          (f32x4.extract_lane 3 (local.get $sums)))))
+      (local.set $row (i32.add (local.get $row) (i32.const 1)))
+      (br_if $rowLoop (i32.lt_u (local.get $row) (i32.const 64)))
+    end
+  )
+
+  (func (export "gemv_strict")
+    (local $row i32)
+    (local $column i32)
+    (local $sums v128)
+    loop $rowLoop
+      (local.set $sums (v128.const i32x4 0 0 0 0))
+      (local.set $column (i32.const 0))
+      loop $columnLoop
+        (local.set $sums
+          (f32x4.add
+            (f32x4.mul
+              (v128.load (i32.add (i32.shl (local.get $row) (i32.const 8))
+                                  (i32.shl (local.get $column) (i32.const 2))))
+              (v128.load offset=0x4000 (i32.shl (local.get $column) (i32.const 2))))
+            (local.get $sums)))
+        (local.set $column (i32.add (local.get $column) (i32.const 4)))
+        (br_if $columnLoop (i32.lt_u (local.get $column) (i32.const 64)))
+      end
+      (f32.store offset=0x4100 (i32.shl (local.get $row) (i32.const 2))
+        (f32.add (f32.add (f32x4.extract_lane 0 (local.get $sums))
+                          (f32x4.extract_lane 1 (local.get $sums)))
+                 (f32.add (f32x4.extract_lane 2 (local.get $sums))
+                          (f32x4.extract_lane 3 (local.get $sums)))))
+      (local.set $row (i32.add (local.get $row) (i32.const 1)))
+      (br_if $rowLoop (i32.lt_u (local.get $row) (i32.const 64)))
+    end
+  )
+
+  (func $horizontalSum (param $sums v128) (result i32)
+    (i32.add (i32.add (i32x4.extract_lane 0 (local.get $sums))
+                      (i32x4.extract_lane 1 (local.get $sums)))
+             (i32.add (i32x4.extract_lane 2 (local.get $sums))
+                      (i32x4.extract_lane 3 (local.get $sums))))
+  )
+
+  (func (export "dot_i8_relaxed") (result i32)
+    (local $i i32)
+    (local $sums v128)
+    loop $loop
+      (local.set $sums
+        (i32x4.relaxed_dot_i8x16_i7x16_add_s
+          (v128.load offset=0x8000 (local.get $i))
+          (v128.load offset=0xa000 (local.get $i))
+          (local.get $sums)))
+      (local.set $i (i32.add (local.get $i) (i32.const 16)))
+      (br_if $loop (i32.lt_u (local.get $i) (i32.const 4096)))
+    end
+    (call $horizontalSum (local.get $sums))
+  )
+
+  ;; The strict equivalent: multiply to i16, then add adjacent pairs of products to i32.
+  (func (export "dot_i8_strict") (result i32)
+    (local $i i32)
+    (local $a v128)
+    (local $b v128)
+    (local $sums v128)
+    loop $loop
+      (local.set $a (v128.load offset=0x8000 (local.get $i)))
+      (local.set $b (v128.load offset=0xa000 (local.get $i)))
+      (local.set $sums
+        (i32x4.add
+          (i32x4.add
+            (i32x4.extadd_pairwise_i16x8_s
+              (i16x8.extmul_low_i8x16_s (local.get $a) (local.get $b)))
+            (i32x4.extadd_pairwise_i16x8_s
+              (i16x8.extmul_high_i8x16_s (local.get $a) (local.get $b))))
+          (local.get $sums)))
+      (local.set $i (i32.add (local.get $i) (i32.const 16)))
+      (br_if $loop (i32.lt_u (local.get $i) (i32.const 4096)))
+    end
+    (call $horizontalSum (local.get $sums))
+  )
+)
+
+(invoke "gemv_relaxed")
+(assert_return (invoke "gemv_checksum") (f32.const 2444))
+(invoke "gemv_strict")
+(assert_return (invoke "gemv_checksum") (f32.const 2444))
+(assert_return (invoke "dot_i8_relaxed") (i32.const 396455))
+(assert_return (invoke "dot_i8_strict") (i32.const 396455))
+
+(benchmark "f32 gemv 64x64 (relaxed_madd)" (invoke "gemv_relaxed"))
+(benchmark "f32 gemv 64x64 (mul+add)" (invoke "gemv_strict"))
+(benchmark "int8 dot 4096 (relaxed_dot_add)" (invoke "dot_i8_relaxed"))
+(benchmark "int8 dot 4096 (extmul)" (invoke "dot_i8_strict"))
@@ -0,0 +1,95 @@
+(module
+  (type $i32_to_i32 (func (param i32) (result i32)))
+
+  (table $externrefs 1024 externref)
+  (table $funcrefs 1024 funcref)
+
+  (elem (table $funcrefs) (i32.const 0) func $identity)
+
+  (func $identity (type $i32_to_i32) (local.get 0))
+
+  (func (export "table.get loop") (param $numIterations i32) (result i32)
+    (local $numNulls i32)
+    loop $getLoop
+      (local.set $numIterations (i32.sub (local.get $numIterations) (i32.const 1)))
+      (local.set $numNulls
+        (i32.add
+          (local.get $numNulls)
+          (ref.is_null (table.get $externrefs (i32.and (local.get $numIterations) (i32.const 1023))))))
+      (br_if $getLoop (local.get $numIterations))
+    end
+    (local.get $numNulls)
+  )
+
+  (func (export "table.set loop") (param $value externref) (param $numIterations i32)
+    loop $setLoop
+      (local.set $numIterations (i32.sub (local.get $numIterations) (i32.const 1)))
+      (table.set $externrefs
+        (i32.and (local.get $numIterations) (i32.const 1023))
+        (local.get $value))
+      (br_if $setLoop (local.get $numIterations))
+    end
+  )
+
+  (func (export "table.get/set loop") (param $numIterations i32)
+    loop $copyLoop
+      (local.set $numIterations (i32.sub (local.get $numIterations) (i32.const 1)))
+      (table.set $externrefs
+        (i32.and (local.get $numIterations) (i32.const 1023))
+        (table.get $externrefs (i32.and (i32.add (local.get $numIterations) (i32.const 1))
+                                        (i32.const 1023))))
+      (br_if $copyLoop (local.get $numIterations))
+    end
+  )
+
+  (func (export "table.size loop") (param $numIterations i32) (result i32)
+    (local $sum i32)
+    loop $sizeLoop
+      (local.set $numIterations (i32.sub (local.get $numIterations) (i32.const 1)))
+      (local.set $sum (i32.add (local.get $sum) (table.size $externrefs)))
+      (br_if $sizeLoop (local.get $numIterations))
+    end
+    (local.get $sum)
+  )
+
+  (func (export "call_indirect loop") (param $numIterations i32) (result i32)
+    (local $sum i32)
+    loop $callLoop
+      (local.set $numIterations (i32.sub (local.get $numIterations) (i32.const 1)))
+      (local.set $sum
+        (i32.add
+          (local.get $sum)
+          (call_indirect $funcrefs (type $i32_to_i32) (local.get $numIterations) (i32.const 0))))
+      (br_if $callLoop (local.get $numIterations))
+    end
+    (local.get $sum)
+  )
+
+  ;; A large table for the bulk operations.
+  (table $bulkFuncrefs 65536 funcref)
+
+  (func (export "table.fill") (param $value funcref) (param $numElements i32)
+    (table.fill $bulkFuncrefs (i32.const 0) (local.get $value) (local.get $numElements))
+  )
+
+  (func (export "table.copy") (param $dest i32) (param $source i32) (param $numElements i32)
+    (table.copy $bulkFuncrefs $bulkFuncrefs
+      (local.get $dest)
+      (local.get $source)
+      (local.get $numElements))
+  )
+)
+
+(benchmark "table.get (1M)" (invoke "table.get loop" (i32.const 1048576)))
+(benchmark "table.set null (1M)" (invoke "table.set loop" (ref.null extern) (i32.const 1048576)))
+(benchmark "table.set non-null (1M)" (invoke "table.set loop" (ref.extern 1) (i32.const 1048576)))
+(benchmark "table.get/set (1M)" (invoke "table.get/set loop" (i32.const 1048576)))
+(benchmark "table.size (1M)" (invoke "table.size loop" (i32.const 1048576)))
+(benchmark "call_indirect (1M)" (invoke "call_indirect loop" (i32.const 1048576)))
+
+(benchmark "table.fill null (1K)" (invoke "table.fill" (ref.null func) (i32.const 1024)))
+(benchmark "table.fill null (64K)" (invoke "table.fill" (ref.null func) (i32.const 65536)))
+(benchmark "table.copy (forward, 1K)" (invoke "table.copy" (i32.const 0) (i32.const 8) (i32.const 1024)))
+(benchmark "table.copy (forward, 32K)" (invoke "table.copy" (i32.const 0) (i32.const 8) (i32.const 32768)))
+(benchmark "table.copy (reverse, 1K)" (invoke "table.copy" (i32.const 8) (i32.const 0) (i32.const 1024)))
+(benchmark "table.copy (reverse, 32K)" (invoke "table.copy" (i32.const 8) (i32.const 0) (i32.const 32768)))
@@ -0,0 +1,546 @@
+;; Generated by generate_table_segment_benchmark.py: do not edit.
+;; Benchmarks of initializing a table from an element segment with 4096 elements.
+
+;; A passive segment, copied into a table by table.init.
+(module
+  (func $f)
+
+  (table $funcrefs 65536 funcref)
+  (elem $segment func
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+  )
+
+  (func (export "table.init") (param $numRepeats i32)
+    loop $initLoop
+      (local.set $numRepeats (i32.sub (local.get $numRepeats) (i32.const 1)))
+      (table.init $funcrefs $segment
+        (i32.mul (i32.and (local.get $numRepeats) (i32.const 15)) (i32.const 4096))
+        (i32.const 0)
+        (i32.const 4096))
+      (br_if $initLoop (local.get $numRepeats))
+    end
+  )
+)
+
+(benchmark "table.init (4K elements x 16)" (invoke "table.init" (i32.const 16)))
+
+;; An active segment, copied into the table when the module is instantiated.
+(benchmark "active segment (4K elements)"
+  (module
+    (func $f)
+    (table 4096 funcref)
+    (elem (i32.const 0) func
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+      $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f $f
+    )
+  )
+)
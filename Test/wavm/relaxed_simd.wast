@@ -0,0 +1,168 @@
+;; Relaxed SIMD operators. The results of these operators are implementation-defined for some
+;; inputs (NaNs, out-of-range values, non-uniform masks, etc), so these tests only use inputs for
+;; which every allowed result is the same.
+
+(module
+  (func (export "i8x16.relaxed_swizzle") (param v128 v128) (result v128)
+    (i8x16.relaxed_swizzle (local.get 0) (local.get 1)))
+
+  (func (export "i32x4.relaxed_trunc_f32x4_s") (param v128) (result v128)
+    (i32x4.relaxed_trunc_f32x4_s (local.get 0)))
+  (func (export "i32x4.relaxed_trunc_f32x4_u") (param v128) (result v128)
+    (i32x4.relaxed_trunc_f32x4_u (local.get 0)))
+  (func (export "i32x4.relaxed_trunc_f64x2_s_zero") (param v128) (result v128)
+    (i32x4.relaxed_trunc_f64x2_s_zero (local.get 0)))
+  (func (export "i32x4.relaxed_trunc_f64x2_u_zero") (param v128) (result v128)
+    (i32x4.relaxed_trunc_f64x2_u_zero (local.get 0)))
+
+  (func (export "f32x4.relaxed_madd") (param v128 v128 v128) (result v128)
+    (f32x4.relaxed_madd (local.get 0) (local.get 1) (local.get 2)))
+  (func (export "f32x4.relaxed_nmadd") (param v128 v128 v128) (result v128)
+    (f32x4.relaxed_nmadd (local.get 0) (local.get 1) (local.get 2)))
+  (func (export "f64x2.relaxed_madd") (param v128 v128 v128) (result v128)
+    (f64x2.relaxed_madd (local.get 0) (local.get 1) (local.get 2)))
+  (func (export "f64x2.relaxed_nmadd") (param v128 v128 v128) (result v128)
+    (f64x2.relaxed_nmadd (local.get 0) (local.get 1) (local.get 2)))
+
+  (func (export "i8x16.relaxed_laneselect") (param v128 v128 v128) (result v128)
+    (i8x16.relaxed_laneselect (local.get 0) (local.get 1) (local.get 2)))
+  (func (export "i16x8.relaxed_laneselect") (param v128 v128 v128) (result v128)
+    (i16x8.relaxed_laneselect (local.get 0) (local.get 1) (local.get 2)))
+  (func (export "i32x4.relaxed_laneselect") (param v128 v128 v128) (result v128)
+    (i32x4.relaxed_laneselect (local.get 0) (local.get 1) (local.get 2)))
+  (func (export "i64x2.relaxed_laneselect") (param v128 v128 v128) (result v128)
+    (i64x2.relaxed_laneselect (local.get 0) (local.get 1) (local.get 2)))
+
+  (func (export "f32x4.relaxed_min") (param v128 v128) (result v128)
+    (f32x4.relaxed_min (local.get 0) (local.get 1)))
+  (func (export "f32x4.relaxed_max") (param v128 v128) (result v128)
+    (f32x4.relaxed_max (local.get 0) (local.get 1)))
+  (func (export "f64x2.relaxed_min") (param v128 v128) (result v128)
+    (f64x2.relaxed_min (local.get 0) (local.get 1)))
+  (func (export "f64x2.relaxed_max") (param v128 v128) (result v128)
+    (f64x2.relaxed_max (local.get 0) (local.get 1)))
+
+  (func (export "i16x8.relaxed_q15mulr_s") (param v128 v128) (result v128)
+    (i16x8.relaxed_q15mulr_s (local.get 0) (local.get 1)))
+  (func (export "i16x8.relaxed_dot_i8x16_i7x16_s") (param v128 v128) (result v128)
+    (i16x8.relaxed_dot_i8x16_i7x16_s (local.get 0) (local.get 1)))
+  (func (export "i32x4.relaxed_dot_i8x16_i7x16_add_s") (param v128 v128 v128) (result v128)
+    (i32x4.relaxed_dot_i8x16_i7x16_add_s (local.get 0) (local.get 1) (local.get 2)))
+)
+
+(assert_return
+  (invoke "i8x16.relaxed_swizzle"
+    (v128.const i8x16 0x10 0x11 0x12 0x13 0x14 0x15 0x16 0x17 0x18 0x19 0x1a 0x1b 0x1c 0x1d 0x1e 0x1f)
+    (v128.const i8x16 15 14 13 12 11 10 9 8 7 6 5 4 3 2 1 0))
+  (v128.const i8x16 0x1f 0x1e 0x1d 0x1c 0x1b 0x1a 0x19 0x18 0x17 0x16 0x15 0x14 0x13 0x12 0x11 0x10))
+
+(assert_return
+  (invoke "i32x4.relaxed_trunc_f32x4_s" (v128.const f32x4 1.5 -2.5 100.9 -0.5))
+  (v128.const i32x4 1 -2 100 0))
+(assert_return
+  (invoke "i32x4.relaxed_trunc_f32x4_u" (v128.const f32x4 1.5 2.5 3000000000.0 0.5))
+  (v128.const i32x4 1 2 3000000000 0))
+(assert_return
+  (invoke "i32x4.relaxed_trunc_f64x2_s_zero" (v128.const f64x2 -3.7 42.2))
+  (v128.const i32x4 -3 42 0 0))
+(assert_return
+  (invoke "i32x4.relaxed_trunc_f64x2_u_zero" (v128.const f64x2 3.7 4000000000.0))
+  (v128.const i32x4 3 4000000000 0 0))
+
+;; The products and sums are exact, so fused and unfused results are the same.
+(assert_return
+  (invoke "f32x4.relaxed_madd"
+    (v128.const f32x4 1 2 3 4) (v128.const f32x4 5 6 7 8) (v128.const f32x4 0.5 0.5 0.5 0.5))
+  (v128.const f32x4 5.5 12.5 21.5 32.5))
+(assert_return
+  (invoke "f32x4.relaxed_nmadd"
+    (v128.const f32x4 1 2 3 4) (v128.const f32x4 5 6 7 8) (v128.const f32x4 0.5 0.5 0.5 0.5))
+  (v128.const f32x4 -4.5 -11.5 -20.5 -31.5))
+(assert_return
+  (invoke "f64x2.relaxed_madd" (v128.const f64x2 3 -4) (v128.const f64x2 5 6) (v128.const f64x2 1 2))
+  (v128.const f64x2 16 -22))
+(assert_return
+  (invoke "f64x2.relaxed_nmadd" (v128.const f64x2 3 -4) (v128.const f64x2 5 6) (v128.const f64x2 1 2))
+  (v128.const f64x2 -14 26))
+
+;; Every lane of the masks is all ones or all zeros.
+(assert_return
+  (invoke "i8x16.relaxed_laneselect"
+    (v128.const i8x16 0x11 0x11 0x11 0x11 0x11 0x11 0x11 0x11 0x11 0x11 0x11 0x11 0x11 0x11 0x11 0x11)
+    (v128.const i8x16 0x22 0x22 0x22 0x22 0x22 0x22 0x22 0x22 0x22 0x22 0x22 0x22 0x22 0x22 0x22 0x22)
+    (v128.const i8x16 -1 0 -1 0 0 0 -1 -1 -1 0 -1 0 0 0 -1 -1))
+  (v128.const i8x16 0x11 0x22 0x11 0x22 0x22 0x22 0x11 0x11 0x11 0x22 0x11 0x22 0x22 0x22 0x11 0x11))
+(assert_return
+  (invoke "i16x8.relaxed_laneselect"
+    (v128.const i16x8 1 2 3 4 5 6 7 8)
+    (v128.const i16x8 -1 -2 -3 -4 -5 -6 -7 -8)
+    (v128.const i16x8 -1 0 0 -1 -1 0 -1 0))
+  (v128.const i16x8 1 -2 -3 4 5 -6 7 -8))
+(assert_return
+  (invoke "i32x4.relaxed_laneselect"
+    (v128.const i32x4 1 2 3 4) (v128.const i32x4 5 6 7 8) (v128.const i32x4 0 -1 -1 0))
+  (v128.const i32x4 5 2 3 8))
+(assert_return
+  (invoke "i64x2.relaxed_laneselect"
+    (v128.const i64x2 1 2) (v128.const i64x2 3 4) (v128.const i64x2 -1 0))
+  (v128.const i64x2 1 4))
+
+;; None of the inputs are NaNs or equal, so the ordering of the operands doesn't matter.
+(assert_return
+  (invoke "f32x4.relaxed_min" (v128.const f32x4 1 -2 3.5 -4) (v128.const f32x4 2 -1 -3.5 4))
+  (v128.const f32x4 1 -2 -3.5 -4))
+(assert_return
+  (invoke "f32x4.relaxed_max" (v128.const f32x4 1 -2 3.5 -4) (v128.const f32x4 2 -1 -3.5 4))
+  (v128.const f32x4 2 -1 3.5 4))
+(assert_return
+  (invoke "f64x2.relaxed_min" (v128.const f64x2 1.25 -8) (v128.const f64x2 -1.25 8))
+  (v128.const f64x2 -1.25 -8))
+(assert_return
+  (invoke "f64x2.relaxed_max" (v128.const f64x2 1.25 -8) (v128.const f64x2 -1.25 8))
+  (v128.const f64x2 1.25 8))
+
+;; None of the products are -32768 * -32768, which is the only input that may overflow.
+(assert_return
+  (invoke "i16x8.relaxed_q15mulr_s"
+    (v128.const i16x8 16384 -16384 100 -100 32767 12345 -32767 0)
+    (v128.const i16x8 16384 16384 200 300 32767 -23456 -32767 5))
+  (v128.const i16x8 8192 -8192 1 -1 32766 -8837 32766 0))
+
+;; The second operand is in [0, 127], so it's the same interpreted as signed or unsigned.
+(assert_return
+  (invoke "i16x8.relaxed_dot_i8x16_i7x16_s"
+    (v128.const i8x16 1 -2 3 -4 5 -6 7 -8 9 -10 11 -12 13 -14 15 -16)
+    (v128.const i8x16 1 2 3 4 5 6 7 8 9 10 11 12 13 14 127 100))
+  (v128.const i16x8 -3 -7 -11 -15 -19 -23 -27 305))
+(assert_return
+  (invoke "i32x4.relaxed_dot_i8x16_i7x16_add_s"
+    (v128.const i8x16 1 -2 3 -4 5 -6 7 -8 9 -10 11 -12 13 -14 15 -16)
+    (v128.const i8x16 1 2 3 4 5 6 7 8 9 10 11 12 13 14 127 100)
+    (v128.const i32x4 1000 -1000 7 0))
+  (v128.const i32x4 990 -1026 -35 278))
+
+;; The binary encoding of relaxed SIMD operators is 0xfd followed by a varuint32 in [0x100, 0x113].
+;; This module exports "madd", which is equivalent to the f32x4.relaxed_madd function above.
+(module binary
+  "\00asm" "\01\00\00\00"
+  "\01\08\01\60\03\7b\7b\7b\01\7b"
+  "\03\02\01\00"
+  "\07\08\01\04madd\00\00"
+  "\0a\0d\01\0b\00\20\00\20\01\20\02\fd\85\02\0b"
+)
+(assert_return
+  (invoke "madd"
+    (v128.const f32x4 1 2 3 4) (v128.const f32x4 5 6 7 8) (v128.const f32x4 0.5 0.5 0.5 0.5))
+  (v128.const f32x4 5.5 12.5 21.5 32.5))
+
+;; 0xfd 0x80 0x04 (0x200) isn't a valid SIMD opcode.
+(assert_malformed
+  (module binary
+    "\00asm" "\01\00\00\00"
+    "\01\08\01\60\03\7b\7b\7b\01\7b"
+    "\03\02\01\00"
+    "\07\08\01\04madd\00\00"
+    "\0a\0d\01\0b\00\20\00\20\01\20\02\fd\80\04\0b"
+  )
+  "unknown operator"
+)